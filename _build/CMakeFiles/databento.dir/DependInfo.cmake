@@ -0,0 +1,85 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/bar_aggregator.cpp" "CMakeFiles/databento.dir/src/bar_aggregator.cpp.o" "gcc" "CMakeFiles/databento.dir/src/bar_aggregator.cpp.o.d"
+  "/root/repo/src/batch.cpp" "CMakeFiles/databento.dir/src/batch.cpp.o" "gcc" "CMakeFiles/databento.dir/src/batch.cpp.o.d"
+  "/root/repo/src/book_analytics.cpp" "CMakeFiles/databento.dir/src/book_analytics.cpp.o" "gcc" "CMakeFiles/databento.dir/src/book_analytics.cpp.o.d"
+  "/root/repo/src/coalescing_symbology_resolver.cpp" "CMakeFiles/databento.dir/src/coalescing_symbology_resolver.cpp.o" "gcc" "CMakeFiles/databento.dir/src/coalescing_symbology_resolver.cpp.o.d"
+  "/root/repo/src/columnar.cpp" "CMakeFiles/databento.dir/src/columnar.cpp.o" "gcc" "CMakeFiles/databento.dir/src/columnar.cpp.o.d"
+  "/root/repo/src/compat.cpp" "CMakeFiles/databento.dir/src/compat.cpp.o" "gcc" "CMakeFiles/databento.dir/src/compat.cpp.o.d"
+  "/root/repo/src/conflation_table.cpp" "CMakeFiles/databento.dir/src/conflation_table.cpp.o" "gcc" "CMakeFiles/databento.dir/src/conflation_table.cpp.o.d"
+  "/root/repo/src/corpus_generator.cpp" "CMakeFiles/databento.dir/src/corpus_generator.cpp.o" "gcc" "CMakeFiles/databento.dir/src/corpus_generator.cpp.o.d"
+  "/root/repo/src/csv_encoder.cpp" "CMakeFiles/databento.dir/src/csv_encoder.cpp.o" "gcc" "CMakeFiles/databento.dir/src/csv_encoder.cpp.o.d"
+  "/root/repo/src/dataset_reader.cpp" "CMakeFiles/databento.dir/src/dataset_reader.cpp.o" "gcc" "CMakeFiles/databento.dir/src/dataset_reader.cpp.o.d"
+  "/root/repo/src/datetime.cpp" "CMakeFiles/databento.dir/src/datetime.cpp.o" "gcc" "CMakeFiles/databento.dir/src/datetime.cpp.o.d"
+  "/root/repo/src/dbn.cpp" "CMakeFiles/databento.dir/src/dbn.cpp.o" "gcc" "CMakeFiles/databento.dir/src/dbn.cpp.o.d"
+  "/root/repo/src/dbn_decoder.cpp" "CMakeFiles/databento.dir/src/dbn_decoder.cpp.o" "gcc" "CMakeFiles/databento.dir/src/dbn_decoder.cpp.o.d"
+  "/root/repo/src/dbn_encoder.cpp" "CMakeFiles/databento.dir/src/dbn_encoder.cpp.o" "gcc" "CMakeFiles/databento.dir/src/dbn_encoder.cpp.o.d"
+  "/root/repo/src/dbn_file_store.cpp" "CMakeFiles/databento.dir/src/dbn_file_store.cpp.o" "gcc" "CMakeFiles/databento.dir/src/dbn_file_store.cpp.o.d"
+  "/root/repo/src/dbn_time_index.cpp" "CMakeFiles/databento.dir/src/dbn_time_index.cpp.o" "gcc" "CMakeFiles/databento.dir/src/dbn_time_index.cpp.o.d"
+  "/root/repo/src/detail/buffer_channel.cpp" "CMakeFiles/databento.dir/src/detail/buffer_channel.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/buffer_channel.cpp.o.d"
+  "/root/repo/src/detail/buffer_pool.cpp" "CMakeFiles/databento.dir/src/detail/buffer_pool.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/buffer_pool.cpp.o.d"
+  "/root/repo/src/detail/file_stream.cpp" "CMakeFiles/databento.dir/src/detail/file_stream.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/file_stream.cpp.o.d"
+  "/root/repo/src/detail/file_write_stream.cpp" "CMakeFiles/databento.dir/src/detail/file_write_stream.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/file_write_stream.cpp.o.d"
+  "/root/repo/src/detail/http_client.cpp" "CMakeFiles/databento.dir/src/detail/http_client.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/http_client.cpp.o.d"
+  "/root/repo/src/detail/io_uring_receiver.cpp" "CMakeFiles/databento.dir/src/detail/io_uring_receiver.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/io_uring_receiver.cpp.o.d"
+  "/root/repo/src/detail/journal_writer.cpp" "CMakeFiles/databento.dir/src/detail/journal_writer.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/journal_writer.cpp.o.d"
+  "/root/repo/src/detail/json_helpers.cpp" "CMakeFiles/databento.dir/src/detail/json_helpers.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/json_helpers.cpp.o.d"
+  "/root/repo/src/detail/lz4_compress_stream.cpp" "CMakeFiles/databento.dir/src/detail/lz4_compress_stream.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/lz4_compress_stream.cpp.o.d"
+  "/root/repo/src/detail/lz4_stream.cpp" "CMakeFiles/databento.dir/src/detail/lz4_stream.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/lz4_stream.cpp.o.d"
+  "/root/repo/src/detail/mmap_file_stream.cpp" "CMakeFiles/databento.dir/src/detail/mmap_file_stream.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/mmap_file_stream.cpp.o.d"
+  "/root/repo/src/detail/prefetch_stream.cpp" "CMakeFiles/databento.dir/src/detail/prefetch_stream.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/prefetch_stream.cpp.o.d"
+  "/root/repo/src/detail/request_thread_pool.cpp" "CMakeFiles/databento.dir/src/detail/request_thread_pool.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/request_thread_pool.cpp.o.d"
+  "/root/repo/src/detail/response_cache.cpp" "CMakeFiles/databento.dir/src/detail/response_cache.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/response_cache.cpp.o.d"
+  "/root/repo/src/detail/scoped_fd.cpp" "CMakeFiles/databento.dir/src/detail/scoped_fd.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/scoped_fd.cpp.o.d"
+  "/root/repo/src/detail/seekable_zstd_stream.cpp" "CMakeFiles/databento.dir/src/detail/seekable_zstd_stream.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/seekable_zstd_stream.cpp.o.d"
+  "/root/repo/src/detail/shared_channel.cpp" "CMakeFiles/databento.dir/src/detail/shared_channel.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/shared_channel.cpp.o.d"
+  "/root/repo/src/detail/spsc_record_queue.cpp" "CMakeFiles/databento.dir/src/detail/spsc_record_queue.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/spsc_record_queue.cpp.o.d"
+  "/root/repo/src/detail/tcp_client.cpp" "CMakeFiles/databento.dir/src/detail/tcp_client.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/tcp_client.cpp.o.d"
+  "/root/repo/src/detail/work_stealing_executor.cpp" "CMakeFiles/databento.dir/src/detail/work_stealing_executor.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/work_stealing_executor.cpp.o.d"
+  "/root/repo/src/detail/zstd_compress_stream.cpp" "CMakeFiles/databento.dir/src/detail/zstd_compress_stream.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/zstd_compress_stream.cpp.o.d"
+  "/root/repo/src/detail/zstd_stream.cpp" "CMakeFiles/databento.dir/src/detail/zstd_stream.cpp.o" "gcc" "CMakeFiles/databento.dir/src/detail/zstd_stream.cpp.o.d"
+  "/root/repo/src/enums.cpp" "CMakeFiles/databento.dir/src/enums.cpp.o" "gcc" "CMakeFiles/databento.dir/src/enums.cpp.o.d"
+  "/root/repo/src/exceptions.cpp" "CMakeFiles/databento.dir/src/exceptions.cpp.o" "gcc" "CMakeFiles/databento.dir/src/exceptions.cpp.o.d"
+  "/root/repo/src/fixed_price.cpp" "CMakeFiles/databento.dir/src/fixed_price.cpp.o" "gcc" "CMakeFiles/databento.dir/src/fixed_price.cpp.o.d"
+  "/root/repo/src/historical.cpp" "CMakeFiles/databento.dir/src/historical.cpp.o" "gcc" "CMakeFiles/databento.dir/src/historical.cpp.o.d"
+  "/root/repo/src/instrument_def_cache.cpp" "CMakeFiles/databento.dir/src/instrument_def_cache.cpp.o" "gcc" "CMakeFiles/databento.dir/src/instrument_def_cache.cpp.o.d"
+  "/root/repo/src/instrument_state_cache.cpp" "CMakeFiles/databento.dir/src/instrument_state_cache.cpp.o" "gcc" "CMakeFiles/databento.dir/src/instrument_state_cache.cpp.o.d"
+  "/root/repo/src/ireadable.cpp" "CMakeFiles/databento.dir/src/ireadable.cpp.o" "gcc" "CMakeFiles/databento.dir/src/ireadable.cpp.o.d"
+  "/root/repo/src/json_encoder.cpp" "CMakeFiles/databento.dir/src/json_encoder.cpp.o" "gcc" "CMakeFiles/databento.dir/src/json_encoder.cpp.o.d"
+  "/root/repo/src/latency_histogram.cpp" "CMakeFiles/databento.dir/src/latency_histogram.cpp.o" "gcc" "CMakeFiles/databento.dir/src/latency_histogram.cpp.o.d"
+  "/root/repo/src/live.cpp" "CMakeFiles/databento.dir/src/live.cpp.o" "gcc" "CMakeFiles/databento.dir/src/live.cpp.o.d"
+  "/root/repo/src/live_blocking.cpp" "CMakeFiles/databento.dir/src/live_blocking.cpp.o" "gcc" "CMakeFiles/databento.dir/src/live_blocking.cpp.o.d"
+  "/root/repo/src/live_hot_standby.cpp" "CMakeFiles/databento.dir/src/live_hot_standby.cpp.o" "gcc" "CMakeFiles/databento.dir/src/live_hot_standby.cpp.o.d"
+  "/root/repo/src/live_session_group.cpp" "CMakeFiles/databento.dir/src/live_session_group.cpp.o" "gcc" "CMakeFiles/databento.dir/src/live_session_group.cpp.o.d"
+  "/root/repo/src/live_threaded.cpp" "CMakeFiles/databento.dir/src/live_threaded.cpp.o" "gcc" "CMakeFiles/databento.dir/src/live_threaded.cpp.o.d"
+  "/root/repo/src/log.cpp" "CMakeFiles/databento.dir/src/log.cpp.o" "gcc" "CMakeFiles/databento.dir/src/log.cpp.o.d"
+  "/root/repo/src/metadata.cpp" "CMakeFiles/databento.dir/src/metadata.cpp.o" "gcc" "CMakeFiles/databento.dir/src/metadata.cpp.o.d"
+  "/root/repo/src/multi_file_replay.cpp" "CMakeFiles/databento.dir/src/multi_file_replay.cpp.o" "gcc" "CMakeFiles/databento.dir/src/multi_file_replay.cpp.o.d"
+  "/root/repo/src/order_book.cpp" "CMakeFiles/databento.dir/src/order_book.cpp.o" "gcc" "CMakeFiles/databento.dir/src/order_book.cpp.o.d"
+  "/root/repo/src/paced_replay.cpp" "CMakeFiles/databento.dir/src/paced_replay.cpp.o" "gcc" "CMakeFiles/databento.dir/src/paced_replay.cpp.o.d"
+  "/root/repo/src/partitioned_replay.cpp" "CMakeFiles/databento.dir/src/partitioned_replay.cpp.o" "gcc" "CMakeFiles/databento.dir/src/partitioned_replay.cpp.o.d"
+  "/root/repo/src/publishers.cpp" "CMakeFiles/databento.dir/src/publishers.cpp.o" "gcc" "CMakeFiles/databento.dir/src/publishers.cpp.o.d"
+  "/root/repo/src/record.cpp" "CMakeFiles/databento.dir/src/record.cpp.o" "gcc" "CMakeFiles/databento.dir/src/record.cpp.o.d"
+  "/root/repo/src/rotating_dbn_writer.cpp" "CMakeFiles/databento.dir/src/rotating_dbn_writer.cpp.o" "gcc" "CMakeFiles/databento.dir/src/rotating_dbn_writer.cpp.o.d"
+  "/root/repo/src/sequence_tracker.cpp" "CMakeFiles/databento.dir/src/sequence_tracker.cpp.o" "gcc" "CMakeFiles/databento.dir/src/sequence_tracker.cpp.o.d"
+  "/root/repo/src/sharded_dispatcher.cpp" "CMakeFiles/databento.dir/src/sharded_dispatcher.cpp.o" "gcc" "CMakeFiles/databento.dir/src/sharded_dispatcher.cpp.o.d"
+  "/root/repo/src/shm_record_fanout.cpp" "CMakeFiles/databento.dir/src/shm_record_fanout.cpp.o" "gcc" "CMakeFiles/databento.dir/src/shm_record_fanout.cpp.o.d"
+  "/root/repo/src/symbol_intern_pool.cpp" "CMakeFiles/databento.dir/src/symbol_intern_pool.cpp.o" "gcc" "CMakeFiles/databento.dir/src/symbol_intern_pool.cpp.o.d"
+  "/root/repo/src/symbol_map.cpp" "CMakeFiles/databento.dir/src/symbol_map.cpp.o" "gcc" "CMakeFiles/databento.dir/src/symbol_map.cpp.o.d"
+  "/root/repo/src/symbology.cpp" "CMakeFiles/databento.dir/src/symbology.cpp.o" "gcc" "CMakeFiles/databento.dir/src/symbology.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,143 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/databento.dir/src/bar_aggregator.cpp.o"
+  "CMakeFiles/databento.dir/src/bar_aggregator.cpp.o.d"
+  "CMakeFiles/databento.dir/src/batch.cpp.o"
+  "CMakeFiles/databento.dir/src/batch.cpp.o.d"
+  "CMakeFiles/databento.dir/src/book_analytics.cpp.o"
+  "CMakeFiles/databento.dir/src/book_analytics.cpp.o.d"
+  "CMakeFiles/databento.dir/src/coalescing_symbology_resolver.cpp.o"
+  "CMakeFiles/databento.dir/src/coalescing_symbology_resolver.cpp.o.d"
+  "CMakeFiles/databento.dir/src/columnar.cpp.o"
+  "CMakeFiles/databento.dir/src/columnar.cpp.o.d"
+  "CMakeFiles/databento.dir/src/compat.cpp.o"
+  "CMakeFiles/databento.dir/src/compat.cpp.o.d"
+  "CMakeFiles/databento.dir/src/conflation_table.cpp.o"
+  "CMakeFiles/databento.dir/src/conflation_table.cpp.o.d"
+  "CMakeFiles/databento.dir/src/corpus_generator.cpp.o"
+  "CMakeFiles/databento.dir/src/corpus_generator.cpp.o.d"
+  "CMakeFiles/databento.dir/src/csv_encoder.cpp.o"
+  "CMakeFiles/databento.dir/src/csv_encoder.cpp.o.d"
+  "CMakeFiles/databento.dir/src/dataset_reader.cpp.o"
+  "CMakeFiles/databento.dir/src/dataset_reader.cpp.o.d"
+  "CMakeFiles/databento.dir/src/datetime.cpp.o"
+  "CMakeFiles/databento.dir/src/datetime.cpp.o.d"
+  "CMakeFiles/databento.dir/src/dbn.cpp.o"
+  "CMakeFiles/databento.dir/src/dbn.cpp.o.d"
+  "CMakeFiles/databento.dir/src/dbn_decoder.cpp.o"
+  "CMakeFiles/databento.dir/src/dbn_decoder.cpp.o.d"
+  "CMakeFiles/databento.dir/src/dbn_encoder.cpp.o"
+  "CMakeFiles/databento.dir/src/dbn_encoder.cpp.o.d"
+  "CMakeFiles/databento.dir/src/dbn_file_store.cpp.o"
+  "CMakeFiles/databento.dir/src/dbn_file_store.cpp.o.d"
+  "CMakeFiles/databento.dir/src/dbn_time_index.cpp.o"
+  "CMakeFiles/databento.dir/src/dbn_time_index.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/buffer_channel.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/buffer_channel.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/buffer_pool.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/buffer_pool.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/file_stream.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/file_stream.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/file_write_stream.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/file_write_stream.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/http_client.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/http_client.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/io_uring_receiver.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/io_uring_receiver.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/journal_writer.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/journal_writer.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/json_helpers.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/json_helpers.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/lz4_compress_stream.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/lz4_compress_stream.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/lz4_stream.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/lz4_stream.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/mmap_file_stream.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/mmap_file_stream.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/prefetch_stream.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/prefetch_stream.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/request_thread_pool.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/request_thread_pool.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/response_cache.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/response_cache.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/scoped_fd.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/scoped_fd.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/seekable_zstd_stream.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/seekable_zstd_stream.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/shared_channel.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/shared_channel.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/spsc_record_queue.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/spsc_record_queue.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/tcp_client.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/tcp_client.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/work_stealing_executor.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/work_stealing_executor.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/zstd_compress_stream.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/zstd_compress_stream.cpp.o.d"
+  "CMakeFiles/databento.dir/src/detail/zstd_stream.cpp.o"
+  "CMakeFiles/databento.dir/src/detail/zstd_stream.cpp.o.d"
+  "CMakeFiles/databento.dir/src/enums.cpp.o"
+  "CMakeFiles/databento.dir/src/enums.cpp.o.d"
+  "CMakeFiles/databento.dir/src/exceptions.cpp.o"
+  "CMakeFiles/databento.dir/src/exceptions.cpp.o.d"
+  "CMakeFiles/databento.dir/src/fixed_price.cpp.o"
+  "CMakeFiles/databento.dir/src/fixed_price.cpp.o.d"
+  "CMakeFiles/databento.dir/src/historical.cpp.o"
+  "CMakeFiles/databento.dir/src/historical.cpp.o.d"
+  "CMakeFiles/databento.dir/src/instrument_def_cache.cpp.o"
+  "CMakeFiles/databento.dir/src/instrument_def_cache.cpp.o.d"
+  "CMakeFiles/databento.dir/src/instrument_state_cache.cpp.o"
+  "CMakeFiles/databento.dir/src/instrument_state_cache.cpp.o.d"
+  "CMakeFiles/databento.dir/src/ireadable.cpp.o"
+  "CMakeFiles/databento.dir/src/ireadable.cpp.o.d"
+  "CMakeFiles/databento.dir/src/json_encoder.cpp.o"
+  "CMakeFiles/databento.dir/src/json_encoder.cpp.o.d"
+  "CMakeFiles/databento.dir/src/latency_histogram.cpp.o"
+  "CMakeFiles/databento.dir/src/latency_histogram.cpp.o.d"
+  "CMakeFiles/databento.dir/src/live.cpp.o"
+  "CMakeFiles/databento.dir/src/live.cpp.o.d"
+  "CMakeFiles/databento.dir/src/live_blocking.cpp.o"
+  "CMakeFiles/databento.dir/src/live_blocking.cpp.o.d"
+  "CMakeFiles/databento.dir/src/live_hot_standby.cpp.o"
+  "CMakeFiles/databento.dir/src/live_hot_standby.cpp.o.d"
+  "CMakeFiles/databento.dir/src/live_session_group.cpp.o"
+  "CMakeFiles/databento.dir/src/live_session_group.cpp.o.d"
+  "CMakeFiles/databento.dir/src/live_threaded.cpp.o"
+  "CMakeFiles/databento.dir/src/live_threaded.cpp.o.d"
+  "CMakeFiles/databento.dir/src/log.cpp.o"
+  "CMakeFiles/databento.dir/src/log.cpp.o.d"
+  "CMakeFiles/databento.dir/src/metadata.cpp.o"
+  "CMakeFiles/databento.dir/src/metadata.cpp.o.d"
+  "CMakeFiles/databento.dir/src/multi_file_replay.cpp.o"
+  "CMakeFiles/databento.dir/src/multi_file_replay.cpp.o.d"
+  "CMakeFiles/databento.dir/src/order_book.cpp.o"
+  "CMakeFiles/databento.dir/src/order_book.cpp.o.d"
+  "CMakeFiles/databento.dir/src/paced_replay.cpp.o"
+  "CMakeFiles/databento.dir/src/paced_replay.cpp.o.d"
+  "CMakeFiles/databento.dir/src/partitioned_replay.cpp.o"
+  "CMakeFiles/databento.dir/src/partitioned_replay.cpp.o.d"
+  "CMakeFiles/databento.dir/src/publishers.cpp.o"
+  "CMakeFiles/databento.dir/src/publishers.cpp.o.d"
+  "CMakeFiles/databento.dir/src/record.cpp.o"
+  "CMakeFiles/databento.dir/src/record.cpp.o.d"
+  "CMakeFiles/databento.dir/src/rotating_dbn_writer.cpp.o"
+  "CMakeFiles/databento.dir/src/rotating_dbn_writer.cpp.o.d"
+  "CMakeFiles/databento.dir/src/sequence_tracker.cpp.o"
+  "CMakeFiles/databento.dir/src/sequence_tracker.cpp.o.d"
+  "CMakeFiles/databento.dir/src/sharded_dispatcher.cpp.o"
+  "CMakeFiles/databento.dir/src/sharded_dispatcher.cpp.o.d"
+  "CMakeFiles/databento.dir/src/shm_record_fanout.cpp.o"
+  "CMakeFiles/databento.dir/src/shm_record_fanout.cpp.o.d"
+  "CMakeFiles/databento.dir/src/symbol_intern_pool.cpp.o"
+  "CMakeFiles/databento.dir/src/symbol_intern_pool.cpp.o.d"
+  "CMakeFiles/databento.dir/src/symbol_map.cpp.o"
+  "CMakeFiles/databento.dir/src/symbol_map.cpp.o.d"
+  "CMakeFiles/databento.dir/src/symbology.cpp.o"
+  "CMakeFiles/databento.dir/src/symbology.cpp.o.d"
+  "lib/Release/libdatabento.a"
+  "lib/Release/libdatabento.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/databento.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
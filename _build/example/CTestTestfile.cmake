@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/example
+# Build directory: /root/repo/_build/example
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("historical")
+subdirs("live")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/batch.dir/batch.cpp.o"
+  "CMakeFiles/batch.dir/batch.cpp.o.d"
+  "batch"
+  "batch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
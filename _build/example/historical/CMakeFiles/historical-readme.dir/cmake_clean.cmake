@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/historical-readme.dir/readme.cpp.o"
+  "CMakeFiles/historical-readme.dir/readme.cpp.o.d"
+  "historical-readme"
+  "historical-readme.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/historical-readme.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/metadata.dir/metadata.cpp.o"
+  "CMakeFiles/metadata.dir/metadata.cpp.o.d"
+  "metadata"
+  "metadata.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metadata.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/symbology-resolve.dir/symbology_resolve.cpp.o"
+  "CMakeFiles/symbology-resolve.dir/symbology_resolve.cpp.o.d"
+  "symbology-resolve"
+  "symbology-resolve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/symbology-resolve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
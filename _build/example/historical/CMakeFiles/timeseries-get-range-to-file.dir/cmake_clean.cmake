@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timeseries-get-range-to-file.dir/timeseries_get_range_to_file.cpp.o"
+  "CMakeFiles/timeseries-get-range-to-file.dir/timeseries_get_range_to_file.cpp.o.d"
+  "timeseries-get-range-to-file"
+  "timeseries-get-range-to-file.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timeseries-get-range-to-file.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timeseries-get-range.dir/timeseries_get_range.cpp.o"
+  "CMakeFiles/timeseries-get-range.dir/timeseries_get_range.cpp.o.d"
+  "timeseries-get-range"
+  "timeseries-get-range.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timeseries-get-range.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/live-readme.dir/readme.cpp.o"
+  "CMakeFiles/live-readme.dir/readme.cpp.o.d"
+  "live-readme"
+  "live-readme.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/live-readme.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
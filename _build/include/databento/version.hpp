@@ -0,0 +1,10 @@
+#ifndef DATABENTO_VERSION_H_
+#define DATABENTO_VERSION_H_
+
+#define DATABENTO_VERSION "0.16.0"
+
+#define DATABENTO_MAJOR_VERSION 0
+#define DATABENTO_MINOR_VERSION 16
+#define DATABENTO_PATCH_VERSION 0
+
+#endif  // DATABENTO_VERSION_H_
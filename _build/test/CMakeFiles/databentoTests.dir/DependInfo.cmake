@@ -0,0 +1,84 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/src/bar_aggregator_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/bar_aggregator_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/bar_aggregator_tests.cpp.o.d"
+  "/root/repo/test/src/batch_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/batch_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/batch_tests.cpp.o.d"
+  "/root/repo/test/src/book_analytics_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/book_analytics_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/book_analytics_tests.cpp.o.d"
+  "/root/repo/test/src/buffer_channel_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/buffer_channel_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/buffer_channel_tests.cpp.o.d"
+  "/root/repo/test/src/buffer_pool_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/buffer_pool_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/buffer_pool_tests.cpp.o.d"
+  "/root/repo/test/src/coalescing_symbology_resolver_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/coalescing_symbology_resolver_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/coalescing_symbology_resolver_tests.cpp.o.d"
+  "/root/repo/test/src/columnar_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/columnar_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/columnar_tests.cpp.o.d"
+  "/root/repo/test/src/compat_view_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/compat_view_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/compat_view_tests.cpp.o.d"
+  "/root/repo/test/src/conflation_table_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/conflation_table_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/conflation_table_tests.cpp.o.d"
+  "/root/repo/test/src/corpus_generator_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/corpus_generator_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/corpus_generator_tests.cpp.o.d"
+  "/root/repo/test/src/csv_encoder_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/csv_encoder_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/csv_encoder_tests.cpp.o.d"
+  "/root/repo/test/src/dataset_reader_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/dataset_reader_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/dataset_reader_tests.cpp.o.d"
+  "/root/repo/test/src/datetime_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/datetime_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/datetime_tests.cpp.o.d"
+  "/root/repo/test/src/dbn_decoder_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/dbn_decoder_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/dbn_decoder_tests.cpp.o.d"
+  "/root/repo/test/src/dbn_encoder_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/dbn_encoder_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/dbn_encoder_tests.cpp.o.d"
+  "/root/repo/test/src/dbn_file_store_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/dbn_file_store_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/dbn_file_store_tests.cpp.o.d"
+  "/root/repo/test/src/dbn_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/dbn_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/dbn_tests.cpp.o.d"
+  "/root/repo/test/src/dbn_time_index_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/dbn_time_index_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/dbn_time_index_tests.cpp.o.d"
+  "/root/repo/test/src/enums_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/enums_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/enums_tests.cpp.o.d"
+  "/root/repo/test/src/file_stream_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/file_stream_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/file_stream_tests.cpp.o.d"
+  "/root/repo/test/src/fixed_price_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/fixed_price_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/fixed_price_tests.cpp.o.d"
+  "/root/repo/test/src/fixed_string_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/fixed_string_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/fixed_string_tests.cpp.o.d"
+  "/root/repo/test/src/flag_set_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/flag_set_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/flag_set_tests.cpp.o.d"
+  "/root/repo/test/src/historical_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/historical_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/historical_tests.cpp.o.d"
+  "/root/repo/test/src/http_client_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/http_client_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/http_client_tests.cpp.o.d"
+  "/root/repo/test/src/instrument_def_cache_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/instrument_def_cache_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/instrument_def_cache_tests.cpp.o.d"
+  "/root/repo/test/src/instrument_state_cache_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/instrument_state_cache_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/instrument_state_cache_tests.cpp.o.d"
+  "/root/repo/test/src/journal_writer_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/journal_writer_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/journal_writer_tests.cpp.o.d"
+  "/root/repo/test/src/json_encoder_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/json_encoder_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/json_encoder_tests.cpp.o.d"
+  "/root/repo/test/src/latency_histogram_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/latency_histogram_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/latency_histogram_tests.cpp.o.d"
+  "/root/repo/test/src/live_blocking_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/live_blocking_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/live_blocking_tests.cpp.o.d"
+  "/root/repo/test/src/live_hot_standby_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/live_hot_standby_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/live_hot_standby_tests.cpp.o.d"
+  "/root/repo/test/src/live_session_group_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/live_session_group_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/live_session_group_tests.cpp.o.d"
+  "/root/repo/test/src/live_soak_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/live_soak_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/live_soak_tests.cpp.o.d"
+  "/root/repo/test/src/live_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/live_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/live_tests.cpp.o.d"
+  "/root/repo/test/src/live_threaded_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/live_threaded_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/live_threaded_tests.cpp.o.d"
+  "/root/repo/test/src/log_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/log_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/log_tests.cpp.o.d"
+  "/root/repo/test/src/lz4_stream_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/lz4_stream_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/lz4_stream_tests.cpp.o.d"
+  "/root/repo/test/src/metadata_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/metadata_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/metadata_tests.cpp.o.d"
+  "/root/repo/test/src/mmap_file_stream_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/mmap_file_stream_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/mmap_file_stream_tests.cpp.o.d"
+  "/root/repo/test/src/mock_http_server.cpp" "test/CMakeFiles/databentoTests.dir/src/mock_http_server.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/mock_http_server.cpp.o.d"
+  "/root/repo/test/src/mock_lsg_server.cpp" "test/CMakeFiles/databentoTests.dir/src/mock_lsg_server.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/mock_lsg_server.cpp.o.d"
+  "/root/repo/test/src/mock_tcp_server.cpp" "test/CMakeFiles/databentoTests.dir/src/mock_tcp_server.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/mock_tcp_server.cpp.o.d"
+  "/root/repo/test/src/multi_file_replay_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/multi_file_replay_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/multi_file_replay_tests.cpp.o.d"
+  "/root/repo/test/src/order_book_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/order_book_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/order_book_tests.cpp.o.d"
+  "/root/repo/test/src/paced_replay_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/paced_replay_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/paced_replay_tests.cpp.o.d"
+  "/root/repo/test/src/partitioned_replay_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/partitioned_replay_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/partitioned_replay_tests.cpp.o.d"
+  "/root/repo/test/src/prefetch_stream_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/prefetch_stream_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/prefetch_stream_tests.cpp.o.d"
+  "/root/repo/test/src/record_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/record_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/record_tests.cpp.o.d"
+  "/root/repo/test/src/request_thread_pool_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/request_thread_pool_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/request_thread_pool_tests.cpp.o.d"
+  "/root/repo/test/src/rotating_dbn_writer_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/rotating_dbn_writer_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/rotating_dbn_writer_tests.cpp.o.d"
+  "/root/repo/test/src/scoped_thread_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/scoped_thread_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/scoped_thread_tests.cpp.o.d"
+  "/root/repo/test/src/seekable_zstd_stream_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/seekable_zstd_stream_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/seekable_zstd_stream_tests.cpp.o.d"
+  "/root/repo/test/src/sequence_tracker_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/sequence_tracker_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/sequence_tracker_tests.cpp.o.d"
+  "/root/repo/test/src/sharded_dispatcher_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/sharded_dispatcher_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/sharded_dispatcher_tests.cpp.o.d"
+  "/root/repo/test/src/shared_channel_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/shared_channel_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/shared_channel_tests.cpp.o.d"
+  "/root/repo/test/src/shm_record_fanout_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/shm_record_fanout_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/shm_record_fanout_tests.cpp.o.d"
+  "/root/repo/test/src/spsc_record_queue_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/spsc_record_queue_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/spsc_record_queue_tests.cpp.o.d"
+  "/root/repo/test/src/stream_op_helper_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/stream_op_helper_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/stream_op_helper_tests.cpp.o.d"
+  "/root/repo/test/src/symbol_intern_pool_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/symbol_intern_pool_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/symbol_intern_pool_tests.cpp.o.d"
+  "/root/repo/test/src/symbol_map_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/symbol_map_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/symbol_map_tests.cpp.o.d"
+  "/root/repo/test/src/symbology_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/symbology_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/symbology_tests.cpp.o.d"
+  "/root/repo/test/src/tcp_client_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/tcp_client_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/tcp_client_tests.cpp.o.d"
+  "/root/repo/test/src/work_stealing_executor_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/work_stealing_executor_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/work_stealing_executor_tests.cpp.o.d"
+  "/root/repo/test/src/zstd_stream_tests.cpp" "test/CMakeFiles/databentoTests.dir/src/zstd_stream_tests.cpp.o" "gcc" "test/CMakeFiles/databentoTests.dir/src/zstd_stream_tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_build/CMakeFiles/databento.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
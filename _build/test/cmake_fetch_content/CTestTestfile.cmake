@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/cmake_fetch_content
+# Build directory: /root/repo/_build/test/cmake_fetch_content
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(cmake_fetch_content_configure "/usr/bin/cmake" "-G" "Unix Makefiles" "-DCMAKE_CXX_COMPILER=/usr/bin/c++" "/root/repo/test/cmake_fetch_content/project")
+set_tests_properties(cmake_fetch_content_configure PROPERTIES  FIXTURES_SETUP "cmake_fetch_content" _BACKTRACE_TRIPLES "/root/repo/test/cmake_fetch_content/CMakeLists.txt;1;add_test;/root/repo/test/cmake_fetch_content/CMakeLists.txt;0;")
+add_test(cmake_fetch_content_build "/usr/bin/cmake" "--build" ".")
+set_tests_properties(cmake_fetch_content_build PROPERTIES  FIXTURES_REQUIRED "cmake_fetch_content" _BACKTRACE_TRIPLES "/root/repo/test/cmake_fetch_content/CMakeLists.txt;15;add_test;/root/repo/test/cmake_fetch_content/CMakeLists.txt;0;")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_build/test/databentoTests[1]_tests.cmake")
+  include("/root/repo/_build/test/databentoTests[1]_tests.cmake")
+else()
+  add_test(databentoTests_NOT_BUILT databentoTests_NOT_BUILT)
+endif()
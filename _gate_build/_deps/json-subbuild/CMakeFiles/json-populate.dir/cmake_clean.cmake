@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/json-populate"
+  "CMakeFiles/json-populate-complete"
+  "json-populate-prefix/src/json-populate-stamp/json-populate-build"
+  "json-populate-prefix/src/json-populate-stamp/json-populate-configure"
+  "json-populate-prefix/src/json-populate-stamp/json-populate-download"
+  "json-populate-prefix/src/json-populate-stamp/json-populate-install"
+  "json-populate-prefix/src/json-populate-stamp/json-populate-mkdir"
+  "json-populate-prefix/src/json-populate-stamp/json-populate-patch"
+  "json-populate-prefix/src/json-populate-stamp/json-populate-test"
+  "json-populate-prefix/src/json-populate-stamp/json-populate-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/json-populate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <cstring>  // memcpy
+#include <vector>
+
+#include "databento/ireadable.hpp"
+#include "databento/iwritable.hpp"
+
+namespace databento {
+namespace benchmarks {
+// An IWritable appending everything written to a caller-owned buffer, used
+// to stage encoded input for the benchmarks. The buffer outliving the writer
+// means staged bytes survive writers that flush on destruction.
+class MemoryWritable : public IWritable {
+ public:
+  explicit MemoryWritable(std::vector<std::uint8_t>* buffer)
+      : buffer_{buffer} {}
+
+  void WriteAll(const std::uint8_t* buffer, std::size_t length) override {
+    buffer_->insert(buffer_->end(), buffer, buffer + length);
+  }
+
+ private:
+  std::vector<std::uint8_t>* buffer_;
+};
+
+// An IReadable over a borrowed buffer. Seek back to zero between benchmark
+// iterations to decode the same bytes again.
+class MemoryReadable : public IReadable {
+ public:
+  explicit MemoryReadable(const std::vector<std::uint8_t>* buffer)
+      : buffer_{buffer} {}
+
+  void ReadExact(std::uint8_t* buffer, std::size_t length) override {
+    std::memcpy(buffer, buffer_->data() + pos_, length);
+    pos_ += length;
+  }
+
+  std::size_t ReadSome(std::uint8_t* buffer, std::size_t max_length) override {
+    const auto remaining = buffer_->size() - pos_;
+    const auto length = remaining < max_length ? remaining : max_length;
+    std::memcpy(buffer, buffer_->data() + pos_, length);
+    pos_ += length;
+    return length;
+  }
+
+  bool CanSeek() const override { return true; }
+  void Seek(std::size_t offset) override { pos_ = offset; }
+
+ private:
+  const std::vector<std::uint8_t>* buffer_;
+  std::size_t pos_{};
+};
+}  // namespace benchmarks
+}  // namespace databento
@@ -0,0 +1,201 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <memory>  // unique_ptr
+#include <vector>
+
+#include "databento/constants.hpp"  // dataset, kDbnVersion, kSymbolCstrLen
+#include "databento/datetime.hpp"
+#include "databento/dbn.hpp"
+#include "databento/dbn_decoder.hpp"
+#include "databento/dbn_encoder.hpp"
+#include "databento/enums.hpp"
+#include "databento/record.hpp"
+#include "memory_io.hpp"
+
+namespace {
+using databento::Action;
+using databento::BidAskPair;
+using databento::DbnDecoder;
+using databento::DbnEncoder;
+using databento::FlagSet;
+using databento::IReadable;
+using databento::MboMsg;
+using databento::Mbp10Msg;
+using databento::Metadata;
+using databento::Record;
+using databento::RecordHeader;
+using databento::RType;
+using databento::Schema;
+using databento::Side;
+using databento::TimeDeltaNanos;
+using databento::TradeMsg;
+using databento::UnixNanos;
+using databento::benchmarks::MemoryReadable;
+using databento::benchmarks::MemoryWritable;
+
+constexpr std::size_t kRecordCount = 10000;
+
+Metadata MakeMetadata(Schema schema) {
+  Metadata metadata{};
+  metadata.version = databento::kDbnVersion;
+  metadata.dataset = databento::dataset::kXnasItch;
+  metadata.schema = schema;
+  metadata.start = UnixNanos{std::chrono::seconds{1}};
+  metadata.stype_in = databento::SType::RawSymbol;
+  metadata.stype_out = databento::SType::InstrumentId;
+  metadata.symbol_cstr_len = databento::kSymbolCstrLen;
+  return metadata;
+}
+
+template <typename R>
+RecordHeader MakeHeader(RType rtype, std::size_t index) {
+  return {sizeof(R) / RecordHeader::kLengthMultiplier, rtype, 1,
+          static_cast<std::uint32_t>(index % 16 + 1),
+          UnixNanos{std::chrono::nanoseconds{1000000000 + index}}};
+}
+
+template <typename R>
+std::vector<std::uint8_t> EncodeRecords(Schema schema,
+                                        std::vector<R> (*make_records)()) {
+  std::vector<std::uint8_t> buffer;
+  MemoryWritable output{&buffer};
+  DbnEncoder encoder{MakeMetadata(schema), &output};
+  for (const auto& record : make_records()) {
+    encoder.EncodeRecord(Record{const_cast<RecordHeader*>(&record.hd)});
+  }
+  return buffer;
+}
+
+std::vector<MboMsg> MakeMboRecords() {
+  std::vector<MboMsg> records;
+  for (std::size_t i = 0; i < kRecordCount; ++i) {
+    MboMsg record{};
+    record.hd = MakeHeader<MboMsg>(RType::Mbo, i);
+    record.order_id = 1000000 + i;
+    record.price = 3722750000000LL + static_cast<std::int64_t>(i) * 250000;
+    record.size = static_cast<std::uint32_t>(i % 10 + 1);
+    record.flags = FlagSet{128};
+    record.action = Action::Add;
+    record.side = i % 2 == 0 ? Side::Bid : Side::Ask;
+    record.ts_recv = record.hd.ts_event;
+    record.ts_in_delta = TimeDeltaNanos{100};
+    record.sequence = static_cast<std::uint32_t>(i);
+    records.emplace_back(record);
+  }
+  return records;
+}
+
+std::vector<TradeMsg> MakeTradeRecords() {
+  std::vector<TradeMsg> records;
+  for (std::size_t i = 0; i < kRecordCount; ++i) {
+    TradeMsg record{};
+    record.hd = MakeHeader<TradeMsg>(RType::Mbp0, i);
+    record.price = 3722750000000LL + static_cast<std::int64_t>(i) * 250000;
+    record.size = static_cast<std::uint32_t>(i % 10 + 1);
+    record.action = Action::Trade;
+    record.side = Side::None;
+    record.ts_recv = record.hd.ts_event;
+    record.sequence = static_cast<std::uint32_t>(i);
+    records.emplace_back(record);
+  }
+  return records;
+}
+
+std::vector<Mbp10Msg> MakeMbp10Records() {
+  std::vector<Mbp10Msg> records;
+  for (std::size_t i = 0; i < kRecordCount; ++i) {
+    Mbp10Msg record{};
+    record.hd = MakeHeader<Mbp10Msg>(RType::Mbp10, i);
+    record.price = 3722750000000LL + static_cast<std::int64_t>(i) * 250000;
+    record.size = 1;
+    record.action = Action::Trade;
+    record.side = Side::Ask;
+    record.ts_recv = record.hd.ts_event;
+    record.sequence = static_cast<std::uint32_t>(i);
+    for (std::size_t level = 0; level < 10; ++level) {
+      record.levels[level] =
+          BidAskPair{3722000000000LL + static_cast<std::int64_t>(level),
+                     3723000000000LL + static_cast<std::int64_t>(level),
+                     10,
+                     20,
+                     1,
+                     2};
+    }
+    records.emplace_back(record);
+  }
+  return records;
+}
+
+// Decodes kRecordCount records of one schema per iteration, reporting
+// records/sec and bytes/sec.
+template <typename R>
+void DecodeRecords(benchmark::State& state, Schema schema,
+                   std::vector<R> (*make_records)()) {
+  const auto input = EncodeRecords<R>(schema, make_records);
+  for (auto _ : state) {
+    state.PauseTiming();
+    DbnDecoder decoder{
+        std::unique_ptr<IReadable>{new MemoryReadable{&input}}};
+    decoder.DecodeMetadata();
+    state.ResumeTiming();
+    std::size_t count = 0;
+    while (decoder.DecodeRecord() != nullptr) {
+      ++count;
+    }
+    if (count != kRecordCount) {
+      state.SkipWithError("decoded an unexpected number of records");
+    }
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(kRecordCount));
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(input.size()));
+}
+
+void BM_DecodeRecordMbo(benchmark::State& state) {
+  DecodeRecords<MboMsg>(state, Schema::Mbo, MakeMboRecords);
+}
+BENCHMARK(BM_DecodeRecordMbo);
+
+void BM_DecodeRecordTrades(benchmark::State& state) {
+  DecodeRecords<TradeMsg>(state, Schema::Trades, MakeTradeRecords);
+}
+BENCHMARK(BM_DecodeRecordTrades);
+
+void BM_DecodeRecordMbp10(benchmark::State& state) {
+  DecodeRecords<Mbp10Msg>(state, Schema::Mbp10, MakeMbp10Records);
+}
+BENCHMARK(BM_DecodeRecordMbp10);
+
+// The batched decode loop over the same MBO input for comparison with
+// record-at-a-time decoding.
+void BM_DecodeRecordsMbo(benchmark::State& state) {
+  const auto input = EncodeRecords<MboMsg>(Schema::Mbo, MakeMboRecords);
+  for (auto _ : state) {
+    state.PauseTiming();
+    DbnDecoder decoder{
+        std::unique_ptr<IReadable>{new MemoryReadable{&input}}};
+    decoder.DecodeMetadata();
+    state.ResumeTiming();
+    std::size_t count = 0;
+    while (true) {
+      const auto& batch = decoder.DecodeRecords();
+      if (batch.empty()) {
+        break;
+      }
+      count += batch.size();
+    }
+    if (count != kRecordCount) {
+      state.SkipWithError("decoded an unexpected number of records");
+    }
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(kRecordCount));
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(input.size()));
+}
+BENCHMARK(BM_DecodeRecordsMbo);
+}  // namespace
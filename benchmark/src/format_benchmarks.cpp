@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>  // size_t
+#include <cstdint>
+
+#include "databento/datetime.hpp"  // ToIso8601Chars, kIso8601MaxStrLen
+#include "databento/enums.hpp"
+#include "databento/fixed_price.hpp"  // PxToChars, kFixPxMaxStrLen
+
+namespace {
+using databento::Schema;
+using databento::UnixNanos;
+
+// Enum name lookups, items/sec across every schema value
+void BM_ToStringSchema(benchmark::State& state) {
+  for (auto _ : state) {
+    for (std::uint16_t raw = 0; raw < 16; ++raw) {
+      benchmark::DoNotOptimize(ToString(static_cast<Schema>(raw)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 16);
+}
+BENCHMARK(BM_ToStringSchema);
+
+void BM_FromStringSchema(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(databento::FromString<Schema>("mbp-10"));
+    benchmark::DoNotOptimize(databento::FromString<Schema>("ohlcv-1s"));
+    benchmark::DoNotOptimize(databento::FromString<Schema>("trades"));
+  }
+  state.SetItemsProcessed(state.iterations() * 3);
+}
+BENCHMARK(BM_FromStringSchema);
+
+// Fixed-price formatting, items/sec over a spread of magnitudes
+void BM_PxToChars(benchmark::State& state) {
+  char buffer[databento::kFixPxMaxStrLen];
+  std::int64_t px = 1;
+  for (auto _ : state) {
+    px = px * 31 % 9000000000000000000LL;
+    benchmark::DoNotOptimize(
+        databento::PxToChars(px, buffer, buffer + sizeof(buffer)));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PxToChars);
+
+// ISO 8601 timestamp formatting, items/sec
+void BM_ToIso8601Chars(benchmark::State& state) {
+  char buffer[databento::kIso8601MaxStrLen];
+  std::uint64_t nanos = 1609160400000000000ULL;
+  for (auto _ : state) {
+    nanos += 1000000007;
+    benchmark::DoNotOptimize(databento::ToIso8601Chars(
+        UnixNanos{std::chrono::nanoseconds{nanos}}, buffer,
+        buffer + sizeof(buffer)));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ToIso8601Chars);
+}  // namespace
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "databento/detail/shared_channel.hpp"
+
+namespace {
+using databento::detail::SharedChannel;
+
+constexpr std::size_t kTransferSize = 64UL * 1024 * 1024;
+
+// Producer/consumer throughput in bytes/sec for a given write chunk size,
+// with the consumer reading on the benchmark thread
+void BM_SharedChannelThroughput(benchmark::State& state) {
+  const auto chunk_size = static_cast<std::size_t>(state.range(0));
+  std::vector<std::uint8_t> write_chunk(chunk_size, 0xAB);
+  std::vector<std::uint8_t> read_chunk(64UL * 1024);
+  for (auto _ : state) {
+    SharedChannel channel;
+    std::thread producer{[channel, &write_chunk]() mutable {
+      for (std::size_t written = 0; written < kTransferSize;
+           written += write_chunk.size()) {
+        channel.Write(write_chunk.data(), write_chunk.size());
+      }
+      channel.Finish();
+    }};
+    std::size_t total = 0;
+    while (true) {
+      const auto read_size =
+          channel.ReadSome(read_chunk.data(), read_chunk.size());
+      if (read_size == 0) {
+        break;
+      }
+      total += read_size;
+    }
+    producer.join();
+    if (total != kTransferSize) {
+      state.SkipWithError("read an unexpected number of bytes");
+    }
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(kTransferSize));
+}
+// Chunk sizes spanning single records to full socket reads
+BENCHMARK(BM_SharedChannelThroughput)
+    ->RangeMultiplier(8)
+    ->Range(64, 64 * 1024)
+    ->UseRealTime();
+}  // namespace
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <cstdio>   // snprintf
+#include <cstring>  // strncpy
+#include <vector>
+
+#include "databento/constants.hpp"  // kSymbolCstrLen
+#include "databento/datetime.hpp"
+#include "databento/enums.hpp"
+#include "databento/record.hpp"
+#include "databento/symbol_map.hpp"
+
+namespace {
+using databento::PitSymbolMap;
+using databento::Record;
+using databento::RecordHeader;
+using databento::RType;
+using databento::SType;
+using databento::SymbolMappingMsg;
+using databento::UnixNanos;
+
+constexpr std::size_t kInstrumentCount = 1000;
+
+std::vector<SymbolMappingMsg> MakeMappings() {
+  std::vector<SymbolMappingMsg> mappings;
+  for (std::size_t i = 0; i < kInstrumentCount; ++i) {
+    SymbolMappingMsg mapping{};
+    mapping.hd = {sizeof(SymbolMappingMsg) / RecordHeader::kLengthMultiplier,
+                  RType::SymbolMapping, 1, static_cast<std::uint32_t>(i + 1),
+                  UnixNanos{std::chrono::nanoseconds{1000000000}}};
+    mapping.stype_in = SType::RawSymbol;
+    mapping.stype_out = SType::InstrumentId;
+    char symbol[databento::kSymbolCstrLen];
+    std::snprintf(symbol, sizeof(symbol), "SYMBOL%zu", i);
+    std::strncpy(mapping.stype_in_symbol.data(), symbol,
+                 mapping.stype_in_symbol.size());
+    std::strncpy(mapping.stype_out_symbol.data(), symbol,
+                 mapping.stype_out_symbol.size());
+    mappings.emplace_back(mapping);
+  }
+  return mappings;
+}
+
+// Applies a full day's worth of mappings to the map, reporting mappings/sec.
+// Repeated updates to the same instruments exercise the assign path as well
+// as insertion.
+void BM_PitSymbolMapOnRecord(benchmark::State& state) {
+  const auto mappings = MakeMappings();
+  for (auto _ : state) {
+    PitSymbolMap symbol_map;
+    for (const auto& mapping : mappings) {
+      symbol_map.OnRecord(
+          Record{const_cast<RecordHeader*>(&mapping.hd)});
+    }
+    for (const auto& mapping : mappings) {
+      symbol_map.OnRecord(
+          Record{const_cast<RecordHeader*>(&mapping.hd)});
+    }
+    if (symbol_map.Size() != kInstrumentCount) {
+      state.SkipWithError("unexpected symbol map size");
+    }
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(2 * kInstrumentCount));
+}
+BENCHMARK(BM_PitSymbolMapOnRecord);
+}  // namespace
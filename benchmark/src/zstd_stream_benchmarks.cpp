@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <memory>  // unique_ptr
+#include <vector>
+
+#include "databento/detail/zstd_compress_stream.hpp"
+#include "databento/detail/zstd_stream.hpp"
+#include "databento/ireadable.hpp"
+#include "databento/iwritable.hpp"
+#include "memory_io.hpp"
+
+namespace {
+using databento::IReadable;
+using databento::IWritable;
+using databento::benchmarks::MemoryReadable;
+using databento::benchmarks::MemoryWritable;
+
+constexpr std::size_t kUncompressedSize = 8UL * 1024 * 1024;
+constexpr std::size_t kReadChunkSize = 64UL * 1024;
+
+// Record-like repetitive bytes so compression ratios resemble market data
+// rather than random noise
+std::vector<std::uint8_t> MakeUncompressed() {
+  std::vector<std::uint8_t> res(kUncompressedSize);
+  std::uint64_t price = 3722750000000ULL;
+  for (std::size_t i = 0; i < res.size(); i += 8) {
+    price += i % 64 == 0 ? 250000 : 0;
+    for (std::size_t byte = 0; byte < 8 && i + byte < res.size(); ++byte) {
+      res[i + byte] = static_cast<std::uint8_t>(price >> (byte * 8));
+    }
+  }
+  return res;
+}
+
+std::vector<std::uint8_t> Compress(
+    const std::vector<std::uint8_t>& uncompressed) {
+  std::vector<std::uint8_t> buffer;
+  {
+    // Scoped so the frame is finished before the buffer is returned
+    databento::detail::ZstdCompressStream compressor{
+        std::unique_ptr<IWritable>{new MemoryWritable{&buffer}}};
+    compressor.WriteAll(uncompressed.data(), uncompressed.size());
+  }
+  return buffer;
+}
+
+// Decompression throughput in uncompressed bytes/sec, reading through
+// ZstdStream the way DbnDecoder does.
+void BM_ZstdStreamDecompress(benchmark::State& state) {
+  const auto uncompressed = MakeUncompressed();
+  const auto compressed = Compress(uncompressed);
+  std::vector<std::uint8_t> read_buffer(kReadChunkSize);
+  for (auto _ : state) {
+    databento::detail::ZstdStream stream{
+        std::unique_ptr<IReadable>{new MemoryReadable{&compressed}}};
+    std::size_t total = 0;
+    while (true) {
+      const auto read_size =
+          stream.ReadSome(read_buffer.data(), read_buffer.size());
+      if (read_size == 0) {
+        break;
+      }
+      total += read_size;
+    }
+    if (total != kUncompressedSize) {
+      state.SkipWithError("decompressed an unexpected number of bytes");
+    }
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(kUncompressedSize));
+}
+BENCHMARK(BM_ZstdStreamDecompress);
+
+// Compression throughput in uncompressed bytes/sec
+void BM_ZstdStreamCompress(benchmark::State& state) {
+  const auto uncompressed = MakeUncompressed();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Compress(uncompressed));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(kUncompressedSize));
+}
+BENCHMARK(BM_ZstdStreamCompress);
+}  // namespace
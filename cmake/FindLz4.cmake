@@ -0,0 +1,54 @@
+include(FindPackageHandleStandardArgs)
+
+find_library(LZ4_LIBRARY NAMES lz4)
+find_path(LZ4_INCLUDE_DIR NAMES lz4frame.h)
+
+#
+# Detect version
+#
+if(LZ4_INCLUDE_DIR)
+  file(
+    STRINGS "${LZ4_INCLUDE_DIR}/lz4.h"
+    version-file
+    REGEX "^#define[ \t]+LZ4_VERSION_(MAJOR|MINOR|RELEASE).*$"
+  )
+  if(NOT version-file)
+    message(AUTHOR_WARNING "LZ4_INCLUDE_DIR found, but missing version info")
+  endif()
+  list(GET version-file 0 major-line)
+  list(GET version-file 1 minor-line)
+  list(GET version-file 2 patch-line)
+  # The version lines carry trailing comments, so match the number after the
+  # macro name rather than anchoring to the end of the line
+  string(REGEX REPLACE "^#define[ \t]+LZ4_VERSION_[A-Z]+[ \t]+([0-9]+).*$" "\\1" LZ4_VERSION_MAJOR ${major-line})
+  string(REGEX REPLACE "^#define[ \t]+LZ4_VERSION_[A-Z]+[ \t]+([0-9]+).*$" "\\1" LZ4_VERSION_MINOR ${minor-line})
+  string(REGEX REPLACE "^#define[ \t]+LZ4_VERSION_[A-Z]+[ \t]+([0-9]+).*$" "\\1" LZ4_VERSION_PATCH ${patch-line})
+  set(LZ4_VERSION ${LZ4_VERSION_MAJOR}.${LZ4_VERSION_MINOR}.${LZ4_VERSION_PATCH} CACHE STRING "LZ4 version")
+endif()
+
+find_package_handle_standard_args(
+  Lz4
+  REQUIRED_VARS LZ4_LIBRARY LZ4_INCLUDE_DIR
+  VERSION_VAR LZ4_VERSION
+)
+
+if(LZ4_FOUND)
+  mark_as_advanced(LZ4_LIBRARY)
+  mark_as_advanced(LZ4_INCLUDE_DIR)
+  mark_as_advanced(LZ4_VERSION)
+endif()
+
+#
+# Create namespaced target
+#
+if(LZ4_FOUND AND NOT TARGET lz4::lz4)
+  add_library(lz4::lz4 UNKNOWN IMPORTED)
+  set_target_properties(
+    lz4::lz4
+    PROPERTIES
+      IMPORTED_LOCATION ${LZ4_LIBRARY}
+      # target_include_directories doesn't work with unknown imported libraries in older
+      # cmake versions
+      INTERFACE_INCLUDE_DIRECTORIES ${LZ4_INCLUDE_DIR}
+  )
+endif()
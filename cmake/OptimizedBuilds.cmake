@@ -0,0 +1,51 @@
+#
+# Architecture-tuned and profile-guided builds.
+#
+# DATABENTO_ENABLE_NATIVE_ARCH tunes codegen for the build machine's CPU.
+# DATABENTO_PGO_MODE drives the two-phase profile-guided optimization
+# workflow: configure with GENERATE, run a training workload (the benchmark
+# suite is the intended one), then reconfigure with USE to consume the
+# profiles. scripts/pgo_build.sh automates the full cycle.
+#
+
+include(CheckCXXCompilerFlag)
+
+if(${PROJECT_NAME_UPPERCASE}_ENABLE_NATIVE_ARCH)
+  check_cxx_compiler_flag("-march=native" COMPILER_SUPPORTS_MARCH_NATIVE)
+  if(COMPILER_SUPPORTS_MARCH_NATIVE)
+    add_compile_options(-march=native -mtune=native)
+    message(STATUS "Enabled native architecture tuning.")
+  else()
+    message(WARNING "Compiler doesn't support -march=native; building generic binary.")
+  endif()
+endif()
+
+set(${PROJECT_NAME_UPPERCASE}_PGO_MODE "OFF" CACHE STRING "Profile-guided optimization mode: OFF, GENERATE (instrument), or USE (consume profiles).")
+set_property(CACHE ${PROJECT_NAME_UPPERCASE}_PGO_MODE PROPERTY STRINGS "OFF" "GENERATE" "USE")
+set(${PROJECT_NAME_UPPERCASE}_PGO_PROFILE_DIR "${CMAKE_BINARY_DIR}/pgo-profiles" CACHE PATH "Directory where PGO profiles are written and read.")
+
+if(NOT ${PROJECT_NAME_UPPERCASE}_PGO_MODE STREQUAL "OFF")
+  if(NOT (CMAKE_CXX_COMPILER_ID STREQUAL "GNU" OR CMAKE_CXX_COMPILER_ID MATCHES "Clang"))
+    message(FATAL_ERROR "PGO is only supported with GCC and Clang, not ${CMAKE_CXX_COMPILER_ID}.")
+  endif()
+  set(PGO_DIR ${${PROJECT_NAME_UPPERCASE}_PGO_PROFILE_DIR})
+  if(${PROJECT_NAME_UPPERCASE}_PGO_MODE STREQUAL "GENERATE")
+    add_compile_options(-fprofile-generate=${PGO_DIR})
+    add_link_options(-fprofile-generate=${PGO_DIR})
+    message(STATUS "Enabled PGO instrumentation; profiles will be written to ${PGO_DIR}.")
+  elseif(${PROJECT_NAME_UPPERCASE}_PGO_MODE STREQUAL "USE")
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+      # Clang consumes a single merged profile produced by llvm-profdata
+      set(PGO_USE_FLAG "-fprofile-use=${PGO_DIR}/default.profdata")
+    else()
+      # GCC reads per-object .gcda files; -fprofile-correction tolerates
+      # the slightly inconsistent counters multi-threaded training produces
+      set(PGO_USE_FLAG "-fprofile-use=${PGO_DIR}" "-fprofile-correction")
+    endif()
+    add_compile_options(${PGO_USE_FLAG})
+    add_link_options(${PGO_USE_FLAG})
+    message(STATUS "Enabled PGO optimization using profiles from ${PGO_DIR}.")
+  else()
+    message(FATAL_ERROR "Invalid ${PROJECT_NAME_UPPERCASE}_PGO_MODE '${${PROJECT_NAME_UPPERCASE}_PGO_MODE}'; expected OFF, GENERATE, or USE.")
+  endif()
+endif()
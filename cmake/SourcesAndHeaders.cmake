@@ -1,64 +1,152 @@
 set(headers
+  include/databento/bar_aggregator.hpp
   include/databento/batch.hpp
+  include/databento/book_analytics.hpp
+  include/databento/columnar.hpp
+  include/databento/coalescing_symbology_resolver.hpp
   include/databento/compat.hpp
+  include/databento/compat_view.hpp
+  include/databento/conflation_table.hpp
   include/databento/constants.hpp
+  include/databento/corpus_generator.hpp
+  include/databento/csv_encoder.hpp
+  include/databento/dataset_reader.hpp
   include/databento/datetime.hpp
   include/databento/dbn.hpp
   include/databento/dbn_decoder.hpp
+  include/databento/dbn_encoder.hpp
   include/databento/dbn_file_store.hpp
+  include/databento/dbn_time_index.hpp
   include/databento/enums.hpp
   include/databento/exceptions.hpp
   include/databento/fixed_price.hpp
+  include/databento/fixed_string.hpp
   include/databento/flag_set.hpp
   include/databento/historical.hpp
+  include/databento/instrument_def_cache.hpp
+  include/databento/instrument_state_cache.hpp
   include/databento/ireadable.hpp
+  include/databento/iwritable.hpp
+  include/databento/json_encoder.hpp
+  include/databento/latency_histogram.hpp
   include/databento/live.hpp
   include/databento/live_blocking.hpp
+  include/databento/live_coro.hpp
+  include/databento/live_hot_standby.hpp
+  include/databento/live_session_group.hpp
   include/databento/live_threaded.hpp
   include/databento/log.hpp
   include/databento/metadata.hpp
+  include/databento/multi_file_replay.hpp
+  include/databento/order_book.hpp
+  include/databento/paced_replay.hpp
+  include/databento/partitioned_replay.hpp
   include/databento/publishers.hpp
   include/databento/record.hpp
+  include/databento/rotating_dbn_writer.hpp
+  include/databento/sequence_tracker.hpp
+  include/databento/sharded_dispatcher.hpp
+  include/databento/shm_record_fanout.hpp
+  include/databento/stats.hpp
+  include/databento/symbol_intern_pool.hpp
   include/databento/symbol_map.hpp
   include/databento/symbology.hpp
   include/databento/timeseries.hpp
   include/databento/with_ts_out.hpp
+  include/databento/detail/buffer_channel.hpp
+  include/databento/detail/buffer_pool.hpp
   include/databento/detail/file_stream.hpp
+  include/databento/detail/file_write_stream.hpp
   include/databento/detail/http_client.hpp
+  include/databento/detail/io_uring_receiver.hpp
+  include/databento/detail/journal_writer.hpp
   include/databento/detail/json_helpers.hpp
+  include/databento/detail/lz4_compress_stream.hpp
+  include/databento/detail/lz4_stream.hpp
+  include/databento/detail/mmap_file_stream.hpp
+  include/databento/detail/prefetch_stream.hpp
+  include/databento/detail/request_thread_pool.hpp
+  include/databento/detail/response_cache.hpp
   include/databento/detail/scoped_fd.hpp
   include/databento/detail/scoped_thread.hpp
+  include/databento/detail/seekable_zstd_stream.hpp
   include/databento/detail/shared_channel.hpp
+  include/databento/detail/spsc_record_queue.hpp
   include/databento/detail/tcp_client.hpp
+  include/databento/detail/trace.hpp
+  include/databento/detail/work_stealing_executor.hpp
+  include/databento/detail/zstd_compress_stream.hpp
   include/databento/detail/zstd_stream.hpp
+  src/enum_lookup_helper.hpp
   src/stream_op_helper.hpp
 )
 
 set(sources
+  src/bar_aggregator.cpp
   src/batch.cpp
+  src/book_analytics.cpp
+  src/columnar.cpp
+  src/coalescing_symbology_resolver.cpp
   src/compat.cpp
+  src/conflation_table.cpp
+  src/corpus_generator.cpp
+  src/csv_encoder.cpp
+  src/dataset_reader.cpp
   src/datetime.cpp
   src/dbn.cpp
   src/dbn_decoder.cpp
+  src/dbn_encoder.cpp
   src/enums.cpp
   src/exceptions.cpp
   src/dbn_file_store.cpp
+  src/dbn_time_index.cpp
   src/fixed_price.cpp
   src/historical.cpp
+  src/instrument_def_cache.cpp
+  src/instrument_state_cache.cpp
+  src/ireadable.cpp
+  src/json_encoder.cpp
+  src/latency_histogram.cpp
   src/live.cpp
   src/live_blocking.cpp
+  src/live_hot_standby.cpp
+  src/live_session_group.cpp
   src/live_threaded.cpp
   src/log.cpp
   src/metadata.cpp
+  src/multi_file_replay.cpp
+  src/order_book.cpp
+  src/paced_replay.cpp
+  src/partitioned_replay.cpp
   src/publishers.cpp
   src/record.cpp
+  src/rotating_dbn_writer.cpp
+  src/sequence_tracker.cpp
+  src/sharded_dispatcher.cpp
+  src/shm_record_fanout.cpp
+  src/symbol_intern_pool.cpp
   src/symbol_map.cpp
   src/symbology.cpp
+  src/detail/buffer_channel.cpp
+  src/detail/buffer_pool.cpp
   src/detail/file_stream.cpp
+  src/detail/file_write_stream.cpp
   src/detail/http_client.cpp
+  src/detail/io_uring_receiver.cpp
+  src/detail/journal_writer.cpp
   src/detail/json_helpers.cpp
+  src/detail/lz4_compress_stream.cpp
+  src/detail/lz4_stream.cpp
+  src/detail/mmap_file_stream.cpp
+  src/detail/prefetch_stream.cpp
+  src/detail/request_thread_pool.cpp
+  src/detail/response_cache.cpp
   src/detail/scoped_fd.cpp
+  src/detail/seekable_zstd_stream.cpp
   src/detail/shared_channel.cpp
+  src/detail/spsc_record_queue.cpp
   src/detail/tcp_client.cpp
+  src/detail/work_stealing_executor.cpp
+  src/detail/zstd_compress_stream.cpp
   src/detail/zstd_stream.cpp
 )
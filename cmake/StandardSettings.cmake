@@ -20,6 +20,25 @@ option(${PROJECT_NAME_UPPERCASE}_WARNINGS_AS_ERRORS "Treat compiler warnings as
 option(${PROJECT_NAME_UPPERCASE}_ENABLE_UNIT_TESTING "Enable unit tests for the projects (from the `test` subfolder)." OFF)
 option(${PROJECT_NAME_UPPERCASE}_ENABLE_EXAMPLES "Enable building examples for the project." OFF)
 
+#
+# Benchmarks
+#
+
+option(${PROJECT_NAME_UPPERCASE}_ENABLE_BENCHMARKS "Enable building benchmarks for the project (from the `benchmark` subfolder)." OFF)
+option(${PROJECT_NAME_UPPERCASE}_USE_EXTERNAL_BENCHMARK "Use an external Google Benchmark library" OFF)
+
+#
+# Optimized builds
+#
+
+option(${PROJECT_NAME_UPPERCASE}_ENABLE_NATIVE_ARCH "Tune codegen for the build machine's CPU (-march=native). The binary may not run on older CPUs." OFF)
+
+#
+# Tracing
+#
+
+option(${PROJECT_NAME_UPPERCASE}_ENABLE_TRACEPOINTS "Enable USDT static tracepoints for perf and bpftrace (requires <sys/sdt.h>)." OFF)
+
 #
 # Static analyzers
 #
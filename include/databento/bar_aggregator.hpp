@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <functional>  // function
+#include <unordered_map>
+#include <vector>
+
+#include "databento/datetime.hpp"  // UnixNanos
+#include "databento/enums.hpp"     // RType
+#include "databento/record.hpp"    // MboMsg, OhlcvMsg, Record, TradeMsg
+
+namespace databento {
+// A streaming aggregation stage that builds OhlcvMsg bars of an arbitrary
+// interval from trades. Feed it TradeMsg records or MBO streams (where
+// Trade-action MboMsg records contribute); an instrument's bar is emitted
+// through the callback when a later trade for that instrument opens the
+// next interval, and Flush emits all in-progress bars at end of stream.
+//
+// Per-instrument accumulators use the same layout as DensePitSymbolMap:
+// instruments near the first-seen ID live in a direct-indexed flat array,
+// so the per-trade path is a bounds check plus an array index, and IDs
+// beyond the dense window fall back to a hash map. Neither path allocates
+// once every instrument has traded, and the stage is single-threaded with
+// no locks.
+class BarAggregator {
+ public:
+  using BarCallback = std::function<void(const OhlcvMsg&)>;
+
+  // Throws InvalidArgumentError if interval is zero.
+  BarAggregator(std::chrono::nanoseconds interval, BarCallback callback);
+
+  // Applies a record to the in-progress bars, emitting any bar it closes.
+  // Records other than trades are ignored.
+  void OnRecord(const Record& record);
+  // Emits all in-progress bars and resets the aggregator. Call at end of
+  // stream, otherwise each instrument's final bar is never emitted.
+  void Flush();
+  // The number of in-progress bars.
+  std::size_t OpenBarCount() const {
+    return dense_size_ + sparse_.size();
+  }
+
+ private:
+  // An in-progress bar
+  struct BarSlot {
+    bool open{false};
+    UnixNanos bar_start{};
+    OhlcvMsg bar;
+  };
+
+  void ApplyTrade(std::uint16_t publisher_id, std::uint32_t instrument_id,
+                  UnixNanos ts_event, std::int64_t price, std::uint32_t size);
+  void UpdateSlot(BarSlot* slot, std::uint16_t publisher_id,
+                  std::uint32_t instrument_id, UnixNanos bar_start,
+                  std::int64_t price, std::uint32_t size);
+  BarSlot* FindOrInsertSlot(std::uint32_t instrument_id);
+
+  // The largest distance from the window base stored densely
+  static constexpr std::size_t kMaxDenseExtent = 1 << 20;
+
+  std::uint64_t interval_ns_;
+  // The rtype emitted bars carry: the matching Ohlcv1S/1M/1H/1D rtype when
+  // the interval is exactly one of those, otherwise OhlcvDeprecated, the
+  // generic OHLCV rtype
+  RType rtype_;
+  BarCallback callback_;
+  bool has_base_{false};
+  std::uint32_t base_{};
+  std::vector<BarSlot> dense_;
+  std::size_t dense_size_{};
+  std::unordered_map<std::uint32_t, BarSlot> sparse_;
+};
+}  // namespace databento
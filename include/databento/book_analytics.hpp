@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <cstddef>  // size_t
+#include <vector>
+
+#include "databento/record.hpp"  // BidAskPair, Mbp10Msg, Record
+
+namespace databento {
+// Per-update top-of-book analytics over the contiguous BidAskPair level
+// arrays of MbpMsg records. The kernels are branch-free multiply-add loops
+// over fixed-size arrays so compilers auto-vectorize them; levels with no
+// orders contribute zero size and a division by zero total size yields NaN
+// rather than a branch. Prices are fixed-precision (1e-9) units, matching
+// the records.
+namespace book_analytics {
+// The mid price weighted by the quantity resting on each side:
+// (bid_px * bid_sz + ask_px * ask_sz) / (bid_sz + ask_sz).
+inline double SizeWeightedMid(const BidAskPair& level) {
+  const auto bid_sz = static_cast<double>(level.bid_sz);
+  const auto ask_sz = static_cast<double>(level.ask_sz);
+  return (static_cast<double>(level.bid_px) * bid_sz +
+          static_cast<double>(level.ask_px) * ask_sz) /
+         (bid_sz + ask_sz);
+}
+
+// The expected next trade price, weighting each side by the opposing
+// quantity: (bid_px * ask_sz + ask_px * bid_sz) / (bid_sz + ask_sz).
+inline double Microprice(const BidAskPair& level) {
+  const auto bid_sz = static_cast<double>(level.bid_sz);
+  const auto ask_sz = static_cast<double>(level.ask_sz);
+  return (static_cast<double>(level.bid_px) * ask_sz +
+          static_cast<double>(level.ask_px) * bid_sz) /
+         (bid_sz + ask_sz);
+}
+
+// Book imbalance over the first level_count levels:
+// (sum bid_sz - sum ask_sz) / (sum bid_sz + sum ask_sz), in [-1, 1] with
+// positive values indicating more resting bid quantity.
+double Imbalance(const BidAskPair* levels, std::size_t level_count);
+
+template <std::size_t N>
+double Imbalance(const std::array<BidAskPair, N>& levels) {
+  return Imbalance(levels.data(), N);
+}
+
+// Batch kernels over records from DbnDecoder::DecodeRecords. Each appends
+// one value per Mbp10Msg in `records` to `*out`, skipping records of other
+// types, and returns the number of values appended. Imbalance is computed
+// over all ten levels.
+std::size_t SizeWeightedMid(const std::vector<Record>& records,
+                            std::vector<double>* out);
+std::size_t Microprice(const std::vector<Record>& records,
+                       std::vector<double>* out);
+std::size_t Imbalance(const std::vector<Record>& records,
+                      std::vector<double>* out);
+}  // namespace book_analytics
+}  // namespace databento
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <chrono>              // milliseconds, steady_clock
+#include <condition_variable>  // condition_variable
+#include <cstddef>             // size_t
+#include <future>              // future, promise
+#include <map>
+#include <mutex>   // lock_guard, mutex
+#include <string>  // string
+#include <unordered_set>
+#include <utility>  // move
+#include <vector>
+
+#include "databento/datetime.hpp"  // DateRange
+#include "databento/detail/scoped_thread.hpp"
+#include "databento/enums.hpp"      // SType
+#include "databento/symbology.hpp"  // SymbologyResolution
+
+namespace databento {
+class Historical;
+
+// Batches symbology resolution requests arriving within a short window into
+// one API call. Requests with the same dataset, symbology types, and date
+// range are merged: their symbols are deduplicated into a single
+// `Historical::SymbologyResolve` call and the results fanned back out, so
+// callers resolving overlapping symbol sets at the same time pay one HTTPS
+// round trip between them instead of one each.
+//
+// Instances are safe to share across threads. The destructor flushes any
+// pending batches before returning.
+class CoalescingSymbologyResolver {
+ public:
+  // `client` must outlive this resolver. `window` is how long the first
+  // request in a batch waits for others to join it; it bounds the latency
+  // added to an uncoalesced request.
+  explicit CoalescingSymbologyResolver(
+      Historical* client,
+      std::chrono::milliseconds window = std::chrono::milliseconds{10});
+  CoalescingSymbologyResolver(const CoalescingSymbologyResolver&) = delete;
+  CoalescingSymbologyResolver& operator=(const CoalescingSymbologyResolver&) =
+      delete;
+  ~CoalescingSymbologyResolver();
+
+  // Schedules `symbols` for resolution, returning a future for this caller's
+  // share of the batched result. The future rethrows any exception the
+  // underlying API call throws.
+  std::future<SymbologyResolution> Resolve(
+      const std::string& dataset, const std::vector<std::string>& symbols,
+      SType stype_in, SType stype_out, const DateRange& date_range);
+
+ private:
+  struct Caller {
+    std::vector<std::string> symbols;
+    std::promise<SymbologyResolution> promise;
+  };
+  struct Batch {
+    std::string dataset;
+    SType stype_in;
+    SType stype_out;
+    DateRange date_range;
+    std::chrono::steady_clock::time_point deadline;
+    // The deduplicated union of every caller's symbols, in arrival order
+    std::vector<std::string> symbols;
+    std::unordered_set<std::string> symbol_set;
+    std::vector<Caller> callers;
+  };
+
+  void WorkerLoop();
+  void ExecuteBatch(Batch&& batch);
+
+  Historical* client_;
+  const std::chrono::milliseconds window_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool is_shutting_down_{false};
+  // Pending batches keyed by the request parameters other than the symbols
+  std::map<std::string, Batch> batches_;
+  detail::ScopedThread worker_;
+};
+}  // namespace databento
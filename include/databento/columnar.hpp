@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <vector>
+
+#include "databento/dbn_decoder.hpp"
+#include "databento/record.hpp"  // MboMsg, TradeMsg
+
+namespace databento {
+// Struct-of-arrays transposition of an MBO stream. Each field is a
+// contiguous array of primitives with one element per record, in stream
+// order, matching Arrow's layout for primitive columns: timestamps are UNIX
+// epoch nanoseconds, enums are their underlying character codes, and flags
+// are the raw bit field.
+struct MboColumns {
+  // Appends one record's fields to the columns.
+  void Append(const MboMsg& mbo);
+  void Reserve(std::size_t record_count);
+  void Clear();
+  std::size_t Size() const { return ts_event.size(); }
+
+  std::vector<std::uint64_t> ts_event;
+  std::vector<std::uint64_t> ts_recv;
+  std::vector<std::uint32_t> instrument_id;
+  std::vector<std::uint16_t> publisher_id;
+  std::vector<std::uint64_t> order_id;
+  std::vector<std::int64_t> price;
+  std::vector<std::uint32_t> size;
+  std::vector<std::uint8_t> flags;
+  std::vector<std::uint8_t> channel_id;
+  std::vector<char> action;
+  std::vector<char> side;
+  std::vector<std::int32_t> ts_in_delta;
+  std::vector<std::uint32_t> sequence;
+};
+
+// Struct-of-arrays transposition of a trade stream, with the same layout
+// conventions as MboColumns.
+struct TradeColumns {
+  // Appends one record's fields to the columns.
+  void Append(const TradeMsg& trade);
+  void Reserve(std::size_t record_count);
+  void Clear();
+  std::size_t Size() const { return ts_event.size(); }
+
+  std::vector<std::uint64_t> ts_event;
+  std::vector<std::uint64_t> ts_recv;
+  std::vector<std::uint32_t> instrument_id;
+  std::vector<std::uint16_t> publisher_id;
+  std::vector<std::int64_t> price;
+  std::vector<std::uint32_t> size;
+  std::vector<char> action;
+  std::vector<char> side;
+  std::vector<std::uint8_t> flags;
+  std::vector<std::uint8_t> depth;
+  std::vector<std::int32_t> ts_in_delta;
+  std::vector<std::uint32_t> sequence;
+};
+
+// Decodes the remainder of a fixed-schema stream directly into per-field
+// arrays, appending to any columns already present. Built on the
+// schema-specialized decode loop, so each record is shredded in a single
+// pass with no intermediate record copy. Returns the number of records
+// appended. Should only be called after DecodeMetadata.
+std::uint64_t DecodeColumns(DbnDecoder* decoder, MboColumns* columns);
+std::uint64_t DecodeColumns(DbnDecoder* decoder, TradeColumns* columns);
+}  // namespace databento
@@ -0,0 +1,272 @@
+// Lazy version-aware views over version-sensitive records.
+#pragma once
+
+#include <cstdint>
+#include <limits>  // numeric_limits
+
+#include "databento/compat.hpp"  // InstrumentDefMsgV1, SymbolMappingMsgV1
+#include "databento/datetime.hpp"    // UnixNanos
+#include "databento/enums.hpp"       // InstrumentClass, SType
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+#include "databento/record.hpp"      // InstrumentDefMsg, Record
+
+namespace databento {
+// A lazy alternative to VersionUpgradePolicy::Upgrade for instrument
+// definitions: instead of physically rewriting each v1 record into the
+// compat buffer, the view wraps the raw bytes of either version and
+// translates on access, so the upgrade cost is paid per field actually read
+// rather than per record. The view borrows the record's bytes and is only
+// valid as long as they are, i.e. until the next record is decoded.
+class InstrumentDefView {
+ public:
+  // The version is inferred from the record length. Throws
+  // InvalidArgumentError for other record types.
+  explicit InstrumentDefView(const Record& record) {
+    if (!record.Holds<InstrumentDefMsg>()) {
+      throw InvalidArgumentError{"InstrumentDefView", "record",
+                                 "must be an instrument definition record"};
+    }
+    if (record.Header().Size() >= sizeof(InstrumentDefMsgV2)) {
+      v1_ = nullptr;
+      v2_ = &record.Get<InstrumentDefMsgV2>();
+    } else {
+      v1_ = &record.Get<InstrumentDefMsgV1>();
+      v2_ = nullptr;
+    }
+  }
+
+  std::uint8_t Version() const { return v1_ ? 1 : 2; }
+  const RecordHeader& Header() const { return v1_ ? v1_->hd : v2_->hd; }
+  UnixNanos IndexTs() const { return TsRecv(); }
+
+  UnixNanos TsRecv() const { return v1_ ? v1_->ts_recv : v2_->ts_recv; }
+  std::int64_t MinPriceIncrement() const {
+    return v1_ ? v1_->min_price_increment : v2_->min_price_increment;
+  }
+  std::int64_t DisplayFactor() const {
+    return v1_ ? v1_->display_factor : v2_->display_factor;
+  }
+  UnixNanos Expiration() const {
+    return v1_ ? v1_->expiration : v2_->expiration;
+  }
+  UnixNanos Activation() const {
+    return v1_ ? v1_->activation : v2_->activation;
+  }
+  std::int64_t HighLimitPrice() const {
+    return v1_ ? v1_->high_limit_price : v2_->high_limit_price;
+  }
+  std::int64_t LowLimitPrice() const {
+    return v1_ ? v1_->low_limit_price : v2_->low_limit_price;
+  }
+  std::int64_t MaxPriceVariation() const {
+    return v1_ ? v1_->max_price_variation : v2_->max_price_variation;
+  }
+  std::int64_t TradingReferencePrice() const {
+    return v1_ ? v1_->trading_reference_price : v2_->trading_reference_price;
+  }
+  std::int64_t UnitOfMeasureQty() const {
+    return v1_ ? v1_->unit_of_measure_qty : v2_->unit_of_measure_qty;
+  }
+  std::int64_t MinPriceIncrementAmount() const {
+    return v1_ ? v1_->min_price_increment_amount
+               : v2_->min_price_increment_amount;
+  }
+  std::int64_t PriceRatio() const {
+    return v1_ ? v1_->price_ratio : v2_->price_ratio;
+  }
+  std::int64_t StrikePrice() const {
+    return v1_ ? v1_->strike_price : v2_->strike_price;
+  }
+  std::int32_t InstAttribValue() const {
+    return v1_ ? v1_->inst_attrib_value : v2_->inst_attrib_value;
+  }
+  std::uint32_t UnderlyingId() const {
+    return v1_ ? v1_->underlying_id : v2_->underlying_id;
+  }
+  std::uint32_t RawInstrumentId() const {
+    return v1_ ? v1_->raw_instrument_id : v2_->raw_instrument_id;
+  }
+  std::int32_t MarketDepthImplied() const {
+    return v1_ ? v1_->market_depth_implied : v2_->market_depth_implied;
+  }
+  std::int32_t MarketDepth() const {
+    return v1_ ? v1_->market_depth : v2_->market_depth;
+  }
+  std::uint32_t MarketSegmentId() const {
+    return v1_ ? v1_->market_segment_id : v2_->market_segment_id;
+  }
+  std::uint32_t MaxTradeVol() const {
+    return v1_ ? v1_->max_trade_vol : v2_->max_trade_vol;
+  }
+  std::int32_t MinLotSize() const {
+    return v1_ ? v1_->min_lot_size : v2_->min_lot_size;
+  }
+  std::int32_t MinLotSizeBlock() const {
+    return v1_ ? v1_->min_lot_size_block : v2_->min_lot_size_block;
+  }
+  std::int32_t MinLotSizeRoundLot() const {
+    return v1_ ? v1_->min_lot_size_round_lot : v2_->min_lot_size_round_lot;
+  }
+  std::uint32_t MinTradeVol() const {
+    return v1_ ? v1_->min_trade_vol : v2_->min_trade_vol;
+  }
+  std::int32_t ContractMultiplier() const {
+    return v1_ ? v1_->contract_multiplier : v2_->contract_multiplier;
+  }
+  std::int32_t DecayQuantity() const {
+    return v1_ ? v1_->decay_quantity : v2_->decay_quantity;
+  }
+  std::int32_t OriginalContractSize() const {
+    return v1_ ? v1_->original_contract_size : v2_->original_contract_size;
+  }
+  std::uint16_t TradingReferenceDate() const {
+    return v1_ ? v1_->trading_reference_date : v2_->trading_reference_date;
+  }
+  std::int16_t ApplId() const { return v1_ ? v1_->appl_id : v2_->appl_id; }
+  std::uint16_t MaturityYear() const {
+    return v1_ ? v1_->maturity_year : v2_->maturity_year;
+  }
+  std::uint16_t DecayStartDate() const {
+    return v1_ ? v1_->decay_start_date : v2_->decay_start_date;
+  }
+  std::uint16_t ChannelId() const {
+    return v1_ ? v1_->channel_id : v2_->channel_id;
+  }
+  const char* Currency() const {
+    return v1_ ? v1_->Currency() : v2_->Currency();
+  }
+  const char* SettlCurrency() const {
+    return v1_ ? v1_->SettlCurrency() : v2_->SettlCurrency();
+  }
+  const char* SecSubType() const {
+    return v1_ ? v1_->SecSubType() : v2_->SecSubType();
+  }
+  const char* RawSymbol() const {
+    return v1_ ? v1_->RawSymbol() : v2_->RawSymbol();
+  }
+  const char* Group() const { return v1_ ? v1_->Group() : v2_->Group(); }
+  const char* Exchange() const {
+    return v1_ ? v1_->Exchange() : v2_->Exchange();
+  }
+  const char* Asset() const { return v1_ ? v1_->Asset() : v2_->Asset(); }
+  const char* Cfi() const { return v1_ ? v1_->Cfi() : v2_->Cfi(); }
+  const char* SecurityType() const {
+    return v1_ ? v1_->SecurityType() : v2_->SecurityType();
+  }
+  const char* UnitOfMeasure() const {
+    return v1_ ? v1_->UnitOfMeasure() : v2_->UnitOfMeasure();
+  }
+  const char* Underlying() const {
+    return v1_ ? v1_->Underlying() : v2_->Underlying();
+  }
+  const char* StrikePriceCurrency() const {
+    return v1_ ? v1_->StrikePriceCurrency() : v2_->StrikePriceCurrency();
+  }
+  InstrumentClass Class() const {
+    return v1_ ? v1_->instrument_class : v2_->instrument_class;
+  }
+  MatchAlgorithm MatchAlgo() const {
+    return v1_ ? v1_->match_algorithm : v2_->match_algorithm;
+  }
+  std::uint8_t MdSecurityTradingStatus() const {
+    return v1_ ? v1_->md_security_trading_status
+               : v2_->md_security_trading_status;
+  }
+  std::uint8_t MainFraction() const {
+    return v1_ ? v1_->main_fraction : v2_->main_fraction;
+  }
+  std::uint8_t PriceDisplayFormat() const {
+    return v1_ ? v1_->price_display_format : v2_->price_display_format;
+  }
+  std::uint8_t SettlPriceType() const {
+    return v1_ ? v1_->settl_price_type : v2_->settl_price_type;
+  }
+  std::uint8_t SubFraction() const {
+    return v1_ ? v1_->sub_fraction : v2_->sub_fraction;
+  }
+  std::uint8_t UnderlyingProduct() const {
+    return v1_ ? v1_->underlying_product : v2_->underlying_product;
+  }
+  SecurityUpdateAction UpdateAction() const {
+    return v1_ ? v1_->security_update_action : v2_->security_update_action;
+  }
+  std::uint8_t MaturityMonth() const {
+    return v1_ ? v1_->maturity_month : v2_->maturity_month;
+  }
+  std::uint8_t MaturityDay() const {
+    return v1_ ? v1_->maturity_day : v2_->maturity_day;
+  }
+  std::uint8_t MaturityWeek() const {
+    return v1_ ? v1_->maturity_week : v2_->maturity_week;
+  }
+  UserDefinedInstrument UserDefined() const {
+    return v1_ ? v1_->user_defined_instrument : v2_->user_defined_instrument;
+  }
+  std::int8_t ContractMultiplierUnit() const {
+    return v1_ ? v1_->contract_multiplier_unit : v2_->contract_multiplier_unit;
+  }
+  std::int8_t FlowScheduleType() const {
+    return v1_ ? v1_->flow_schedule_type : v2_->flow_schedule_type;
+  }
+  std::uint8_t TickRule() const {
+    return v1_ ? v1_->tick_rule : v2_->tick_rule;
+  }
+
+  // Materializes a v2 record from the view, equivalent to the eager upgrade.
+  InstrumentDefMsgV2 ToV2() const { return v1_ ? v1_->ToV2() : *v2_; }
+
+ private:
+  const InstrumentDefMsgV1* v1_;
+  const InstrumentDefMsgV2* v2_;
+};
+
+// The symbol mapping counterpart of InstrumentDefView. v1 records carry no
+// symbology types, so STypeIn and STypeOut report the same invalid sentinel
+// the eager upgrade writes.
+class SymbolMappingView {
+ public:
+  // The version is inferred from the record length. Throws
+  // InvalidArgumentError for other record types.
+  explicit SymbolMappingView(const Record& record) {
+    if (!record.Holds<SymbolMappingMsg>()) {
+      throw InvalidArgumentError{"SymbolMappingView", "record",
+                                 "must be a symbol mapping record"};
+    }
+    if (record.Header().Size() >= sizeof(SymbolMappingMsgV2)) {
+      v1_ = nullptr;
+      v2_ = &record.Get<SymbolMappingMsgV2>();
+    } else {
+      v1_ = &record.Get<SymbolMappingMsgV1>();
+      v2_ = nullptr;
+    }
+  }
+
+  std::uint8_t Version() const { return v1_ ? 1 : 2; }
+  const RecordHeader& Header() const { return v1_ ? v1_->hd : v2_->hd; }
+  UnixNanos IndexTs() const { return Header().ts_event; }
+
+  SType STypeIn() const {
+    return v1_ ? static_cast<SType>(std::numeric_limits<std::uint8_t>::max())
+               : v2_->stype_in;
+  }
+  const char* STypeInSymbol() const {
+    return v1_ ? v1_->STypeInSymbol() : v2_->STypeInSymbol();
+  }
+  SType STypeOut() const {
+    return v1_ ? static_cast<SType>(std::numeric_limits<std::uint8_t>::max())
+               : v2_->stype_out;
+  }
+  const char* STypeOutSymbol() const {
+    return v1_ ? v1_->STypeOutSymbol() : v2_->STypeOutSymbol();
+  }
+  UnixNanos StartTs() const { return v1_ ? v1_->start_ts : v2_->start_ts; }
+  UnixNanos EndTs() const { return v1_ ? v1_->end_ts : v2_->end_ts; }
+
+  // Materializes a v2 record from the view, equivalent to the eager upgrade.
+  SymbolMappingMsgV2 ToV2() const { return v1_ ? v1_->ToV2() : *v2_; }
+
+ private:
+  const SymbolMappingMsgV1* v1_;
+  const SymbolMappingMsgV2* v2_;
+};
+}  // namespace databento
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <memory>  // unique_ptr
+
+#include "databento/record.hpp"  // kMaxRecordLen, Record, RecordHeader
+
+namespace databento {
+// A snapshot of the latest record for one instrument, copied out of a
+// ConflationTable.
+struct ConflatedRecord {
+  Record AsRecord() {
+    return Record{reinterpret_cast<RecordHeader*>(buffer.data())};
+  }
+
+  alignas(RecordHeader) std::array<std::uint8_t, kMaxRecordLen> buffer;
+};
+
+// A conflation stage for consumers that only need the latest state per
+// instrument, such as UIs and risk checks. The feed thread overwrites a
+// fixed per-instrument slot on every record, so memory is bounded by the
+// instrument window and nothing queues: a slow consumer simply observes
+// fewer intermediate states. Each slot is guarded by a seqlock version
+// counter, making the writer wait-free (two counter stores and a copy) and
+// letting any number of reader threads snapshot at their own pace,
+// retrying the rare read that overlaps a write.
+class ConflationTable {
+ public:
+  // Creates a table with one slot per instrument ID in
+  // [base_instrument_id, base_instrument_id + instrument_count). Throws
+  // InvalidArgumentError if instrument_count is zero.
+  ConflationTable(std::uint32_t base_instrument_id,
+                  std::size_t instrument_count);
+  // Slots hold pointers into the table: not copyable or movable
+  ConflationTable(const ConflationTable&) = delete;
+  ConflationTable& operator=(const ConflationTable&) = delete;
+
+  std::size_t Size() const { return slot_count_; }
+
+  // Stores the record as its instrument's latest, replacing any previous
+  // record. Returns false for records outside the instrument window or
+  // larger than kMaxRecordLen, which aren't stored. May only be called from
+  // one thread.
+  bool Update(const Record& record);
+  // Copies the latest record for instrument_id into `*snapshot`. Returns
+  // false if the instrument is outside the window or no record for it has
+  // been stored yet. Safe to call from any thread at any rate.
+  bool GetLatest(std::uint32_t instrument_id,
+                 ConflatedRecord* snapshot) const;
+  // The number of updates stored for instrument_id. A reader can skip
+  // re-reading state it has already seen by polling this first.
+  std::uint64_t UpdateCount(std::uint32_t instrument_id) const;
+
+ private:
+  struct Slot {
+    // Even when the slot is consistent, odd mid-write; each update
+    // increments it twice, so the update count is version / 2
+    std::atomic<std::uint64_t> version{0};
+    alignas(RecordHeader) std::array<std::uint8_t, kMaxRecordLen> payload{};
+  };
+
+  const Slot* FindSlot(std::uint32_t instrument_id) const;
+
+  std::uint32_t base_;
+  std::size_t slot_count_;
+  // unique_ptr rather than vector: Slot's atomic makes it non-movable
+  std::unique_ptr<Slot[]> slots_;
+};
+}  // namespace databento
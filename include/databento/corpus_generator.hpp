@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <random>  // mt19937_64
+#include <vector>
+
+#include "databento/datetime.hpp"  // UnixNanos
+#include "databento/dbn.hpp"       // Metadata
+#include "databento/enums.hpp"     // Schema
+#include "databento/iwritable.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+class DbnEncoder;
+
+// How synthetic records are spread across instruments.
+enum class InstrumentDistribution : std::uint8_t {
+  // Every instrument is equally likely.
+  Uniform = 0,
+  // Activity concentrates in the lowest instrument IDs, approximating real
+  // feeds where a handful of products dominate the message rate.
+  Skewed,
+};
+
+// Configuration for CorpusGenerator.
+struct CorpusConfig {
+  Schema schema{Schema::Mbo};
+  std::size_t record_count{10000};
+  // Instrument IDs are drawn from [1, instrument_count].
+  std::uint32_t instrument_count{100};
+  InstrumentDistribution instrument_distribution{
+      InstrumentDistribution::Uniform};
+  // The number of consecutive records separated by intra_burst_gap_ns before
+  // the clock jumps by inter_burst_gap_ns. A size of 1 produces evenly-spaced
+  // records.
+  std::size_t burst_size{1};
+  std::uint64_t intra_burst_gap_ns{1000};
+  std::uint64_t inter_burst_gap_ns{1000000};
+  std::uint64_t seed{0};
+  // The ts_event of the first record.
+  UnixNanos start{};
+};
+
+// A deterministic generator of synthetic DBN streams for benchmarks and load
+// tests. The same configuration produces a byte-identical stream on every
+// platform, so corpora can be regenerated from a config instead of sharing
+// licensed captures. Supports the MBO, MBP-1, MBP-10, trades, and OHLCV
+// schemas.
+class CorpusGenerator {
+ public:
+  explicit CorpusGenerator(const CorpusConfig& config);
+
+  // The metadata header matching the generated stream.
+  Metadata GenerateMetadata() const;
+  // Writes a complete DBN stream of record_count records, including the
+  // metadata header, to output. Each call restarts the generator and writes
+  // an identical stream.
+  void Generate(IWritable* output);
+  // Like Generate(IWritable*), but returns the encoded stream.
+  std::vector<std::uint8_t> Generate();
+
+ private:
+  std::uint32_t NextInstrumentId();
+  std::uint32_t NextSize();
+  std::int64_t NextPrice();
+  UnixNanos NextTs();
+  template <typename RecordT>
+  void GenerateRecords(DbnEncoder* encoder);
+  void GenerateOhlcv(DbnEncoder* encoder);
+  void Fill(MboMsg& record);
+  void Fill(TradeMsg& record);
+  void Fill(Mbp1Msg& record);
+  void Fill(Mbp10Msg& record);
+
+  CorpusConfig config_;
+  std::mt19937_64 rng_;
+  std::uint64_t ts_;
+  std::int64_t price_;
+  std::size_t burst_pos_{};
+  std::uint32_t sequence_{};
+};
+}  // namespace databento
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <vector>
+
+#include "databento/datetime.hpp"  // UnixNanos
+#include "databento/enums.hpp"     // Schema
+#include "databento/iwritable.hpp"
+#include "databento/record.hpp"  // MboMsg, Mbp1Msg, Mbp10Msg, OhlcvMsg,
+                                 // Record, TradeMsg
+
+namespace databento {
+// CSV record serializer. The text-encoding counterpart to DbnEncoder. Rows
+// are formatted into an internal buffer with integer and fixed-price
+// formatters (no ostream or allocation per field) and flushed to the output
+// in buffer-sized batches, so it can keep up with a full-rate decode loop.
+class CsvEncoder {
+ public:
+  static constexpr std::size_t kDefaultBufferSize = 64 * 1024;
+
+  // If pretty_px, prices are written as decimal strings, otherwise as raw
+  // fixed-precision integers. If pretty_ts, timestamps are written as
+  // ISO 8601 strings, otherwise as nanoseconds since the UNIX epoch.
+  CsvEncoder(IWritable* output, bool pretty_px, bool pretty_ts);
+  CsvEncoder(IWritable* output, bool pretty_px, bool pretty_ts,
+             std::size_t buffer_size);
+  // Not copyable or movable: the buffer is flushed on destruction
+  CsvEncoder(const CsvEncoder&) = delete;
+  CsvEncoder& operator=(const CsvEncoder&) = delete;
+  ~CsvEncoder();
+
+  // Writes the column header row for the given schema. Throws
+  // InvalidArgumentError for schemas without CSV support.
+  void WriteHeader(Schema schema);
+  // Serializes one record, dispatching on its rtype. Throws
+  // InvalidArgumentError for records without CSV support.
+  void EncodeRecord(const Record& record);
+  void EncodeRecord(const MboMsg& record);
+  void EncodeRecord(const TradeMsg& record);
+  void EncodeRecord(const Mbp1Msg& record);
+  void EncodeRecord(const Mbp10Msg& record);
+  void EncodeRecord(const OhlcvMsg& record);
+  // Writes all buffered rows to the output.
+  void Flush();
+
+ private:
+  // Returns a write position with room for at least one row of any schema
+  char* RowStart();
+  void FinishRow(char* pos);
+  char* WritePx(char* pos, std::int64_t px) const;
+  char* WriteTs(char* pos, UnixNanos ts) const;
+  template <std::size_t N>
+  void EncodeMbp(const detail::MbpMsg<N>& record);
+
+  IWritable* output_;
+  const bool pretty_px_;
+  const bool pretty_ts_;
+  std::vector<char> buffer_;
+  std::size_t length_{0};
+};
+}  // namespace databento
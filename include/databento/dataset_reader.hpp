@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <string>
+#include <vector>
+
+#include "databento/enums.hpp"       // VersionUpgradePolicy
+#include "databento/timeseries.hpp"  // MetadataCallback, RecordCallback
+
+namespace databento {
+// A reader for a directory tree of DBN files, such as a per-day, per-schema
+// archive. On construction it discovers every .dbn and .dbn.zst file under
+// the root (sorted by path, so date-named files replay in date order) and
+// validates that their metadata is mutually compatible: same dataset, same
+// schema unless mixed, and the same ts_out setting. The whole dataset then
+// replays through one callback, either file-by-file in path order or k-way
+// merged by ts_event across files decoded with bounded parallelism.
+class DatasetReader {
+ public:
+  explicit DatasetReader(const std::string& root_dir);
+  // thread_count bounds how many files are open and decoding concurrently
+  // during validation and merged replay.
+  DatasetReader(const std::string& root_dir,
+                VersionUpgradePolicy upgrade_policy,
+                std::size_t thread_count);
+
+  // The discovered file paths in replay order.
+  const std::vector<std::string>& FilePaths() const { return file_paths_; }
+
+  // Replays the files one after another in path order. The metadata
+  // callback is invoked once per file before its records.
+  void ReplayConcatenated(const MetadataCallback& metadata_callback,
+                          const RecordCallback& record_callback);
+  void ReplayConcatenated(const RecordCallback& record_callback);
+  // Replays all files as a single stream merged by ts_event, decoding
+  // files concurrently on background threads. The metadata callback is
+  // invoked once per file, in path order, before any records.
+  void ReplayMerged(const MetadataCallback& metadata_callback,
+                    const RecordCallback& record_callback);
+  void ReplayMerged(const RecordCallback& record_callback);
+
+ private:
+  static void DiscoverFiles(const std::string& dir,
+                            std::vector<std::string>* file_paths);
+  // Decodes every file's metadata, thread_count_ files at a time, and
+  // throws InvalidArgumentError on the first incompatibility.
+  void ValidateMetadata() const;
+
+  std::vector<std::string> file_paths_;
+  VersionUpgradePolicy upgrade_policy_;
+  std::size_t thread_count_;
+};
+}  // namespace databento
@@ -17,6 +17,24 @@ std::string ToString(UnixNanos unix_nanos);
 // Format the UNIX timestamp as a human-readable ISO8601 string of format
 // YYYY-MM-DDTHH:MM:SS.fffffffffZ
 std::string ToIso8601(UnixNanos unix_nanos);
+
+// The maximum number of characters ToIso8601Chars writes: enough for
+// "YYYY-MM-DDTHH:MM:SS.fffffffffZ" as well as "UNDEF_TIMESTAMP".
+constexpr std::size_t kIso8601MaxStrLen = 30;
+
+// Formats the UNIX timestamp as ISO 8601 into [first, last) in the style of
+// std::to_chars, using only integer math: no allocation, locale, or gmtime
+// locks. Returns a pointer past the last character written, or nullptr if
+// the buffer is too small; kIso8601MaxStrLen characters always suffice. The
+// output is not null-terminated.
+char* ToIso8601Chars(UnixNanos unix_nanos, char* first, char* last);
+
+// Parses an ISO 8601 timestamp of the format YYYY-MM-DD, optionally followed
+// by a time of the format THH:MM:SS with optional fractional seconds (up to
+// nanosecond precision) and an optional trailing 'Z'. Throws
+// InvalidArgumentError if str is malformed or before the UNIX epoch.
+UnixNanos FromIso8601(const std::string& str);
+
 std::string ToString(TimeDeltaNanos td_nanos);
 // Converts a YYYYMMDD integer to a YYYY-MM-DD string.
 std::string DateFromIso8601Int(std::uint32_t date_int);
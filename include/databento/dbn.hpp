@@ -1,12 +1,14 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>  // shared_ptr
 #include <ostream>
 #include <string>
 #include <vector>
 
 #include "databento/datetime.hpp"  // UnixNanos
 #include "databento/enums.hpp"
+#include "databento/fixed_string.hpp"  // SymbolString
 
 namespace databento {
 struct MappingInterval {
@@ -16,12 +18,12 @@ struct MappingInterval {
   // The end date of the interval (exclusive) as
   // YYYYMMDD e.g. 2022-10-08 is represented as 20221008
   std::uint32_t end_date;
-  std::string symbol;
+  SymbolString symbol;
 };
 
 struct SymbolMapping {
   // The raw symbol from the publisher.
-  std::string raw_symbol;
+  SymbolString raw_symbol;
   // The mappings of `native` for different date ranges.
   std::vector<MappingInterval> intervals;
 };
@@ -59,17 +61,104 @@ struct Metadata {
   // The length in bytes of fixed-length symbol strings, including a null
   // terminator byte.
   std::size_t symbol_cstr_len;
-  // The original query input symbols from the request.
-  std::vector<std::string> symbols;
+  // The original query input symbols from the request. Stored inline so
+  // symbol collections are flat contiguous arrays without per-element heap
+  // allocation.
+  std::vector<SymbolString> symbols;
   // Symbols that did not resolve for _at least one day_ in the query time
   // range.
-  std::vector<std::string> partial;
+  std::vector<SymbolString> partial;
   // Symbols that did not resolve for _any_ day in the query time range.
-  std::vector<std::string> not_found;
+  std::vector<SymbolString> not_found;
   // Symbol mappings containing a native symbol and its mapping intervals.
   std::vector<SymbolMapping> mappings;
 };
 
+// Like MappingInterval, but symbol points into the arena owned by the
+// enclosing ArenaMetadata.
+struct ArenaMappingInterval {
+  // The start date of the interval (inclusive) as YYYYMMDD.
+  std::uint32_t start_date;
+  // The end date of the interval (exclusive) as YYYYMMDD.
+  std::uint32_t end_date;
+  // Null-terminated symbol text in the metadata arena.
+  const char* symbol;
+};
+
+// Like SymbolMapping, but with its intervals stored contiguously in
+// ArenaMetadata::intervals.
+struct ArenaSymbolMapping {
+  // Null-terminated raw symbol text in the metadata arena.
+  const char* raw_symbol;
+  // The index of the mapping's first interval in ArenaMetadata::intervals.
+  std::uint32_t interval_begin;
+  // The number of intervals belonging to the mapping.
+  std::uint32_t interval_count;
+};
+
+// Metadata whose symbol text remains in the single decoded metadata buffer
+// rather than being copied into individually-allocated strings. All `const
+// char*` members point into `arena`, which is kept alive by the struct
+// itself, so copies remain cheap and valid.
+struct ArenaMetadata {
+  // The DBN schema version number.
+  std::uint8_t version;
+  // The dataset code.
+  std::string dataset;
+  // Indicates the DBN stream may contain multiple record types and data
+  // schemas. If true, the schema field should be ignored.
+  bool has_mixed_schema;
+  // The data record schema. If has_mixed_schema is true, this field should
+  // be ignored.
+  Schema schema;
+  // The UNIX timestamp of the query start, or the first record if the file
+  // was split.
+  UnixNanos start;
+  // The UNIX timestamp of the query end, or the last record if the file was
+  // split.
+  UnixNanos end;
+  // The maximum number of records for the query.
+  std::uint64_t limit;
+  // Indicates the DBN stream may have been created with a mix of stype_in.
+  bool has_mixed_stype_in;
+  // The input symbology type. Should be ignored if has_mixed_stype_in is
+  // true.
+  SType stype_in;
+  // The output symbology type.
+  SType stype_out;
+  // Whether the records contain an appended send timestamp.
+  bool ts_out;
+  // The length in bytes of fixed-length symbol strings, including a null
+  // terminator byte.
+  std::size_t symbol_cstr_len;
+  // The original query input symbols from the request.
+  std::vector<const char*> symbols;
+  // Symbols that did not resolve for _at least one day_ in the query time
+  // range.
+  std::vector<const char*> partial;
+  // Symbols that did not resolve for _any_ day in the query time range.
+  std::vector<const char*> not_found;
+  // Symbol mappings. Each mapping's intervals are the contiguous range
+  // [interval_begin, interval_begin + interval_count) of `intervals`.
+  std::vector<ArenaSymbolMapping> mappings;
+  // All mapping intervals, grouped by mapping.
+  std::vector<ArenaMappingInterval> intervals;
+  // The raw metadata buffer that all symbol text points into.
+  std::shared_ptr<const std::vector<std::uint8_t>> arena;
+};
+
+// An immutable, reference-counted snapshot of stream metadata. Copying a
+// SharedMetadata copies a single shared_ptr, so distributing session
+// metadata to N worker threads costs N pointer copies instead of N deep
+// copies of the symbol vectors.
+using SharedMetadata = std::shared_ptr<const ArenaMetadata>;
+
+// Moves already arena-backed metadata into an immutable shared snapshot.
+SharedMetadata ShareMetadata(ArenaMetadata&& metadata);
+// Packs a deep-copy Metadata into an arena-backed shared snapshot. All
+// symbol text is copied once into a single buffer owned by the snapshot.
+SharedMetadata ShareMetadata(const Metadata& metadata);
+
 inline bool operator==(const MappingInterval& lhs, const MappingInterval& rhs) {
   return lhs.start_date == rhs.start_date && lhs.end_date == rhs.end_date &&
          lhs.symbol == rhs.symbol;
@@ -2,26 +2,87 @@
 
 #include <cstddef>  // size_t
 #include <cstdint>  // uint8_t
-#include <memory>   // unique_ptr
+#include <array>
+#include <memory>  // unique_ptr
 #include <string>
+#include <unordered_set>
+#include <utility>  // move
+#include <vector>
 
 #include "databento/dbn.hpp"
+#include "databento/detail/buffer_channel.hpp"
 #include "databento/detail/file_stream.hpp"
 #include "databento/detail/shared_channel.hpp"
 #include "databento/enums.hpp"  // Upgrade Policy
 #include "databento/ireadable.hpp"
 #include "databento/record.hpp"  // Record, RecordHeader
+#include "databento/stats.hpp"   // ClientStats, StatsCounters
 
 namespace databento {
+// A filter applied against the raw RecordHeader during decoding. Records
+// that don't match are skipped by advancing past them: they're never
+// upgraded nor returned, so a skipped record only costs a header read.
+// Dimensions that are never set match every record. Note that filtering by
+// instrument ID also drops records without a meaningful instrument ID, such
+// as SymbolMappingMsg, ErrorMsg, and SystemMsg.
+class RecordFilter {
+ public:
+  // Matches everything by default.
+  RecordFilter() = default;
+
+  void SetInstrumentIds(std::vector<std::uint32_t> instrument_ids);
+  void SetRTypes(const std::vector<RType>& rtypes);
+  void SetPublishers(const std::vector<Publisher>& publishers);
+
+  bool Matches(const RecordHeader& header) const {
+    if (has_rtypes_ && !rtype_mask_[static_cast<std::uint8_t>(header.rtype)]) {
+      return false;
+    }
+    if (has_publishers_ &&
+        publisher_ids_.count(header.publisher_id) == 0) {
+      return false;
+    }
+    if (has_instrument_ids_ &&
+        instrument_ids_.count(header.instrument_id) == 0) {
+      return false;
+    }
+    return true;
+  }
+
+  // Whether no dimensions are set, i.e. every record matches.
+  bool MatchesAll() const {
+    return !has_instrument_ids_ && !has_rtypes_ && !has_publishers_;
+  }
+
+ private:
+  bool has_instrument_ids_{false};
+  std::unordered_set<std::uint32_t> instrument_ids_;
+  bool has_rtypes_{false};
+  std::array<bool, 256> rtype_mask_{};
+  bool has_publishers_{false};
+  std::unordered_set<std::uint16_t> publisher_ids_;
+};
+
 // DBN decoder. Set upgrade_policy to control how DBN version 1 data should be
 // handled. Defaults to upgrading DBNv1 data to version 2 (the current version).
 class DbnDecoder {
  public:
   explicit DbnDecoder(detail::SharedChannel channel);
+  // Decodes records directly within the slices taken from the channel
+  // instead of copying them through an intermediate read buffer. Only
+  // records spanning a slice boundary are copied. Compressed inputs fall
+  // back to the byte-stream path, since decompression produces new bytes
+  // regardless.
+  explicit DbnDecoder(detail::BufferChannel channel);
   explicit DbnDecoder(detail::FileStream file_stream);
   explicit DbnDecoder(std::unique_ptr<IReadable> input);
   DbnDecoder(std::unique_ptr<IReadable> input,
              VersionUpgradePolicy upgrade_policy);
+  DbnDecoder(DbnDecoder&&) = default;
+  DbnDecoder& operator=(DbnDecoder&&) = default;
+  // Returns the read buffers to the shared buffer pool for reuse by later
+  // sessions.
+  ~DbnDecoder();
 
   // Decode metadata from the given buffer.
   static Metadata DecodeMetadata(const std::vector<std::uint8_t>& buffer);
@@ -36,17 +97,106 @@ class DbnDecoder {
       std::uint8_t version, VersionUpgradePolicy upgrade_policy, bool ts_out,
       std::array<std::uint8_t, kMaxRecordLen>* compat_buffer, Record rec);
 
+  // Sets a filter to apply to all subsequently decoded records.
+  void SetRecordFilter(RecordFilter filter) { filter_ = std::move(filter); }
+
+  // Marks the input as locally produced and well formed, such as a file
+  // this process wrote. DecodeRecords then frames records by trusting each
+  // header's length and enforces bounds only at buffer granularity,
+  // dropping the per-record filter and upgrade dispatch. Malformed input
+  // in trusted mode has undefined results, so this should never be enabled
+  // for data of unknown provenance.
+  void SetTrustedInput(bool trusted) { trusted_input_ = trusted; }
+
+  // Moves reading the input (and decompressing it, for zstd inputs) to a
+  // background thread that stays a few buffers ahead of decoding. Should be
+  // called at most once, before DecodeMetadata. Prefetched inputs don't
+  // support SeekToTime.
+  void EnablePrefetch();
+
+  // Treats the input as any number of DBN streams laid end to end, e.g.
+  // concatenated rotated capture files or batch shards. When one stream's
+  // records end at a following DBN magic, the next stream's metadata is
+  // decoded and its records continue in place, reusing the read buffers
+  // and any decompression context instead of constructing a decoder per
+  // stream. Applies to DecodeRecord, TryDecodeRecord, and DecodeRecords;
+  // DecodeAll treats the input as a single stream. Should be called before
+  // DecodeMetadata.
+  void EnableStreamChaining() { chain_streams_ = true; }
+  // The metadata of the most recently crossed chained stream, or nullptr
+  // while decoding the first stream. Valid until the next stream boundary.
+  const Metadata* ChainedMetadata() const {
+    return chained_stream_count_ == 0 ? nullptr : &chained_metadata_;
+  }
+
+  // Decodes metadata keeping all symbol text in the single decoded buffer.
+  static ArenaMetadata DecodeArenaMetadataFields(
+      std::uint8_t version,
+      std::shared_ptr<const std::vector<std::uint8_t>> buffer);
+
   // Should be called exactly once.
   Metadata DecodeMetadata();
+  // Alternative to DecodeMetadata that returns metadata whose symbol text
+  // points into a single arena buffer instead of allocating a string per
+  // symbol. Should be called exactly once, in place of DecodeMetadata.
+  ArenaMetadata DecodeArenaMetadata();
   // Lifetime of returned Record is until next call to DecodeRecord. Returns
   // nullptr once the end of the input has been reached.
   const Record* DecodeRecord();
+  // Decodes every complete record currently buffered, refilling the buffer
+  // from the input at most once per batch in the common case. Lifetime of the
+  // returned records is until the next call to DecodeRecord or DecodeRecords.
+  // Returns an empty vector once the end of the input has been reached.
+  const std::vector<Record>& DecodeRecords();
+  // Decodes the remainder of the stream, invoking callback with a typed
+  // `const T&` for every T record, and returns the number of records
+  // delivered. Intended for fixed-schema streams (Metadata::schema set
+  // without has_mixed_schema), where the record size is a compile-time
+  // constant and the decode loop avoids the generic per-record dispatch.
+  // Records of other types, records with ts_out appended, and DBNv1 records
+  // needing an upgrade fall back to the generic path, so the result matches
+  // calling DecodeRecord in a loop. The lifetime of the reference passed to
+  // callback ends when callback returns.
+  template <typename T, typename Callback>
+  std::uint64_t DecodeAll(Callback&& callback);
+  // Non-throwing variant of DecodeRecord: stores the next record in
+  // `*record` and returns DecodeStatus::Ok, or stores nullptr and returns
+  // a status describing why no record is available. Errors raised while
+  // reading or decoding the input are mapped to a status whose description
+  // is a preformatted static string (see ToString), so the error path never
+  // unwinds through the caller nor allocates.
+  DecodeStatus TryDecodeRecord(const Record** record) noexcept;
+  // Repositions the input so decoding continues from the record boundary at
+  // `offset` bytes from the beginning of the file, then skips ahead to the
+  // first record with a ts_event at or after ts reading only headers.
+  // Should only be called after DecodeMetadata. Requires a seekable,
+  // uncompressed input.
+  void SeekToTime(std::uint64_t offset, UnixNanos ts);
+  // Reinitializes the decoder to decode a new stream read from `channel`,
+  // retaining the buffer capacity allocated for earlier streams. Like the
+  // constructor, blocks until the compression of the new stream can be
+  // detected, so the channel's writer should already be running.
+  // DecodeMetadata should be called exactly once after each Reset. Activity
+  // counters accumulate across streams.
+  void Reset(detail::BufferChannel channel);
+  // Returns a snapshot of the decoder's activity counters. Cheap enough to
+  // poll and safe to call from another thread.
+  ClientStats Stats() const;
 
  private:
+  // Signature shared by the per-rtype upgrade functions and the no-op
+  // passthrough.
+  using CompatFn = Record (*)(bool ts_out,
+                              std::array<std::uint8_t, kMaxRecordLen>*,
+                              Record);
+
+  // The DBNv1 upgrade dispatch table, indexed by rtype.
+  static const std::array<CompatFn, 256>& UpgradeV1Table();
+
   static std::string DecodeSymbol(
       std::size_t symbol_cstr_len,
       std::vector<std::uint8_t>::const_iterator& buffer_it);
-  static std::vector<std::string> DecodeRepeatedSymbol(
+  static std::vector<SymbolString> DecodeRepeatedSymbol(
       std::size_t symbol_cstr_len,
       std::vector<std::uint8_t>::const_iterator& buffer_it,
       std::vector<std::uint8_t>::const_iterator buffer_end_it);
@@ -58,19 +208,130 @@ class DbnDecoder {
       std::size_t symbol_cstr_len,
       std::vector<std::uint8_t>::const_iterator& buffer_it,
       std::vector<std::uint8_t>::const_iterator buffer_end_it);
-  bool DetectCompression();
+  // How the input identified itself through its magic bytes
+  enum class InputFormat : std::uint8_t {
+    Dbn,
+    Zstd,
+    Lz4,
+  };
+
+  InputFormat DetectCompression();
+  // Detects the input's compression, wrapping it in a ZstdStream or
+  // Lz4Stream when compressed. Shared by the constructors and Reset.
+  void SetUpCompression();
+  // Resolves the upgrade dispatch for the stream once its version is known.
+  void ResolveUpgradeTable() {
+    upgrade_table_ =
+        (version_ == 1 && upgrade_policy_ == VersionUpgradePolicy::Upgrade)
+            ? &UpgradeV1Table()
+            : nullptr;
+  }
   std::size_t FillBuffer();
+  std::size_t FillBufferFromSlices();
   RecordHeader* BufferRecordHeader();
+  // Whether the unread input begins a new chained DBN stream. Only
+  // meaningful with stream chaining enabled.
+  bool AtChainedStreamBoundary();
+  // Decodes the metadata of the following chained stream, updating the
+  // version, ts_out, and upgrade dispatch for its records.
+  void ChainNextStream();
+  // Copies exactly `size` unread bytes into `dst`, refilling the read
+  // buffer as needed. Throws DbnResponseError if the input ends first.
+  void ConsumeExact(std::uint8_t* dst, std::size_t size);
+  // Applies the upgrade dispatch resolved after DecodeMetadata. A no-op
+  // unless the stream is DBNv1 with an Upgrade policy.
+  Record ApplyUpgrade(Record rec) {
+    if (upgrade_table_ == nullptr) {
+      return rec;
+    }
+    return (*upgrade_table_)[static_cast<std::uint8_t>(rec.RType())](
+        ts_out_, &compat_buffer_, rec);
+  }
 
   std::uint8_t version_{};
   VersionUpgradePolicy upgrade_policy_;
+  RecordFilter filter_;
+  bool compressed_{};
+  bool trusted_input_{false};
+  bool chain_streams_{false};
+  // The metadata decoded at the most recent chained stream boundary
+  Metadata chained_metadata_;
+  std::uint64_t chained_stream_count_{};
+  // Resolved once per stream from version x upgrade policy; nullptr when
+  // records don't need upgrading
+  const std::array<CompatFn, 256>* upgrade_table_{nullptr};
   bool ts_out_{};
   std::unique_ptr<IReadable> input_;
+  // Set when input_ is an uncompressed BufferChannel, enabling the
+  // slice-swapping FillBuffer path. Aliases input_, which owns the channel.
+  detail::BufferChannel* buffer_channel_{nullptr};
+  // Set when the input is a SharedChannel, for depth reporting in Stats.
+  // SharedChannel handles are copyable, so this shares the underlying ring
+  // with input_ (possibly through a ZstdStream for compressed inputs).
+  std::unique_ptr<detail::SharedChannel> shared_channel_;
+  detail::StatsCounters stats_;
   std::vector<std::uint8_t> read_buffer_;
   std::size_t buffer_idx_{};
+  // The remainder of a slice partially copied to complete a record that
+  // spanned a slice boundary
+  std::vector<std::uint8_t> pending_slice_;
+  std::size_t pending_idx_{};
   // Must be 8-byte aligned for records
   alignas(
       RecordHeader) std::array<std::uint8_t, kMaxRecordLen> compat_buffer_{};
   Record current_record_{nullptr};
+  std::vector<Record> record_batch_;
+  // Arena for upgraded records decoded in a batch, which can't share
+  // compat_buffer_
+  std::vector<std::uint8_t> batch_compat_buffer_;
 };
+
+template <typename T, typename Callback>
+std::uint64_t DbnDecoder::DecodeAll(Callback&& callback) {
+  std::uint64_t count = 0;
+  while (true) {
+    while (read_buffer_.size() - buffer_idx_ < sizeof(RecordHeader) ||
+           read_buffer_.size() - buffer_idx_ < BufferRecordHeader()->Size()) {
+      if (FillBuffer() == 0) {
+        return count;
+      }
+    }
+    // Fast path: a contiguous run of plain T records. sizeof(T) is a
+    // compile-time constant, so the length check per record is a single
+    // comparison against the header and the loop bound is known
+    const std::uint8_t* const data = read_buffer_.data();
+    const std::size_t end = read_buffer_.size();
+    std::size_t idx = buffer_idx_;
+    std::uint64_t delivered = 0;
+    while (end - idx >= sizeof(T)) {
+      const auto* header = reinterpret_cast<const RecordHeader*>(data + idx);
+      if (header->Size() != sizeof(T) || !T::HasRType(header->rtype)) {
+        break;
+      }
+      if (filter_.Matches(*header)) {
+        callback(*reinterpret_cast<const T*>(header));
+        ++delivered;
+      }
+      idx += sizeof(T);
+    }
+    buffer_idx_ = idx;
+    if (delivered > 0) {
+      count += delivered;
+      stats_.AddRecords(delivered);
+    }
+    // Generic path for a complete record that isn't a plain T: another
+    // rtype, an appended ts_out, or a DBNv1 record needing an upgrade
+    if (end - buffer_idx_ >= sizeof(RecordHeader) &&
+        end - buffer_idx_ >= BufferRecordHeader()->Size()) {
+      const Record* record = DecodeRecord();
+      if (record == nullptr) {
+        return count;
+      }
+      if (record->Holds<T>()) {
+        callback(record->Get<T>());
+        ++count;
+      }
+    }
+  }
+}
 }  // namespace databento
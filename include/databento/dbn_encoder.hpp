@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <memory>   // unique_ptr
+#include <string>
+
+#include "databento/dbn.hpp"       // Metadata
+#include "databento/iwritable.hpp"
+#include "databento/record.hpp"  // Record
+
+namespace databento {
+// DBN encoder. The counterpart to DbnDecoder. Writes the metadata header on
+// construction, after which records can be appended. Records are written
+// as-is, so they should match the version in the metadata.
+class DbnEncoder {
+ public:
+  DbnEncoder(const Metadata& metadata, IWritable* output);
+
+  static void EncodeMetadata(const Metadata& metadata, IWritable* output);
+  static void EncodeRecord(const Record& record, IWritable* output);
+
+  void EncodeRecord(const Record& record);
+
+ private:
+  IWritable* output_;
+};
+
+// A writer of DBN files for local capture, with optional streaming
+// compression. The counterpart to DbnFileStore.
+class DbnFileWriter {
+ public:
+  // The compression codec for the file. Zstd compresses best and suits
+  // archives; Lz4 compresses several times faster at a lower ratio, better
+  // suited to always-on capture where CPU is at a premium. DbnFileStore
+  // detects either codec when reading the file back.
+  enum class Codec : std::uint8_t {
+    None = 0,
+    Zstd,
+    Lz4,
+  };
+
+  DbnFileWriter(const std::string& file_path, const Metadata& metadata);
+  DbnFileWriter(const std::string& file_path, const Metadata& metadata,
+                bool zstd_compress);
+  DbnFileWriter(const std::string& file_path, const Metadata& metadata,
+                Codec codec);
+  // Writes a zstd-compressed file in independent frames of at most
+  // seekable_frame_size uncompressed bytes with a trailing seek table, which
+  // detail::SeekableZstdStream can later use for random access.
+  DbnFileWriter(const std::string& file_path, const Metadata& metadata,
+                std::size_t seekable_frame_size);
+
+  void WriteRecord(const Record& record);
+
+ private:
+  // unique_ptr for a stable address during construction
+  std::unique_ptr<IWritable> output_;
+  DbnEncoder encoder_;
+};
+}  // namespace databento
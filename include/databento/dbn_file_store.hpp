@@ -1,11 +1,14 @@
 #pragma once
 
 #include <string>
+#include <utility>  // forward
 
-#include "databento/dbn.hpp"          // Metadata
-#include "databento/dbn_decoder.hpp"  // DbnDecoder
-#include "databento/enums.hpp"        // VersionUpgradePolicy
-#include "databento/timeseries.hpp"   // MetadataCallback, RecordCallback
+#include "databento/datetime.hpp"        // UnixNanos
+#include "databento/dbn.hpp"             // Metadata
+#include "databento/dbn_decoder.hpp"     // DbnDecoder
+#include "databento/dbn_time_index.hpp"  // DbnTimeIndex
+#include "databento/enums.hpp"           // VersionUpgradePolicy
+#include "databento/timeseries.hpp"      // MetadataCallback, RecordCallback
 
 namespace databento {
 // A reader for DBN files.
@@ -14,12 +17,46 @@ class DbnFileStore {
   explicit DbnFileStore(const std::string& file_path);
   DbnFileStore(const std::string& file_path,
                VersionUpgradePolicy upgrade_policy);
+  // Set use_mmap to read the file through a memory mapping, where decoding
+  // is fed directly from the operating system's page cache. This avoids a
+  // copy per read and is usually faster for replaying large files.
+  DbnFileStore(const std::string& file_path,
+               VersionUpgradePolicy upgrade_policy, bool use_mmap);
 
   void Replay(const MetadataCallback& metadata_callback,
               const RecordCallback& record_callback);
   void Replay(const RecordCallback& record_callback);
+  // Replays the file, invoking the callback directly rather than through
+  // std::function, so a lambda or functor can be inlined into the decode
+  // loop. Preferred over the RecordCallback overloads in hot paths: it
+  // avoids an indirect call per record.
+  template <typename RecordCb>
+  void ReplayWith(RecordCb&& record_callback) {
+    GetMetadata();
+    const Record* record;
+    while ((record = parser_.DecodeRecord()) != nullptr) {
+      if (record_callback(*record) == KeepGoing::Stop) {
+        break;
+      }
+    }
+  }
+  template <typename MetadataCb, typename RecordCb>
+  void ReplayWith(MetadataCb&& metadata_callback, RecordCb&& record_callback) {
+    GetMetadata();
+    metadata_callback(Metadata{metadata_});
+    ReplayWith(std::forward<RecordCb>(record_callback));
+  }
+
+  // Decodes the metadata if it hasn't already been decoded.
+  const Metadata& GetMetadata();
+  // Positions replay so the next record delivered is the first with a
+  // ts_event at or after ts, using the given index to avoid decoding from
+  // the beginning of the file. Only supported for uncompressed files.
+  void SeekToTime(UnixNanos ts, const DbnTimeIndex& index);
 
  private:
   DbnDecoder parser_;
+  Metadata metadata_{};
+  bool has_decoded_metadata_{};
 };
 }  // namespace databento
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <string>
+#include <vector>
+
+#include "databento/datetime.hpp"  // UnixNanos
+
+namespace databento {
+// An index of ts_event checkpoints into an uncompressed DBN file, used with
+// DbnFileStore::SeekToTime to jump near a timestamp without decoding from
+// the beginning of the file. The index is written once to a small binary
+// sidecar file and assumes records are ordered by ts_event.
+class DbnTimeIndex {
+ public:
+  struct Checkpoint {
+    // The byte offset of a record boundary from the beginning of the file.
+    std::uint64_t offset;
+    // The ts_event of the record beginning at offset.
+    UnixNanos ts_event;
+  };
+
+  // Scans the DBN file at dbn_path and writes a checkpoint for every
+  // records_per_checkpoint records to the sidecar file at index_path.
+  static void WriteIndexFile(const std::string& dbn_path,
+                             const std::string& index_path,
+                             std::size_t records_per_checkpoint);
+  // Reads an index previously written with WriteIndexFile.
+  static DbnTimeIndex ReadIndexFile(const std::string& index_path);
+
+  // Returns the offset of the latest checkpoint with a ts_event at or
+  // before ts, or of the first record if every checkpoint is later.
+  std::uint64_t OffsetForTime(UnixNanos ts) const;
+
+  const std::vector<Checkpoint>& Checkpoints() const { return checkpoints_; }
+
+ private:
+  explicit DbnTimeIndex(std::vector<Checkpoint> checkpoints);
+
+  std::vector<Checkpoint> checkpoints_;
+};
+}  // namespace databento
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <memory>   // shared_ptr
+#include <vector>
+
+#include "databento/ireadable.hpp"
+
+namespace databento {
+namespace detail {
+// Copyable, unidirectional channel of owned buffer slices. Where
+// `SharedChannel` copies bytes into and back out of a ring buffer, the
+// writer here hands off whole buffers that the reader takes and consumes in
+// place, so the only copy on the streaming path is the one that takes
+// ownership of the producer's bytes. Supports one writing thread and one
+// reading thread. Implements `IReadable` for consumers that need a byte
+// stream; slice-aware consumers use `NextSlice` to take each buffer without
+// copying.
+class BufferChannel : public IReadable {
+ public:
+  BufferChannel();
+
+  // Copies `data` of `length` bytes into a new owned slice and enqueues it.
+  // Blocks while the high watermark of buffered bytes is reached, bounding
+  // memory when the reader is slower than the writer.
+  void Write(const std::uint8_t* data, std::size_t length);
+  // Enqueues `slice` without copying.
+  void Write(std::vector<std::uint8_t>&& slice);
+  // Signal the end of input.
+  void Finish();
+  // Closes the channel from the reading side. A writer blocked on the high
+  // watermark is released with its slice discarded, as is every subsequent
+  // write, and readers see the end of the stream. Unlike `Finish`, this is
+  // safe to call while the writer is still active, letting a reader that's
+  // seen enough tear the stream down without draining the rest of it.
+  void Abort();
+  // Returns the channel to its initial state so it can be reused for a new
+  // stream, dropping any unread slices and clearing the finished flag.
+  // Should only be called while no other thread is using the channel.
+  void Reset();
+  // Takes the next slice, blocking until one is available. `*offset` is set
+  // to the first unread index within `*slice`, which is nonzero when part
+  // of the slice was already consumed through the `IReadable` interface.
+  // Returns false once the stream is finished and every slice has been
+  // taken, leaving `*slice` empty.
+  bool NextSlice(std::vector<std::uint8_t>* slice, std::size_t* offset);
+  // Read exactly `length` bytes.
+  void ReadExact(std::uint8_t* buffer, std::size_t length) override;
+  // Read at most `length` bytes. Returns the number of bytes read. Will only
+  // return 0 if the end of the stream is reached.
+  std::size_t ReadSome(std::uint8_t* buffer, std::size_t length) override;
+
+ private:
+  class Channel;
+
+  std::shared_ptr<Channel> channel_;
+};
+}  // namespace detail
+}  // namespace databento
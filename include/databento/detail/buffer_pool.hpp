@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <mutex>
+#include <vector>
+
+namespace databento {
+namespace detail {
+// Recycles the transient I/O buffers the streaming components allocate per
+// session. Buffers are grouped into power-of-two size classes from 4 KiB to
+// 4 MiB. Each class keeps a small mutex-guarded free list, fronted by a
+// one-buffer-per-class thread-local cache, so steady-state reuse on one
+// thread never takes a lock. A recycled buffer keeps its pages mapped and
+// warm, so request-churn workloads stop round-tripping every buffer through
+// the allocator and refaulting its pages. Buffers are plain vectors with no
+// back-reference to the pool: releasing a buffer into a different pool is
+// safe, as is destroying a pool while buffers it handed out are still alive.
+class BufferPool {
+ public:
+  // The process-wide pool shared by the streaming components.
+  static BufferPool& Shared();
+
+  BufferPool() = default;
+  BufferPool(const BufferPool&) = delete;
+  BufferPool& operator=(const BufferPool&) = delete;
+
+  // Returns an empty buffer whose capacity is at least `min_capacity`,
+  // recycling an idle buffer when one is available. Requests larger than the
+  // largest size class are served directly by the allocator.
+  std::vector<std::uint8_t> Acquire(std::size_t min_capacity);
+  // Returns a buffer to the pool for reuse, dropping its contents. Buffers
+  // smaller than the smallest size class or larger than the largest are
+  // freed instead, as is any buffer past its class's retention cap.
+  void Release(std::vector<std::uint8_t>&& buffer);
+  // The number of idle buffers currently retained across all size classes,
+  // not counting the thread-local caches.
+  std::size_t PooledCount() const;
+
+ private:
+  static constexpr std::size_t kMinClassCapacity = std::size_t{1} << 12;
+  static constexpr std::size_t kNumClasses = 11;
+  // Caps the number of idle buffers retained per size class
+  static constexpr std::size_t kMaxPooledPerClass = 8;
+
+  struct SizeClass {
+    mutable std::mutex mutex;
+    std::vector<std::vector<std::uint8_t>> free_list;
+  };
+
+  // The smallest class able to satisfy an acquisition of `capacity` bytes,
+  // or kNumClasses when it exceeds the largest class
+  static std::size_t ClassForAcquire(std::size_t capacity);
+  // The largest class whose acquisitions a released buffer of `capacity`
+  // bytes can serve, or kNumClasses when no class can reuse it
+  static std::size_t ClassForRelease(std::size_t capacity);
+  // The calling thread's cache: at most one idle buffer per size class,
+  // shared by all pools since buffers are interchangeable between them
+  static std::array<std::vector<std::uint8_t>, kNumClasses>& ThreadCache();
+
+  std::array<SizeClass, kNumClasses> classes_;
+};
+}  // namespace detail
+}  // namespace databento
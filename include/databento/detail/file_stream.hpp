@@ -5,22 +5,57 @@
 #include <fstream>  // ifstream
 #include <string>
 
+#include "databento/detail/scoped_fd.hpp"
 #include "databento/ireadable.hpp"
 
 namespace databento {
 namespace detail {
+// Kernel page cache advice applied while reading a file sequentially. The
+// defaults preserve the previous behavior of issuing no advice. Advice is
+// best-effort: it's only supported on POSIX platforms and failures are
+// ignored.
+struct ReadAdvice {
+  // Whether to issue posix_fadvise(POSIX_FADV_SEQUENTIAL) on open, letting
+  // the kernel grow its own readahead window for the file.
+  bool sequential{false};
+  // The number of bytes to prefetch ahead of the read position with
+  // POSIX_FADV_WILLNEED, or 0 to disable. Useful for cold files where the
+  // decoder would otherwise stall on the first read of each region.
+  std::size_t readahead_size{0};
+  // Whether to drop consumed ranges from the page cache with
+  // POSIX_FADV_DONTNEED, keeping huge single-pass replays from evicting
+  // the rest of the page cache.
+  bool drop_consumed{false};
+};
+
 class FileStream : public IReadable {
  public:
   explicit FileStream(const std::string& file_path);
+  FileStream(const std::string& file_path, ReadAdvice advice);
 
   // Read exactly `length` bytes into `buffer`.
   void ReadExact(std::uint8_t* buffer, std::size_t length) override;
   // Read at most `length` bytes. Returns the number of bytes read. Will only
   // return 0 if the end of the stream is reached.
   std::size_t ReadSome(std::uint8_t* buffer, std::size_t max_length) override;
+  bool CanSeek() const override { return true; }
+  void Seek(std::size_t offset) override;
 
  private:
+  void AdviseRead(std::size_t read_size);
+
   std::ifstream stream_;
+  ReadAdvice advice_;
+  // A descriptor for the same file used only for posix_fadvise, which acts
+  // on the file's page cache regardless of which descriptor it's issued
+  // through. Only opened when some advice is enabled.
+  ScopedFd advice_fd_;
+  // The stream position, tracked for computing advice ranges
+  std::size_t pos_{};
+  // The end of the range WILLNEED has been issued for
+  std::size_t readahead_until_{};
+  // The end of the range DONTNEED has been issued for
+  std::size_t dropped_until_{};
 };
 }  // namespace detail
 }  // namespace databento
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <fstream>  // ofstream
+#include <string>
+
+#include "databento/iwritable.hpp"
+
+namespace databento {
+namespace detail {
+class FileWriteStream : public IWritable {
+ public:
+  explicit FileWriteStream(const std::string& file_path);
+
+  // Write exactly `length` bytes from `buffer`.
+  void WriteAll(const std::uint8_t* buffer, std::size_t length) override;
+
+ private:
+  std::ofstream stream_;
+};
+}  // namespace detail
+}  // namespace databento
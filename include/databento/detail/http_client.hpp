@@ -8,12 +8,21 @@
 #include <httplib.h>
 #include <nlohmann/json.hpp>
 
+#include <condition_variable>
+#include <cstddef>  // size_t
 #include <cstdint>
+#include <memory>  // unique_ptr
+#include <mutex>
 #include <string>
+#include <utility>  // move
+#include <vector>
 
 namespace databento {
 class ILogReceiver;
 namespace detail {
+// Each request checks a persistent keep-alive connection out of a pool, so
+// repeated calls reuse the TLS session instead of paying a handshake per
+// call, and concurrent requests each get their own connection.
 class HttpClient {
  public:
   HttpClient(ILogReceiver* log_receiver, const std::string& key,
@@ -21,23 +30,85 @@ class HttpClient {
   HttpClient(ILogReceiver* log_receiver, const std::string& key,
              const std::string& gateway, std::uint16_t port);
 
+  // Caps the number of concurrent connections to the gateway. Callers past
+  // the cap wait for a connection to be returned to the pool rather than
+  // opening another, so many-small-request workloads share a few warm TLS
+  // connections instead of paying a handshake and a separate congestion
+  // window each. Throws InvalidArgumentError when `max_connections` is zero.
+  void SetMaxConnections(std::size_t max_connections);
+
   nlohmann::json GetJson(const std::string& path,
                          const httplib::Params& params);
   nlohmann::json PostJson(const std::string& path,
                           const httplib::Params& params);
+  // Returns the raw response body after status and warning checks, leaving
+  // parsing to the caller.
+  std::string PostRaw(const std::string& path, const httplib::Params& params);
   void GetRawStream(const std::string& path, const httplib::Params& params,
                     const httplib::ContentReceiver& callback);
+  // Streams the byte range [start, start + length) of the response body.
+  // The server must support HTTP range requests.
+  void GetRangeRawStream(const std::string& path,
+                         const httplib::Params& params, std::uint64_t start,
+                         std::uint64_t length,
+                         const httplib::ContentReceiver& callback);
 
  private:
+  // RAII checkout of a pooled connection, returned on destruction.
+  class PooledClient {
+   public:
+    PooledClient(HttpClient* pool, std::unique_ptr<httplib::Client> client)
+        : pool_{pool}, client_{std::move(client)} {}
+    PooledClient(PooledClient&& other) noexcept
+        : pool_{other.pool_}, client_{std::move(other.client_)} {}
+    PooledClient& operator=(PooledClient&&) = delete;
+    PooledClient(const PooledClient&) = delete;
+    PooledClient& operator=(const PooledClient&) = delete;
+    ~PooledClient();
+
+    httplib::Client* operator->() { return client_.get(); }
+
+   private:
+    HttpClient* pool_;
+    std::unique_ptr<httplib::Client> client_;
+  };
+
+  // Behind a `unique_ptr` so `HttpClient` remains movable.
+  struct ConnectionPool {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::unique_ptr<httplib::Client>> clients;
+    // Connections currently checked out
+    std::size_t outstanding{0};
+    std::size_t max_connections{kDefaultMaxConnections};
+  };
+
+  PooledClient CheckOut();
+  void CheckIn(std::unique_ptr<httplib::Client>&& client);
+  std::string CheckResponse(const std::string& path,
+                            httplib::Result&& res) const;
   nlohmann::json CheckAndParseResponse(const std::string& path,
                                        httplib::Result&& res) const;
   void CheckWarnings(const httplib::Response& response) const;
   static bool IsErrorStatus(int status_code);
+  // Decompresses a zstd-encoded response body
+  static std::string DecompressZstdBody(const std::string& path,
+                                        const std::string& body);
+
+  static constexpr std::size_t kDefaultMaxConnections = 6;
 
   static const httplib::Headers kHeaders;
+  // Extra headers for the JSON endpoints, negotiating a compressed content
+  // encoding. Not sent on the raw streaming endpoints, whose DBN payloads
+  // are already zstd-compressed.
+  static const httplib::Headers kJsonHeaders;
 
   ILogReceiver* log_receiver_;
-  httplib::Client client_;
+  const std::string key_;
+  const std::string gateway_;
+  // The gateway port, or zero for the scheme default
+  const std::uint16_t port_{};
+  std::unique_ptr<ConnectionPool> pool_;
 };
 }  // namespace detail
 }  // namespace databento
@@ -0,0 +1,69 @@
+#pragma once
+
+#ifdef __linux__
+
+#include <chrono>   // milliseconds
+#include <cstddef>  // size_t
+#include <cstdint>
+
+#include "databento/detail/scoped_fd.hpp"   // ScopedFd, Socket
+#include "databento/detail/tcp_client.hpp"  // TcpClient::Result
+
+struct io_uring_params;
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace databento {
+namespace detail {
+// A socket read path backed by an io_uring submission queue. Each receive
+// (and for the timeout overload, a linked timeout) is submitted and waited
+// on with a single io_uring_enter syscall, replacing the poll-then-recv
+// syscall pair on the portable path. Supports one in-flight receive issued
+// from one thread, matching how the live clients read.
+class IoUringReceiver {
+ public:
+  // Doesn't take ownership of the socket, which must outlive this object.
+  explicit IoUringReceiver(Socket socket);
+  IoUringReceiver(const IoUringReceiver&) = delete;
+  IoUringReceiver& operator=(const IoUringReceiver&) = delete;
+  IoUringReceiver(IoUringReceiver&&) = delete;
+  IoUringReceiver& operator=(IoUringReceiver&&) = delete;
+  ~IoUringReceiver();
+
+  // Receive at most `max_size` bytes. Returns the number of bytes received,
+  // which is only 0 when the socket is closed.
+  std::size_t Receive(char* buffer, std::size_t max_size);
+  // Passing a timeout of 0 will block until data is available or the socket
+  // is closed, the same behavior as the overload without a timeout.
+  TcpClient::Result Receive(char* buffer, std::size_t max_size,
+                            std::chrono::milliseconds timeout);
+
+ private:
+  void MapRings(const io_uring_params& params);
+  void UnmapRings();
+  void PushSqe(std::uint8_t opcode, std::uint64_t addr, std::uint32_t len,
+               std::uint8_t flags, std::uint64_t user_data);
+  // Submits `to_submit` queued entries and waits for the receive to
+  // complete. Returns its raw completion result: a size or a negative errno.
+  std::int32_t SubmitAndWaitRecv(unsigned to_submit);
+
+  Socket socket_;
+  ScopedFd ring_fd_;
+  void* sq_ring_{};
+  std::size_t sq_ring_size_{};
+  void* cq_ring_{};
+  std::size_t cq_ring_size_{};
+  io_uring_sqe* sqes_{};
+  std::size_t sqes_size_{};
+  unsigned* sq_tail_{};
+  unsigned* sq_mask_{};
+  unsigned* sq_array_{};
+  unsigned* cq_head_{};
+  unsigned* cq_tail_{};
+  unsigned* cq_mask_{};
+  io_uring_cqe* cqes_{};
+};
+}  // namespace detail
+}  // namespace databento
+
+#endif  // __linux__
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <lz4frame.h>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "databento/detail/scoped_thread.hpp"  // ScopedThread
+
+namespace databento {
+class ILogReceiver;
+
+namespace detail {
+// Journals raw bytes into memory-mapped, size-rotated segment files on a
+// background thread. The write path copies into a lock-free ring without
+// allocating, so it's safe to call from a latency-sensitive receive loop.
+class JournalWriter {
+ public:
+  struct Conf {
+    // Path prefix for the journal: segments are written to
+    // `<path_prefix>.<index>`
+    std::string path_prefix;
+    // Bytes per memory-mapped segment before rotating to a new file
+    std::size_t segment_size{256UL * 1024 * 1024};
+    // Capacity in bytes of the ring between the write path and the writer
+    // thread, rounded up to a power of two
+    std::size_t buffer_size{1UL << 20};
+    // Compress each segment as a standalone LZ4 frame, trading ratio for
+    // GB/s-class speed so an always-on journal costs a fraction of a core.
+    // Compression runs on the writer thread; the write path is unchanged.
+    // Compressed segments rotate before a block could overflow the mapping,
+    // so they come out somewhat smaller than `segment_size`. Read one back
+    // with Lz4Stream or any LZ4-frame decoder.
+    bool lz4_compress{false};
+  };
+
+  // Opens the first segment, throwing on failure.
+  JournalWriter(ILogReceiver* log_receiver, Conf conf);
+  // Not copyable or movable: the writer thread holds a reference
+  JournalWriter(const JournalWriter&) = delete;
+  JournalWriter& operator=(const JournalWriter&) = delete;
+  // Flushes the ring and truncates the last segment to the bytes written.
+  ~JournalWriter();
+
+  // Copies `size` bytes into the ring without locking or allocating. Spins
+  // if the writer thread has fallen a full ring behind.
+  void Write(const char* data, std::size_t size);
+
+ private:
+  void WriterThread();
+  // Opens and maps the next segment file, beginning its LZ4 frame when
+  // compressing. Returns false (and logs) on failure, which permanently
+  // stops journaling.
+  bool OpenSegment();
+  void CloseSegment(std::size_t used_size);
+  // Finishes the current segment's LZ4 frame, writing its end mark into the
+  // mapping.
+  void EndFrame();
+
+  ILogReceiver* log_receiver_;
+  Conf conf_;
+  std::vector<char> ring_;
+  std::size_t ring_mask_;
+  // Total bytes pushed into the ring, only incremented by the write path
+  std::atomic<std::size_t> head_{0};
+  // Total bytes consumed from the ring, only incremented by the writer
+  // thread
+  std::atomic<std::size_t> tail_{0};
+  std::atomic<bool> keep_going_{true};
+  // The remaining members are only used by the writer thread after
+  // construction
+  char* map_{nullptr};
+#ifdef _WIN32
+  void* file_handle_{nullptr};
+  void* mapping_handle_{nullptr};
+#else
+  int fd_{-1};
+#endif
+  std::size_t segment_index_{0};
+  std::size_t segment_pos_{0};
+  // Null unless compressing
+  LZ4F_cctx* lz4_cctx_{nullptr};
+  ScopedThread thread_;
+};
+}  // namespace detail
+}  // namespace databento
@@ -2,13 +2,16 @@
 
 #include <nlohmann/json.hpp>
 
+#include <array>
 #include <map>  // multimap
+#include <streambuf>
 #include <string>
 #include <vector>
 
 #include "databento/datetime.hpp"    // UnixNanos
 #include "databento/enums.hpp"       // FromString
 #include "databento/exceptions.hpp"  // JsonResponseError
+#include "databento/ireadable.hpp"
 
 namespace httplib {
 using Params = std::multimap<std::string, std::string>;
@@ -38,6 +41,20 @@ inline void SetIfPositive<databento::UnixNanos>(
   }
 }
 
+// Presents an `IReadable` as an input stream so a JSON response can be
+// parsed while it's still downloading.
+class IReadableStreambuf : public std::streambuf {
+ public:
+  explicit IReadableStreambuf(IReadable* source);
+
+ protected:
+  int_type underflow() override;
+
+ private:
+  IReadable* source_;
+  std::array<char, 16 * 1024> buffer_;
+};
+
 const nlohmann::json& CheckedAt(const std::string& endpoint,
                                 const nlohmann::json& json,
                                 const std::string& key);
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <lz4frame.h>
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <memory>   // unique_ptr
+#include <vector>
+
+#include "databento/iwritable.hpp"
+
+namespace databento {
+namespace detail {
+// A streaming LZ4-frame compressor in front of another IWritable. LZ4
+// compresses several times faster than zstd at a lower ratio, making it the
+// better fit for always-on capture where compression CPU is at a premium.
+// The frame header is written on construction and the frame is finished
+// when the stream is destroyed, producing a standard `.lz4` file.
+class Lz4CompressStream : public IWritable {
+ public:
+  explicit Lz4CompressStream(std::unique_ptr<IWritable> output);
+  Lz4CompressStream(int compression_level, std::unique_ptr<IWritable> output);
+  Lz4CompressStream(const Lz4CompressStream&) = delete;
+  Lz4CompressStream& operator=(const Lz4CompressStream&) = delete;
+  ~Lz4CompressStream() override;
+
+  // Write exactly `length` bytes from `buffer`.
+  void WriteAll(const std::uint8_t* buffer, std::size_t length) override;
+
+ private:
+  std::unique_ptr<IWritable> output_;
+  std::unique_ptr<LZ4F_cctx, std::size_t (*)(LZ4F_cctx*)> cctx_;
+  LZ4F_preferences_t prefs_{};
+  std::vector<std::uint8_t> out_buffer_;
+};
+}  // namespace detail
+}  // namespace databento
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <lz4frame.h>
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <memory>   // unique_ptr
+#include <vector>
+
+#include "databento/ireadable.hpp"
+
+namespace databento {
+namespace detail {
+// A streaming LZ4-frame decompressor. The counterpart to Lz4CompressStream,
+// it reads back `.lz4` files such as captures and journal segments,
+// including files of several concatenated frames.
+class Lz4Stream : public IReadable {
+ public:
+  explicit Lz4Stream(std::unique_ptr<IReadable> input);
+  Lz4Stream(std::unique_ptr<IReadable> input,
+            std::vector<std::uint8_t>&& in_buffer);
+  Lz4Stream(const Lz4Stream&) = delete;
+  Lz4Stream& operator=(const Lz4Stream&) = delete;
+  // Returns the input buffer to the shared buffer pool for reuse.
+  ~Lz4Stream() override;
+
+  // Read exactly `length` bytes into `buffer`.
+  void ReadExact(std::uint8_t* buffer, std::size_t length) override;
+  // Read at most `length` bytes. Returns the number of bytes read. Will only
+  // return 0 if the end of the stream is reached.
+  std::size_t ReadSome(std::uint8_t* buffer, std::size_t max_length) override;
+
+ private:
+  std::unique_ptr<IReadable> input_;
+  std::unique_ptr<LZ4F_dctx, std::size_t (*)(LZ4F_dctx*)> dctx_;
+  std::vector<std::uint8_t> in_buffer_;
+  // The first unconsumed index within in_buffer_
+  std::size_t in_pos_{};
+  // The number of valid bytes in in_buffer_
+  std::size_t in_size_;
+  // Nonzero while the decoder expects more input for the current frame
+  std::size_t expected_{};
+};
+}  // namespace detail
+}  // namespace databento
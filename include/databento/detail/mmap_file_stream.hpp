@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <string>
+
+#include "databento/ireadable.hpp"
+
+namespace databento {
+namespace detail {
+// A memory-mapped implementation of IReadable. Reads are served directly
+// from the operating system's page cache rather than through a userspace
+// read buffer, which avoids a copy per read for large files.
+class MmapFileStream : public IReadable {
+ public:
+  explicit MmapFileStream(const std::string& file_path);
+  MmapFileStream(const MmapFileStream&) = delete;
+  MmapFileStream& operator=(const MmapFileStream&) = delete;
+  MmapFileStream(MmapFileStream&& other) noexcept;
+  MmapFileStream& operator=(MmapFileStream&& rhs) noexcept;
+  ~MmapFileStream() override;
+
+  // Read exactly `length` bytes into `buffer`.
+  void ReadExact(std::uint8_t* buffer, std::size_t length) override;
+  // Read at most `length` bytes. Returns the number of bytes read. Will only
+  // return 0 if the end of the stream is reached.
+  std::size_t ReadSome(std::uint8_t* buffer, std::size_t max_length) override;
+  bool CanSeek() const override { return true; }
+  void Seek(std::size_t offset) override;
+
+  // The total size of the mapped file in bytes.
+  std::size_t Size() const { return size_; }
+  // A pointer to the start of the mapping, valid for Size() bytes.
+  const std::uint8_t* Data() const { return map_; }
+
+ private:
+  void Unmap();
+
+  const std::uint8_t* map_{nullptr};
+  std::size_t size_{};
+  std::size_t pos_{};
+#ifdef _WIN32
+  void* file_handle_{nullptr};
+  void* mapping_handle_{nullptr};
+#endif
+};
+}  // namespace detail
+}  // namespace databento
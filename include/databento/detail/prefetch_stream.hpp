@@ -0,0 +1,65 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <deque>
+#include <exception>  // exception_ptr
+#include <memory>     // unique_ptr
+#include <mutex>
+#include <vector>
+
+#include "databento/detail/scoped_thread.hpp"
+#include "databento/ireadable.hpp"
+
+namespace databento {
+namespace detail {
+// An IReadable that reads ahead of the consumer on a background thread,
+// overlapping I/O (and decompression, when wrapping a ZstdStream) with
+// whatever the consumer does between reads. The background thread fills a
+// small bounded queue of buffers and blocks once it's max_buffers ahead.
+class PrefetchStream : public IReadable {
+ public:
+  explicit PrefetchStream(std::unique_ptr<IReadable> source);
+  PrefetchStream(std::unique_ptr<IReadable> source, std::size_t buffer_size,
+                 std::size_t max_buffers);
+  PrefetchStream(const PrefetchStream&) = delete;
+  PrefetchStream& operator=(const PrefetchStream&) = delete;
+  PrefetchStream(PrefetchStream&&) = delete;
+  PrefetchStream& operator=(PrefetchStream&&) = delete;
+  ~PrefetchStream() override;
+
+  // Read exactly `length` bytes into `buffer`.
+  void ReadExact(std::uint8_t* buffer, std::size_t length) override;
+  // Read at most `length` bytes. Returns the number of bytes read. Will only
+  // return 0 if the end of the stream is reached.
+  std::size_t ReadSome(std::uint8_t* buffer, std::size_t max_length) override;
+
+ private:
+  void ProcessSource();
+
+  std::unique_ptr<IReadable> source_;
+  const std::size_t buffer_size_;
+  const std::size_t max_buffers_;
+  std::mutex mutex_;
+  std::condition_variable producer_cv_;
+  std::condition_variable consumer_cv_;
+  // Filled buffers in read order. Protected by mutex_.
+  std::deque<std::vector<std::uint8_t>> buffers_;
+  // Set once the source has reached its end. Protected by mutex_.
+  bool finished_{false};
+  // Set by the destructor to stop the background thread. Protected by mutex_.
+  bool shutdown_{false};
+  // An error raised on the background thread, rethrown from the next read.
+  // Protected by mutex_.
+  std::exception_ptr error_;
+  // The buffer currently being consumed and the read position within it.
+  // Only touched by the consumer thread.
+  std::vector<std::uint8_t> current_;
+  std::size_t current_idx_{};
+  // Must be initialized last so all other members are ready when the thread
+  // starts
+  ScopedThread thread_;
+};
+}  // namespace detail
+}  // namespace databento
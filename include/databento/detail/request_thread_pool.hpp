@@ -0,0 +1,55 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>  // function
+#include <future>      // future, packaged_task
+#include <memory>      // make_shared
+#include <mutex>
+#include <type_traits>  // result_of
+#include <utility>      // move
+#include <vector>
+
+#include "databento/detail/scoped_thread.hpp"
+
+namespace databento {
+namespace detail {
+// A small fixed-size thread pool for overlapping independent API requests.
+// Worker threads are spawned lazily on the first submission, so an unused
+// pool costs nothing. The destructor drains any queued tasks before joining.
+class RequestThreadPool {
+ public:
+  explicit RequestThreadPool(std::size_t thread_count);
+  RequestThreadPool(const RequestThreadPool&) = delete;
+  RequestThreadPool& operator=(const RequestThreadPool&) = delete;
+  ~RequestThreadPool();
+
+  // Schedules `task` to run on a worker thread, returning a future for its
+  // result. Any exception the task throws is rethrown when the future's
+  // result is retrieved.
+  template <typename F>
+  std::future<typename std::result_of<F()>::type> Submit(F task) {
+    using R = typename std::result_of<F()>::type;
+    // shared_ptr because packaged_task is move-only and std::function
+    // requires a copyable target
+    auto packaged =
+        std::make_shared<std::packaged_task<R()>>(std::move(task));
+    std::future<R> future = packaged->get_future();
+    this->SubmitTask([packaged]() { (*packaged)(); });
+    return future;
+  }
+
+ private:
+  void SubmitTask(std::function<void()>&& task);
+  void ProcessTasks();
+
+  const std::size_t thread_count_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::function<void()>> tasks_;
+  bool is_shutting_down_{false};
+  std::vector<ScopedThread> threads_;
+};
+}  // namespace detail
+}  // namespace databento
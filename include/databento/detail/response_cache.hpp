@@ -0,0 +1,36 @@
+#pragma once
+
+#include <map>  // multimap
+#include <string>
+
+namespace httplib {
+using Params = std::multimap<std::string, std::string>;
+}
+
+namespace databento {
+class ILogReceiver;
+namespace detail {
+// Persists API responses in files under a directory, keyed by a digest of
+// the request path, the request parameters, and the current UTC date, so
+// entries implicitly expire at midnight UTC. Storage failures are logged
+// and otherwise ignored: the cache is best-effort and the caller falls
+// back to the network.
+class ResponseCache {
+ public:
+  ResponseCache(ILogReceiver* log_receiver, std::string cache_dir);
+
+  // Returns the cached contents for the request, or an empty string on a
+  // cache miss.
+  std::string Load(const std::string& path, const httplib::Params& params);
+  void Store(const std::string& path, const httplib::Params& params,
+             const std::string& contents);
+
+ private:
+  std::string EntryPath(const std::string& path,
+                        const httplib::Params& params) const;
+
+  ILogReceiver* log_receiver_;
+  const std::string cache_dir_;
+};
+}  // namespace detail
+}  // namespace databento
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <memory>   // unique_ptr
+#include <string>
+#include <vector>
+
+#include "databento/detail/zstd_stream.hpp"
+#include "databento/ireadable.hpp"
+
+namespace databento {
+namespace detail {
+// A random-access reader for files in the seekable-zstd format, i.e. files
+// compressed in independent frames with a trailing seek table, as written by
+// ZstdCompressStream with a seekable frame size. Seek offsets are in
+// decompressed bytes: seeking jumps to the frame containing the offset and
+// decompresses only from the start of that frame.
+class SeekableZstdStream : public IReadable {
+ public:
+  explicit SeekableZstdStream(const std::string& file_path);
+
+  // Read exactly `length` bytes into `buffer`.
+  void ReadExact(std::uint8_t* buffer, std::size_t length) override;
+  // Read at most `length` bytes. Returns the number of bytes read. Will only
+  // return 0 if the end of the stream is reached.
+  std::size_t ReadSome(std::uint8_t* buffer, std::size_t max_length) override;
+  bool CanSeek() const override { return true; }
+  void Seek(std::size_t offset) override;
+
+  // The total decompressed size in bytes.
+  std::size_t Size() const { return size_; }
+
+ private:
+  struct Frame {
+    // Offsets of the frame's first byte within the compressed file and the
+    // decompressed stream respectively
+    std::uint64_t compressed_offset;
+    std::uint64_t decompressed_offset;
+  };
+
+  void ReadSeekTable();
+
+  std::string file_path_;
+  std::vector<Frame> frames_;
+  // Total decompressed size
+  std::size_t size_{};
+  // Position in the decompressed stream
+  std::size_t pos_{};
+  std::unique_ptr<ZstdStream> zstd_;
+};
+}  // namespace detail
+}  // namespace databento
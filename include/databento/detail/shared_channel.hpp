@@ -8,20 +8,38 @@
 
 namespace databento {
 namespace detail {
-// Copyable, thread-safe, unidirectional channel.
+// Copyable, unidirectional channel. Backed by a fixed-capacity lock-free
+// ring buffer supporting one writing thread and one reading thread; a side
+// only blocks when the channel is full (writer) or empty (reader).
 class SharedChannel : public IReadable {
  public:
   SharedChannel();
+  // Overrides the default flow-control watermarks. The writer blocks while
+  // high_watermark or more bytes are buffered, bounding memory when the
+  // reader is slower than the writer. A reader that went to sleep on an
+  // empty channel isn't woken until low_watermark bytes are buffered (or
+  // the channel is finished), batching wakeups when writes arrive in many
+  // small chunks. high_watermark is clamped to the channel capacity and
+  // must be at least low_watermark.
+  SharedChannel(std::size_t high_watermark, std::size_t low_watermark);
 
   // Write `data` of `length` bytes to the channel.
   void Write(const std::uint8_t* data, std::size_t length);
   // Signal the end of input.
   void Finish();
+  // Closes the channel from the reading side. A writer blocked on the high
+  // watermark is released with its bytes discarded, as is every subsequent
+  // write, and readers see the end of the stream. Unlike `Finish`, this is
+  // safe to call while the writer is still active, letting a reader that's
+  // seen enough tear the stream down without draining the rest of it.
+  void Abort();
   // Read exactly `length` bytes.
   void ReadExact(std::uint8_t* buffer, std::size_t length) override;
   // Read at most `length` bytes. Returns the number of bytes read. Will only
   // return 0 if the end of the stream is reached.
   std::size_t ReadSome(std::uint8_t* buffer, std::size_t length) override;
+  // The number of written bytes not yet read, i.e. the channel depth.
+  std::size_t BytesBuffered() const;
 
  private:
   class Channel;
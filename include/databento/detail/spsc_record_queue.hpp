@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "databento/record.hpp"  // kMaxRecordLen, Record
+
+namespace databento {
+namespace detail {
+// A bounded lock-free single-producer single-consumer queue of records.
+// Each slot holds a copy of the record payload, so queued records don't
+// alias the producer's read buffer.
+class SpscRecordQueue {
+ public:
+  // `capacity` is the number of record slots, rounded up to a power of two.
+  explicit SpscRecordQueue(std::size_t capacity);
+  // Not copyable or movable: both threads hold a reference to the queue
+  SpscRecordQueue(const SpscRecordQueue&) = delete;
+  SpscRecordQueue& operator=(const SpscRecordQueue&) = delete;
+
+  std::size_t Capacity() const { return mask_ + 1; }
+  bool Empty() const {
+    return head_.load(std::memory_order_acquire) ==
+           tail_.load(std::memory_order_acquire);
+  }
+
+  // Copies `record` into the queue. Returns false when the queue is full.
+  // Throws InvalidArgumentError for records larger than kMaxRecordLen
+  // rather than overflow a slot. May only be called from the producer
+  // thread.
+  bool TryPush(const Record& record);
+  // Returns the next record or `nullptr` when the queue is empty. The
+  // returned record is valid until the next call. May only be called from
+  // the consumer thread.
+  const Record* TryPop();
+
+ private:
+  std::size_t SlotOffset(std::size_t index) const {
+    return (index & mask_) * kMaxRecordLen;
+  }
+
+  std::size_t mask_;
+  // kMaxRecordLen is a multiple of alignof(RecordHeader), so every slot
+  // remains suitably aligned for records
+  std::vector<std::uint8_t> storage_;
+  // Index of the next slot to write, only incremented by the producer
+  std::atomic<std::size_t> head_{0};
+  // Index of the next slot to read, only incremented by the consumer
+  std::atomic<std::size_t> tail_{0};
+  // Whether the consumer is still reading the slot at `tail_`, which is
+  // released on its next call to `TryPop`
+  bool release_pending_{false};
+  Record current_record_{nullptr};
+};
+}  // namespace detail
+}  // namespace databento
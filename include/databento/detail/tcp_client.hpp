@@ -1,13 +1,24 @@
 #pragma once
 
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>  // socklen_t
+#else
+#include <sys/socket.h>  // sockaddr_storage, socklen_t
+#endif
+
 #include <chrono>  // milliseconds
 #include <cstdint>
+#include <memory>  // unique_ptr
 #include <string>
+#include <vector>
 
 #include "databento/detail/scoped_fd.hpp"  // ScopedFd
 
 namespace databento {
 namespace detail {
+class IoUringReceiver;
+
 class TcpClient {
  public:
   enum class Status : std::uint8_t {
@@ -26,26 +37,93 @@ class TcpClient {
     std::chrono::seconds max_wait{std::chrono::minutes{1}};
   };
 
+  struct SocketConf {
+    // Disables Nagle's algorithm so writes are sent immediately.
+    bool tcp_nodelay{false};
+    // Requested size of the kernel receive buffer (SO_RCVBUF) in bytes for
+    // absorbing bursts. Zero leaves the operating system default.
+    std::size_t recv_buffer_size{0};
+    // How long reads should busy-poll the device queue (SO_BUSY_POLL) to
+    // reduce latency at the cost of CPU. Zero disables busy-polling. Ignored
+    // on platforms without SO_BUSY_POLL.
+    std::chrono::microseconds busy_poll_duration{0};
+    // Experimental: asks the kernel to serve this socket's receives from
+    // busy polling instead of device interrupts (SO_PREFER_BUSY_POLL),
+    // taking the interrupt path out of the receive latency entirely — the
+    // closest supported analogue to a kernel-bypass backend. Meant to be
+    // combined with `busy_poll_duration`. Requires Linux 5.11+ and
+    // CAP_NET_ADMIN; constructing a client with this option set throws
+    // where it's unsupported. Ignored on platforms without the option.
+    bool prefer_busy_poll{false};
+    // Packets the kernel may process per busy poll (SO_BUSY_POLL_BUDGET)
+    // when `prefer_busy_poll` is set. Zero leaves the kernel default.
+    std::uint32_t busy_poll_budget{0};
+    // Reads through an io_uring submission queue, halving the syscalls on
+    // the read path. Only supported on Linux: constructing a client with
+    // this option set elsewhere throws an exception.
+    bool io_uring{false};
+  };
+
+  // A resolved gateway address.
+  struct Address {
+    sockaddr_storage storage;
+    socklen_t length;
+  };
+  // The addresses a gateway resolved to, which can be cached to reconnect
+  // without repeating DNS resolution.
+  using AddressList = std::vector<Address>;
+
+  // Resolves a gateway to its addresses without connecting.
+  static AddressList Resolve(const std::string& gateway, std::uint16_t port);
+
   TcpClient(const std::string& gateway, std::uint16_t port);
   TcpClient(const std::string& gateway, std::uint16_t port,
             RetryConf retry_conf);
+  TcpClient(const std::string& gateway, std::uint16_t port,
+            RetryConf retry_conf, SocketConf socket_conf);
+  TcpClient(const AddressList& addresses, RetryConf retry_conf,
+            SocketConf socket_conf);
+  TcpClient(TcpClient&&) noexcept;
+  TcpClient& operator=(TcpClient&&) noexcept;
+  TcpClient(const TcpClient&) = delete;
+  TcpClient& operator=(const TcpClient&) = delete;
+  ~TcpClient();
 
   void WriteAll(const std::string& str);
   void WriteAll(const char* buffer, std::size_t size);
+  // Writes every buffer to the socket, gathering as many as possible into
+  // each syscall (writev) instead of one send per buffer.
+  void WriteAllVectored(const std::vector<std::string>& buffers);
   void ReadExact(char* buffer, std::size_t size);
   Result ReadSome(char* buffer, std::size_t max_size);
   // Passing a timeout of 0 will block until data is available of the socket is
   // closed, the same behavior as the Read overload without a timeout.
   Result ReadSome(char* buffer, std::size_t max_size,
                   std::chrono::milliseconds timeout);
+  // Reads whatever data is immediately available without blocking,
+  // returning a `Timeout` status when there is none.
+  Result ReadSomeNonBlocking(char* buffer, std::size_t max_size);
   // Closes the socket.
   void Close();
+  // The underlying socket descriptor, e.g. for registering with an event
+  // loop. Remains owned by this client.
+  Socket SocketFd() const { return socket_.Get(); }
 
  private:
   static ScopedFd InitSocket(const std::string& gateway, std::uint16_t port,
-                             RetryConf retry_conf);
+                             RetryConf retry_conf, SocketConf socket_conf);
+  static ScopedFd InitSocket(const AddressList& addresses,
+                             RetryConf retry_conf, SocketConf socket_conf);
+  // Starts a non-blocking connect to every address and keeps whichever
+  // completes its handshake first.
+  static ScopedFd ConnectAny(const AddressList& addresses,
+                             const SocketConf& socket_conf);
+
+  void InitIoUring(const SocketConf& socket_conf);
 
   ScopedFd socket_;
+  // Set when SocketConf::io_uring is enabled; reads are delegated to it
+  std::unique_ptr<IoUringReceiver> uring_;
 };
 }  // namespace detail
 }  // namespace databento
@@ -0,0 +1,24 @@
+#pragma once
+
+// Compile-time-optional USDT (user statically defined tracing) probes under
+// the "databento" provider. When the library is built with the
+// DATABENTO_ENABLE_TRACEPOINTS CMake option, each macro expands to a static
+// tracepoint that perf and bpftrace can attach to in production; an
+// unattached probe costs a single nop. Without the option the macros expand
+// to nothing and their arguments aren't evaluated.
+//
+// List the available probes with `readelf -n` on the linked binary and
+// attach with e.g.
+//   bpftrace -e 'usdt:./a.out:databento:record_decoded { @ = count(); }'
+#ifdef DATABENTO_ENABLE_TRACEPOINTS
+#include <sys/sdt.h>
+
+#define DATABENTO_TRACEPOINT(name) DTRACE_PROBE(databento, name)
+#define DATABENTO_TRACEPOINT1(name, arg1) DTRACE_PROBE1(databento, name, arg1)
+#define DATABENTO_TRACEPOINT2(name, arg1, arg2) \
+  DTRACE_PROBE2(databento, name, arg1, arg2)
+#else
+#define DATABENTO_TRACEPOINT(name)
+#define DATABENTO_TRACEPOINT1(name, arg1)
+#define DATABENTO_TRACEPOINT2(name, arg1, arg2)
+#endif
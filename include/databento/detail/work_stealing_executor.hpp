@@ -0,0 +1,86 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>  // function
+#include <future>      // future, packaged_task
+#include <memory>      // make_shared, unique_ptr
+#include <mutex>
+#include <type_traits>  // result_of
+#include <utility>      // move
+#include <vector>
+
+#include "databento/detail/scoped_thread.hpp"
+
+namespace databento {
+namespace detail {
+// A fixed-size work-stealing thread pool for the library's parallel
+// subsystems. Each worker owns a bounded deque: it pushes and pops at the
+// back, while idle workers steal from the front of other deques, so tasks
+// submitted from within a task stay cache-warm on their worker until
+// another thread runs dry. Worker threads are spawned lazily on the first
+// submission, so an unused executor costs nothing. The destructor drains
+// any queued tasks before joining.
+class WorkStealingExecutor {
+ public:
+  // The process-wide executor shared by the library's parallel subsystems,
+  // sized to the hardware concurrency. Sharing one pool keeps an embedding
+  // process from oversubscribing cores with competing pools.
+  static WorkStealingExecutor& Shared();
+
+  explicit WorkStealingExecutor(std::size_t thread_count,
+                                std::size_t queue_capacity = 256);
+  WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+  WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+  ~WorkStealingExecutor();
+
+  std::size_t ThreadCount() const { return thread_count_; }
+
+  // Schedules `task` to run on a worker thread, returning a future for its
+  // result. Any exception the task throws is rethrown when the future's
+  // result is retrieved. Submissions from within a task go to the worker's
+  // own deque; when a deque is full, a worker runs the task inline while an
+  // external caller blocks for space, bounding queued memory either way.
+  template <typename F>
+  std::future<typename std::result_of<F()>::type> Submit(F task) {
+    using R = typename std::result_of<F()>::type;
+    // shared_ptr because packaged_task is move-only and std::function
+    // requires a copyable target
+    auto packaged =
+        std::make_shared<std::packaged_task<R()>>(std::move(task));
+    std::future<R> future = packaged->get_future();
+    this->SubmitTask([packaged]() { (*packaged)(); });
+    return future;
+  }
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  void SubmitTask(std::function<void()>&& task);
+  void WorkerLoop(std::size_t index);
+  // Pops a task from the back of the worker's own deque
+  bool PopOwn(std::size_t index, std::function<void()>* task);
+  // Steals a task from the front of another worker's deque
+  bool Steal(std::size_t index, std::function<void()>* task);
+  void SpawnThreadsLocked();
+
+  const std::size_t thread_count_;
+  const std::size_t queue_capacity_;
+  // unique_ptr so workers_ doesn't require Worker to be movable
+  std::vector<std::unique_ptr<Worker>> workers_;
+  // Guards thread spawning and idle/space waiting; the deques have their
+  // own mutexes
+  std::mutex mutex_;
+  std::condition_variable idle_cv_;
+  std::condition_variable space_cv_;
+  bool is_shutting_down_{false};
+  // Rotates external submissions across workers
+  std::size_t next_worker_{0};
+  std::vector<ScopedThread> threads_;
+};
+}  // namespace detail
+}  // namespace databento
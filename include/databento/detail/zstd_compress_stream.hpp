@@ -0,0 +1,58 @@
+#pragma once
+
+#include <zstd.h>
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <memory>   // unique_ptr
+#include <vector>
+
+#include "databento/iwritable.hpp"
+
+namespace databento {
+namespace detail {
+// A streaming zstd compressor in front of another IWritable. The zstd frame
+// is finished when the stream is destroyed.
+//
+// When constructed with a seekable frame size, the output is split into
+// independent frames of at most that many uncompressed bytes and a seek
+// table in the seekable-zstd skippable-frame format is appended on
+// destruction, making the file randomly accessible through
+// SeekableZstdStream.
+class ZstdCompressStream : public IWritable {
+ public:
+  explicit ZstdCompressStream(std::unique_ptr<IWritable> output);
+  ZstdCompressStream(int compression_level,
+                     std::unique_ptr<IWritable> output);
+  ZstdCompressStream(int compression_level, std::size_t seekable_frame_size,
+                     std::unique_ptr<IWritable> output);
+  ZstdCompressStream(const ZstdCompressStream&) = delete;
+  ZstdCompressStream& operator=(const ZstdCompressStream&) = delete;
+  ~ZstdCompressStream() override;
+
+  // Write exactly `length` bytes from `buffer`.
+  void WriteAll(const std::uint8_t* buffer, std::size_t length) override;
+
+ private:
+  struct FrameEntry {
+    std::uint32_t compressed_size;
+    std::uint32_t decompressed_size;
+  };
+
+  void Compress(ZSTD_inBuffer* z_in_buffer, ZSTD_EndDirective directive);
+  // Flushes and ends the current frame, recording its seek table entry
+  void EndFrame();
+  void WriteSeekTable();
+
+  std::unique_ptr<IWritable> output_;
+  std::unique_ptr<ZSTD_CStream, std::size_t (*)(ZSTD_CStream*)> z_cstream_;
+  std::vector<std::uint8_t> out_buffer_;
+  // 0 when not in seekable mode
+  const std::size_t seekable_frame_size_;
+  // Bytes in the current frame so far
+  std::size_t frame_compressed_{};
+  std::size_t frame_decompressed_{};
+  std::vector<FrameEntry> frame_entries_;
+};
+}  // namespace detail
+}  // namespace databento
@@ -11,11 +11,37 @@
 
 namespace databento {
 namespace detail {
+// A prebuilt zstd decompression dictionary. Building the dictionary is
+// relatively expensive, so one instance should be shared across all streams
+// decoding data compressed with the same dictionary. Safe to share between
+// threads: referencing the dictionary doesn't mutate it.
+class ZstdDecodeDict {
+ public:
+  ZstdDecodeDict(const std::uint8_t* dict_data, std::size_t size);
+
+  const ZSTD_DDict* Get() const { return ddict_.get(); }
+
+ private:
+  std::unique_ptr<ZSTD_DDict, std::size_t (*)(ZSTD_DDict*)> ddict_;
+};
+
 class ZstdStream : public IReadable {
  public:
   explicit ZstdStream(std::unique_ptr<IReadable> input);
   ZstdStream(std::unique_ptr<IReadable> input,
              std::vector<std::uint8_t>&& in_buffer);
+  // Decompresses with the given shared dictionary, which the stream keeps
+  // alive for its lifetime.
+  ZstdStream(std::unique_ptr<IReadable> input,
+             std::shared_ptr<const ZstdDecodeDict> dict);
+  // Returns the input buffer to the shared buffer pool for reuse.
+  ~ZstdStream() override;
+
+  // Returns a stream that runs zstd decompression on a background thread,
+  // staying a few staging buffers ahead of the consumer so decompression
+  // overlaps with whatever the consumer does between reads.
+  static std::unique_ptr<IReadable> CreatePipelined(
+      std::unique_ptr<IReadable> input);
 
   // Read exactly `length` bytes into `buffer`.
   void ReadExact(std::uint8_t* buffer, std::size_t length) override;
@@ -24,7 +50,18 @@ class ZstdStream : public IReadable {
   size_t ReadSome(std::uint8_t* buffer, std::size_t max_length) override;
 
  private:
+  ZstdStream(std::unique_ptr<IReadable> input,
+             std::vector<std::uint8_t>&& in_buffer,
+             std::shared_ptr<const ZstdDecodeDict> dict);
+
+  // (Re)initializes the decompression context for a new frame, referencing
+  // the dictionary if one was given. Returns zstd's read size suggestion.
+  std::size_t InitDStream();
+
   std::unique_ptr<IReadable> input_;
+  std::shared_ptr<const ZstdDecodeDict> dict_;
+  // Recycled through a process-wide pool to avoid paying context setup for
+  // every small file
   std::unique_ptr<ZSTD_DStream, std::size_t (*)(ZSTD_DStream*)> z_dstream_;
   std::size_t read_suggestion_;
   std::vector<std::uint8_t> in_buffer_;
@@ -274,6 +274,23 @@ enum class VersionUpgradePolicy : std::uint8_t {
   Upgrade = 1,
 };
 
+// The outcome of a non-throwing decode call. Descriptions from ToString are
+// preformatted static strings, so reporting an error never allocates.
+enum class DecodeStatus : std::uint8_t {
+  Ok = 0,
+  // The end of the input was reached cleanly.
+  EndOfInput,
+  // No complete record was available within the timeout (or immediately,
+  // for no-wait calls).
+  Timeout,
+  // The gateway closed the session.
+  SessionClosed,
+  // The input bytes couldn't be decoded.
+  MalformedInput,
+  // An unexpected failure in a lower layer, such as reading the input.
+  InternalError,
+};
+
 // Convert a HistoricalGateway to a URL.
 const char* UrlFromGateway(HistoricalGateway gateway);
 
@@ -297,6 +314,7 @@ const char* ToString(UserDefinedInstrument user_def_instr);
 const char* ToString(StatType stat_type);
 const char* ToString(StatUpdateAction stat_update_action);
 const char* ToString(VersionUpgradePolicy upgrade_policy);
+const char* ToString(DecodeStatus status);
 
 std::ostream& operator<<(std::ostream& out, Schema schema);
 std::ostream& operator<<(std::ostream& out, Encoding encoding);
@@ -321,6 +339,7 @@ std::ostream& operator<<(std::ostream& out,
                          StatUpdateAction stat_update_action);
 std::ostream& operator<<(std::ostream& out,
                          VersionUpgradePolicy upgrade_policy);
+std::ostream& operator<<(std::ostream& out, DecodeStatus status);
 
 template <>
 Schema FromString(const std::string& str);
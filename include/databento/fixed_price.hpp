@@ -1,7 +1,7 @@
 #pragma once
 
 #include <cstdint>
-#include <sstream>
+#include <ostream>
 #include <string>
 
 #include "databento/constants.hpp"
@@ -14,12 +14,22 @@ struct FixPx {
   std::int64_t val;
 };
 
+// The maximum number of characters PxToChars writes: enough for
+// "-9223372036.854775808" as well as "kUndefPrice".
+constexpr std::size_t kFixPxMaxStrLen = 21;
+
+// Formats a fixed-precision price into [first, last) in the style of
+// std::to_chars, without allocating or touching the locale. Returns a
+// pointer past the last character written, or nullptr if the buffer is too
+// small; kFixPxMaxStrLen characters always suffice. The output is not
+// null-terminated.
+char* PxToChars(std::int64_t px, char* first, char* last);
+
 std::ostream& operator<<(std::ostream& stream, FixPx fix_px);
 
 // Convert a fixed-precision price to a formatted string.
 inline std::string PxToString(std::int64_t px) {
-  std::ostringstream ss;
-  ss << FixPx{px};
-  return ss.str();
+  char buf[kFixPxMaxStrLen];
+  return std::string(buf, PxToChars(px, buf, buf + sizeof buf));
 }
 }  // namespace databento
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstring>  // memcpy, strcmp, strlen
+#include <ostream>
+#include <string>
+
+#include "databento/constants.hpp"  // kSymbolCstrLen
+
+namespace databento {
+// A fixed-capacity inline string holding at most Capacity - 1 characters and
+// a null terminator. Trivially copyable with no heap allocation, so
+// collections of symbols are flat contiguous arrays. Longer input is
+// truncated to fit. Implicitly converts to and from std::string for use
+// where a dynamic string is expected.
+template <std::size_t Capacity>
+class FixedString {
+  static_assert(Capacity > 0, "Capacity must be non-zero");
+
+ public:
+  FixedString() : data_{} {}
+  // Intentionally implicit
+  FixedString(const char* cstr) : FixedString{cstr, std::strlen(cstr)} {}
+  FixedString(const char* str, std::size_t length) : data_{} {
+    if (length >= Capacity) {
+      length = Capacity - 1;
+    }
+    std::memcpy(data_, str, length);
+  }
+  // Intentionally implicit
+  FixedString(const std::string& str) : FixedString{str.data(), str.size()} {}
+
+  const char* c_str() const { return data_; }
+  const char* data() const { return data_; }
+  std::size_t size() const { return std::strlen(data_); }
+  static constexpr std::size_t MaxSize() { return Capacity - 1; }
+  bool empty() const { return data_[0] == '\0'; }
+  operator std::string() const { return std::string{data_}; }
+
+ private:
+  char data_[Capacity];
+};
+
+template <std::size_t Capacity>
+bool operator==(const FixedString<Capacity>& lhs,
+                const FixedString<Capacity>& rhs) {
+  return std::strcmp(lhs.c_str(), rhs.c_str()) == 0;
+}
+template <std::size_t Capacity>
+bool operator==(const FixedString<Capacity>& lhs, const char* rhs) {
+  return std::strcmp(lhs.c_str(), rhs) == 0;
+}
+template <std::size_t Capacity>
+bool operator==(const char* lhs, const FixedString<Capacity>& rhs) {
+  return rhs == lhs;
+}
+template <std::size_t Capacity>
+bool operator==(const FixedString<Capacity>& lhs, const std::string& rhs) {
+  return lhs == rhs.c_str();
+}
+template <std::size_t Capacity>
+bool operator==(const std::string& lhs, const FixedString<Capacity>& rhs) {
+  return rhs == lhs.c_str();
+}
+template <std::size_t Capacity, typename T>
+bool operator!=(const FixedString<Capacity>& lhs, const T& rhs) {
+  return !(lhs == rhs);
+}
+template <std::size_t Capacity>
+bool operator!=(const char* lhs, const FixedString<Capacity>& rhs) {
+  return !(rhs == lhs);
+}
+template <std::size_t Capacity>
+bool operator!=(const std::string& lhs, const FixedString<Capacity>& rhs) {
+  return !(rhs == lhs);
+}
+template <std::size_t Capacity>
+bool operator<(const FixedString<Capacity>& lhs,
+               const FixedString<Capacity>& rhs) {
+  return std::strcmp(lhs.c_str(), rhs.c_str()) < 0;
+}
+template <std::size_t Capacity>
+std::ostream& operator<<(std::ostream& stream,
+                         const FixedString<Capacity>& str) {
+  return stream << str.c_str();
+}
+
+// The fixed-length symbol strings used in metadata and symbol mappings,
+// sized for the largest symbol_cstr_len.
+using SymbolString = FixedString<kSymbolCstrLen>;
+}  // namespace databento
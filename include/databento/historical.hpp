@@ -1,14 +1,23 @@
 #pragma once
 
+#include <cstddef>  // size_t
 #include <cstdint>
-#include <map>  // multimap
+#include <functional>  // bind
+#include <future>      // future
+#include <map>         // multimap
+#include <memory>      // unique_ptr
 #include <string>
+#include <utility>  // forward
 #include <vector>
 
 #include "databento/batch.hpp"     // BatchJob
 #include "databento/datetime.hpp"  // DateRange, DateTimeRange, UnixNanos
+#include "databento/dbn_decoder.hpp"  // DbnDecoder
 #include "databento/dbn_file_store.hpp"
+#include "databento/detail/buffer_channel.hpp"  // BufferChannel
 #include "databento/detail/http_client.hpp"  // HttpClient
+#include "databento/detail/request_thread_pool.hpp"  // RequestThreadPool
+#include "databento/detail/response_cache.hpp"  // ResponseCache
 #include "databento/enums.hpp"  // BatchState, Delivery, DurationInterval, Packaging, Schema, SType
 #include "databento/metadata.hpp"  // DatasetConditionDetail, DatasetRange, FieldDetail, PublisherDetail, UnitPricesForMode
 #include "databento/symbology.hpp"  // SymbologyResolution
@@ -33,6 +42,13 @@ class Historical {
   const std::string& Key() const { return key_; };
   const std::string& Gateway() const { return gateway_; }
 
+  // Enables the opt-in response cache: symbology resolutions and metadata
+  // listings are persisted in a compact binary format under `cache_dir`,
+  // keyed by request parameters and the current UTC date, so repeated
+  // requests on the same day are served from disk with a single sequential
+  // read instead of a network call. Pass an empty string to disable.
+  void SetCacheDir(std::string cache_dir);
+
   /*
    * Batch API
    */
@@ -65,19 +81,82 @@ class Historical {
                           std::uint64_t split_size, Packaging packaging,
                           Delivery delivery, SType stype_in, SType stype_out,
                           std::uint64_t limit);
+  // Overloads for a span of null-terminated symbols, e.g. handles from a
+  // SymbolInternPool, so callers with existing symbol storage submit a job
+  // without materializing a vector of strings.
+  BatchJob BatchSubmitJob(const std::string& dataset,
+                          const char* const* symbols,
+                          std::size_t symbol_count, Schema schema,
+                          const DateTimeRange<UnixNanos>& datetime_range);
+  BatchJob BatchSubmitJob(const std::string& dataset,
+                          const char* const* symbols,
+                          std::size_t symbol_count, Schema schema,
+                          const DateTimeRange<std::string>& datetime_range);
+  BatchJob BatchSubmitJob(const std::string& dataset,
+                          const char* const* symbols,
+                          std::size_t symbol_count, Schema schema,
+                          const DateTimeRange<UnixNanos>& datetime_range,
+                          Encoding encoding, Compression compression,
+                          bool pretty_px, bool pretty_ts, bool map_symbols,
+                          bool split_symbols, SplitDuration split_duration,
+                          std::uint64_t split_size, Packaging packaging,
+                          Delivery delivery, SType stype_in, SType stype_out,
+                          std::uint64_t limit);
+  BatchJob BatchSubmitJob(const std::string& dataset,
+                          const char* const* symbols,
+                          std::size_t symbol_count, Schema schema,
+                          const DateTimeRange<std::string>& datetime_range,
+                          Encoding encoding, Compression compression,
+                          bool pretty_px, bool pretty_ts, bool map_symbols,
+                          bool split_symbols, SplitDuration split_duration,
+                          std::uint64_t split_size, Packaging packaging,
+                          Delivery delivery, SType stype_in, SType stype_out,
+                          std::uint64_t limit);
   std::vector<BatchJob> BatchListJobs();
   std::vector<BatchJob> BatchListJobs(const std::vector<JobState>& states,
                                       UnixNanos since);
   std::vector<BatchJob> BatchListJobs(const std::vector<JobState>& states,
                                       const std::string& since);
   std::vector<BatchFileDesc> BatchListFiles(const std::string& job_id);
-  // Returns the paths of the downloaded files.
+  // Configuration for parallel batch downloads.
+  struct DownloadConf {
+    // The maximum number of concurrent HTTP connections
+    std::size_t connection_count{4};
+    // Files at least this large are split into HTTP range requests spread
+    // across the connection budget
+    std::uint64_t min_range_size{64UL * 1024 * 1024};
+  };
+  // Returns the paths of the downloaded files. Resumes any partially
+  // downloaded files and verifies each file against its listed hash while
+  // the bytes stream through.
   std::vector<std::string> BatchDownload(const std::string& output_dir,
                                          const std::string& job_id);
+  // Downloads files concurrently over up to connection_count connections,
+  // splitting large files into ranged requests. Each downloaded file is
+  // verified against its listed hash.
+  std::vector<std::string> BatchDownload(const std::string& output_dir,
+                                         const std::string& job_id,
+                                         DownloadConf download_conf);
   // Returns the path of the downloaded file.
   std::string BatchDownload(const std::string& output_dir,
                             const std::string& job_id,
                             const std::string& filename_to_download);
+  std::string BatchDownload(const std::string& output_dir,
+                            const std::string& job_id,
+                            const std::string& filename_to_download,
+                            DownloadConf download_conf);
+  // Streams each of the job's DBN files through a decoder concurrently with
+  // its download, invoking `metadata_callback` once per file and delivering
+  // records without waiting for the transfer to complete. Returning
+  // `KeepGoing::Stop` from `record_callback` skips any remaining files.
+  void BatchStream(const std::string& job_id,
+                   const MetadataCallback& metadata_callback,
+                   const RecordCallback& record_callback);
+  // As above, but also persists each file's raw bytes under
+  // `output_dir/job_id/` like `BatchDownload`.
+  void BatchStream(const std::string& output_dir, const std::string& job_id,
+                   const MetadataCallback& metadata_callback,
+                   const RecordCallback& record_callback);
 
   /*
    * Metadata API
@@ -149,6 +228,26 @@ class Historical {
                          const std::vector<std::string>& symbols, Schema schema,
                          FeedMode mode, SType stype_in, std::uint64_t limit);
 
+  /*
+   * Async API
+   */
+
+  // Schedules a call to `method` with `args` on a small request thread pool
+  // shared by this client, so independent requests overlap instead of
+  // running back-to-back, e.g.
+  //   auto publishers = client.Async(&Historical::MetadataListPublishers);
+  //   auto datasets = client.Async<std::vector<std::string>>(
+  //       &Historical::MetadataListDatasets);
+  // When a method is overloaded, specify the return type explicitly as
+  // above to select the overload. The returned future rethrows any
+  // exception the call throws.
+  template <typename R, typename... MethodArgs, typename... Args>
+  std::future<R> Async(R (Historical::*method)(MethodArgs...),
+                       Args&&... args) {
+    return request_pool_->Submit(
+        std::bind(method, this, std::forward<Args>(args)...));
+  }
+
   /*
    * Symbology API
    */
@@ -157,6 +256,14 @@ class Historical {
                                        const std::vector<std::string>& symbols,
                                        SType stype_in, SType stype_out,
                                        const DateRange& date_range);
+  // Overload for a span of null-terminated symbols, e.g. handles from a
+  // SymbolInternPool, so callers with existing symbol storage resolve
+  // without materializing a vector of strings.
+  SymbologyResolution SymbologyResolve(const std::string& dataset,
+                                       const char* const* symbols,
+                                       std::size_t symbol_count, SType stype_in,
+                                       SType stype_out,
+                                       const DateRange& date_range);
 
   /*
    * Timeseries API
@@ -164,7 +271,9 @@ class Historical {
 
   // Stream historical market data to `record_callback`. This method will
   // return only after all data has been returned or `record_callback` returns
-  // `KeepGoing::Stop`.
+  // `KeepGoing::Stop`, which aborts the HTTP transfer immediately rather
+  // than letting the rest of the response download, so sampling the head of
+  // a large range costs only the bytes actually consumed.
   //
   // NOTE: This method spawns a thread, however, the callbacks will be called
   // from the current thread.
@@ -197,6 +306,38 @@ class Historical {
                           std::uint64_t limit,
                           const MetadataCallback& metadata_callback,
                           const RecordCallback& record_callback);
+  // How a sharded request delivers records.
+  enum class ShardOrdering : std::uint8_t {
+    // Shards are delivered one after another in time order, preserving the
+    // `ts_event` ordering of a serial request.
+    Ordered = 0,
+    // Records are delivered as each shard decodes them, so shards
+    // interleave. One slow shard doesn't hold up the others.
+    Unordered,
+  };
+  // Splits the time range into `shard_count` disjoint sub-ranges streamed
+  // and decoded over concurrent connections, overlapping the network
+  // latency of a large request. `metadata_callback` will be called exactly
+  // once, with `end` restored to the full requested range.
+  //
+  // NOTE: This method spawns threads. With `ShardOrdering::Ordered` the
+  // callbacks are called from the current thread; with
+  // `ShardOrdering::Unordered` they're called from the decoding threads,
+  // serialized by a mutex.
+  void TimeseriesGetRangeParallel(
+      const std::string& dataset,
+      const DateTimeRange<UnixNanos>& datetime_range,
+      const std::vector<std::string>& symbols, Schema schema,
+      std::size_t shard_count, ShardOrdering ordering,
+      const MetadataCallback& metadata_callback,
+      const RecordCallback& record_callback);
+  void TimeseriesGetRangeParallel(
+      const std::string& dataset,
+      const DateTimeRange<UnixNanos>& datetime_range,
+      const std::vector<std::string>& symbols, Schema schema,
+      SType stype_in, SType stype_out, std::size_t shard_count,
+      ShardOrdering ordering, const MetadataCallback& metadata_callback,
+      const RecordCallback& record_callback);
   // Stream historical market data to a file at `path`. Returns a `DbnFileStore`
   // object for replaying the data in `file_path`.
   //
@@ -221,15 +362,49 @@ class Historical {
       const DateTimeRange<std::string>& datetime_range,
       const std::vector<std::string>& symbols, Schema schema, SType stype_in,
       SType stype_out, std::uint64_t limit, const std::string& file_path);
+  // Controls how `TimeseriesGetRangeToFile` writes the output file.
+  enum class FileWriteMode : std::uint8_t {
+    // Standard buffered writes through the OS page cache.
+    Buffered = 0,
+    // Preallocates ahead of the write position and advises the kernel to
+    // drop written pages from the page cache, so a large one-shot download
+    // doesn't evict hot data. Falls back to `Buffered` on platforms without
+    // the required support.
+    DropCache,
+  };
+  DbnFileStore TimeseriesGetRangeToFile(
+      const std::string& dataset,
+      const DateTimeRange<UnixNanos>& datetime_range,
+      const std::vector<std::string>& symbols, Schema schema, SType stype_in,
+      SType stype_out, std::uint64_t limit, const std::string& file_path,
+      FileWriteMode write_mode);
+  DbnFileStore TimeseriesGetRangeToFile(
+      const std::string& dataset,
+      const DateTimeRange<std::string>& datetime_range,
+      const std::vector<std::string>& symbols, Schema schema, SType stype_in,
+      SType stype_out, std::uint64_t limit, const std::string& file_path,
+      FileWriteMode write_mode);
 
  private:
+  friend class TimeseriesSession;
+
   using HttplibParams = std::multimap<std::string, std::string>;
 
   BatchJob BatchSubmitJob(const HttplibParams& params);
   void StreamToFile(const std::string& url_path, const HttplibParams& params,
-                    const std::string& file_path);
-  void DownloadFile(const std::string& url, const std::string& output_path);
+                    const std::string& file_path, FileWriteMode write_mode);
+  void DownloadFileResumable(const BatchFileDesc& file_desc,
+                             const std::string& output_path);
+  void DownloadFilesParallel(const std::vector<BatchFileDesc>& file_descs,
+                             const std::vector<std::string>& output_paths,
+                             DownloadConf download_conf);
+  // Returns the expected hex digest, or an empty string if the file's hash
+  // is missing or uses an unknown algorithm.
+  std::string ExpectedSha256(const BatchFileDesc& file_desc);
+  void VerifyFileHash(const BatchFileDesc& file_desc,
+                      const std::string& output_path);
   std::vector<BatchJob> BatchListJobs(const HttplibParams& params);
+  SymbologyResolution SymbologyResolve(const HttplibParams& params);
   std::vector<DatasetConditionDetail> MetadataGetDatasetCondition(
       const HttplibParams& params);
   std::uint64_t MetadataGetRecordCount(const HttplibParams& params);
@@ -238,13 +413,69 @@ class Historical {
   void TimeseriesGetRange(const HttplibParams& params,
                           const MetadataCallback& metadata_callback,
                           const RecordCallback& record_callback);
+  // Streams and decodes one request through the given channel and decoder,
+  // initializing `*decoder` on first use and resetting it thereafter so its
+  // buffers are reused across requests.
+  void TimeseriesGetRange(const HttplibParams& params,
+                          detail::BufferChannel channel,
+                          std::unique_ptr<DbnDecoder>* decoder,
+                          const MetadataCallback& metadata_callback,
+                          const RecordCallback& record_callback);
   DbnFileStore TimeseriesGetRangeToFile(const HttplibParams& params,
-                                        const std::string& file_path);
+                                        const std::string& file_path,
+                                        FileWriteMode write_mode);
 
   ILogReceiver* log_receiver_;
   const std::string key_;
   const std::string gateway_;
   detail::HttpClient client_;
+  // Behind a `unique_ptr` so `Historical` remains movable.
+  std::unique_ptr<detail::RequestThreadPool> request_pool_;
+  std::unique_ptr<detail::ResponseCache> response_cache_;
+};
+
+// Reuses one decode channel and one decoder's buffers (as well as the
+// client's persistent HTTP connection) across successive ranged requests, so
+// workloads issuing many small requests pay the setup allocations once
+// instead of per request. Requests run one at a time; a session is not
+// thread-safe. The referenced Historical client must outlive the session.
+class TimeseriesSession {
+ public:
+  explicit TimeseriesSession(Historical* client) : client_{client} {}
+
+  // Stream historical market data to `record_callback`, like
+  // `Historical::TimeseriesGetRange`.
+  void GetRange(const std::string& dataset,
+                const DateTimeRange<UnixNanos>& datetime_range,
+                const std::vector<std::string>& symbols, Schema schema,
+                const RecordCallback& record_callback);
+  void GetRange(const std::string& dataset,
+                const DateTimeRange<std::string>& datetime_range,
+                const std::vector<std::string>& symbols, Schema schema,
+                const RecordCallback& record_callback);
+  void GetRange(const std::string& dataset,
+                const DateTimeRange<UnixNanos>& datetime_range,
+                const std::vector<std::string>& symbols, Schema schema,
+                SType stype_in, SType stype_out, std::uint64_t limit,
+                const MetadataCallback& metadata_callback,
+                const RecordCallback& record_callback);
+  void GetRange(const std::string& dataset,
+                const DateTimeRange<std::string>& datetime_range,
+                const std::vector<std::string>& symbols, Schema schema,
+                SType stype_in, SType stype_out, std::uint64_t limit,
+                const MetadataCallback& metadata_callback,
+                const RecordCallback& record_callback);
+
+ private:
+  void GetRange(const std::multimap<std::string, std::string>& params,
+                const MetadataCallback& metadata_callback,
+                const RecordCallback& record_callback);
+
+  Historical* client_;
+  detail::BufferChannel channel_;
+  // Initialized on the first request; reset (retaining buffer capacity) on
+  // subsequent ones
+  std::unique_ptr<DbnDecoder> decoder_;
 };
 
 // A helper class for constructing an instance of Historical.
@@ -259,6 +490,9 @@ class HistoricalBuilder {
   HistoricalBuilder& SetKeyFromEnv();
   HistoricalBuilder& SetKey(std::string key);
   HistoricalBuilder& SetGateway(HistoricalGateway gateway);
+  // Enables the response cache under `cache_dir`. See
+  // `Historical::SetCacheDir`.
+  HistoricalBuilder& SetCacheDir(std::string cache_dir);
   // Sets the receiver of the logs to be used by the client.
   HistoricalBuilder& SetLogReceiver(ILogReceiver* log_receiver);
   // Attempts to construct an instance of Historical or throws an exception if
@@ -269,5 +503,6 @@ class HistoricalBuilder {
   ILogReceiver* log_receiver_{};
   std::string key_;
   HistoricalGateway gateway_{HistoricalGateway::Bo1};
+  std::string cache_dir_;
 };
 }  // namespace databento
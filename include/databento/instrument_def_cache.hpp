@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <vector>
+
+#include "databento/record.hpp"  // InstrumentDefMsg, Record
+
+namespace databento {
+// A single-writer cache of the latest instrument definition per instrument
+// ID, so the definition stream only has to be decoded and stored once per
+// process. Definitions live in a flat slab sized once at construction: like
+// DensePitSymbolMap, IDs near the first-seen ID are direct-indexed, and
+// outliers fall back to an open-addressing region of the same slab. The
+// writer updates slots in place; reader threads query concurrently without
+// locks by copying a slot out under its sequence stamp.
+class InstrumentDefCache {
+ public:
+  // `dense_capacity` is the width of the direct-indexed ID window and
+  // `sparse_capacity` the number of outlier slots, rounded up to a power of
+  // two. Neither region grows: size them for the subscribed universe.
+  explicit InstrumentDefCache(std::size_t dense_capacity = 1 << 16,
+                              std::size_t sparse_capacity = 1024);
+  // Not copyable or movable: readers hold a reference to the cache
+  InstrumentDefCache(const InstrumentDefCache&) = delete;
+  InstrumentDefCache& operator=(const InstrumentDefCache&) = delete;
+
+  // The number of distinct instrument IDs cached.
+  std::size_t Size() const { return size_.load(std::memory_order_relaxed); }
+
+  // Updates the cache from an instrument definition record; other record
+  // types are ignored. May only be called from the writer thread.
+  void OnRecord(const Record& record);
+  // Inserts or updates the definition for `def.hd.instrument_id` in place.
+  // May only be called from the writer thread. Throws Exception when the
+  // outlier region is full.
+  void Insert(const InstrumentDefMsg& def);
+  // Copies the latest definition for `instrument_id` into `def`, returning
+  // false when the cache holds none. Safe to call from any thread
+  // concurrently with the writer.
+  bool Find(std::uint32_t instrument_id, InstrumentDefMsg* def) const;
+
+ private:
+  struct Slot {
+    // instrument_id + 1 of the occupant, 0 while the slot is empty
+    std::atomic<std::uint32_t> key{0};
+    // Seqlock stamp: odd while the definition is being written
+    std::atomic<std::uint32_t> version{0};
+    InstrumentDefMsg def;
+  };
+
+  Slot* FindSlot(std::uint32_t instrument_id);
+  const Slot* FindSlotForRead(std::uint32_t instrument_id) const;
+  void StoreDef(Slot* slot, const InstrumentDefMsg& def);
+  static bool LoadDef(const Slot& slot, std::uint32_t instrument_id,
+                      InstrumentDefMsg* def);
+
+  // The dense window occupies the first dense_capacity_ slots; the
+  // remaining power-of-two slots are the open-addressing outlier region
+  std::vector<Slot> slab_;
+  std::size_t dense_capacity_;
+  std::size_t sparse_mask_;
+  // The base ID of the dense window, fixed by the first definition.
+  // -1 until then; readers miss while it's unset.
+  std::atomic<std::int64_t> base_{-1};
+  std::atomic<std::size_t> size_{0};
+};
+}  // namespace databento
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <vector>
+
+#include "databento/datetime.hpp"  // UnixNanos
+#include "databento/enums.hpp"     // StatType
+#include "databento/record.hpp"    // ImbalanceMsg, Record, StatMsg
+
+namespace databento {
+// A single-writer cache of the latest point-in-time state per instrument ID:
+// the most recent value of each statistic by `stat_type` and the most recent
+// imbalance record. It mirrors the InstrumentDefCache design: state lives in
+// a flat slab sized once at construction, IDs near the first-seen ID are
+// direct-indexed, and outliers fall back to an open-addressing region of the
+// same slab. The writer updates slots in place; reader threads query
+// concurrently without locks by copying state out under a sequence stamp.
+class InstrumentStateCache {
+ public:
+  // The compact latest value of one statistic.
+  struct StatValue {
+    std::int64_t price{};
+    std::int32_t quantity{};
+    // When the statistic was received; zero while the statistic is unset
+    UnixNanos ts_recv{};
+    // The reference timestamp of the statistic, e.g. the trading date of a
+    // settlement price
+    UnixNanos ts_ref{};
+  };
+
+  // `dense_capacity` is the width of the direct-indexed ID window and
+  // `sparse_capacity` the number of outlier slots, rounded up to a power of
+  // two. Neither region grows: size them for the subscribed universe.
+  explicit InstrumentStateCache(std::size_t dense_capacity = 1 << 14,
+                                std::size_t sparse_capacity = 1024);
+  // Not copyable or movable: readers hold a reference to the cache
+  InstrumentStateCache(const InstrumentStateCache&) = delete;
+  InstrumentStateCache& operator=(const InstrumentStateCache&) = delete;
+
+  // The number of distinct instrument IDs cached.
+  std::size_t Size() const { return size_.load(std::memory_order_relaxed); }
+
+  // Updates the cache from a statistics or imbalance record; other record
+  // types are ignored. May only be called from the writer thread.
+  void OnRecord(const Record& record);
+  // Inserts or updates the statistic for `stat.hd.instrument_id` in place.
+  // A `Delete` update action clears the statistic; unknown future stat types
+  // are ignored. May only be called from the writer thread. Throws Exception
+  // when the outlier region is full.
+  void Insert(const StatMsg& stat);
+  // Inserts or updates the imbalance for `imbalance.hd.instrument_id` in
+  // place. May only be called from the writer thread. Throws Exception when
+  // the outlier region is full.
+  void Insert(const ImbalanceMsg& imbalance);
+  // Copies the latest value of `stat_type` for `instrument_id` into `value`,
+  // returning false when the cache holds none. Safe to call from any thread
+  // concurrently with the writer.
+  bool FindStat(std::uint32_t instrument_id, StatType stat_type,
+                StatValue* value) const;
+  // Copies the latest imbalance for `instrument_id` into `imbalance`,
+  // returning false when the cache holds none. Safe to call from any thread
+  // concurrently with the writer.
+  bool FindImbalance(std::uint32_t instrument_id,
+                     ImbalanceMsg* imbalance) const;
+
+ private:
+  // One entry per StatType value, indexed by stat_type
+  static constexpr std::size_t kNumStatTypes =
+      static_cast<std::size_t>(StatType::Vwap) + 1;
+
+  struct Slot {
+    // instrument_id + 1 of the occupant, 0 while the slot is empty
+    std::atomic<std::uint32_t> key{0};
+    // Seqlock stamp: odd while the state is being written
+    std::atomic<std::uint32_t> version{0};
+    std::array<StatValue, kNumStatTypes> stats{};
+    // The latest imbalance; unset while its ts_recv is zero
+    ImbalanceMsg imbalance{};
+  };
+
+  Slot* ClaimSlot(std::uint32_t instrument_id);
+  Slot* FindSlot(std::uint32_t instrument_id);
+  const Slot* FindSlotForRead(std::uint32_t instrument_id) const;
+
+  // The dense window occupies the first dense_capacity_ slots; the
+  // remaining power-of-two slots are the open-addressing outlier region
+  std::vector<Slot> slab_;
+  std::size_t dense_capacity_;
+  std::size_t sparse_mask_;
+  // The base ID of the dense window, fixed by the first record.
+  // -1 until then; readers miss while it's unset.
+  std::atomic<std::int64_t> base_{-1};
+  std::atomic<std::size_t> size_{0};
+};
+}  // namespace databento
@@ -16,5 +16,10 @@ class IReadable {
   // return 0 if the end of the stream is reached.
   virtual std::size_t ReadSome(std::uint8_t* buffer,
                                std::size_t max_length) = 0;
+  // Whether the stream supports repositioning via Seek.
+  virtual bool CanSeek() const { return false; }
+  // Repositions the stream so the next read begins `offset` bytes from the
+  // beginning. The default implementation throws InvalidArgumentError.
+  virtual void Seek(std::size_t offset);
 };
 }  // namespace databento
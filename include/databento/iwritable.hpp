@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+
+namespace databento {
+// An abstract class for writable objects to allow for runtime polymorphism
+// around DBN encoding.
+class IWritable {
+ public:
+  virtual ~IWritable() = default;
+
+  // Write exactly `length` bytes from `buffer`.
+  virtual void WriteAll(const std::uint8_t* buffer, std::size_t length) = 0;
+};
+}  // namespace databento
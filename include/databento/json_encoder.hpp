@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <vector>
+
+#include "databento/datetime.hpp"  // UnixNanos
+#include "databento/iwritable.hpp"
+#include "databento/record.hpp"  // MboMsg, Mbp1Msg, Mbp10Msg, OhlcvMsg,
+                                 // Record, TradeMsg
+
+namespace databento {
+// Newline-delimited JSON record serializer, sharing the buffered design of
+// CsvEncoder: each record becomes one JSON object on its own line, formatted
+// with integer and fixed-price formatters and flushed to the output in
+// buffer-sized batches. 64-bit integer fields are written as JSON strings so
+// consumers limited to double precision don't lose bits.
+class JsonEncoder {
+ public:
+  static constexpr std::size_t kDefaultBufferSize = 64 * 1024;
+
+  // If pretty_px, prices are written as decimal strings, otherwise as raw
+  // fixed-precision integers. If pretty_ts, timestamps are written as
+  // ISO 8601 strings, otherwise as nanoseconds since the UNIX epoch.
+  JsonEncoder(IWritable* output, bool pretty_px, bool pretty_ts);
+  JsonEncoder(IWritable* output, bool pretty_px, bool pretty_ts,
+              std::size_t buffer_size);
+  // Not copyable or movable: the buffer is flushed on destruction
+  JsonEncoder(const JsonEncoder&) = delete;
+  JsonEncoder& operator=(const JsonEncoder&) = delete;
+  ~JsonEncoder();
+
+  // Serializes one record, dispatching on its rtype. Throws
+  // InvalidArgumentError for records without JSON support.
+  void EncodeRecord(const Record& record);
+  void EncodeRecord(const MboMsg& record);
+  void EncodeRecord(const TradeMsg& record);
+  void EncodeRecord(const Mbp1Msg& record);
+  void EncodeRecord(const Mbp10Msg& record);
+  void EncodeRecord(const OhlcvMsg& record);
+  // Writes all buffered records to the output.
+  void Flush();
+
+ private:
+  // Returns a write position with room for at least one record of any schema
+  char* RowStart();
+  void FinishRow(char* pos);
+  char* WriteHd(char* pos, const RecordHeader& hd) const;
+  char* WritePx(char* pos, std::int64_t px) const;
+  char* WriteTs(char* pos, UnixNanos ts) const;
+  template <std::size_t N>
+  void EncodeMbp(const detail::MbpMsg<N>& record);
+
+  IWritable* output_;
+  const bool pretty_px_;
+  const bool pretty_ts_;
+  std::vector<char> buffer_;
+  std::size_t length_{0};
+};
+}  // namespace databento
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>  // size_t
+#include <cstdint>
+
+namespace databento {
+// A fixed-memory, allocation-free histogram of nanosecond durations with
+// logarithmic buckets subdivided linearly, giving a worst-case relative
+// error of about 3% across the full 64-bit range. Recording is a couple of
+// relaxed atomic operations, cheap enough for per-record instrumentation.
+// Records and reads may come from different threads: reads don't stop
+// writers, so a snapshot taken while recording may be off by in-flight
+// updates.
+class LatencyHistogram {
+ public:
+  // The number of values recorded.
+  std::uint64_t Count() const;
+  // The largest value recorded, tracked exactly.
+  std::uint64_t Max() const { return max_.load(std::memory_order_relaxed); }
+  // Returns the approximate value at `percentile`, which should be in
+  // [0, 100], e.g. 99.9. Returns 0 if nothing has been recorded.
+  std::uint64_t ValueAtPercentile(double percentile) const;
+
+  void Record(std::uint64_t value) {
+    counts_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    auto prev_max = max_.load(std::memory_order_relaxed);
+    while (value > prev_max &&
+           !max_.compare_exchange_weak(prev_max, value,
+                                       std::memory_order_relaxed)) {
+    }
+  }
+
+ private:
+  // Each power of two is split into 2^kSubBucketHalfBits linear sub-buckets
+  static constexpr std::uint32_t kSubBucketHalfBits = 5;
+  static constexpr std::size_t kSubBucketHalfCount = 1
+                                                     << kSubBucketHalfBits;
+  // The largest shift is 63 - kSubBucketHalfBits, and each shift spans
+  // kSubBucketHalfCount indexes except the first, which spans twice that
+  static constexpr std::size_t kBucketCount =
+      (64 - kSubBucketHalfBits + 1) * kSubBucketHalfCount;
+
+  static std::uint32_t MostSignificantBit(std::uint64_t value) {
+    std::uint32_t msb = 0;
+    if (value >> 32) {
+      msb += 32;
+      value >>= 32;
+    }
+    if (value >> 16) {
+      msb += 16;
+      value >>= 16;
+    }
+    if (value >> 8) {
+      msb += 8;
+      value >>= 8;
+    }
+    if (value >> 4) {
+      msb += 4;
+      value >>= 4;
+    }
+    if (value >> 2) {
+      msb += 2;
+      value >>= 2;
+    }
+    if (value >> 1) {
+      msb += 1;
+    }
+    return msb;
+  }
+
+  static std::size_t BucketIndex(std::uint64_t value) {
+    const auto msb = MostSignificantBit(value | 1);
+    const auto shift = msb < kSubBucketHalfBits ? 0 : msb - kSubBucketHalfBits;
+    return shift * kSubBucketHalfCount + (value >> shift);
+  }
+
+  // The smallest value mapping to the bucket at `index`
+  static std::uint64_t BucketLowerBound(std::size_t index) {
+    if (index < 2 * kSubBucketHalfCount) {
+      return index;
+    }
+    const auto shift = index / kSubBucketHalfCount - 1;
+    return (index - shift * kSubBucketHalfCount) << shift;
+  }
+
+  std::array<std::atomic<std::uint64_t>, kBucketCount> counts_{};
+  std::atomic<std::uint64_t> max_{0};
+};
+}  // namespace databento
@@ -30,6 +30,12 @@ class LiveBuilder {
   LiveBuilder& SetUpgradePolicy(VersionUpgradePolicy upgrade_policy);
   // Sets the receiver of the logs to be used by the client.
   LiveBuilder& SetLogReceiver(ILogReceiver* log_receiver);
+  // Overrides the default options on the gateway socket, e.g. to grow the
+  // receive buffer or enable busy-polling.
+  LiveBuilder& SetSocketConf(detail::TcpClient::SocketConf socket_conf);
+  // Configures the CPU affinity, scheduling, and name of the record
+  // processing thread. Only used by `BuildThreaded`.
+  LiveBuilder& SetThreadConf(LiveThreaded::ThreadConf thread_conf);
   // Attempts to construct an instance of a blocking live client or throws an
   // exception.
   LiveBlocking BuildBlocking();
@@ -45,5 +51,7 @@ class LiveBuilder {
   std::string dataset_;
   bool send_ts_out_{false};
   VersionUpgradePolicy upgrade_policy_{VersionUpgradePolicy::Upgrade};
+  detail::TcpClient::SocketConf socket_conf_{};
+  LiveThreaded::ThreadConf thread_conf_{};
 };
 }  // namespace databento
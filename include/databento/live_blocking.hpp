@@ -1,21 +1,35 @@
 #pragma once
 
 #include <array>
-#include <chrono>  // milliseconds
+#include <atomic>
+#include <chrono>  // milliseconds, nanoseconds
+#include <cstddef>  // size_t
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
-#include "databento/datetime.hpp"           // UnixNanos
-#include "databento/dbn.hpp"                // Metadata
-#include "databento/detail/tcp_client.hpp"  // TcpClient
+#include "databento/datetime.hpp"               // UnixNanos
+#include "databento/dbn.hpp"                    // Metadata
+#include "databento/detail/journal_writer.hpp"  // JournalWriter
+#include "databento/detail/tcp_client.hpp"      // TcpClient
 #include "databento/enums.hpp"   // Schema, SType, VersionUpgradePolicy
 #include "databento/record.hpp"  // Record, RecordHeader
+#include "databento/stats.hpp"   // ClientStats, StatsCounters
 
 namespace databento {
 class ILogReceiver;
 
+// A single subscription for the bulk `Subscribe` overload.
+struct SubscriptionRequest {
+  std::vector<std::string> symbols;
+  Schema schema;
+  SType stype_in;
+  // Optionally request an intraday replay from this timestamp. The default
+  // of zero subscribes from the current time.
+  UnixNanos start{};
+};
+
 // A client for interfacing with Databento's real-time and intraday replay
 // market data API. This client provides a blocking API for getting the next
 // record. Unlike Historical, each instance of LiveBlocking is associated with a
@@ -24,9 +38,27 @@ class LiveBlocking {
  public:
   LiveBlocking(ILogReceiver* log_receiver, std::string key, std::string dataset,
                bool send_ts_out, VersionUpgradePolicy upgrade_policy);
+  LiveBlocking(ILogReceiver* log_receiver, std::string key, std::string dataset,
+               bool send_ts_out, VersionUpgradePolicy upgrade_policy,
+               detail::TcpClient::SocketConf socket_conf);
   LiveBlocking(ILogReceiver* log_receiver, std::string key, std::string dataset,
                std::string gateway, std::uint16_t port, bool send_ts_out,
                VersionUpgradePolicy upgrade_policy);
+  LiveBlocking(ILogReceiver* log_receiver, std::string key, std::string dataset,
+               std::string gateway, std::uint16_t port, bool send_ts_out,
+               VersionUpgradePolicy upgrade_policy,
+               detail::TcpClient::SocketConf socket_conf);
+  // Moving only happens before the session is running (e.g. returning a
+  // client from LiveBuilder or adding one to a LiveSessionGroup), so the
+  // liveness clock is transferred with relaxed loads. User-declared because
+  // the atomic clock member isn't movable and would otherwise delete the
+  // move operations.
+  LiveBlocking(LiveBlocking&& other) noexcept;
+  LiveBlocking& operator=(LiveBlocking&& other) noexcept;
+  LiveBlocking(const LiveBlocking&) = delete;
+  LiveBlocking& operator=(const LiveBlocking&) = delete;
+  ~LiveBlocking() = default;
+
   /*
    * Getters
    */
@@ -51,6 +83,19 @@ class LiveBlocking {
                  SType stype_in, UnixNanos start);
   void Subscribe(const std::vector<std::string>& symbols, Schema schema,
                  SType stype_in, const std::string& start);
+  // Overloads for a span of null-terminated symbols, e.g. handles from a
+  // SymbolInternPool, so callers with existing symbol storage subscribe
+  // without materializing a vector of strings.
+  void Subscribe(const char* const* symbols, std::size_t symbol_count,
+                 Schema schema, SType stype_in);
+  void Subscribe(const char* const* symbols, std::size_t symbol_count,
+                 Schema schema, SType stype_in, UnixNanos start);
+  void Subscribe(const char* const* symbols, std::size_t symbol_count,
+                 Schema schema, SType stype_in, const std::string& start);
+  // Add several subscriptions at once. All subscription requests are
+  // serialized up front and written with as few syscalls as possible, which
+  // is significantly faster for very large symbol lists.
+  void Subscribe(const std::vector<SubscriptionRequest>& requests);
   // Notifies the gateway to start sending messages for all subscriptions.
   //
   // This method should only be called once per instance.
@@ -66,21 +111,109 @@ class LiveBlocking {
   //
   // This method should only be called after `Start`.
   const Record* NextRecord(std::chrono::milliseconds timeout);
+  // Like `NextRecord` with a timeout, but spins on a non-blocking read for
+  // `spin_for` before falling back to the blocking wait, trading CPU for
+  // lower wakeup latency.
+  //
+  // This method should only be called after `Start`.
+  const Record* NextRecord(std::chrono::milliseconds timeout,
+                           std::chrono::microseconds spin_for);
+  // Returns the next record without waiting: a buffered record costs no
+  // syscall and otherwise at most one non-blocking read is attempted.
+  // Returns `nullptr` when no complete record is available, making it
+  // suitable for polling from a single-threaded event loop.
+  //
+  // This method should only be called after `Start`.
+  const Record* NextRecordNoWait();
+  // Non-throwing variant of `NextRecord` with a timeout: stores the next
+  // record in `*record` and returns DecodeStatus::Ok, or stores nullptr
+  // and returns DecodeStatus::Timeout, DecodeStatus::SessionClosed, or
+  // DecodeStatus::InternalError. The error path never unwinds through the
+  // caller nor formats a message (see ToString for the preformatted
+  // descriptions); the throwing overloads are wrappers around this method.
+  //
+  // This method should only be called after `Start`.
+  DecodeStatus TryNextRecord(const Record** record,
+                             std::chrono::milliseconds timeout) noexcept;
+  // Non-throwing variant of `NextRecordNoWait`, returning
+  // DecodeStatus::Timeout when no complete record is available.
+  //
+  // This method should only be called after `Start`.
+  DecodeStatus TryNextRecordNoWait(const Record** record) noexcept;
+  // Block on getting the next batch of records: every complete record
+  // decoded from one socket read. Returns an empty batch if the `timeout`
+  // is reached. The returned records are valid until the next call to
+  // `NextRecord` or `NextRecordBatch`.
+  //
+  // This method should only be called after `Start`.
+  const std::vector<Record>& NextRecordBatch(std::chrono::milliseconds timeout);
+  // Tees the raw bytes of every gateway read into a memory-mapped,
+  // size-rotated journal on a background thread, before any decoding.
+  // Replaying the journal through `DbnDecoder` reproduces the session
+  // byte-for-byte.
+  //
+  // This method should only be called before `Start`.
+  void EnableJournal(detail::JournalWriter::Conf conf);
   // Stops the session with the gateway. Once stopped, the session cannot be
   // restarted.
   void Stop();
   // Closes the current connection and attempts to reconnect to the gateway.
   void Reconnect();
+  // Returns a snapshot of the session's activity counters. Cheap enough to
+  // poll and safe to call from another thread.
+  ClientStats Stats() const { return stats_.Snapshot(); }
+  // When enabled, heartbeat SystemMsg records are consumed internally and
+  // never returned from the `NextRecord` methods, so consumers don't have
+  // to branch on RType::System. Their arrival still refreshes the liveness
+  // clock. Note `NextRecordBatch` may then return an empty batch for a read
+  // that contained only heartbeats.
+  void SuppressHeartbeats(bool suppress) { suppress_heartbeats_ = suppress; }
+  // The time elapsed since the session last showed signs of life. The
+  // gateway only sends heartbeats while a session is idle, so any record
+  // refreshes the clock, not just heartbeats. Safe to call from another
+  // thread.
+  std::chrono::nanoseconds SinceLastHeartbeat() const;
+  // Whether the session has gone longer than `threshold` without a
+  // heartbeat or record. Always false before `Start`. Safe to call from
+  // another thread.
+  bool IsSessionStale(std::chrono::milliseconds threshold) const;
+  // The number of bytes read from the gateway but not yet returned as
+  // records: an approximation of how far the consumer has fallen behind.
+  //
+  // This method should only be called from the thread calling the
+  // `NextRecord` methods.
+  std::size_t BufferedBytes() const { return buffer_size_ - buffer_idx_; }
 
  private:
+  // Waits on the gateway sockets of several sessions at once
+  friend class LiveSessionGroup;
+
+  // Serializes a subscription into one or more request messages, chunking
+  // oversized symbol lists. `start` is the formatted start field, empty to
+  // omit it.
+  static void AppendSubRequests(std::vector<std::string>* requests,
+                                const std::vector<std::string>& symbols,
+                                Schema schema, SType stype_in,
+                                const std::string& start);
+  static void AppendSubRequests(std::vector<std::string>* requests,
+                                const char* const* symbols,
+                                std::size_t symbol_count, Schema schema,
+                                SType stype_in, const std::string& start);
+
   std::string DetermineGateway() const;
+  detail::Socket SocketFd() const { return client_.SocketFd(); }
   std::uint64_t Authenticate();
   std::string DecodeChallenge();
   std::string GenerateCramReply(const std::string& challenge_key);
   std::string EncodeAuthReq(const std::string& auth);
   std::uint64_t DecodeAuthResp();
   detail::TcpClient::Result FillBuffer(std::chrono::milliseconds timeout);
+  detail::TcpClient::Result FillBufferNoWait();
   RecordHeader* BufferRecordHeader();
+  // Stamps the liveness clock with the current time
+  void TouchLiveness();
+  // Returns true when `record` is a heartbeat system message
+  static bool IsHeartbeat(const Record& record);
 
   static constexpr std::size_t kMaxStrLen = 24L * 1024;
 
@@ -92,6 +225,11 @@ class LiveBlocking {
   bool send_ts_out_;
   std::uint8_t version_{};
   VersionUpgradePolicy upgrade_policy_;
+  // Socket options applied on each (re)connection
+  detail::TcpClient::SocketConf socket_conf_;
+  // Resolved on the initial connection so reconnecting doesn't depend on
+  // DNS; refreshed only if every cached address fails
+  detail::TcpClient::AddressList gateway_addresses_;
   detail::TcpClient client_;
   // Must be 8-byte aligned for records
   alignas(RecordHeader) std::array<char, kMaxStrLen> read_buffer_{};
@@ -102,5 +240,16 @@ class LiveBlocking {
       RecordHeader) std::array<std::uint8_t, kMaxRecordLen> compat_buffer_{};
   std::uint64_t session_id_;
   Record current_record_{nullptr};
+  std::vector<Record> record_batch_;
+  // Arena for record upgrades in `NextRecordBatch`, which can't share
+  // `compat_buffer_`
+  std::vector<std::uint8_t> batch_compat_buffer_;
+  // Set when journaling is enabled via `EnableJournal`
+  std::unique_ptr<detail::JournalWriter> journal_;
+  detail::StatsCounters stats_;
+  // Steady-clock nanoseconds of the last record or heartbeat, 0 before
+  // `Start`
+  std::atomic<std::int64_t> last_heartbeat_ns_{0};
+  bool suppress_heartbeats_{false};
 };
 }  // namespace databento
@@ -0,0 +1,92 @@
+#pragma once
+
+// Coroutine-native wrapper around LiveBlocking. The library itself targets
+// C++11, so this header is only active when the consuming translation unit
+// is compiled with C++20 coroutine support; it's empty otherwise.
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+
+#include <coroutine>
+#include <exception>   // exception_ptr
+#include <functional>  // function
+#include <utility>     // move
+
+#include "databento/live_blocking.hpp"
+#include "databento/record.hpp"  // Record
+
+namespace databento {
+// Schedules a unit of work, used to run the blocking read that backs a
+// suspended awaiter. The default executor invokes the work inline on the
+// awaiting thread; an event-loop integration can instead post it to a
+// worker so the loop never blocks.
+using CoroExecutor = std::function<void(std::function<void()>)>;
+
+// An awaitable record source over a LiveBlocking session, for use from
+// C++20 coroutines:
+//
+//   while (const Record* record = co_await session.NextRecord()) { ... }
+//
+// A record already buffered by the client is returned without suspending
+// the coroutine, so draining a burst costs no executor round trips. Only
+// when no complete record is available does the awaiter suspend and hand
+// the blocking read to the executor, which resumes the coroutine once a
+// record arrives. Like LiveBlocking, this is a single-consumer interface:
+// at most one coroutine should await a session at a time, and the record
+// remains valid until the next await.
+class LiveCoroSession {
+ public:
+  class RecordAwaitable {
+   public:
+    RecordAwaitable(LiveBlocking* client, const CoroExecutor* executor)
+        : client_{client}, executor_{executor} {}
+
+    bool await_ready() {
+      record_ = client_->NextRecordNoWait();
+      return record_ != nullptr;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+      (*executor_)([this, handle]() {
+        try {
+          record_ = &client_->NextRecord();
+        } catch (...) {
+          exception_ = std::current_exception();
+        }
+        handle.resume();
+      });
+    }
+
+    const Record* await_resume() {
+      if (exception_ != nullptr) {
+        std::rethrow_exception(exception_);
+      }
+      return record_;
+    }
+
+   private:
+    LiveBlocking* client_;
+    const CoroExecutor* executor_;
+    const Record* record_{nullptr};
+    std::exception_ptr exception_{nullptr};
+  };
+
+  // The session doesn't take ownership of client, which should outlive it.
+  // Subscribe and Start should be called on the client as usual before
+  // awaiting records.
+  explicit LiveCoroSession(LiveBlocking* client)
+      : LiveCoroSession{client,
+                        [](std::function<void()> work) { work(); }} {}
+  LiveCoroSession(LiveBlocking* client, CoroExecutor executor)
+      : client_{client}, executor_{std::move(executor)} {}
+
+  // Awaits the next record. The result pointer is valid until the next
+  // await on this session.
+  RecordAwaitable NextRecord() { return RecordAwaitable{client_, &executor_}; }
+
+  LiveBlocking& Client() { return *client_; }
+
+ private:
+  LiveBlocking* client_;
+  CoroExecutor executor_;
+};
+}  // namespace databento
+#endif
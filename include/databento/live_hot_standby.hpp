@@ -0,0 +1,125 @@
+#pragma once
+
+#include <array>
+#include <chrono>  // milliseconds
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "databento/datetime.hpp"           // UnixNanos
+#include "databento/dbn.hpp"                // Metadata
+#include "databento/detail/tcp_client.hpp"  // TcpClient
+#include "databento/enums.hpp"          // Schema, SType, VersionUpgradePolicy
+#include "databento/live_blocking.hpp"  // LiveBlocking
+#include "databento/record.hpp"         // Record
+
+namespace databento {
+class ILogReceiver;
+
+// A live client that maintains two authenticated and subscribed connections
+// to the same gateway. Records are delivered from the primary connection
+// while the standby is left unread, its data accumulating in the kernel
+// receive buffer (size it with SocketConf::recv_buffer_size on high-volume
+// feeds). If the primary dies, the standby is promoted immediately — no
+// reconnect, CRAM exchange, or resubscription on the critical path — and
+// the overlap between the two streams is skipped by comparing each record's
+// event timestamp and, where the schema has one, sequence number against
+// the last record delivered for its instrument. After a failover the dead
+// connection can be re-established with RearmStandby once the application
+// has a convenient moment to block.
+class LiveHotStandby {
+ public:
+  LiveHotStandby(ILogReceiver* log_receiver, std::string key,
+                 std::string dataset, bool send_ts_out,
+                 VersionUpgradePolicy upgrade_policy,
+                 detail::TcpClient::SocketConf socket_conf);
+  LiveHotStandby(ILogReceiver* log_receiver, std::string key,
+                 std::string dataset, std::string gateway, std::uint16_t port,
+                 bool send_ts_out, VersionUpgradePolicy upgrade_policy,
+                 detail::TcpClient::SocketConf socket_conf);
+
+  /*
+   * Getters
+   */
+
+  const std::string& Key() const { return Active().Key(); }
+  const std::string& Dataset() const { return Active().Dataset(); }
+  const std::string& Gateway() const { return Active().Gateway(); }
+  std::uint16_t Port() const { return Active().Port(); }
+  bool SendTsOut() const { return Active().SendTsOut(); }
+  VersionUpgradePolicy UpgradePolicy() const {
+    return Active().UpgradePolicy();
+  }
+  // The number of times the standby connection has been promoted.
+  std::size_t FailoverCount() const { return failover_count_; }
+  // Whether a standby connection is available to promote. False after a
+  // failover until RearmStandby succeeds.
+  bool StandbyReady() const { return standby_ready_; }
+
+  /*
+   * Methods
+   */
+
+  // Add a new subscription on both connections.
+  void Subscribe(const std::vector<std::string>& symbols, Schema schema,
+                 SType stype_in);
+  void Subscribe(const std::vector<std::string>& symbols, Schema schema,
+                 SType stype_in, UnixNanos start);
+  void Subscribe(const std::vector<std::string>& symbols, Schema schema,
+                 SType stype_in, const std::string& start);
+  // Notifies the gateway to start sending messages on both connections,
+  // standby first so its stream covers everything the primary delivers.
+  // Returns the metadata of the primary session.
+  //
+  // This method should only be called once per instance.
+  Metadata Start();
+  // Block on getting the next record, promoting the standby connection if
+  // the primary fails. The returned reference is valid until this method is
+  // called again.
+  //
+  // This method should only be called after `Start`.
+  const Record& NextRecord();
+  // Same as above with a timeout, returning `nullptr` if it's reached.
+  const Record* NextRecord(std::chrono::milliseconds timeout);
+  // Stops both sessions with the gateway. Once stopped, the sessions cannot
+  // be restarted.
+  void Stop();
+  // Blocks while reconnecting, resubscribing, and starting the connection
+  // that failed, making it the new standby. No-op while a standby is ready.
+  void RearmStandby();
+
+ private:
+  struct Subscription {
+    std::vector<std::string> symbols;
+    Schema schema;
+    SType stype_in;
+    UnixNanos start;
+    std::string start_str;
+  };
+  // The most recent record delivered for an instrument.
+  struct Progress {
+    std::uint64_t ts_event;
+    std::uint32_t sequence;
+  };
+
+  LiveBlocking& Active() { return sessions_[active_]; }
+  const LiveBlocking& Active() const { return sessions_[active_]; }
+  LiveBlocking& Standby() { return sessions_[1 - active_]; }
+  // Returns false when no standby is available to promote.
+  bool Promote(const std::exception& exc);
+  bool IsDuplicate(const Record& record) const;
+  void RecordProgress(const Record& record);
+
+  ILogReceiver* log_receiver_;
+  std::vector<Subscription> subscriptions_;
+  std::unordered_map<std::uint32_t, Progress> progress_;
+  std::array<LiveBlocking, 2> sessions_;
+  std::size_t active_{0};
+  bool standby_ready_{true};
+  // Set on the first failover; the overlap check is cheap enough to leave on
+  bool dedupe_{false};
+  std::size_t failover_count_{};
+};
+}  // namespace databento
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>      // milliseconds
+#include <cstddef>     // size_t
+#include <functional>  // function
+#include <vector>
+
+#include "databento/dbn.hpp"            // Metadata
+#include "databento/live_blocking.hpp"  // LiveBlocking
+#include "databento/record.hpp"         // Record
+#include "databento/timeseries.hpp"     // KeepGoing
+
+namespace databento {
+class ILogReceiver;
+
+// Multiplexes several live sessions on a single thread. All gateway sockets
+// are waited on together with one epoll instance (or poll elsewhere), and
+// every record is decoded on the thread calling Run and delivered through
+// one callback, rather than running one processing thread per session and
+// merging across threads downstream.
+class LiveSessionGroup {
+ public:
+  // Invoked with the index of the session that produced the record.
+  using GroupRecordCallback =
+      std::function<KeepGoing(std::size_t session, const Record& record)>;
+
+  explicit LiveSessionGroup(ILogReceiver* log_receiver);
+
+  // Adds a session to the group, returning its index. Must not be called
+  // once Run has been called.
+  std::size_t AddSession(LiveBlocking session);
+  LiveBlocking& Session(std::size_t session) { return sessions_[session]; }
+  std::size_t SessionCount() const { return sessions_.size(); }
+
+  // Notifies every gateway to start sending messages for all subscriptions,
+  // returning the metadata for each session in index order.
+  //
+  // This method should only be called once per instance.
+  std::vector<Metadata> Start();
+  // Processes records from all sessions on the calling thread until every
+  // session is closed or the callback returns KeepGoing::Stop. A session
+  // that fails is logged, closed, and removed from the loop; the remaining
+  // sessions keep running.
+  void Run(const GroupRecordCallback& callback);
+  // Like Run, but delivers a single stream ordered by RecordHeader::ts_event,
+  // merging the sessions through a k-way heap on the session heads. A record
+  // is delivered once every open session has a record buffered behind it, or
+  // once it has been held for staleness_window, bounding how long one quiet
+  // session can delay the merged stream. Records within each session are
+  // assumed to already be ordered by ts_event.
+  void RunOrdered(std::chrono::milliseconds staleness_window,
+                  const GroupRecordCallback& callback);
+
+ private:
+  // Decodes every buffered and immediately available record from one
+  // session. Returns false once the callback returns KeepGoing::Stop.
+  bool DrainSession(std::size_t session, const GroupRecordCallback& callback);
+
+  ILogReceiver* log_receiver_;
+  std::vector<LiveBlocking> sessions_;
+};
+}  // namespace databento
@@ -1,16 +1,23 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>  // size_t
+#include <cstdint>
 #include <functional>  // function
 #include <memory>      // unique_ptr
 #include <string>
 #include <vector>
 
-#include "databento/datetime.hpp"              // UnixNanos
-#include "databento/dbn.hpp"                   // Metadata
-#include "databento/detail/scoped_thread.hpp"  // ScopedThread
-#include "databento/enums.hpp"                 // Schema, SType
-#include "databento/record.hpp"                // Record
+#include "databento/datetime.hpp"               // UnixNanos
+#include "databento/dbn.hpp"                    // Metadata
+#include "databento/detail/journal_writer.hpp"  // JournalWriter
+#include "databento/detail/scoped_thread.hpp"   // ScopedThread
+#include "databento/detail/tcp_client.hpp"      // TcpClient
+#include "databento/enums.hpp"          // Schema, SType
+#include "databento/live_blocking.hpp"  // SubscriptionRequest
+#include "databento/latency_histogram.hpp"  // LatencyHistogram
+#include "databento/record.hpp"             // Record
+#include "databento/stats.hpp"              // ClientStats
 #include "databento/timeseries.hpp"  // MetadataCallback, RecordCallback
 
 namespace databento {
@@ -32,11 +39,96 @@ class LiveThreaded {
   using ExceptionCallback =
       std::function<ExceptionAction(const std::exception&)>;
 
+  // What the network thread does when the record queue is full because the
+  // consumer has fallen behind.
+  enum class QueueOverflowPolicy : std::uint8_t {
+    // Wait for space, applying backpressure to the gateway socket
+    Block,
+    // Drop the newest record and keep reading. Drops are counted in
+    // `QueueDropCount`.
+    Drop,
+  };
+
+  struct QueueConf {
+    // The number of record slots in the queue, rounded up to a power of two
+    std::size_t capacity{1024};
+    QueueOverflowPolicy overflow_policy{QueueOverflowPolicy::Block};
+  };
+
+  struct StaleWatchConf {
+    // Invoke `stale_hook` on the processing thread when the session goes
+    // `threshold` without a heartbeat or record. The hook fires once per
+    // stale episode and re-arms when the session shows life again. A zero
+    // threshold or an empty hook disables the watch.
+    std::chrono::milliseconds threshold{};
+    std::function<void()> stale_hook;
+  };
+
+  struct FastForwardConf {
+    // Enter fast-forward when the bytes buffered from the gateway but not
+    // yet consumed exceed this threshold, i.e. the consumer has fallen
+    // behind, e.g. after a GC-like stall. Zero disables fast-forwarding.
+    std::size_t backlog_threshold_bytes{};
+    // While fast-forwarding, records whose header `ts_event` lags the wall
+    // clock by more than this bound are skipped without invoking the
+    // callback, so the backlog is burned through at header-scan speed. The
+    // first fresh record ends the episode.
+    std::chrono::nanoseconds staleness_bound{};
+    // Optional hook invoked on the processing thread when an episode ends,
+    // with the number of records and bytes skipped during it.
+    std::function<void(std::uint64_t records, std::uint64_t bytes)>
+        report_hook;
+  };
+
+  struct GapBackfillConf {
+    // Optional hook invoked on the processing thread when a backfill episode
+    // ends, i.e. when the replay catches up to the live stream, with the
+    // number of replayed records dropped as duplicates during it.
+    std::function<void(std::uint64_t deduped_records)> report_hook;
+  };
+
+  struct LatencyWatchConf {
+    // Invoke `slow_hook` on the processing thread when a record callback
+    // takes `slow_threshold` or longer. A zero threshold or an empty hook
+    // disables the hook; durations are still recorded in the histogram.
+    std::chrono::nanoseconds slow_threshold{};
+    std::function<void(std::chrono::nanoseconds)> slow_hook;
+  };
+
+  struct ThreadConf {
+    // CPU to pin the record processing thread to, e.g. one on the NIC's NUMA
+    // node. Negative leaves thread placement to the scheduler. Ignored on
+    // platforms without thread affinity support.
+    int cpu{-1};
+    // NUMA node to place the session on, e.g. the NIC's node on multi-socket
+    // hosts. Binds the session's threads to the node's CPUs (unless `cpu`
+    // pins one more specifically), sets their allocation policy to prefer
+    // the node, and migrates the receive and queue buffers there, so records
+    // don't cross the interconnect between sockets. Negative leaves memory
+    // placement to the kernel. Only supported on Linux; ignored elsewhere.
+    int numa_node{-1};
+    // Scheduling policy for the processing thread (e.g. SCHED_FIFO). Negative
+    // keeps the inherited policy. Elevated policies usually require
+    // privileges: failures are logged, not thrown.
+    int sched_policy{-1};
+    int sched_priority{0};
+    // Name for the processing thread, truncated to 15 characters on Linux.
+    // Empty keeps the default.
+    std::string name;
+  };
+
   LiveThreaded(ILogReceiver* log_receiver, std::string key, std::string dataset,
                bool send_ts_out, VersionUpgradePolicy upgrade_policy);
+  LiveThreaded(ILogReceiver* log_receiver, std::string key, std::string dataset,
+               bool send_ts_out, VersionUpgradePolicy upgrade_policy,
+               detail::TcpClient::SocketConf socket_conf);
   LiveThreaded(ILogReceiver* log_receiver, std::string key, std::string dataset,
                std::string gateway, std::uint16_t port, bool send_ts_out,
                VersionUpgradePolicy upgrade_policy);
+  LiveThreaded(ILogReceiver* log_receiver, std::string key, std::string dataset,
+               std::string gateway, std::uint16_t port, bool send_ts_out,
+               VersionUpgradePolicy upgrade_policy,
+               detail::TcpClient::SocketConf socket_conf);
   LiveThreaded(const LiveThreaded&) = delete;
   LiveThreaded& operator=(const LiveThreaded&) = delete;
   LiveThreaded(LiveThreaded&& other) noexcept;
@@ -58,6 +150,10 @@ class LiveThreaded {
    * Methods
    */
 
+  // Configures the CPU affinity, scheduling, and name of the record
+  // processing thread. Only affects threads spawned by later calls to
+  // `Start`.
+  void SetThreadConf(ThreadConf thread_conf);
   // Add a new subscription. A single client instance supports multiple
   // subscriptions. Note there is no unsubscribe method. Subscriptions end
   // when the client disconnects when it's destroyed.
@@ -67,6 +163,18 @@ class LiveThreaded {
                  SType stype_in, UnixNanos start);
   void Subscribe(const std::vector<std::string>& symbols, Schema schema,
                  SType stype_in, const std::string& start);
+  // Overloads for a span of null-terminated symbols, e.g. handles from a
+  // SymbolInternPool, so callers with existing symbol storage subscribe
+  // without materializing a vector of strings.
+  void Subscribe(const char* const* symbols, std::size_t symbol_count,
+                 Schema schema, SType stype_in);
+  void Subscribe(const char* const* symbols, std::size_t symbol_count,
+                 Schema schema, SType stype_in, UnixNanos start);
+  void Subscribe(const char* const* symbols, std::size_t symbol_count,
+                 Schema schema, SType stype_in, const std::string& start);
+  // Add several subscriptions at once, coalescing all requests into as few
+  // writes as possible.
+  void Subscribe(const std::vector<SubscriptionRequest>& requests);
   // Notifies the gateway to start sending messages for all subscriptions.
   // `metadata_callback` will be called exactly once, before any calls to
   // `record_callback`. `record_callback` will be called for records from all
@@ -78,7 +186,101 @@ class LiveThreaded {
              RecordCallback record_callback);
   void Start(MetadataCallback metadata_callback, RecordCallback record_callback,
              ExceptionCallback exception_callback);
+  // Like the `Start` overloads above, but `batch_callback` is invoked once
+  // with all records decoded from each socket read, amortizing the callback
+  // dispatch across the batch.
+  void Start(BatchRecordCallback batch_callback);
+  void Start(MetadataCallback metadata_callback,
+             BatchRecordCallback batch_callback);
+  void Start(MetadataCallback metadata_callback,
+             BatchRecordCallback batch_callback,
+             ExceptionCallback exception_callback);
+  // Like the `Start` overloads above, but the network thread copies each
+  // decoded record into a bounded lock-free queue and `record_callback` is
+  // invoked on a second thread draining it, so a slow callback doesn't back
+  // up into the kernel receive buffer.
+  void Start(QueueConf queue_conf, RecordCallback record_callback);
+  void Start(QueueConf queue_conf, MetadataCallback metadata_callback,
+             RecordCallback record_callback,
+             ExceptionCallback exception_callback);
+  // The number of records dropped because the queue was full with the `Drop`
+  // overflow policy.
+  std::uint64_t QueueDropCount() const;
+  // Returns a snapshot of the session's activity counters. Cheap enough to
+  // poll and safe to call from any thread.
+  ClientStats Stats() const;
+  // Consumes heartbeat SystemMsg records at the client level so the record
+  // callback never sees them and doesn't have to branch on RType::System.
+  // Their arrival still refreshes the liveness clock.
+  //
+  // This method should only be called before `Start`.
+  void SuppressHeartbeats(bool suppress);
+  // Whether the session has gone longer than `threshold` without a
+  // heartbeat or record. Always false before `Start`. Safe to call from any
+  // thread.
+  bool IsSessionStale(std::chrono::milliseconds threshold) const;
+  // Invokes a hook on the processing thread when the session goes stale,
+  // e.g. to trigger failover. Only instruments the single-record,
+  // non-queued `Start` overloads.
+  //
+  // This method should only be called before `Start`.
+  void EnableStaleWatch(StaleWatchConf conf);
+  // Opt-in catch-up policy: when the consumer falls behind by more than the
+  // configured backlog threshold, records staler than the configured bound
+  // are skipped with only a header inspection instead of being replayed
+  // through the callback, shortening recovery after a consumer stall.
+  // Skips are counted in `FastForwardSkipCount`. Only instruments the
+  // single-record, non-queued `Start` overloads.
+  //
+  // This method should only be called before `Start`.
+  void EnableFastForward(FastForwardConf conf);
+  // The total number of records skipped by fast-forwarding. Safe to call
+  // from any thread.
+  std::uint64_t FastForwardSkipCount() const;
+  // Opt-in gap recovery: subscriptions are remembered along with the
+  // `ts_event` of the last record delivered to the callback, and `Reconnect`
+  // re-subscribes with the intraday replay `start` set to that point. The
+  // replayed records up to and including it are dropped, so the callback
+  // sees one complete stream across the reconnect instead of a gap or a
+  // duplicated overlap. Only instruments the single-record, non-queued
+  // `Start` overloads.
+  //
+  // This method should only be called before `Start`.
+  void EnableGapBackfill(GapBackfillConf conf);
+  // The total number of replayed records dropped as duplicates by gap
+  // backfill. Safe to call from any thread.
+  std::uint64_t GapBackfillDedupeCount() const;
+  // Records the duration of each record callback into a fixed-memory
+  // histogram and optionally invokes a hook for slow callbacks. Only
+  // instruments the single-record, non-queued `Start` overloads.
+  //
+  // This method should only be called before `Start`.
+  void EnableLatencyWatch(LatencyWatchConf conf);
+  // Records the gateway-to-client wire latency (receive time - ts_out) of
+  // each record into a fixed-memory histogram. The receive time comes from
+  // a coarse clock refreshed every few records, so the per-record cost is a
+  // subtraction and a couple of relaxed atomic operations. Requires the
+  // client to have been constructed with `send_ts_out`; otherwise the watch
+  // stays disabled and a warning is logged. Only instruments the
+  // single-record, non-queued `Start` overloads.
+  //
+  // This method should only be called before `Start`.
+  void EnableWireLatencyWatch();
+  // The histogram of wire latencies in nanoseconds. Empty unless
+  // `EnableWireLatencyWatch` was called before `Start`.
+  const LatencyHistogram& WireLatencies() const;
+  // The histogram of record callback durations in nanoseconds. Empty unless
+  // `EnableLatencyWatch` was called before `Start`.
+  const LatencyHistogram& CallbackLatencies() const;
+  // Tees the raw bytes of every gateway read into a memory-mapped,
+  // size-rotated journal, before any decoding. Replaying the journal through
+  // `DbnDecoder` reproduces the session byte-for-byte.
+  //
+  // This method should only be called before `Start`.
+  void EnableJournal(detail::JournalWriter::Conf conf);
   // Closes the current connection, and attempts to reconnect to the gateway.
+  // When gap backfill is enabled, also re-subscribes with an intraday replay
+  // covering the disconnect.
   void Reconnect();
   // Blocking wait with an optional timeout for the session to close when the
   // record_callback or the exception_callback return Stop.
@@ -91,6 +293,30 @@ class LiveThreaded {
   static void ProcessingThread(Impl* impl, MetadataCallback&& metadata_callback,
                                RecordCallback&& record_callback,
                                ExceptionCallback&& exception_callback);
+  static void BatchProcessingThread(Impl* impl,
+                                    MetadataCallback&& metadata_callback,
+                                    BatchRecordCallback&& batch_callback,
+                                    ExceptionCallback&& exception_callback);
+  static void QueuedProcessingThread(Impl* impl,
+                                     MetadataCallback&& metadata_callback,
+                                     ExceptionCallback&& exception_callback,
+                                     QueueOverflowPolicy overflow_policy);
+  static void QueueConsumerThread(Impl* impl, RecordCallback&& record_callback);
+  // Records `rec`'s wire latency against the coarse receive clock
+  static void RecordWireLatency(Impl* impl, const Record& rec);
+  // Returns true if `rec` was skipped by an active fast-forward episode
+  static bool FastForward(Impl* impl, const Record& rec);
+  // Ends any active fast-forward episode, reporting what it skipped
+  static void EndFastForward(Impl* impl);
+  // Returns true if `rec` is a replayed duplicate from an active backfill
+  // episode. Otherwise remembers its `ts_event` as the resume point.
+  static bool GapBackfillDedupe(Impl* impl, const Record& rec);
+  // Ends any active backfill episode, reporting what it deduped
+  static void EndGapBackfill(Impl* impl);
+  // Migrates the session state, including the blocking client's receive and
+  // compat buffers, to the configured NUMA node. A no-op unless a node is
+  // set.
+  static void ApplyNumaPlacement(Impl* impl);
   static ExceptionAction ExceptionHandler(
       Impl* impl, const ExceptionCallback& exception_callback,
       const std::exception& exc, const char* pretty_function_name,
@@ -99,5 +325,7 @@ class LiveThreaded {
   // unique_ptr to be movable
   std::unique_ptr<Impl> impl_;
   detail::ScopedThread thread_;
+  // Only used by the queued `Start` overloads
+  detail::ScopedThread consumer_thread_;
 };
 }  // namespace databento
@@ -1,8 +1,15 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>  // ostream
 #include <string>
+#include <utility>  // forward
+#include <vector>
+
+#include "databento/detail/scoped_thread.hpp"
 
 namespace databento {
 enum class LogLevel : std::uint8_t {
@@ -19,11 +26,16 @@ class ILogReceiver {
   virtual ~ILogReceiver() = default;
 
   virtual void Receive(databento::LogLevel level, const std::string& msg) = 0;
+  // Returns whether a message at the given level would be accepted. Callers
+  // can check this before formatting an expensive message. The default is
+  // conservative: any level may be logged.
+  virtual bool ShouldLog(databento::LogLevel) const { return true; }
 };
 
 class NullLogReceiver : public ILogReceiver {
  public:
   void Receive(databento::LogLevel, const std::string&) override {}
+  bool ShouldLog(databento::LogLevel) const override { return false; }
 };
 
 class ConsoleLogReceiver : public ILogReceiver {
@@ -34,9 +46,75 @@ class ConsoleLogReceiver : public ILogReceiver {
   ConsoleLogReceiver(LogLevel min_level, std::ostream& stream);
 
   void Receive(LogLevel level, const std::string& msg) override;
+  bool ShouldLog(LogLevel level) const override {
+    return level >= min_level_;
+  }
 
  private:
   std::ostream& stream_;
   const databento::LogLevel min_level_;
 };
+
+// An ILogReceiver that buffers messages in a bounded lock-free
+// multi-producer ring drained to a downstream receiver by a dedicated writer
+// thread, so a slow log sink (e.g. stderr piped to a log collector) never
+// stalls the logging thread. When the ring is full, messages are dropped and
+// counted; the drop count is reported downstream once the ring drains.
+class AsyncLogReceiver : public ILogReceiver {
+ public:
+  // Messages longer than this are truncated.
+  static constexpr std::size_t kMaxMsgLen = 255;
+
+  // Drains to `downstream`, which must outlive this receiver.
+  explicit AsyncLogReceiver(ILogReceiver* downstream);
+  // `capacity` is the number of buffered entries, rounded up to a power of
+  // two.
+  AsyncLogReceiver(ILogReceiver* downstream, std::size_t capacity);
+  // Not copyable or movable: the writer thread holds a reference
+  AsyncLogReceiver(const AsyncLogReceiver&) = delete;
+  AsyncLogReceiver& operator=(const AsyncLogReceiver&) = delete;
+  // Drains all buffered messages before returning.
+  ~AsyncLogReceiver() override;
+
+  // May be called from any thread.
+  void Receive(LogLevel level, const std::string& msg) override;
+  bool ShouldLog(LogLevel level) const override;
+  // The number of messages dropped because the ring was full.
+  std::uint64_t DroppedCount() const {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Entry {
+    // Slot state in the style of a bounded MPMC queue: `index` when free,
+    // `index + 1` when written, `index + capacity` after being consumed
+    std::atomic<std::size_t> sequence;
+    LogLevel level;
+    std::uint8_t length;
+    std::array<char, kMaxMsgLen> msg;
+  };
+
+  void WriteLoop();
+
+  ILogReceiver* downstream_;
+  std::size_t mask_;
+  std::vector<Entry> slots_;
+  std::atomic<std::size_t> enqueue_pos_{0};
+  // Only accessed by the writer thread
+  std::size_t dequeue_pos_{0};
+  std::atomic<std::uint64_t> dropped_count_{0};
+  std::uint64_t reported_dropped_{0};
+  std::atomic<bool> keep_running_{true};
+  detail::ScopedThread writer_thread_;
+};
+
+// Logs the message built by build_msg, a callable returning std::string, but
+// only invokes it if the receiver accepts the level, so a filtered-out
+// message costs one branch instead of string formatting.
+template <typename MessageFn>
+void LogIf(ILogReceiver* receiver, LogLevel level, MessageFn&& build_msg) {
+  if (receiver->ShouldLog(level)) {
+    receiver->Receive(level, std::forward<MessageFn>(build_msg)());
+  }
+}
 }  // namespace databento
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>  // size_t
+#include <memory>   // unique_ptr
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "databento/enums.hpp"       // VersionUpgradePolicy
+#include "databento/timeseries.hpp"  // MetadataCallback, RecordCallback
+
+namespace databento {
+// Replays records from multiple DBN files as a single stream ordered by
+// RecordHeader::ts_event. Files are decoded concurrently on a pool of
+// background threads while the merged stream is delivered to the callback
+// on the thread calling Replay.
+class MultiFileReplay {
+ public:
+  explicit MultiFileReplay(std::vector<std::string> file_paths);
+  MultiFileReplay(std::vector<std::string> file_paths,
+                  VersionUpgradePolicy upgrade_policy,
+                  std::size_t thread_count);
+  MultiFileReplay(const MultiFileReplay&) = delete;
+  MultiFileReplay& operator=(const MultiFileReplay&) = delete;
+  // Out-of-line destructor required for unique_ptr to incomplete Source
+  ~MultiFileReplay();
+
+  // Replays all files merged by ts_event. The metadata callback is invoked
+  // once per file, in the order the file paths were given, before any
+  // records are delivered.
+  void Replay(const MetadataCallback& metadata_callback,
+              const RecordCallback& record_callback);
+  void Replay(const RecordCallback& record_callback);
+
+ private:
+  struct Source;
+
+  void ProcessSources();
+  bool AdvanceSource(Source* source);
+  std::vector<std::uint8_t> DecodeChunk(Source* source);
+
+  std::vector<std::string> file_paths_;
+  VersionUpgradePolicy upgrade_policy_;
+  std::size_t thread_count_;
+  std::vector<std::unique_ptr<Source>> sources_;
+  bool shutdown_{false};
+  std::mutex mutex_;
+  // Signaled when a source queue gains space or the engine shuts down
+  std::condition_variable producer_cv_;
+  // Signaled when a source queue gains a chunk or its source finishes
+  std::condition_variable consumer_cv_;
+};
+}  // namespace databento
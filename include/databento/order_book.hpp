@@ -0,0 +1,112 @@
+#pragma once
+
+#include <array>
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "databento/constants.hpp"  // kUndefPrice
+#include "databento/enums.hpp"      // Action, Side
+#include "databento/record.hpp"     // BidAskPair, MboMsg
+
+namespace databento {
+// An aggregated price level maintained by OrderBook.
+struct PriceLevel {
+  // The price of the level, or kUndefPrice for an empty level.
+  std::int64_t price;
+  // The total quantity resting at the level.
+  std::uint64_t size;
+  // The number of resting orders at the level.
+  std::uint32_t count;
+
+  bool IsEmpty() const { return price == kUndefPrice; }
+};
+
+// A resting order tracked by OrderBook.
+struct BookOrder {
+  std::uint64_t order_id;
+  std::int64_t price;
+  std::uint32_t size;
+  Side side;
+};
+
+// A limit order book for a single instrument built from MboMsg records.
+// Maintains both L3 state (individual orders, pooled in a free-list-backed
+// array) and L2 state (aggregated price levels in contiguous sorted arrays).
+// Levels are kept with the best price at the back of each array, so updates
+// near the top of the book, where nearly all activity occurs, shift few or
+// no elements. Level accessors return references into those arrays without
+// copying.
+class OrderBook {
+ public:
+  OrderBook() = default;
+
+  // Applies an MBO record to the book. Trade and None-side records leave the
+  // book unchanged. Throws InvalidArgumentError if the record references an
+  // unknown order or is otherwise inconsistent with the book, which
+  // indicates records were dropped or applied out of order.
+  void Apply(const MboMsg& mbo);
+  // Removes all orders and levels.
+  void Clear();
+
+  // The number of price levels on each side.
+  std::size_t BidDepth() const { return bids_.size(); }
+  std::size_t AskDepth() const { return asks_.size(); }
+  // The number of resting orders.
+  std::size_t OrderCount() const { return order_lookup_.size(); }
+  // Returns the aggregated level `depth` levels below the best bid (above
+  // the best ask), where depth 0 is the best price. Returns an empty level
+  // with price kUndefPrice when the side has fewer levels. The reference is
+  // valid until the next call to Apply or Clear.
+  const PriceLevel& BidLevel(std::size_t depth) const;
+  const PriceLevel& AskLevel(std::size_t depth) const;
+  // Returns the resting order with the given ID, or nullptr if there is
+  // none. The pointer is valid until the next call to Apply or Clear.
+  const BookOrder* GetOrder(std::uint64_t order_id) const;
+  // The best bid and ask as a BidAskPair. Sides with no orders have price
+  // kUndefPrice and zero size and count.
+  BidAskPair Bbo() const { return LevelPair(0); }
+  // The top N levels of the book in BidAskPair form, best first.
+  template <std::size_t N>
+  std::array<BidAskPair, N> Snapshot() const {
+    std::array<BidAskPair, N> res;
+    for (std::size_t depth = 0; depth < N; ++depth) {
+      res[depth] = LevelPair(depth);
+    }
+    return res;
+  }
+
+ private:
+  void Add(const MboMsg& mbo);
+  void Cancel(const MboMsg& mbo);
+  void Modify(const MboMsg& mbo);
+  void Fill(const MboMsg& mbo);
+  // Removes `size` from the order at `order_it`, erasing the order when
+  // nothing remains.
+  void Reduce(std::unordered_map<std::uint64_t, std::uint32_t>::iterator
+                  order_it,
+              std::uint32_t size, const char* method_name);
+  void AddToLevel(Side side, std::int64_t price, std::uint32_t size);
+  void RemoveFromLevel(Side side, std::int64_t price, std::uint32_t size,
+                       bool order_removed, const char* method_name);
+  std::vector<PriceLevel>& SideLevels(Side side) {
+    return side == Side::Bid ? bids_ : asks_;
+  }
+  BidAskPair LevelPair(std::size_t depth) const;
+  std::uint32_t AllocOrder();
+  void FreeOrder(std::uint32_t index);
+
+  // Bid levels sorted by price ascending: the best bid is at the back.
+  std::vector<PriceLevel> bids_;
+  // Ask levels sorted by price descending: the best ask is at the back.
+  std::vector<PriceLevel> asks_;
+  // Pool of order nodes. Erased orders are recycled through free_list_
+  // rather than deallocated, so a busy book settles into a fixed set of
+  // allocations.
+  std::vector<BookOrder> order_pool_;
+  std::vector<std::uint32_t> free_list_;
+  // Maps order IDs to indices in order_pool_.
+  std::unordered_map<std::uint64_t, std::uint32_t> order_lookup_;
+};
+}  // namespace databento
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <chrono>  // microseconds
+#include <string>
+
+#include "databento/enums.hpp"       // VersionUpgradePolicy
+#include "databento/timeseries.hpp"  // MetadataCallback, RecordCallback
+
+namespace databento {
+// Replays records from a DBN file paced by the `ts_event` deltas between
+// records, simulating the inter-arrival timing of a live feed. Delivery
+// follows an absolute schedule anchored to the first record rather than
+// sleeping per record, so timing error doesn't accumulate over a session.
+class PacedReplay {
+ public:
+  struct Conf {
+    // Multiplier on replay speed: 1.0 delivers records at the cadence they
+    // were recorded, 10.0 replays ten times faster
+    double speed{1.0};
+    // Waits at or below this duration busy-spin for precise delivery;
+    // longer waits sleep until within the threshold
+    std::chrono::microseconds spin_threshold{200};
+  };
+
+  explicit PacedReplay(std::string file_path);
+  PacedReplay(std::string file_path, Conf conf);
+  PacedReplay(std::string file_path, VersionUpgradePolicy upgrade_policy,
+              Conf conf);
+
+  // Replays the file paced by `ts_event`. Records without a valid `ts_event`
+  // are delivered immediately after the preceding record.
+  void Replay(const MetadataCallback& metadata_callback,
+              const RecordCallback& record_callback);
+  void Replay(const RecordCallback& record_callback);
+
+ private:
+  std::string file_path_;
+  VersionUpgradePolicy upgrade_policy_;
+  Conf conf_;
+};
+}  // namespace databento
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t
+#include <functional>
+#include <string>
+
+#include "databento/dbn.hpp"
+#include "databento/detail/mmap_file_stream.hpp"
+#include "databento/enums.hpp"  // VersionUpgradePolicy
+#include "databento/record.hpp"
+#include "databento/timeseries.hpp"  // KeepGoing
+
+namespace databento {
+// Decodes an uncompressed DBN file by splitting its record region into
+// contiguous byte ranges that are decoded in parallel on one thread per
+// partition. Partition cuts are resynchronized onto the next RecordHeader
+// boundary by scanning for a chain of plausible headers, so every record is
+// decoded exactly once. Records within a partition are delivered in file
+// order; the callback is invoked concurrently from the worker threads and
+// must be thread-safe.
+class PartitionedReplay {
+ public:
+  // Invoked with the zero-based partition index and each record decoded from
+  // that partition.
+  using PartitionRecordCallback =
+      std::function<KeepGoing(std::size_t partition, const Record& record)>;
+
+  explicit PartitionedReplay(const std::string& file_path);
+  PartitionedReplay(const std::string& file_path,
+                    VersionUpgradePolicy upgrade_policy,
+                    std::size_t partition_count);
+
+  const Metadata& GetMetadata() const { return metadata_; }
+  std::size_t PartitionCount() const { return partition_count_; }
+
+  // Decodes all partitions in parallel, blocking until every partition is
+  // exhausted or the callback returns KeepGoing::Stop from any partition.
+  void Replay(const PartitionRecordCallback& callback);
+
+ private:
+  // Returns the offset of the first record boundary at or after `offset`, or
+  // the end of the file if there is none.
+  std::size_t Resync(std::size_t offset) const;
+  bool IsRecordBoundary(std::size_t offset) const;
+
+  detail::MmapFileStream file_;
+  Metadata metadata_;
+  VersionUpgradePolicy upgrade_policy_;
+  std::size_t partition_count_;
+  // The offset of the first record, directly after the metadata frame
+  std::size_t records_start_;
+};
+}  // namespace databento
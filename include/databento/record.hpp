@@ -62,7 +62,27 @@ class Record {
     return *reinterpret_cast<T*>(record_);
   }
 
+  // Identical to Get, which performs no validation either. This spelling
+  // documents hot call sites that have already dispatched on RType() and
+  // stays valid should Get ever gain debug-mode checking.
+  template <typename T>
+  const T& GetUnchecked() const {
+    return *reinterpret_cast<const T*>(record_);
+  }
+  template <typename T>
+  T& GetUnchecked() {
+    return *reinterpret_cast<T*>(record_);
+  }
+
   std::size_t Size() const;
+  // Whether the record's length field is consistent with its rtype.
+  bool HasValidSize() const;
+  // Invokes visitor with the record cast to its concrete type, e.g.
+  // `visitor(const MboMsg&)` for an MBO record. Returns false without
+  // invoking visitor if the rtype is unknown. visitor must be callable with
+  // every concrete record type.
+  template <typename Visitor>
+  bool Visit(Visitor&& visitor) const;
   static std::size_t SizeOfSchema(Schema schema);
   static ::databento::RType RTypeFromSchema(Schema schema);
 
@@ -382,6 +402,92 @@ struct SystemMsg {
 static_assert(sizeof(SystemMsg) == 320, "SystemMsg size must match Rust");
 static_assert(alignof(SystemMsg) == 8, "Must have 8-byte alignment");
 
+// The expected size in bytes of a version 2 record with the given rtype, or
+// 0 if the rtype is unknown. Evaluated at compile time for constant rtypes.
+constexpr std::size_t RecordSizeOf(RType rtype) {
+  return rtype == RType::Mbo             ? sizeof(MboMsg)
+         : rtype == RType::Mbp0          ? sizeof(TradeMsg)
+         : rtype == RType::Mbp1          ? sizeof(Mbp1Msg)
+         : rtype == RType::Mbp10         ? sizeof(Mbp10Msg)
+         : rtype == RType::OhlcvDeprecated ||
+                 (rtype >= RType::Ohlcv1S && rtype <= RType::Ohlcv1D)
+             ? sizeof(OhlcvMsg)
+         : rtype == RType::InstrumentDef ? sizeof(InstrumentDefMsg)
+         : rtype == RType::Imbalance     ? sizeof(ImbalanceMsg)
+         : rtype == RType::Statistics    ? sizeof(StatMsg)
+         : rtype == RType::Error         ? sizeof(ErrorMsg)
+         : rtype == RType::SymbolMapping ? sizeof(SymbolMappingMsg)
+         : rtype == RType::System        ? sizeof(SystemMsg)
+                                         : 0;
+}
+
+inline bool Record::HasValidSize() const {
+  const std::size_t expected = RecordSizeOf(RType());
+  // A record with ts_out appended is one UnixNanos larger than its struct
+  return expected != 0 &&
+         (Size() == expected || Size() == expected + sizeof(UnixNanos));
+}
+
+// The dense switch compiles to a jump table, so dispatch is a single
+// indirect branch rather than a chain of rtype comparisons, and each typed
+// handler can be inlined into its case.
+template <typename Visitor>
+bool Record::Visit(Visitor&& visitor) const {
+  switch (record_->rtype) {
+    case RType::Mbo: {
+      visitor(Get<MboMsg>());
+      return true;
+    }
+    case RType::Mbp0: {
+      visitor(Get<TradeMsg>());
+      return true;
+    }
+    case RType::Mbp1: {
+      visitor(Get<Mbp1Msg>());
+      return true;
+    }
+    case RType::Mbp10: {
+      visitor(Get<Mbp10Msg>());
+      return true;
+    }
+    case RType::OhlcvDeprecated:  // fallthrough
+    case RType::Ohlcv1S:          // fallthrough
+    case RType::Ohlcv1M:          // fallthrough
+    case RType::Ohlcv1H:          // fallthrough
+    case RType::Ohlcv1D: {
+      visitor(Get<OhlcvMsg>());
+      return true;
+    }
+    case RType::InstrumentDef: {
+      visitor(Get<InstrumentDefMsg>());
+      return true;
+    }
+    case RType::Imbalance: {
+      visitor(Get<ImbalanceMsg>());
+      return true;
+    }
+    case RType::Statistics: {
+      visitor(Get<StatMsg>());
+      return true;
+    }
+    case RType::Error: {
+      visitor(Get<ErrorMsg>());
+      return true;
+    }
+    case RType::SymbolMapping: {
+      visitor(Get<SymbolMappingMsg>());
+      return true;
+    }
+    case RType::System: {
+      visitor(Get<SystemMsg>());
+      return true;
+    }
+    default: {
+      return false;
+    }
+  }
+}
+
 inline bool operator==(const RecordHeader& lhs, const RecordHeader& rhs) {
   return lhs.length == rhs.length && lhs.rtype == rhs.rtype &&
          lhs.publisher_id == rhs.publisher_id &&
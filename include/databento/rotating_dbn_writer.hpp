@@ -0,0 +1,86 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>  // size_t
+#include <cstdint>
+#include <future>  // future
+#include <memory>  // unique_ptr
+#include <string>
+#include <vector>
+
+#include "databento/datetime.hpp"  // UnixNanos
+#include "databento/dbn.hpp"       // Metadata
+#include "databento/dbn_encoder.hpp"
+#include "databento/detail/request_thread_pool.hpp"
+#include "databento/iwritable.hpp"
+#include "databento/record.hpp"  // Record
+
+namespace databento {
+// When a capture file rotates. Size and time limits may be combined; a
+// file rotates when it exceeds either. Zero disables a limit.
+struct RotationPolicy {
+  // Rotate once a file's size reaches this many bytes.
+  std::size_t max_file_size{0};
+  // Rotate once a file has been open this long (wall clock).
+  std::chrono::nanoseconds max_file_duration{};
+};
+
+// A DbnFileWriter for continuous live capture that rotates across files by
+// size and/or wall-clock age. Files are written uncompressed as
+// `<prefix>-<index>.dbn.inprogress` and sealed on rotation: the metadata's
+// end timestamp is patched to the last captured record, the file is
+// fsynced, and it's renamed to its final `.dbn` name. Sealing runs on a
+// background thread, so the capture path never blocks on storage — a
+// stalled fsync delays only the rename of an already-complete file, never
+// WriteRecord.
+class RotatingDbnWriter {
+ public:
+  // Capture files are named `<file_prefix>-<index>.dbn` within output_dir.
+  // The metadata is written at the start of every file. Throws
+  // InvalidArgumentError if the policy disables both limits.
+  RotatingDbnWriter(const std::string& output_dir,
+                    const std::string& file_prefix, const Metadata& metadata,
+                    RotationPolicy policy);
+  RotatingDbnWriter(const RotatingDbnWriter&) = delete;
+  RotatingDbnWriter& operator=(const RotatingDbnWriter&) = delete;
+  // Seals the current file and waits for pending background seals,
+  // swallowing their errors. Prefer calling Close first.
+  ~RotatingDbnWriter();
+
+  // Writes a record to the current capture file, rotating beforehand if
+  // the file exceeds the policy's limits.
+  void WriteRecord(const Record& record);
+  // Seals the current file and blocks until every background seal has
+  // completed, rethrowing the first error any of them hit. The writer
+  // can't be used afterwards.
+  void Close();
+  // The number of files sealed or in progress, including the current one.
+  std::size_t FileCount() const { return file_index_; }
+
+ private:
+  void OpenNextFile();
+  // Closes the current file and hands fsync, metadata finalization, and
+  // the rename to the background thread.
+  void SealCurrentFile();
+
+  std::string output_dir_;
+  std::string file_prefix_;
+  Metadata metadata_;
+  RotationPolicy policy_;
+  std::size_t file_index_{};
+  std::string current_path_;
+  std::size_t bytes_written_{};
+  std::size_t file_record_count_{};
+  std::chrono::steady_clock::time_point opened_at_;
+  // ts_event range of the records in the current file, patched into the
+  // sealed file's metadata as its start and end timestamps
+  UnixNanos first_ts_event_{};
+  UnixNanos last_ts_event_{};
+  std::unique_ptr<IWritable> output_;
+  std::unique_ptr<DbnEncoder> encoder_;
+  std::vector<std::future<void>> pending_seals_;
+  // Single worker so seals of successive files stay ordered. Declared last
+  // so it's destroyed (and drained) before the state its tasks use.
+  detail::RequestThreadPool seal_pool_{1};
+};
+}  // namespace databento
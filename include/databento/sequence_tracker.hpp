@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>  // function
+#include <unordered_map>
+#include <utility>  // move
+
+#include "databento/datetime.hpp"  // UnixNanos
+#include "databento/record.hpp"    // MboMsg, Record
+
+namespace databento {
+// Tracks per-instrument venue sequence numbers on the live decode path,
+// detecting gaps and reordering with a couple of branchless comparisons per
+// record. Counters are atomic so they can be scraped from a monitoring
+// thread while the feed-handler thread keeps calling OnRecord.
+class SequenceTracker {
+ public:
+  // One detected sequence discontinuity.
+  struct Gap {
+    std::uint32_t instrument_id;
+    // One past the last sequence number seen for the instrument
+    std::uint32_t expected;
+    std::uint32_t received;
+    UnixNanos ts_event;
+  };
+  // Invoked synchronously on the decode thread, so it should be cheap.
+  using GapCallback = std::function<void(const Gap&)>;
+
+  SequenceTracker() = default;
+  explicit SequenceTracker(GapCallback on_gap) : on_gap_{std::move(on_gap)} {}
+
+  // Updates tracking from a record. Only MBO records carry venue sequence
+  // numbers; all other record types are ignored.
+  void OnRecord(const Record& record) {
+    if (record.RType() == RType::Mbo) {
+      Track(record.Get<MboMsg>());
+    }
+  }
+  void Track(const MboMsg& mbo);
+
+  // Records whose sequence number skipped ahead of the expected value
+  std::uint64_t GapCount() const {
+    return gap_count_.load(std::memory_order_relaxed);
+  }
+  // Records whose sequence number fell behind the expected value
+  std::uint64_t OutOfOrderCount() const {
+    return out_of_order_count_.load(std::memory_order_relaxed);
+  }
+  // Records flagged kMaybeBadBook, the venue-signaled unrecoverable gaps
+  std::uint64_t BadBookCount() const {
+    return bad_book_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::unordered_map<std::uint32_t, std::uint32_t> last_sequence_;
+  std::atomic<std::uint64_t> gap_count_{0};
+  std::atomic<std::uint64_t> out_of_order_count_{0};
+  std::atomic<std::uint64_t> bad_book_count_{0};
+  GapCallback on_gap_;
+};
+}  // namespace databento
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>  // size_t
+#include <exception>
+#include <memory>  // unique_ptr
+#include <mutex>
+#include <vector>
+
+#include "databento/detail/scoped_thread.hpp"
+#include "databento/detail/spsc_record_queue.hpp"
+#include "databento/record.hpp"      // Record
+#include "databento/timeseries.hpp"  // RecordCallback
+
+namespace databento {
+// A dispatch stage that spreads record processing across a pool of worker
+// threads while preserving per-instrument ordering. Records are routed by
+// RecordHeader::instrument_id to one of worker_count shards, each a
+// lock-free SPSC ring filled only by the dispatching thread. Workers prefer
+// their own shard but steal from other shards when idle: a consumer claims
+// exclusive ownership of a whole ring before popping, so an instrument's
+// records are always processed one at a time in arrival order no matter
+// which worker runs them.
+//
+// The callback runs concurrently on the worker threads for records of
+// different instruments, so any state it shares across instruments must be
+// synchronized.
+class ShardedDispatcher {
+ public:
+  static constexpr std::size_t kDefaultQueueCapacity = 1024;
+
+  // Throws InvalidArgumentError if worker_count is zero.
+  ShardedDispatcher(std::size_t worker_count, RecordCallback callback);
+  // queue_capacity is the per-shard record capacity, rounded up to a power
+  // of two. Dispatch blocks while a record's shard is full, so size it for
+  // the expected burstiness.
+  ShardedDispatcher(std::size_t worker_count, std::size_t queue_capacity,
+                    RecordCallback callback);
+  ShardedDispatcher(const ShardedDispatcher&) = delete;
+  ShardedDispatcher& operator=(const ShardedDispatcher&) = delete;
+  // Stops and joins the workers without surfacing their result: records
+  // still queued are processed, but a callback exception is lost. Prefer
+  // calling Close first.
+  ~ShardedDispatcher();
+
+  std::size_t WorkerCount() const { return workers_.size(); }
+
+  // Routes the record to its instrument's shard, blocking while the shard
+  // is full. May only be called from one thread at a time. Records
+  // dispatched after the callback returns KeepGoing::Stop are dropped.
+  void Dispatch(const Record& record);
+  // Waits for the workers to drain every shard, then joins them and
+  // rethrows the first exception thrown by the callback, if any. The
+  // dispatcher can't be reused afterwards.
+  void Close();
+
+ private:
+  // A shard's ring plus the flag securing exclusive consumer access to it.
+  // Only the worker that wins the claim may pop, which is what keeps
+  // stealing compatible with the queue's single-consumer requirement and
+  // with per-instrument ordering.
+  struct Shard {
+    explicit Shard(std::size_t capacity) : queue{capacity} {}
+
+    detail::SpscRecordQueue queue;
+    std::atomic<bool> claimed{false};
+  };
+
+  void WorkerLoop(std::size_t worker_idx);
+  // Processes every record currently in the shard. Returns true if any
+  // record was processed. The caller must hold the shard's claim.
+  bool DrainShard(Shard* shard);
+  bool AllShardsEmpty() const;
+
+  RecordCallback callback_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  // Set once the producer is done dispatching; workers exit when it's set
+  // and every shard is empty
+  std::atomic<bool> closed_{false};
+  // Set when the callback returns KeepGoing::Stop or throws
+  std::atomic<bool> stopped_{false};
+  std::mutex exception_mutex_;
+  std::exception_ptr exception_;
+  std::vector<detail::ScopedThread> workers_;
+};
+}  // namespace databento
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t, uint64_t
+#include <string>
+
+#include "databento/record.hpp"  // kMaxRecordLen, Record
+
+namespace databento {
+// Publishes decoded records into a shared-memory broadcast ring so
+// co-located processes can consume one live session's stream without their
+// own sessions. Each record is copied into a sequence-stamped slot; readers
+// never block the publisher and a slow reader is lapped rather than applying
+// backpressure. Designed to sit in a `LiveThreaded` record callback:
+//
+//   client.Start([&publisher](const Record& record) {
+//     publisher.Publish(record);
+//     return KeepGoing::Continue;
+//   });
+//
+// The backing file (e.g. under /dev/shm) is left in place on destruction so
+// subscribers can outlive the publisher.
+class ShmRecordPublisher {
+ public:
+  // Creates and maps the ring file at `path` with at least `min_slot_count`
+  // record slots, rounded up to a power of two. Throws on failure.
+  ShmRecordPublisher(const std::string& path, std::size_t min_slot_count);
+  // Not copyable or movable: subscribers rendezvous on the mapping
+  ShmRecordPublisher(const ShmRecordPublisher&) = delete;
+  ShmRecordPublisher& operator=(const ShmRecordPublisher&) = delete;
+  ~ShmRecordPublisher();
+
+  // The number of record slots in the ring.
+  std::size_t Capacity() const;
+  // The total number of records published.
+  std::uint64_t RecordCount() const;
+
+  // Copies `record` into the next slot. Never blocks: a subscriber that
+  // hasn't consumed the slot being overwritten observes a gap. Throws
+  // InvalidArgumentError for records larger than kMaxRecordLen rather than
+  // overflow a slot in the shared mapping.
+  void Publish(const Record& record);
+
+ private:
+  void* map_{nullptr};
+  std::size_t map_size_{};
+};
+
+// Attaches to a ring created by ShmRecordPublisher and reads records in
+// publication order. Reads are seqlock-style: each record is copied out of
+// its slot and the slot's sequence stamp is re-checked, so a concurrent
+// overwrite is detected rather than yielding a torn record. Zero syscalls
+// per read. Each subscriber instance may only be used from one thread.
+class ShmRecordSubscriber {
+ public:
+  // Maps the ring file at `path` read-only. Throws if the file doesn't
+  // contain a valid ring.
+  explicit ShmRecordSubscriber(const std::string& path);
+  // Not copyable or movable: Next() returns pointers into the instance
+  ShmRecordSubscriber(const ShmRecordSubscriber&) = delete;
+  ShmRecordSubscriber& operator=(const ShmRecordSubscriber&) = delete;
+  ~ShmRecordSubscriber();
+
+  // The number of record slots in the ring.
+  std::size_t Capacity() const;
+  // The total number of records skipped because the publisher lapped this
+  // subscriber.
+  std::uint64_t LostCount() const { return lost_count_; }
+
+  // Returns the next record or `nullptr` when the subscriber is caught up.
+  // The returned record is valid until the next call. When the publisher
+  // has lapped this subscriber, skips to the oldest intact record and
+  // increments LostCount() by the number skipped.
+  const Record* Next();
+
+ private:
+  const void* map_{nullptr};
+  std::size_t map_size_{};
+  // The sequence number of the next record to read
+  std::uint64_t next_seq_{};
+  std::uint64_t lost_count_{};
+  // kMaxRecordLen is a multiple of alignof(RecordHeader), so the copied-out
+  // record remains suitably aligned
+  alignas(alignof(RecordHeader)) std::array<std::uint8_t, kMaxRecordLen>
+      buffer_{};
+  Record record_{nullptr};
+};
+}  // namespace databento
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace databento {
+// A snapshot of a client's activity counters, returned by the `Stats`
+// methods on `DbnDecoder`, `LiveBlocking`, and `LiveThreaded`. All fields
+// are cumulative since the client was constructed except where noted.
+struct ClientStats {
+  // Bytes read from the input or gateway socket
+  std::uint64_t bytes_read{};
+  // Reads from the input or gateway socket, i.e. buffer refills
+  std::uint64_t read_calls{};
+  // Records decoded, after any record filter
+  std::uint64_t records{};
+  // Records upgraded from an older DBN version
+  std::uint64_t compat_upgrades{};
+  // Reconnections to the gateway
+  std::uint64_t reconnects{};
+  // Bytes currently buffered in the input channel, for decoders reading
+  // from a channel. Instantaneous, not cumulative.
+  std::uint64_t bytes_buffered{};
+};
+
+namespace detail {
+// Relaxed atomic counters cheap enough to update inline on hot paths:
+// uncontended relaxed increments compile to plain `lock add`s with no
+// ordering stalls. `Snapshot` reads each counter independently without
+// stopping writers, so the fields of one snapshot may be offset from each
+// other by in-flight updates.
+class StatsCounters {
+ public:
+  StatsCounters() = default;
+  // Moving only happens before the owning client is running (e.g. returning
+  // a client from a builder), so a relaxed member-wise copy of the counter
+  // values is sufficient. Needed because atomics aren't movable and would
+  // otherwise delete the owning client's move constructor.
+  StatsCounters(StatsCounters&& other) noexcept
+      : bytes_read_{other.bytes_read_.load(std::memory_order_relaxed)},
+        read_calls_{other.read_calls_.load(std::memory_order_relaxed)},
+        records_{other.records_.load(std::memory_order_relaxed)},
+        compat_upgrades_{
+            other.compat_upgrades_.load(std::memory_order_relaxed)},
+        reconnects_{other.reconnects_.load(std::memory_order_relaxed)} {}
+  StatsCounters& operator=(StatsCounters&& other) noexcept {
+    bytes_read_ = other.bytes_read_.load(std::memory_order_relaxed);
+    read_calls_ = other.read_calls_.load(std::memory_order_relaxed);
+    records_ = other.records_.load(std::memory_order_relaxed);
+    compat_upgrades_ = other.compat_upgrades_.load(std::memory_order_relaxed);
+    reconnects_ = other.reconnects_.load(std::memory_order_relaxed);
+    return *this;
+  }
+
+  void AddRead(std::uint64_t bytes) {
+    bytes_read_.fetch_add(bytes, std::memory_order_relaxed);
+    read_calls_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void AddRecords(std::uint64_t count) {
+    records_.fetch_add(count, std::memory_order_relaxed);
+  }
+  void AddCompatUpgrades(std::uint64_t count) {
+    compat_upgrades_.fetch_add(count, std::memory_order_relaxed);
+  }
+  void AddReconnect() { reconnects_.fetch_add(1, std::memory_order_relaxed); }
+
+  ClientStats Snapshot() const {
+    ClientStats res;
+    res.bytes_read = bytes_read_.load(std::memory_order_relaxed);
+    res.read_calls = read_calls_.load(std::memory_order_relaxed);
+    res.records = records_.load(std::memory_order_relaxed);
+    res.compat_upgrades = compat_upgrades_.load(std::memory_order_relaxed);
+    res.reconnects = reconnects_.load(std::memory_order_relaxed);
+    return res;
+  }
+
+ private:
+  std::atomic<std::uint64_t> bytes_read_{0};
+  std::atomic<std::uint64_t> read_calls_{0};
+  std::atomic<std::uint64_t> records_{0};
+  std::atomic<std::uint64_t> compat_upgrades_{0};
+  std::atomic<std::uint64_t> reconnects_{0};
+};
+}  // namespace detail
+}  // namespace databento
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>  // size_t
+#include <memory>   // unique_ptr
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace databento {
+// An append-only interning pool for symbol text. The same symbol ("ESH6",
+// etc.) recurs across Metadata::symbols, symbol mappings, and symbol maps;
+// interning stores each distinct spelling once in a chunked slab and hands
+// out a canonical null-terminated handle. Equal text always yields the same
+// handle, so symbol equality in hot joins is a pointer compare, and handles
+// remain valid for the lifetime of the pool: nothing is ever removed or
+// moved. Writers serialize on a mutex; `Find` and handle dereferences are
+// lock-free, so readers never stall behind an intern.
+class SymbolInternPool {
+ public:
+  // `capacity` is the maximum number of distinct symbols, fixed at
+  // construction: the index doesn't grow, so size it for the subscribed
+  // universe.
+  explicit SymbolInternPool(std::size_t capacity = 1 << 16);
+  // Not copyable or movable: handles point into the pool
+  SymbolInternPool(const SymbolInternPool&) = delete;
+  SymbolInternPool& operator=(const SymbolInternPool&) = delete;
+
+  // A process-wide pool for symbol-carrying structures to share.
+  static SymbolInternPool& Shared();
+
+  // The number of distinct symbols interned.
+  std::size_t Size() const { return size_.load(std::memory_order_relaxed); }
+
+  // Returns the canonical handle for `symbol`, interning it on first sight.
+  // Thread-safe. Throws Exception when the pool is at capacity.
+  const char* Intern(const std::string& symbol);
+  const char* Intern(const char* symbol, std::size_t length);
+  // Returns the canonical handle for `symbol`, or nullptr when it was never
+  // interned. Safe to call from any thread concurrently with writers,
+  // without taking the mutex.
+  const char* Find(const std::string& symbol) const;
+  const char* Find(const char* symbol, std::size_t length) const;
+
+ private:
+  // Interned text is copied into fixed-size chunks; symbols longer than a
+  // chunk get a chunk of their own
+  static constexpr std::size_t kChunkSize = 1 << 16;
+
+  const char* Append(const char* symbol, std::size_t length);
+
+  // Open-addressing index over the slab. Entries are claimed under mutex_
+  // and published with a release store, so lock-free probes see complete
+  // strings.
+  std::vector<std::atomic<const char*>> index_;
+  std::size_t index_mask_;
+  std::size_t capacity_;
+  std::atomic<std::size_t> size_{0};
+  std::mutex mutex_;
+  // The slab: chunks are only ever appended, so handles never move
+  std::vector<std::unique_ptr<char[]>> chunks_;
+  std::size_t chunk_used_{kChunkSize};
+};
+}  // namespace databento
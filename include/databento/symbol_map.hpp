@@ -1,10 +1,14 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "databento/compat.hpp"
+#include "databento/constants.hpp"  // kSymbolCstrLen
+#include "databento/dbn.hpp"  // Metadata
 #include "databento/record.hpp"
 
 namespace databento {
@@ -40,4 +44,120 @@ extern template void PitSymbolMap::OnSymbolMapping(
     const SymbolMappingMsgV1& symbol_mapping);
 extern template void PitSymbolMap::OnSymbolMapping(
     const SymbolMappingMsgV2& symbol_mapping);
+
+// A cache-friendly alternative to PitSymbolMap for per-record lookup in hot
+// loops: an open-addressing hash table whose slots store the symbol text
+// inline in a fixed-capacity array (symbols are bounded by kSymbolCstrLen),
+// so a lookup probes contiguous slots instead of chasing a bucket node and a
+// heap-allocated string. Mappings can be inserted and updated but not
+// removed, matching how symbology messages are applied.
+class FlatPitSymbolMap {
+ public:
+  FlatPitSymbolMap();
+
+  bool IsEmpty() const { return size_ == 0; }
+  std::size_t Size() const { return size_; }
+  // Returns the null-terminated symbol mapped to instrument_id, or nullptr
+  // if there's no mapping. The pointer is invalidated by the next insertion.
+  const char* Find(std::uint32_t instrument_id) const;
+  // Maps instrument_id to symbol, replacing any previous mapping. Symbols
+  // longer than kSymbolCstrLen - 1 are truncated.
+  void Insert(std::uint32_t instrument_id, const char* symbol);
+  void OnRecord(const Record& rec);
+  template <typename SymbolMappingRec>
+  void OnSymbolMapping(const SymbolMappingRec& symbol_mapping);
+
+ private:
+  struct Slot {
+    std::uint32_t instrument_id;
+    bool is_occupied;
+    std::array<char, kSymbolCstrLen> symbol;
+  };
+
+  Slot& FindSlot(std::uint32_t instrument_id);
+  void Grow();
+
+  std::vector<Slot> slots_;
+  std::size_t size_{};
+};
+
+// Forward declare explicit instantiation
+extern template void FlatPitSymbolMap::OnSymbolMapping(
+    const SymbolMappingMsgV1& symbol_mapping);
+extern template void FlatPitSymbolMap::OnSymbolMapping(
+    const SymbolMappingMsgV2& symbol_mapping);
+
+// A symbol map specialized for the dense instrument ID ranges typical within
+// one live session: mappings near the first-seen ID are stored in a
+// direct-indexed vector, making Find a bounds check plus an array index with
+// no hashing. Outliers beyond the dense window fall back to a
+// FlatPitSymbolMap. An ID's storage is decided once from its distance to the
+// window base, so dense and sparse entries never alias.
+class DensePitSymbolMap {
+ public:
+  bool IsEmpty() const { return Size() == 0; }
+  std::size_t Size() const { return dense_size_ + sparse_.Size(); }
+  // Returns the null-terminated symbol mapped to instrument_id, or nullptr
+  // if there's no mapping. The pointer is invalidated by the next insertion.
+  const char* Find(std::uint32_t instrument_id) const;
+  // Maps instrument_id to symbol, replacing any previous mapping. Symbols
+  // longer than kSymbolCstrLen - 1 are truncated.
+  void Insert(std::uint32_t instrument_id, const char* symbol);
+  void OnRecord(const Record& rec);
+  template <typename SymbolMappingRec>
+  void OnSymbolMapping(const SymbolMappingRec& symbol_mapping);
+
+ private:
+  // An empty symbol marks an unmapped slot within the dense window
+  using DenseSlot = std::array<char, kSymbolCstrLen>;
+
+  bool has_base_{false};
+  std::uint32_t base_{};
+  std::vector<DenseSlot> dense_;
+  std::size_t dense_size_{};
+  FlatPitSymbolMap sparse_;
+};
+
+// Forward declare explicit instantiation
+extern template void DensePitSymbolMap::OnSymbolMapping(
+    const SymbolMappingMsgV1& symbol_mapping);
+extern template void DensePitSymbolMap::OnSymbolMapping(
+    const SymbolMappingMsgV2& symbol_mapping);
+
+// A timeseries symbol map for historical data spanning several days, built
+// once from Metadata::mappings. The mapping intervals are flattened into one
+// array sorted by instrument ID and start date with the symbol text interned
+// in a side table, so Find is a binary search with no allocation. Either the
+// input or output symbology type of the metadata must be instrument ID.
+class TsSymbolMap {
+ public:
+  TsSymbolMap() = default;
+  explicit TsSymbolMap(const Metadata& metadata);
+
+  bool IsEmpty() const { return entries_.empty(); }
+  // The number of indexed mapping intervals.
+  std::size_t Size() const { return entries_.size(); }
+  // Returns the symbol mapped to instrument_id on date, given as YYYYMMDD,
+  // e.g. 2022-10-08 is represented as 20221008. Returns nullptr if there's
+  // no mapping for that day. The pointer remains valid for the lifetime of
+  // the map.
+  const std::string* Find(std::uint32_t date,
+                          std::uint32_t instrument_id) const;
+
+ private:
+  struct Entry {
+    std::uint32_t instrument_id;
+    // Inclusive, as YYYYMMDD
+    std::uint32_t start_date;
+    // Exclusive, as YYYYMMDD
+    std::uint32_t end_date;
+    // Index into symbols_
+    std::uint32_t symbol_idx;
+  };
+
+  // Sorted by instrument ID, then start date
+  std::vector<Entry> entries_;
+  // Deduplicated symbol text referenced by entries_
+  std::vector<std::string> symbols_;
+};
 }  // namespace databento
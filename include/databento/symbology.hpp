@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>  // size_t
 #include <cstdint>
+#include <memory>  // shared_ptr
 #include <ostream>
 #include <string>
 #include <unordered_map>
@@ -24,6 +26,59 @@ struct SymbologyResolution {
   std::vector<std::string> not_found;
 };
 
+// Like StrMappingInterval, but the null-terminated strings point into the
+// pool owned by the enclosing FlatSymbologyResolution.
+struct FlatStrMappingInterval {
+  // YYYY-MM-DD
+  const char* start_date;
+  // YYYY-MM-DD
+  const char* end_date;
+  const char* symbol;
+};
+
+// One input symbol's mapping within a FlatSymbologyResolution. The intervals
+// are the half-open index range [interval_begin, interval_begin +
+// interval_count) into Intervals(), sorted by start date.
+struct FlatSymbolMapping {
+  // Null-terminated, points into the pool owned by the enclosing
+  // FlatSymbologyResolution
+  const char* input_symbol;
+  std::uint32_t interval_begin;
+  std::uint32_t interval_count;
+};
+
+// A flat form of SymbologyResolution: all text is interned once in a single
+// contiguous pool and the mappings are kept in index arrays sorted by input
+// symbol, so lookup is a binary search and iteration walks contiguous
+// memory, with no per-entry allocation. Copies share the pool.
+class FlatSymbologyResolution {
+ public:
+  FlatSymbologyResolution() = default;
+  explicit FlatSymbologyResolution(const SymbologyResolution& resolution);
+
+  bool IsEmpty() const { return mappings_.empty(); }
+  // The number of resolved input symbols.
+  std::size_t Size() const { return mappings_.size(); }
+  // Sorted by input symbol.
+  const std::vector<FlatSymbolMapping>& Mappings() const { return mappings_; }
+  // Grouped by mapping, sorted by start date within each mapping.
+  const std::vector<FlatStrMappingInterval>& Intervals() const {
+    return intervals_;
+  }
+  const std::vector<const char*>& Partial() const { return partial_; }
+  const std::vector<const char*>& NotFound() const { return not_found_; }
+  // Returns the mapping for input_symbol, or nullptr if it didn't resolve.
+  const FlatSymbolMapping* Find(const char* input_symbol) const;
+
+ private:
+  std::vector<FlatSymbolMapping> mappings_;
+  std::vector<FlatStrMappingInterval> intervals_;
+  std::vector<const char*> partial_;
+  std::vector<const char*> not_found_;
+  // Owns every string the views point into
+  std::shared_ptr<const std::vector<char>> pool_;
+};
+
 // Converts a vector of symbols to a comma-delineated string for sending to
 // Databento's historical and live APIs.
 //
@@ -35,6 +90,12 @@ std::string JoinSymbolStrings(
     std::vector<std::string>::const_iterator symbols_end);
 std::string JoinSymbolStrings(const std::string& method_name,
                               const std::vector<std::string>& symbols);
+// Overload for a span of null-terminated symbols, e.g. handles from a
+// SymbolInternPool or a FlatSymbologyResolution, avoiding a temporary
+// vector of strings.
+std::string JoinSymbolStrings(const std::string& method_name,
+                              const char* const* symbols,
+                              std::size_t symbol_count);
 std::string ToString(const StrMappingInterval& mapping_interval);
 std::string ToString(const SymbologyResolution& sym_res);
 std::ostream& operator<<(std::ostream& stream,
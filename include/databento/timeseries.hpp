@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>  // function
+#include <vector>
 
 #include "databento/dbn.hpp"     // Metadata
 #include "databento/record.hpp"  // Record
@@ -13,4 +14,7 @@ enum KeepGoing : std::uint8_t {
 
 using MetadataCallback = std::function<void(Metadata&&)>;
 using RecordCallback = std::function<KeepGoing(const Record&)>;
+// A callback invoked with every record decoded from one socket read,
+// amortizing the dispatch across the batch.
+using BatchRecordCallback = std::function<KeepGoing(const std::vector<Record>&)>;
 }  // namespace databento
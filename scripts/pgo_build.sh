@@ -0,0 +1,24 @@
+#! /usr/bin/env bash
+# Builds a profile-guided, architecture-tuned library using the benchmark
+# suite as the training workload. The result is left in build-pgo.
+set -e
+
+BUILD_DIR=build-pgo
+PROFILE_DIR="$(pwd)/${BUILD_DIR}/pgo-profiles"
+
+# Phase 1: instrumented build
+cmake --preset pgo-instrument
+cmake --build --preset pgo-instrument -- -j "$(nproc)"
+
+# Phase 2: train on the benchmark suite
+"${BUILD_DIR}/benchmark/databentoBenchmarks"
+
+# Clang writes raw profiles that must be merged before use
+if ls "${PROFILE_DIR}"/*.profraw > /dev/null 2>&1; then
+  llvm-profdata merge -output="${PROFILE_DIR}/default.profdata" \
+    "${PROFILE_DIR}"/*.profraw
+fi
+
+# Phase 3: rebuild consuming the profiles
+cmake --preset pgo-use
+cmake --build --preset pgo-use --clean-first -- -j "$(nproc)"
@@ -0,0 +1,133 @@
+#include "databento/bar_aggregator.hpp"
+
+#include <algorithm>  // max, min
+#include <utility>    // move
+
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+
+using databento::BarAggregator;
+
+namespace {
+constexpr std::uint64_t kNanosPerSecond = 1000000000ULL;
+
+databento::RType RTypeForInterval(std::uint64_t interval_ns) {
+  switch (interval_ns) {
+    case kNanosPerSecond: {
+      return databento::RType::Ohlcv1S;
+    }
+    case 60 * kNanosPerSecond: {
+      return databento::RType::Ohlcv1M;
+    }
+    case 3600 * kNanosPerSecond: {
+      return databento::RType::Ohlcv1H;
+    }
+    case 86400 * kNanosPerSecond: {
+      return databento::RType::Ohlcv1D;
+    }
+    default: {
+      return databento::RType::OhlcvDeprecated;
+    }
+  }
+}
+}  // namespace
+
+constexpr std::size_t BarAggregator::kMaxDenseExtent;
+
+BarAggregator::BarAggregator(std::chrono::nanoseconds interval,
+                             BarCallback callback)
+    : interval_ns_{static_cast<std::uint64_t>(interval.count())},
+      rtype_{RTypeForInterval(interval_ns_)},
+      callback_{std::move(callback)} {
+  if (interval.count() <= 0) {
+    throw InvalidArgumentError{"BarAggregator::BarAggregator", "interval",
+                               "Must be positive"};
+  }
+}
+
+void BarAggregator::OnRecord(const Record& record) {
+  if (record.Holds<TradeMsg>()) {
+    const auto& trade = record.Get<TradeMsg>();
+    ApplyTrade(trade.hd.publisher_id, trade.hd.instrument_id,
+               trade.hd.ts_event, trade.price, trade.size);
+  } else if (record.Holds<MboMsg>()) {
+    const auto& mbo = record.Get<MboMsg>();
+    if (mbo.action == Action::Trade) {
+      ApplyTrade(mbo.hd.publisher_id, mbo.hd.instrument_id, mbo.hd.ts_event,
+                 mbo.price, mbo.size);
+    }
+  }
+}
+
+void BarAggregator::Flush() {
+  for (auto& slot : dense_) {
+    if (slot.open) {
+      callback_(slot.bar);
+      slot.open = false;
+    }
+  }
+  dense_size_ = 0;
+  for (auto& id_and_slot : sparse_) {
+    callback_(id_and_slot.second.bar);
+  }
+  sparse_.clear();
+}
+
+void BarAggregator::ApplyTrade(std::uint16_t publisher_id,
+                               std::uint32_t instrument_id, UnixNanos ts_event,
+                               std::int64_t price, std::uint32_t size) {
+  const auto ts = static_cast<std::uint64_t>(
+      ts_event.time_since_epoch().count());
+  const UnixNanos bar_start{
+      std::chrono::nanoseconds{ts - ts % interval_ns_}};
+  BarSlot* slot = FindOrInsertSlot(instrument_id);
+  if (slot->open && slot->bar_start != bar_start) {
+    callback_(slot->bar);
+    slot->open = false;
+  }
+  UpdateSlot(slot, publisher_id, instrument_id, bar_start, price, size);
+}
+
+void BarAggregator::UpdateSlot(BarSlot* slot, std::uint16_t publisher_id,
+                               std::uint32_t instrument_id,
+                               UnixNanos bar_start, std::int64_t price,
+                               std::uint32_t size) {
+  if (!slot->open) {
+    slot->open = true;
+    slot->bar_start = bar_start;
+    slot->bar.hd =
+        RecordHeader{sizeof(OhlcvMsg) / RecordHeader::kLengthMultiplier,
+                     rtype_, publisher_id, instrument_id, bar_start};
+    slot->bar.open = price;
+    slot->bar.high = price;
+    slot->bar.low = price;
+    slot->bar.close = price;
+    slot->bar.volume = size;
+    return;
+  }
+  slot->bar.high = std::max(slot->bar.high, price);
+  slot->bar.low = std::min(slot->bar.low, price);
+  slot->bar.close = price;
+  slot->bar.volume += size;
+}
+
+BarAggregator::BarSlot* BarAggregator::FindOrInsertSlot(
+    std::uint32_t instrument_id) {
+  if (!has_base_) {
+    has_base_ = true;
+    base_ = instrument_id;
+  }
+  if (instrument_id >= base_) {
+    const std::size_t offset = instrument_id - base_;
+    if (offset < kMaxDenseExtent) {
+      if (offset >= dense_.size()) {
+        dense_.resize(offset + 1);
+      }
+      BarSlot* slot = &dense_[offset];
+      if (!slot->open) {
+        ++dense_size_;
+      }
+      return slot;
+    }
+  }
+  return &sparse_[instrument_id];
+}
@@ -0,0 +1,57 @@
+#include "databento/book_analytics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace databento {
+namespace book_analytics {
+double Imbalance(const BidAskPair* levels, std::size_t level_count) {
+  // Accumulate in integers: level sizes are 32-bit so the sums can't
+  // overflow, and the single loop reduces to vector adds
+  std::uint64_t bid_sz = 0;
+  std::uint64_t ask_sz = 0;
+  for (std::size_t i = 0; i < level_count; ++i) {
+    bid_sz += levels[i].bid_sz;
+    ask_sz += levels[i].ask_sz;
+  }
+  return (static_cast<double>(bid_sz) - static_cast<double>(ask_sz)) /
+         (static_cast<double>(bid_sz) + static_cast<double>(ask_sz));
+}
+
+namespace {
+template <typename KernelT>
+std::size_t ApplyToBatch(const std::vector<Record>& records,
+                         std::vector<double>* out, KernelT kernel) {
+  const auto size_before = out->size();
+  out->reserve(size_before + records.size());
+  for (const auto& record : records) {
+    if (record.Holds<Mbp10Msg>()) {
+      out->emplace_back(kernel(record.Get<Mbp10Msg>()));
+    }
+  }
+  return out->size() - size_before;
+}
+}  // namespace
+
+std::size_t SizeWeightedMid(const std::vector<Record>& records,
+                            std::vector<double>* out) {
+  return ApplyToBatch(records, out, [](const Mbp10Msg& mbp) {
+    return SizeWeightedMid(mbp.levels[0]);
+  });
+}
+
+std::size_t Microprice(const std::vector<Record>& records,
+                       std::vector<double>* out) {
+  return ApplyToBatch(records, out, [](const Mbp10Msg& mbp) {
+    return Microprice(mbp.levels[0]);
+  });
+}
+
+std::size_t Imbalance(const std::vector<Record>& records,
+                      std::vector<double>* out) {
+  return ApplyToBatch(records, out, [](const Mbp10Msg& mbp) {
+    return Imbalance(mbp.levels);
+  });
+}
+}  // namespace book_analytics
+}  // namespace databento
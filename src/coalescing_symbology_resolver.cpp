@@ -0,0 +1,143 @@
+#include "databento/coalescing_symbology_resolver.hpp"
+
+#include <exception>  // current_exception
+#include <iterator>   // next
+
+#include "databento/historical.hpp"
+
+using databento::CoalescingSymbologyResolver;
+
+namespace {
+std::string BatchKey(const std::string& dataset, databento::SType stype_in,
+                     databento::SType stype_out,
+                     const databento::DateRange& date_range) {
+  std::string key = dataset;
+  key += '|';
+  key += databento::ToString(stype_in);
+  key += '|';
+  key += databento::ToString(stype_out);
+  key += '|';
+  key += date_range.start;
+  key += '|';
+  key += date_range.end;
+  return key;
+}
+}  // namespace
+
+CoalescingSymbologyResolver::CoalescingSymbologyResolver(
+    Historical* client, std::chrono::milliseconds window)
+    : client_{client},
+      window_{window},
+      worker_{[this] { this->WorkerLoop(); }} {}
+
+CoalescingSymbologyResolver::~CoalescingSymbologyResolver() {
+  {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    is_shutting_down_ = true;
+  }
+  cv_.notify_one();
+  // ScopedThread joins the worker, which flushes any pending batches
+}
+
+std::future<databento::SymbologyResolution>
+CoalescingSymbologyResolver::Resolve(const std::string& dataset,
+                                     const std::vector<std::string>& symbols,
+                                     SType stype_in, SType stype_out,
+                                     const DateRange& date_range) {
+  Caller caller{symbols, {}};
+  std::future<SymbologyResolution> future = caller.promise.get_future();
+  {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    const std::string key =
+        ::BatchKey(dataset, stype_in, stype_out, date_range);
+    auto batch_it = batches_.find(key);
+    if (batch_it == batches_.end()) {
+      // First caller opens the window
+      batch_it = batches_
+                     .emplace(key, Batch{dataset,
+                                         stype_in,
+                                         stype_out,
+                                         date_range,
+                                         std::chrono::steady_clock::now() +
+                                             window_,
+                                         {},
+                                         {},
+                                         {}})
+                     .first;
+    }
+    auto& batch = batch_it->second;
+    for (const auto& symbol : symbols) {
+      if (batch.symbol_set.insert(symbol).second) {
+        batch.symbols.emplace_back(symbol);
+      }
+    }
+    batch.callers.emplace_back(std::move(caller));
+  }
+  cv_.notify_one();
+  return future;
+}
+
+void CoalescingSymbologyResolver::WorkerLoop() {
+  std::unique_lock<std::mutex> lock{mutex_};
+  while (true) {
+    if (batches_.empty()) {
+      if (is_shutting_down_) {
+        return;
+      }
+      cv_.wait(lock);
+      continue;
+    }
+    // Find the batch whose window closes first
+    auto due_it = batches_.begin();
+    for (auto it = std::next(batches_.begin()); it != batches_.end(); ++it) {
+      if (it->second.deadline < due_it->second.deadline) {
+        due_it = it;
+      }
+    }
+    // Shutdown flushes immediately rather than waiting out the window
+    if (!is_shutting_down_ &&
+        due_it->second.deadline > std::chrono::steady_clock::now()) {
+      cv_.wait_until(lock, due_it->second.deadline);
+      continue;
+    }
+    Batch batch{std::move(due_it->second)};
+    batches_.erase(due_it);
+    lock.unlock();
+    ExecuteBatch(std::move(batch));
+    lock.lock();
+  }
+}
+
+void CoalescingSymbologyResolver::ExecuteBatch(Batch&& batch) {
+  SymbologyResolution full;
+  try {
+    full = client_->SymbologyResolve(batch.dataset, batch.symbols,
+                                     batch.stype_in, batch.stype_out,
+                                     batch.date_range);
+  } catch (const std::exception&) {
+    for (auto& caller : batch.callers) {
+      caller.promise.set_exception(std::current_exception());
+    }
+    return;
+  }
+  const std::unordered_set<std::string> partial{full.partial.begin(),
+                                                full.partial.end()};
+  const std::unordered_set<std::string> not_found{full.not_found.begin(),
+                                                  full.not_found.end()};
+  for (auto& caller : batch.callers) {
+    // Fan out only this caller's share of the batched result
+    SymbologyResolution res{};
+    for (const auto& symbol : caller.symbols) {
+      const auto mapping_it = full.mappings.find(symbol);
+      if (mapping_it != full.mappings.end()) {
+        res.mappings.emplace(symbol, mapping_it->second);
+      } else if (partial.count(symbol) > 0) {
+        res.partial.emplace_back(symbol);
+      } else {
+        // Symbols the response omitted entirely are treated as not found
+        res.not_found.emplace_back(symbol);
+      }
+    }
+    caller.promise.set_value(std::move(res));
+  }
+}
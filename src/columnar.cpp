@@ -0,0 +1,115 @@
+#include "databento/columnar.hpp"
+
+using databento::MboColumns;
+using databento::TradeColumns;
+
+void MboColumns::Append(const MboMsg& mbo) {
+  ts_event.emplace_back(
+      static_cast<std::uint64_t>(mbo.hd.ts_event.time_since_epoch().count()));
+  ts_recv.emplace_back(
+      static_cast<std::uint64_t>(mbo.ts_recv.time_since_epoch().count()));
+  instrument_id.emplace_back(mbo.hd.instrument_id);
+  publisher_id.emplace_back(mbo.hd.publisher_id);
+  order_id.emplace_back(mbo.order_id);
+  price.emplace_back(mbo.price);
+  size.emplace_back(mbo.size);
+  flags.emplace_back(static_cast<std::uint8_t>(mbo.flags));
+  channel_id.emplace_back(mbo.channel_id);
+  action.emplace_back(static_cast<char>(mbo.action));
+  side.emplace_back(static_cast<char>(mbo.side));
+  ts_in_delta.emplace_back(
+      static_cast<std::int32_t>(mbo.ts_in_delta.count()));
+  sequence.emplace_back(mbo.sequence);
+}
+
+void MboColumns::Reserve(std::size_t record_count) {
+  ts_event.reserve(record_count);
+  ts_recv.reserve(record_count);
+  instrument_id.reserve(record_count);
+  publisher_id.reserve(record_count);
+  order_id.reserve(record_count);
+  price.reserve(record_count);
+  size.reserve(record_count);
+  flags.reserve(record_count);
+  channel_id.reserve(record_count);
+  action.reserve(record_count);
+  side.reserve(record_count);
+  ts_in_delta.reserve(record_count);
+  sequence.reserve(record_count);
+}
+
+void MboColumns::Clear() {
+  ts_event.clear();
+  ts_recv.clear();
+  instrument_id.clear();
+  publisher_id.clear();
+  order_id.clear();
+  price.clear();
+  size.clear();
+  flags.clear();
+  channel_id.clear();
+  action.clear();
+  side.clear();
+  ts_in_delta.clear();
+  sequence.clear();
+}
+
+void TradeColumns::Append(const TradeMsg& trade) {
+  ts_event.emplace_back(static_cast<std::uint64_t>(
+      trade.hd.ts_event.time_since_epoch().count()));
+  ts_recv.emplace_back(
+      static_cast<std::uint64_t>(trade.ts_recv.time_since_epoch().count()));
+  instrument_id.emplace_back(trade.hd.instrument_id);
+  publisher_id.emplace_back(trade.hd.publisher_id);
+  price.emplace_back(trade.price);
+  size.emplace_back(trade.size);
+  action.emplace_back(static_cast<char>(trade.action));
+  side.emplace_back(static_cast<char>(trade.side));
+  flags.emplace_back(static_cast<std::uint8_t>(trade.flags));
+  depth.emplace_back(trade.depth);
+  ts_in_delta.emplace_back(
+      static_cast<std::int32_t>(trade.ts_in_delta.count()));
+  sequence.emplace_back(trade.sequence);
+}
+
+void TradeColumns::Reserve(std::size_t record_count) {
+  ts_event.reserve(record_count);
+  ts_recv.reserve(record_count);
+  instrument_id.reserve(record_count);
+  publisher_id.reserve(record_count);
+  price.reserve(record_count);
+  size.reserve(record_count);
+  action.reserve(record_count);
+  side.reserve(record_count);
+  flags.reserve(record_count);
+  depth.reserve(record_count);
+  ts_in_delta.reserve(record_count);
+  sequence.reserve(record_count);
+}
+
+void TradeColumns::Clear() {
+  ts_event.clear();
+  ts_recv.clear();
+  instrument_id.clear();
+  publisher_id.clear();
+  price.clear();
+  size.clear();
+  action.clear();
+  side.clear();
+  flags.clear();
+  depth.clear();
+  ts_in_delta.clear();
+  sequence.clear();
+}
+
+std::uint64_t databento::DecodeColumns(DbnDecoder* decoder,
+                                       MboColumns* columns) {
+  return decoder->DecodeAll<MboMsg>(
+      [columns](const MboMsg& mbo) { columns->Append(mbo); });
+}
+
+std::uint64_t databento::DecodeColumns(DbnDecoder* decoder,
+                                       TradeColumns* columns) {
+  return decoder->DecodeAll<TradeMsg>(
+      [columns](const TradeMsg& trade) { columns->Append(trade); });
+}
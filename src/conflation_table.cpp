@@ -0,0 +1,82 @@
+#include "databento/conflation_table.hpp"
+
+#include <cstring>  // memcpy
+
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+
+using databento::ConflationTable;
+
+ConflationTable::ConflationTable(std::uint32_t base_instrument_id,
+                                 std::size_t instrument_count)
+    : base_{base_instrument_id},
+      slot_count_{instrument_count},
+      slots_{new Slot[instrument_count]{}} {
+  if (instrument_count == 0) {
+    throw InvalidArgumentError{"ConflationTable::ConflationTable",
+                               "instrument_count", "Must be non-zero"};
+  }
+}
+
+bool ConflationTable::Update(const Record& record) {
+  const auto instrument_id = record.Header().instrument_id;
+  if (instrument_id < base_ || instrument_id - base_ >= slot_count_) {
+    return false;
+  }
+  if (record.Size() > kMaxRecordLen) {
+    // A corrupt length byte would otherwise overflow the slot: the decoder
+    // doesn't bound the header length against kMaxRecordLen
+    return false;
+  }
+  Slot& slot = slots_[instrument_id - base_];
+  const auto version = slot.version.load(std::memory_order_relaxed);
+  // Mark the slot inconsistent before touching the payload. The fence
+  // orders the odd-version store before the copy for readers.
+  slot.version.store(version + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(slot.payload.data(), &record.Header(), record.Size());
+  slot.version.store(version + 2, std::memory_order_release);
+  return true;
+}
+
+bool ConflationTable::GetLatest(std::uint32_t instrument_id,
+                                ConflatedRecord* snapshot) const {
+  const Slot* slot = FindSlot(instrument_id);
+  if (slot == nullptr) {
+    return false;
+  }
+  for (;;) {
+    const auto version_before =
+        slot->version.load(std::memory_order_acquire);
+    if (version_before == 0) {
+      return false;
+    }
+    if (version_before % 2 == 1) {
+      // Mid-write: try again
+      continue;
+    }
+    std::memcpy(snapshot->buffer.data(), slot->payload.data(),
+                kMaxRecordLen);
+    // Order the copy before the re-read of the version
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot->version.load(std::memory_order_relaxed) == version_before) {
+      return true;
+    }
+  }
+}
+
+std::uint64_t ConflationTable::UpdateCount(
+    std::uint32_t instrument_id) const {
+  const Slot* slot = FindSlot(instrument_id);
+  if (slot == nullptr) {
+    return 0;
+  }
+  return slot->version.load(std::memory_order_relaxed) / 2;
+}
+
+const ConflationTable::Slot* ConflationTable::FindSlot(
+    std::uint32_t instrument_id) const {
+  if (instrument_id < base_ || instrument_id - base_ >= slot_count_) {
+    return nullptr;
+  }
+  return &slots_[instrument_id - base_];
+}
@@ -0,0 +1,239 @@
+#include "databento/corpus_generator.hpp"
+
+#include <algorithm>  // min
+#include <chrono>     // nanoseconds
+
+#include "databento/constants.hpp"  // dataset, kDbnVersion, kSymbolCstrLen
+#include "databento/dbn_encoder.hpp"
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+
+using databento::CorpusGenerator;
+
+namespace {
+constexpr std::int64_t kBasePrice = 3722750000000LL;
+constexpr std::int64_t kTickSize = 250000LL;
+
+// Appends encoded bytes to a caller-owned vector for the convenience
+// Generate overload.
+class VectorWritable : public databento::IWritable {
+ public:
+  explicit VectorWritable(std::vector<std::uint8_t>* buffer)
+      : buffer_{buffer} {}
+
+  void WriteAll(const std::uint8_t* buffer, std::size_t length) override {
+    buffer_->insert(buffer_->end(), buffer, buffer + length);
+  }
+
+ private:
+  std::vector<std::uint8_t>* buffer_;
+};
+}  // namespace
+
+CorpusGenerator::CorpusGenerator(const CorpusConfig& config)
+    : config_{config},
+      rng_{config.seed},
+      ts_{static_cast<std::uint64_t>(
+          config.start.time_since_epoch().count())},
+      price_{kBasePrice} {
+  if (config_.instrument_count == 0) {
+    throw InvalidArgumentError{"CorpusGenerator::CorpusGenerator",
+                               "config.instrument_count",
+                               "must be non-zero"};
+  }
+  if (config_.burst_size == 0) {
+    throw InvalidArgumentError{"CorpusGenerator::CorpusGenerator",
+                               "config.burst_size", "must be non-zero"};
+  }
+}
+
+databento::Metadata CorpusGenerator::GenerateMetadata() const {
+  Metadata metadata{};
+  metadata.version = kDbnVersion;
+  metadata.dataset = dataset::kXnasItch;
+  metadata.schema = config_.schema;
+  metadata.start = config_.start;
+  metadata.stype_in = SType::RawSymbol;
+  metadata.stype_out = SType::InstrumentId;
+  metadata.symbol_cstr_len = kSymbolCstrLen;
+  return metadata;
+}
+
+void CorpusGenerator::Generate(IWritable* output) {
+  // Restart so every call emits an identical stream
+  rng_.seed(config_.seed);
+  ts_ = static_cast<std::uint64_t>(config_.start.time_since_epoch().count());
+  price_ = kBasePrice;
+  burst_pos_ = 0;
+  sequence_ = 0;
+  DbnEncoder encoder{GenerateMetadata(), output};
+  switch (config_.schema) {
+    case Schema::Mbo: {
+      GenerateRecords<MboMsg>(&encoder);
+      break;
+    }
+    case Schema::Trades: {
+      GenerateRecords<TradeMsg>(&encoder);
+      break;
+    }
+    case Schema::Mbp1: {
+      GenerateRecords<Mbp1Msg>(&encoder);
+      break;
+    }
+    case Schema::Mbp10: {
+      GenerateRecords<Mbp10Msg>(&encoder);
+      break;
+    }
+    case Schema::Ohlcv1S:  // fallthrough
+    case Schema::Ohlcv1M:  // fallthrough
+    case Schema::Ohlcv1H:  // fallthrough
+    case Schema::Ohlcv1D: {
+      GenerateOhlcv(&encoder);
+      break;
+    }
+    default: {
+      throw InvalidArgumentError{"CorpusGenerator::Generate", "config.schema",
+                                 "unsupported schema " +
+                                     std::string{ToString(config_.schema)}};
+    }
+  }
+}
+
+std::vector<std::uint8_t> CorpusGenerator::Generate() {
+  std::vector<std::uint8_t> buffer;
+  VectorWritable output{&buffer};
+  Generate(&output);
+  return buffer;
+}
+
+std::uint32_t CorpusGenerator::NextInstrumentId() {
+  const auto first = static_cast<std::uint32_t>(
+      rng_() % config_.instrument_count);
+  if (config_.instrument_distribution == InstrumentDistribution::Uniform) {
+    return first + 1;
+  }
+  // The minimum of two uniform draws is triangular, concentrating activity
+  // in the lowest IDs
+  const auto second = static_cast<std::uint32_t>(
+      rng_() % config_.instrument_count);
+  return std::min(first, second) + 1;
+}
+
+std::uint32_t CorpusGenerator::NextSize() {
+  return static_cast<std::uint32_t>(rng_() % 100) + 1;
+}
+
+std::int64_t CorpusGenerator::NextPrice() {
+  // Random walk of up to four ticks per step, bounded away from zero
+  price_ += (static_cast<std::int64_t>(rng_() % 9) - 4) * kTickSize;
+  if (price_ < kTickSize) {
+    price_ = kTickSize;
+  }
+  return price_;
+}
+
+databento::UnixNanos CorpusGenerator::NextTs() {
+  const UnixNanos res{std::chrono::nanoseconds{ts_}};
+  ++burst_pos_;
+  if (burst_pos_ >= config_.burst_size) {
+    burst_pos_ = 0;
+    ts_ += config_.inter_burst_gap_ns;
+  } else {
+    ts_ += config_.intra_burst_gap_ns;
+  }
+  return res;
+}
+
+template <typename RecordT>
+void CorpusGenerator::GenerateRecords(DbnEncoder* encoder) {
+  for (std::size_t i = 0; i < config_.record_count; ++i) {
+    RecordT record{};
+    record.hd = RecordHeader{
+        sizeof(RecordT) / RecordHeader::kLengthMultiplier,
+        Record::RTypeFromSchema(config_.schema), 1, NextInstrumentId(),
+        NextTs()};
+    Fill(record);
+    encoder->EncodeRecord(Record{&record.hd});
+  }
+}
+
+void CorpusGenerator::GenerateOhlcv(DbnEncoder* encoder) {
+  for (std::size_t i = 0; i < config_.record_count; ++i) {
+    OhlcvMsg record{};
+    record.hd = RecordHeader{
+        sizeof(OhlcvMsg) / RecordHeader::kLengthMultiplier,
+        Record::RTypeFromSchema(config_.schema), 1, NextInstrumentId(),
+        NextTs()};
+    record.open = NextPrice();
+    record.close = NextPrice();
+    record.high = std::max(record.open, record.close) + kTickSize;
+    record.low = std::min(record.open, record.close) - kTickSize;
+    record.volume = NextSize();
+    encoder->EncodeRecord(Record{&record.hd});
+  }
+}
+
+void CorpusGenerator::Fill(MboMsg& record) {
+  record.order_id = 1000000 + sequence_;
+  record.price = NextPrice();
+  record.size = NextSize();
+  record.channel_id = 0;
+  switch (rng_() % 4) {
+    case 0: {
+      record.action = Action::Cancel;
+      break;
+    }
+    case 1: {
+      record.action = Action::Trade;
+      break;
+    }
+    default: {
+      record.action = Action::Add;
+      break;
+    }
+  }
+  record.side = rng_() % 2 == 0 ? Side::Bid : Side::Ask;
+  record.ts_recv = record.hd.ts_event;
+  record.ts_in_delta = TimeDeltaNanos{100};
+  record.sequence = sequence_++;
+}
+
+void CorpusGenerator::Fill(TradeMsg& record) {
+  record.price = NextPrice();
+  record.size = NextSize();
+  record.action = Action::Trade;
+  record.side = rng_() % 2 == 0 ? Side::Bid : Side::Ask;
+  record.ts_recv = record.hd.ts_event;
+  record.ts_in_delta = TimeDeltaNanos{100};
+  record.sequence = sequence_++;
+}
+
+void CorpusGenerator::Fill(Mbp1Msg& record) {
+  record.price = NextPrice();
+  record.size = NextSize();
+  record.action = Action::Modify;
+  record.side = rng_() % 2 == 0 ? Side::Bid : Side::Ask;
+  record.depth = 0;
+  record.ts_recv = record.hd.ts_event;
+  record.ts_in_delta = TimeDeltaNanos{100};
+  record.sequence = sequence_++;
+  record.levels[0] =
+      BidAskPair{record.price - kTickSize, record.price + kTickSize,
+                 NextSize(), NextSize(), 1, 1};
+}
+
+void CorpusGenerator::Fill(Mbp10Msg& record) {
+  record.price = NextPrice();
+  record.size = NextSize();
+  record.action = Action::Modify;
+  record.side = rng_() % 2 == 0 ? Side::Bid : Side::Ask;
+  record.depth = static_cast<std::uint8_t>(rng_() % 10);
+  record.ts_recv = record.hd.ts_event;
+  record.ts_in_delta = TimeDeltaNanos{100};
+  record.sequence = sequence_++;
+  for (std::size_t level = 0; level < record.levels.size(); ++level) {
+    const auto offset = static_cast<std::int64_t>(level + 1) * kTickSize;
+    record.levels[level] =
+        BidAskPair{record.price - offset, record.price + offset, NextSize(),
+                   NextSize(), 1, 1};
+  }
+}
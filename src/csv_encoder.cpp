@@ -0,0 +1,275 @@
+#include "databento/csv_encoder.hpp"
+
+#include <algorithm>  // max
+#include <cstdint>
+#include <cstring>  // memcpy
+#include <string>
+
+#include "databento/exceptions.hpp"   // InvalidArgumentError
+#include "databento/fixed_price.hpp"  // PxToChars, kFixPxMaxStrLen
+
+namespace {
+// Generous bound on the widest row (Mbp10Msg with pretty prices and
+// timestamps is below 2 KiB)
+constexpr std::size_t kMaxRowLen = 4096;
+
+constexpr const char* kMboHeader =
+    "ts_recv,ts_event,rtype,publisher_id,instrument_id,action,side,price,"
+    "size,channel_id,order_id,flags,ts_in_delta,sequence";
+constexpr const char* kTradesHeader =
+    "ts_recv,ts_event,rtype,publisher_id,instrument_id,action,side,depth,"
+    "price,size,flags,ts_in_delta,sequence";
+constexpr const char* kOhlcvHeader =
+    "ts_event,rtype,publisher_id,instrument_id,open,high,low,close,volume";
+
+char* WriteUnsigned(char* pos, std::uint64_t value) {
+  char digits[20];
+  char* digit = digits;
+  do {
+    *digit++ = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value > 0);
+  while (digit != digits) {
+    *pos++ = *--digit;
+  }
+  return pos;
+}
+
+char* WriteSigned(char* pos, std::int64_t value) {
+  std::uint64_t abs_value;
+  if (value < 0) {
+    *pos++ = '-';
+    abs_value = 0 - static_cast<std::uint64_t>(value);
+  } else {
+    abs_value = static_cast<std::uint64_t>(value);
+  }
+  return WriteUnsigned(pos, abs_value);
+}
+
+char* WriteLiteral(char* pos, const char* literal) {
+  const auto length = std::strlen(literal);
+  std::memcpy(pos, literal, length);
+  return pos + length;
+}
+}  // namespace
+
+namespace databento {
+constexpr std::size_t CsvEncoder::kDefaultBufferSize;
+
+CsvEncoder::CsvEncoder(IWritable* output, bool pretty_px, bool pretty_ts)
+    : CsvEncoder{output, pretty_px, pretty_ts, kDefaultBufferSize} {}
+
+CsvEncoder::CsvEncoder(IWritable* output, bool pretty_px, bool pretty_ts,
+                       std::size_t buffer_size)
+    : output_{output},
+      pretty_px_{pretty_px},
+      pretty_ts_{pretty_ts},
+      buffer_(std::max(buffer_size, 2 * kMaxRowLen)) {}
+
+CsvEncoder::~CsvEncoder() { Flush(); }
+
+void CsvEncoder::WriteHeader(Schema schema) {
+  char* pos = RowStart();
+  switch (schema) {
+    case Schema::Mbo: {
+      pos = WriteLiteral(pos, kMboHeader);
+      break;
+    }
+    case Schema::Trades: {
+      pos = WriteLiteral(pos, kTradesHeader);
+      break;
+    }
+    case Schema::Mbp1:     // fallthrough
+    case Schema::Tbbo:     // fallthrough
+    case Schema::Mbp10: {
+      pos = WriteLiteral(pos, kTradesHeader);
+      const std::size_t levels = schema == Schema::Mbp10 ? 10 : 1;
+      for (std::size_t level = 0; level < levels; ++level) {
+        for (const char* column :
+             {"bid_px_", "ask_px_", "bid_sz_", "ask_sz_", "bid_ct_",
+              "ask_ct_"}) {
+          *pos++ = ',';
+          pos = WriteLiteral(pos, column);
+          *pos++ = static_cast<char>('0' + level / 10);
+          *pos++ = static_cast<char>('0' + level % 10);
+        }
+      }
+      break;
+    }
+    case Schema::Ohlcv1S:  // fallthrough
+    case Schema::Ohlcv1M:  // fallthrough
+    case Schema::Ohlcv1H:  // fallthrough
+    case Schema::Ohlcv1D: {
+      pos = WriteLiteral(pos, kOhlcvHeader);
+      break;
+    }
+    default: {
+      throw InvalidArgumentError{
+          "CsvEncoder::WriteHeader", "schema",
+          std::string{"no CSV support for "} + ToString(schema)};
+    }
+  }
+  FinishRow(pos);
+}
+
+void CsvEncoder::EncodeRecord(const Record& record) {
+  if (record.Holds<MboMsg>()) {
+    EncodeRecord(record.Get<MboMsg>());
+  } else if (record.Holds<TradeMsg>()) {
+    EncodeRecord(record.Get<TradeMsg>());
+  } else if (record.Holds<Mbp1Msg>()) {
+    EncodeRecord(record.Get<Mbp1Msg>());
+  } else if (record.Holds<Mbp10Msg>()) {
+    EncodeRecord(record.Get<Mbp10Msg>());
+  } else if (record.Holds<OhlcvMsg>()) {
+    EncodeRecord(record.Get<OhlcvMsg>());
+  } else {
+    throw InvalidArgumentError{
+        "CsvEncoder::EncodeRecord", "record",
+        std::string{"no CSV support for rtype "} + ToString(record.RType())};
+  }
+}
+
+void CsvEncoder::EncodeRecord(const MboMsg& record) {
+  char* pos = RowStart();
+  pos = WriteTs(pos, record.ts_recv);
+  *pos++ = ',';
+  pos = WriteTs(pos, record.hd.ts_event);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, static_cast<std::uint8_t>(record.hd.rtype));
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.hd.publisher_id);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.hd.instrument_id);
+  *pos++ = ',';
+  *pos++ = static_cast<char>(record.action);
+  *pos++ = ',';
+  *pos++ = static_cast<char>(record.side);
+  *pos++ = ',';
+  pos = WritePx(pos, record.price);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.size);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.channel_id);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.order_id);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, static_cast<std::uint8_t>(record.flags));
+  *pos++ = ',';
+  pos = WriteSigned(pos, record.ts_in_delta.count());
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.sequence);
+  FinishRow(pos);
+}
+
+void CsvEncoder::EncodeRecord(const TradeMsg& record) {
+  // TradeMsg is layout-identical to an MbpMsg body with no levels
+  EncodeMbp(reinterpret_cast<const detail::MbpMsg<0>&>(record));
+}
+
+void CsvEncoder::EncodeRecord(const Mbp1Msg& record) { EncodeMbp(record); }
+
+void CsvEncoder::EncodeRecord(const Mbp10Msg& record) { EncodeMbp(record); }
+
+template <std::size_t N>
+void CsvEncoder::EncodeMbp(const detail::MbpMsg<N>& record) {
+  char* pos = RowStart();
+  pos = WriteTs(pos, record.ts_recv);
+  *pos++ = ',';
+  pos = WriteTs(pos, record.hd.ts_event);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, static_cast<std::uint8_t>(record.hd.rtype));
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.hd.publisher_id);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.hd.instrument_id);
+  *pos++ = ',';
+  *pos++ = static_cast<char>(record.action);
+  *pos++ = ',';
+  *pos++ = static_cast<char>(record.side);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.depth);
+  *pos++ = ',';
+  pos = WritePx(pos, record.price);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.size);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, static_cast<std::uint8_t>(record.flags));
+  *pos++ = ',';
+  pos = WriteSigned(pos, record.ts_in_delta.count());
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.sequence);
+  for (std::size_t level = 0; level < N; ++level) {
+    const BidAskPair& pair = record.levels[level];
+    *pos++ = ',';
+    pos = WritePx(pos, pair.bid_px);
+    *pos++ = ',';
+    pos = WritePx(pos, pair.ask_px);
+    *pos++ = ',';
+    pos = WriteUnsigned(pos, pair.bid_sz);
+    *pos++ = ',';
+    pos = WriteUnsigned(pos, pair.ask_sz);
+    *pos++ = ',';
+    pos = WriteUnsigned(pos, pair.bid_ct);
+    *pos++ = ',';
+    pos = WriteUnsigned(pos, pair.ask_ct);
+  }
+  FinishRow(pos);
+}
+
+void CsvEncoder::EncodeRecord(const OhlcvMsg& record) {
+  char* pos = RowStart();
+  pos = WriteTs(pos, record.hd.ts_event);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, static_cast<std::uint8_t>(record.hd.rtype));
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.hd.publisher_id);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.hd.instrument_id);
+  *pos++ = ',';
+  pos = WritePx(pos, record.open);
+  *pos++ = ',';
+  pos = WritePx(pos, record.high);
+  *pos++ = ',';
+  pos = WritePx(pos, record.low);
+  *pos++ = ',';
+  pos = WritePx(pos, record.close);
+  *pos++ = ',';
+  pos = WriteUnsigned(pos, record.volume);
+  FinishRow(pos);
+}
+
+void CsvEncoder::Flush() {
+  if (length_ > 0) {
+    output_->WriteAll(reinterpret_cast<const std::uint8_t*>(buffer_.data()),
+                      length_);
+    length_ = 0;
+  }
+}
+
+char* CsvEncoder::RowStart() {
+  if (buffer_.size() - length_ < kMaxRowLen) {
+    Flush();
+  }
+  return buffer_.data() + length_;
+}
+
+void CsvEncoder::FinishRow(char* pos) {
+  *pos++ = '\n';
+  length_ = static_cast<std::size_t>(pos - buffer_.data());
+}
+
+char* CsvEncoder::WritePx(char* pos, std::int64_t px) const {
+  if (pretty_px_) {
+    return PxToChars(px, pos, pos + kFixPxMaxStrLen);
+  }
+  return WriteSigned(pos, px);
+}
+
+char* CsvEncoder::WriteTs(char* pos, UnixNanos ts) const {
+  if (pretty_ts_) {
+    return ToIso8601Chars(ts, pos, pos + kIso8601MaxStrLen);
+  }
+  return WriteUnsigned(pos, ts.time_since_epoch().count());
+}
+}  // namespace databento
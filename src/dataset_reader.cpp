@@ -0,0 +1,150 @@
+#include "databento/dataset_reader.hpp"
+
+#include <dirent.h>    // closedir, opendir, readdir
+#include <sys/stat.h>  // stat
+
+#include <algorithm>  // max, sort
+#include <future>     // future
+#include <memory>     // unique_ptr
+#include <sstream>
+#include <thread>  // hardware_concurrency
+
+#include "databento/dbn.hpp"  // Metadata
+#include "databento/dbn_file_store.hpp"
+#include "databento/detail/request_thread_pool.hpp"
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+#include "databento/multi_file_replay.hpp"
+
+using databento::DatasetReader;
+
+namespace {
+bool HasDbnExtension(const std::string& file_name) {
+  static const std::string kDbnSuffix = ".dbn";
+  static const std::string kDbnZstSuffix = ".dbn.zst";
+  const auto ends_with = [&file_name](const std::string& suffix) {
+    return file_name.length() >= suffix.length() &&
+           file_name.compare(file_name.length() - suffix.length(),
+                             suffix.length(), suffix) == 0;
+  };
+  return ends_with(kDbnSuffix) || ends_with(kDbnZstSuffix);
+}
+
+std::string PathJoin(const std::string& dir, const std::string& path) {
+  if (dir.empty() || dir[dir.length() - 1] == '/') {
+    return dir + path;
+  }
+  return dir + '/' + path;
+}
+}  // namespace
+
+DatasetReader::DatasetReader(const std::string& root_dir)
+    : DatasetReader{root_dir, VersionUpgradePolicy::Upgrade,
+                    std::thread::hardware_concurrency()} {}
+
+DatasetReader::DatasetReader(const std::string& root_dir,
+                             VersionUpgradePolicy upgrade_policy,
+                             std::size_t thread_count)
+    : upgrade_policy_{upgrade_policy},
+      thread_count_{std::max<std::size_t>(thread_count, 1)} {
+  DiscoverFiles(root_dir, &file_paths_);
+  if (file_paths_.empty()) {
+    throw InvalidArgumentError{"DatasetReader", "root_dir",
+                               "No DBN files found under " + root_dir};
+  }
+  std::sort(file_paths_.begin(), file_paths_.end());
+  ValidateMetadata();
+}
+
+void DatasetReader::ReplayConcatenated(
+    const MetadataCallback& metadata_callback,
+    const RecordCallback& record_callback) {
+  for (const auto& file_path : file_paths_) {
+    DbnFileStore store{file_path, upgrade_policy_};
+    bool should_continue = true;
+    store.Replay(metadata_callback,
+                 [&record_callback, &should_continue](const Record& record) {
+                   const auto res = record_callback(record);
+                   should_continue = res == KeepGoing::Continue;
+                   return res;
+                 });
+    if (!should_continue) {
+      return;
+    }
+  }
+}
+
+void DatasetReader::ReplayConcatenated(const RecordCallback& record_callback) {
+  ReplayConcatenated([](Metadata&&) {}, record_callback);
+}
+
+void DatasetReader::ReplayMerged(const MetadataCallback& metadata_callback,
+                                 const RecordCallback& record_callback) {
+  MultiFileReplay replay{file_paths_, upgrade_policy_, thread_count_};
+  replay.Replay(metadata_callback, record_callback);
+}
+
+void DatasetReader::ReplayMerged(const RecordCallback& record_callback) {
+  ReplayMerged([](Metadata&&) {}, record_callback);
+}
+
+void DatasetReader::DiscoverFiles(const std::string& dir,
+                                  std::vector<std::string>* file_paths) {
+  const std::unique_ptr<DIR, int (*)(DIR*)> dir_handle{
+      ::opendir(dir.c_str()), &::closedir};
+  if (dir_handle == nullptr) {
+    throw InvalidArgumentError{"DatasetReader", "root_dir",
+                               "Non-existent or unreadable directory " + dir};
+  }
+  while (const dirent* entry = ::readdir(dir_handle.get())) {
+    const std::string name = entry->d_name;
+    if (name == "." || name == "..") {
+      continue;
+    }
+    const auto path = ::PathJoin(dir, name);
+    struct stat entry_stat;
+    if (::stat(path.c_str(), &entry_stat) != 0) {
+      continue;
+    }
+    if (S_ISDIR(entry_stat.st_mode)) {
+      DiscoverFiles(path, file_paths);
+    } else if (HasDbnExtension(name)) {
+      file_paths->emplace_back(path);
+    }
+  }
+}
+
+void DatasetReader::ValidateMetadata() const {
+  detail::RequestThreadPool pool{thread_count_};
+  std::vector<std::future<Metadata>> futures;
+  futures.reserve(file_paths_.size());
+  for (const auto& file_path : file_paths_) {
+    const auto upgrade_policy = upgrade_policy_;
+    futures.emplace_back(pool.Submit([file_path, upgrade_policy]() {
+      DbnFileStore store{file_path, upgrade_policy};
+      return store.GetMetadata();
+    }));
+  }
+  Metadata first{};
+  for (std::size_t i = 0; i < futures.size(); ++i) {
+    const auto metadata = futures[i].get();
+    if (i == 0) {
+      first = metadata;
+      continue;
+    }
+    std::ostringstream err_msg;
+    if (metadata.dataset != first.dataset) {
+      err_msg << "Mismatched dataset in " << file_paths_[i] << ": expected "
+              << first.dataset << ", found " << metadata.dataset;
+    } else if (!metadata.has_mixed_schema && !first.has_mixed_schema &&
+               metadata.schema != first.schema) {
+      err_msg << "Mismatched schema in " << file_paths_[i] << ": expected "
+              << ToString(first.schema) << ", found "
+              << ToString(metadata.schema);
+    } else if (metadata.ts_out != first.ts_out) {
+      err_msg << "Mismatched ts_out in " << file_paths_[i];
+    } else {
+      continue;
+    }
+    throw InvalidArgumentError{"DatasetReader", "root_dir", err_msg.str()};
+  }
+}
@@ -1,47 +1,193 @@
 #include "databento/datetime.hpp"
 
-// NOLINTNEXTLINE(modernize-deprecated-headers): no thread-safe version in STL
-#include <time.h>  // gmtime_r or gmtime_s
+#include <cstddef>
+#include <cstring>  // memcpy
 
-#include <array>
-#include <chrono>
-#include <ctime>    // localtime, strftime, tm
-#include <iomanip>  // setw
-#include <sstream>  // ostringstream
+#include "databento/constants.hpp"   // kUndefTimestamp
+#include "databento/exceptions.hpp"  // InvalidArgumentError
 
-#include "databento/constants.hpp"  // kUndefTimestamp
+namespace {
+constexpr std::int64_t kNanosPerSec = 1000000000;
+constexpr std::int64_t kSecsPerDay = 86400;
+// Days per month for a non-leap year
+constexpr std::uint32_t kDaysInMonth[12] = {31, 28, 31, 30, 31, 30,
+                                            31, 31, 30, 31, 30, 31};
+
+bool IsLeapYear(std::uint32_t year) {
+  return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+}
+
+// Gregorian date from days since the UNIX epoch, using the era-based civil
+// calendar algorithm (Howard Hinnant's chrono-compatible date algorithms):
+// pure integer math with no locale, locks, or table walks.
+void CivilFromDays(std::int64_t days, std::uint32_t* year, std::uint32_t* month,
+                   std::uint32_t* day) {
+  days += 719468;
+  const std::int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  const auto doe = static_cast<std::uint32_t>(days - era * 146097);
+  const std::uint32_t yoe =
+      (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const std::int64_t y = static_cast<std::int64_t>(yoe) + era * 400;
+  const std::uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const std::uint32_t mp = (5 * doy + 2) / 153;
+  *day = doy - (153 * mp + 2) / 5 + 1;
+  *month = mp < 10 ? mp + 3 : mp - 9;
+  *year = static_cast<std::uint32_t>(y + (*month <= 2));
+}
+
+// The inverse of CivilFromDays.
+std::int64_t DaysFromCivil(std::uint32_t year, std::uint32_t month,
+                           std::uint32_t day) {
+  const std::int64_t y = static_cast<std::int64_t>(year) - (month <= 2);
+  const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+  const auto yoe = static_cast<std::uint32_t>(y - era * 400);
+  const std::uint32_t doy =
+      (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const std::uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + static_cast<std::int64_t>(doe) - 719468;
+}
+
+// Writes value as exactly width decimal digits, zero-padded, returning a
+// pointer past the last digit.
+char* WriteUint(char* pos, std::uint64_t value, std::size_t width) {
+  for (std::size_t i = width; i > 0; --i) {
+    pos[i - 1] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+  return pos + width;
+}
+
+// Parses exactly width decimal digits, returning false on a non-digit.
+bool ParseUint(const char* pos, std::size_t width, std::uint32_t* value) {
+  std::uint32_t res = 0;
+  for (std::size_t i = 0; i < width; ++i) {
+    if (pos[i] < '0' || pos[i] > '9') {
+      return false;
+    }
+    res = res * 10 + static_cast<std::uint32_t>(pos[i] - '0');
+  }
+  *value = res;
+  return true;
+}
+}  // namespace
 
 namespace databento {
+char* ToIso8601Chars(UnixNanos unix_nanos, char* first, char* last) {
+  const std::uint64_t raw = unix_nanos.time_since_epoch().count();
+  if (raw == kUndefTimestamp) {
+    constexpr char kUndefStr[] = "UNDEF_TIMESTAMP";
+    constexpr std::size_t kUndefLen = sizeof(kUndefStr) - 1;
+    if (static_cast<std::size_t>(last - first) < kUndefLen) {
+      return nullptr;
+    }
+    std::memcpy(first, kUndefStr, kUndefLen);
+    return first + kUndefLen;
+  }
+  if (static_cast<std::size_t>(last - first) < kIso8601MaxStrLen) {
+    return nullptr;
+  }
+  const std::uint64_t secs = raw / kNanosPerSec;
+  const std::uint64_t nanos = raw % kNanosPerSec;
+  const auto days = static_cast<std::int64_t>(secs / kSecsPerDay);
+  const std::uint64_t secs_of_day = secs % kSecsPerDay;
+  std::uint32_t year;
+  std::uint32_t month;
+  std::uint32_t day;
+  CivilFromDays(days, &year, &month, &day);
+  char* pos = WriteUint(first, year, 4);
+  *pos++ = '-';
+  pos = WriteUint(pos, month, 2);
+  *pos++ = '-';
+  pos = WriteUint(pos, day, 2);
+  *pos++ = 'T';
+  pos = WriteUint(pos, secs_of_day / 3600, 2);
+  *pos++ = ':';
+  pos = WriteUint(pos, secs_of_day / 60 % 60, 2);
+  *pos++ = ':';
+  pos = WriteUint(pos, secs_of_day % 60, 2);
+  *pos++ = '.';
+  pos = WriteUint(pos, nanos, 9);
+  *pos++ = 'Z';
+  return pos;
+}
+
 std::string ToIso8601(UnixNanos unix_nanos) {
-  if (unix_nanos.time_since_epoch().count() == kUndefTimestamp) {
-    return "UNDEF_TIMESTAMP";
+  char buf[kIso8601MaxStrLen];
+  return std::string(buf, ToIso8601Chars(unix_nanos, buf, buf + sizeof buf));
+}
+
+UnixNanos FromIso8601(const std::string& str) {
+  static const std::string kMethod = "FromIso8601";
+  const char* pos = str.c_str();
+  const char* const end = pos + str.size();
+  std::uint32_t year;
+  std::uint32_t month;
+  std::uint32_t day;
+  if (end - pos < 10 || !ParseUint(pos, 4, &year) || pos[4] != '-' ||
+      !ParseUint(pos + 5, 2, &month) || pos[7] != '-' ||
+      !ParseUint(pos + 8, 2, &day)) {
+    throw InvalidArgumentError{
+        kMethod, "str", "Expected date of the format YYYY-MM-DD, got " + str};
+  }
+  const bool leap_day = month == 2 && day == 29 && IsLeapYear(year);
+  if (month < 1 || month > 12 || day < 1 ||
+      (day > kDaysInMonth[month - 1] && !leap_day)) {
+    throw InvalidArgumentError{kMethod, "str", "Invalid date " + str};
   }
-  std::array<char, 80> buf{};
-  const auto time =
-      static_cast<std::time_t>(std::chrono::duration_cast<std::chrono::seconds>(
-                                   unix_nanos.time_since_epoch())
-                                   .count());
-  std::tm tm = {};
-#ifdef _WIN32
-  if (::gmtime_s(&tm, &time) != 0) {
-    // Fallback on printing nanos
-    return ToString(unix_nanos);
+  pos += 10;
+  std::uint64_t secs_of_day = 0;
+  std::uint64_t nanos = 0;
+  if (pos != end) {
+    std::uint32_t hour;
+    std::uint32_t minute;
+    std::uint32_t sec;
+    if ((*pos != 'T' && *pos != ' ') || end - pos < 9 ||
+        !ParseUint(pos + 1, 2, &hour) || pos[3] != ':' ||
+        !ParseUint(pos + 4, 2, &minute) || pos[6] != ':' ||
+        !ParseUint(pos + 7, 2, &sec) || hour > 23 || minute > 59 ||
+        sec > 59) {
+      throw InvalidArgumentError{
+          kMethod, "str", "Expected time of the format HH:MM:SS in " + str};
+    }
+    secs_of_day = hour * 3600 + minute * 60 + sec;
+    pos += 9;
+    if (pos != end && *pos == '.') {
+      ++pos;
+      std::size_t digits = 0;
+      while (pos != end && *pos >= '0' && *pos <= '9' && digits < 9) {
+        nanos = nanos * 10 + static_cast<std::uint64_t>(*pos - '0');
+        ++pos;
+        ++digits;
+      }
+      if (digits == 0) {
+        throw InvalidArgumentError{
+            kMethod, "str", "Expected fractional seconds after '.' in " + str};
+      }
+      // Right-pad to nanosecond precision
+      for (; digits < 9; ++digits) {
+        nanos *= 10;
+      }
+    }
+    if (pos != end && *pos == 'Z') {
+      ++pos;
+    }
+    if (pos != end) {
+      throw InvalidArgumentError{
+          kMethod, "str", "Unexpected trailing characters in " + str};
+    }
   }
-#else
-  if (::gmtime_r(&time, &tm) == nullptr) {
-    // Fallback on printing nanos
-    return ToString(unix_nanos);
+  const std::int64_t days = DaysFromCivil(year, month, day);
+  if (days < 0) {
+    throw InvalidArgumentError{kMethod, "str",
+                               "Dates before the UNIX epoch aren't "
+                               "representable as UnixNanos: " +
+                                   str};
   }
-#endif
-  const auto nanos = std::chrono::nanoseconds{
-      unix_nanos.time_since_epoch() %
-      std::chrono::nanoseconds{std::chrono::seconds{1}}};
-  const size_t count =
-      std::strftime(buf.data(), sizeof(buf), "%Y-%m-%dT%H:%M:%S", &tm);
-  std::ostringstream time_ss;
-  time_ss.write(buf.data(), static_cast<std::streamsize>(count));
-  time_ss << '.' << std::setw(9) << std::setfill('0') << nanos.count() << 'Z';
-  return time_ss.str();
+  const std::uint64_t raw =
+      (static_cast<std::uint64_t>(days) * kSecsPerDay + secs_of_day) *
+          kNanosPerSec +
+      nanos;
+  return UnixNanos{std::chrono::duration<std::uint64_t, std::nano>{raw}};
 }
 
 std::string ToString(UnixNanos unix_nanos) {
@@ -57,9 +203,14 @@ std::string DateFromIso8601Int(std::uint32_t date_int) {
   const auto remaining = date_int % 10000;
   const auto month = remaining / 100;
   const auto day = remaining % 100;
-  std::ostringstream out_ss;
-  out_ss << year << '-' << std::setfill('0') << std::setw(2) << month << '-'
-         << std::setfill('0') << std::setw(2) << day;
-  return out_ss.str();
+  std::string res = std::to_string(year);
+  res.reserve(res.size() + 6);
+  res.push_back('-');
+  res.push_back(static_cast<char>('0' + month / 10));
+  res.push_back(static_cast<char>('0' + month % 10));
+  res.push_back('-');
+  res.push_back(static_cast<char>('0' + day / 10));
+  res.push_back(static_cast<char>('0' + day % 10));
+  return res;
 }
 }  // namespace databento
@@ -1,6 +1,7 @@
 #include "databento/dbn.hpp"
 
 #include <array>
+#include <cstring>  // strlen
 #include <sstream>  // ostringstream
 #include <utility>  // pair
 
@@ -28,7 +29,7 @@ std::ostream& operator<<(std::ostream& stream, const Metadata& metadata) {
 
   // format symbols, partial, and not_found
   constexpr auto kVecCount = 3;
-  constexpr std::array<std::vector<std::string> Metadata::*, kVecCount>
+  constexpr std::array<std::vector<SymbolString> Metadata::*, kVecCount>
       kStrVecs{&Metadata::symbols, &Metadata::partial, &Metadata::not_found};
   constexpr std::array<char const*, kVecCount> kStrVecNames{
       "symbols", "partial", "not_found"};
@@ -74,6 +75,81 @@ std::ostream& operator<<(std::ostream& stream, const SymbolMapping& mapping) {
       .Finish();
 }
 
+SharedMetadata ShareMetadata(ArenaMetadata&& metadata) {
+  return std::make_shared<const ArenaMetadata>(std::move(metadata));
+}
+
+SharedMetadata ShareMetadata(const Metadata& metadata) {
+  ArenaMetadata res;
+  res.version = metadata.version;
+  res.dataset = metadata.dataset;
+  res.has_mixed_schema = metadata.has_mixed_schema;
+  res.schema = metadata.schema;
+  res.start = metadata.start;
+  res.end = metadata.end;
+  res.limit = metadata.limit;
+  res.has_mixed_stype_in = metadata.has_mixed_stype_in;
+  res.stype_in = metadata.stype_in;
+  res.stype_out = metadata.stype_out;
+  res.ts_out = metadata.ts_out;
+  res.symbol_cstr_len = metadata.symbol_cstr_len;
+  // Reserve the exact arena size up front so pointers taken while filling
+  // remain stable.
+  std::size_t arena_size = 0;
+  for (const auto& symbol : metadata.symbols) {
+    arena_size += std::strlen(symbol.c_str()) + 1;
+  }
+  for (const auto& symbol : metadata.partial) {
+    arena_size += std::strlen(symbol.c_str()) + 1;
+  }
+  for (const auto& symbol : metadata.not_found) {
+    arena_size += std::strlen(symbol.c_str()) + 1;
+  }
+  for (const auto& mapping : metadata.mappings) {
+    arena_size += std::strlen(mapping.raw_symbol.c_str()) + 1;
+    for (const auto& interval : mapping.intervals) {
+      arena_size += std::strlen(interval.symbol.c_str()) + 1;
+    }
+  }
+  auto arena = std::make_shared<std::vector<std::uint8_t>>();
+  arena->reserve(arena_size);
+  const auto append = [&arena](const char* str) -> const char* {
+    const auto offset = arena->size();
+    const auto* begin = reinterpret_cast<const std::uint8_t*>(str);
+    arena->insert(arena->end(), begin, begin + std::strlen(str) + 1);
+    return reinterpret_cast<const char*>(arena->data()) + offset;
+  };
+  res.symbols.reserve(metadata.symbols.size());
+  for (const auto& symbol : metadata.symbols) {
+    res.symbols.emplace_back(append(symbol.c_str()));
+  }
+  res.partial.reserve(metadata.partial.size());
+  for (const auto& symbol : metadata.partial) {
+    res.partial.emplace_back(append(symbol.c_str()));
+  }
+  res.not_found.reserve(metadata.not_found.size());
+  for (const auto& symbol : metadata.not_found) {
+    res.not_found.emplace_back(append(symbol.c_str()));
+  }
+  res.mappings.reserve(metadata.mappings.size());
+  for (const auto& mapping : metadata.mappings) {
+    ArenaSymbolMapping arena_mapping;
+    arena_mapping.raw_symbol = append(mapping.raw_symbol.c_str());
+    arena_mapping.interval_begin =
+        static_cast<std::uint32_t>(res.intervals.size());
+    arena_mapping.interval_count =
+        static_cast<std::uint32_t>(mapping.intervals.size());
+    for (const auto& interval : mapping.intervals) {
+      res.intervals.emplace_back(
+          ArenaMappingInterval{interval.start_date, interval.end_date,
+                               append(interval.symbol.c_str())});
+    }
+    res.mappings.emplace_back(arena_mapping);
+  }
+  res.arena = std::move(arena);
+  return std::make_shared<const ArenaMetadata>(std::move(res));
+}
+
 std::string ToString(const MappingInterval& interval) {
   return MakeString(interval);
 }
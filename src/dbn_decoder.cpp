@@ -2,13 +2,17 @@
 
 #include <algorithm>  // copy
 #include <cstddef>
-#include <cstring>  // strncmp
+#include <cstring>  // memcmp, memcpy, strncmp
 #include <limits>
 #include <vector>
 
 #include "databento/compat.hpp"
 #include "databento/constants.hpp"
 #include "databento/datetime.hpp"
+#include "databento/detail/buffer_pool.hpp"
+#include "databento/detail/lz4_stream.hpp"
+#include "databento/detail/prefetch_stream.hpp"
+#include "databento/detail/trace.hpp"
 #include "databento/detail/zstd_stream.hpp"
 #include "databento/enums.hpp"
 #include "databento/exceptions.hpp"
@@ -16,10 +20,35 @@
 #include "databento/with_ts_out.hpp"
 
 using databento::DbnDecoder;
+using databento::RecordFilter;
+
+void RecordFilter::SetInstrumentIds(std::vector<std::uint32_t> instrument_ids) {
+  has_instrument_ids_ = true;
+  instrument_ids_ =
+      std::unordered_set<std::uint32_t>{instrument_ids.begin(),
+                                        instrument_ids.end()};
+}
+
+void RecordFilter::SetRTypes(const std::vector<RType>& rtypes) {
+  has_rtypes_ = true;
+  rtype_mask_.fill(false);
+  for (const auto rtype : rtypes) {
+    rtype_mask_[static_cast<std::uint8_t>(rtype)] = true;
+  }
+}
+
+void RecordFilter::SetPublishers(const std::vector<Publisher>& publishers) {
+  has_publishers_ = true;
+  publisher_ids_.clear();
+  for (const auto publisher : publishers) {
+    publisher_ids_.insert(static_cast<std::uint16_t>(publisher));
+  }
+}
 
 namespace {
 constexpr std::size_t kMagicSize = 4;
 constexpr std::uint32_t kZstdMagicNumber = 0xFD2FB528;
+constexpr std::uint32_t kLz4MagicNumber = 0x184D2204;
 constexpr auto kDbnPrefix = "DBN";
 constexpr std::size_t kFixedMetadataLen = 100;
 constexpr std::size_t kDatasetCstrLen = 16;
@@ -59,11 +88,125 @@ std::string Consume(std::vector<std::uint8_t>::const_iterator& byte_it,
   }
   return std::string{cstr, str_len};
 }
+
+// Decodes the fixed metadata fields shared by Metadata and ArenaMetadata, up
+// to and including the schema definition length.
+template <typename M>
+void ConsumeMetadataPrefix(
+    M* res, std::uint8_t version,
+    std::vector<std::uint8_t>::const_iterator& read_buffer_it) {
+  res->version = version;
+  if (res->version > databento::kDbnVersion) {
+    throw databento::DbnResponseError{
+        "Can't decode newer version of DBN. Decoder version is " +
+        std::to_string(databento::kDbnVersion) + ", input version is " +
+        std::to_string(res->version)};
+  }
+  res->dataset = Consume(read_buffer_it, kDatasetCstrLen, "dataset");
+  const auto raw_schema = Consume<std::uint16_t>(read_buffer_it);
+  if (raw_schema == std::numeric_limits<std::uint16_t>::max()) {
+    res->has_mixed_schema = true;
+    // must initialize
+    res->schema = databento::Schema::Mbo;
+  } else {
+    res->has_mixed_schema = false;
+    res->schema = static_cast<databento::Schema>(raw_schema);
+  }
+  res->start = databento::UnixNanos{
+      std::chrono::nanoseconds{Consume<std::uint64_t>(read_buffer_it)}};
+  res->end = databento::UnixNanos{
+      std::chrono::nanoseconds{Consume<std::uint64_t>(read_buffer_it)}};
+  res->limit = Consume<std::uint64_t>(read_buffer_it);
+  if (version == 1) {
+    // skip deprecated record_count
+    read_buffer_it += 8;
+  }
+  const auto raw_stype_in = Consume<std::uint8_t>(read_buffer_it);
+  if (raw_stype_in == std::numeric_limits<std::uint8_t>::max()) {
+    res->has_mixed_stype_in = true;
+    // must initialize
+    res->stype_in = databento::SType::InstrumentId;
+  } else {
+    res->has_mixed_stype_in = false;
+    res->stype_in = static_cast<databento::SType>(raw_stype_in);
+  }
+  res->stype_out =
+      static_cast<databento::SType>(Consume<std::uint8_t>(read_buffer_it));
+  res->ts_out = static_cast<bool>(Consume<std::uint8_t>(read_buffer_it));
+  if (version > 1) {
+    res->symbol_cstr_len =
+        static_cast<std::size_t>(Consume<std::uint16_t>(read_buffer_it));
+  } else {
+    res->symbol_cstr_len = databento::kSymbolCstrLenV1;
+  }
+  // skip reserved
+  if (version == 1) {
+    read_buffer_it += ::kReservedLenV1;
+  } else {
+    read_buffer_it += ::kReservedLen;
+  }
+
+  const auto schema_definition_length = Consume<std::uint32_t>(read_buffer_it);
+  if (schema_definition_length != 0) {
+    throw databento::DbnResponseError{
+        "This version of dbn can't parse schema definitions"};
+  }
+}
+
+// Returns a pointer to the null-terminated symbol at the iterator without
+// copying it out of the buffer.
+const char* ConsumeSymbolRef(
+    std::size_t symbol_cstr_len,
+    std::vector<std::uint8_t>::const_iterator& read_buffer_it,
+    std::vector<std::uint8_t>::const_iterator read_buffer_end_it) {
+  if (read_buffer_it + static_cast<std::ptrdiff_t>(symbol_cstr_len) >
+      read_buffer_end_it) {
+    throw databento::DbnResponseError{
+        "Unexpected end of metadata buffer while parsing symbol"};
+  }
+  const auto* symbol = reinterpret_cast<const char*>(&*read_buffer_it);
+  if (std::find(symbol, symbol + symbol_cstr_len, '\0') ==
+      symbol + symbol_cstr_len) {
+    throw databento::DbnResponseError{
+        "Invalid symbol missing null terminator"};
+  }
+  read_buffer_it += static_cast<std::ptrdiff_t>(symbol_cstr_len);
+  return symbol;
+}
+
+std::vector<const char*> ConsumeRepeatedSymbolRef(
+    std::size_t symbol_cstr_len,
+    std::vector<std::uint8_t>::const_iterator& read_buffer_it,
+    std::vector<std::uint8_t>::const_iterator read_buffer_end_it) {
+  if (read_buffer_it + sizeof(std::uint32_t) > read_buffer_end_it) {
+    throw databento::DbnResponseError{
+        "Unexpected end of metadata buffer while parsing symbol"};
+  }
+  const auto count = std::size_t{Consume<std::uint32_t>(read_buffer_it)};
+  std::vector<const char*> res;
+  res.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    res.emplace_back(
+        ConsumeSymbolRef(symbol_cstr_len, read_buffer_it, read_buffer_end_it));
+  }
+  return res;
+}
 }  // namespace
 
 DbnDecoder::DbnDecoder(detail::SharedChannel channel)
     : DbnDecoder(std::unique_ptr<IReadable>{
-          new detail::SharedChannel{std::move(channel)}}) {}
+          new detail::SharedChannel{channel}}) {
+  // Keep a handle sharing the underlying ring for depth reporting in Stats
+  shared_channel_.reset(new detail::SharedChannel{std::move(channel)});
+}
+
+DbnDecoder::DbnDecoder(detail::BufferChannel channel)
+    : DbnDecoder(std::unique_ptr<IReadable>{
+          new detail::BufferChannel{std::move(channel)}}) {
+  if (!compressed_) {
+    buffer_channel_ = static_cast<detail::BufferChannel*>(input_.get());
+  }
+}
 
 DbnDecoder::DbnDecoder(detail::FileStream file_stream)
     : DbnDecoder(std::unique_ptr<IReadable>{
@@ -75,22 +218,70 @@ DbnDecoder::DbnDecoder(std::unique_ptr<IReadable> input)
 DbnDecoder::DbnDecoder(std::unique_ptr<IReadable> input,
                        VersionUpgradePolicy upgrade_policy)
     : input_{std::move(input)}, upgrade_policy_{upgrade_policy} {
-  read_buffer_.reserve(kBufferCapacity);
-  if (DetectCompression()) {
-    input_ = std::unique_ptr<detail::ZstdStream>(
-        new detail::ZstdStream(std::move(input_), std::move(read_buffer_)));
+  read_buffer_ = detail::BufferPool::Shared().Acquire(kBufferCapacity);
+  SetUpCompression();
+}
+
+DbnDecoder::~DbnDecoder() {
+  detail::BufferPool::Shared().Release(std::move(read_buffer_));
+  detail::BufferPool::Shared().Release(std::move(batch_compat_buffer_));
+}
+
+void DbnDecoder::SetUpCompression() {
+  const auto format = DetectCompression();
+  compressed_ = format != InputFormat::Dbn;
+  if (compressed_) {
+    if (format == InputFormat::Zstd) {
+      input_ = std::unique_ptr<detail::ZstdStream>(
+          new detail::ZstdStream(std::move(input_), std::move(read_buffer_)));
+    } else {
+      input_ = std::unique_ptr<detail::Lz4Stream>(
+          new detail::Lz4Stream(std::move(input_), std::move(read_buffer_)));
+    }
     // Reinitialize buffer and get it into the same state as uncompressed input
-    read_buffer_ = std::vector<std::uint8_t>();
-    read_buffer_.reserve(kBufferCapacity);
+    read_buffer_ = detail::BufferPool::Shared().Acquire(kBufferCapacity);
     read_buffer_.resize(kMagicSize);
     input_->ReadExact(read_buffer_.data(), kMagicSize);
     auto read_buffer_it = read_buffer_.cbegin();
     if (std::strncmp(Consume(read_buffer_it, 3), kDbnPrefix, 3) != 0) {
-      throw DbnResponseError{"Found Zstd input, but not DBN prefix"};
+      throw DbnResponseError{"Found compressed input, but not DBN prefix"};
     }
   }
 }
 
+void DbnDecoder::Reset(detail::BufferChannel channel) {
+  version_ = 0;
+  upgrade_table_ = nullptr;
+  ts_out_ = false;
+  chained_stream_count_ = 0;
+  buffer_channel_ = nullptr;
+  shared_channel_.reset();
+  // clear() retains the capacity reserved for earlier streams
+  read_buffer_.clear();
+  buffer_idx_ = 0;
+  pending_slice_.clear();
+  pending_idx_ = 0;
+  current_record_ = Record{nullptr};
+  record_batch_.clear();
+  batch_compat_buffer_.clear();
+  input_ = std::unique_ptr<IReadable>{
+      new detail::BufferChannel{std::move(channel)}};
+  SetUpCompression();
+  if (!compressed_) {
+    buffer_channel_ = static_cast<detail::BufferChannel*>(input_.get());
+  }
+}
+
+void DbnDecoder::EnablePrefetch() {
+  if (buffer_channel_ != nullptr) {
+    // A channel input is already fed by another thread; wrapping it in a
+    // prefetch stream would add a copy without adding parallelism
+    return;
+  }
+  input_ = std::unique_ptr<detail::PrefetchStream>(
+      new detail::PrefetchStream(std::move(input_)));
+}
+
 std::pair<std::uint8_t, std::size_t> DbnDecoder::DecodeMetadataVersionAndSize(
     const std::uint8_t* buffer, std::size_t size) {
   if (size < 8) {
@@ -111,62 +302,8 @@ std::pair<std::uint8_t, std::size_t> DbnDecoder::DecodeMetadataVersionAndSize(
 databento::Metadata DbnDecoder::DecodeMetadataFields(
     std::uint8_t version, const std::vector<std::uint8_t>& buffer) {
   Metadata res;
-  res.version = version;
-  if (res.version > kDbnVersion) {
-    throw DbnResponseError{
-        "Can't decode newer version of DBN. Decoder version is " +
-        std::to_string(kDbnVersion) + ", input version is " +
-        std::to_string(res.version)};
-  }
   auto read_buffer_it = buffer.cbegin();
-  res.dataset = Consume(read_buffer_it, kDatasetCstrLen, "dataset");
-  const auto raw_schema = Consume<std::uint16_t>(read_buffer_it);
-  if (raw_schema == std::numeric_limits<std::uint16_t>::max()) {
-    res.has_mixed_schema = true;
-    // must initialize
-    res.schema = Schema::Mbo;
-  } else {
-    res.has_mixed_schema = false;
-    res.schema = static_cast<Schema>(raw_schema);
-  }
-  res.start = UnixNanos{
-      std::chrono::nanoseconds{Consume<std::uint64_t>(read_buffer_it)}};
-  res.end = UnixNanos{
-      std::chrono::nanoseconds{Consume<std::uint64_t>(read_buffer_it)}};
-  res.limit = Consume<std::uint64_t>(read_buffer_it);
-  if (version == 1) {
-    // skip deprecated record_count
-    read_buffer_it += 8;
-  }
-  const auto raw_stype_in = Consume<std::uint8_t>(read_buffer_it);
-  if (raw_stype_in == std::numeric_limits<std::uint8_t>::max()) {
-    res.has_mixed_stype_in = true;
-    // must initialize
-    res.stype_in = SType::InstrumentId;
-  } else {
-    res.has_mixed_stype_in = false;
-    res.stype_in = static_cast<SType>(raw_stype_in);
-  }
-  res.stype_out = static_cast<SType>(Consume<std::uint8_t>(read_buffer_it));
-  res.ts_out = static_cast<bool>(Consume<std::uint8_t>(read_buffer_it));
-  if (version > 1) {
-    res.symbol_cstr_len =
-        static_cast<std::size_t>(Consume<std::uint16_t>(read_buffer_it));
-  } else {
-    res.symbol_cstr_len = kSymbolCstrLenV1;
-  }
-  // skip reserved
-  if (version == 1) {
-    read_buffer_it += ::kReservedLenV1;
-  } else {
-    read_buffer_it += ::kReservedLen;
-  }
-
-  const auto schema_definition_length = Consume<std::uint32_t>(read_buffer_it);
-  if (schema_definition_length != 0) {
-    throw DbnResponseError{
-        "This version of dbn can't parse schema definitions"};
-  }
+  ConsumeMetadataPrefix(&res, version, read_buffer_it);
   res.symbols = DbnDecoder::DecodeRepeatedSymbol(res.symbol_cstr_len,
                                                  read_buffer_it, buffer.cend());
   res.partial = DbnDecoder::DecodeRepeatedSymbol(res.symbol_cstr_len,
@@ -179,6 +316,75 @@ databento::Metadata DbnDecoder::DecodeMetadataFields(
   return res;
 }
 
+databento::ArenaMetadata DbnDecoder::DecodeArenaMetadataFields(
+    std::uint8_t version,
+    std::shared_ptr<const std::vector<std::uint8_t>> buffer) {
+  ArenaMetadata res;
+  auto read_buffer_it = buffer->cbegin();
+  ConsumeMetadataPrefix(&res, version, read_buffer_it);
+  const auto read_buffer_end_it = buffer->cend();
+  res.symbols = ConsumeRepeatedSymbolRef(res.symbol_cstr_len, read_buffer_it,
+                                         read_buffer_end_it);
+  res.partial = ConsumeRepeatedSymbolRef(res.symbol_cstr_len, read_buffer_it,
+                                         read_buffer_end_it);
+  res.not_found = ConsumeRepeatedSymbolRef(res.symbol_cstr_len, read_buffer_it,
+                                           read_buffer_end_it);
+  if (read_buffer_it + sizeof(std::uint32_t) > read_buffer_end_it) {
+    throw DbnResponseError{
+        "Unexpected end of metadata buffer while parsing mappings"};
+  }
+  const auto mapping_count =
+      std::size_t{Consume<std::uint32_t>(read_buffer_it)};
+  res.mappings.reserve(mapping_count);
+  for (std::size_t i = 0; i < mapping_count; ++i) {
+    ArenaSymbolMapping mapping;
+    mapping.raw_symbol = ConsumeSymbolRef(res.symbol_cstr_len, read_buffer_it,
+                                          read_buffer_end_it);
+    if (read_buffer_it + sizeof(std::uint32_t) > read_buffer_end_it) {
+      throw DbnResponseError{
+          "Unexpected end of metadata buffer while parsing symbol mapping"};
+    }
+    mapping.interval_begin = static_cast<std::uint32_t>(res.intervals.size());
+    mapping.interval_count = Consume<std::uint32_t>(read_buffer_it);
+    for (std::uint32_t j = 0; j < mapping.interval_count; ++j) {
+      if (read_buffer_it + static_cast<std::ptrdiff_t>(
+                               2 * sizeof(std::uint32_t)) >
+          read_buffer_end_it) {
+        throw DbnResponseError{
+            "Symbol mapping interval_count doesn't match size of buffer"};
+      }
+      ArenaMappingInterval interval;
+      interval.start_date = Consume<std::uint32_t>(read_buffer_it);
+      interval.end_date = Consume<std::uint32_t>(read_buffer_it);
+      interval.symbol = ConsumeSymbolRef(res.symbol_cstr_len, read_buffer_it,
+                                         read_buffer_end_it);
+      res.intervals.emplace_back(interval);
+    }
+    res.mappings.emplace_back(mapping);
+  }
+  res.arena = std::move(buffer);
+  return res;
+}
+
+databento::ArenaMetadata DbnDecoder::DecodeArenaMetadata() {
+  // already read first 4 bytes detecting compression
+  read_buffer_.resize(8);
+  input_->ReadExact(&read_buffer_[4], 4);
+  const auto version_and_size =
+      DbnDecoder::DecodeMetadataVersionAndSize(read_buffer_.data(), 8);
+  version_ = version_and_size.first;
+  auto buffer =
+      std::make_shared<std::vector<std::uint8_t>>(version_and_size.second);
+  input_->ReadExact(buffer->data(), buffer->size());
+  read_buffer_.clear();
+  buffer_idx_ = 0;
+  auto metadata =
+      DbnDecoder::DecodeArenaMetadataFields(version_, std::move(buffer));
+  ts_out_ = metadata.ts_out;
+  ResolveUpgradeTable();
+  return metadata;
+}
+
 databento::Metadata DbnDecoder::DecodeMetadata() {
   // already read first 4 bytes detecting compression
   read_buffer_.resize(8);
@@ -191,9 +397,54 @@ databento::Metadata DbnDecoder::DecodeMetadata() {
   buffer_idx_ = read_buffer_.size();
   auto metadata = DbnDecoder::DecodeMetadataFields(version_, read_buffer_);
   ts_out_ = metadata.ts_out;
+  ResolveUpgradeTable();
   return metadata;
 }
 
+void DbnDecoder::ConsumeExact(std::uint8_t* dst, std::size_t size) {
+  std::size_t copied = 0;
+  while (copied < size) {
+    if (read_buffer_.size() == buffer_idx_ && FillBuffer() == 0) {
+      throw DbnResponseError{
+          "Unexpected end of input within chained stream metadata"};
+    }
+    const auto take =
+        std::min(size - copied, read_buffer_.size() - buffer_idx_);
+    std::memcpy(dst + copied, &read_buffer_[buffer_idx_], take);
+    buffer_idx_ += take;
+    copied += take;
+  }
+}
+
+bool DbnDecoder::AtChainedStreamBoundary() {
+  // The next stream's magic arrives inline in the byte stream, so it has to
+  // be recognized before its bytes could be framed as a record header
+  while (read_buffer_.size() - buffer_idx_ < 3) {
+    if (FillBuffer() == 0) {
+      return false;
+    }
+  }
+  return std::memcmp(&read_buffer_[buffer_idx_], kDbnPrefix, 3) == 0;
+}
+
+void DbnDecoder::ChainNextStream() {
+  std::array<std::uint8_t, 8> prelude;
+  ConsumeExact(prelude.data(), prelude.size());
+  const auto version_and_size =
+      DbnDecoder::DecodeMetadataVersionAndSize(prelude.data(), prelude.size());
+  version_ = version_and_size.first;
+  auto metadata_buffer =
+      detail::BufferPool::Shared().Acquire(version_and_size.second);
+  metadata_buffer.resize(version_and_size.second);
+  ConsumeExact(metadata_buffer.data(), metadata_buffer.size());
+  chained_metadata_ = DbnDecoder::DecodeMetadataFields(version_,
+                                                       metadata_buffer);
+  detail::BufferPool::Shared().Release(std::move(metadata_buffer));
+  ts_out_ = chained_metadata_.ts_out;
+  ResolveUpgradeTable();
+  ++chained_stream_count_;
+}
+
 namespace {
 template <typename T, typename U>
 databento::Record UpgradeRecord(
@@ -213,78 +464,309 @@ databento::Record UpgradeRecord(
   return databento::Record{
       reinterpret_cast<databento::RecordHeader*>(compat_buffer->data())};
 }
+
+databento::Record PassThroughRecord(
+    bool, std::array<std::uint8_t, databento::kMaxRecordLen>*,
+    databento::Record rec) {
+  return rec;
+}
 }  // namespace
 
+const std::array<DbnDecoder::CompatFn, 256>& DbnDecoder::UpgradeV1Table() {
+  static const std::array<CompatFn, 256> table = [] {
+    std::array<CompatFn, 256> res{};
+    res.fill(PassThroughRecord);
+    res[static_cast<std::uint8_t>(RType::InstrumentDef)] =
+        UpgradeRecord<InstrumentDefMsgV1, InstrumentDefMsgV2>;
+    res[static_cast<std::uint8_t>(RType::SymbolMapping)] =
+        UpgradeRecord<SymbolMappingMsgV1, SymbolMappingMsgV2>;
+    res[static_cast<std::uint8_t>(RType::Error)] =
+        UpgradeRecord<ErrorMsgV1, ErrorMsgV2>;
+    res[static_cast<std::uint8_t>(RType::System)] =
+        UpgradeRecord<SystemMsgV1, SystemMsgV2>;
+    return res;
+  }();
+  return table;
+}
+
 databento::Record DbnDecoder::DecodeRecordCompat(
     std::uint8_t version, VersionUpgradePolicy upgrade_policy, bool ts_out,
     std::array<std::uint8_t, kMaxRecordLen>* compat_buffer, Record rec) {
   if (version == 1 && upgrade_policy == VersionUpgradePolicy::Upgrade) {
-    if (rec.RType() == RType::InstrumentDef) {
-      return UpgradeRecord<InstrumentDefMsgV1, InstrumentDefMsgV2>(
-          ts_out, compat_buffer, rec);
-    } else if (rec.RType() == RType::SymbolMapping) {
-      return UpgradeRecord<SymbolMappingMsgV1, SymbolMappingMsgV2>(
-          ts_out, compat_buffer, rec);
-    } else if (rec.RType() == RType::Error) {
-      return UpgradeRecord<ErrorMsgV1, ErrorMsgV2>(ts_out, compat_buffer, rec);
-    } else if (rec.RType() == RType::System) {
-      return UpgradeRecord<SystemMsgV1, SystemMsgV2>(ts_out, compat_buffer,
-                                                     rec);
-    }
+    return UpgradeV1Table()[static_cast<std::uint8_t>(rec.RType())](
+        ts_out, compat_buffer, rec);
   }
   return rec;
 }
 
 // assumes ParseMetadata has been called
 const databento::Record* DbnDecoder::DecodeRecord() {
-  // need some unread unread_bytes
-  const auto unread_bytes = read_buffer_.size() - buffer_idx_;
-  if (unread_bytes == 0) {
-    if (FillBuffer() == 0) {
-      return nullptr;
+  while (true) {
+    // need some unread unread_bytes
+    const auto unread_bytes = read_buffer_.size() - buffer_idx_;
+    if (unread_bytes == 0) {
+      if (FillBuffer() == 0) {
+        return nullptr;
+      }
+    }
+    if (chain_streams_ && AtChainedStreamBoundary()) {
+      ChainNextStream();
+      continue;
+    }
+    // check length
+    while (read_buffer_.size() - buffer_idx_ < BufferRecordHeader()->Size()) {
+      if (FillBuffer() == 0) {
+        return nullptr;
+      }
+    }
+    RecordHeader* header = BufferRecordHeader();
+    buffer_idx_ += header->Size();
+    if (!filter_.Matches(*header)) {
+      // Skipped records only cost the header read
+      continue;
+    }
+    current_record_ = ApplyUpgrade(Record{header});
+    DATABENTO_TRACEPOINT2(record_decoded,
+                          static_cast<std::uint8_t>(header->rtype),
+                          header->Size());
+    stats_.AddRecords(1);
+    if (upgrade_table_ != nullptr) {
+      stats_.AddCompatUpgrades(1);
+    }
+    return &current_record_;
+  }
+}
+
+databento::DecodeStatus DbnDecoder::TryDecodeRecord(
+    const Record** record) noexcept {
+  *record = nullptr;
+  try {
+    const Record* res = DecodeRecord();
+    if (res == nullptr) {
+      return DecodeStatus::EndOfInput;
     }
+    *record = res;
+    return DecodeStatus::Ok;
+  } catch (const DbnResponseError&) {
+    return DecodeStatus::MalformedInput;
+  } catch (...) {
+    return DecodeStatus::InternalError;
   }
-  // check length
-  while (read_buffer_.size() - buffer_idx_ < BufferRecordHeader()->Size()) {
+}
+
+// assumes ParseMetadata has been called
+const std::vector<databento::Record>& DbnDecoder::DecodeRecords() {
+  record_batch_.clear();
+  batch_compat_buffer_.clear();
+  while (chain_streams_ && AtChainedStreamBoundary()) {
+    ChainNextStream();
+  }
+  while (read_buffer_.size() - buffer_idx_ < sizeof(RecordHeader) ||
+         read_buffer_.size() - buffer_idx_ < BufferRecordHeader()->Size()) {
     if (FillBuffer() == 0) {
-      return nullptr;
+      return record_batch_;
+    }
+  }
+  const bool upgrade_records = upgrade_table_ != nullptr;
+  if (trusted_input_ && !upgrade_records && filter_.MatchesAll()) {
+    // Trusted fast path: no per-record filter or upgrade dispatch, and the
+    // only bounds enforcement is finding the partial record at the end of
+    // the buffer
+    while (read_buffer_.size() - buffer_idx_ >= sizeof(RecordHeader)) {
+      if (chain_streams_ &&
+          std::memcmp(&read_buffer_[buffer_idx_], kDbnPrefix, 3) == 0) {
+        // Stop the batch at a chained stream boundary; the next call
+        // crosses it
+        break;
+      }
+      RecordHeader* header = BufferRecordHeader();
+      const auto size = header->Size();
+      if (read_buffer_.size() - buffer_idx_ < size) {
+        break;
+      }
+      record_batch_.emplace_back(Record{header});
+      buffer_idx_ += size;
+    }
+    stats_.AddRecords(record_batch_.size());
+    return record_batch_;
+  }
+  if (upgrade_records) {
+    // Reserve the worst-case size upfront so pointers into the arena remain
+    // stable while the batch grows
+    batch_compat_buffer_.reserve((read_buffer_.size() - buffer_idx_) /
+                                 sizeof(RecordHeader) * kMaxRecordLen);
+  }
+  while (read_buffer_.size() - buffer_idx_ >= sizeof(RecordHeader) &&
+         read_buffer_.size() - buffer_idx_ >= BufferRecordHeader()->Size()) {
+    if (chain_streams_ &&
+        std::memcmp(&read_buffer_[buffer_idx_], kDbnPrefix, 3) == 0) {
+      // Stop the batch at a chained stream boundary; the next call
+      // crosses it
+      break;
+    }
+    Record record{BufferRecordHeader()};
+    buffer_idx_ += record.Size();
+    if (!filter_.Matches(record.Header())) {
+      continue;
+    }
+    if (upgrade_records) {
+      // kMaxRecordLen is a multiple of alignof(RecordHeader), so each chunk
+      // remains suitably aligned
+      const auto offset = batch_compat_buffer_.size();
+      batch_compat_buffer_.resize(offset + kMaxRecordLen);
+      record = (*upgrade_table_)[static_cast<std::uint8_t>(record.RType())](
+          ts_out_,
+          reinterpret_cast<std::array<std::uint8_t, kMaxRecordLen>*>(
+              &batch_compat_buffer_[offset]),
+          record);
+    }
+    record_batch_.emplace_back(record);
+  }
+  stats_.AddRecords(record_batch_.size());
+  if (upgrade_records) {
+    stats_.AddCompatUpgrades(record_batch_.size());
+  }
+  return record_batch_;
+}
+
+databento::ClientStats DbnDecoder::Stats() const {
+  auto res = stats_.Snapshot();
+  if (shared_channel_ != nullptr) {
+    res.bytes_buffered = shared_channel_->BytesBuffered();
+  }
+  return res;
+}
+
+void DbnDecoder::SeekToTime(std::uint64_t offset, UnixNanos ts) {
+  if (compressed_) {
+    throw InvalidArgumentError{
+        "DbnDecoder::SeekToTime", "offset",
+        "Seeking isn't supported for compressed inputs"};
+  }
+  input_->Seek(static_cast<std::size_t>(offset));
+  // Discard all buffered input
+  read_buffer_.clear();
+  buffer_idx_ = 0;
+  // Fast-forward reading only record headers
+  while (true) {
+    if (read_buffer_.size() - buffer_idx_ == 0) {
+      if (FillBuffer() == 0) {
+        return;
+      }
+    }
+    while (read_buffer_.size() - buffer_idx_ < BufferRecordHeader()->Size()) {
+      if (FillBuffer() == 0) {
+        return;
+      }
     }
+    if (BufferRecordHeader()->ts_event >= ts) {
+      return;
+    }
+    buffer_idx_ += BufferRecordHeader()->Size();
   }
-  current_record_ = Record{BufferRecordHeader()};
-  buffer_idx_ += current_record_.Size();
-  current_record_ = DbnDecoder::DecodeRecordCompat(
-      version_, upgrade_policy_, ts_out_, &compat_buffer_, current_record_);
-  return &current_record_;
 }
 
+// Appends to the read buffer without moving unread bytes in the common case.
+// Records must remain contiguous for BufferRecordHeader, so when the write
+// position reaches the end of the buffer, the at most one partial record
+// still unread is wrapped to the front. This bounds the bytes moved per
+// buffer cycle by kMaxRecordLen instead of shifting every unread byte on
+// each refill.
 size_t DbnDecoder::FillBuffer() {
-  // Shift data forward
+  DATABENTO_TRACEPOINT(decoder_fill_buffer_entry);
+  if (buffer_channel_ != nullptr) {
+    const auto fill_size = FillBufferFromSlices();
+    DATABENTO_TRACEPOINT1(decoder_fill_buffer_exit, fill_size);
+    return fill_size;
+  }
+  if (read_buffer_.size() >= kBufferCapacity) {
+    // Wrap around: move any partial record to the front of the buffer
+    std::copy(read_buffer_.cbegin() + static_cast<std::ptrdiff_t>(buffer_idx_),
+              read_buffer_.cend(), read_buffer_.begin());
+    read_buffer_.resize(read_buffer_.size() - buffer_idx_);
+    buffer_idx_ = 0;
+  }
+  const auto write_idx = read_buffer_.size();
+  read_buffer_.resize(kBufferCapacity);
+  const auto fill_size =
+      input_->ReadSome(&read_buffer_[write_idx], kBufferCapacity - write_idx);
+  read_buffer_.resize(write_idx + fill_size);
+  stats_.AddRead(fill_size);
+  DATABENTO_TRACEPOINT1(decoder_fill_buffer_exit, fill_size);
+  return fill_size;
+}
+
+// Swaps the writer's slices into the read buffer instead of copying bytes
+// through it. When the buffer is fully consumed, the next slice replaces it
+// wholesale. A record spanning a slice boundary is the only case that copies
+// bytes: the partial tail (at most kMaxRecordLen bytes) is moved to the front
+// and completed from the next slice, whose remainder is kept pending for a
+// wholesale swap on a later refill.
+std::size_t DbnDecoder::FillBufferFromSlices() {
+  const std::size_t unread_bytes = read_buffer_.size() - buffer_idx_;
+  if (unread_bytes == 0) {
+    if (pending_slice_.empty() &&
+        !buffer_channel_->NextSlice(&pending_slice_, &pending_idx_)) {
+      return 0;
+    }
+    read_buffer_ = std::move(pending_slice_);
+    buffer_idx_ = pending_idx_;
+    pending_slice_.clear();
+    pending_idx_ = 0;
+    stats_.AddRead(read_buffer_.size() - buffer_idx_);
+    return read_buffer_.size() - buffer_idx_;
+  }
+  // A record spans the slice boundary: move the partial tail to the front
   std::copy(read_buffer_.cbegin() + static_cast<std::ptrdiff_t>(buffer_idx_),
             read_buffer_.cend(), read_buffer_.begin());
-  const auto unread_size = read_buffer_.size() - buffer_idx_;
+  read_buffer_.resize(unread_bytes);
   buffer_idx_ = 0;
-  read_buffer_.resize(kBufferCapacity);
-  const auto fill_size = input_->ReadSome(&read_buffer_[unread_size],
-                                          kBufferCapacity - unread_size);
-  read_buffer_.resize(unread_size + fill_size);
-  return fill_size;
+  if (pending_slice_.empty() &&
+      !buffer_channel_->NextSlice(&pending_slice_, &pending_idx_)) {
+    // Truncated record: report end of input like the byte-stream path
+    return 0;
+  }
+  // Append only what's needed to complete the current record. The caller
+  // refills again if the record's size isn't known until the header is whole.
+  const std::size_t needed =
+      (read_buffer_.size() < sizeof(RecordHeader)
+           ? sizeof(RecordHeader)
+           : std::size_t{BufferRecordHeader()->Size()}) -
+      read_buffer_.size();
+  const auto copy_size =
+      std::min(needed, pending_slice_.size() - pending_idx_);
+  read_buffer_.insert(
+      read_buffer_.end(),
+      pending_slice_.cbegin() + static_cast<std::ptrdiff_t>(pending_idx_),
+      pending_slice_.cbegin() +
+          static_cast<std::ptrdiff_t>(pending_idx_ + copy_size));
+  pending_idx_ += copy_size;
+  if (pending_idx_ == pending_slice_.size()) {
+    pending_slice_.clear();
+    pending_idx_ = 0;
+  }
+  stats_.AddRead(copy_size);
+  return copy_size;
 }
 
 databento::RecordHeader* DbnDecoder::BufferRecordHeader() {
   return reinterpret_cast<RecordHeader*>(&read_buffer_[buffer_idx_]);
 }
 
-bool DbnDecoder::DetectCompression() {
+DbnDecoder::InputFormat DbnDecoder::DetectCompression() {
   read_buffer_.resize(kMagicSize);
   input_->ReadExact(read_buffer_.data(), kMagicSize);
   auto read_buffer_it = read_buffer_.cbegin();
   if (std::strncmp(Consume(read_buffer_it, 3), kDbnPrefix, 3) == 0) {
-    return false;
+    return InputFormat::Dbn;
   }
   read_buffer_it = read_buffer_.cbegin();
   auto x = Consume<std::uint32_t>(read_buffer_it);
   if (x == kZstdMagicNumber) {
-    return true;
+    return InputFormat::Zstd;
+  }
+  if (x == kLz4MagicNumber) {
+    return InputFormat::Lz4;
   }
   // Zstandard skippable frames begin with 0x184D2A5? where the last 8 bits
   // can be set to any value
@@ -296,7 +778,7 @@ bool DbnDecoder::DetectCompression() {
         "convert it to DBN."};
   }
   throw DbnResponseError{
-      "Couldn't detect input type. It doesn't appear to be Zstd or "
+      "Couldn't detect input type. It doesn't appear to be Zstd, LZ4, or "
       "DBN."};
 }
 
@@ -307,7 +789,7 @@ std::string DbnDecoder::DecodeSymbol(
                  "symbol");
 }
 
-std::vector<std::string> DbnDecoder::DecodeRepeatedSymbol(
+std::vector<databento::SymbolString> DbnDecoder::DecodeRepeatedSymbol(
     std::size_t symbol_cstr_len,
     std::vector<std::uint8_t>::const_iterator& read_buffer_it,
     std::vector<std::uint8_t>::const_iterator read_buffer_end_it) {
@@ -321,10 +803,18 @@ std::vector<std::string> DbnDecoder::DecodeRepeatedSymbol(
     throw DbnResponseError{
         "Unexpected end of metadata buffer while parsing symbol"};
   }
-  std::vector<std::string> res;
+  std::vector<SymbolString> res;
   res.reserve(count);
   for (std::size_t i = 0; i < count; ++i) {
-    res.emplace_back(DecodeSymbol(symbol_cstr_len, read_buffer_it));
+    // Construct in place from the buffer without an intermediate string
+    const auto* cstr =
+        Consume(read_buffer_it, static_cast<std::ptrdiff_t>(symbol_cstr_len));
+    const auto str_len = static_cast<std::size_t>(
+        std::find(cstr, cstr + symbol_cstr_len, '\0') - cstr);
+    if (str_len == symbol_cstr_len) {
+      throw DbnResponseError{"Invalid symbol missing null terminator"};
+    }
+    res.emplace_back(cstr, str_len);
   }
   return res;
 }
@@ -0,0 +1,208 @@
+#include "databento/dbn_encoder.hpp"
+
+#include <cstdint>
+#include <cstring>  // memcpy
+#include <limits>
+#include <vector>
+
+#include "databento/compat.hpp"  // kSymbolCstrLenV1
+#include "databento/constants.hpp"
+#include "databento/detail/file_write_stream.hpp"
+#include "databento/detail/lz4_compress_stream.hpp"
+#include "databento/detail/zstd_compress_stream.hpp"
+#include "databento/exceptions.hpp"
+
+using databento::DbnEncoder;
+using databento::DbnFileWriter;
+
+namespace {
+constexpr auto kDbnPrefix = "DBN";
+constexpr std::size_t kFixedMetadataLen = 100;
+constexpr std::size_t kDatasetCstrLen = 16;
+constexpr std::size_t kReservedLen = 53;
+constexpr std::size_t kReservedLenV1 = 47;
+
+template <typename T>
+void EmitScalar(std::vector<std::uint8_t>* buffer, T value) {
+  const auto* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+  buffer->insert(buffer->end(), bytes, bytes + sizeof(T));
+}
+
+void EmitFixedCstr(std::vector<std::uint8_t>* buffer, const std::string& str,
+                   std::size_t cstr_len, const char* context) {
+  if (str.length() >= cstr_len) {
+    throw databento::InvalidArgumentError{
+        "DbnEncoder::EncodeMetadata", context,
+        "Value is too long for the fixed-length string"};
+  }
+  const auto* bytes = reinterpret_cast<const std::uint8_t*>(str.data());
+  buffer->insert(buffer->end(), bytes, bytes + str.length());
+  buffer->insert(buffer->end(), cstr_len - str.length(), '\0');
+}
+
+void EmitFixedCstr(std::vector<std::uint8_t>* buffer,
+                   const databento::SymbolString& str, std::size_t cstr_len,
+                   const char* context) {
+  const auto length = str.size();
+  if (length >= cstr_len) {
+    throw databento::InvalidArgumentError{
+        "DbnEncoder::EncodeMetadata", context,
+        "Value is too long for the fixed-length string"};
+  }
+  const auto* bytes = reinterpret_cast<const std::uint8_t*>(str.data());
+  buffer->insert(buffer->end(), bytes, bytes + length);
+  buffer->insert(buffer->end(), cstr_len - length, '\0');
+}
+
+void EmitRepeatedSymbol(std::vector<std::uint8_t>* buffer,
+                        const std::vector<databento::SymbolString>& symbols,
+                        std::size_t symbol_cstr_len) {
+  EmitScalar(buffer, static_cast<std::uint32_t>(symbols.size()));
+  for (const auto& symbol : symbols) {
+    EmitFixedCstr(buffer, symbol, symbol_cstr_len, "symbol");
+  }
+}
+
+void EmitSymbolMappings(std::vector<std::uint8_t>* buffer,
+                        const std::vector<databento::SymbolMapping>& mappings,
+                        std::size_t symbol_cstr_len) {
+  EmitScalar(buffer, static_cast<std::uint32_t>(mappings.size()));
+  for (const auto& mapping : mappings) {
+    EmitFixedCstr(buffer, mapping.raw_symbol, symbol_cstr_len, "raw_symbol");
+    EmitScalar(buffer, static_cast<std::uint32_t>(mapping.intervals.size()));
+    for (const auto& interval : mapping.intervals) {
+      EmitScalar(buffer, interval.start_date);
+      EmitScalar(buffer, interval.end_date);
+      EmitFixedCstr(buffer, interval.symbol, symbol_cstr_len, "symbol");
+    }
+  }
+}
+}  // namespace
+
+DbnEncoder::DbnEncoder(const Metadata& metadata, IWritable* output)
+    : output_{output} {
+  EncodeMetadata(metadata, output_);
+}
+
+void DbnEncoder::EncodeMetadata(const Metadata& metadata, IWritable* output) {
+  const std::uint8_t version =
+      metadata.version == 0 ? kDbnVersion : metadata.version;
+  if (version > kDbnVersion) {
+    throw InvalidArgumentError{"DbnEncoder::EncodeMetadata", "metadata",
+                               "Can't encode newer version of DBN"};
+  }
+  const auto symbol_cstr_len = version == 1
+                                   ? kSymbolCstrLenV1
+                                   : (metadata.symbol_cstr_len == 0
+                                          ? kSymbolCstrLen
+                                          : metadata.symbol_cstr_len);
+  std::vector<std::uint8_t> buffer;
+  buffer.reserve(8 + kFixedMetadataLen);
+  // Version and frame size header
+  buffer.insert(buffer.end(), kDbnPrefix, kDbnPrefix + 3);
+  buffer.emplace_back(version);
+  // Frame size placeholder, patched below
+  EmitScalar(&buffer, std::uint32_t{0});
+  EmitFixedCstr(&buffer, metadata.dataset, kDatasetCstrLen, "dataset");
+  if (metadata.has_mixed_schema) {
+    EmitScalar(&buffer, std::numeric_limits<std::uint16_t>::max());
+  } else {
+    EmitScalar(&buffer, static_cast<std::uint16_t>(metadata.schema));
+  }
+  EmitScalar(&buffer, static_cast<std::uint64_t>(
+                          metadata.start.time_since_epoch().count()));
+  EmitScalar(&buffer,
+             static_cast<std::uint64_t>(metadata.end.time_since_epoch().count()));
+  EmitScalar(&buffer, metadata.limit);
+  if (version == 1) {
+    // Deprecated record_count
+    EmitScalar(&buffer, std::numeric_limits<std::uint64_t>::max());
+  }
+  if (metadata.has_mixed_stype_in) {
+    EmitScalar(&buffer, std::numeric_limits<std::uint8_t>::max());
+  } else {
+    EmitScalar(&buffer, static_cast<std::uint8_t>(metadata.stype_in));
+  }
+  EmitScalar(&buffer, static_cast<std::uint8_t>(metadata.stype_out));
+  EmitScalar(&buffer, static_cast<std::uint8_t>(metadata.ts_out));
+  if (version > 1) {
+    EmitScalar(&buffer, static_cast<std::uint16_t>(symbol_cstr_len));
+    buffer.insert(buffer.end(), kReservedLen, '\0');
+  } else {
+    buffer.insert(buffer.end(), kReservedLenV1, '\0');
+  }
+  // No schema definitions
+  EmitScalar(&buffer, std::uint32_t{0});
+  EmitRepeatedSymbol(&buffer, metadata.symbols, symbol_cstr_len);
+  EmitRepeatedSymbol(&buffer, metadata.partial, symbol_cstr_len);
+  EmitRepeatedSymbol(&buffer, metadata.not_found, symbol_cstr_len);
+  EmitSymbolMappings(&buffer, metadata.mappings, symbol_cstr_len);
+  // Patch the frame size now that the full length is known
+  const auto frame_size = static_cast<std::uint32_t>(buffer.size() - 8);
+  std::memcpy(&buffer[4], &frame_size, sizeof(frame_size));
+  output->WriteAll(buffer.data(), buffer.size());
+}
+
+void DbnEncoder::EncodeRecord(const Record& record, IWritable* output) {
+  output->WriteAll(reinterpret_cast<const std::uint8_t*>(&record.Header()),
+                   record.Size());
+}
+
+void DbnEncoder::EncodeRecord(const Record& record) {
+  EncodeRecord(record, output_);
+}
+
+namespace {
+// Matches ZstdCompressStream's default level
+constexpr int kZstdCompressionLevel = 3;
+
+std::unique_ptr<databento::IWritable> OpenOutput(const std::string& file_path,
+                                                 DbnFileWriter::Codec codec) {
+  std::unique_ptr<databento::IWritable> output{
+      new databento::detail::FileWriteStream{file_path}};
+  switch (codec) {
+    case DbnFileWriter::Codec::Zstd: {
+      output.reset(
+          new databento::detail::ZstdCompressStream{std::move(output)});
+      break;
+    }
+    case DbnFileWriter::Codec::Lz4: {
+      output.reset(
+          new databento::detail::Lz4CompressStream{std::move(output)});
+      break;
+    }
+    case DbnFileWriter::Codec::None:
+    default: {
+      break;
+    }
+  }
+  return output;
+}
+}  // namespace
+
+DbnFileWriter::DbnFileWriter(const std::string& file_path,
+                             const Metadata& metadata)
+    : DbnFileWriter{file_path, metadata, Codec::None} {}
+
+DbnFileWriter::DbnFileWriter(const std::string& file_path,
+                             const Metadata& metadata, bool zstd_compress)
+    : DbnFileWriter{file_path, metadata,
+                    zstd_compress ? Codec::Zstd : Codec::None} {}
+
+DbnFileWriter::DbnFileWriter(const std::string& file_path,
+                             const Metadata& metadata, Codec codec)
+    : output_{OpenOutput(file_path, codec)},
+      encoder_{metadata, output_.get()} {}
+
+DbnFileWriter::DbnFileWriter(const std::string& file_path,
+                             const Metadata& metadata,
+                             std::size_t seekable_frame_size)
+    : output_{new detail::ZstdCompressStream{
+          kZstdCompressionLevel, seekable_frame_size,
+          std::unique_ptr<IWritable>{
+              new detail::FileWriteStream{file_path}}}},
+      encoder_{metadata, output_.get()} {}
+
+void DbnFileWriter::WriteRecord(const Record& record) {
+  encoder_.EncodeRecord(record);
+}
@@ -4,10 +4,23 @@
 #include <utility>  // move
 
 #include "databento/detail/file_stream.hpp"
+#include "databento/detail/mmap_file_stream.hpp"
 #include "databento/ireadable.hpp"
 
 using databento::DbnFileStore;
 
+namespace {
+std::unique_ptr<databento::IReadable> OpenFile(const std::string& file_path,
+                                               bool use_mmap) {
+  if (use_mmap) {
+    return std::unique_ptr<databento::IReadable>{
+        new databento::detail::MmapFileStream{file_path}};
+  }
+  return std::unique_ptr<databento::IReadable>{
+      new databento::detail::FileStream{file_path}};
+}
+}  // namespace
+
 DbnFileStore::DbnFileStore(const std::string& file_path)
     : parser_{detail::FileStream{file_path}} {}
 
@@ -16,20 +29,32 @@ DbnFileStore::DbnFileStore(const std::string& file_path,
     : parser_{std::unique_ptr<IReadable>{new detail::FileStream{file_path}},
               upgrade_policy} {}
 
+DbnFileStore::DbnFileStore(const std::string& file_path,
+                           VersionUpgradePolicy upgrade_policy, bool use_mmap)
+    : parser_{OpenFile(file_path, use_mmap), upgrade_policy} {}
+
 void DbnFileStore::Replay(const MetadataCallback& metadata_callback,
                           const RecordCallback& record_callback) {
-  auto metadata = parser_.DecodeMetadata();
+  GetMetadata();
   if (metadata_callback) {
-    metadata_callback(std::move(metadata));
-  }
-  const databento::Record* record;
-  while ((record = parser_.DecodeRecord()) != nullptr) {
-    if (record_callback(*record) == KeepGoing::Stop) {
-      break;
-    }
+    metadata_callback(Metadata{metadata_});
   }
+  ReplayWith(record_callback);
 }
 
 void DbnFileStore::Replay(const RecordCallback& record_callback) {
   Replay({}, record_callback);
 }
+
+const databento::Metadata& DbnFileStore::GetMetadata() {
+  if (!has_decoded_metadata_) {
+    metadata_ = parser_.DecodeMetadata();
+    has_decoded_metadata_ = true;
+  }
+  return metadata_;
+}
+
+void DbnFileStore::SeekToTime(UnixNanos ts, const DbnTimeIndex& index) {
+  GetMetadata();
+  parser_.SeekToTime(index.OffsetForTime(ts), ts);
+}
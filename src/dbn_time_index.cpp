@@ -0,0 +1,139 @@
+#include "databento/dbn_time_index.hpp"
+
+#include <algorithm>  // upper_bound
+#include <cstring>    // memcmp
+#include <fstream>    // ifstream, ofstream
+#include <ios>        // ios
+#include <memory>     // unique_ptr
+#include <utility>    // move
+
+#include "databento/dbn_decoder.hpp"
+#include "databento/detail/file_stream.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/ireadable.hpp"
+#include "databento/record.hpp"
+
+using databento::DbnTimeIndex;
+
+namespace {
+constexpr char kIndexMagic[] = {'D', 'B', 'I', 'X'};
+constexpr std::uint32_t kIndexVersion = 1;
+
+template <typename T>
+void WriteScalar(std::ofstream& stream, T value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T ReadScalar(std::ifstream& stream) {
+  T value{};
+  stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+}  // namespace
+
+DbnTimeIndex::DbnTimeIndex(std::vector<Checkpoint> checkpoints)
+    : checkpoints_{std::move(checkpoints)} {}
+
+void DbnTimeIndex::WriteIndexFile(const std::string& dbn_path,
+                                  const std::string& index_path,
+                                  std::size_t records_per_checkpoint) {
+  if (records_per_checkpoint == 0) {
+    throw InvalidArgumentError{"DbnTimeIndex::WriteIndexFile",
+                               "records_per_checkpoint", "Must be non-zero"};
+  }
+  // The metadata frame size gives the offset of the first record
+  std::uint64_t offset;
+  {
+    std::ifstream header_stream{dbn_path, std::ios::binary};
+    char prefix[8];
+    header_stream.read(prefix, sizeof(prefix));
+    if (header_stream.gcount() != sizeof(prefix)) {
+      throw DbnResponseError{"Unexpected end of file reading DBN header"};
+    }
+    const auto version_and_size = DbnDecoder::DecodeMetadataVersionAndSize(
+        reinterpret_cast<const std::uint8_t*>(prefix), sizeof(prefix));
+    offset = 8 + version_and_size.second;
+  }
+  // Decode AsIs so record sizes match the bytes in the file
+  DbnDecoder decoder{std::unique_ptr<IReadable>{
+                         new detail::FileStream{dbn_path}},
+                     VersionUpgradePolicy::AsIs};
+  decoder.DecodeMetadata();
+  std::vector<Checkpoint> checkpoints;
+  std::size_t record_count = 0;
+  const Record* record;
+  while ((record = decoder.DecodeRecord()) != nullptr) {
+    if (record_count % records_per_checkpoint == 0) {
+      checkpoints.emplace_back(
+          Checkpoint{offset, record->Header().ts_event});
+    }
+    offset += record->Size();
+    ++record_count;
+  }
+  std::ofstream index_stream{index_path, std::ios::binary};
+  if (index_stream.fail()) {
+    throw InvalidArgumentError{"DbnTimeIndex::WriteIndexFile", "index_path",
+                               "Unable to open file for writing"};
+  }
+  index_stream.write(kIndexMagic, sizeof(kIndexMagic));
+  WriteScalar(index_stream, kIndexVersion);
+  WriteScalar(index_stream, static_cast<std::uint64_t>(checkpoints.size()));
+  for (const auto& checkpoint : checkpoints) {
+    WriteScalar(index_stream, checkpoint.offset);
+    WriteScalar(index_stream, static_cast<std::uint64_t>(
+                                  checkpoint.ts_event.time_since_epoch()
+                                      .count()));
+  }
+  if (index_stream.fail()) {
+    throw DbnResponseError{"Failed writing DBN index file to " + index_path};
+  }
+}
+
+DbnTimeIndex DbnTimeIndex::ReadIndexFile(const std::string& index_path) {
+  std::ifstream index_stream{index_path, std::ios::binary};
+  if (index_stream.fail()) {
+    throw InvalidArgumentError{"DbnTimeIndex::ReadIndexFile", "index_path",
+                               "Non-existent or invalid file"};
+  }
+  char magic[sizeof(kIndexMagic)];
+  index_stream.read(magic, sizeof(magic));
+  if (index_stream.gcount() != sizeof(magic) ||
+      std::memcmp(magic, kIndexMagic, sizeof(magic)) != 0) {
+    throw DbnResponseError{"Missing DBN index magic number"};
+  }
+  const auto version = ReadScalar<std::uint32_t>(index_stream);
+  if (version != kIndexVersion) {
+    throw DbnResponseError{"Unsupported DBN index version " +
+                           std::to_string(version)};
+  }
+  const auto count = ReadScalar<std::uint64_t>(index_stream);
+  std::vector<Checkpoint> checkpoints;
+  checkpoints.reserve(count);
+  for (std::uint64_t i = 0; i < count; ++i) {
+    const auto offset = ReadScalar<std::uint64_t>(index_stream);
+    const auto ts = ReadScalar<std::uint64_t>(index_stream);
+    checkpoints.emplace_back(
+        Checkpoint{offset, UnixNanos{std::chrono::nanoseconds{ts}}});
+  }
+  if (index_stream.fail()) {
+    throw DbnResponseError{"Unexpected end of DBN index file"};
+  }
+  return DbnTimeIndex{std::move(checkpoints)};
+}
+
+std::uint64_t DbnTimeIndex::OffsetForTime(UnixNanos ts) const {
+  if (checkpoints_.empty()) {
+    throw InvalidArgumentError{"DbnTimeIndex::OffsetForTime", "ts",
+                               "Index contains no checkpoints"};
+  }
+  const auto it = std::upper_bound(
+      checkpoints_.begin(), checkpoints_.end(), ts,
+      [](UnixNanos target, const Checkpoint& checkpoint) {
+        return target < checkpoint.ts_event;
+      });
+  if (it == checkpoints_.begin()) {
+    return checkpoints_.front().offset;
+  }
+  return (it - 1)->offset;
+}
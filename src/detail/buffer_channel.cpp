@@ -0,0 +1,195 @@
+#include "databento/detail/buffer_channel.hpp"
+
+#include <algorithm>  // min
+#include <condition_variable>
+#include <cstring>  // memcpy
+#include <deque>
+#include <memory>   // make_shared
+#include <mutex>    // lock_guard, mutex, unique_lock
+#include <sstream>  // ostringstream
+#include <utility>  // move
+
+#include "databento/exceptions.hpp"  // DbnResponseError
+
+namespace {
+// The writer parks while this many bytes are buffered
+constexpr std::size_t kHighWatermark = 1UL << 20;
+}  // namespace
+
+namespace databento {
+namespace detail {
+// Slice handoff happens at buffer granularity, so unlike `SharedChannel`
+// there's no per-byte hot path to keep lock-free: a mutex-guarded deque of
+// owned buffers is sufficient.
+class BufferChannel::Channel {
+ public:
+  void Write(const std::uint8_t* data, std::size_t length);
+  void Write(std::vector<std::uint8_t>&& slice);
+  void Finish();
+  void Abort();
+  void Reset();
+  bool NextSlice(std::vector<std::uint8_t>* slice, std::size_t* offset);
+  void ReadExact(std::uint8_t* buffer, std::size_t length);
+  std::size_t ReadSome(std::uint8_t* buffer, std::size_t length);
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable read_cv_;
+  std::condition_variable write_cv_;
+  std::deque<std::vector<std::uint8_t>> slices_;
+  // The first unread index within the front slice, advanced by `ReadSome`
+  std::size_t front_offset_{};
+  // Total unread bytes across all slices
+  std::size_t buffered_bytes_{};
+  bool is_finished_{false};
+  // Whether the reader closed the channel; writes are discarded
+  bool is_aborted_{false};
+};
+
+BufferChannel::BufferChannel() : channel_{std::make_shared<Channel>()} {}
+
+void BufferChannel::Write(const std::uint8_t* data, std::size_t length) {
+  channel_->Write(data, length);
+}
+
+void BufferChannel::Write(std::vector<std::uint8_t>&& slice) {
+  channel_->Write(std::move(slice));
+}
+
+void BufferChannel::Finish() { channel_->Finish(); }
+
+void BufferChannel::Abort() { channel_->Abort(); }
+
+void BufferChannel::Reset() { channel_->Reset(); }
+
+bool BufferChannel::NextSlice(std::vector<std::uint8_t>* slice,
+                              std::size_t* offset) {
+  return channel_->NextSlice(slice, offset);
+}
+
+void BufferChannel::ReadExact(std::uint8_t* buffer, std::size_t length) {
+  channel_->ReadExact(buffer, length);
+}
+
+std::size_t BufferChannel::ReadSome(std::uint8_t* buffer, std::size_t length) {
+  return channel_->ReadSome(buffer, length);
+}
+
+void BufferChannel::Channel::Write(const std::uint8_t* data,
+                                   std::size_t length) {
+  if (length == 0) {
+    return;
+  }
+  Write(std::vector<std::uint8_t>{data, data + length});
+}
+
+void BufferChannel::Channel::Write(std::vector<std::uint8_t>&& slice) {
+  if (slice.empty()) {
+    return;
+  }
+  {
+    std::unique_lock<std::mutex> lock{mutex_};
+    write_cv_.wait(lock, [this]() {
+      return buffered_bytes_ < kHighWatermark || is_finished_;
+    });
+    if (is_aborted_) {
+      return;
+    }
+    buffered_bytes_ += slice.size();
+    slices_.emplace_back(std::move(slice));
+  }
+  read_cv_.notify_one();
+}
+
+void BufferChannel::Channel::Finish() {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    is_finished_ = true;
+  }
+  read_cv_.notify_one();
+  write_cv_.notify_one();
+}
+
+void BufferChannel::Channel::Abort() {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    is_aborted_ = true;
+    is_finished_ = true;
+    slices_.clear();
+    front_offset_ = 0;
+    buffered_bytes_ = 0;
+  }
+  read_cv_.notify_one();
+  write_cv_.notify_one();
+}
+
+void BufferChannel::Channel::Reset() {
+  std::lock_guard<std::mutex> lock{mutex_};
+  slices_.clear();
+  front_offset_ = 0;
+  buffered_bytes_ = 0;
+  is_finished_ = false;
+  is_aborted_ = false;
+}
+
+bool BufferChannel::Channel::NextSlice(std::vector<std::uint8_t>* slice,
+                                       std::size_t* offset) {
+  {
+    std::unique_lock<std::mutex> lock{mutex_};
+    read_cv_.wait(lock,
+                  [this]() { return !slices_.empty() || is_finished_; });
+    if (slices_.empty()) {
+      slice->clear();
+      *offset = 0;
+      return false;
+    }
+    *slice = std::move(slices_.front());
+    *offset = front_offset_;
+    slices_.pop_front();
+    front_offset_ = 0;
+    buffered_bytes_ -= slice->size() - *offset;
+  }
+  write_cv_.notify_one();
+  return true;
+}
+
+void BufferChannel::Channel::ReadExact(std::uint8_t* buffer,
+                                       std::size_t length) {
+  std::size_t size{};
+  while (size < length) {
+    const auto read_size = ReadSome(&buffer[size], length - size);
+    if (read_size == 0) {
+      std::ostringstream err_msg;
+      err_msg << "Reached end of the stream with only " << size
+              << " bytes remaining";
+      throw DbnResponseError{err_msg.str()};
+    }
+    size += read_size;
+  }
+}
+
+std::size_t BufferChannel::Channel::ReadSome(std::uint8_t* buffer,
+                                             std::size_t length) {
+  std::size_t read_size;
+  {
+    std::unique_lock<std::mutex> lock{mutex_};
+    read_cv_.wait(lock,
+                  [this]() { return !slices_.empty() || is_finished_; });
+    if (slices_.empty()) {
+      return 0;
+    }
+    const std::vector<std::uint8_t>& front = slices_.front();
+    read_size = std::min(length, front.size() - front_offset_);
+    std::memcpy(buffer, front.data() + front_offset_, read_size);
+    front_offset_ += read_size;
+    buffered_bytes_ -= read_size;
+    if (front_offset_ == front.size()) {
+      slices_.pop_front();
+      front_offset_ = 0;
+    }
+  }
+  write_cv_.notify_one();
+  return read_size;
+}
+}  // namespace detail
+}  // namespace databento
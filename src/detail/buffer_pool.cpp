@@ -0,0 +1,94 @@
+#include "databento/detail/buffer_pool.hpp"
+
+#include <utility>  // move
+
+using databento::detail::BufferPool;
+
+constexpr std::size_t BufferPool::kMinClassCapacity;
+constexpr std::size_t BufferPool::kNumClasses;
+constexpr std::size_t BufferPool::kMaxPooledPerClass;
+
+BufferPool& BufferPool::Shared() {
+  static BufferPool instance;
+  return instance;
+}
+
+std::size_t BufferPool::ClassForAcquire(std::size_t capacity) {
+  for (std::size_t idx = 0; idx < kNumClasses; ++idx) {
+    if (kMinClassCapacity << idx >= capacity) {
+      return idx;
+    }
+  }
+  return kNumClasses;
+}
+
+std::size_t BufferPool::ClassForRelease(std::size_t capacity) {
+  if (capacity < kMinClassCapacity ||
+      // Oversized buffers would pin memory well past their class
+      capacity > kMinClassCapacity << (kNumClasses - 1)) {
+    return kNumClasses;
+  }
+  std::size_t idx = 0;
+  while (idx + 1 < kNumClasses && kMinClassCapacity << (idx + 1) <= capacity) {
+    ++idx;
+  }
+  return idx;
+}
+
+std::array<std::vector<std::uint8_t>, BufferPool::kNumClasses>&
+BufferPool::ThreadCache() {
+  static thread_local std::array<std::vector<std::uint8_t>, kNumClasses> cache;
+  return cache;
+}
+
+std::vector<std::uint8_t> BufferPool::Acquire(std::size_t min_capacity) {
+  const auto idx = ClassForAcquire(min_capacity);
+  std::vector<std::uint8_t> buffer;
+  if (idx == kNumClasses) {
+    buffer.reserve(min_capacity);
+    return buffer;
+  }
+  // swap rather than move so the cache slot is left empty, not unspecified
+  buffer.swap(ThreadCache()[idx]);
+  if (buffer.capacity() != 0) {
+    return buffer;
+  }
+  auto& size_class = classes_[idx];
+  {
+    const std::lock_guard<std::mutex> lock{size_class.mutex};
+    if (!size_class.free_list.empty()) {
+      buffer = std::move(size_class.free_list.back());
+      size_class.free_list.pop_back();
+      return buffer;
+    }
+  }
+  buffer.reserve(kMinClassCapacity << idx);
+  return buffer;
+}
+
+void BufferPool::Release(std::vector<std::uint8_t>&& buffer) {
+  const auto idx = ClassForRelease(buffer.capacity());
+  if (idx == kNumClasses) {
+    return;
+  }
+  buffer.clear();
+  auto& cached = ThreadCache()[idx];
+  if (cached.capacity() == 0) {
+    cached = std::move(buffer);
+    return;
+  }
+  auto& size_class = classes_[idx];
+  const std::lock_guard<std::mutex> lock{size_class.mutex};
+  if (size_class.free_list.size() < kMaxPooledPerClass) {
+    size_class.free_list.emplace_back(std::move(buffer));
+  }
+}
+
+std::size_t BufferPool::PooledCount() const {
+  std::size_t count = 0;
+  for (const auto& size_class : classes_) {
+    const std::lock_guard<std::mutex> lock{size_class.mutex};
+    count += size_class.free_list.size();
+  }
+  return count;
+}
@@ -1,5 +1,9 @@
 #include "databento/detail/file_stream.hpp"
 
+#ifndef _WIN32
+#include <fcntl.h>  // open, posix_fadvise
+#endif
+
 #include <ios>  // ios, streamsize
 #include <sstream>
 
@@ -7,12 +11,51 @@
 
 using databento::detail::FileStream;
 
+namespace {
+// Page cache advice is issued in aligned chunks rather than per read to
+// keep the syscall off most ReadSome calls
+constexpr std::size_t kAdviceChunk = 4 * 1024 * 1024;
+
+void Fadvise(databento::detail::ScopedFd* fd, std::size_t offset,
+             std::size_t length, int advice) {
+#ifdef _WIN32
+  (void)fd;
+  (void)offset;
+  (void)length;
+  (void)advice;
+#else
+  if (fd->Get() == databento::detail::ScopedFd::kUnset) {
+    return;
+  }
+  // Best-effort: ignore failures, advice doesn't affect correctness
+  static_cast<void>(::posix_fadvise(fd->Get(), static_cast<off_t>(offset),
+                                    static_cast<off_t>(length), advice));
+#endif
+}
+}  // namespace
+
 FileStream::FileStream(const std::string& file_path)
-    : stream_{file_path, std::ios::binary} {
+    : FileStream{file_path, ReadAdvice{}} {}
+
+FileStream::FileStream(const std::string& file_path, ReadAdvice advice)
+    : stream_{file_path, std::ios::binary}, advice_{advice} {
   if (stream_.fail()) {
     throw InvalidArgumentError{"FileStream", "file_path",
                                "Non-existent or invalid file"};
   }
+#ifndef _WIN32
+  if (advice_.sequential || advice_.readahead_size > 0 ||
+      advice_.drop_consumed) {
+    advice_fd_ = ScopedFd{::open(file_path.c_str(), O_RDONLY)};
+    if (advice_.sequential) {
+      Fadvise(&advice_fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+    if (advice_.readahead_size > 0) {
+      Fadvise(&advice_fd_, 0, advice_.readahead_size, POSIX_FADV_WILLNEED);
+      readahead_until_ = advice_.readahead_size;
+    }
+  }
+#endif
 }
 
 void FileStream::ReadExact(std::uint8_t* buffer, std::size_t length) {
@@ -28,5 +71,45 @@ void FileStream::ReadExact(std::uint8_t* buffer, std::size_t length) {
 std::size_t FileStream::ReadSome(std::uint8_t* buffer, std::size_t max_length) {
   stream_.read(reinterpret_cast<char*>(buffer),
                static_cast<std::streamsize>(max_length));
-  return static_cast<std::size_t>(stream_.gcount());
+  const auto read_size = static_cast<std::size_t>(stream_.gcount());
+  AdviseRead(read_size);
+  return read_size;
+}
+
+void FileStream::Seek(std::size_t offset) {
+  // Clear a possible EOF state from a previous read
+  stream_.clear();
+  stream_.seekg(static_cast<std::streamoff>(offset));
+  pos_ = offset;
+  // Restart the advice windows from the new position
+  readahead_until_ = offset;
+  dropped_until_ = offset;
+#ifndef _WIN32
+  if (advice_.readahead_size > 0) {
+    Fadvise(&advice_fd_, pos_, advice_.readahead_size, POSIX_FADV_WILLNEED);
+    readahead_until_ = pos_ + advice_.readahead_size;
+  }
+#endif
+}
+
+void FileStream::AdviseRead(std::size_t read_size) {
+  pos_ += read_size;
+#ifndef _WIN32
+  if (advice_.readahead_size > 0 &&
+      pos_ + advice_.readahead_size / 2 > readahead_until_) {
+    // Top the window back up to a full readahead_size ahead of the
+    // position once half of it has been consumed
+    Fadvise(&advice_fd_, readahead_until_,
+            pos_ + advice_.readahead_size - readahead_until_,
+            POSIX_FADV_WILLNEED);
+    readahead_until_ = pos_ + advice_.readahead_size;
+  }
+  if (advice_.drop_consumed && pos_ - dropped_until_ >= kAdviceChunk) {
+    // Drop whole chunks strictly behind the position
+    const auto drop_until = pos_ - pos_ % kAdviceChunk;
+    Fadvise(&advice_fd_, dropped_until_, drop_until - dropped_until_,
+            POSIX_FADV_DONTNEED);
+    dropped_until_ = drop_until;
+  }
+#endif
 }
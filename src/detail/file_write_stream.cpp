@@ -0,0 +1,24 @@
+#include "databento/detail/file_write_stream.hpp"
+
+#include <ios>  // ios, streamsize
+
+#include "databento/exceptions.hpp"
+
+using databento::detail::FileWriteStream;
+
+FileWriteStream::FileWriteStream(const std::string& file_path)
+    : stream_{file_path, std::ios::binary} {
+  if (stream_.fail()) {
+    throw InvalidArgumentError{"FileWriteStream", "file_path",
+                               "Unable to open file for writing"};
+  }
+}
+
+void FileWriteStream::WriteAll(const std::uint8_t* buffer,
+                               std::size_t length) {
+  stream_.write(reinterpret_cast<const char*>(buffer),
+                static_cast<std::streamsize>(length));
+  if (stream_.fail()) {
+    throw DbnResponseError{"Failed writing to file"};
+  }
+}
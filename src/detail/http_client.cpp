@@ -1,59 +1,135 @@
 #include "databento/detail/http_client.hpp"
 
+#include <zstd.h>
+
 #include <chrono>   // seconds
 #include <sstream>  // ostringstream
+#include <utility>  // move
 
-#include "databento/exceptions.hpp"  // HttpResponseError, HttpRequestError, JsonResponseError
+#include "databento/exceptions.hpp"  // HttpResponseError, HttpRequestError, InvalidArgumentError, JsonResponseError
 #include "databento/log.hpp"      // ILogReceiver, LogLevel
 #include "databento/version.hpp"  // DATABENTO_VERSION
 
 using databento::detail::HttpClient;
 
 constexpr std::chrono::seconds kTimeout{100};
+constexpr std::size_t HttpClient::kDefaultMaxConnections;
 const httplib::Headers HttpClient::kHeaders{
     {"accept", "application/json"},
     {"user-agent", "Databento/" DATABENTO_VERSION " C++"},
 };
+const httplib::Headers HttpClient::kJsonHeaders{
+// httplib transparently decompresses gzip only when built with zlib
+#ifdef CPPHTTPLIB_ZLIB_SUPPORT
+    {"accept-encoding", "zstd, gzip"},
+#else
+    {"accept-encoding", "zstd"},
+#endif
+};
 
 HttpClient::HttpClient(databento::ILogReceiver* log_receiver,
                        const std::string& key, const std::string& gateway)
-    : log_receiver_{log_receiver}, client_{gateway} {
-  client_.set_default_headers(HttpClient::kHeaders);
-  client_.set_basic_auth(key, "");
-  client_.set_read_timeout(kTimeout);
-  client_.set_write_timeout(kTimeout);
-}
+    : log_receiver_{log_receiver},
+      key_{key},
+      gateway_{gateway},
+      pool_{new ConnectionPool{}} {}
 
 HttpClient::HttpClient(databento::ILogReceiver* log_receiver,
                        const std::string& key, const std::string& gateway,
                        std::uint16_t port)
-    : log_receiver_{log_receiver}, client_{gateway, port} {
-  client_.set_default_headers(HttpClient::kHeaders);
-  client_.set_basic_auth(key, "");
-  client_.set_read_timeout(kTimeout);
-  client_.set_write_timeout(kTimeout);
+    : log_receiver_{log_receiver},
+      key_{key},
+      gateway_{gateway},
+      port_{port},
+      pool_{new ConnectionPool{}} {}
+
+HttpClient::PooledClient::~PooledClient() {
+  if (client_) {
+    pool_->CheckIn(std::move(client_));
+  }
+}
+
+void HttpClient::SetMaxConnections(std::size_t max_connections) {
+  if (max_connections == 0) {
+    throw InvalidArgumentError{"HttpClient::SetMaxConnections",
+                               "max_connections", "must be nonzero"};
+  }
+  {
+    std::lock_guard<std::mutex> lock{pool_->mutex};
+    pool_->max_connections = max_connections;
+  }
+  pool_->cv.notify_all();
+}
+
+HttpClient::PooledClient HttpClient::CheckOut() {
+  {
+    std::unique_lock<std::mutex> lock{pool_->mutex};
+    // Wait for a pooled connection once the cap is reached, rather than
+    // opening another
+    pool_->cv.wait(lock, [this] {
+      return !pool_->clients.empty() ||
+             pool_->outstanding < pool_->max_connections;
+    });
+    ++pool_->outstanding;
+    if (!pool_->clients.empty()) {
+      std::unique_ptr<httplib::Client> client =
+          std::move(pool_->clients.back());
+      pool_->clients.pop_back();
+      return PooledClient{this, std::move(client)};
+    }
+  }
+  std::unique_ptr<httplib::Client> client{
+      port_ == 0 ? new httplib::Client{gateway_}
+                 : new httplib::Client{gateway_, port_}};
+  client->set_default_headers(HttpClient::kHeaders);
+  client->set_basic_auth(key_, "");
+  client->set_read_timeout(kTimeout);
+  client->set_write_timeout(kTimeout);
+  // keep the connection (and its TLS session) open across requests
+  client->set_keep_alive(true);
+  return PooledClient{this, std::move(client)};
+}
+
+void HttpClient::CheckIn(std::unique_ptr<httplib::Client>&& client) {
+  {
+    std::lock_guard<std::mutex> lock{pool_->mutex};
+    pool_->clients.emplace_back(std::move(client));
+    --pool_->outstanding;
+  }
+  pool_->cv.notify_one();
 }
 
 nlohmann::json HttpClient::GetJson(const std::string& path,
                                    const httplib::Params& params) {
-  httplib::Result res = client_.Get(path, params, httplib::Headers{});
+  PooledClient client = CheckOut();
+  httplib::Result res = client->Get(path, params, kJsonHeaders);
   return HttpClient::CheckAndParseResponse(path, std::move(res));
 }
 
 nlohmann::json HttpClient::PostJson(const std::string& path,
                                     const httplib::Params& form_params) {
+  PooledClient client = CheckOut();
   // params will be encoded as form data
-  httplib::Result res = client_.Post(path, {}, form_params);
+  httplib::Result res = client->Post(path, kJsonHeaders, form_params);
   return HttpClient::CheckAndParseResponse(path, std::move(res));
 }
 
+std::string HttpClient::PostRaw(const std::string& path,
+                                const httplib::Params& form_params) {
+  PooledClient client = CheckOut();
+  // params will be encoded as form data
+  httplib::Result res = client->Post(path, kJsonHeaders, form_params);
+  return HttpClient::CheckResponse(path, std::move(res));
+}
+
 void HttpClient::GetRawStream(const std::string& path,
                               const httplib::Params& params,
                               const httplib::ContentReceiver& callback) {
   const std::string full_path = httplib::append_query_params(path, params);
   std::string err_body{};
   int err_status{};
-  const httplib::Result res = client_.Get(
+  PooledClient client = CheckOut();
+  const httplib::Result res = client->Get(
       full_path,
       [&err_status](const httplib::Response& resp) {
         if (HttpClient::IsErrorStatus(resp.status)) {
@@ -81,8 +157,45 @@ void HttpClient::GetRawStream(const std::string& path,
   }
 }
 
-nlohmann::json HttpClient::CheckAndParseResponse(const std::string& path,
-                                                 httplib::Result&& res) const {
+void HttpClient::GetRangeRawStream(const std::string& path,
+                                   const httplib::Params& params,
+                                   std::uint64_t start, std::uint64_t length,
+                                   const httplib::ContentReceiver& callback) {
+  const std::string full_path = httplib::append_query_params(path, params);
+  std::ostringstream range_ss;
+  range_ss << "bytes=" << start << '-' << (start + length - 1);
+  const httplib::Headers headers{{"Range", range_ss.str()}};
+  std::string err_body{};
+  int err_status{};
+  PooledClient client = CheckOut();
+  const httplib::Result res = client->Get(
+      full_path, headers,
+      [&err_status](const httplib::Response& resp) {
+        if (HttpClient::IsErrorStatus(resp.status)) {
+          err_status = resp.status;
+        }
+        return true;
+      },
+      [&callback, &err_body, &err_status](const char* data,
+                                          std::size_t length_chunk) {
+        // if an error response was received, read all content into err_status
+        if (err_status > 0) {
+          err_body.append(data, length_chunk);
+          return true;
+        }
+        return callback(data, length_chunk);
+      });
+  if (err_status > 0) {
+    throw HttpResponseError{path, err_status, std::move(err_body)};
+  }
+  if (res.error() != httplib::Error::Success &&
+      res.error() != httplib::Error::Canceled) {
+    throw HttpRequestError{path, res.error()};
+  }
+}
+
+std::string HttpClient::CheckResponse(const std::string& path,
+                                      httplib::Result&& res) const {
   if (res.error() != httplib::Error::Success) {
     throw HttpRequestError{path, res.error()};
   }
@@ -92,8 +205,45 @@ nlohmann::json HttpClient::CheckAndParseResponse(const std::string& path,
     throw HttpResponseError{path, status_code, std::move(response.body)};
   }
   CheckWarnings(response);
+  // httplib handles gzip itself (when built with zlib); zstd is ours
+  if (response.get_header_value("Content-Encoding") == "zstd") {
+    return DecompressZstdBody(path, response.body);
+  }
+  return std::move(response.body);
+}
+
+std::string HttpClient::DecompressZstdBody(const std::string& path,
+                                           const std::string& body) {
+  const std::unique_ptr<ZSTD_DStream, std::size_t (*)(ZSTD_DStream*)> dstream{
+      ::ZSTD_createDStream(), ::ZSTD_freeDStream};
+  std::string out;
+  // The content usually compresses around 10:1
+  out.resize(body.length() * 8);
+  ZSTD_inBuffer z_in{body.data(), body.length(), 0};
+  ZSTD_outBuffer z_out{&out[0], out.length(), 0};
+  while (z_in.pos < z_in.size) {
+    if (z_out.pos == z_out.size) {
+      out.resize(out.length() * 2);
+      z_out.dst = &out[0];
+      z_out.size = out.length();
+    }
+    const auto ret = ::ZSTD_decompressStream(dstream.get(), &z_out, &z_in);
+    if (::ZSTD_isError(ret)) {
+      std::ostringstream err_msg;
+      err_msg << "Failed to decompress zstd-encoded response from " << path
+              << ": " << ::ZSTD_getErrorName(ret);
+      throw Exception{err_msg.str()};
+    }
+  }
+  out.resize(z_out.pos);
+  return out;
+}
+
+nlohmann::json HttpClient::CheckAndParseResponse(const std::string& path,
+                                                 httplib::Result&& res) const {
+  std::string body = CheckResponse(path, std::move(res));
   try {
-    return nlohmann::json::parse(std::move(response.body));
+    return nlohmann::json::parse(std::move(body));
   } catch (const nlohmann::json::parse_error& parse_err) {
     throw JsonResponseError::ParseError(path, parse_err);
   }
@@ -0,0 +1,208 @@
+#ifdef __linux__
+
+#include "databento/detail/io_uring_receiver.hpp"
+
+#include <linux/io_uring.h>
+#include <linux/time_types.h>  // __kernel_timespec
+#include <sys/mman.h>          // mmap, munmap
+#include <sys/syscall.h>       // __NR_io_uring_enter, __NR_io_uring_setup
+#include <unistd.h>            // syscall
+
+#include <algorithm>  // max
+#include <cerrno>     // errno
+#include <cstring>    // memset
+
+#include "databento/exceptions.hpp"  // TcpError
+
+using databento::detail::IoUringReceiver;
+
+namespace {
+constexpr unsigned kQueueDepth = 8;
+constexpr std::uint64_t kRecvUserData = 1;
+constexpr std::uint64_t kTimeoutUserData = 2;
+
+int IoUringSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags) {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                    min_complete, flags, nullptr, 0));
+}
+
+// The ring head and tail are shared with the kernel, so they're accessed
+// with the same acquire/release ordering the kernel uses.
+unsigned LoadAcquire(const unsigned* ptr) {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+void StoreRelease(unsigned* ptr, unsigned value) {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+}  // namespace
+
+IoUringReceiver::IoUringReceiver(Socket socket) : socket_{socket} {
+  io_uring_params params{};
+  const int ring_fd = ::IoUringSetup(kQueueDepth, &params);
+  if (ring_fd < 0) {
+    throw TcpError{errno, "Failed to create io_uring"};
+  }
+  ring_fd_ = ScopedFd{ring_fd};
+  try {
+    MapRings(params);
+  } catch (...) {
+    UnmapRings();
+    throw;
+  }
+}
+
+IoUringReceiver::~IoUringReceiver() { UnmapRings(); }
+
+std::size_t IoUringReceiver::Receive(char* buffer, std::size_t max_size) {
+  PushSqe(IORING_OP_RECV, reinterpret_cast<std::uint64_t>(buffer),
+          static_cast<std::uint32_t>(max_size), {}, kRecvUserData);
+  const auto res = SubmitAndWaitRecv(1);
+  if (res < 0) {
+    throw TcpError{-res, "Error reading from socket"};
+  }
+  return static_cast<std::size_t>(res);
+}
+
+databento::detail::TcpClient::Result IoUringReceiver::Receive(
+    char* buffer, std::size_t max_size, std::chrono::milliseconds timeout) {
+  if (timeout.count() == 0) {
+    const auto read_size = Receive(buffer, max_size);
+    return {read_size, read_size == 0 ? TcpClient::Status::Closed
+                                      : TcpClient::Status::Ok};
+  }
+  __kernel_timespec ts{};
+  ts.tv_sec = timeout.count() / 1000;
+  ts.tv_nsec = timeout.count() % 1000 * 1000000;
+  // Linking a timeout to the receive cancels whichever completes second, so
+  // both operations always post a completion
+  PushSqe(IORING_OP_RECV, reinterpret_cast<std::uint64_t>(buffer),
+          static_cast<std::uint32_t>(max_size), IOSQE_IO_LINK, kRecvUserData);
+  PushSqe(IORING_OP_LINK_TIMEOUT, reinterpret_cast<std::uint64_t>(&ts), 1, {},
+          kTimeoutUserData);
+  const auto res = SubmitAndWaitRecv(2);
+  if (res == -ECANCELED) {
+    return {0, TcpClient::Status::Timeout};
+  }
+  if (res < 0) {
+    throw TcpError{-res, "Error reading from socket"};
+  }
+  return {static_cast<std::size_t>(res), res == 0 ? TcpClient::Status::Closed
+                                                  : TcpClient::Status::Ok};
+}
+
+void IoUringReceiver::MapRings(const io_uring_params& params) {
+  sq_ring_size_ =
+      params.sq_off.array + params.sq_entries * sizeof(std::uint32_t);
+  cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap) {
+    sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+  }
+  void* res =
+      ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, ring_fd_.Get(), IORING_OFF_SQ_RING);
+  if (res == MAP_FAILED) {
+    throw TcpError{errno, "Failed to map io_uring submission ring"};
+  }
+  sq_ring_ = res;
+  if (single_mmap) {
+    cq_ring_ = sq_ring_;
+  } else {
+    res = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_POPULATE, ring_fd_.Get(), IORING_OFF_CQ_RING);
+    if (res == MAP_FAILED) {
+      throw TcpError{errno, "Failed to map io_uring completion ring"};
+    }
+    cq_ring_ = res;
+  }
+  sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+  res = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_POPULATE, ring_fd_.Get(), IORING_OFF_SQES);
+  if (res == MAP_FAILED) {
+    throw TcpError{errno, "Failed to map io_uring submission entries"};
+  }
+  sqes_ = static_cast<io_uring_sqe*>(res);
+  auto* sq_ring = static_cast<std::uint8_t*>(sq_ring_);
+  sq_tail_ = reinterpret_cast<unsigned*>(sq_ring + params.sq_off.tail);
+  sq_mask_ = reinterpret_cast<unsigned*>(sq_ring + params.sq_off.ring_mask);
+  sq_array_ = reinterpret_cast<unsigned*>(sq_ring + params.sq_off.array);
+  auto* cq_ring = static_cast<std::uint8_t*>(cq_ring_);
+  cq_head_ = reinterpret_cast<unsigned*>(cq_ring + params.cq_off.head);
+  cq_tail_ = reinterpret_cast<unsigned*>(cq_ring + params.cq_off.tail);
+  cq_mask_ = reinterpret_cast<unsigned*>(cq_ring + params.cq_off.ring_mask);
+  cqes_ = reinterpret_cast<io_uring_cqe*>(cq_ring + params.cq_off.cqes);
+}
+
+void IoUringReceiver::UnmapRings() {
+  if (sqes_ != nullptr) {
+    ::munmap(sqes_, sqes_size_);
+    sqes_ = nullptr;
+  }
+  if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+    ::munmap(cq_ring_, cq_ring_size_);
+  }
+  cq_ring_ = nullptr;
+  if (sq_ring_ != nullptr) {
+    ::munmap(sq_ring_, sq_ring_size_);
+    sq_ring_ = nullptr;
+  }
+}
+
+void IoUringReceiver::PushSqe(std::uint8_t opcode, std::uint64_t addr,
+                              std::uint32_t len, std::uint8_t flags,
+                              std::uint64_t user_data) {
+  // Only this thread advances the submission tail
+  const unsigned tail = *sq_tail_;
+  const unsigned idx = tail & *sq_mask_;
+  io_uring_sqe& sqe = sqes_[idx];
+  std::memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = opcode;
+  sqe.fd = socket_;
+  sqe.addr = addr;
+  sqe.len = len;
+  sqe.flags = flags;
+  sqe.user_data = user_data;
+  sq_array_[idx] = idx;
+  StoreRelease(sq_tail_, tail + 1);
+}
+
+std::int32_t IoUringReceiver::SubmitAndWaitRecv(unsigned to_submit) {
+  while (true) {
+    const int enter_res =
+        ::IoUringEnter(ring_fd_.Get(), to_submit, 1, IORING_ENTER_GETEVENTS);
+    if (enter_res < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw TcpError{errno, "Failed to submit to io_uring"};
+    }
+    to_submit -= static_cast<unsigned>(enter_res);
+    // Drain all posted completions, keeping the result of the receive. A
+    // linked timeout that was canceled may not post until a later drain,
+    // where it's skipped by its user_data.
+    std::int32_t recv_res{};
+    bool recv_seen = false;
+    unsigned head = *cq_head_;
+    const unsigned tail = ::LoadAcquire(cq_tail_);
+    while (head != tail) {
+      const io_uring_cqe& cqe = cqes_[head & *cq_mask_];
+      if (cqe.user_data == kRecvUserData) {
+        recv_res = cqe.res;
+        recv_seen = true;
+      }
+      ++head;
+    }
+    StoreRelease(cq_head_, head);
+    if (recv_seen) {
+      return recv_res;
+    }
+  }
+}
+
+#endif  // __linux__
@@ -0,0 +1,314 @@
+#include "databento/detail/journal_writer.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, msync, munmap
+#include <unistd.h>    // close, ftruncate
+#endif
+
+#include <algorithm>  // min
+#include <cerrno>     // errno
+#include <chrono>     // microseconds
+#include <cstring>    // memcpy, strerror
+#include <sstream>
+#include <thread>   // this_thread
+#include <utility>  // move
+
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+#include "databento/log.hpp"         // ILogReceiver, LogLevel
+
+using databento::detail::JournalWriter;
+
+namespace {
+// The ring is drained into the compressor in chunks of at most this many
+// bytes, bounding how much segment space a single block needs
+constexpr std::size_t kLz4ChunkSize = 1UL << 16;
+
+std::size_t NextPowerOfTwo(std::size_t size) {
+  std::size_t res = 2;
+  while (res < size) {
+    res <<= 1;
+  }
+  return res;
+}
+}  // namespace
+
+JournalWriter::JournalWriter(databento::ILogReceiver* log_receiver, Conf conf)
+    : log_receiver_{log_receiver},
+      conf_{std::move(conf)},
+      ring_(NextPowerOfTwo(conf_.buffer_size)),
+      ring_mask_{ring_.size() - 1} {
+  if (conf_.path_prefix.empty()) {
+    throw InvalidArgumentError{"JournalWriter", "path_prefix",
+                               "must not be empty"};
+  }
+  if (conf_.lz4_compress) {
+    if (::LZ4F_isError(
+            ::LZ4F_createCompressionContext(&lz4_cctx_, LZ4F_VERSION))) {
+      throw InvalidArgumentError{"JournalWriter", "lz4_compress",
+                                 "failed to create LZ4 compression context"};
+    }
+    // Room for the frame header, one compressed chunk, and the end mark
+    if (conf_.segment_size <
+        LZ4F_HEADER_SIZE_MAX + ::LZ4F_compressBound(kLz4ChunkSize, nullptr) +
+            ::LZ4F_compressBound(0, nullptr)) {
+      ::LZ4F_freeCompressionContext(lz4_cctx_);
+      lz4_cctx_ = nullptr;
+      throw InvalidArgumentError{"JournalWriter", "segment_size",
+                                 "too small for LZ4-compressed segments"};
+    }
+  }
+  if (!OpenSegment()) {
+    if (lz4_cctx_ != nullptr) {
+      ::LZ4F_freeCompressionContext(lz4_cctx_);
+    }
+    throw InvalidArgumentError{"JournalWriter", "path_prefix",
+                               "failed to open journal segment"};
+  }
+  thread_ = ScopedThread{&JournalWriter::WriterThread, this};
+}
+
+JournalWriter::~JournalWriter() {
+  keep_going_.store(false, std::memory_order_release);
+  if (thread_.Joinable()) {
+    thread_.Join();
+  }
+  if (map_ != nullptr) {
+    if (lz4_cctx_ != nullptr) {
+      EndFrame();
+    }
+    CloseSegment(segment_pos_);
+  }
+  if (lz4_cctx_ != nullptr) {
+    ::LZ4F_freeCompressionContext(lz4_cctx_);
+  }
+}
+
+void JournalWriter::Write(const char* data, std::size_t size) {
+  while (size > 0) {
+    const auto head = head_.load(std::memory_order_relaxed);
+    const auto tail = tail_.load(std::memory_order_acquire);
+    const auto free_size = ring_.size() - (head - tail);
+    if (free_size == 0) {
+      std::this_thread::yield();
+      continue;
+    }
+    const auto chunk_size = std::min(size, free_size);
+    const auto idx = head & ring_mask_;
+    const auto contiguous = std::min(chunk_size, ring_.size() - idx);
+    std::memcpy(&ring_[idx], data, contiguous);
+    if (contiguous < chunk_size) {
+      std::memcpy(ring_.data(), data + contiguous, chunk_size - contiguous);
+    }
+    head_.store(head + chunk_size, std::memory_order_release);
+    data += chunk_size;
+    size -= chunk_size;
+  }
+}
+
+void JournalWriter::WriterThread() {
+  constexpr std::chrono::microseconds kIdleSleep{100};
+
+  while (true) {
+    auto tail = tail_.load(std::memory_order_relaxed);
+    const auto head = head_.load(std::memory_order_acquire);
+    if (head == tail) {
+      if (!keep_going_.load(std::memory_order_acquire)) {
+        return;
+      }
+      std::this_thread::sleep_for(kIdleSleep);
+      continue;
+    }
+    if (map_ == nullptr) {
+      // Journaling was stopped by a failed rotation: discard the bytes
+      tail_.store(head, std::memory_order_release);
+      continue;
+    }
+    while (tail < head) {
+      const auto idx = tail & ring_mask_;
+      auto chunk_size = std::min(head - tail, ring_.size() - idx);
+      if (lz4_cctx_ != nullptr) {
+        chunk_size = std::min(chunk_size, kLz4ChunkSize);
+        if (conf_.segment_size - segment_pos_ <
+            ::LZ4F_compressBound(chunk_size, nullptr) +
+                ::LZ4F_compressBound(0, nullptr)) {
+          // Rotate while the next block and the end mark still fit
+          EndFrame();
+          CloseSegment(segment_pos_);
+          if (!OpenSegment()) {
+            break;
+          }
+          continue;
+        }
+        const auto out_size = ::LZ4F_compressUpdate(
+            lz4_cctx_, map_ + segment_pos_,
+            conf_.segment_size - segment_pos_, &ring_[idx], chunk_size,
+            nullptr);
+        if (::LZ4F_isError(out_size)) {
+          std::ostringstream log_ss;
+          log_ss << "[JournalWriter::WriterThread] LZ4 error compressing: "
+                 << ::LZ4F_getErrorName(out_size) << ". Stopping journal.";
+          log_receiver_->Receive(LogLevel::Error, log_ss.str());
+          CloseSegment(segment_pos_);
+          break;
+        }
+        segment_pos_ += out_size;
+        tail += chunk_size;
+        continue;
+      }
+      chunk_size = std::min(chunk_size, conf_.segment_size - segment_pos_);
+      std::memcpy(map_ + segment_pos_, &ring_[idx], chunk_size);
+      segment_pos_ += chunk_size;
+      tail += chunk_size;
+      if (segment_pos_ == conf_.segment_size) {
+        CloseSegment(conf_.segment_size);
+        if (!OpenSegment()) {
+          break;
+        }
+      }
+    }
+    tail_.store(tail, std::memory_order_release);
+  }
+}
+
+bool JournalWriter::OpenSegment() {
+  const std::string path =
+      conf_.path_prefix + '.' + std::to_string(segment_index_);
+#ifdef _WIN32
+  file_handle_ =
+      ::CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                    CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file_handle_ == INVALID_HANDLE_VALUE) {
+    file_handle_ = nullptr;
+    std::ostringstream log_ss;
+    log_ss << "[JournalWriter::OpenSegment] Failed to open " << path
+           << ". Stopping journal.";
+    log_receiver_->Receive(LogLevel::Error, log_ss.str());
+    return false;
+  }
+  // Creating the mapping extends the file to `segment_size`
+  mapping_handle_ = ::CreateFileMappingA(
+      file_handle_, nullptr, PAGE_READWRITE,
+      static_cast<DWORD>(conf_.segment_size >> 32),
+      static_cast<DWORD>(conf_.segment_size & 0xFFFFFFFF), nullptr);
+  if (mapping_handle_ == nullptr) {
+    ::CloseHandle(file_handle_);
+    file_handle_ = nullptr;
+    std::ostringstream log_ss;
+    log_ss << "[JournalWriter::OpenSegment] Failed to map " << path
+           << ". Stopping journal.";
+    log_receiver_->Receive(LogLevel::Error, log_ss.str());
+    return false;
+  }
+  map_ = static_cast<char*>(
+      ::MapViewOfFile(mapping_handle_, FILE_MAP_WRITE, 0, 0, 0));
+  if (map_ == nullptr) {
+    ::CloseHandle(mapping_handle_);
+    ::CloseHandle(file_handle_);
+    mapping_handle_ = nullptr;
+    file_handle_ = nullptr;
+    std::ostringstream log_ss;
+    log_ss << "[JournalWriter::OpenSegment] Failed to map " << path
+           << ". Stopping journal.";
+    log_receiver_->Receive(LogLevel::Error, log_ss.str());
+    return false;
+  }
+#else
+  fd_ = ::open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+  if (fd_ < 0) {
+    std::ostringstream log_ss;
+    log_ss << "[JournalWriter::OpenSegment] Failed to open " << path << ": "
+           << std::strerror(errno) << ". Stopping journal.";
+    log_receiver_->Receive(LogLevel::Error, log_ss.str());
+    return false;
+  }
+  if (::ftruncate(fd_, static_cast<::off_t>(conf_.segment_size)) != 0) {
+    std::ostringstream log_ss;
+    log_ss << "[JournalWriter::OpenSegment] Failed to size " << path << ": "
+           << std::strerror(errno) << ". Stopping journal.";
+    log_receiver_->Receive(LogLevel::Error, log_ss.str());
+    ::close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  void* map = ::mmap(nullptr, conf_.segment_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED, fd_, 0);
+  if (map == MAP_FAILED) {  // NOLINT(performance-no-int-to-ptr)
+    std::ostringstream log_ss;
+    log_ss << "[JournalWriter::OpenSegment] Failed to map " << path << ": "
+           << std::strerror(errno) << ". Stopping journal.";
+    log_receiver_->Receive(LogLevel::Error, log_ss.str());
+    ::close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  map_ = static_cast<char*>(map);
+#endif
+  ++segment_index_;
+  segment_pos_ = 0;
+  if (lz4_cctx_ != nullptr) {
+    const auto header_size =
+        ::LZ4F_compressBegin(lz4_cctx_, map_, conf_.segment_size, nullptr);
+    if (::LZ4F_isError(header_size)) {
+      std::ostringstream log_ss;
+      log_ss << "[JournalWriter::OpenSegment] LZ4 error beginning frame: "
+             << ::LZ4F_getErrorName(header_size) << ". Stopping journal.";
+      log_receiver_->Receive(LogLevel::Error, log_ss.str());
+      CloseSegment(0);
+      return false;
+    }
+    segment_pos_ = header_size;
+  }
+  return true;
+}
+
+void JournalWriter::EndFrame() {
+  const auto end_size = ::LZ4F_compressEnd(
+      lz4_cctx_, map_ + segment_pos_, conf_.segment_size - segment_pos_,
+      nullptr);
+  if (::LZ4F_isError(end_size)) {
+    std::ostringstream log_ss;
+    log_ss << "[JournalWriter::EndFrame] LZ4 error finishing frame: "
+           << ::LZ4F_getErrorName(end_size);
+    log_receiver_->Receive(LogLevel::Warning, log_ss.str());
+    return;
+  }
+  segment_pos_ += end_size;
+}
+
+void JournalWriter::CloseSegment(std::size_t used_size) {
+#ifdef _WIN32
+  ::FlushViewOfFile(map_, used_size);
+  ::UnmapViewOfFile(map_);
+  map_ = nullptr;
+  ::CloseHandle(mapping_handle_);
+  mapping_handle_ = nullptr;
+  if (used_size < conf_.segment_size) {
+    // Trim the unwritten tail of the final segment
+    LARGE_INTEGER end;
+    end.QuadPart = static_cast<LONGLONG>(used_size);
+    if (::SetFilePointerEx(file_handle_, end, nullptr, FILE_BEGIN) != 0) {
+      ::SetEndOfFile(file_handle_);
+    }
+  }
+  ::CloseHandle(file_handle_);
+  file_handle_ = nullptr;
+#else
+  ::msync(map_, used_size, MS_ASYNC);
+  ::munmap(map_, conf_.segment_size);
+  map_ = nullptr;
+  if (used_size < conf_.segment_size) {
+    // Trim the unwritten tail of the final segment
+    if (::ftruncate(fd_, static_cast<::off_t>(used_size)) != 0) {
+      std::ostringstream log_ss;
+      log_ss << "[JournalWriter::CloseSegment] Failed to trim segment: "
+             << std::strerror(errno);
+      log_receiver_->Receive(LogLevel::Warning, log_ss.str());
+    }
+  }
+  ::close(fd_);
+  fd_ = -1;
+#endif
+}
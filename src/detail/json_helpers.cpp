@@ -1,9 +1,27 @@
 #include "databento/detail/json_helpers.hpp"
 
+#include <cstdint>  // uint8_t
 #include <numeric>  // accumulate
 
 namespace databento {
 namespace detail {
+IReadableStreambuf::IReadableStreambuf(IReadable* source) : source_{source} {
+  setg(buffer_.data(), buffer_.data(), buffer_.data());
+}
+
+std::streambuf::int_type IReadableStreambuf::underflow() {
+  if (gptr() < egptr()) {
+    return traits_type::to_int_type(*gptr());
+  }
+  const std::size_t read_size = source_->ReadSome(
+      reinterpret_cast<std::uint8_t*>(buffer_.data()), buffer_.size());
+  if (read_size == 0) {
+    return traits_type::eof();
+  }
+  setg(buffer_.data(), buffer_.data(), buffer_.data() + read_size);
+  return traits_type::to_int_type(*gptr());
+}
+
 void SetIfNotEmpty(httplib::Params* params, const std::string& key,
                    const std::string& value) {
   if (!value.empty()) {
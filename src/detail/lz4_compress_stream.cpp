@@ -0,0 +1,82 @@
+#include "databento/detail/lz4_compress_stream.hpp"
+
+#include <algorithm>  // min
+#include <exception>
+#include <string>
+#include <utility>  // move
+
+#include "databento/exceptions.hpp"
+
+using databento::detail::Lz4CompressStream;
+
+namespace {
+// 0 selects LZ4's default fast mode; positive levels enable LZ4HC
+constexpr int kDefaultCompressionLevel = 0;
+// Input is fed to the compressor in chunks of at most this many bytes, so
+// the output buffer only needs to hold one chunk's compression bound
+constexpr std::size_t kInChunkSize = 1UL << 16;
+
+LZ4F_cctx* CreateCCtx() {
+  LZ4F_cctx* cctx{};
+  const auto ret = ::LZ4F_createCompressionContext(&cctx, LZ4F_VERSION);
+  if (::LZ4F_isError(ret)) {
+    throw databento::DbnResponseError{
+        std::string{"Lz4 error creating compression context: "} +
+        ::LZ4F_getErrorName(ret)};
+  }
+  return cctx;
+}
+}  // namespace
+
+Lz4CompressStream::Lz4CompressStream(std::unique_ptr<IWritable> output)
+    : Lz4CompressStream{kDefaultCompressionLevel, std::move(output)} {}
+
+Lz4CompressStream::Lz4CompressStream(int compression_level,
+                                     std::unique_ptr<IWritable> output)
+    : output_{std::move(output)},
+      cctx_{CreateCCtx(), ::LZ4F_freeCompressionContext} {
+  prefs_.compressionLevel = compression_level;
+  // The bound covers a full input chunk as well as the header and the end
+  // of the frame
+  out_buffer_.resize(::LZ4F_compressBound(kInChunkSize, &prefs_));
+  const auto header_size = ::LZ4F_compressBegin(
+      cctx_.get(), out_buffer_.data(), out_buffer_.size(), &prefs_);
+  if (::LZ4F_isError(header_size)) {
+    throw DbnResponseError{std::string{"Lz4 error writing frame header: "} +
+                           ::LZ4F_getErrorName(header_size)};
+  }
+  output_->WriteAll(out_buffer_.data(), header_size);
+}
+
+Lz4CompressStream::~Lz4CompressStream() {
+  // Errors are swallowed because destructors shouldn't throw
+  try {
+    const auto end_size = ::LZ4F_compressEnd(
+        cctx_.get(), out_buffer_.data(), out_buffer_.size(), nullptr);
+    if (!::LZ4F_isError(end_size)) {
+      output_->WriteAll(out_buffer_.data(), end_size);
+    }
+  } catch (const std::exception&) {
+  }
+}
+
+void Lz4CompressStream::WriteAll(const std::uint8_t* buffer,
+                                 std::size_t length) {
+  std::size_t pos{};
+  while (pos < length) {
+    const auto chunk_size = std::min(length - pos, kInChunkSize);
+    const auto out_size =
+        ::LZ4F_compressUpdate(cctx_.get(), out_buffer_.data(),
+                              out_buffer_.size(), &buffer[pos], chunk_size,
+                              nullptr);
+    if (::LZ4F_isError(out_size)) {
+      throw DbnResponseError{std::string{"Lz4 error compressing: "} +
+                             ::LZ4F_getErrorName(out_size)};
+    }
+    // The compressor may buffer small inputs internally and emit nothing
+    if (out_size > 0) {
+      output_->WriteAll(out_buffer_.data(), out_size);
+    }
+    pos += chunk_size;
+  }
+}
@@ -0,0 +1,92 @@
+#include "databento/detail/lz4_stream.hpp"
+
+#include <sstream>  // ostringstream
+#include <string>
+#include <utility>  // move
+
+#include "databento/detail/buffer_pool.hpp"
+#include "databento/exceptions.hpp"
+
+using databento::detail::Lz4Stream;
+
+namespace {
+// How many compressed bytes are requested from the input at a time
+constexpr std::size_t kInBufferSize = 1UL << 16;
+
+LZ4F_dctx* CreateDCtx() {
+  LZ4F_dctx* dctx{};
+  const auto ret = ::LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION);
+  if (::LZ4F_isError(ret)) {
+    throw databento::DbnResponseError{
+        std::string{"Lz4 error creating decompression context: "} +
+        ::LZ4F_getErrorName(ret)};
+  }
+  return dctx;
+}
+}  // namespace
+
+Lz4Stream::Lz4Stream(std::unique_ptr<IReadable> input)
+    : Lz4Stream{std::move(input), {}} {}
+
+Lz4Stream::Lz4Stream(std::unique_ptr<IReadable> input,
+                     std::vector<std::uint8_t>&& in_buffer)
+    : input_{std::move(input)},
+      dctx_{CreateDCtx(), ::LZ4F_freeDecompressionContext},
+      in_buffer_{std::move(in_buffer)},
+      in_size_{in_buffer_.size()} {
+  if (in_buffer_.capacity() == 0) {
+    // Start from a recycled buffer; empty, so the first read refills it
+    in_buffer_ = BufferPool::Shared().Acquire(kInBufferSize);
+  }
+}
+
+Lz4Stream::~Lz4Stream() {
+  BufferPool::Shared().Release(std::move(in_buffer_));
+}
+
+void Lz4Stream::ReadExact(std::uint8_t* buffer, std::size_t length) {
+  std::size_t size{};
+  while (size < length) {
+    const auto read_size = ReadSome(&buffer[size], length - size);
+    if (read_size == 0) {
+      std::ostringstream err_msg;
+      err_msg << "Reached end of Lz4 stream without " << length
+              << " bytes, only " << size << " bytes available";
+      throw DbnResponseError{err_msg.str()};
+    }
+    size += read_size;
+  }
+}
+
+std::size_t Lz4Stream::ReadSome(std::uint8_t* buffer, std::size_t max_length) {
+  while (true) {
+    if (in_pos_ == in_size_) {
+      in_buffer_.resize(kInBufferSize);
+      in_size_ = input_->ReadSome(in_buffer_.data(), in_buffer_.size());
+      in_pos_ = 0;
+      if (in_size_ == 0) {
+        if (expected_ != 0) {
+          throw DbnResponseError{
+              "Lz4 error decompressing: unexpected end of input within a "
+              "frame"};
+        }
+        return 0;
+      }
+    }
+    std::size_t dst_size = max_length;
+    std::size_t src_size = in_size_ - in_pos_;
+    const auto ret = ::LZ4F_decompress(dctx_.get(), buffer, &dst_size,
+                                       &in_buffer_[in_pos_], &src_size,
+                                       nullptr);
+    if (::LZ4F_isError(ret)) {
+      throw DbnResponseError{std::string{"Lz4 error decompressing: "} +
+                             ::LZ4F_getErrorName(ret)};
+    }
+    in_pos_ += src_size;
+    expected_ = ret;
+    if (dst_size > 0) {
+      return dst_size;
+    }
+    // No output produced: loop to feed the decoder more input
+  }
+}
@@ -0,0 +1,158 @@
+#include "databento/detail/mmap_file_stream.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // madvise, mmap, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close
+#endif
+
+#include <algorithm>  // copy, min
+#include <sstream>
+#include <utility>  // swap
+
+#include "databento/exceptions.hpp"
+
+using databento::detail::MmapFileStream;
+
+MmapFileStream::MmapFileStream(const std::string& file_path) {
+#ifdef _WIN32
+  file_handle_ =
+      ::CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                    OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file_handle_ == INVALID_HANDLE_VALUE) {
+    file_handle_ = nullptr;
+    throw InvalidArgumentError{"MmapFileStream", "file_path",
+                               "Non-existent or invalid file"};
+  }
+  LARGE_INTEGER file_size;
+  if (::GetFileSizeEx(file_handle_, &file_size) == 0) {
+    ::CloseHandle(file_handle_);
+    file_handle_ = nullptr;
+    throw InvalidArgumentError{"MmapFileStream", "file_path",
+                               "Unable to determine file size"};
+  }
+  size_ = static_cast<std::size_t>(file_size.QuadPart);
+  if (size_ == 0) {
+    // Can't create a zero-length file mapping on Windows
+    return;
+  }
+  mapping_handle_ = ::CreateFileMappingA(file_handle_, nullptr, PAGE_READONLY,
+                                         0, 0, nullptr);
+  if (mapping_handle_ == nullptr) {
+    ::CloseHandle(file_handle_);
+    file_handle_ = nullptr;
+    throw InvalidArgumentError{"MmapFileStream", "file_path",
+                               "Unable to memory map file"};
+  }
+  map_ = static_cast<const std::uint8_t*>(
+      ::MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+  if (map_ == nullptr) {
+    ::CloseHandle(mapping_handle_);
+    ::CloseHandle(file_handle_);
+    mapping_handle_ = nullptr;
+    file_handle_ = nullptr;
+    throw InvalidArgumentError{"MmapFileStream", "file_path",
+                               "Unable to memory map file"};
+  }
+#else
+  const int fd = ::open(file_path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw InvalidArgumentError{"MmapFileStream", "file_path",
+                               "Non-existent or invalid file"};
+  }
+  struct stat file_stat {};
+  if (::fstat(fd, &file_stat) != 0) {
+    ::close(fd);
+    throw InvalidArgumentError{"MmapFileStream", "file_path",
+                               "Unable to determine file size"};
+  }
+  size_ = static_cast<std::size_t>(file_stat.st_size);
+  if (size_ == 0) {
+    // Can't mmap an empty file
+    ::close(fd);
+    return;
+  }
+  void* map = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping remains valid after the file descriptor is closed
+  ::close(fd);
+  if (map == MAP_FAILED) {  // NOLINT(performance-no-int-to-ptr)
+    throw InvalidArgumentError{"MmapFileStream", "file_path",
+                               "Unable to memory map file"};
+  }
+  map_ = static_cast<const std::uint8_t*>(map);
+  // Readahead hint for the sequential decode access pattern
+  ::madvise(map, size_, MADV_SEQUENTIAL);
+#endif
+}
+
+MmapFileStream::MmapFileStream(MmapFileStream&& other) noexcept
+    : map_{other.map_}, size_{other.size_}, pos_{other.pos_} {
+  other.map_ = nullptr;
+  other.size_ = 0;
+  other.pos_ = 0;
+#ifdef _WIN32
+  file_handle_ = other.file_handle_;
+  mapping_handle_ = other.mapping_handle_;
+  other.file_handle_ = nullptr;
+  other.mapping_handle_ = nullptr;
+#endif
+}
+
+MmapFileStream& MmapFileStream::operator=(MmapFileStream&& rhs) noexcept {
+  std::swap(map_, rhs.map_);
+  std::swap(size_, rhs.size_);
+  std::swap(pos_, rhs.pos_);
+#ifdef _WIN32
+  std::swap(file_handle_, rhs.file_handle_);
+  std::swap(mapping_handle_, rhs.mapping_handle_);
+#endif
+  return *this;
+}
+
+MmapFileStream::~MmapFileStream() { Unmap(); }
+
+void MmapFileStream::Unmap() {
+  if (map_ != nullptr) {
+#ifdef _WIN32
+    ::UnmapViewOfFile(map_);
+#else
+    ::munmap(const_cast<std::uint8_t*>(map_), size_);
+#endif
+    map_ = nullptr;
+  }
+#ifdef _WIN32
+  if (mapping_handle_ != nullptr) {
+    ::CloseHandle(mapping_handle_);
+    mapping_handle_ = nullptr;
+  }
+  if (file_handle_ != nullptr) {
+    ::CloseHandle(file_handle_);
+    file_handle_ = nullptr;
+  }
+#endif
+}
+
+void MmapFileStream::ReadExact(std::uint8_t* buffer, std::size_t length) {
+  const auto size = ReadSome(buffer, length);
+  if (size != length) {
+    std::ostringstream err_msg;
+    err_msg << "Unexpected end of file, expected " << length << " bytes, got "
+            << size;
+    throw DbnResponseError{err_msg.str()};
+  }
+}
+
+void MmapFileStream::Seek(std::size_t offset) {
+  pos_ = std::min(offset, size_);
+}
+
+std::size_t MmapFileStream::ReadSome(std::uint8_t* buffer,
+                                     std::size_t max_length) {
+  const auto read_size = std::min(max_length, size_ - pos_);
+  std::copy(map_ + pos_, map_ + pos_ + read_size, buffer);
+  pos_ += read_size;
+  return read_size;
+}
@@ -0,0 +1,108 @@
+#include "databento/detail/prefetch_stream.hpp"
+
+#include <algorithm>  // copy_n, min
+#include <sstream>
+#include <utility>  // move
+
+#include "databento/exceptions.hpp"
+
+using databento::detail::PrefetchStream;
+
+namespace {
+constexpr std::size_t kDefaultBufferSize = 64UL * 1024;
+constexpr std::size_t kDefaultMaxBuffers = 4;
+}  // namespace
+
+PrefetchStream::PrefetchStream(std::unique_ptr<IReadable> source)
+    : PrefetchStream{std::move(source), kDefaultBufferSize,
+                     kDefaultMaxBuffers} {}
+
+PrefetchStream::PrefetchStream(std::unique_ptr<IReadable> source,
+                               std::size_t buffer_size,
+                               std::size_t max_buffers)
+    : source_{std::move(source)},
+      buffer_size_{std::max<std::size_t>(buffer_size, 1)},
+      max_buffers_{std::max<std::size_t>(max_buffers, 1)},
+      thread_{&PrefetchStream::ProcessSource, this} {}
+
+PrefetchStream::~PrefetchStream() {
+  {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    shutdown_ = true;
+  }
+  producer_cv_.notify_one();
+  // thread_ joins before the other members are destroyed
+}
+
+void PrefetchStream::ReadExact(std::uint8_t* buffer, std::size_t length) {
+  std::size_t size{};
+  while (size < length) {
+    const auto read_size = ReadSome(&buffer[size], length - size);
+    if (read_size == 0) {
+      std::ostringstream err_msg;
+      err_msg << "Unexpected end of stream, expected " << length
+              << " bytes, got " << size;
+      throw DbnResponseError{err_msg.str()};
+    }
+    size += read_size;
+  }
+}
+
+std::size_t PrefetchStream::ReadSome(std::uint8_t* buffer,
+                                     std::size_t max_length) {
+  if (current_idx_ == current_.size()) {
+    std::unique_lock<std::mutex> lock{mutex_};
+    consumer_cv_.wait(lock, [this] {
+      return !buffers_.empty() || finished_ || error_ != nullptr;
+    });
+    if (error_ != nullptr) {
+      std::exception_ptr error = std::move(error_);
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+    if (buffers_.empty()) {
+      // end of stream
+      return 0;
+    }
+    current_ = std::move(buffers_.front());
+    buffers_.pop_front();
+    current_idx_ = 0;
+    lock.unlock();
+    producer_cv_.notify_one();
+  }
+  const auto read_size =
+      std::min(max_length, current_.size() - current_idx_);
+  std::copy_n(current_.cbegin() + static_cast<std::ptrdiff_t>(current_idx_),
+              read_size, buffer);
+  current_idx_ += read_size;
+  return read_size;
+}
+
+void PrefetchStream::ProcessSource() {
+  while (true) {
+    std::vector<std::uint8_t> buffer(buffer_size_);
+    std::size_t read_size;
+    try {
+      read_size = source_->ReadSome(buffer.data(), buffer.size());
+    } catch (const std::exception&) {
+      const std::lock_guard<std::mutex> lock{mutex_};
+      error_ = std::current_exception();
+      consumer_cv_.notify_one();
+      return;
+    }
+    std::unique_lock<std::mutex> lock{mutex_};
+    if (read_size == 0) {
+      finished_ = true;
+      consumer_cv_.notify_one();
+      return;
+    }
+    buffer.resize(read_size);
+    buffers_.emplace_back(std::move(buffer));
+    consumer_cv_.notify_one();
+    producer_cv_.wait(
+        lock, [this] { return buffers_.size() < max_buffers_ || shutdown_; });
+    if (shutdown_) {
+      return;
+    }
+  }
+}
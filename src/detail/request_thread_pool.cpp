@@ -0,0 +1,47 @@
+#include "databento/detail/request_thread_pool.hpp"
+
+using databento::detail::RequestThreadPool;
+
+RequestThreadPool::RequestThreadPool(std::size_t thread_count)
+    : thread_count_{thread_count} {}
+
+RequestThreadPool::~RequestThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    is_shutting_down_ = true;
+  }
+  cv_.notify_all();
+  // ScopedThread joins each worker
+}
+
+void RequestThreadPool::SubmitTask(std::function<void()>&& task) {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (threads_.empty()) {
+      threads_.reserve(thread_count_);
+      for (std::size_t i = 0; i < thread_count_; ++i) {
+        threads_.emplace_back(&RequestThreadPool::ProcessTasks, this);
+      }
+    }
+    tasks_.emplace_back(std::move(task));
+  }
+  cv_.notify_one();
+}
+
+void RequestThreadPool::ProcessTasks() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock{mutex_};
+      cv_.wait(lock,
+               [this]() { return !tasks_.empty() || is_shutting_down_; });
+      if (tasks_.empty()) {
+        // shutting down and the queue is drained
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
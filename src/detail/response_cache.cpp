@@ -0,0 +1,115 @@
+#include "databento/detail/response_cache.hpp"
+
+#include <openssl/evp.h>  // EVP_Digest, EVP_sha256
+#include <sys/stat.h>     // mkdir
+#ifdef _WIN32
+#include <direct.h>  // _mkdir
+#endif
+
+#include <cstdint>  // uint8_t
+#include <cstdio>   // rename
+#include <ctime>    // gmtime_r, strftime, time
+#include <fstream>  // ifstream, ofstream
+#include <ios>       // ios::binary
+#include <iterator>  // istreambuf_iterator
+#include <sstream>  // ostringstream
+#include <utility>  // move
+
+#include "databento/log.hpp"  // ILogReceiver, LogLevel
+
+using databento::detail::ResponseCache;
+
+namespace {
+// Bump to invalidate all existing cache entries when the format changes
+constexpr const char* kCacheFormatVersion = "1";
+constexpr const char kHexDigits[] = "0123456789abcdef";
+
+std::string Sha256Hex(const std::string& data) {
+  std::uint8_t digest[EVP_MAX_MD_SIZE];
+  unsigned int digest_size{};
+  ::EVP_Digest(data.data(), data.size(), digest, &digest_size, ::EVP_sha256(),
+               nullptr);
+  std::string hex;
+  hex.reserve(digest_size * 2);
+  for (unsigned int i = 0; i < digest_size; ++i) {
+    hex.push_back(kHexDigits[digest[i] >> 4]);
+    hex.push_back(kHexDigits[digest[i] & 0xF]);
+  }
+  return hex;
+}
+
+std::string UtcDate() {
+  const std::time_t now = std::time(nullptr);
+  std::tm tm_buf{};
+#ifdef _WIN32
+  ::gmtime_s(&tm_buf, &now);
+#else
+  ::gmtime_r(&now, &tm_buf);
+#endif
+  char date[sizeof "2000-01-01"];
+  std::strftime(date, sizeof date, "%Y-%m-%d", &tm_buf);
+  return date;
+}
+}  // namespace
+
+ResponseCache::ResponseCache(databento::ILogReceiver* log_receiver,
+                             std::string cache_dir)
+    : log_receiver_{log_receiver}, cache_dir_{std::move(cache_dir)} {}
+
+std::string ResponseCache::Load(const std::string& path,
+                                const httplib::Params& params) {
+  std::ifstream file{EntryPath(path, params), std::ios::binary};
+  if (!file.is_open()) {
+    return {};
+  }
+  std::string contents{std::istreambuf_iterator<char>{file},
+                       std::istreambuf_iterator<char>{}};
+  if (!file.good() && !file.eof()) {
+    return {};
+  }
+  return contents;
+}
+
+void ResponseCache::Store(const std::string& path,
+                          const httplib::Params& params,
+                          const std::string& contents) {
+  const int ret =
+#ifdef _WIN32
+      ::_mkdir(cache_dir_.c_str());
+#else
+      ::mkdir(cache_dir_.c_str(), 0777);
+#endif
+  // EEXIST is expected on all but the first store
+  static_cast<void>(ret);
+  const std::string entry_path = EntryPath(path, params);
+  // write to a temporary file, then atomically rename into place so a
+  // concurrent reader never sees a partial entry
+  const std::string tmp_path = entry_path + ".tmp";
+  {
+    std::ofstream file{tmp_path, std::ios::binary | std::ios::trunc};
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    if (!file.good()) {
+      std::ostringstream log_ss;
+      log_ss << "[ResponseCache::Store] Failed to write cache entry "
+             << tmp_path;
+      log_receiver_->Receive(LogLevel::Warning, log_ss.str());
+      return;
+    }
+  }
+  if (std::rename(tmp_path.c_str(), entry_path.c_str()) != 0) {
+    std::ostringstream log_ss;
+    log_ss << "[ResponseCache::Store] Failed to rename cache entry into place "
+           << entry_path;
+    log_receiver_->Receive(LogLevel::Warning, log_ss.str());
+  }
+}
+
+std::string ResponseCache::EntryPath(const std::string& path,
+                                     const httplib::Params& params) const {
+  std::ostringstream key;
+  key << kCacheFormatVersion << '\n' << path << '\n' << UtcDate() << '\n';
+  for (const auto& param : params) {
+    key << param.first << '=' << param.second << '\n';
+  }
+  return cache_dir_ + '/' + Sha256Hex(key.str()) + ".dbc";
+}
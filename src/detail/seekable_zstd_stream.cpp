@@ -0,0 +1,137 @@
+#include "databento/detail/seekable_zstd_stream.hpp"
+
+#include <algorithm>  // min, upper_bound
+#include <array>
+#include <cstring>  // memcpy
+#include <fstream>
+#include <sstream>
+#include <utility>  // move
+
+#include "databento/detail/file_stream.hpp"
+#include "databento/exceptions.hpp"
+
+using databento::detail::SeekableZstdStream;
+
+namespace {
+constexpr std::uint32_t kSkippableMagicNumber = 0x184D2A5E;
+constexpr std::uint32_t kSeekableMagicNumber = 0x8F92EAB1;
+// num_frames, seek table descriptor, and the seekable magic number
+constexpr std::size_t kSeekTableFooterSize = 9;
+// Indicates each seek table entry has a per-frame checksum
+constexpr std::uint8_t kChecksumFlag = 1U << 7;
+
+template <typename T>
+T ReadScalar(const std::uint8_t* buffer) {
+  T res;
+  std::memcpy(&res, buffer, sizeof(T));
+  return res;
+}
+}  // namespace
+
+SeekableZstdStream::SeekableZstdStream(const std::string& file_path)
+    : file_path_{file_path} {
+  ReadSeekTable();
+  Seek(0);
+}
+
+void SeekableZstdStream::ReadSeekTable() {
+  std::ifstream file{file_path_, std::ios::binary | std::ios::ate};
+  if (file.fail()) {
+    throw InvalidArgumentError{"SeekableZstdStream::SeekableZstdStream",
+                               "file_path", "Non-existent or invalid file"};
+  }
+  const auto file_size = static_cast<std::size_t>(file.tellg());
+  std::array<std::uint8_t, kSeekTableFooterSize> footer;
+  if (file_size < footer.size()) {
+    throw DbnResponseError{"Missing Zstd seek table"};
+  }
+  file.seekg(-static_cast<std::streamoff>(footer.size()), std::ios::end);
+  file.read(reinterpret_cast<char*>(footer.data()),
+            static_cast<std::streamsize>(footer.size()));
+  if (ReadScalar<std::uint32_t>(&footer[5]) != kSeekableMagicNumber) {
+    throw DbnResponseError{"Missing Zstd seek table"};
+  }
+  const auto num_frames = ReadScalar<std::uint32_t>(&footer[0]);
+  const auto descriptor = footer[4];
+  const std::size_t entry_size = (descriptor & kChecksumFlag) ? 12 : 8;
+  const auto table_size =
+      8 + num_frames * entry_size + kSeekTableFooterSize;
+  if (file_size < table_size) {
+    throw DbnResponseError{"Invalid Zstd seek table size"};
+  }
+  std::vector<std::uint8_t> table(num_frames * entry_size + 8);
+  file.seekg(-static_cast<std::streamoff>(table_size), std::ios::end);
+  file.read(reinterpret_cast<char*>(table.data()),
+            static_cast<std::streamsize>(table.size()));
+  if (file.gcount() != static_cast<std::streamsize>(table.size()) ||
+      ReadScalar<std::uint32_t>(&table[0]) != kSkippableMagicNumber) {
+    throw DbnResponseError{"Invalid Zstd seek table frame"};
+  }
+  frames_.reserve(num_frames);
+  std::uint64_t compressed_offset{};
+  std::uint64_t decompressed_offset{};
+  for (std::uint32_t i = 0; i < num_frames; ++i) {
+    const auto* entry = &table[8 + i * entry_size];
+    frames_.emplace_back(Frame{compressed_offset, decompressed_offset});
+    compressed_offset += ReadScalar<std::uint32_t>(entry);
+    decompressed_offset += ReadScalar<std::uint32_t>(entry + 4);
+  }
+  size_ = static_cast<std::size_t>(decompressed_offset);
+}
+
+void SeekableZstdStream::ReadExact(std::uint8_t* buffer, std::size_t length) {
+  std::size_t size{};
+  while (size < length) {
+    const auto read_size = ReadSome(&buffer[size], length - size);
+    if (read_size == 0) {
+      std::ostringstream err_msg;
+      err_msg << "Unexpected end of file, expected " << length
+              << " bytes, got " << size;
+      throw DbnResponseError{err_msg.str()};
+    }
+    size += read_size;
+  }
+}
+
+std::size_t SeekableZstdStream::ReadSome(std::uint8_t* buffer,
+                                         std::size_t max_length) {
+  const auto remaining = size_ - pos_;
+  if (remaining == 0) {
+    return 0;
+  }
+  const auto read_size =
+      zstd_->ReadSome(buffer, std::min(max_length, remaining));
+  pos_ += read_size;
+  return read_size;
+}
+
+void SeekableZstdStream::Seek(std::size_t offset) {
+  pos_ = std::min(offset, size_);
+  // The first frame at or after pos_, so the preceding frame contains it
+  auto frame_it =
+      std::upper_bound(frames_.cbegin(), frames_.cend(), pos_,
+                       [](std::size_t target, const Frame& frame) {
+                         return target < frame.decompressed_offset;
+                       });
+  std::unique_ptr<IReadable> input{new FileStream{file_path_}};
+  if (frame_it != frames_.cbegin()) {
+    --frame_it;
+    input->Seek(static_cast<std::size_t>(frame_it->compressed_offset));
+  }
+  zstd_.reset(new ZstdStream{std::move(input)});
+  // Decompress and discard up to the target offset within the frame
+  auto skip_remaining =
+      frame_it == frames_.cend()
+          ? std::size_t{0}
+          : pos_ - static_cast<std::size_t>(frame_it->decompressed_offset);
+  std::array<std::uint8_t, 4096> scratch;
+  while (skip_remaining > 0) {
+    const auto read_size = zstd_->ReadSome(
+        scratch.data(), std::min(skip_remaining, scratch.size()));
+    if (read_size == 0) {
+      throw DbnResponseError{
+          "Unexpected end of Zstd frame while seeking"};
+    }
+    skip_remaining -= read_size;
+  }
+}
@@ -1,18 +1,36 @@
 #include "databento/detail/shared_channel.hpp"
 
+#include <algorithm>  // min
+#include <atomic>
 #include <condition_variable>
+#include <cstring>  // memcpy
 #include <memory>
 #include <mutex>
-#include <sstream>  // stringstream
+#include <sstream>  // ostringstream
+#include <utility>  // move
 #include <vector>
 
+#include "databento/detail/buffer_pool.hpp"
 #include "databento/exceptions.hpp"  // DbnResponseError
 
+namespace {
+// The fixed channel capacity. Must be a power of two so positions can be
+// mapped into the buffer with a mask.
+constexpr std::size_t kChannelCapacity = 1UL << 20;
+constexpr std::size_t kChannelCapacityMask = kChannelCapacity - 1;
+}  // namespace
+
 namespace databento {
 namespace detail {
+// A fixed-capacity single-producer/single-consumer ring buffer. The hot path
+// is lock-free: the producer and consumer each advance only their own
+// monotonic position and read the other's atomically. The mutex and
+// condition variables are only used to park a side that finds the channel
+// empty (consumer) or full (producer); the parked flags let the other side
+// skip notification entirely when no one is waiting.
 class SharedChannel::Channel {
  public:
-  Channel() = default;
+  Channel(std::size_t high_watermark, std::size_t low_watermark);
   Channel(const Channel&) = delete;
   Channel& operator=(const Channel&) = delete;
   Channel(Channel&&) = delete;
@@ -21,28 +39,46 @@ class SharedChannel::Channel {
 
   void Write(const std::uint8_t* data, std::size_t length);
   void Finish();
+  void Abort();
   // Read exactly `length` bytes
   void ReadExact(std::uint8_t* buffer, std::size_t length);
   // Read at most `length` bytes. Returns the number of bytes read. Will only
   // return 0 if the end of the stream is reached.
   std::size_t ReadSome(std::uint8_t* buffer, std::size_t length);
+  std::size_t BytesBuffered() const {
+    return static_cast<std::size_t>(write_pos_.load() - read_pos_.load());
+  }
 
  private:
-  std::size_t Size();
-
-  // protects all other data members of this class
+  std::vector<std::uint8_t> buffer_;
+  // The writer parks while this many bytes are buffered
+  const std::size_t high_watermark_;
+  // A parked reader isn't woken until this many bytes are buffered
+  const std::size_t low_watermark_;
+  // Total bytes ever written; advanced only by the producer
+  std::atomic<std::uint64_t> write_pos_{0};
+  // Total bytes ever read; advanced only by the consumer
+  std::atomic<std::uint64_t> read_pos_{0};
+  std::atomic<bool> is_finished_{false};
+  // Whether the reader closed the channel; writes are discarded
+  std::atomic<bool> is_aborted_{false};
+  std::atomic<bool> reader_parked_{false};
+  std::atomic<bool> writer_parked_{false};
+  // Only for parking; never held while copying data
   std::mutex mutex_;
-  // could use eofbit, but seekg clears this
-  bool is_finished_{false};
-  std::condition_variable cv_;
-  std::stringstream stream_;
+  std::condition_variable read_cv_;
+  std::condition_variable write_cv_;
 };
 }  // namespace detail
 }  // namespace databento
 
 using databento::detail::SharedChannel;
 
-SharedChannel::SharedChannel() : channel_{std::make_shared<Channel>()} {}
+SharedChannel::SharedChannel() : SharedChannel{kChannelCapacity, 1} {}
+
+SharedChannel::SharedChannel(std::size_t high_watermark,
+                             std::size_t low_watermark)
+    : channel_{std::make_shared<Channel>(high_watermark, low_watermark)} {}
 
 void SharedChannel::Write(const std::uint8_t* data, std::size_t length) {
   channel_->Write(data, length);
@@ -50,6 +86,8 @@ void SharedChannel::Write(const std::uint8_t* data, std::size_t length) {
 
 void SharedChannel::Finish() { channel_->Finish(); }
 
+void SharedChannel::Abort() { channel_->Abort(); }
+
 void SharedChannel::ReadExact(std::uint8_t* buffer, std::size_t length) {
   channel_->ReadExact(buffer, length);
 }
@@ -61,54 +99,131 @@ std::size_t SharedChannel::ReadSome(std::uint8_t* buffer,
   return channel_->ReadSome(buffer, max_length);
 }
 
-SharedChannel::Channel::~Channel() { Finish(); }
+std::size_t SharedChannel::BytesBuffered() const {
+  return channel_->BytesBuffered();
+}
+
+SharedChannel::Channel::Channel(std::size_t high_watermark,
+                                std::size_t low_watermark)
+    : buffer_{BufferPool::Shared().Acquire(kChannelCapacity)},
+      high_watermark_{std::min(high_watermark, kChannelCapacity)},
+      low_watermark_{std::max<std::size_t>(low_watermark, 1)} {
+  buffer_.resize(kChannelCapacity);
+  if (low_watermark_ > high_watermark_) {
+    throw InvalidArgumentError{
+        "SharedChannel::SharedChannel", "low_watermark",
+        "Cannot be greater than the high watermark"};
+  }
+}
+
+SharedChannel::Channel::~Channel() {
+  Finish();
+  BufferPool::Shared().Release(std::move(buffer_));
+}
 
+// The default sequentially-consistent ordering is relied upon throughout so
+// a parked flag set before sleeping can't be missed by the other side after
+// it publishes a new position.
 void SharedChannel::Channel::Write(const std::uint8_t* data,
                                    std::size_t length) {
-  const std::lock_guard<std::mutex> lock{mutex_};
-  stream_.write(reinterpret_cast<const char*>(data),
-                static_cast<std::streamsize>(length));
-  cv_.notify_one();
+  std::size_t written{};
+  while (written < length) {
+    if (is_aborted_.load()) {
+      return;
+    }
+    const auto write_pos = write_pos_.load();
+    const auto buffered =
+        static_cast<std::size_t>(write_pos - read_pos_.load());
+    if (buffered >= high_watermark_) {
+      std::unique_lock<std::mutex> lock{mutex_};
+      writer_parked_.store(true);
+      write_cv_.wait(lock, [this, write_pos] {
+        return write_pos - read_pos_.load() < high_watermark_ ||
+               is_aborted_.load();
+      });
+      writer_parked_.store(false);
+      continue;
+    }
+    const auto free_space = high_watermark_ - buffered;
+    const auto chunk_size = std::min(length - written, free_space);
+    const auto idx =
+        static_cast<std::size_t>(write_pos) & kChannelCapacityMask;
+    const auto contiguous = std::min(chunk_size, kChannelCapacity - idx);
+    std::memcpy(&buffer_[idx], &data[written], contiguous);
+    std::memcpy(buffer_.data(), &data[written + contiguous],
+                chunk_size - contiguous);
+    write_pos_.store(write_pos + chunk_size);
+    written += chunk_size;
+    if (reader_parked_.load() &&
+        write_pos + chunk_size - read_pos_.load() >= low_watermark_) {
+      // Taking the mutex guarantees the reader is either already parked and
+      // will see the notification, or hasn't rechecked its predicate yet
+      { const std::lock_guard<std::mutex> lock{mutex_}; }
+      read_cv_.notify_one();
+    }
+  }
 }
 
 void SharedChannel::Channel::Finish() {
-  const std::lock_guard<std::mutex> lock{mutex_};
-  is_finished_ = true;
-  cv_.notify_one();
+  is_finished_.store(true);
+  { const std::lock_guard<std::mutex> lock{mutex_}; }
+  read_cv_.notify_one();
+}
+
+void SharedChannel::Channel::Abort() {
+  is_aborted_.store(true);
+  is_finished_.store(true);
+  { const std::lock_guard<std::mutex> lock{mutex_}; }
+  read_cv_.notify_one();
+  write_cv_.notify_one();
 }
 
 void SharedChannel::Channel::ReadExact(std::uint8_t* buffer,
                                        std::size_t length) {
-  std::unique_lock<std::mutex> lock{mutex_};
-  cv_.wait(lock, [this, length] { return Size() >= length || is_finished_; });
-  if (Size() < length) {
-    std::ostringstream err_msg;
-    err_msg << "Reached end of the stream with only " << Size()
-            << " bytes remaining";
-    throw DbnResponseError{err_msg.str()};
+  std::size_t size{};
+  while (size < length) {
+    const auto read_size = ReadSome(&buffer[size], length - size);
+    if (read_size == 0) {
+      std::ostringstream err_msg;
+      err_msg << "Reached end of the stream with only " << size
+              << " bytes remaining";
+      throw DbnResponseError{err_msg.str()};
+    }
+    size += read_size;
   }
-  stream_.read(reinterpret_cast<char*>(buffer),
-               static_cast<std::streamsize>(length));
 }
 
 std::size_t SharedChannel::Channel::ReadSome(std::uint8_t* buffer,
                                              std::size_t length) {
-  std::unique_lock<std::mutex> lock{mutex_};
-  cv_.wait(lock, [this] { return Size() > 0 || is_finished_; });
-  if (Size() == 0) {
-    return 0;
+  while (true) {
+    const auto read_pos = read_pos_.load();
+    const auto available =
+        static_cast<std::size_t>(write_pos_.load() - read_pos);
+    if (available > 0) {
+      const auto chunk_size = std::min(available, length);
+      const auto idx =
+          static_cast<std::size_t>(read_pos) & kChannelCapacityMask;
+      const auto contiguous = std::min(chunk_size, kChannelCapacity - idx);
+      std::memcpy(buffer, &buffer_[idx], contiguous);
+      std::memcpy(&buffer[contiguous], buffer_.data(),
+                  chunk_size - contiguous);
+      read_pos_.store(read_pos + chunk_size);
+      if (writer_parked_.load() &&
+          write_pos_.load() - (read_pos + chunk_size) < high_watermark_) {
+        { const std::lock_guard<std::mutex> lock{mutex_}; }
+        write_cv_.notify_one();
+      }
+      return chunk_size;
+    }
+    if (is_finished_.load()) {
+      return 0;
+    }
+    std::unique_lock<std::mutex> lock{mutex_};
+    reader_parked_.store(true);
+    read_cv_.wait(lock, [this, read_pos] {
+      return write_pos_.load() - read_pos >= low_watermark_ ||
+             is_finished_.load();
+    });
+    reader_parked_.store(false);
   }
-  stream_.read(reinterpret_cast<char*>(buffer),
-               static_cast<std::streamsize>(std::min(Size(), length)));
-  return static_cast<std::size_t>(stream_.gcount());
-}
-
-// lock_ must be held to call this method
-std::size_t SharedChannel::Channel::Size() {
-  const auto pos = stream_.tellg();
-  stream_.seekg(0, std::ios::end);
-  const auto remaining = stream_.tellg() - pos;
-  // reset state
-  stream_.seekg(pos, std::ios::beg);
-  return static_cast<std::size_t>(remaining);
 }
@@ -0,0 +1,56 @@
+#include "databento/detail/spsc_record_queue.hpp"
+
+#include <cstring>  // memcpy
+
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+
+using databento::detail::SpscRecordQueue;
+
+namespace {
+std::size_t NextPowerOfTwo(std::size_t size) {
+  std::size_t res = 2;
+  while (res < size) {
+    res <<= 1;
+  }
+  return res;
+}
+}  // namespace
+
+SpscRecordQueue::SpscRecordQueue(std::size_t capacity)
+    : mask_{NextPowerOfTwo(capacity) - 1},
+      storage_((mask_ + 1) * kMaxRecordLen) {}
+
+bool SpscRecordQueue::TryPush(const Record& record) {
+  if (record.Size() > kMaxRecordLen) {
+    // A corrupt length byte would otherwise write past the slot, and for
+    // the last slot past the end of the storage. Thrown rather than
+    // returned as false, which callers treat as queue-full and may retry
+    // forever
+    throw InvalidArgumentError{"SpscRecordQueue::TryPush", "record",
+                               "Larger than kMaxRecordLen"};
+  }
+  const auto head = head_.load(std::memory_order_relaxed);
+  const auto tail = tail_.load(std::memory_order_acquire);
+  if (head - tail > mask_) {
+    return false;
+  }
+  std::memcpy(&storage_[SlotOffset(head)], &record.Header(), record.Size());
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+const databento::Record* SpscRecordQueue::TryPop() {
+  auto tail = tail_.load(std::memory_order_relaxed);
+  if (release_pending_) {
+    ++tail;
+    tail_.store(tail, std::memory_order_release);
+    release_pending_ = false;
+  }
+  if (head_.load(std::memory_order_acquire) == tail) {
+    return nullptr;
+  }
+  current_record_ =
+      Record{reinterpret_cast<RecordHeader*>(&storage_[SlotOffset(tail)])};
+  release_pending_ = true;
+  return &current_record_;
+}
@@ -3,21 +3,30 @@
 #ifdef _WIN32
 #include <winsock2.h>  // closesocket, recv, send, socket
 #else
-#include <netdb.h>       // addrinfo, gai_strerror, getaddrinfo, freeaddrinfo
-#include <netinet/in.h>  // htons, IPPROTO_TCP
-#include <sys/poll.h>    // pollfd, POLLHUP
+#include <fcntl.h>        // fcntl, F_GETFL, F_SETFL, O_NONBLOCK
+#include <netdb.h>        // addrinfo, gai_strerror, getaddrinfo, freeaddrinfo
+#include <netinet/in.h>   // htons, IPPROTO_TCP
+#include <netinet/tcp.h>  // TCP_NODELAY
+#include <sys/poll.h>     // pollfd, POLLHUP
 #include <sys/socket.h>  // AF_INET, connect, recv, send, sockaddr, sockaddr_in, socket, SOCK_STREAM
-#include <unistd.h>  // close, ssize_t
+#include <sys/uio.h>  // iovec, writev
+#include <unistd.h>   // close, ssize_t
 
-#include <cerrno>  // errno
+#include <cerrno>   // errno
+#include <climits>  // IOV_MAX
 #endif
 
 #include <algorithm>  // max
+#include <cstring>    // memcpy
 #include <memory>     // unique_ptr
 #include <sstream>
 #include <thread>
+#include <utility>  // move
 
 #include "databento/exceptions.hpp"  // TcpError
+#ifdef __linux__
+#include "databento/detail/io_uring_receiver.hpp"
+#endif
 
 using databento::detail::TcpClient;
 
@@ -29,14 +38,106 @@ int GetErrNo() {
   return errno;
 #endif
 }
+
+void SetSockOpt(databento::detail::Socket fd, int level, int opt_name,
+                int opt_val, const char* opt_desc) {
+#ifdef _WIN32
+  const auto res = ::setsockopt(
+      fd, level, opt_name, reinterpret_cast<const char*>(&opt_val),
+      sizeof(opt_val));
+#else
+  const auto res = ::setsockopt(fd, level, opt_name, &opt_val,
+                                sizeof(opt_val));
+#endif
+  if (res != 0) {
+    throw databento::TcpError{::GetErrNo(),
+                              std::string{"Failed to set "} + opt_desc};
+  }
+}
+
+void ApplySocketConf(databento::detail::Socket fd,
+                     const TcpClient::SocketConf& socket_conf) {
+  if (socket_conf.tcp_nodelay) {
+    ::SetSockOpt(fd, IPPROTO_TCP, TCP_NODELAY, 1, "TCP_NODELAY");
+  }
+  if (socket_conf.recv_buffer_size > 0) {
+    ::SetSockOpt(fd, SOL_SOCKET, SO_RCVBUF,
+                 static_cast<int>(socket_conf.recv_buffer_size), "SO_RCVBUF");
+  }
+  if (socket_conf.busy_poll_duration.count() > 0) {
+#ifdef SO_BUSY_POLL
+    ::SetSockOpt(fd, SOL_SOCKET, SO_BUSY_POLL,
+                 static_cast<int>(socket_conf.busy_poll_duration.count()),
+                 "SO_BUSY_POLL");
+#endif
+  }
+  if (socket_conf.prefer_busy_poll) {
+#if defined(SO_PREFER_BUSY_POLL) && defined(SO_BUSY_POLL_BUDGET)
+    ::SetSockOpt(fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, 1,
+                 "SO_PREFER_BUSY_POLL");
+    if (socket_conf.busy_poll_budget > 0) {
+      ::SetSockOpt(fd, SOL_SOCKET, SO_BUSY_POLL_BUDGET,
+                   static_cast<int>(socket_conf.busy_poll_budget),
+                   "SO_BUSY_POLL_BUDGET");
+    }
+#endif
+  }
+}
+
+void SetNonBlocking(databento::detail::Socket fd) {
+#ifdef _WIN32
+  u_long mode = 1;
+  ::ioctlsocket(fd, FIONBIO, &mode);
+#else
+  const int flags = ::fcntl(fd, F_GETFL, 0);
+  ::fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+#endif
+}
+
+void SetBlocking(databento::detail::Socket fd) {
+#ifdef _WIN32
+  u_long mode = 0;
+  ::ioctlsocket(fd, FIONBIO, &mode);
+#else
+  const int flags = ::fcntl(fd, F_GETFL, 0);
+  ::fcntl(fd, F_SETFL, flags & ~O_NONBLOCK);
+#endif
+}
 }  // namespace
 
 TcpClient::TcpClient(const std::string& gateway, std::uint16_t port)
-    : TcpClient{gateway, port, {}} {}
+    : TcpClient{gateway, port, {}, {}} {}
 
 TcpClient::TcpClient(const std::string& gateway, std::uint16_t port,
                      RetryConf retry_conf)
-    : socket_{InitSocket(gateway, port, retry_conf)} {}
+    : TcpClient{gateway, port, retry_conf, {}} {}
+
+TcpClient::TcpClient(const std::string& gateway, std::uint16_t port,
+                     RetryConf retry_conf, SocketConf socket_conf)
+    : socket_{InitSocket(gateway, port, retry_conf, socket_conf)} {
+  InitIoUring(socket_conf);
+}
+
+TcpClient::TcpClient(const AddressList& addresses, RetryConf retry_conf,
+                     SocketConf socket_conf)
+    : socket_{InitSocket(addresses, retry_conf, socket_conf)} {
+  InitIoUring(socket_conf);
+}
+
+void TcpClient::InitIoUring(const SocketConf& socket_conf) {
+  if (socket_conf.io_uring) {
+#ifdef __linux__
+    uring_.reset(new IoUringReceiver{socket_.Get()});
+#else
+    throw InvalidArgumentError{"TcpClient::TcpClient", "socket_conf",
+                               "io_uring is only supported on Linux"};
+#endif
+  }
+}
+
+TcpClient::TcpClient(TcpClient&&) noexcept = default;
+TcpClient& TcpClient::operator=(TcpClient&&) noexcept = default;
+TcpClient::~TcpClient() = default;
 
 void TcpClient::WriteAll(const std::string& str) {
   WriteAll(str.c_str(), str.length());
@@ -53,7 +154,110 @@ void TcpClient::WriteAll(const char* buffer, std::size_t size) {
   } while (size > 0);
 }
 
+void TcpClient::WriteAllVectored(const std::vector<std::string>& buffers) {
+#ifdef _WIN32
+  std::vector<WSABUF> iov;
+  iov.reserve(buffers.size());
+  for (const auto& buffer : buffers) {
+    if (!buffer.empty()) {
+      iov.push_back({static_cast<ULONG>(buffer.size()),
+                     const_cast<char*>(buffer.data())});
+    }
+  }
+  std::size_t first{};
+  while (first < iov.size()) {
+    DWORD res{};
+    if (::WSASend(socket_.Get(), &iov[first],
+                  static_cast<DWORD>(iov.size() - first), &res, 0, nullptr,
+                  nullptr) != 0) {
+      throw TcpError{::GetErrNo(), "Error writing to socket"};
+    }
+    auto written = static_cast<std::size_t>(res);
+    while (first < iov.size() && written >= iov[first].len) {
+      written -= iov[first].len;
+      ++first;
+    }
+    if (written > 0) {
+      iov[first].buf += written;
+      iov[first].len -= static_cast<ULONG>(written);
+    }
+  }
+#else
+#ifdef IOV_MAX
+  constexpr std::size_t kMaxIovCount = IOV_MAX;
+#else
+  // the minimum guaranteed by POSIX
+  constexpr std::size_t kMaxIovCount = 16;
+#endif
+  std::vector<iovec> iov;
+  iov.reserve(buffers.size());
+  for (const auto& buffer : buffers) {
+    if (!buffer.empty()) {
+      iov.push_back({const_cast<char*>(buffer.data()), buffer.size()});
+    }
+  }
+  std::size_t first{};
+  while (first < iov.size()) {
+    const auto iov_count = std::min(iov.size() - first, kMaxIovCount);
+    const ::ssize_t res =
+        ::writev(socket_.Get(), &iov[first], static_cast<int>(iov_count));
+    if (res < 0) {
+      throw TcpError{::GetErrNo(), "Error writing to socket"};
+    }
+    auto written = static_cast<std::size_t>(res);
+    while (first < iov.size() && written >= iov[first].iov_len) {
+      written -= iov[first].iov_len;
+      ++first;
+    }
+    if (written > 0) {
+      iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + written;
+      iov[first].iov_len -= written;
+    }
+  }
+#endif
+}
+
+TcpClient::Result TcpClient::ReadSomeNonBlocking(char* buffer,
+                                                 std::size_t max_size) {
+#ifdef _WIN32
+  // Windows has no MSG_DONTWAIT, so check for readiness with a zero timeout
+  WSAPOLLFD fds{socket_.Get(), POLLIN, {}};
+  const int poll_status = ::WSAPoll(&fds, 1, 0);
+  if (poll_status == 0) {
+    return {0, Status::Timeout};
+  }
+  if (poll_status < 0) {
+    throw TcpError{::GetErrNo(), "Incorrect poll"};
+  }
+  return ReadSome(buffer, max_size);
+#else
+  const ::ssize_t res = ::recv(socket_.Get(), buffer, max_size, MSG_DONTWAIT);
+  if (res < 0) {
+    const int err_num = ::GetErrNo();
+    if (err_num == EAGAIN || err_num == EWOULDBLOCK) {
+      return {0, Status::Timeout};
+    }
+    throw TcpError{err_num, "Error reading from socket"};
+  }
+  return {static_cast<std::size_t>(res),
+          res == 0 ? Status::Closed : Status::Ok};
+#endif
+}
+
 void TcpClient::ReadExact(char* buffer, std::size_t size) {
+#ifdef __linux__
+  if (uring_) {
+    std::size_t read_size{};
+    while (read_size < size) {
+      const auto res = uring_->Receive(&buffer[read_size], size - read_size);
+      if (res == 0) {
+        throw TcpError{ECONNRESET, "Error reading from socket"};
+      }
+      read_size += res;
+    }
+    return;
+  }
+#endif
   const ::ssize_t res = ::recv(socket_.Get(), buffer, size, MSG_WAITALL);
   if (res != static_cast<::ssize_t>(size)) {
     throw TcpError{::GetErrNo(), "Error reading from socket"};
@@ -61,6 +265,12 @@ void TcpClient::ReadExact(char* buffer, std::size_t size) {
 }
 
 TcpClient::Result TcpClient::ReadSome(char* buffer, std::size_t max_size) {
+#ifdef __linux__
+  if (uring_) {
+    const auto read_size = uring_->Receive(buffer, max_size);
+    return {read_size, read_size == 0 ? Status::Closed : Status::Ok};
+  }
+#endif
   const ::ssize_t res = ::recv(socket_.Get(), buffer, max_size, {});
   if (res < 0) {
     throw TcpError{::GetErrNo(), "Error reading from socket"};
@@ -71,6 +281,11 @@ TcpClient::Result TcpClient::ReadSome(char* buffer, std::size_t max_size) {
 
 TcpClient::Result TcpClient::ReadSome(char* buffer, std::size_t max_size,
                                       std::chrono::milliseconds timeout) {
+#ifdef __linux__
+  if (uring_) {
+    return uring_->Receive(buffer, max_size, timeout);
+  }
+#endif
   pollfd fds{socket_.Get(), POLLIN, {}};
   // passing a timeout of -1 blocks indefinitely, which is the equivalent of
   // having no timeout
@@ -99,15 +314,8 @@ TcpClient::Result TcpClient::ReadSome(char* buffer, std::size_t max_size,
 
 void TcpClient::Close() { socket_.Close(); }
 
-databento::detail::ScopedFd TcpClient::InitSocket(const std::string& gateway,
-                                                  std::uint16_t port,
-                                                  RetryConf retry_conf) {
-  const detail::Socket fd = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-  if (fd == -1) {
-    throw TcpError{::GetErrNo(), "Failed to create socket"};
-  }
-  ScopedFd scoped_fd{fd};
-
+TcpClient::AddressList TcpClient::Resolve(const std::string& gateway,
+                                          std::uint16_t port) {
   addrinfo hints{};
   hints.ai_flags = AI_PASSIVE;
   hints.ai_family = AF_INET;
@@ -117,25 +325,124 @@ databento::detail::ScopedFd TcpClient::InitSocket(const std::string& gateway,
   const auto ret = ::getaddrinfo(gateway.c_str(), std::to_string(port).c_str(),
                                  &hints, &out);
   if (ret != 0) {
-    throw InvalidArgumentError{"TcpClient::TcpClient", "addr",
+    throw InvalidArgumentError{"TcpClient::Resolve", "addr",
                                ::gai_strerror(ret)};
   }
   std::unique_ptr<addrinfo, decltype(&::freeaddrinfo)> res{out,
                                                            &::freeaddrinfo};
+  AddressList addresses;
+  for (const addrinfo* it = res.get(); it != nullptr; it = it->ai_next) {
+    Address address{};
+    std::memcpy(&address.storage, it->ai_addr, it->ai_addrlen);
+    address.length = static_cast<socklen_t>(it->ai_addrlen);
+    addresses.emplace_back(address);
+  }
+  if (addresses.empty()) {
+    throw InvalidArgumentError{"TcpClient::Resolve", "addr",
+                               "Resolved to no addresses"};
+  }
+  return addresses;
+}
+
+databento::detail::ScopedFd TcpClient::InitSocket(const std::string& gateway,
+                                                  std::uint16_t port,
+                                                  RetryConf retry_conf,
+                                                  SocketConf socket_conf) {
+  return InitSocket(Resolve(gateway, port), retry_conf, socket_conf);
+}
+
+databento::detail::ScopedFd TcpClient::InitSocket(const AddressList& addresses,
+                                                  RetryConf retry_conf,
+                                                  SocketConf socket_conf) {
   const auto max_attempts = std::max<std::uint32_t>(retry_conf.max_attempts, 1);
   std::chrono::seconds backoff{1};
-  for (std::uint32_t attempt = 0; attempt < max_attempts; ++attempt) {
-    if (::connect(scoped_fd.Get(), res->ai_addr, res->ai_addrlen) == 0) {
-      break;
-    } else if (attempt + 1 == max_attempts) {
-      std::ostringstream err_msg;
-      err_msg << "Socket failed to connect after " << max_attempts
-              << " attempts";
-      throw TcpError{::GetErrNo(), err_msg.str()};
+  for (std::uint32_t attempt = 0;; ++attempt) {
+    try {
+      return ConnectAny(addresses, socket_conf);
+    } catch (const TcpError& exc) {
+      if (attempt + 1 == max_attempts) {
+        std::ostringstream err_msg;
+        err_msg << "Socket failed to connect after " << max_attempts
+                << " attempts";
+        throw TcpError{exc.ErrNum(), err_msg.str()};
+      }
     }
     // TODO(cg): Log
     std::this_thread::sleep_for(backoff);
     backoff = (std::min)(backoff * 2, retry_conf.max_wait);
   }
-  return scoped_fd;
+}
+
+databento::detail::ScopedFd TcpClient::ConnectAny(
+    const AddressList& addresses, const SocketConf& socket_conf) {
+  std::vector<ScopedFd> pending;
+  int last_err{};
+  for (const auto& address : addresses) {
+    const detail::Socket fd =
+        ::socket(address.storage.ss_family, SOCK_STREAM, IPPROTO_TCP);
+    if (fd == ScopedFd::kUnset) {
+      last_err = ::GetErrNo();
+      continue;
+    }
+    ScopedFd scoped_fd{fd};
+    ::ApplySocketConf(fd, socket_conf);
+    ::SetNonBlocking(fd);
+    if (::connect(fd, reinterpret_cast<const sockaddr*>(&address.storage),
+                  address.length) == 0) {
+      ::SetBlocking(fd);
+      return scoped_fd;
+    }
+    const int err = ::GetErrNo();
+#ifdef _WIN32
+    if (err == WSAEWOULDBLOCK) {
+#else
+    if (err == EINPROGRESS) {
+#endif
+      pending.emplace_back(std::move(scoped_fd));
+    } else {
+      last_err = err;
+    }
+  }
+  // Wait for the remaining handshakes, dropping addresses as they fail
+  while (!pending.empty()) {
+    std::vector<pollfd> fds;
+    fds.reserve(pending.size());
+    for (const auto& scoped_fd : pending) {
+      fds.push_back({scoped_fd.Get(), POLLOUT, {}});
+    }
+    const int poll_res =
+#ifdef _WIN32
+        ::WSAPoll(fds.data(), static_cast<ULONG>(fds.size()), -1);
+#else
+        ::poll(fds.data(), fds.size(), -1);
+#endif
+    if (poll_res < 0) {
+      const int err = ::GetErrNo();
+      if (err == EAGAIN || err == EINTR) {
+        continue;
+      }
+      throw TcpError{err, "Incorrect poll"};
+    }
+    for (std::size_t i = fds.size(); i-- > 0;) {
+      if (fds[i].revents == 0) {
+        continue;
+      }
+      int err{};
+      auto err_len = static_cast<socklen_t>(sizeof(err));
+#ifdef _WIN32
+      ::getsockopt(pending[i].Get(), SOL_SOCKET, SO_ERROR,
+                   reinterpret_cast<char*>(&err), &err_len);
+#else
+      ::getsockopt(pending[i].Get(), SOL_SOCKET, SO_ERROR, &err, &err_len);
+#endif
+      if (err == 0) {
+        ScopedFd connected{std::move(pending[i])};
+        ::SetBlocking(connected.Get());
+        return connected;
+      }
+      last_err = err;
+      pending.erase(pending.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+  }
+  throw TcpError{last_err, "Failed to connect to any gateway address"};
 }
@@ -0,0 +1,139 @@
+#include "databento/detail/work_stealing_executor.hpp"
+
+#include <algorithm>  // max
+#include <chrono>     // milliseconds
+#include <thread>     // hardware_concurrency
+
+using databento::detail::WorkStealingExecutor;
+
+namespace {
+// The executor the current thread is a worker of, if any, and its index.
+// Used to route nested submissions to the worker's own deque.
+thread_local WorkStealingExecutor* t_executor = nullptr;
+thread_local std::size_t t_worker_index = 0;
+}  // namespace
+
+WorkStealingExecutor& WorkStealingExecutor::Shared() {
+  static WorkStealingExecutor executor{std::max<std::size_t>(
+      1, std::thread::hardware_concurrency())};
+  return executor;
+}
+
+WorkStealingExecutor::WorkStealingExecutor(std::size_t thread_count,
+                                           std::size_t queue_capacity)
+    : thread_count_{std::max<std::size_t>(1, thread_count)},
+      queue_capacity_{std::max<std::size_t>(1, queue_capacity)} {
+  workers_.reserve(thread_count_);
+  for (std::size_t i = 0; i < thread_count_; ++i) {
+    workers_.emplace_back(new Worker{});
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    is_shutting_down_ = true;
+  }
+  idle_cv_.notify_all();
+  space_cv_.notify_all();
+  // ScopedThread joins each worker
+}
+
+void WorkStealingExecutor::SubmitTask(std::function<void()>&& task) {
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (threads_.empty()) {
+      SpawnThreadsLocked();
+    }
+  }
+  if (t_executor == this) {
+    // Nested submission: push to the submitting worker's own deque
+    Worker& own = *workers_[t_worker_index];
+    {
+      std::lock_guard<std::mutex> lock{own.mutex};
+      if (own.tasks.size() < queue_capacity_) {
+        own.tasks.emplace_back(std::move(task));
+        idle_cv_.notify_one();
+        return;
+      }
+    }
+    // The deque is full: running inline bounds queued memory and can't
+    // deadlock, unlike blocking a worker for space
+    task();
+    return;
+  }
+  for (;;) {
+    for (std::size_t attempt = 0; attempt < thread_count_; ++attempt) {
+      std::size_t index;
+      {
+        std::lock_guard<std::mutex> lock{mutex_};
+        index = next_worker_;
+        next_worker_ = (next_worker_ + 1) % thread_count_;
+      }
+      Worker& worker = *workers_[index];
+      const std::lock_guard<std::mutex> lock{worker.mutex};
+      if (worker.tasks.size() < queue_capacity_) {
+        worker.tasks.emplace_back(std::move(task));
+        idle_cv_.notify_one();
+        return;
+      }
+    }
+    // Every deque is full: block until a worker makes space
+    std::unique_lock<std::mutex> lock{mutex_};
+    space_cv_.wait_for(lock, std::chrono::milliseconds{1});
+  }
+}
+
+void WorkStealingExecutor::SpawnThreadsLocked() {
+  threads_.reserve(thread_count_);
+  for (std::size_t i = 0; i < thread_count_; ++i) {
+    threads_.emplace_back(&WorkStealingExecutor::WorkerLoop, this, i);
+  }
+}
+
+void WorkStealingExecutor::WorkerLoop(std::size_t index) {
+  t_executor = this;
+  t_worker_index = index;
+  while (true) {
+    std::function<void()> task;
+    if (PopOwn(index, &task) || Steal(index, &task)) {
+      space_cv_.notify_one();
+      task();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock{mutex_};
+    if (is_shutting_down_) {
+      // Drained its own deque and found nothing to steal
+      return;
+    }
+    // The timeout covers the unlocked window between the deque scans and
+    // this wait, where a submission's notify could be missed
+    idle_cv_.wait_for(lock, std::chrono::milliseconds{50});
+  }
+}
+
+bool WorkStealingExecutor::PopOwn(std::size_t index,
+                                  std::function<void()>* task) {
+  Worker& worker = *workers_[index];
+  const std::lock_guard<std::mutex> lock{worker.mutex};
+  if (worker.tasks.empty()) {
+    return false;
+  }
+  *task = std::move(worker.tasks.back());
+  worker.tasks.pop_back();
+  return true;
+}
+
+bool WorkStealingExecutor::Steal(std::size_t index,
+                                 std::function<void()>* task) {
+  for (std::size_t i = 1; i < thread_count_; ++i) {
+    Worker& victim = *workers_[(index + i) % thread_count_];
+    const std::lock_guard<std::mutex> lock{victim.mutex};
+    if (!victim.tasks.empty()) {
+      *task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,135 @@
+#include "databento/detail/zstd_compress_stream.hpp"
+
+#include <algorithm>  // min
+#include <exception>
+#include <limits>
+#include <string>
+#include <utility>  // move
+
+#include "databento/exceptions.hpp"
+
+using databento::detail::ZstdCompressStream;
+
+namespace {
+constexpr int kDefaultCompressionLevel = 3;
+constexpr std::uint32_t kSkippableMagicNumber = 0x184D2A5E;
+constexpr std::uint32_t kSeekableMagicNumber = 0x8F92EAB1;
+// num_frames, seek table descriptor, and the seekable magic number
+constexpr std::size_t kSeekTableFooterSize = 9;
+
+template <typename T>
+void EmitScalar(std::vector<std::uint8_t>* buffer, T value) {
+  const auto* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+  buffer->insert(buffer->end(), bytes, bytes + sizeof(T));
+}
+}  // namespace
+
+ZstdCompressStream::ZstdCompressStream(std::unique_ptr<IWritable> output)
+    : ZstdCompressStream{kDefaultCompressionLevel, std::move(output)} {}
+
+ZstdCompressStream::ZstdCompressStream(int compression_level,
+                                       std::unique_ptr<IWritable> output)
+    : ZstdCompressStream{compression_level, 0, std::move(output)} {}
+
+ZstdCompressStream::ZstdCompressStream(int compression_level,
+                                       std::size_t seekable_frame_size,
+                                       std::unique_ptr<IWritable> output)
+    : output_{std::move(output)},
+      z_cstream_{::ZSTD_createCStream(), ::ZSTD_freeCStream},
+      out_buffer_(::ZSTD_CStreamOutSize()),
+      seekable_frame_size_{seekable_frame_size} {
+  if (seekable_frame_size_ > std::numeric_limits<std::uint32_t>::max() / 2) {
+    // seek table entries are 32-bit
+    throw InvalidArgumentError{
+        "ZstdCompressStream::ZstdCompressStream", "seekable_frame_size",
+        "Seekable frames must be smaller than 2 GiB"};
+  }
+  const auto ret = ::ZSTD_initCStream(z_cstream_.get(), compression_level);
+  if (::ZSTD_isError(ret)) {
+    throw DbnResponseError{std::string{"Zstd error initializing: "} +
+                           ::ZSTD_getErrorName(ret)};
+  }
+}
+
+ZstdCompressStream::~ZstdCompressStream() {
+  // Errors are swallowed because destructors shouldn't throw
+  try {
+    if (seekable_frame_size_ == 0) {
+      ZSTD_inBuffer z_in_buffer{nullptr, 0, 0};
+      Compress(&z_in_buffer, ZSTD_e_end);
+    } else {
+      if (frame_decompressed_ > 0 || frame_entries_.empty()) {
+        EndFrame();
+      }
+      WriteSeekTable();
+    }
+  } catch (const std::exception&) {
+  }
+}
+
+void ZstdCompressStream::WriteAll(const std::uint8_t* buffer,
+                                  std::size_t length) {
+  if (seekable_frame_size_ == 0) {
+    ZSTD_inBuffer z_in_buffer{buffer, length, 0};
+    Compress(&z_in_buffer, ZSTD_e_continue);
+    return;
+  }
+  std::size_t pos{};
+  while (pos < length) {
+    const auto chunk_size = std::min(
+        length - pos, seekable_frame_size_ - frame_decompressed_);
+    ZSTD_inBuffer z_in_buffer{&buffer[pos], chunk_size, 0};
+    Compress(&z_in_buffer, ZSTD_e_continue);
+    frame_decompressed_ += chunk_size;
+    pos += chunk_size;
+    if (frame_decompressed_ == seekable_frame_size_) {
+      EndFrame();
+    }
+  }
+}
+
+void ZstdCompressStream::Compress(ZSTD_inBuffer* z_in_buffer,
+                                  ZSTD_EndDirective directive) {
+  std::size_t remaining;
+  do {
+    ZSTD_outBuffer z_out_buffer{out_buffer_.data(), out_buffer_.size(), 0};
+    remaining = ::ZSTD_compressStream2(z_cstream_.get(), &z_out_buffer,
+                                       z_in_buffer, directive);
+    if (::ZSTD_isError(remaining)) {
+      throw DbnResponseError{std::string{"Zstd error compressing: "} +
+                             ::ZSTD_getErrorName(remaining)};
+    }
+    if (z_out_buffer.pos > 0) {
+      output_->WriteAll(out_buffer_.data(), z_out_buffer.pos);
+      frame_compressed_ += z_out_buffer.pos;
+    }
+  } while (z_in_buffer->pos < z_in_buffer->size ||
+           (directive == ZSTD_e_end && remaining != 0));
+}
+
+void ZstdCompressStream::EndFrame() {
+  ZSTD_inBuffer z_in_buffer{nullptr, 0, 0};
+  Compress(&z_in_buffer, ZSTD_e_end);
+  frame_entries_.emplace_back(
+      FrameEntry{static_cast<std::uint32_t>(frame_compressed_),
+                 static_cast<std::uint32_t>(frame_decompressed_)});
+  frame_compressed_ = 0;
+  frame_decompressed_ = 0;
+}
+
+void ZstdCompressStream::WriteSeekTable() {
+  std::vector<std::uint8_t> table;
+  table.reserve(8 + frame_entries_.size() * 8 + kSeekTableFooterSize);
+  EmitScalar(&table, kSkippableMagicNumber);
+  EmitScalar(&table, static_cast<std::uint32_t>(frame_entries_.size() * 8 +
+                                                kSeekTableFooterSize));
+  for (const auto& entry : frame_entries_) {
+    EmitScalar(&table, entry.compressed_size);
+    EmitScalar(&table, entry.decompressed_size);
+  }
+  EmitScalar(&table, static_cast<std::uint32_t>(frame_entries_.size()));
+  // seek table descriptor: no per-frame checksums
+  EmitScalar(&table, std::uint8_t{0});
+  EmitScalar(&table, kSeekableMagicNumber);
+  output_->WriteAll(table.data(), table.size());
+}
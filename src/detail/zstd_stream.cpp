@@ -1,22 +1,104 @@
 #include "databento/detail/zstd_stream.hpp"
 
+#include <mutex>
 #include <sstream>
 #include <utility>  // move
 
+#include "databento/detail/buffer_pool.hpp"
+#include "databento/detail/prefetch_stream.hpp"
 #include "databento/exceptions.hpp"
 
+using databento::detail::ZstdDecodeDict;
 using databento::detail::ZstdStream;
 
+namespace {
+// Caps the number of idle decompression contexts retained for reuse
+constexpr std::size_t kMaxPooledDStreams = 16;
+
+std::mutex dstream_pool_mutex;
+std::vector<ZSTD_DStream*> dstream_pool;
+
+ZSTD_DStream* AcquireDStream() {
+  {
+    const std::lock_guard<std::mutex> lock{dstream_pool_mutex};
+    if (!dstream_pool.empty()) {
+      auto* dstream = dstream_pool.back();
+      dstream_pool.pop_back();
+      return dstream;
+    }
+  }
+  return ::ZSTD_createDStream();
+}
+
+// Deleter for pooled contexts: returns the context for reuse instead of
+// freeing it, matching the signature of ZSTD_freeDStream.
+std::size_t ReleaseDStream(ZSTD_DStream* dstream) {
+  {
+    const std::lock_guard<std::mutex> lock{dstream_pool_mutex};
+    if (dstream_pool.size() < kMaxPooledDStreams) {
+      dstream_pool.emplace_back(dstream);
+      return 0;
+    }
+  }
+  return ::ZSTD_freeDStream(dstream);
+}
+}  // namespace
+
+ZstdDecodeDict::ZstdDecodeDict(const std::uint8_t* dict_data, std::size_t size)
+    : ddict_{::ZSTD_createDDict(dict_data, size), ::ZSTD_freeDDict} {
+  if (ddict_ == nullptr) {
+    throw databento::InvalidArgumentError{
+        "ZstdDecodeDict::ZstdDecodeDict", "dict_data",
+        "Failed to create Zstd dictionary"};
+  }
+}
+
+std::unique_ptr<databento::IReadable> ZstdStream::CreatePipelined(
+    std::unique_ptr<IReadable> input) {
+  return std::unique_ptr<IReadable>{new PrefetchStream{
+      std::unique_ptr<IReadable>{new ZstdStream{std::move(input)}}}};
+}
+
 ZstdStream::ZstdStream(std::unique_ptr<IReadable> input)
-    : ZstdStream{std::move(input), {}} {}
+    : ZstdStream{std::move(input), {}, nullptr} {}
 
 ZstdStream::ZstdStream(std::unique_ptr<IReadable> input,
                        std::vector<std::uint8_t>&& in_buffer)
+    : ZstdStream{std::move(input), std::move(in_buffer), nullptr} {}
+
+ZstdStream::ZstdStream(std::unique_ptr<IReadable> input,
+                       std::shared_ptr<const ZstdDecodeDict> dict)
+    : ZstdStream{std::move(input), {}, std::move(dict)} {}
+
+ZstdStream::ZstdStream(std::unique_ptr<IReadable> input,
+                       std::vector<std::uint8_t>&& in_buffer,
+                       std::shared_ptr<const ZstdDecodeDict> dict)
     : input_{std::move(input)},
-      z_dstream_{::ZSTD_createDStream(), ::ZSTD_freeDStream},
-      read_suggestion_{::ZSTD_initDStream(z_dstream_.get())},
+      dict_{std::move(dict)},
+      z_dstream_{AcquireDStream(), ReleaseDStream},
+      read_suggestion_{InitDStream()},
       in_buffer_{std::move(in_buffer)},
-      z_in_buffer_{in_buffer_.data(), in_buffer_.size(), 0} {}
+      z_in_buffer_{in_buffer_.data(), in_buffer_.size(), 0} {
+  if (in_buffer_.capacity() == 0) {
+    // Start from a recycled buffer; ReadSome sizes it to zstd's suggestion
+    in_buffer_ = BufferPool::Shared().Acquire(read_suggestion_);
+  }
+}
+
+ZstdStream::~ZstdStream() {
+  BufferPool::Shared().Release(std::move(in_buffer_));
+}
+
+std::size_t ZstdStream::InitDStream() {
+  if (dict_ == nullptr) {
+    return ::ZSTD_initDStream(z_dstream_.get());
+  }
+  // The stable equivalent of ZSTD_initDStream_usingDDict, which is
+  // deprecated and hidden behind ZSTD_STATIC_LINKING_ONLY in zstd 1.5
+  ::ZSTD_DCtx_reset(z_dstream_.get(), ZSTD_reset_session_only);
+  ::ZSTD_DCtx_refDDict(z_dstream_.get(), dict_->Get());
+  return ::ZSTD_DStreamInSize();
+}
 
 void ZstdStream::ReadExact(std::uint8_t* buffer, std::size_t length) {
   std::size_t size{};
@@ -44,7 +126,7 @@ size_t ZstdStream::ReadSome(std::uint8_t* buffer, std::size_t max_length) {
     }
     if (read_suggestion_ == 0) {
       // next frame
-      read_suggestion_ = ::ZSTD_initDStream(z_dstream_.get());
+      read_suggestion_ = InitDStream();
     }
     const auto new_size = unread_input + read_suggestion_;
     if (new_size != in_buffer_.size()) {
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <algorithm>  // lower_bound
+#include <cstddef>
+#include <cstring>  // strcmp
+#include <string>
+
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+
+namespace databento {
+namespace detail {
+// An enum value paired with its string name, for the sparse enums whose
+// values can't index a dense table. Tables are sorted by value.
+template <typename E>
+struct ValueName {
+  E value;
+  const char* name;
+};
+
+template <typename E>
+bool ValueNameLess(const ValueName<E>& entry, E value) {
+  return entry.value < value;
+}
+
+// A string name paired with the enum value it parses to. Tables are sorted
+// by strcmp order of the names.
+template <typename E>
+struct NamedValue {
+  const char* name;
+  E value;
+};
+
+template <typename E>
+bool NamedValueLess(const NamedValue<E>& entry, const char* name) {
+  return std::strcmp(entry.name, name) < 0;
+}
+
+// Looks up the name for a dense enum: a bounds check and an index. nullptr
+// entries mark gaps in the value range.
+template <std::size_t N>
+const char* NameAt(const char* const (&table)[N], std::size_t idx,
+                   const char* unknown) {
+  return idx < N && table[idx] != nullptr ? table[idx] : unknown;
+}
+
+// Looks up the name for a sparse enum with a binary search by value.
+template <typename E, std::size_t N>
+const char* FindName(const ValueName<E> (&table)[N], E value,
+                     const char* unknown) {
+  const auto* it =
+      std::lower_bound(table, table + N, value, ValueNameLess<E>);
+  return it != table + N && it->value == value ? it->name : unknown;
+}
+
+// Parses an enum with a binary search by name.
+template <typename E, std::size_t N>
+E FindValue(const char* method, const NamedValue<E> (&table)[N],
+            const std::string& str) {
+  const auto* it =
+      std::lower_bound(table, table + N, str.c_str(), NamedValueLess<E>);
+  if (it != table + N && str == it->name) {
+    return it->value;
+  }
+  throw InvalidArgumentError{method, "str", "unknown value '" + str + '\''};
+}
+}  // namespace detail
+}  // namespace databento
@@ -5,6 +5,7 @@
 #include <string>
 
 #include "databento/exceptions.hpp"  // InvalidArgumentError
+#include "enum_lookup_helper.hpp"    // FindName, FindValue, NameAt
 
 namespace databento {
 const char* UrlFromGateway(HistoricalGateway gateway) {
@@ -22,487 +23,183 @@ const char* UrlFromGateway(HistoricalGateway gateway) {
 }
 
 const char* ToString(Schema schema) {
-  switch (schema) {
-    case Schema::Mbo: {
-      return "mbo";
-    }
-    case Schema::Mbp1: {
-      return "mbp-1";
-    }
-    case Schema::Mbp10: {
-      return "mbp-10";
-    }
-    case Schema::Tbbo: {
-      return "tbbo";
-    }
-    case Schema::Trades: {
-      return "trades";
-    }
-    case Schema::Ohlcv1S: {
-      return "ohlcv-1s";
-    }
-    case Schema::Ohlcv1M: {
-      return "ohlcv-1m";
-    }
-    case Schema::Ohlcv1H: {
-      return "ohlcv-1h";
-    }
-    case Schema::Ohlcv1D: {
-      return "ohlcv-1d";
-    }
-    case Schema::Definition: {
-      return "definition";
-    }
-    case Schema::Imbalance: {
-      return "imbalance";
-    }
-    case Schema::Statistics: {
-      return "statistics";
-    }
-    case Schema::Status: {
-      return "status";
-    }
-    default: {
-      return "unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {
+      "mbo",      "mbp-1",    "mbp-10",     "tbbo",      "trades",
+      "ohlcv-1s", "ohlcv-1m", "ohlcv-1h",   "ohlcv-1d",  "definition",
+      "statistics", "status", "imbalance"};
+  return detail::NameAt(kNames, static_cast<std::uint16_t>(schema), "unknown");
 }
 
 const char* ToString(Encoding encoding) {
-  switch (encoding) {
-    case Encoding::Dbn: {
-      return "dbn";
-    }
-    case Encoding::Csv: {
-      return "csv";
-    }
-    case Encoding::Json: {
-      return "json";
-    }
-    default: {
-      return "unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {"dbn", "csv", "json"};
+  return detail::NameAt(kNames, static_cast<std::uint8_t>(encoding), "unknown");
 }
 
 const char* ToString(FeedMode mode) {
-  switch (mode) {
-    case FeedMode::Historical: {
-      return "historical";
-    }
-    case FeedMode::HistoricalStreaming: {
-      return "historical-streaming";
-    }
-    case FeedMode::Live: {
-      return "live";
-    }
-    default: {
-      return "unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {"historical",
+                                           "historical-streaming", "live"};
+  return detail::NameAt(kNames, static_cast<std::uint8_t>(mode), "unknown");
 }
 
 const char* ToString(Compression compression) {
-  switch (compression) {
-    case Compression::None: {
-      return "none";
-    }
-    case Compression::Zstd: {
-      return "zstd";
-    }
-    default: {
-      return "unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {"none", "zstd"};
+  return detail::NameAt(kNames, static_cast<std::uint8_t>(compression),
+                        "unknown");
 }
 
 const char* ToString(SType stype) {
-  switch (stype) {
-    case SType::InstrumentId: {
-      return "instrument_id";
-    }
-    case SType::RawSymbol: {
-      return "raw_symbol";
-    }
-    case SType::Continuous: {
-      return "continuous";
-    }
-    case SType::Parent: {
-      return "parent";
-    }
-    default: {
-      return "unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {"instrument_id", "raw_symbol",
+                                           nullptr, "continuous", "parent"};
+  return detail::NameAt(kNames, static_cast<std::uint8_t>(stype), "unknown");
 }
 
 const char* ToString(SplitDuration duration_interval) {
-  switch (duration_interval) {
-    case SplitDuration::Day: {
-      return "day";
-    }
-    case SplitDuration::Week: {
-      return "week";
-    }
-    case SplitDuration::Month: {
-      return "month";
-    }
-    case SplitDuration::None: {
-      return "none";
-    }
-    default: {
-      return "unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {"day", "week", "month", "none"};
+  return detail::NameAt(kNames, static_cast<std::uint8_t>(duration_interval),
+                        "unknown");
 }
 
 const char* ToString(Packaging packaging) {
-  switch (packaging) {
-    case Packaging::None: {
-      return "none";
-    }
-    case Packaging::Zip: {
-      return "zip";
-    }
-    case Packaging::Tar: {
-      return "tar";
-    }
-    default: {
-      return "unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {"none", "zip", "tar"};
+  return detail::NameAt(kNames, static_cast<std::uint8_t>(packaging),
+                        "unknown");
 }
 
 const char* ToString(Delivery delivery) {
-  switch (delivery) {
-    case Delivery::Download: {
-      return "download";
-    }
-    case Delivery::S3: {
-      return "s3";
-    }
-    case Delivery::Disk: {
-      return "disk";
-    }
-    default: {
-      return "unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {"download", "s3", "disk"};
+  return detail::NameAt(kNames, static_cast<std::uint8_t>(delivery), "unknown");
 }
 
 const char* ToString(JobState state) {
-  switch (state) {
-    case JobState::Received: {
-      return "received";
-    }
-    case JobState::Queued: {
-      return "queued";
-    }
-    case JobState::Processing: {
-      return "processing";
-    }
-    case JobState::Done: {
-      return "done";
-    }
-    case JobState::Expired: {
-      return "expired";
-    }
-    default: {
-      return "unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {"received", "queued", "processing",
+                                           "done", "expired"};
+  return detail::NameAt(kNames, static_cast<std::uint8_t>(state), "unknown");
 }
 
 const char* ToString(DatasetCondition condition) {
-  switch (condition) {
-    case DatasetCondition::Available: {
-      return "available";
-    }
-    case DatasetCondition::Degraded: {
-      return "degraded";
-    }
-    case DatasetCondition::Pending: {
-      return "pending";
-    }
-    case DatasetCondition::Missing: {
-      return "missing";
-    }
-    case DatasetCondition::Bad: {  // Deprecated
-      return "bad";
-    }
-    default: {
-      return "unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {
+      "available", "degraded", "pending", "missing",
+      "bad"  // Deprecated
+  };
+  return detail::NameAt(kNames, static_cast<std::uint8_t>(condition),
+                        "unknown");
 }
 
 const char* ToString(RType rtype) {
-  switch (rtype) {
-    case RType::Mbp0: {
-      return "Mbp0";
-    }
-    case RType::Mbp1: {
-      return "Mbp1";
-    }
-    case RType::Mbp10: {
-      return "Mbp10";
-    }
-    case RType::OhlcvDeprecated: {
-      return "OhlcvDeprecated";
-    }
-    case RType::Ohlcv1S: {
-      return "Ohlcv1S";
-    }
-    case RType::Ohlcv1M: {
-      return "Ohlcv1M";
-    }
-    case RType::Ohlcv1H: {
-      return "Ohlcv1H";
-    }
-    case RType::Ohlcv1D: {
-      return "Ohlcv1D";
-    }
-    case RType::InstrumentDef: {
-      return "InstrumentDef";
-    }
-    case RType::Imbalance: {
-      return "Imbalance";
-    }
-    case RType::Error: {
-      return "Error";
-    }
-    case RType::SymbolMapping: {
-      return "SymbolMapping";
-    }
-    case RType::System: {
-      return "System";
-    }
-    case RType::Statistics: {
-      return "Statistics";
-    }
-    case RType::Mbo: {
-      return "Mbo";
-    }
-    default: {
-      return "Unknown";
-    }
-  }
+  static constexpr detail::ValueName<RType> kNames[] = {
+      {RType::Mbp0, "Mbp0"},
+      {RType::Mbp1, "Mbp1"},
+      {RType::Mbp10, "Mbp10"},
+      {RType::OhlcvDeprecated, "OhlcvDeprecated"},
+      {RType::InstrumentDef, "InstrumentDef"},
+      {RType::Imbalance, "Imbalance"},
+      {RType::Error, "Error"},
+      {RType::SymbolMapping, "SymbolMapping"},
+      {RType::System, "System"},
+      {RType::Statistics, "Statistics"},
+      {RType::Ohlcv1S, "Ohlcv1S"},
+      {RType::Ohlcv1M, "Ohlcv1M"},
+      {RType::Ohlcv1H, "Ohlcv1H"},
+      {RType::Ohlcv1D, "Ohlcv1D"},
+      {RType::Mbo, "Mbo"}};
+  return detail::FindName(kNames, rtype, "Unknown");
 }
 
 const char* ToString(Action action) {
-  switch (action) {
-    case Action::Modify: {
-      return "Modify";
-    }
-    case Action::Trade: {
-      return "Trade";
-    }
-    case Action::Fill: {
-      return "Fill";
-    }
-    case Action::Cancel: {
-      return "Cancel";
-    }
-    case Action::Add: {
-      return "Add";
-    }
-    case Action::Clear: {
-      return "Clear";
-    }
-    default: {
-      return "Unknown";
-    }
-  }
+  static constexpr detail::ValueName<Action> kNames[] = {
+      {Action::Add, "Add"},       {Action::Cancel, "Cancel"},
+      {Action::Fill, "Fill"},     {Action::Modify, "Modify"},
+      {Action::Clear, "Clear"},   {Action::Trade, "Trade"}};
+  return detail::FindName(kNames, action, "Unknown");
 }
 
 const char* ToString(Side side) {
-  switch (side) {
-    case Side::Ask: {
-      return "Ask";
-    }
-    case Side::Bid: {
-      return "Bid";
-    }
-    case Side::None: {
-      return "None";
-    }
-    default: {
-      return "Unknown";
-    }
-  }
+  static constexpr detail::ValueName<Side> kNames[] = {
+      {Side::Ask, "Ask"}, {Side::Bid, "Bid"}, {Side::None, "None"}};
+  return detail::FindName(kNames, side, "Unknown");
 }
 
 const char* ToString(InstrumentClass instrument_class) {
-  switch (instrument_class) {
-    case instrument_class::Bond: {
-      return "Bond";
-    }
-    case instrument_class::Call: {
-      return "Call";
-    }
-    case instrument_class::Future: {
-      return "Future";
-    }
-    case instrument_class::Stock: {
-      return "Stock";
-    }
-    case instrument_class::MixedSpread: {
-      return "MixedSpread";
-    }
-    case instrument_class::Put: {
-      return "Put";
-    }
-    case instrument_class::FutureSpread: {
-      return "FutureSpread";
-    }
-    case instrument_class::OptionSpread: {
-      return "OptionSpread";
-    }
-    case instrument_class::FxSpot: {
-      return "FxSpot";
-    }
-    default: {
-      return "Unknown";
-    }
-  }
+  static constexpr detail::ValueName<InstrumentClass> kNames[] = {
+      {instrument_class::Bond, "Bond"},
+      {instrument_class::Call, "Call"},
+      {instrument_class::Future, "Future"},
+      {instrument_class::Stock, "Stock"},
+      {instrument_class::MixedSpread, "MixedSpread"},
+      {instrument_class::Put, "Put"},
+      {instrument_class::FutureSpread, "FutureSpread"},
+      {instrument_class::OptionSpread, "OptionSpread"},
+      {instrument_class::FxSpot, "FxSpot"}};
+  return detail::FindName(kNames, instrument_class, "Unknown");
 }
 
 const char* ToString(MatchAlgorithm match_algorithm) {
-  switch (match_algorithm) {
-    case match_algorithm::Fifo: {
-      return "Fifo";
-    }
-    case match_algorithm::Configurable: {
-      return "Configurable";
-    }
-    case match_algorithm::ProRata: {
-      return "ProRata";
-    }
-    case match_algorithm::FifoLmm: {
-      return "FifoLmm";
-    }
-    case match_algorithm::ThresholdProRata: {
-      return "ThresholdProRata";
-    }
-    case match_algorithm::FifoTopLmm: {
-      return "FifoTopLmm";
-    }
-    case match_algorithm::ThresholdProRataLmm: {
-      return "ThresholdProRataLmm";
-    }
-    case match_algorithm::EurodollarOptions: {
-      return "EurodollarOptions";
-    }
-    default: {
-      return "Unknown";
-    }
-  }
+  static constexpr detail::ValueName<MatchAlgorithm> kNames[] = {
+      {match_algorithm::ProRata, "ProRata"},
+      {match_algorithm::Fifo, "Fifo"},
+      {match_algorithm::Configurable, "Configurable"},
+      {match_algorithm::ThresholdProRata, "ThresholdProRata"},
+      {match_algorithm::ThresholdProRataLmm, "ThresholdProRataLmm"},
+      {match_algorithm::FifoTopLmm, "FifoTopLmm"},
+      {match_algorithm::FifoLmm, "FifoLmm"},
+      {match_algorithm::EurodollarOptions, "EurodollarOptions"}};
+  return detail::FindName(kNames, match_algorithm, "Unknown");
 }
 
 const char* ToString(SecurityUpdateAction update_action) {
-  switch (update_action) {
-    case SecurityUpdateAction::Add: {
-      return "Add";
-    }
-    case SecurityUpdateAction::Modify: {
-      return "Modify";
-    }
-    case SecurityUpdateAction::Delete: {
-      return "Delete";
-    }
-    default: {
-      return "Unknown";
-    }
-  }
+  static constexpr detail::ValueName<SecurityUpdateAction> kNames[] = {
+      {SecurityUpdateAction::Add, "Add"},
+      {SecurityUpdateAction::Delete, "Delete"},
+      {SecurityUpdateAction::Modify, "Modify"}};
+  return detail::FindName(kNames, update_action, "Unknown");
 }
 
 const char* ToString(UserDefinedInstrument user_def_instr) {
-  switch (user_def_instr) {
-    case UserDefinedInstrument::No: {
-      return "No";
-    }
-    case UserDefinedInstrument::Yes: {
-      return "Yes";
-    }
-    default: {
-      return "Unknown";
-    }
-  }
+  static constexpr detail::ValueName<UserDefinedInstrument> kNames[] = {
+      {UserDefinedInstrument::No, "No"}, {UserDefinedInstrument::Yes, "Yes"}};
+  return detail::FindName(kNames, user_def_instr, "Unknown");
 }
 
 const char* ToString(StatType stat_type) {
-  switch (stat_type) {
-    case StatType::OpeningPrice: {
-      return "OpeningPrice";
-    }
-    case StatType::IndicativeOpeningPrice: {
-      return "IndicativeOpeningPrice";
-    }
-    case StatType::SettlementPrice: {
-      return "SettlementPrice";
-    }
-    case StatType::TradingSessionLowPrice: {
-      return "TradingSessionLowPrice";
-    }
-    case StatType::TradingSessionHighPrice: {
-      return "TradingSessionHighPrice";
-    }
-    case StatType::ClearedVolume: {
-      return "ClearedVolume";
-    }
-    case StatType::LowestOffer: {
-      return "LowestOffer";
-    }
-    case StatType::HighestBid: {
-      return "HighestBid";
-    }
-    case StatType::OpenInterest: {
-      return "OpenInterest";
-    }
-    case StatType::FixingPrice: {
-      return "FixingPrice";
-    }
-    case StatType::ClosePrice: {
-      return "ClosePrice";
-    }
-    case StatType::NetChange: {
-      return "NetChange";
-    }
-    case StatType::Vwap: {
-      return "Vwap";
-    }
-    default: {
-      return "Unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {nullptr,
+                                           "OpeningPrice",
+                                           "IndicativeOpeningPrice",
+                                           "SettlementPrice",
+                                           "TradingSessionLowPrice",
+                                           "TradingSessionHighPrice",
+                                           "ClearedVolume",
+                                           "LowestOffer",
+                                           "HighestBid",
+                                           "OpenInterest",
+                                           "FixingPrice",
+                                           "ClosePrice",
+                                           "NetChange",
+                                           "Vwap"};
+  return detail::NameAt(kNames, static_cast<std::uint16_t>(stat_type),
+                        "Unknown");
 }
 
 const char* ToString(StatUpdateAction stat_update_action) {
-  switch (stat_update_action) {
-    case StatUpdateAction::New: {
-      return "New";
-    }
-    case StatUpdateAction::Delete: {
-      return "Delete";
-    }
-    default: {
-      return "Unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {nullptr, "New", "Delete"};
+  return detail::NameAt(kNames, static_cast<std::uint8_t>(stat_update_action),
+                        "Unknown");
 }
 
 const char* ToString(VersionUpgradePolicy upgrade_policy) {
-  switch (upgrade_policy) {
-    case VersionUpgradePolicy::AsIs: {
-      return "AsIs";
-    }
-    case VersionUpgradePolicy::Upgrade: {
-      return "Upgrade";
-    }
-    default: {
-      return "Unknown";
-    }
-  }
+  static constexpr const char* kNames[] = {"AsIs", "Upgrade"};
+  return detail::NameAt(kNames, static_cast<std::uint8_t>(upgrade_policy),
+                        "Unknown");
+}
+
+const char* ToString(DecodeStatus status) {
+  static constexpr const char* kNames[] = {
+      "ok",
+      "end of input",
+      "timed out waiting for a record",
+      "gateway closed the session",
+      "malformed input",
+      "internal error"};
+  return detail::NameAt(kNames, static_cast<std::uint8_t>(status), "unknown");
 }
 
 std::ostream& operator<<(std::ostream& out, Schema schema) {
@@ -609,198 +306,104 @@ std::ostream& operator<<(std::ostream& out,
   return out;
 }
 
+std::ostream& operator<<(std::ostream& out, DecodeStatus status) {
+  out << ToString(status);
+  return out;
+}
+
 template <>
 Schema FromString(const std::string& str) {
-  if (str == "mbo") {
-    return Schema::Mbo;
-  }
-  if (str == "mbp-1") {
-    return Schema::Mbp1;
-  }
-  if (str == "mbp-10") {
-    return Schema::Mbp10;
-  }
-  if (str == "tbbo") {
-    return Schema::Tbbo;
-  }
-  if (str == "trades") {
-    return Schema::Trades;
-  }
-  if (str == "ohlcv-1s") {
-    return Schema::Ohlcv1S;
-  }
-  if (str == "ohlcv-1m") {
-    return Schema::Ohlcv1M;
-  }
-  if (str == "ohlcv-1h") {
-    return Schema::Ohlcv1H;
-  }
-  if (str == "ohlcv-1d") {
-    return Schema::Ohlcv1D;
-  }
-  if (str == "definition") {
-    return Schema::Definition;
-  }
-  if (str == "imbalance") {
-    return Schema::Imbalance;
-  }
-  if (str == "statistics") {
-    return Schema::Statistics;
-  }
-  if (str == "status") {
-    return Schema::Status;
-  }
-  throw InvalidArgumentError{"FromString<Schema>", "str",
-                             "unknown value '" + str + '\''};
+  static constexpr detail::NamedValue<Schema> kValues[] = {
+      {"definition", Schema::Definition}, {"imbalance", Schema::Imbalance},
+      {"mbo", Schema::Mbo},               {"mbp-1", Schema::Mbp1},
+      {"mbp-10", Schema::Mbp10},          {"ohlcv-1d", Schema::Ohlcv1D},
+      {"ohlcv-1h", Schema::Ohlcv1H},      {"ohlcv-1m", Schema::Ohlcv1M},
+      {"ohlcv-1s", Schema::Ohlcv1S},      {"statistics", Schema::Statistics},
+      {"status", Schema::Status},         {"tbbo", Schema::Tbbo},
+      {"trades", Schema::Trades}};
+  return detail::FindValue("FromString<Schema>", kValues, str);
 }
 
 template <>
 Encoding FromString(const std::string& str) {
-  if (str == "dbn") {
-    return Encoding::Dbn;
-  }
-  if (str == "csv") {
-    return Encoding::Csv;
-  }
-  if (str == "json") {
-    return Encoding::Json;
-  }
-  throw InvalidArgumentError{"FromString<Encoding>", "str",
-                             "unknown value '" + str + '\''};
+  static constexpr detail::NamedValue<Encoding> kValues[] = {
+      {"csv", Encoding::Csv}, {"dbn", Encoding::Dbn}, {"json", Encoding::Json}};
+  return detail::FindValue("FromString<Encoding>", kValues, str);
 }
 
 template <>
 FeedMode FromString(const std::string& str) {
-  if (str == "historical") {
-    return FeedMode::Historical;
-  }
-  if (str == "historical-streaming") {
-    return FeedMode::HistoricalStreaming;
-  }
-  if (str == "live") {
-    return FeedMode::Live;
-  }
-  throw InvalidArgumentError{"FromString<FeedMode>", "str",
-                             "unknown value '" + str + '\''};
+  static constexpr detail::NamedValue<FeedMode> kValues[] = {
+      {"historical", FeedMode::Historical},
+      {"historical-streaming", FeedMode::HistoricalStreaming},
+      {"live", FeedMode::Live}};
+  return detail::FindValue("FromString<FeedMode>", kValues, str);
 }
 
 template <>
 Compression FromString(const std::string& str) {
-  if (str == "none") {
-    return Compression::None;
-  }
-  if (str == "zstd") {
-    return Compression::Zstd;
-  }
-  throw InvalidArgumentError{"FromString<Compression>", "str",
-                             "unknown value '" + str + '\''};
+  static constexpr detail::NamedValue<Compression> kValues[] = {
+      {"none", Compression::None}, {"zstd", Compression::Zstd}};
+  return detail::FindValue("FromString<Compression>", kValues, str);
 }
 
 template <>
 SType FromString(const std::string& str) {
-  if (str == "instrument_id") {
-    return SType::InstrumentId;
-  }
-  if (str == "raw_symbol") {
-    return SType::RawSymbol;
-  }
-  if (str == "continuous") {
-    return SType::Continuous;
-  }
-  if (str == "parent") {
-    return SType::Parent;
-  }
-  throw InvalidArgumentError{"FromString<SType>", "str",
-                             "unknown value '" + str + '\''};
+  static constexpr detail::NamedValue<SType> kValues[] = {
+      {"continuous", SType::Continuous},
+      {"instrument_id", SType::InstrumentId},
+      {"parent", SType::Parent},
+      {"raw_symbol", SType::RawSymbol}};
+  return detail::FindValue("FromString<SType>", kValues, str);
 }
 
 template <>
 SplitDuration FromString(const std::string& str) {
-  if (str == "day") {
-    return SplitDuration::Day;
-  }
-  if (str == "week") {
-    return SplitDuration::Week;
-  }
-  if (str == "month") {
-    return SplitDuration::Month;
-  }
-  if (str == "none") {
-    return SplitDuration::None;
-  }
-  throw InvalidArgumentError{"FromString<SplitInterval>", "str",
-                             "unknown value '" + str + '\''};
+  static constexpr detail::NamedValue<SplitDuration> kValues[] = {
+      {"day", SplitDuration::Day},
+      {"month", SplitDuration::Month},
+      {"none", SplitDuration::None},
+      {"week", SplitDuration::Week}};
+  return detail::FindValue("FromString<SplitInterval>", kValues, str);
 }
 
 template <>
 Packaging FromString(const std::string& str) {
-  if (str == "none") {
-    return Packaging::None;
-  }
-  if (str == "zip") {
-    return Packaging::Zip;
-  }
-  if (str == "tar") {
-    return Packaging::Tar;
-  }
-  throw InvalidArgumentError{"FromString<Packaging>", "str",
-                             "unknown value '" + str + '\''};
+  static constexpr detail::NamedValue<Packaging> kValues[] = {
+      {"none", Packaging::None},
+      {"tar", Packaging::Tar},
+      {"zip", Packaging::Zip}};
+  return detail::FindValue("FromString<Packaging>", kValues, str);
 }
 
 template <>
 Delivery FromString(const std::string& str) {
-  if (str == "download") {
-    return Delivery::Download;
-  }
-  if (str == "s3") {
-    return Delivery::S3;
-  }
-  if (str == "disk") {
-    return Delivery::Disk;
-  }
-  throw InvalidArgumentError{"FromString<Delivery>", "str",
-                             "unknown value '" + str + '\''};
+  static constexpr detail::NamedValue<Delivery> kValues[] = {
+      {"disk", Delivery::Disk},
+      {"download", Delivery::Download},
+      {"s3", Delivery::S3}};
+  return detail::FindValue("FromString<Delivery>", kValues, str);
 }
 
 template <>
 JobState FromString(const std::string& str) {
-  if (str == "received") {
-    return JobState::Received;
-  }
-  if (str == "queued") {
-    return JobState::Queued;
-  }
-  if (str == "processing") {
-    return JobState::Processing;
-  }
-  if (str == "done") {
-    return JobState::Done;
-  }
-  if (str == "expired") {
-    return JobState::Expired;
-  }
-  throw InvalidArgumentError{"FromString<JobState>", "str",
-                             "unknown value '" + str + '\''};
+  static constexpr detail::NamedValue<JobState> kValues[] = {
+      {"done", JobState::Done},
+      {"expired", JobState::Expired},
+      {"processing", JobState::Processing},
+      {"queued", JobState::Queued},
+      {"received", JobState::Received}};
+  return detail::FindValue("FromString<JobState>", kValues, str);
 }
 
 template <>
 DatasetCondition FromString(const std::string& str) {
-  if (str == "available") {
-    return DatasetCondition::Available;
-  }
-  if (str == "degraded") {
-    return DatasetCondition::Degraded;
-  }
-  if (str == "pending") {
-    return DatasetCondition::Pending;
-  }
-  if (str == "missing") {
-    return DatasetCondition::Missing;
-  }
-  if (str == "bad") {
-    return DatasetCondition::Bad;  // Deprecated
-  }
-  throw InvalidArgumentError{"FromString<DatasetCondition>", "str",
-                             "unknown value '" + str + '\''};
+  static constexpr detail::NamedValue<DatasetCondition> kValues[] = {
+      {"available", DatasetCondition::Available},
+      {"bad", DatasetCondition::Bad},  // Deprecated
+      {"degraded", DatasetCondition::Degraded},
+      {"missing", DatasetCondition::Missing},
+      {"pending", DatasetCondition::Pending}};
+  return detail::FindValue("FromString<DatasetCondition>", kValues, str);
 }
 }  // namespace databento
@@ -1,22 +1,59 @@
 #include "databento/fixed_price.hpp"
 
-#include <iomanip>
+#include <cstring>  // memcpy
+
+namespace {
+constexpr char kUndefPriceStr[] = "kUndefPrice";
+constexpr std::size_t kFractionDigits = 9;
+}  // namespace
 
 namespace databento {
-std::ostream& operator<<(std::ostream& stream, FixPx fix_px) {
-  if (fix_px.IsUndefined()) {
-    stream << "kUndefPrice";
-    return stream;
+char* PxToChars(std::int64_t px, char* first, char* last) {
+  if (px == kUndefPrice) {
+    constexpr std::size_t kUndefLen = sizeof(kUndefPriceStr) - 1;
+    if (static_cast<std::size_t>(last - first) < kUndefLen) {
+      return nullptr;
+    }
+    std::memcpy(first, kUndefPriceStr, kUndefLen);
+    return first + kUndefLen;
+  }
+  const bool is_neg = px < 0;
+  // Negating in the unsigned domain is safe for the minimum int64_t
+  const std::uint64_t abs_px = is_neg ? 0 - static_cast<std::uint64_t>(px)
+                                      : static_cast<std::uint64_t>(px);
+  std::uint64_t integer = abs_px / kFixedPriceScale;
+  std::uint64_t fraction = abs_px % kFixedPriceScale;
+  std::size_t integer_digits = 1;
+  for (std::uint64_t rest = integer; rest >= 10; rest /= 10) {
+    ++integer_digits;
+  }
+  const std::size_t total_len = static_cast<std::size_t>(is_neg) +
+                                integer_digits + 1 + kFractionDigits;
+  if (static_cast<std::size_t>(last - first) < total_len) {
+    return nullptr;
   }
-  const bool price_neg = (fix_px.val < 0);
-  const int64_t fixed_price_abs = price_neg ? -fix_px.val : fix_px.val;
-  const int64_t price_integer = fixed_price_abs / kFixedPriceScale;
-  const int64_t price_fraction = fixed_price_abs % kFixedPriceScale;
-  if (price_neg) {
-    stream << '-';
+  // Fill backward from the end, least significant digit first
+  char* const end = first + total_len;
+  char* pos = end;
+  for (std::size_t i = 0; i < kFractionDigits; ++i) {
+    *--pos = static_cast<char>('0' + fraction % 10);
+    fraction /= 10;
   }
-  stream << price_integer << '.' << std::setw(9) << std::setfill('0')
-         << price_fraction;
+  *--pos = '.';
+  do {
+    *--pos = static_cast<char>('0' + integer % 10);
+    integer /= 10;
+  } while (integer != 0);
+  if (is_neg) {
+    *--pos = '-';
+  }
+  return end;
+}
+
+std::ostream& operator<<(std::ostream& stream, FixPx fix_px) {
+  char buf[kFixPxMaxStrLen];
+  const char* end = PxToChars(fix_px.val, buf, buf + sizeof buf);
+  stream.write(buf, end - buf);
   return stream;
 }
 }  // namespace databento
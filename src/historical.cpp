@@ -1,18 +1,30 @@
 #include "databento/historical.hpp"
 
 #include <dirent.h>  // closedir, opendir
+#ifdef __linux__
+#include <fcntl.h>   // open, posix_fadvise, posix_fallocate, sync_file_range
+#include <unistd.h>  // ftruncate, write
+#endif
 #include <httplib.h>
+#include <openssl/evp.h>  // EVP_DigestInit_ex, EVP_MD_CTX, EVP_sha256
 #include <nlohmann/json.hpp>
 
-#include <algorithm>  // find_if
+#include <algorithm>  // find_if, min
+#include <array>
 #include <atomic>     // atomic<bool>
+#include <chrono>     // nanoseconds
 #include <cstddef>    // size_t
 #include <cstdlib>    // get_env
+#include <cstring>    // memcpy
 #include <exception>  // exception, exception_ptr
 #include <fstream>    // ofstream
 #include <ios>        // ios::binary
+#include <istream>    // istream
 #include <iterator>   // back_inserter
 #include <memory>     // unique_ptr
+#include <mutex>      // lock_guard, mutex
+#include <sstream>    // ostringstream
+#include <stdexcept>  // out_of_range
 #include <string>
 #include <utility>  // move
 #ifdef _WIN32
@@ -23,7 +35,11 @@
 #include "databento/datetime.hpp"
 #include "databento/dbn_decoder.hpp"
 #include "databento/dbn_file_store.hpp"
+#include "databento/detail/buffer_channel.hpp"
 #include "databento/detail/json_helpers.hpp"
+#include "databento/detail/request_thread_pool.hpp"
+#include "databento/detail/response_cache.hpp"
+#include "databento/detail/scoped_fd.hpp"
 #include "databento/detail/scoped_thread.hpp"
 #include "databento/detail/shared_channel.hpp"
 #include "databento/enums.hpp"
@@ -55,6 +71,8 @@ constexpr auto kDefaultSTypeIn = databento::SType::RawSymbol;
 constexpr auto kDefaultEncoding = databento::Encoding::Dbn;
 constexpr auto kDefaultCompression = databento::Compression::Zstd;
 constexpr auto kDefaultSTypeOut = databento::SType::InstrumentId;
+// Worker threads are only spawned once `Historical::Async` is used
+constexpr std::size_t kRequestThreadCount = 8;
 
 databento::BatchJob Parse(const std::string& endpoint,
                           const nlohmann::json& json) {
@@ -144,6 +162,403 @@ std::string PathJoin(const std::string& dir, const std::string& path) {
   }
   return dir + '/' + path;
 }
+
+std::string PathFromUrl(const std::string& endpoint, const std::string& url) {
+  const auto protocol_divider = url.find("://");
+  if (protocol_divider == std::string::npos) {
+    const auto slash = url.find_first_of('/');
+    if (slash == std::string::npos) {
+      throw databento::InvalidArgumentError{endpoint, "url", "No slashes"};
+    }
+    return url.substr(slash);
+  }
+  const auto slash = url.find('/', protocol_divider + 3);
+  if (slash == std::string::npos) {
+    throw databento::InvalidArgumentError{endpoint, "url", "No slashes"};
+  }
+  return url.substr(slash);
+}
+
+bool EndsWith(const std::string& str, const std::string& suffix) {
+  return str.size() >= suffix.size() &&
+         str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Whether the file is a DBN stream that can be decoded, as opposed to one of
+// the accompanying JSON files
+bool IsDbnFile(const std::string& filename) {
+  return EndsWith(filename, ".dbn") || EndsWith(filename, ".dbn.zst");
+}
+
+// An incremental SHA-256 digest so downloads can be verified as the bytes
+// stream through, without a second read pass.
+class Sha256Digest {
+ public:
+  Sha256Digest() : ctx_{EVP_MD_CTX_new(), &EVP_MD_CTX_free} {
+    EVP_DigestInit_ex(ctx_.get(), EVP_sha256(), nullptr);
+  }
+
+  void Update(const char* data, std::size_t length) {
+    EVP_DigestUpdate(ctx_.get(), data, length);
+  }
+
+  std::string FinalizeHex() {
+    std::array<unsigned char, EVP_MAX_MD_SIZE> digest{};
+    unsigned int digest_size{};
+    EVP_DigestFinal_ex(ctx_.get(), digest.data(), &digest_size);
+    static constexpr char kHexDigits[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(2 * digest_size);
+    for (unsigned int i = 0; i < digest_size; ++i) {
+      const unsigned char byte = digest[i];
+      hex.push_back(kHexDigits[byte >> 4]);
+      hex.push_back(kHexDigits[byte & 0xF]);
+    }
+    return hex;
+  }
+
+ private:
+  std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> ctx_;
+};
+
+// Feeds the first `length` bytes of the file into `digest`.
+void DigestFilePrefix(Sha256Digest* digest, const std::string& path,
+                      std::uint64_t length) {
+  std::ifstream file{path, std::ios::binary};
+  std::array<char, 64 * 1024> buffer;
+  std::uint64_t remaining = length;
+  while (remaining > 0 && file) {
+    const auto chunk = std::min<std::uint64_t>(remaining, buffer.size());
+    file.read(buffer.data(), static_cast<std::streamsize>(chunk));
+    digest->Update(buffer.data(), static_cast<std::size_t>(file.gcount()));
+    remaining -= static_cast<std::uint64_t>(file.gcount());
+  }
+}
+
+#ifdef __linux__
+// Writes a downloaded file with preallocation ahead of the write position,
+// periodically starting writeback and dropping the written pages from the
+// page cache, so a large one-shot download doesn't evict hot data.
+class DropCacheFileWriter {
+ public:
+  explicit DropCacheFileWriter(const std::string& file_path)
+      : fd_{::open(file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)} {
+    if (fd_.Get() < 0) {
+      throw databento::InvalidArgumentError{
+          "Historical::StreamToFile", "file_path",
+          std::string{"Failed to open file: "} + std::strerror(errno)};
+    }
+  }
+
+  void Write(const char* data, std::size_t length) {
+    // Preallocate in large chunks ahead of the write position to avoid
+    // fragmentation and per-write extent allocation
+    while (preallocate_ && write_offset_ + length > allocated_size_) {
+      if (::posix_fallocate(fd_.Get(), static_cast<::off_t>(allocated_size_),
+                            kAllocChunkSize) == 0) {
+        allocated_size_ += kAllocChunkSize;
+      } else {
+        // Preallocation is an optimization; writes extend the file anyway
+        preallocate_ = false;
+      }
+    }
+    while (length > 0) {
+      const ::ssize_t write_size = ::write(fd_.Get(), data, length);
+      if (write_size < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        throw databento::Exception{std::string{"Failed to write file: "} +
+                                   std::strerror(errno)};
+      }
+      data += write_size;
+      length -= static_cast<std::size_t>(write_size);
+      write_offset_ += static_cast<std::uint64_t>(write_size);
+    }
+    if (write_offset_ - writeback_offset_ >= kDropWindowSize) {
+      // Start writeback of the newly written window, then drop everything
+      // before it, which a previous call already queued for writeback
+      ::sync_file_range(fd_.Get(), static_cast<::off_t>(writeback_offset_),
+                        static_cast<::off_t>(write_offset_ -
+                                             writeback_offset_),
+                        SYNC_FILE_RANGE_WRITE);
+      if (writeback_offset_ > 0) {
+        ::posix_fadvise(fd_.Get(), 0, static_cast<::off_t>(writeback_offset_),
+                        POSIX_FADV_DONTNEED);
+      }
+      writeback_offset_ = write_offset_;
+    }
+  }
+
+  void Finish() {
+    // Trim the file to the bytes actually written, flush them, and drop
+    // what remains of the file from the page cache
+    if (::ftruncate(fd_.Get(), static_cast<::off_t>(write_offset_)) != 0) {
+      throw databento::Exception{std::string{"Failed to truncate file: "} +
+                                 std::strerror(errno)};
+    }
+    ::fdatasync(fd_.Get());
+    ::posix_fadvise(fd_.Get(), 0, 0, POSIX_FADV_DONTNEED);
+    fd_.Close();
+  }
+
+ private:
+  static constexpr ::off_t kAllocChunkSize = 64 * 1024 * 1024;
+  static constexpr std::uint64_t kDropWindowSize = 8 * 1024 * 1024;
+
+  databento::detail::ScopedFd fd_;
+  bool preallocate_{true};
+  std::uint64_t allocated_size_{};
+  std::uint64_t write_offset_{};
+  std::uint64_t writeback_offset_{};
+};
+
+constexpr ::off_t DropCacheFileWriter::kAllocChunkSize;
+constexpr std::uint64_t DropCacheFileWriter::kDropWindowSize;
+#endif  // __linux__
+
+// Compact host-endian binary codec for entries in the response cache. The
+// cache key embeds a format version, so changing the encoding only requires
+// bumping `kCacheFormatVersion` in `ResponseCache`.
+class CacheWriter {
+ public:
+  void WriteU16(std::uint16_t val) { AppendRaw(&val, sizeof val); }
+  void WriteU32(std::uint32_t val) { AppendRaw(&val, sizeof val); }
+  void WriteDouble(double val) { AppendRaw(&val, sizeof val); }
+  void WriteString(const std::string& val) {
+    WriteU32(static_cast<std::uint32_t>(val.size()));
+    buf_.append(val);
+  }
+
+  std::string Finish() { return std::move(buf_); }
+
+ private:
+  void AppendRaw(const void* data, std::size_t size) {
+    buf_.append(static_cast<const char*>(data), size);
+  }
+
+  std::string buf_;
+};
+
+class CacheReader {
+ public:
+  explicit CacheReader(const std::string& buf) : buf_{buf} {}
+
+  std::uint16_t ReadU16() { return ReadRaw<std::uint16_t>(); }
+  std::uint32_t ReadU32() { return ReadRaw<std::uint32_t>(); }
+  double ReadDouble() { return ReadRaw<double>(); }
+  std::string ReadString() {
+    const std::uint32_t size = ReadU32();
+    if (buf_.size() - pos_ < size) {
+      throw std::out_of_range{"Truncated cache entry"};
+    }
+    std::string val = buf_.substr(pos_, size);
+    pos_ += size;
+    return val;
+  }
+  std::size_t Remaining() const { return buf_.size() - pos_; }
+  // A valid entry is consumed exactly; trailing bytes indicate corruption.
+  void EnsureAtEnd() const {
+    if (pos_ != buf_.size()) {
+      throw std::out_of_range{"Trailing bytes in cache entry"};
+    }
+  }
+
+ private:
+  template <typename T>
+  T ReadRaw() {
+    if (buf_.size() - pos_ < sizeof(T)) {
+      throw std::out_of_range{"Truncated cache entry"};
+    }
+    T val;
+    std::memcpy(&val, buf_.data() + pos_, sizeof(T));
+    pos_ += sizeof(T);
+    return val;
+  }
+
+  const std::string& buf_;
+  std::size_t pos_{};
+};
+
+template <typename T>
+struct CacheCodec;
+
+template <>
+struct CacheCodec<std::string> {
+  static void Encode(CacheWriter* writer, const std::string& val) {
+    writer->WriteString(val);
+  }
+  static std::string Decode(CacheReader* reader) {
+    return reader->ReadString();
+  }
+};
+
+template <>
+struct CacheCodec<databento::Schema> {
+  static void Encode(CacheWriter* writer, databento::Schema val) {
+    writer->WriteU16(static_cast<std::uint16_t>(val));
+  }
+  static databento::Schema Decode(CacheReader* reader) {
+    return static_cast<databento::Schema>(reader->ReadU16());
+  }
+};
+
+template <typename T>
+struct CacheCodec<std::vector<T>> {
+  static void Encode(CacheWriter* writer, const std::vector<T>& vals) {
+    writer->WriteU32(static_cast<std::uint32_t>(vals.size()));
+    for (const auto& val : vals) {
+      CacheCodec<T>::Encode(writer, val);
+    }
+  }
+  static std::vector<T> Decode(CacheReader* reader) {
+    const std::uint32_t size = reader->ReadU32();
+    std::vector<T> vals;
+    // cap the reservation in case the count is corrupt: every element
+    // consumes at least one byte
+    vals.reserve(std::min<std::size_t>(size, reader->Remaining()));
+    for (std::uint32_t i = 0; i < size; ++i) {
+      vals.emplace_back(CacheCodec<T>::Decode(reader));
+    }
+    return vals;
+  }
+};
+
+template <>
+struct CacheCodec<databento::PublisherDetail> {
+  static void Encode(CacheWriter* writer,
+                     const databento::PublisherDetail& val) {
+    writer->WriteU16(val.publisher_id);
+    writer->WriteString(val.dataset);
+    writer->WriteString(val.venue);
+    writer->WriteString(val.description);
+  }
+  static databento::PublisherDetail Decode(CacheReader* reader) {
+    databento::PublisherDetail val;
+    val.publisher_id = reader->ReadU16();
+    val.dataset = reader->ReadString();
+    val.venue = reader->ReadString();
+    val.description = reader->ReadString();
+    return val;
+  }
+};
+
+template <>
+struct CacheCodec<databento::FieldDetail> {
+  static void Encode(CacheWriter* writer, const databento::FieldDetail& val) {
+    writer->WriteString(val.name);
+    writer->WriteString(val.type);
+  }
+  static databento::FieldDetail Decode(CacheReader* reader) {
+    databento::FieldDetail val;
+    val.name = reader->ReadString();
+    val.type = reader->ReadString();
+    return val;
+  }
+};
+
+template <>
+struct CacheCodec<databento::UnitPricesForMode> {
+  static void Encode(CacheWriter* writer,
+                     const databento::UnitPricesForMode& val) {
+    writer->WriteU16(static_cast<std::uint16_t>(val.mode));
+    writer->WriteU32(static_cast<std::uint32_t>(val.unit_prices.size()));
+    for (const auto& unit_price : val.unit_prices) {
+      CacheCodec<databento::Schema>::Encode(writer, unit_price.first);
+      writer->WriteDouble(unit_price.second);
+    }
+  }
+  static databento::UnitPricesForMode Decode(CacheReader* reader) {
+    databento::UnitPricesForMode val;
+    val.mode = static_cast<databento::FeedMode>(reader->ReadU16());
+    const std::uint32_t size = reader->ReadU32();
+    for (std::uint32_t i = 0; i < size; ++i) {
+      const auto schema = CacheCodec<databento::Schema>::Decode(reader);
+      val.unit_prices.emplace(schema, reader->ReadDouble());
+    }
+    return val;
+  }
+};
+
+template <>
+struct CacheCodec<databento::StrMappingInterval> {
+  static void Encode(CacheWriter* writer,
+                     const databento::StrMappingInterval& val) {
+    writer->WriteString(val.start_date);
+    writer->WriteString(val.end_date);
+    writer->WriteString(val.symbol);
+  }
+  static databento::StrMappingInterval Decode(CacheReader* reader) {
+    databento::StrMappingInterval val;
+    val.start_date = reader->ReadString();
+    val.end_date = reader->ReadString();
+    val.symbol = reader->ReadString();
+    return val;
+  }
+};
+
+template <>
+struct CacheCodec<databento::SymbologyResolution> {
+  static void Encode(CacheWriter* writer,
+                     const databento::SymbologyResolution& val) {
+    writer->WriteU32(static_cast<std::uint32_t>(val.mappings.size()));
+    for (const auto& mapping : val.mappings) {
+      writer->WriteString(mapping.first);
+      CacheCodec<std::vector<databento::StrMappingInterval>>::Encode(
+          writer, mapping.second);
+    }
+    CacheCodec<std::vector<std::string>>::Encode(writer, val.partial);
+    CacheCodec<std::vector<std::string>>::Encode(writer, val.not_found);
+  }
+  static databento::SymbologyResolution Decode(CacheReader* reader) {
+    databento::SymbologyResolution val;
+    const std::uint32_t mapping_count = reader->ReadU32();
+    val.mappings.reserve(std::min<std::size_t>(mapping_count,
+                                               reader->Remaining()));
+    for (std::uint32_t i = 0; i < mapping_count; ++i) {
+      std::string symbol = reader->ReadString();
+      val.mappings.emplace(
+          std::move(symbol),
+          CacheCodec<std::vector<databento::StrMappingInterval>>::Decode(
+              reader));
+    }
+    val.partial = CacheCodec<std::vector<std::string>>::Decode(reader);
+    val.not_found = CacheCodec<std::vector<std::string>>::Decode(reader);
+    return val;
+  }
+};
+
+// Serves the response from the cache when possible, otherwise invokes
+// `fetch` and caches its result. Corrupt entries are logged and refetched.
+template <typename T, typename F>
+T FetchWithCache(databento::detail::ResponseCache* cache,
+                 databento::ILogReceiver* log_receiver,
+                 const std::string& path, const httplib::Params& params,
+                 F fetch) {
+  if (cache == nullptr) {
+    return fetch();
+  }
+  const std::string cached = cache->Load(path, params);
+  if (!cached.empty()) {
+    try {
+      CacheReader reader{cached};
+      T res = CacheCodec<T>::Decode(&reader);
+      reader.EnsureAtEnd();
+      return res;
+    } catch (const std::exception& exc) {
+      std::ostringstream log_ss;
+      log_ss << "[Historical::FetchWithCache] Ignoring corrupt cache entry "
+                "for "
+             << path << ": " << exc.what();
+      log_receiver->Receive(databento::LogLevel::Warning, log_ss.str());
+    }
+  }
+  T res = fetch();
+  CacheWriter writer;
+  CacheCodec<T>::Encode(&writer, res);
+  cache->Store(path, params, writer.Finish());
+  return res;
+}
 }  // namespace
 
 Historical::Historical(ILogReceiver* log_receiver, std::string key,
@@ -151,14 +566,25 @@ Historical::Historical(ILogReceiver* log_receiver, std::string key,
     : log_receiver_{log_receiver},
       key_{std::move(key)},
       gateway_{UrlFromGateway(gateway)},
-      client_{log_receiver, key_, gateway_} {}
+      client_{log_receiver, key_, gateway_},
+      request_pool_{new detail::RequestThreadPool{kRequestThreadCount}} {}
 
 Historical::Historical(ILogReceiver* log_receiver, std::string key,
                        std::string gateway, std::uint16_t port)
     : log_receiver_{log_receiver},
       key_{std::move(key)},
       gateway_{std::move(gateway)},
-      client_{log_receiver, key_, gateway_, port} {}
+      client_{log_receiver, key_, gateway_, port},
+      request_pool_{new detail::RequestThreadPool{kRequestThreadCount}} {}
+
+void Historical::SetCacheDir(std::string cache_dir) {
+  if (cache_dir.empty()) {
+    response_cache_.reset();
+  } else {
+    response_cache_.reset(
+        new detail::ResponseCache{log_receiver_, std::move(cache_dir)});
+  }
+}
 
 static const std::string kBatchSubmitJobEndpoint = "Historical::BatchSubmitJob";
 
@@ -237,6 +663,88 @@ databento::BatchJob Historical::BatchSubmitJob(
   detail::SetIfPositive(&params, "limit", limit);
   return this->BatchSubmitJob(params);
 }
+databento::BatchJob Historical::BatchSubmitJob(
+    const std::string& dataset, const char* const* symbols,
+    std::size_t symbol_count, Schema schema,
+    const DateTimeRange<UnixNanos>& datetime_range) {
+  return this->BatchSubmitJob(dataset, symbols, symbol_count, schema,
+                              datetime_range, kDefaultEncoding,
+                              kDefaultCompression, {}, {}, {}, {},
+                              SplitDuration::Day, {}, Packaging::None,
+                              Delivery::Download, kDefaultSTypeIn,
+                              kDefaultSTypeOut, {});
+}
+databento::BatchJob Historical::BatchSubmitJob(
+    const std::string& dataset, const char* const* symbols,
+    std::size_t symbol_count, Schema schema,
+    const DateTimeRange<std::string>& datetime_range) {
+  return this->BatchSubmitJob(dataset, symbols, symbol_count, schema,
+                              datetime_range, kDefaultEncoding,
+                              kDefaultCompression, {}, {}, {}, {},
+                              SplitDuration::Day, {}, Packaging::None,
+                              Delivery::Download, kDefaultSTypeIn,
+                              kDefaultSTypeOut, {});
+}
+databento::BatchJob Historical::BatchSubmitJob(
+    const std::string& dataset, const char* const* symbols,
+    std::size_t symbol_count, Schema schema,
+    const DateTimeRange<UnixNanos>& datetime_range, Encoding encoding,
+    Compression compression, bool pretty_px, bool pretty_ts, bool map_symbols,
+    bool split_symbols, SplitDuration split_duration, std::uint64_t split_size,
+    Packaging packaging, Delivery delivery, SType stype_in, SType stype_out,
+    std::uint64_t limit) {
+  httplib::Params params{
+      {"dataset", dataset},
+      {"start", ToString(datetime_range.start)},
+      {"symbols",
+       JoinSymbolStrings(kBatchSubmitJobEndpoint, symbols, symbol_count)},
+      {"schema", ToString(schema)},
+      {"encoding", ToString(encoding)},
+      {"compression", ToString(compression)},
+      {"pretty_px", std::to_string(pretty_px)},
+      {"pretty_ts", std::to_string(pretty_ts)},
+      {"map_symbols", std::to_string(map_symbols)},
+      {"split_symbols", std::to_string(split_symbols)},
+      {"split_duration", ToString(split_duration)},
+      {"packaging", ToString(packaging)},
+      {"delivery", ToString(delivery)},
+      {"stype_in", ToString(stype_in)},
+      {"stype_out", ToString(stype_out)}};
+  detail::SetIfPositive(&params, "end", datetime_range.end);
+  detail::SetIfPositive(&params, "split_size", split_size);
+  detail::SetIfPositive(&params, "limit", limit);
+  return this->BatchSubmitJob(params);
+}
+databento::BatchJob Historical::BatchSubmitJob(
+    const std::string& dataset, const char* const* symbols,
+    std::size_t symbol_count, Schema schema,
+    const DateTimeRange<std::string>& datetime_range, Encoding encoding,
+    Compression compression, bool pretty_px, bool pretty_ts, bool map_symbols,
+    bool split_symbols, SplitDuration split_duration, std::uint64_t split_size,
+    Packaging packaging, Delivery delivery, SType stype_in, SType stype_out,
+    std::uint64_t limit) {
+  httplib::Params params{
+      {"dataset", dataset},
+      {"start", datetime_range.start},
+      {"symbols",
+       JoinSymbolStrings(kBatchSubmitJobEndpoint, symbols, symbol_count)},
+      {"schema", ToString(schema)},
+      {"encoding", ToString(encoding)},
+      {"compression", ToString(compression)},
+      {"pretty_px", std::to_string(pretty_px)},
+      {"pretty_ts", std::to_string(pretty_ts)},
+      {"map_symbols", std::to_string(map_symbols)},
+      {"split_symbols", std::to_string(split_symbols)},
+      {"split_duration", ToString(split_duration)},
+      {"packaging", ToString(packaging)},
+      {"delivery", ToString(delivery)},
+      {"stype_in", ToString(stype_in)},
+      {"stype_out", ToString(stype_out)}};
+  detail::SetIfNotEmpty(&params, "end", datetime_range.end);
+  detail::SetIfPositive(&params, "split_size", split_size);
+  detail::SetIfPositive(&params, "limit", limit);
+  return this->BatchSubmitJob(params);
+}
 databento::BatchJob Historical::BatchSubmitJob(const httplib::Params& params) {
   static const std::string kPath = ::BuildBatchPath(".submit_job");
   const nlohmann::json json = client_.PostJson(kPath, params);
@@ -267,14 +775,60 @@ std::vector<databento::BatchJob> Historical::BatchListJobs(
     const httplib::Params& params) {
   static const std::string kEndpoint = "Historical::BatchListJobs";
   static const std::string kPath = ::BuildBatchPath(".list_jobs");
-  const nlohmann::json json = client_.GetJson(kPath, params);
-  if (!json.is_array()) {
-    throw JsonResponseError::TypeMismatch(kEndpoint, "array", json);
-  }
   std::vector<BatchJob> jobs;
-  std::transform(
-      json.begin(), json.end(), std::back_inserter(jobs),
-      [](const nlohmann::json& item) { return ::Parse(kEndpoint, item); });
+  detail::SharedChannel channel;
+  std::exception_ptr exception_ptr{};
+  detail::ScopedThread stream{[this, &channel, &exception_ptr, &params] {
+    try {
+      this->client_.GetRawStream(
+          kPath, params, [channel](const char* data, std::size_t length) mutable {
+            channel.Write(reinterpret_cast<const std::uint8_t*>(data), length);
+            return true;
+          });
+      channel.Finish();
+    } catch (const std::exception&) {
+      channel.Finish();
+      // rethrowing here will cause the process to be terminated
+      exception_ptr = std::current_exception();
+    }
+  }};
+  try {
+    detail::IReadableStreambuf streambuf{&channel};
+    std::istream body_stream{&streambuf};
+    // Parse each job as its array element completes, then discard it,
+    // bounding memory to one entry and overlapping parse with download
+    const nlohmann::json json = nlohmann::json::parse(
+        body_stream,
+        [&jobs](int depth, nlohmann::json::parse_event_t event,
+                nlohmann::json& parsed) {
+          if (depth == 1 &&
+              event == nlohmann::json::parse_event_t::object_end) {
+            jobs.emplace_back(::Parse(kEndpoint, parsed));
+            return false;
+          }
+          return true;
+        });
+    if (!json.is_array()) {
+      throw JsonResponseError::TypeMismatch(kEndpoint, "array", json);
+    }
+  } catch (const nlohmann::json::parse_error& parse_err) {
+    stream.Join();
+    // an HTTP error will also truncate the JSON, so prefer surfacing it
+    if (exception_ptr) {
+      std::rethrow_exception(exception_ptr);
+    }
+    throw JsonResponseError::ParseError(kPath, parse_err);
+  } catch (const std::exception&) {
+    stream.Join();
+    if (exception_ptr) {
+      std::rethrow_exception(exception_ptr);
+    }
+    throw;
+  }
+  stream.Join();
+  if (exception_ptr) {
+    std::rethrow_exception(exception_ptr);
+  }
   return jobs;
 }
 
@@ -316,11 +870,28 @@ std::vector<std::string> Historical::BatchDownload(
   std::vector<std::string> paths;
   for (const auto& file_desc : file_descs) {
     std::string output_path = PathJoin(job_dir, file_desc.filename);
-    DownloadFile(file_desc.https_url, output_path);
+    DownloadFileResumable(file_desc, output_path);
     paths.emplace_back(std::move(output_path));
   }
   return paths;
 }
+
+std::vector<std::string> Historical::BatchDownload(
+    const std::string& output_dir, const std::string& job_id,
+    DownloadConf download_conf) {
+  TryCreateDir(output_dir);
+  const std::string job_dir = PathJoin(output_dir, job_id);
+  TryCreateDir(job_dir);
+  const auto file_descs = BatchListFiles(job_id);
+  std::vector<std::string> paths;
+  paths.reserve(file_descs.size());
+  for (const auto& file_desc : file_descs) {
+    paths.emplace_back(PathJoin(job_dir, file_desc.filename));
+  }
+  DownloadFilesParallel(file_descs, paths, download_conf);
+  return paths;
+}
+
 std::string Historical::BatchDownload(const std::string& output_dir,
                                       const std::string& job_id,
                                       const std::string& filename_to_download) {
@@ -339,13 +910,147 @@ std::string Historical::BatchDownload(const std::string& output_dir,
                                "Filename not found for batch job " + job_id};
   }
   std::string output_path = PathJoin(job_dir, file_desc_it->filename);
-  DownloadFile(file_desc_it->https_url, output_path);
+  DownloadFileResumable(*file_desc_it, output_path);
   return output_path;
 }
 
+std::string Historical::BatchDownload(const std::string& output_dir,
+                                      const std::string& job_id,
+                                      const std::string& filename_to_download,
+                                      DownloadConf download_conf) {
+  TryCreateDir(output_dir);
+  const std::string job_dir = PathJoin(output_dir, job_id);
+  TryCreateDir(job_dir);
+  const auto file_descs = BatchListFiles(job_id);
+  const auto file_desc_it =
+      std::find_if(file_descs.begin(), file_descs.end(),
+                   [&filename_to_download](const BatchFileDesc& file_desc) {
+                     return file_desc.filename == filename_to_download;
+                   });
+  if (file_desc_it == file_descs.end()) {
+    throw InvalidArgumentError{"Historical::BatchDownload",
+                               "filename_to_download",
+                               "Filename not found for batch job " + job_id};
+  }
+  std::string output_path = PathJoin(job_dir, file_desc_it->filename);
+  DownloadFilesParallel({*file_desc_it}, {output_path}, download_conf);
+  return output_path;
+}
+
+void Historical::BatchStream(const std::string& job_id,
+                             const MetadataCallback& metadata_callback,
+                             const RecordCallback& record_callback) {
+  this->BatchStream({}, job_id, metadata_callback, record_callback);
+}
+
+void Historical::BatchStream(const std::string& output_dir,
+                             const std::string& job_id,
+                             const MetadataCallback& metadata_callback,
+                             const RecordCallback& record_callback) {
+  static const std::string kEndpoint = "Historical::BatchStream";
+  std::string job_dir{};
+  if (!output_dir.empty()) {
+    TryCreateDir(output_dir);
+    job_dir = PathJoin(output_dir, job_id);
+    TryCreateDir(job_dir);
+  }
+  const auto file_descs = BatchListFiles(job_id);
+  for (const auto& file_desc : file_descs) {
+    if (!IsDbnFile(file_desc.filename)) {
+      continue;
+    }
+    const std::string url_path = PathFromUrl(kEndpoint, file_desc.https_url);
+    std::ofstream out_file;
+    if (!job_dir.empty()) {
+      out_file.open(PathJoin(job_dir, file_desc.filename),
+                    std::ios::binary | std::ios::trunc);
+      if (out_file.fail()) {
+        throw InvalidArgumentError{kEndpoint, "output_dir",
+                                   "Failed to open file"};
+      }
+    }
+    // Decode the file as it downloads so the bytes never have to cross the
+    // disk before reaching the callback
+    std::atomic<bool> should_continue{true};
+    detail::SharedChannel channel;
+    std::exception_ptr exception_ptr{};
+    detail::ScopedThread stream{[this, &channel, &exception_ptr, &out_file,
+                                 &url_path, &should_continue] {
+      try {
+        this->client_.GetRawStream(
+            url_path, {},
+            [channel, &out_file, &should_continue](
+                const char* data, std::size_t length) mutable {
+              if (out_file.is_open()) {
+                out_file.write(data, static_cast<std::streamsize>(length));
+              }
+              channel.Write(reinterpret_cast<const std::uint8_t*>(data),
+                            length);
+              return should_continue.load();
+            });
+        channel.Finish();
+      } catch (const std::exception&) {
+        channel.Finish();
+        // rethrowing here will cause the process to be terminated
+        exception_ptr = std::current_exception();
+      }
+    }};
+    bool stopped = false;
+    try {
+      DbnDecoder dbn_decoder{channel};
+      Metadata metadata = dbn_decoder.DecodeMetadata();
+      if (metadata_callback) {
+        metadata_callback(std::move(metadata));
+      }
+      const Record* record;
+      while ((record = dbn_decoder.DecodeRecord()) != nullptr) {
+        if (record_callback(*record) == KeepGoing::Stop) {
+          should_continue = false;
+          stopped = true;
+          break;
+        }
+      }
+    } catch (const std::exception&) {
+      should_continue = false;
+      // wait for thread to finish before checking for exceptions
+      stream.Join();
+      // check if there's an exception from stream thread. Thread safe
+      // because `stream` thread has been joined
+      if (exception_ptr) {
+        std::rethrow_exception(exception_ptr);
+      }
+      // otherwise rethrow original exception
+      throw;
+    }
+    stream.Join();
+    if (exception_ptr) {
+      std::rethrow_exception(exception_ptr);
+    }
+    if (stopped) {
+      return;
+    }
+  }
+}
+
 void Historical::StreamToFile(const std::string& url_path,
                               const HttplibParams& params,
-                              const std::string& file_path) {
+                              const std::string& file_path,
+                              FileWriteMode write_mode) {
+#ifdef __linux__
+  if (write_mode == FileWriteMode::DropCache) {
+    DropCacheFileWriter out_file{file_path};
+    this->client_.GetRawStream(
+        url_path, params, [&out_file](const char* data, std::size_t length) {
+          out_file.Write(data, length);
+          return true;
+        });
+    out_file.Finish();
+    return;
+  }
+#else
+  // Page cache control requires Linux; fall back to buffered writes
+  static_cast<void>(write_mode);
+#endif
   std::ofstream out_file{file_path, std::ios::binary};
   if (out_file.fail()) {
     throw InvalidArgumentError{"Historical::StreamToFile", "file_path",
@@ -358,52 +1063,257 @@ void Historical::StreamToFile(const std::string& url_path,
       });
 }
 
-void Historical::DownloadFile(const std::string& url,
-                              const std::string& output_path) {
-  static const std::string kEndpoint = "Historical::DownloadFile";
-  // extract path from URL
-  const auto protocol_divider = url.find("://");
-  std::string path;
-  if (protocol_divider == std::string::npos) {
-    const auto slash = url.find_first_of('/');
-    if (slash == std::string::npos) {
-      throw InvalidArgumentError{kEndpoint, "url", "No slashes"};
+void Historical::DownloadFileResumable(const BatchFileDesc& file_desc,
+                                       const std::string& output_path) {
+  static const std::string kEndpoint = "Historical::BatchDownload";
+  const std::string url_path = PathFromUrl(kEndpoint, file_desc.https_url);
+  const std::string expected = ExpectedSha256(file_desc);
+  // Determine how much of a previous attempt is already on disk
+  std::uint64_t existing_size = 0;
+  {
+    std::ifstream existing{output_path, std::ios::binary | std::ios::ate};
+    if (existing.good()) {
+      existing_size = static_cast<std::uint64_t>(existing.tellg());
+    }
+  }
+  Sha256Digest digest;
+  if (file_desc.size > 0 && existing_size > 0 &&
+      existing_size <= file_desc.size) {
+    // Resume: hash the bytes already on disk, then fetch only the missing
+    // tail, so an interrupted transfer loses no completed progress
+    DigestFilePrefix(&digest, output_path, existing_size);
+    if (existing_size < file_desc.size) {
+      std::ofstream out_file{output_path, std::ios::binary | std::ios::app};
+      if (out_file.fail()) {
+        throw InvalidArgumentError{kEndpoint, "output_dir",
+                                   "Failed to open file"};
+      }
+      this->client_.GetRangeRawStream(
+          url_path, {}, existing_size, file_desc.size - existing_size,
+          [&out_file, &digest](const char* data, std::size_t length) {
+            out_file.write(data, static_cast<std::streamsize>(length));
+            digest.Update(data, length);
+            return true;
+          });
     }
-    path = url.substr(slash);
   } else {
-    const auto slash = url.find('/', protocol_divider + 3);
-    if (slash == std::string::npos) {
-      throw InvalidArgumentError{kEndpoint, "url", "No slashes"};
+    // No usable partial file, or the expected size is unknown: download in
+    // full, hashing the bytes as they stream through
+    std::ofstream out_file{output_path, std::ios::binary | std::ios::trunc};
+    if (out_file.fail()) {
+      throw InvalidArgumentError{kEndpoint, "output_dir",
+                                 "Failed to open file"};
     }
-    path = url.substr(slash);
+    this->client_.GetRawStream(
+        url_path, {},
+        [&out_file, &digest](const char* data, std::size_t length) {
+          out_file.write(data, static_cast<std::streamsize>(length));
+          digest.Update(data, length);
+          return true;
+        });
+  }
+  if (!expected.empty() && digest.FinalizeHex() != expected) {
+    throw DbnResponseError{"Hash mismatch for downloaded file " +
+                           file_desc.filename};
   }
+}
 
-  StreamToFile(path, {}, output_path);
+void Historical::DownloadFilesParallel(
+    const std::vector<BatchFileDesc>& file_descs,
+    const std::vector<std::string>& output_paths, DownloadConf download_conf) {
+  static const std::string kEndpoint = "Historical::BatchDownload";
+  if (download_conf.connection_count == 0) {
+    throw InvalidArgumentError{kEndpoint, "download_conf.connection_count",
+                               "must be positive"};
+  }
+  if (download_conf.min_range_size == 0) {
+    throw InvalidArgumentError{kEndpoint, "download_conf.min_range_size",
+                               "must be positive"};
+  }
+  // A whole file when length is zero, otherwise one ranged part of a file
+  struct Task {
+    std::size_t file_idx;
+    std::uint64_t offset;
+    std::uint64_t length;
+  };
+  std::vector<Task> tasks;
+  std::vector<std::string> url_paths;
+  url_paths.reserve(file_descs.size());
+  // Outstanding parts per file: the worker finishing the last part verifies
+  // the file's hash
+  std::vector<std::atomic<std::size_t>> remaining_parts(file_descs.size());
+  for (std::size_t file_idx = 0; file_idx < file_descs.size(); ++file_idx) {
+    const auto& file_desc = file_descs[file_idx];
+    url_paths.emplace_back(PathFromUrl(kEndpoint, file_desc.https_url));
+    if (download_conf.connection_count > 1 &&
+        file_desc.size >= 2 * download_conf.min_range_size) {
+      const auto part_count = std::min<std::uint64_t>(
+          download_conf.connection_count,
+          file_desc.size / download_conf.min_range_size);
+      const auto part_size = file_desc.size / part_count;
+      for (std::uint64_t part = 0; part < part_count; ++part) {
+        const auto offset = part * part_size;
+        // The last part gets the division remainder
+        const auto length =
+            part + 1 == part_count ? file_desc.size - offset : part_size;
+        tasks.push_back({file_idx, offset, length});
+      }
+      remaining_parts[file_idx].store(part_count, std::memory_order_relaxed);
+      // Preallocate so each part can write at its own offset
+      std::ofstream prealloc{output_paths[file_idx], std::ios::binary};
+      if (prealloc.fail()) {
+        throw InvalidArgumentError{kEndpoint, "output_dir",
+                                   "Failed to open file"};
+      }
+      prealloc.seekp(static_cast<std::streamoff>(file_desc.size - 1));
+      prealloc.put('\0');
+    } else {
+      tasks.push_back({file_idx, 0, 0});
+      remaining_parts[file_idx].store(1, std::memory_order_relaxed);
+    }
+  }
+  std::atomic<std::size_t> next_task{0};
+  std::mutex exc_mutex;
+  std::exception_ptr first_exc;
+  const auto worker = [this, &tasks, &file_descs, &url_paths, &output_paths,
+                       &remaining_parts, &next_task, &exc_mutex, &first_exc] {
+    while (true) {
+      const auto task_idx =
+          next_task.fetch_add(1, std::memory_order_relaxed);
+      if (task_idx >= tasks.size()) {
+        return;
+      }
+      {
+        // Don't pick up new work after another connection failed
+        std::lock_guard<std::mutex> lock{exc_mutex};
+        if (first_exc) {
+          return;
+        }
+      }
+      const auto& task = tasks[task_idx];
+      const auto& output_path = output_paths[task.file_idx];
+      try {
+        if (task.length == 0) {
+          std::ofstream out_file{output_path, std::ios::binary};
+          if (out_file.fail()) {
+            throw InvalidArgumentError{kEndpoint, "output_dir",
+                                       "Failed to open file"};
+          }
+          this->client_.GetRawStream(
+              url_paths[task.file_idx], {},
+              [&out_file](const char* data, std::size_t length) {
+                out_file.write(data, static_cast<std::streamsize>(length));
+                return true;
+              });
+        } else {
+          std::fstream out_file{output_path, std::ios::binary | std::ios::in |
+                                                 std::ios::out};
+          if (out_file.fail()) {
+            throw InvalidArgumentError{kEndpoint, "output_dir",
+                                       "Failed to open file"};
+          }
+          out_file.seekp(static_cast<std::streamoff>(task.offset));
+          this->client_.GetRangeRawStream(
+              url_paths[task.file_idx], {}, task.offset, task.length,
+              [&out_file](const char* data, std::size_t length) {
+                out_file.write(data, static_cast<std::streamsize>(length));
+                return true;
+              });
+        }
+        if (remaining_parts[task.file_idx].fetch_sub(
+                1, std::memory_order_acq_rel) == 1) {
+          VerifyFileHash(file_descs[task.file_idx], output_path);
+        }
+      } catch (const std::exception&) {
+        std::lock_guard<std::mutex> lock{exc_mutex};
+        if (!first_exc) {
+          first_exc = std::current_exception();
+        }
+        return;
+      }
+    }
+  };
+  {
+    std::vector<detail::ScopedThread> threads;
+    const auto thread_count =
+        std::min<std::size_t>(download_conf.connection_count, tasks.size());
+    threads.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i) {
+      threads.emplace_back(worker);
+    }
+    // ScopedThread joins on destruction
+  }
+  if (first_exc) {
+    std::rethrow_exception(first_exc);
+  }
+}
+
+std::string Historical::ExpectedSha256(const BatchFileDesc& file_desc) {
+  static const std::string kEndpoint = "Historical::BatchDownload";
+  static const std::string kSha256Prefix = "sha256:";
+  if (file_desc.hash.empty()) {
+    return {};
+  }
+  if (file_desc.hash.compare(0, kSha256Prefix.size(), kSha256Prefix) != 0) {
+    std::ostringstream log_ss;
+    log_ss << "[" << kEndpoint << "] Unknown hash algorithm for "
+           << file_desc.filename << "; skipping verification";
+    log_receiver_->Receive(LogLevel::Warning, log_ss.str());
+    return {};
+  }
+  return file_desc.hash.substr(kSha256Prefix.size());
+}
+
+void Historical::VerifyFileHash(const BatchFileDesc& file_desc,
+                                const std::string& output_path) {
+  const std::string expected = ExpectedSha256(file_desc);
+  if (expected.empty()) {
+    return;
+  }
+  Sha256Digest digest;
+  std::ifstream file{output_path, std::ios::binary};
+  std::array<char, 64 * 1024> buffer;
+  while (file) {
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    digest.Update(buffer.data(), static_cast<std::size_t>(file.gcount()));
+  }
+  if (digest.FinalizeHex() != expected) {
+    throw DbnResponseError{"Hash mismatch for downloaded file " +
+                           file_desc.filename};
+  }
 }
 
 std::vector<databento::PublisherDetail> Historical::MetadataListPublishers() {
   static const std::string kEndpoint = "Historical::MetadataListPublishers";
   static const std::string kPath = ::BuildMetadataPath(".list_publishers");
-  const nlohmann::json json = client_.GetJson(kPath, httplib::Params{});
-  if (!json.is_array()) {
-    throw JsonResponseError::TypeMismatch(kEndpoint, "array", json);
-  }
-  std::vector<PublisherDetail> publisher_details;
-  for (const auto& detail_json : json) {
-    if (!detail_json.is_object()) {
-      throw JsonResponseError::TypeMismatch(kEndpoint, "object", detail_json);
-    }
-    const auto id =
-        detail::ParseAt<std::uint16_t>(kEndpoint, detail_json, "publisher_id");
-    auto dataset =
-        detail::ParseAt<std::string>(kEndpoint, detail_json, "dataset");
-    auto venue = detail::ParseAt<std::string>(kEndpoint, detail_json, "venue");
-    auto description =
-        detail::ParseAt<std::string>(kEndpoint, detail_json, "description");
-    publisher_details.emplace_back(PublisherDetail{
-        id, std::move(dataset), std::move(venue), std::move(description)});
-  }
-  return publisher_details;
+  return FetchWithCache<std::vector<PublisherDetail>>(
+      response_cache_.get(), log_receiver_, kPath, httplib::Params{},
+      [this]() -> std::vector<PublisherDetail> {
+        const nlohmann::json json = client_.GetJson(kPath, httplib::Params{});
+        if (!json.is_array()) {
+          throw JsonResponseError::TypeMismatch(kEndpoint, "array", json);
+        }
+        std::vector<PublisherDetail> publisher_details;
+        for (const auto& detail_json : json) {
+          if (!detail_json.is_object()) {
+            throw JsonResponseError::TypeMismatch(kEndpoint, "object",
+                                                  detail_json);
+          }
+          const auto id =
+              detail::ParseAt<std::uint16_t>(kEndpoint, detail_json,
+                                             "publisher_id");
+          auto dataset =
+              detail::ParseAt<std::string>(kEndpoint, detail_json, "dataset");
+          auto venue =
+              detail::ParseAt<std::string>(kEndpoint, detail_json, "venue");
+          auto description = detail::ParseAt<std::string>(
+              kEndpoint, detail_json, "description");
+          publisher_details.emplace_back(
+              PublisherDetail{id, std::move(dataset), std::move(venue),
+                              std::move(description)});
+        }
+        return publisher_details;
+      });
 }
 
 std::vector<std::string> Historical::MetadataListDatasets() {
@@ -416,98 +1326,123 @@ std::vector<std::string> Historical::MetadataListDatasets(
   httplib::Params params{};
   detail::SetIfNotEmpty(&params, "start_date", date_range.start);
   detail::SetIfNotEmpty(&params, "end_date", date_range.end);
-  const nlohmann::json json = client_.GetJson(kPath, params);
-  if (!json.is_array()) {
-    throw JsonResponseError::TypeMismatch(kEndpoint, "array", json);
-  }
-  std::vector<std::string> datasets;
-  datasets.reserve(json.size());
-  for (const auto& item : json.items()) {
-    if (!item.value().is_string()) {
-      // `key()` in an array is the index
-      throw JsonResponseError::TypeMismatch(kEndpoint, "string", item.key(),
-                                            item.value());
-    }
-    datasets.emplace_back(item.value());
-  }
-  return datasets;
+  return FetchWithCache<std::vector<std::string>>(
+      response_cache_.get(), log_receiver_, kPath, params,
+      [this, &params]() -> std::vector<std::string> {
+        const nlohmann::json json = client_.GetJson(kPath, params);
+        if (!json.is_array()) {
+          throw JsonResponseError::TypeMismatch(kEndpoint, "array", json);
+        }
+        std::vector<std::string> datasets;
+        datasets.reserve(json.size());
+        for (const auto& item : json.items()) {
+          if (!item.value().is_string()) {
+            // `key()` in an array is the index
+            throw JsonResponseError::TypeMismatch(kEndpoint, "string",
+                                                  item.key(), item.value());
+          }
+          datasets.emplace_back(item.value());
+        }
+        return datasets;
+      });
 }
 
 std::vector<databento::Schema> Historical::MetadataListSchemas(
     const std::string& dataset) {
   static const std::string kEndpoint = "Historical::MetadataListSchemas";
   static const std::string kPath = ::BuildMetadataPath(".list_schemas");
-  const nlohmann::json json = client_.GetJson(kPath, {{"dataset", dataset}});
-  if (!json.is_array()) {
-    throw JsonResponseError::TypeMismatch(kEndpoint, "array", json);
-  }
-  std::vector<Schema> schemas;
-  schemas.reserve(json.size());
-  for (const auto& item : json.items()) {
-    if (!item.value().is_string()) {
-      throw JsonResponseError::TypeMismatch(kEndpoint, "string", item.key(),
-                                            item.value());
-    }
-    schemas.emplace_back(FromString<Schema>(item.value()));
-  }
-  return schemas;
+  const httplib::Params params{{"dataset", dataset}};
+  return FetchWithCache<std::vector<Schema>>(
+      response_cache_.get(), log_receiver_, kPath, params,
+      [this, &params]() -> std::vector<Schema> {
+        const nlohmann::json json = client_.GetJson(kPath, params);
+        if (!json.is_array()) {
+          throw JsonResponseError::TypeMismatch(kEndpoint, "array", json);
+        }
+        std::vector<Schema> schemas;
+        schemas.reserve(json.size());
+        for (const auto& item : json.items()) {
+          if (!item.value().is_string()) {
+            throw JsonResponseError::TypeMismatch(kEndpoint, "string",
+                                                  item.key(), item.value());
+          }
+          schemas.emplace_back(FromString<Schema>(item.value()));
+        }
+        return schemas;
+      });
 }
 
 std::vector<databento::FieldDetail> Historical::MetadataListFields(
     Encoding encoding, Schema schema) {
   static const std::string kEndpoint = "Historical::MetadataListFields";
   static const std::string kPath = ::BuildMetadataPath(".list_fields");
-  const nlohmann::json json = client_.GetJson(
-      kPath, {{"encoding", ToString(encoding)}, {"schema", ToString(schema)}});
-  if (!json.is_array()) {
-    throw JsonResponseError::TypeMismatch(kEndpoint, "array", json);
-  }
-  std::vector<FieldDetail> field_details;
-  for (const auto& detail_json : json) {
-    if (!detail_json.is_object()) {
-      throw JsonResponseError::TypeMismatch(kEndpoint, "object", detail_json);
-    }
-    auto name = detail::ParseAt<std::string>(kEndpoint, detail_json, "name");
-    auto type = detail::ParseAt<std::string>(kEndpoint, detail_json, "type");
-    field_details.emplace_back(FieldDetail{std::move(name), std::move(type)});
-  }
-  return field_details;
+  const httplib::Params params{{"encoding", ToString(encoding)},
+                               {"schema", ToString(schema)}};
+  return FetchWithCache<std::vector<FieldDetail>>(
+      response_cache_.get(), log_receiver_, kPath, params,
+      [this, &params]() -> std::vector<FieldDetail> {
+        const nlohmann::json json = client_.GetJson(kPath, params);
+        if (!json.is_array()) {
+          throw JsonResponseError::TypeMismatch(kEndpoint, "array", json);
+        }
+        std::vector<FieldDetail> field_details;
+        for (const auto& detail_json : json) {
+          if (!detail_json.is_object()) {
+            throw JsonResponseError::TypeMismatch(kEndpoint, "object",
+                                                  detail_json);
+          }
+          auto name =
+              detail::ParseAt<std::string>(kEndpoint, detail_json, "name");
+          auto type =
+              detail::ParseAt<std::string>(kEndpoint, detail_json, "type");
+          field_details.emplace_back(
+              FieldDetail{std::move(name), std::move(type)});
+        }
+        return field_details;
+      });
 }
 
 std::vector<databento::UnitPricesForMode> Historical::MetadataListUnitPrices(
     const std::string& dataset) {
   static const std::string kEndpoint = "Historical::MetadataListUnitPrices";
   static const std::string kPath = ::BuildMetadataPath(".list_unit_prices");
-  const nlohmann::json json =
-      client_.GetJson(kPath, httplib::Params{{"dataset", dataset}});
-  if (!json.is_array()) {
-    throw JsonResponseError::TypeMismatch(kEndpoint, "array", json);
-  }
-  std::vector<UnitPricesForMode> res;
-  for (const auto& mode_json : json) {
-    if (!mode_json.is_object()) {
-      throw JsonResponseError::TypeMismatch(kEndpoint, "object", mode_json);
-    }
-    const auto mode =
-        detail::FromCheckedAtString<FeedMode>(kEndpoint, mode_json, "mode");
-    std::map<Schema, double> unit_prices;
-    const auto unit_prices_json =
-        detail::CheckedAt(kEndpoint, mode_json, "unit_prices");
-    if (!unit_prices_json.is_object()) {
-      throw JsonResponseError::TypeMismatch(kEndpoint, "nested object",
-                                            unit_prices_json);
-    }
-    for (const auto& schema_json : unit_prices_json.items()) {
-      if (!schema_json.value().is_number()) {
-        throw JsonResponseError::TypeMismatch(
-            kEndpoint, "nested number", schema_json.key(), schema_json.value());
-      }
-      unit_prices.emplace(FromString<Schema>(schema_json.key()),
-                          schema_json.value());
-    }
-    res.emplace_back(UnitPricesForMode{mode, std::move(unit_prices)});
-  }
-  return res;
+  const httplib::Params params{{"dataset", dataset}};
+  return FetchWithCache<std::vector<UnitPricesForMode>>(
+      response_cache_.get(), log_receiver_, kPath, params,
+      [this, &params]() -> std::vector<UnitPricesForMode> {
+        const nlohmann::json json = client_.GetJson(kPath, params);
+        if (!json.is_array()) {
+          throw JsonResponseError::TypeMismatch(kEndpoint, "array", json);
+        }
+        std::vector<UnitPricesForMode> res;
+        for (const auto& mode_json : json) {
+          if (!mode_json.is_object()) {
+            throw JsonResponseError::TypeMismatch(kEndpoint, "object",
+                                                  mode_json);
+          }
+          const auto mode =
+              detail::FromCheckedAtString<FeedMode>(kEndpoint, mode_json,
+                                                    "mode");
+          std::map<Schema, double> unit_prices;
+          const auto unit_prices_json =
+              detail::CheckedAt(kEndpoint, mode_json, "unit_prices");
+          if (!unit_prices_json.is_object()) {
+            throw JsonResponseError::TypeMismatch(kEndpoint, "nested object",
+                                                  unit_prices_json);
+          }
+          for (const auto& schema_json : unit_prices_json.items()) {
+            if (!schema_json.value().is_number()) {
+              throw JsonResponseError::TypeMismatch(
+                  kEndpoint, "nested number", schema_json.key(),
+                  schema_json.value());
+            }
+            unit_prices.emplace(FromString<Schema>(schema_json.key()),
+                                schema_json.value());
+          }
+          res.emplace_back(UnitPricesForMode{mode, std::move(unit_prices)});
+        }
+        return res;
+      });
 }
 
 std::vector<databento::DatasetConditionDetail>
@@ -751,60 +1686,128 @@ databento::SymbologyResolution Historical::SymbologyResolve(
                          {"stype_in", ToString(stype_in)},
                          {"stype_out", ToString(stype_out)}};
   detail::SetIfNotEmpty(&params, "end_date", date_range.end);
-  const nlohmann::json json = client_.PostJson(kPath, params);
+  return FetchWithCache<SymbologyResolution>(
+      response_cache_.get(), log_receiver_, kPath, params,
+      [this, &params]() { return this->SymbologyResolve(params); });
+}
+
+databento::SymbologyResolution Historical::SymbologyResolve(
+    const std::string& dataset, const char* const* symbols,
+    std::size_t symbol_count, SType stype_in, SType stype_out,
+    const DateRange& date_range) {
+  static const std::string kEndpoint = "Historical::SymbologyResolve";
+  static const std::string kPath = ::BuildSymbologyPath(".resolve");
+  httplib::Params params{
+      {"dataset", dataset},
+      {"start_date", date_range.start},
+      {"symbols", JoinSymbolStrings(kEndpoint, symbols, symbol_count)},
+      {"stype_in", ToString(stype_in)},
+      {"stype_out", ToString(stype_out)}};
+  detail::SetIfNotEmpty(&params, "end_date", date_range.end);
+  return FetchWithCache<SymbologyResolution>(
+      response_cache_.get(), log_receiver_, kPath, params,
+      [this, &params]() { return this->SymbologyResolve(params); });
+}
+
+databento::SymbologyResolution Historical::SymbologyResolve(
+    const HttplibParams& params) {
+  static const std::string kEndpoint = "Historical::SymbologyResolve";
+  static const std::string kPath = ::BuildSymbologyPath(".resolve");
+  const std::string body = client_.PostRaw(kPath, params);
+  SymbologyResolution res{};
+  // Collect each mapping interval and partial/not-found symbol as it
+  // completes and discard it from the DOM, so the parse keeps at most one
+  // entry in memory; only the response's skeleton is retained for the
+  // structural checks below
+  std::string section{};
+  std::string symbol{};
+  using parse_event_t = nlohmann::json::parse_event_t;
+  const auto collect = [&res, &section, &symbol](int depth,
+                                                 parse_event_t event,
+                                                 nlohmann::json& parsed) {
+    switch (event) {
+      case parse_event_t::key: {
+        if (depth == 1) {
+          section = parsed;
+        } else if (depth == 2 && section == "result") {
+          symbol = parsed;
+        }
+        return true;
+      }
+      case parse_event_t::object_end: {
+        if (depth == 3 && section == "result") {
+          res.mappings[symbol].emplace_back(StrMappingInterval{
+              detail::CheckedAt(kEndpoint, parsed, "d0"),
+              detail::CheckedAt(kEndpoint, parsed, "d1"),
+              detail::CheckedAt(kEndpoint, parsed, "s"),
+          });
+          return false;
+        }
+        return true;
+      }
+      case parse_event_t::value: {
+        if (depth == 2 && parsed.is_string()) {
+          if (section == "partial") {
+            res.partial.emplace_back(parsed);
+            return false;
+          }
+          if (section == "not_found") {
+            res.not_found.emplace_back(parsed);
+            return false;
+          }
+        }
+        return true;
+      }
+      default:
+        return true;
+    }
+  };
+  nlohmann::json json;
+  try {
+    json = nlohmann::json::parse(body, collect);
+  } catch (const nlohmann::json::parse_error& parse_err) {
+    throw JsonResponseError::ParseError(kPath, parse_err);
+  }
   if (!json.is_object()) {
     throw JsonResponseError::TypeMismatch(kEndpoint, "object", json);
   }
   const auto& mappings_json = detail::CheckedAt(kEndpoint, json, "result");
   const auto& partial_json = detail::CheckedAt(kEndpoint, json, "partial");
   const auto& not_found_json = detail::CheckedAt(kEndpoint, json, "not_found");
-  SymbologyResolution res{};
   if (!mappings_json.is_object()) {
     throw JsonResponseError::TypeMismatch(kEndpoint, "mappings object",
                                           mappings_json);
   }
-  res.mappings.reserve(mappings_json.size());
   for (const auto& mapping : mappings_json.items()) {
-    const auto& mapping_json = mapping.value();
-    if (!mapping_json.is_array()) {
+    if (!mapping.value().is_array()) {
       throw JsonResponseError::TypeMismatch(kEndpoint, "array", mapping.key(),
-                                            mapping_json);
-    }
-    std::vector<StrMappingInterval> mapping_intervals;
-    std::transform(mapping_json.begin(), mapping_json.end(),
-                   std::back_inserter(mapping_intervals),
-                   [](const nlohmann::json& interval_json) {
-                     return StrMappingInterval{
-                         detail::CheckedAt(kEndpoint, interval_json, "d0"),
-                         detail::CheckedAt(kEndpoint, interval_json, "d1"),
-                         detail::CheckedAt(kEndpoint, interval_json, "s"),
-                     };
-                   });
-    res.mappings.emplace(mapping.key(), std::move(mapping_intervals));
+                                            mapping.value());
+    }
+    // Interval objects were collected during the parse, so anything left in
+    // the array is mistyped
+    if (!mapping.value().empty()) {
+      throw JsonResponseError::TypeMismatch(kEndpoint, "object", mapping.key(),
+                                            mapping.value());
+    }
+    // Ensure symbols whose intervals were all collected (or empty) are
+    // still present
+    res.mappings.emplace(mapping.key(), std::vector<StrMappingInterval>{});
   }
   if (!partial_json.is_array()) {
     throw JsonResponseError::TypeMismatch(kEndpoint, "partial array",
                                           partial_json);
   }
-  res.partial.reserve(partial_json.size());
-  for (const auto& symbol : partial_json.items()) {
-    if (!symbol.value().is_string()) {
-      throw JsonResponseError::TypeMismatch(kEndpoint, "nested string",
-                                            symbol.key(), symbol.value());
-    }
-    res.partial.emplace_back(symbol.value());
+  if (!partial_json.empty()) {
+    throw JsonResponseError::TypeMismatch(kEndpoint, "nested string",
+                                          partial_json);
   }
   if (!not_found_json.is_array()) {
     throw JsonResponseError::TypeMismatch(kEndpoint, "not_found array",
                                           not_found_json);
   }
-  res.not_found.reserve(not_found_json.size());
-  for (const auto& symbol : not_found_json.items()) {
-    if (!symbol.value().is_string()) {
-      throw JsonResponseError::TypeMismatch(kEndpoint, "nested string",
-                                            symbol.key(), symbol.value());
-    }
-    res.not_found.emplace_back(symbol.value());
+  if (!not_found_json.empty()) {
+    throw JsonResponseError::TypeMismatch(kEndpoint, "nested string",
+                                          not_found_json);
   }
   return res;
 }
@@ -814,6 +1817,48 @@ static const std::string kTimeseriesGetRangeEndpoint =
 static const std::string kTimeseriesGetRangePath =
     ::BuildTimeseriesPath(".get_range");
 
+namespace {
+httplib::Params BuildTimeseriesGetRangeParams(
+    const std::string& method_name, const std::string& dataset,
+    const databento::DateTimeRange<databento::UnixNanos>& datetime_range,
+    const std::vector<std::string>& symbols, databento::Schema schema,
+    databento::SType stype_in, databento::SType stype_out,
+    std::uint64_t limit) {
+  httplib::Params params{
+      {"dataset", dataset},
+      {"encoding", "dbn"},
+      {"compression", "zstd"},
+      {"start", databento::ToString(datetime_range.start)},
+      {"symbols", databento::JoinSymbolStrings(method_name, symbols)},
+      {"schema", databento::ToString(schema)},
+      {"stype_in", databento::ToString(stype_in)},
+      {"stype_out", databento::ToString(stype_out)}};
+  databento::detail::SetIfPositive(&params, "end", datetime_range.end);
+  databento::detail::SetIfPositive(&params, "limit", limit);
+  return params;
+}
+
+httplib::Params BuildTimeseriesGetRangeParams(
+    const std::string& method_name, const std::string& dataset,
+    const databento::DateTimeRange<std::string>& datetime_range,
+    const std::vector<std::string>& symbols, databento::Schema schema,
+    databento::SType stype_in, databento::SType stype_out,
+    std::uint64_t limit) {
+  httplib::Params params{
+      {"dataset", dataset},
+      {"encoding", "dbn"},
+      {"compression", "zstd"},
+      {"start", datetime_range.start},
+      {"symbols", databento::JoinSymbolStrings(method_name, symbols)},
+      {"schema", databento::ToString(schema)},
+      {"stype_in", databento::ToString(stype_in)},
+      {"stype_out", databento::ToString(stype_out)}};
+  databento::detail::SetIfNotEmpty(&params, "end", datetime_range.end);
+  databento::detail::SetIfPositive(&params, "limit", limit);
+  return params;
+}
+}  // namespace
+
 void Historical::TimeseriesGetRange(
     const std::string& dataset, const DateTimeRange<UnixNanos>& datetime_range,
     const std::vector<std::string>& symbols, Schema schema,
@@ -837,19 +1882,11 @@ void Historical::TimeseriesGetRange(
     SType stype_out, std::uint64_t limit,
     const MetadataCallback& metadata_callback,
     const RecordCallback& record_callback) {
-  httplib::Params params{
-      {"dataset", dataset},
-      {"encoding", "dbn"},
-      {"compression", "zstd"},
-      {"start", ToString(datetime_range.start)},
-      {"symbols", JoinSymbolStrings(kTimeseriesGetRangeEndpoint, symbols)},
-      {"schema", ToString(schema)},
-      {"stype_in", ToString(stype_in)},
-      {"stype_out", ToString(stype_out)}};
-  detail::SetIfPositive(&params, "end", datetime_range.end);
-  detail::SetIfPositive(&params, "limit", limit);
-
-  this->TimeseriesGetRange(params, metadata_callback, record_callback);
+  this->TimeseriesGetRange(
+      ::BuildTimeseriesGetRangeParams(kTimeseriesGetRangeEndpoint, dataset,
+                                      datetime_range, symbols, schema,
+                                      stype_in, stype_out, limit),
+      metadata_callback, record_callback);
 }
 void Historical::TimeseriesGetRange(
     const std::string& dataset,
@@ -858,25 +1895,30 @@ void Historical::TimeseriesGetRange(
     SType stype_out, std::uint64_t limit,
     const MetadataCallback& metadata_callback,
     const RecordCallback& record_callback) {
-  httplib::Params params{
-      {"dataset", dataset},
-      {"encoding", "dbn"},
-      {"compression", "zstd"},
-      {"start", datetime_range.start},
-      {"symbols", JoinSymbolStrings(kTimeseriesGetRangeEndpoint, symbols)},
-      {"schema", ToString(schema)},
-      {"stype_in", ToString(stype_in)},
-      {"stype_out", ToString(stype_out)}};
-  detail::SetIfNotEmpty(&params, "end", datetime_range.end);
-  detail::SetIfPositive(&params, "limit", limit);
-
-  this->TimeseriesGetRange(params, metadata_callback, record_callback);
+  this->TimeseriesGetRange(
+      ::BuildTimeseriesGetRangeParams(kTimeseriesGetRangeEndpoint, dataset,
+                                      datetime_range, symbols, schema,
+                                      stype_in, stype_out, limit),
+      metadata_callback, record_callback);
 }
 void Historical::TimeseriesGetRange(const HttplibParams& params,
                                     const MetadataCallback& metadata_callback,
                                     const RecordCallback& record_callback) {
+  // The decoder takes each written slice and decodes records in place, so
+  // the copy into the channel is the only copy between the HTTP receiver
+  // and the record callback
+  detail::BufferChannel channel;
+  std::unique_ptr<DbnDecoder> decoder;
+  this->TimeseriesGetRange(params, std::move(channel), &decoder,
+                           metadata_callback, record_callback);
+}
+
+void Historical::TimeseriesGetRange(const HttplibParams& params,
+                                    detail::BufferChannel channel,
+                                    std::unique_ptr<DbnDecoder>* decoder,
+                                    const MetadataCallback& metadata_callback,
+                                    const RecordCallback& record_callback) {
   std::atomic<bool> should_continue{true};
-  detail::SharedChannel channel;
   std::exception_ptr exception_ptr{};
   detail::ScopedThread stream{[this, &channel, &exception_ptr, &params,
                                &should_continue] {
@@ -896,7 +1938,13 @@ void Historical::TimeseriesGetRange(const HttplibParams& params,
     }
   }};
   try {
-    DbnDecoder dbn_decoder{channel};
+    if (*decoder == nullptr) {
+      decoder->reset(new DbnDecoder{channel});
+    } else {
+      // Reuse the buffers allocated for earlier requests
+      (*decoder)->Reset(channel);
+    }
+    DbnDecoder& dbn_decoder = **decoder;
     Metadata metadata = dbn_decoder.DecodeMetadata();
     if (metadata_callback) {
       metadata_callback(std::move(metadata));
@@ -905,11 +1953,16 @@ void Historical::TimeseriesGetRange(const HttplibParams& params,
     while ((record = dbn_decoder.DecodeRecord()) != nullptr) {
       if (record_callback(*record) == KeepGoing::Stop) {
         should_continue = false;
+        // Release a receiver blocked on the channel's high watermark so it
+        // can cancel the transfer immediately instead of draining the rest
+        // of the response
+        channel.Abort();
         break;
       }
     }
   } catch (const std::exception& exc) {
     should_continue = false;
+    channel.Abort();
     // wait for thread to finish before checking for exceptions
     stream.Join();
     // check if there's an exception from stream thread. Thread safe because
@@ -922,6 +1975,252 @@ void Historical::TimeseriesGetRange(const HttplibParams& params,
   }
 }
 
+static const std::string kTimeseriesSessionEndpoint =
+    "TimeseriesSession::GetRange";
+
+using databento::TimeseriesSession;
+
+void TimeseriesSession::GetRange(
+    const std::string& dataset, const DateTimeRange<UnixNanos>& datetime_range,
+    const std::vector<std::string>& symbols, Schema schema,
+    const RecordCallback& record_callback) {
+  this->GetRange(dataset, datetime_range, symbols, schema, kDefaultSTypeIn,
+                 kDefaultSTypeOut, {}, {}, record_callback);
+}
+void TimeseriesSession::GetRange(
+    const std::string& dataset,
+    const DateTimeRange<std::string>& datetime_range,
+    const std::vector<std::string>& symbols, Schema schema,
+    const RecordCallback& record_callback) {
+  this->GetRange(dataset, datetime_range, symbols, schema, kDefaultSTypeIn,
+                 kDefaultSTypeOut, {}, {}, record_callback);
+}
+void TimeseriesSession::GetRange(
+    const std::string& dataset, const DateTimeRange<UnixNanos>& datetime_range,
+    const std::vector<std::string>& symbols, Schema schema, SType stype_in,
+    SType stype_out, std::uint64_t limit,
+    const MetadataCallback& metadata_callback,
+    const RecordCallback& record_callback) {
+  this->GetRange(
+      ::BuildTimeseriesGetRangeParams(kTimeseriesSessionEndpoint, dataset,
+                                      datetime_range, symbols, schema,
+                                      stype_in, stype_out, limit),
+      metadata_callback, record_callback);
+}
+void TimeseriesSession::GetRange(
+    const std::string& dataset,
+    const DateTimeRange<std::string>& datetime_range,
+    const std::vector<std::string>& symbols, Schema schema, SType stype_in,
+    SType stype_out, std::uint64_t limit,
+    const MetadataCallback& metadata_callback,
+    const RecordCallback& record_callback) {
+  this->GetRange(
+      ::BuildTimeseriesGetRangeParams(kTimeseriesSessionEndpoint, dataset,
+                                      datetime_range, symbols, schema,
+                                      stype_in, stype_out, limit),
+      metadata_callback, record_callback);
+}
+void TimeseriesSession::GetRange(
+    const std::multimap<std::string, std::string>& params,
+    const MetadataCallback& metadata_callback,
+    const RecordCallback& record_callback) {
+  // Drop anything left over from a request stopped early
+  channel_.Reset();
+  client_->TimeseriesGetRange(params, channel_, &decoder_, metadata_callback,
+                              record_callback);
+}
+
+static const std::string kTimeseriesGetRangeParallelEndpoint =
+    "Historical::TimeseriesGetRangeParallel";
+
+void Historical::TimeseriesGetRangeParallel(
+    const std::string& dataset, const DateTimeRange<UnixNanos>& datetime_range,
+    const std::vector<std::string>& symbols, Schema schema,
+    std::size_t shard_count, ShardOrdering ordering,
+    const MetadataCallback& metadata_callback,
+    const RecordCallback& record_callback) {
+  this->TimeseriesGetRangeParallel(dataset, datetime_range, symbols, schema,
+                                   kDefaultSTypeIn, kDefaultSTypeOut,
+                                   shard_count, ordering, metadata_callback,
+                                   record_callback);
+}
+
+void Historical::TimeseriesGetRangeParallel(
+    const std::string& dataset, const DateTimeRange<UnixNanos>& datetime_range,
+    const std::vector<std::string>& symbols, Schema schema, SType stype_in,
+    SType stype_out, std::size_t shard_count, ShardOrdering ordering,
+    const MetadataCallback& metadata_callback,
+    const RecordCallback& record_callback) {
+  if (shard_count == 0) {
+    throw InvalidArgumentError{kTimeseriesGetRangeParallelEndpoint,
+                               "shard_count", "must be positive"};
+  }
+  const std::uint64_t start_ns =
+      static_cast<std::uint64_t>(datetime_range.start.time_since_epoch().count());
+  const std::uint64_t end_ns =
+      static_cast<std::uint64_t>(datetime_range.end.time_since_epoch().count());
+  if (end_ns <= start_ns) {
+    throw InvalidArgumentError{kTimeseriesGetRangeParallelEndpoint,
+                               "datetime_range",
+                               "must have an explicit end after its start"};
+  }
+  // Build every shard's params up front so the download threads only read
+  const std::uint64_t shard_size = (end_ns - start_ns) / shard_count;
+  std::vector<HttplibParams> shard_params;
+  shard_params.reserve(shard_count);
+  for (std::size_t shard = 0; shard < shard_count; ++shard) {
+    const std::uint64_t shard_start = start_ns + shard * shard_size;
+    const std::uint64_t shard_end =
+        shard + 1 == shard_count ? end_ns : shard_start + shard_size;
+    shard_params.emplace_back(HttplibParams{
+        {"dataset", dataset},
+        {"encoding", "dbn"},
+        {"compression", "zstd"},
+        {"start", ToString(UnixNanos{std::chrono::nanoseconds{shard_start}})},
+        {"end", ToString(UnixNanos{std::chrono::nanoseconds{shard_end}})},
+        {"symbols", JoinSymbolStrings(kTimeseriesGetRangeParallelEndpoint,
+                                      symbols)},
+        {"schema", ToString(schema)},
+        {"stype_in", ToString(stype_in)},
+        {"stype_out", ToString(stype_out)}});
+  }
+  std::atomic<bool> should_continue{true};
+  std::vector<detail::SharedChannel> channels(shard_count);
+  std::vector<std::exception_ptr> stream_exceptions(shard_count);
+  std::vector<std::exception_ptr> decode_exceptions(shard_count);
+  {
+    std::vector<detail::ScopedThread> stream_threads;
+    stream_threads.reserve(shard_count);
+    for (std::size_t shard = 0; shard < shard_count; ++shard) {
+      stream_threads.emplace_back([this, &channels, &stream_exceptions,
+                                   &shard_params, &should_continue, shard] {
+        try {
+          detail::SharedChannel channel = channels[shard];
+          this->client_.GetRawStream(
+              kTimeseriesGetRangePath, shard_params[shard],
+              [channel, &should_continue](const char* data,
+                                          std::size_t length) mutable {
+                channel.Write(reinterpret_cast<const std::uint8_t*>(data),
+                              length);
+                return should_continue.load();
+              });
+          channels[shard].Finish();
+        } catch (const std::exception&) {
+          channels[shard].Finish();
+          // rethrowing here will cause the process to be terminated
+          stream_exceptions[shard] = std::current_exception();
+        }
+      });
+    }
+    if (ordering == ShardOrdering::Ordered) {
+      // Deliver the disjoint shards one after another on this thread; later
+      // shards keep downloading into their channels in the background
+      bool delivered_metadata = false;
+      for (std::size_t shard = 0;
+           shard < shard_count && should_continue.load(); ++shard) {
+        try {
+          DbnDecoder dbn_decoder{channels[shard]};
+          Metadata metadata = dbn_decoder.DecodeMetadata();
+          if (!delivered_metadata) {
+            delivered_metadata = true;
+            if (metadata_callback) {
+              // Restore the full requested range on the merged stream
+              metadata.end = datetime_range.end;
+              metadata_callback(std::move(metadata));
+            }
+          }
+          const Record* record;
+          while ((record = dbn_decoder.DecodeRecord()) != nullptr) {
+            if (record_callback(*record) == KeepGoing::Stop) {
+              should_continue = false;
+              // Release receivers blocked on their channels' high
+              // watermarks so every shard cancels its transfer immediately
+              // instead of draining the rest of its response
+              for (auto& channel : channels) {
+                channel.Abort();
+              }
+              break;
+            }
+          }
+        } catch (const std::exception&) {
+          should_continue = false;
+          for (auto& channel : channels) {
+            channel.Abort();
+          }
+          decode_exceptions[shard] = std::current_exception();
+        }
+      }
+    } else {
+      std::mutex callback_mutex;
+      bool delivered_metadata = false;
+      std::vector<detail::ScopedThread> decode_threads;
+      decode_threads.reserve(shard_count);
+      for (std::size_t shard = 0; shard < shard_count; ++shard) {
+        decode_threads.emplace_back([&channels, &decode_exceptions,
+                                     &should_continue, &callback_mutex,
+                                     &delivered_metadata, &datetime_range,
+                                     &metadata_callback, &record_callback,
+                                     shard] {
+          try {
+            DbnDecoder dbn_decoder{channels[shard]};
+            Metadata metadata = dbn_decoder.DecodeMetadata();
+            {
+              std::lock_guard<std::mutex> lock{callback_mutex};
+              if (!delivered_metadata) {
+                delivered_metadata = true;
+                if (metadata_callback) {
+                  // Restore the full requested range on the merged stream
+                  metadata.end = datetime_range.end;
+                  metadata_callback(std::move(metadata));
+                }
+              }
+            }
+            const Record* record;
+            while (should_continue.load() &&
+                   (record = dbn_decoder.DecodeRecord()) != nullptr) {
+              std::lock_guard<std::mutex> lock{callback_mutex};
+              if (record_callback(*record) == KeepGoing::Stop) {
+                should_continue = false;
+                // Release receivers blocked on their channels' high
+                // watermarks so every shard cancels its transfer
+                // immediately instead of draining the rest of its response
+                for (auto& channel : channels) {
+                  channel.Abort();
+                }
+                break;
+              }
+            }
+          } catch (const std::exception&) {
+            // An exception after a stop was already requested is just this
+            // shard's stream being torn down by `Abort`, not an error
+            if (!should_continue.exchange(false)) {
+              return;
+            }
+            for (auto& channel : channels) {
+              channel.Abort();
+            }
+            decode_exceptions[shard] = std::current_exception();
+          }
+        });
+      }
+      // joined here, before the download threads
+    }
+  }
+  // All threads have been joined, so the exception slots are safe to read.
+  // A decode failure is usually secondary to its shard's download failing,
+  // so surface download errors first
+  for (const auto& exception_ptr : stream_exceptions) {
+    if (exception_ptr) {
+      std::rethrow_exception(exception_ptr);
+    }
+  }
+  for (const auto& exception_ptr : decode_exceptions) {
+    if (exception_ptr) {
+      std::rethrow_exception(exception_ptr);
+    }
+  }
+}
+
 static const std::string kTimeseriesGetRangeToFileEndpoint =
     "Historical::TimeseriesGetRangeToFile";
 
@@ -958,7 +2257,8 @@ databento::DbnFileStore Historical::TimeseriesGetRangeToFile(
       {"stype_out", ToString(stype_out)}};
   detail::SetIfPositive(&params, "end", datetime_range.end);
   detail::SetIfPositive(&params, "limit", limit);
-  return this->TimeseriesGetRangeToFile(params, file_path);
+  return this->TimeseriesGetRangeToFile(params, file_path,
+                                        FileWriteMode::Buffered);
 }
 databento::DbnFileStore Historical::TimeseriesGetRangeToFile(
     const std::string& dataset,
@@ -977,11 +2277,52 @@ databento::DbnFileStore Historical::TimeseriesGetRangeToFile(
       {"stype_out", ToString(stype_out)}};
   detail::SetIfNotEmpty(&params, "end", datetime_range.end);
   detail::SetIfPositive(&params, "limit", limit);
-  return this->TimeseriesGetRangeToFile(params, file_path);
+  return this->TimeseriesGetRangeToFile(params, file_path,
+                                        FileWriteMode::Buffered);
+}
+databento::DbnFileStore Historical::TimeseriesGetRangeToFile(
+    const std::string& dataset, const DateTimeRange<UnixNanos>& datetime_range,
+    const std::vector<std::string>& symbols, Schema schema, SType stype_in,
+    SType stype_out, std::uint64_t limit, const std::string& file_path,
+    FileWriteMode write_mode) {
+  httplib::Params params{
+      {"dataset", dataset},
+      {"encoding", "dbn"},
+      {"compression", "zstd"},
+      {"start", ToString(datetime_range.start)},
+      {"symbols",
+       JoinSymbolStrings(kTimeseriesGetRangeToFileEndpoint, symbols)},
+      {"schema", ToString(schema)},
+      {"stype_in", ToString(stype_in)},
+      {"stype_out", ToString(stype_out)}};
+  detail::SetIfPositive(&params, "end", datetime_range.end);
+  detail::SetIfPositive(&params, "limit", limit);
+  return this->TimeseriesGetRangeToFile(params, file_path, write_mode);
+}
+databento::DbnFileStore Historical::TimeseriesGetRangeToFile(
+    const std::string& dataset,
+    const DateTimeRange<std::string>& datetime_range,
+    const std::vector<std::string>& symbols, Schema schema, SType stype_in,
+    SType stype_out, std::uint64_t limit, const std::string& file_path,
+    FileWriteMode write_mode) {
+  httplib::Params params{
+      {"dataset", dataset},
+      {"encoding", "dbn"},
+      {"compression", "zstd"},
+      {"start", datetime_range.start},
+      {"symbols",
+       JoinSymbolStrings(kTimeseriesGetRangeToFileEndpoint, symbols)},
+      {"schema", ToString(schema)},
+      {"stype_in", ToString(stype_in)},
+      {"stype_out", ToString(stype_out)}};
+  detail::SetIfNotEmpty(&params, "end", datetime_range.end);
+  detail::SetIfPositive(&params, "limit", limit);
+  return this->TimeseriesGetRangeToFile(params, file_path, write_mode);
 }
 databento::DbnFileStore Historical::TimeseriesGetRangeToFile(
-    const HttplibParams& params, const std::string& file_path) {
-  StreamToFile(kTimeseriesGetRangePath, params, file_path);
+    const HttplibParams& params, const std::string& file_path,
+    FileWriteMode write_mode) {
+  StreamToFile(kTimeseriesGetRangePath, params, file_path, write_mode);
   return DbnFileStore{file_path};
 }
 
@@ -1006,6 +2347,11 @@ HistoricalBuilder& HistoricalBuilder::SetGateway(HistoricalGateway gateway) {
   return *this;
 }
 
+HistoricalBuilder& HistoricalBuilder::SetCacheDir(std::string cache_dir) {
+  cache_dir_ = std::move(cache_dir);
+  return *this;
+}
+
 Historical HistoricalBuilder::Build() {
   if (key_.empty()) {
     throw Exception{"'key' is unset"};
@@ -1013,5 +2359,7 @@ Historical HistoricalBuilder::Build() {
   if (log_receiver_ == nullptr) {
     log_receiver_ = databento::ILogReceiver::Default();
   }
-  return Historical{log_receiver_, key_, gateway_};
+  Historical res{log_receiver_, key_, gateway_};
+  res.SetCacheDir(std::move(cache_dir_));
+  return res;
 }
@@ -0,0 +1,160 @@
+#include "databento/instrument_def_cache.hpp"
+
+#include <algorithm>  // min
+
+#include "databento/compat.hpp"      // InstrumentDefMsgV1
+#include "databento/exceptions.hpp"  // Exception, InvalidArgumentError
+
+using databento::InstrumentDefCache;
+
+namespace {
+// The window base starts this far below the first-seen ID, so slightly
+// smaller IDs arriving later still land in the window
+constexpr std::uint32_t kDenseHeadroom = 1024;
+
+// Fibonacci hashing spreads the sequential instrument IDs common within one
+// dataset across the table
+std::size_t HashInstrumentId(std::uint32_t instrument_id) {
+  return static_cast<std::size_t>(instrument_id) * 2654435761UL;
+}
+
+std::size_t NextPowerOfTwo(std::size_t size) {
+  std::size_t res = 2;
+  while (res < size) {
+    res <<= 1;
+  }
+  return res;
+}
+}  // namespace
+
+InstrumentDefCache::InstrumentDefCache(std::size_t dense_capacity,
+                                       std::size_t sparse_capacity)
+    : slab_(dense_capacity + NextPowerOfTwo(sparse_capacity)),
+      dense_capacity_{dense_capacity},
+      sparse_mask_{NextPowerOfTwo(sparse_capacity) - 1} {
+  if (dense_capacity == 0) {
+    throw InvalidArgumentError{"InstrumentDefCache", "dense_capacity",
+                               "must be nonzero"};
+  }
+}
+
+void InstrumentDefCache::OnRecord(const Record& record) {
+  if (record.RType() == RType::InstrumentDef) {
+    // Version compat
+    if (record.Header().Size() >= sizeof(InstrumentDefMsgV2)) {
+      Insert(record.Get<InstrumentDefMsgV2>());
+    } else {
+      Insert(record.Get<InstrumentDefMsgV1>().ToV2());
+    }
+  }
+}
+
+void InstrumentDefCache::Insert(const InstrumentDefMsg& def) {
+  const auto instrument_id = def.hd.instrument_id;
+  if (base_.load(std::memory_order_relaxed) < 0) {
+    // Clamp the headroom so the first-seen ID always lands in the window,
+    // even for narrow windows
+    const auto headroom = std::min<std::uint32_t>(
+        kDenseHeadroom, static_cast<std::uint32_t>(dense_capacity_ / 2));
+    base_.store(instrument_id > headroom ? instrument_id - headroom : 0,
+                std::memory_order_release);
+  }
+  Slot* slot = FindSlot(instrument_id);
+  if (slot == nullptr) {
+    throw Exception{
+        "InstrumentDefCache outlier region is full; increase "
+        "sparse_capacity"};
+  }
+  StoreDef(slot, def);
+}
+
+bool InstrumentDefCache::Find(std::uint32_t instrument_id,
+                              InstrumentDefMsg* def) const {
+  const Slot* slot = FindSlotForRead(instrument_id);
+  return slot != nullptr && LoadDef(*slot, instrument_id, def);
+}
+
+// Returns the slot for instrument_id, claiming an empty one if necessary,
+// or nullptr when it falls to the outlier region and that region is full.
+InstrumentDefCache::Slot* InstrumentDefCache::FindSlot(
+    std::uint32_t instrument_id) {
+  // Wraps for IDs below the base, yielding an offset beyond the window
+  const auto offset = static_cast<std::uint32_t>(
+      instrument_id -
+      static_cast<std::uint32_t>(base_.load(std::memory_order_relaxed)));
+  if (offset < dense_capacity_) {
+    return &slab_[offset];
+  }
+  std::size_t idx = HashInstrumentId(instrument_id) & sparse_mask_;
+  for (std::size_t i = 0; i <= sparse_mask_; ++i) {
+    Slot& slot = slab_[dense_capacity_ + idx];
+    const auto key = slot.key.load(std::memory_order_relaxed);
+    if (key == 0 || key == instrument_id + 1) {
+      return &slot;
+    }
+    idx = (idx + 1) & sparse_mask_;
+  }
+  return nullptr;
+}
+
+const InstrumentDefCache::Slot* InstrumentDefCache::FindSlotForRead(
+    std::uint32_t instrument_id) const {
+  const auto base = base_.load(std::memory_order_acquire);
+  if (base < 0) {
+    return nullptr;
+  }
+  const auto offset = static_cast<std::uint32_t>(
+      instrument_id - static_cast<std::uint32_t>(base));
+  if (offset < dense_capacity_) {
+    return &slab_[offset];
+  }
+  std::size_t idx = HashInstrumentId(instrument_id) & sparse_mask_;
+  for (std::size_t i = 0; i <= sparse_mask_; ++i) {
+    const Slot& slot = slab_[dense_capacity_ + idx];
+    const auto key = slot.key.load(std::memory_order_acquire);
+    if (key == 0) {
+      // Definitions are never removed, so an empty slot ends the probe chain
+      return nullptr;
+    }
+    if (key == instrument_id + 1) {
+      return &slot;
+    }
+    idx = (idx + 1) & sparse_mask_;
+  }
+  return nullptr;
+}
+
+void InstrumentDefCache::StoreDef(Slot* slot, const InstrumentDefMsg& def) {
+  if (slot->key.load(std::memory_order_relaxed) == 0) {
+    slot->key.store(def.hd.instrument_id + 1, std::memory_order_release);
+    size_.fetch_add(1, std::memory_order_relaxed);
+  }
+  // Seqlock write: stamp the slot in-progress, copy the definition, then
+  // stamp it complete. Readers that overlap either stamp discard their copy.
+  const auto version = slot->version.load(std::memory_order_relaxed);
+  slot->version.store(version + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot->def = def;
+  slot->version.store(version + 2, std::memory_order_release);
+}
+
+bool InstrumentDefCache::LoadDef(const Slot& slot,
+                                 std::uint32_t instrument_id,
+                                 InstrumentDefMsg* def) {
+  for (;;) {
+    const auto version = slot.version.load(std::memory_order_acquire);
+    if (version == 0) {
+      // Claimed but never completely written
+      return false;
+    }
+    if (version % 2 != 0) {
+      // A write is in flight; it completes in a bounded number of steps
+      continue;
+    }
+    *def = slot.def;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.version.load(std::memory_order_relaxed) == version) {
+      return def->hd.instrument_id == instrument_id;
+    }
+  }
+}
@@ -0,0 +1,207 @@
+#include "databento/instrument_state_cache.hpp"
+
+#include <algorithm>  // min
+
+#include "databento/exceptions.hpp"  // Exception, InvalidArgumentError
+
+using databento::InstrumentStateCache;
+
+namespace {
+// The window base starts this far below the first-seen ID, so slightly
+// smaller IDs arriving later still land in the window
+constexpr std::uint32_t kDenseHeadroom = 1024;
+
+// Fibonacci hashing spreads the sequential instrument IDs common within one
+// dataset across the table
+std::size_t HashInstrumentId(std::uint32_t instrument_id) {
+  return static_cast<std::size_t>(instrument_id) * 2654435761UL;
+}
+
+std::size_t NextPowerOfTwo(std::size_t size) {
+  std::size_t res = 2;
+  while (res < size) {
+    res <<= 1;
+  }
+  return res;
+}
+}  // namespace
+
+constexpr std::size_t InstrumentStateCache::kNumStatTypes;
+
+InstrumentStateCache::InstrumentStateCache(std::size_t dense_capacity,
+                                           std::size_t sparse_capacity)
+    : slab_(dense_capacity + NextPowerOfTwo(sparse_capacity)),
+      dense_capacity_{dense_capacity},
+      sparse_mask_{NextPowerOfTwo(sparse_capacity) - 1} {
+  if (dense_capacity == 0) {
+    throw InvalidArgumentError{"InstrumentStateCache", "dense_capacity",
+                               "must be nonzero"};
+  }
+}
+
+void InstrumentStateCache::OnRecord(const Record& record) {
+  if (record.RType() == RType::Statistics) {
+    Insert(record.Get<StatMsg>());
+  } else if (record.RType() == RType::Imbalance) {
+    Insert(record.Get<ImbalanceMsg>());
+  }
+}
+
+void InstrumentStateCache::Insert(const StatMsg& stat) {
+  const auto stat_type = static_cast<std::size_t>(stat.stat_type);
+  if (stat_type >= kNumStatTypes) {
+    // An unknown future statistic: there's no entry to index it under
+    return;
+  }
+  Slot* slot = ClaimSlot(stat.hd.instrument_id);
+  // Seqlock write: stamp the slot in-progress, update the entry, then stamp
+  // it complete. Readers that overlap either stamp discard their copy.
+  const auto version = slot->version.load(std::memory_order_relaxed);
+  slot->version.store(version + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  StatValue& value = slot->stats[stat_type];
+  if (stat.update_action == StatUpdateAction::Delete) {
+    value = StatValue{};
+  } else {
+    value.price = stat.price;
+    value.quantity = stat.quantity;
+    value.ts_recv = stat.ts_recv;
+    value.ts_ref = stat.ts_ref;
+  }
+  slot->version.store(version + 2, std::memory_order_release);
+}
+
+void InstrumentStateCache::Insert(const ImbalanceMsg& imbalance) {
+  Slot* slot = ClaimSlot(imbalance.hd.instrument_id);
+  const auto version = slot->version.load(std::memory_order_relaxed);
+  slot->version.store(version + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot->imbalance = imbalance;
+  slot->version.store(version + 2, std::memory_order_release);
+}
+
+bool InstrumentStateCache::FindStat(std::uint32_t instrument_id,
+                                    StatType stat_type,
+                                    StatValue* value) const {
+  const auto stat_idx = static_cast<std::size_t>(stat_type);
+  if (stat_idx >= kNumStatTypes) {
+    return false;
+  }
+  const Slot* slot = FindSlotForRead(instrument_id);
+  if (slot == nullptr) {
+    return false;
+  }
+  for (;;) {
+    const auto version = slot->version.load(std::memory_order_acquire);
+    if (version == 0) {
+      // Claimed but never completely written
+      return false;
+    }
+    if (version % 2 != 0) {
+      // A write is in flight; it completes in a bounded number of steps
+      continue;
+    }
+    *value = slot->stats[stat_idx];
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot->version.load(std::memory_order_relaxed) == version) {
+      // A zero receive timestamp marks an unset (or deleted) statistic
+      return value->ts_recv.time_since_epoch().count() != 0;
+    }
+  }
+}
+
+bool InstrumentStateCache::FindImbalance(std::uint32_t instrument_id,
+                                         ImbalanceMsg* imbalance) const {
+  const Slot* slot = FindSlotForRead(instrument_id);
+  if (slot == nullptr) {
+    return false;
+  }
+  for (;;) {
+    const auto version = slot->version.load(std::memory_order_acquire);
+    if (version == 0) {
+      return false;
+    }
+    if (version % 2 != 0) {
+      continue;
+    }
+    *imbalance = slot->imbalance;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot->version.load(std::memory_order_relaxed) == version) {
+      return imbalance->ts_recv.time_since_epoch().count() != 0;
+    }
+  }
+}
+
+// Returns the slot for `instrument_id`, claiming an empty one if necessary.
+// Throws Exception when it falls to the outlier region and that region is
+// full.
+InstrumentStateCache::Slot* InstrumentStateCache::ClaimSlot(
+    std::uint32_t instrument_id) {
+  if (base_.load(std::memory_order_relaxed) < 0) {
+    // Clamp the headroom so the first-seen ID always lands in the window,
+    // even for narrow windows
+    const auto headroom = std::min<std::uint32_t>(
+        kDenseHeadroom, static_cast<std::uint32_t>(dense_capacity_ / 2));
+    base_.store(instrument_id > headroom ? instrument_id - headroom : 0,
+                std::memory_order_release);
+  }
+  Slot* slot = FindSlot(instrument_id);
+  if (slot == nullptr) {
+    throw Exception{
+        "InstrumentStateCache outlier region is full; increase "
+        "sparse_capacity"};
+  }
+  if (slot->key.load(std::memory_order_relaxed) == 0) {
+    slot->key.store(instrument_id + 1, std::memory_order_release);
+    size_.fetch_add(1, std::memory_order_relaxed);
+  }
+  return slot;
+}
+
+InstrumentStateCache::Slot* InstrumentStateCache::FindSlot(
+    std::uint32_t instrument_id) {
+  // Wraps for IDs below the base, yielding an offset beyond the window
+  const auto offset = static_cast<std::uint32_t>(
+      instrument_id -
+      static_cast<std::uint32_t>(base_.load(std::memory_order_relaxed)));
+  if (offset < dense_capacity_) {
+    return &slab_[offset];
+  }
+  std::size_t idx = HashInstrumentId(instrument_id) & sparse_mask_;
+  for (std::size_t i = 0; i <= sparse_mask_; ++i) {
+    Slot& slot = slab_[dense_capacity_ + idx];
+    const auto key = slot.key.load(std::memory_order_relaxed);
+    if (key == 0 || key == instrument_id + 1) {
+      return &slot;
+    }
+    idx = (idx + 1) & sparse_mask_;
+  }
+  return nullptr;
+}
+
+const InstrumentStateCache::Slot* InstrumentStateCache::FindSlotForRead(
+    std::uint32_t instrument_id) const {
+  const auto base = base_.load(std::memory_order_acquire);
+  if (base < 0) {
+    return nullptr;
+  }
+  const auto offset = static_cast<std::uint32_t>(
+      instrument_id - static_cast<std::uint32_t>(base));
+  if (offset < dense_capacity_) {
+    return &slab_[offset];
+  }
+  std::size_t idx = HashInstrumentId(instrument_id) & sparse_mask_;
+  for (std::size_t i = 0; i <= sparse_mask_; ++i) {
+    const Slot& slot = slab_[dense_capacity_ + idx];
+    const auto key = slot.key.load(std::memory_order_acquire);
+    if (key == 0) {
+      // State is never removed, so an empty slot ends the probe chain
+      return nullptr;
+    }
+    if (key == instrument_id + 1) {
+      return &slot;
+    }
+    idx = (idx + 1) & sparse_mask_;
+  }
+  return nullptr;
+}
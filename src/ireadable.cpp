@@ -0,0 +1,10 @@
+#include "databento/ireadable.hpp"
+
+#include "databento/exceptions.hpp"
+
+using databento::IReadable;
+
+void IReadable::Seek(std::size_t) {
+  throw InvalidArgumentError{"IReadable::Seek", "offset",
+                             "Stream doesn't support seeking"};
+}
@@ -0,0 +1,299 @@
+#include "databento/json_encoder.hpp"
+
+#include <algorithm>  // max
+#include <cstdint>
+#include <cstring>  // memcpy, strlen
+#include <string>
+#include <utility>  // make_pair
+
+#include "databento/exceptions.hpp"   // InvalidArgumentError
+#include "databento/fixed_price.hpp"  // PxToChars, kFixPxMaxStrLen
+
+namespace {
+// Generous bound on the widest record (Mbp10Msg with pretty prices and
+// timestamps is below 3 KiB)
+constexpr std::size_t kMaxRowLen = 4096;
+
+char* WriteUnsigned(char* pos, std::uint64_t value) {
+  char digits[20];
+  char* digit = digits;
+  do {
+    *digit++ = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value > 0);
+  while (digit != digits) {
+    *pos++ = *--digit;
+  }
+  return pos;
+}
+
+char* WriteSigned(char* pos, std::int64_t value) {
+  std::uint64_t abs_value;
+  if (value < 0) {
+    *pos++ = '-';
+    abs_value = 0 - static_cast<std::uint64_t>(value);
+  } else {
+    abs_value = static_cast<std::uint64_t>(value);
+  }
+  return WriteUnsigned(pos, abs_value);
+}
+
+char* WriteLiteral(char* pos, const char* literal) {
+  const auto length = std::strlen(literal);
+  std::memcpy(pos, literal, length);
+  return pos + length;
+}
+
+// Writes `"key":`
+char* WriteKey(char* pos, const char* key) {
+  *pos++ = '"';
+  pos = WriteLiteral(pos, key);
+  *pos++ = '"';
+  *pos++ = ':';
+  return pos;
+}
+
+char* WriteCharField(char* pos, const char* key, char value) {
+  pos = WriteKey(pos, key);
+  *pos++ = '"';
+  *pos++ = value;
+  *pos++ = '"';
+  return pos;
+}
+}  // namespace
+
+namespace databento {
+constexpr std::size_t JsonEncoder::kDefaultBufferSize;
+
+JsonEncoder::JsonEncoder(IWritable* output, bool pretty_px, bool pretty_ts)
+    : JsonEncoder{output, pretty_px, pretty_ts, kDefaultBufferSize} {}
+
+JsonEncoder::JsonEncoder(IWritable* output, bool pretty_px, bool pretty_ts,
+                         std::size_t buffer_size)
+    : output_{output},
+      pretty_px_{pretty_px},
+      pretty_ts_{pretty_ts},
+      buffer_(std::max(buffer_size, 2 * kMaxRowLen)) {}
+
+JsonEncoder::~JsonEncoder() { Flush(); }
+
+void JsonEncoder::EncodeRecord(const Record& record) {
+  if (record.Holds<MboMsg>()) {
+    EncodeRecord(record.Get<MboMsg>());
+  } else if (record.Holds<TradeMsg>()) {
+    EncodeRecord(record.Get<TradeMsg>());
+  } else if (record.Holds<Mbp1Msg>()) {
+    EncodeRecord(record.Get<Mbp1Msg>());
+  } else if (record.Holds<Mbp10Msg>()) {
+    EncodeRecord(record.Get<Mbp10Msg>());
+  } else if (record.Holds<OhlcvMsg>()) {
+    EncodeRecord(record.Get<OhlcvMsg>());
+  } else {
+    throw InvalidArgumentError{
+        "JsonEncoder::EncodeRecord", "record",
+        std::string{"no JSON support for rtype "} + ToString(record.RType())};
+  }
+}
+
+void JsonEncoder::EncodeRecord(const MboMsg& record) {
+  char* pos = RowStart();
+  *pos++ = '{';
+  pos = WriteHd(pos, record.hd);
+  *pos++ = ',';
+  pos = WriteKey(pos, "order_id");
+  *pos++ = '"';
+  pos = WriteUnsigned(pos, record.order_id);
+  *pos++ = '"';
+  *pos++ = ',';
+  pos = WriteKey(pos, "price");
+  *pos++ = '"';
+  pos = WritePx(pos, record.price);
+  *pos++ = '"';
+  *pos++ = ',';
+  pos = WriteKey(pos, "size");
+  pos = WriteUnsigned(pos, record.size);
+  *pos++ = ',';
+  pos = WriteKey(pos, "flags");
+  pos = WriteUnsigned(pos, static_cast<std::uint8_t>(record.flags));
+  *pos++ = ',';
+  pos = WriteKey(pos, "channel_id");
+  pos = WriteUnsigned(pos, record.channel_id);
+  *pos++ = ',';
+  pos = WriteCharField(pos, "action", static_cast<char>(record.action));
+  *pos++ = ',';
+  pos = WriteCharField(pos, "side", static_cast<char>(record.side));
+  *pos++ = ',';
+  pos = WriteKey(pos, "ts_recv");
+  *pos++ = '"';
+  pos = WriteTs(pos, record.ts_recv);
+  *pos++ = '"';
+  *pos++ = ',';
+  pos = WriteKey(pos, "ts_in_delta");
+  pos = WriteSigned(pos, record.ts_in_delta.count());
+  *pos++ = ',';
+  pos = WriteKey(pos, "sequence");
+  pos = WriteUnsigned(pos, record.sequence);
+  *pos++ = '}';
+  FinishRow(pos);
+}
+
+void JsonEncoder::EncodeRecord(const TradeMsg& record) {
+  // TradeMsg is layout-identical to an MbpMsg body with no levels
+  EncodeMbp(reinterpret_cast<const detail::MbpMsg<0>&>(record));
+}
+
+void JsonEncoder::EncodeRecord(const Mbp1Msg& record) { EncodeMbp(record); }
+
+void JsonEncoder::EncodeRecord(const Mbp10Msg& record) { EncodeMbp(record); }
+
+template <std::size_t N>
+void JsonEncoder::EncodeMbp(const detail::MbpMsg<N>& record) {
+  char* pos = RowStart();
+  *pos++ = '{';
+  pos = WriteHd(pos, record.hd);
+  *pos++ = ',';
+  pos = WriteKey(pos, "price");
+  *pos++ = '"';
+  pos = WritePx(pos, record.price);
+  *pos++ = '"';
+  *pos++ = ',';
+  pos = WriteKey(pos, "size");
+  pos = WriteUnsigned(pos, record.size);
+  *pos++ = ',';
+  pos = WriteCharField(pos, "action", static_cast<char>(record.action));
+  *pos++ = ',';
+  pos = WriteCharField(pos, "side", static_cast<char>(record.side));
+  *pos++ = ',';
+  pos = WriteKey(pos, "flags");
+  pos = WriteUnsigned(pos, static_cast<std::uint8_t>(record.flags));
+  *pos++ = ',';
+  pos = WriteKey(pos, "depth");
+  pos = WriteUnsigned(pos, record.depth);
+  *pos++ = ',';
+  pos = WriteKey(pos, "ts_recv");
+  *pos++ = '"';
+  pos = WriteTs(pos, record.ts_recv);
+  *pos++ = '"';
+  *pos++ = ',';
+  pos = WriteKey(pos, "ts_in_delta");
+  pos = WriteSigned(pos, record.ts_in_delta.count());
+  *pos++ = ',';
+  pos = WriteKey(pos, "sequence");
+  pos = WriteUnsigned(pos, record.sequence);
+  if (N > 0) {
+    *pos++ = ',';
+    pos = WriteKey(pos, "levels");
+    *pos++ = '[';
+    for (std::size_t level = 0; level < N; ++level) {
+      const BidAskPair& pair = record.levels[level];
+      if (level > 0) {
+        *pos++ = ',';
+      }
+      *pos++ = '{';
+      pos = WriteKey(pos, "bid_px");
+      *pos++ = '"';
+      pos = WritePx(pos, pair.bid_px);
+      *pos++ = '"';
+      *pos++ = ',';
+      pos = WriteKey(pos, "ask_px");
+      *pos++ = '"';
+      pos = WritePx(pos, pair.ask_px);
+      *pos++ = '"';
+      *pos++ = ',';
+      pos = WriteKey(pos, "bid_sz");
+      pos = WriteUnsigned(pos, pair.bid_sz);
+      *pos++ = ',';
+      pos = WriteKey(pos, "ask_sz");
+      pos = WriteUnsigned(pos, pair.ask_sz);
+      *pos++ = ',';
+      pos = WriteKey(pos, "bid_ct");
+      pos = WriteUnsigned(pos, pair.bid_ct);
+      *pos++ = ',';
+      pos = WriteKey(pos, "ask_ct");
+      pos = WriteUnsigned(pos, pair.ask_ct);
+      *pos++ = '}';
+    }
+    *pos++ = ']';
+  }
+  *pos++ = '}';
+  FinishRow(pos);
+}
+
+void JsonEncoder::EncodeRecord(const OhlcvMsg& record) {
+  char* pos = RowStart();
+  *pos++ = '{';
+  pos = WriteHd(pos, record.hd);
+  for (const auto& field :
+       {std::make_pair("open", record.open),
+        std::make_pair("high", record.high),
+        std::make_pair("low", record.low),
+        std::make_pair("close", record.close)}) {
+    *pos++ = ',';
+    pos = WriteKey(pos, field.first);
+    *pos++ = '"';
+    pos = WritePx(pos, field.second);
+    *pos++ = '"';
+  }
+  *pos++ = ',';
+  pos = WriteKey(pos, "volume");
+  *pos++ = '"';
+  pos = WriteUnsigned(pos, record.volume);
+  *pos++ = '"';
+  *pos++ = '}';
+  FinishRow(pos);
+}
+
+void JsonEncoder::Flush() {
+  if (length_ > 0) {
+    output_->WriteAll(reinterpret_cast<const std::uint8_t*>(buffer_.data()),
+                      length_);
+    length_ = 0;
+  }
+}
+
+char* JsonEncoder::RowStart() {
+  if (buffer_.size() - length_ < kMaxRowLen) {
+    Flush();
+  }
+  return buffer_.data() + length_;
+}
+
+void JsonEncoder::FinishRow(char* pos) {
+  *pos++ = '\n';
+  length_ = static_cast<std::size_t>(pos - buffer_.data());
+}
+
+char* JsonEncoder::WriteHd(char* pos, const RecordHeader& hd) const {
+  pos = WriteKey(pos, "hd");
+  *pos++ = '{';
+  pos = WriteKey(pos, "ts_event");
+  *pos++ = '"';
+  pos = WriteTs(pos, hd.ts_event);
+  *pos++ = '"';
+  *pos++ = ',';
+  pos = WriteKey(pos, "rtype");
+  pos = WriteUnsigned(pos, static_cast<std::uint8_t>(hd.rtype));
+  *pos++ = ',';
+  pos = WriteKey(pos, "publisher_id");
+  pos = WriteUnsigned(pos, hd.publisher_id);
+  *pos++ = ',';
+  pos = WriteKey(pos, "instrument_id");
+  pos = WriteUnsigned(pos, hd.instrument_id);
+  *pos++ = '}';
+  return pos;
+}
+
+char* JsonEncoder::WritePx(char* pos, std::int64_t px) const {
+  if (pretty_px_) {
+    return PxToChars(px, pos, pos + kFixPxMaxStrLen);
+  }
+  return WriteSigned(pos, px);
+}
+
+char* JsonEncoder::WriteTs(char* pos, UnixNanos ts) const {
+  if (pretty_ts_) {
+    return ToIso8601Chars(ts, pos, pos + kIso8601MaxStrLen);
+  }
+  return WriteUnsigned(pos, ts.time_since_epoch().count());
+}
+}  // namespace databento
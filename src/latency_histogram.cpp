@@ -0,0 +1,38 @@
+#include "databento/latency_histogram.hpp"
+
+#include <cmath>  // ceil
+
+namespace databento {
+constexpr std::uint32_t LatencyHistogram::kSubBucketHalfBits;
+constexpr std::size_t LatencyHistogram::kSubBucketHalfCount;
+constexpr std::size_t LatencyHistogram::kBucketCount;
+
+std::uint64_t LatencyHistogram::Count() const {
+  std::uint64_t total = 0;
+  for (const auto& count : counts_) {
+    total += count.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+std::uint64_t LatencyHistogram::ValueAtPercentile(double percentile) const {
+  const auto total = Count();
+  if (total == 0) {
+    return 0;
+  }
+  const auto target = static_cast<std::uint64_t>(
+      std::ceil(percentile / 100.0 * static_cast<double>(total)));
+  std::uint64_t cumulative = 0;
+  for (std::size_t index = 0; index < kBucketCount; ++index) {
+    cumulative += counts_[index].load(std::memory_order_relaxed);
+    if (cumulative >= target && cumulative > 0) {
+      // Report the top of the bucket, clamped to the exact maximum so high
+      // percentiles never exceed an observed value
+      const auto upper_bound = BucketLowerBound(index + 1) - 1;
+      const auto max = Max();
+      return upper_bound < max ? upper_bound : max;
+    }
+  }
+  return Max();
+}
+}  // namespace databento
@@ -51,16 +51,30 @@ LiveBuilder& LiveBuilder::SetLogReceiver(
   return *this;
 }
 
+LiveBuilder& LiveBuilder::SetSocketConf(
+    databento::detail::TcpClient::SocketConf socket_conf) {
+  socket_conf_ = socket_conf;
+  return *this;
+}
+
+LiveBuilder& LiveBuilder::SetThreadConf(LiveThreaded::ThreadConf thread_conf) {
+  thread_conf_ = std::move(thread_conf);
+  return *this;
+}
+
 databento::LiveBlocking LiveBuilder::BuildBlocking() {
   Validate();
-  return databento::LiveBlocking{log_receiver_, key_, dataset_, send_ts_out_,
-                                 upgrade_policy_};
+  return databento::LiveBlocking{log_receiver_, key_,            dataset_,
+                                 send_ts_out_,  upgrade_policy_, socket_conf_};
 }
 
 databento::LiveThreaded LiveBuilder::BuildThreaded() {
   Validate();
-  return databento::LiveThreaded{log_receiver_, key_, dataset_, send_ts_out_,
-                                 upgrade_policy_};
+  databento::LiveThreaded live_threaded{
+      log_receiver_, key_, dataset_, send_ts_out_, upgrade_policy_,
+      socket_conf_};
+  live_threaded.SetThreadConf(thread_conf_);
+  return live_threaded;
 }
 
 void LiveBuilder::Validate() {
@@ -9,9 +9,12 @@
 #include <ios>  //hex, setfill, setw
 #include <sstream>
 
+#include "databento/compat.hpp"     // SystemMsgV1
 #include "databento/constants.hpp"  //  kApiKeyLength
 #include "databento/dbn_decoder.hpp"
+#include "databento/detail/journal_writer.hpp"
 #include "databento/detail/tcp_client.hpp"
+#include "databento/detail/trace.hpp"
 #include "databento/exceptions.hpp"  // LiveApiError
 #include "databento/log.hpp"         // ILogReceiver
 #include "databento/record.hpp"      // Record
@@ -27,7 +30,14 @@ constexpr std::size_t kBucketIdLength = 5;
 LiveBlocking::LiveBlocking(ILogReceiver* log_receiver, std::string key,
                            std::string dataset, bool send_ts_out,
                            VersionUpgradePolicy upgrade_policy)
+    : LiveBlocking{log_receiver, std::move(key),
+                   std::move(dataset), send_ts_out,
+                   upgrade_policy,    detail::TcpClient::SocketConf{}} {}
 
+LiveBlocking::LiveBlocking(ILogReceiver* log_receiver, std::string key,
+                           std::string dataset, bool send_ts_out,
+                           VersionUpgradePolicy upgrade_policy,
+                           detail::TcpClient::SocketConf socket_conf)
     : log_receiver_{log_receiver},
       key_{std::move(key)},
       dataset_{std::move(dataset)},
@@ -35,13 +45,29 @@ LiveBlocking::LiveBlocking(ILogReceiver* log_receiver, std::string key,
       port_{13000},
       send_ts_out_{send_ts_out},
       upgrade_policy_{upgrade_policy},
-      client_{gateway_, port_},
+      socket_conf_{socket_conf},
+      gateway_addresses_{detail::TcpClient::Resolve(gateway_, port_)},
+      client_{gateway_addresses_, {}, socket_conf_},
       session_id_{this->Authenticate()} {}
 
 LiveBlocking::LiveBlocking(ILogReceiver* log_receiver, std::string key,
                            std::string dataset, std::string gateway,
                            std::uint16_t port, bool send_ts_out,
                            VersionUpgradePolicy upgrade_policy)
+    : LiveBlocking{log_receiver,
+                   std::move(key),
+                   std::move(dataset),
+                   std::move(gateway),
+                   port,
+                   send_ts_out,
+                   upgrade_policy,
+                   detail::TcpClient::SocketConf{}} {}
+
+LiveBlocking::LiveBlocking(ILogReceiver* log_receiver, std::string key,
+                           std::string dataset, std::string gateway,
+                           std::uint16_t port, bool send_ts_out,
+                           VersionUpgradePolicy upgrade_policy,
+                           detail::TcpClient::SocketConf socket_conf)
     : log_receiver_{log_receiver},
       key_{std::move(key)},
       dataset_{std::move(dataset)},
@@ -49,9 +75,66 @@ LiveBlocking::LiveBlocking(ILogReceiver* log_receiver, std::string key,
       port_{port},
       send_ts_out_{send_ts_out},
       upgrade_policy_{upgrade_policy},
-      client_{gateway_, port_},
+      socket_conf_{socket_conf},
+      gateway_addresses_{detail::TcpClient::Resolve(gateway_, port_)},
+      client_{gateway_addresses_, {}, socket_conf_},
       session_id_{this->Authenticate()} {}
 
+LiveBlocking::LiveBlocking(LiveBlocking&& other) noexcept
+    : log_receiver_{other.log_receiver_},
+      key_{std::move(other.key_)},
+      dataset_{std::move(other.dataset_)},
+      gateway_{std::move(other.gateway_)},
+      port_{other.port_},
+      send_ts_out_{other.send_ts_out_},
+      version_{other.version_},
+      upgrade_policy_{other.upgrade_policy_},
+      socket_conf_{other.socket_conf_},
+      gateway_addresses_{std::move(other.gateway_addresses_)},
+      client_{std::move(other.client_)},
+      read_buffer_{other.read_buffer_},
+      buffer_size_{other.buffer_size_},
+      buffer_idx_{other.buffer_idx_},
+      compat_buffer_{other.compat_buffer_},
+      session_id_{other.session_id_},
+      current_record_{other.current_record_},
+      record_batch_{std::move(other.record_batch_)},
+      batch_compat_buffer_{std::move(other.batch_compat_buffer_)},
+      journal_{std::move(other.journal_)},
+      stats_{std::move(other.stats_)},
+      last_heartbeat_ns_{
+          other.last_heartbeat_ns_.load(std::memory_order_relaxed)},
+      suppress_heartbeats_{other.suppress_heartbeats_} {}
+
+LiveBlocking& LiveBlocking::operator=(LiveBlocking&& other) noexcept {
+  log_receiver_ = other.log_receiver_;
+  key_ = std::move(other.key_);
+  dataset_ = std::move(other.dataset_);
+  gateway_ = std::move(other.gateway_);
+  port_ = other.port_;
+  send_ts_out_ = other.send_ts_out_;
+  version_ = other.version_;
+  upgrade_policy_ = other.upgrade_policy_;
+  socket_conf_ = other.socket_conf_;
+  gateway_addresses_ = std::move(other.gateway_addresses_);
+  client_ = std::move(other.client_);
+  read_buffer_ = other.read_buffer_;
+  buffer_size_ = other.buffer_size_;
+  buffer_idx_ = other.buffer_idx_;
+  compat_buffer_ = other.compat_buffer_;
+  session_id_ = other.session_id_;
+  current_record_ = other.current_record_;
+  record_batch_ = std::move(other.record_batch_);
+  batch_compat_buffer_ = std::move(other.batch_compat_buffer_);
+  journal_ = std::move(other.journal_);
+  stats_ = std::move(other.stats_);
+  last_heartbeat_ns_.store(
+      other.last_heartbeat_ns_.load(std::memory_order_relaxed),
+      std::memory_order_relaxed);
+  suppress_heartbeats_ = other.suppress_heartbeats_;
+  return *this;
+}
+
 void LiveBlocking::Subscribe(const std::vector<std::string>& symbols,
                              Schema schema, SType stype_in) {
   Subscribe(symbols, schema, stype_in, UnixNanos{});
@@ -59,6 +142,63 @@ void LiveBlocking::Subscribe(const std::vector<std::string>& symbols,
 
 void LiveBlocking::Subscribe(const std::vector<std::string>& symbols,
                              Schema schema, SType stype_in, UnixNanos start) {
+  std::vector<std::string> requests;
+  AppendSubRequests(&requests, symbols, schema, stype_in,
+                    start.time_since_epoch().count()
+                        ? std::to_string(start.time_since_epoch().count())
+                        : std::string{});
+  client_.WriteAllVectored(requests);
+}
+
+void LiveBlocking::Subscribe(const std::vector<std::string>& symbols,
+                             Schema schema, SType stype_in,
+                             const std::string& start) {
+  std::vector<std::string> requests;
+  AppendSubRequests(&requests, symbols, schema, stype_in, start);
+  client_.WriteAllVectored(requests);
+}
+
+void LiveBlocking::Subscribe(const char* const* symbols,
+                             std::size_t symbol_count, Schema schema,
+                             SType stype_in) {
+  Subscribe(symbols, symbol_count, schema, stype_in, UnixNanos{});
+}
+
+void LiveBlocking::Subscribe(const char* const* symbols,
+                             std::size_t symbol_count, Schema schema,
+                             SType stype_in, UnixNanos start) {
+  std::vector<std::string> requests;
+  AppendSubRequests(&requests, symbols, symbol_count, schema, stype_in,
+                    start.time_since_epoch().count()
+                        ? std::to_string(start.time_since_epoch().count())
+                        : std::string{});
+  client_.WriteAllVectored(requests);
+}
+
+void LiveBlocking::Subscribe(const char* const* symbols,
+                             std::size_t symbol_count, Schema schema,
+                             SType stype_in, const std::string& start) {
+  std::vector<std::string> requests;
+  AppendSubRequests(&requests, symbols, symbol_count, schema, stype_in, start);
+  client_.WriteAllVectored(requests);
+}
+
+void LiveBlocking::Subscribe(const std::vector<SubscriptionRequest>& requests) {
+  std::vector<std::string> messages;
+  for (const auto& request : requests) {
+    AppendSubRequests(
+        &messages, request.symbols, request.schema, request.stype_in,
+        request.start.time_since_epoch().count()
+            ? std::to_string(request.start.time_since_epoch().count())
+            : std::string{});
+  }
+  client_.WriteAllVectored(messages);
+}
+
+void LiveBlocking::AppendSubRequests(std::vector<std::string>* requests,
+                                     const std::vector<std::string>& symbols,
+                                     Schema schema, SType stype_in,
+                                     const std::string& start) {
   static constexpr auto kMethodName = "Live::Subscribe";
   constexpr std::ptrdiff_t kSymbolMaxChunkSize = 128;
   if (symbols.empty()) {
@@ -75,44 +215,63 @@ void LiveBlocking::Subscribe(const std::vector<std::string>& symbols,
             << "|stype_in=" << ToString(stype_in) << "|symbols="
             << JoinSymbolStrings(kMethodName, symbols_it,
                                  symbols_it + chunk_size);
-    if (start.time_since_epoch().count()) {
-      sub_msg << "|start=" << start.time_since_epoch().count();
+    if (!start.empty()) {
+      sub_msg << "|start=" << start;
     }
     sub_msg << '\n';
-    client_.WriteAll(sub_msg.str());
+    requests->emplace_back(sub_msg.str());
 
     symbols_it += chunk_size;
   }
 }
 
-void LiveBlocking::Subscribe(const std::vector<std::string>& symbols,
-                             Schema schema, SType stype_in,
-                             const std::string& start) {
-  std::ostringstream sub_msg;
-  sub_msg << "schema=" << ToString(schema) << "|stype_in=" << ToString(stype_in)
-          << "|symbols="
-          << JoinSymbolStrings("LiveBlocking::Subscribe", symbols);
-  if (!start.empty()) {
-    sub_msg << "|start=" << start;
+void LiveBlocking::AppendSubRequests(std::vector<std::string>* requests,
+                                     const char* const* symbols,
+                                     std::size_t symbol_count, Schema schema,
+                                     SType stype_in,
+                                     const std::string& start) {
+  static constexpr auto kMethodName = "Live::Subscribe";
+  constexpr std::size_t kSymbolMaxChunkSize = 128;
+  if (symbol_count == 0) {
+    throw InvalidArgumentError{kMethodName, "symbols",
+                               "must contain at least one symbol"};
   }
-  sub_msg << '\n';
+  for (std::size_t idx = 0; idx < symbol_count; idx += kSymbolMaxChunkSize) {
+    const auto chunk_size = std::min(kSymbolMaxChunkSize, symbol_count - idx);
 
-  client_.WriteAll(sub_msg.str());
+    std::ostringstream sub_msg;
+    sub_msg << "schema=" << ToString(schema)
+            << "|stype_in=" << ToString(stype_in) << "|symbols="
+            << JoinSymbolStrings(kMethodName, &symbols[idx], chunk_size);
+    if (!start.empty()) {
+      sub_msg << "|start=" << start;
+    }
+    sub_msg << '\n';
+    requests->emplace_back(sub_msg.str());
+  }
 }
 
 databento::Metadata LiveBlocking::Start() {
   constexpr auto kMetadataPreludeSize = 8;
   client_.WriteAll("start_session\n");
   client_.ReadExact(read_buffer_.data(), kMetadataPreludeSize);
+  if (journal_) {
+    journal_->Write(read_buffer_.data(), kMetadataPreludeSize);
+  }
   const auto version_and_size = DbnDecoder::DecodeMetadataVersionAndSize(
       reinterpret_cast<std::uint8_t*>(read_buffer_.data()),
       kMetadataPreludeSize);
   std::vector<std::uint8_t> meta_buffer(version_and_size.second);
   client_.ReadExact(reinterpret_cast<char*>(meta_buffer.data()),
                     version_and_size.second);
+  if (journal_) {
+    journal_->Write(reinterpret_cast<const char*>(meta_buffer.data()),
+                    version_and_size.second);
+  }
   auto metadata =
       DbnDecoder::DecodeMetadataFields(version_and_size.first, meta_buffer);
   version_ = metadata.version;
+  TouchLiveness();
   return metadata;
 }
 
@@ -120,40 +279,251 @@ const databento::Record& LiveBlocking::NextRecord() { return *NextRecord({}); }
 
 const databento::Record* LiveBlocking::NextRecord(
     std::chrono::milliseconds timeout) {
-  // need some unread_bytes
-  const auto unread_bytes = buffer_size_ - buffer_idx_;
-  if (unread_bytes == 0) {
-    const auto read_res = FillBuffer(timeout);
-    if (read_res.status == detail::TcpClient::Status::Timeout) {
+  const Record* record;
+  const auto status = TryNextRecord(&record, timeout);
+  switch (status) {
+    case DecodeStatus::Ok: {
+      return record;
+    }
+    case DecodeStatus::Timeout: {
       return nullptr;
     }
-    if (read_res.status == detail::TcpClient::Status::Closed) {
+    case DecodeStatus::SessionClosed: {
       throw DbnResponseError{"Gateway closed the session"};
     }
+    default: {
+      throw DbnResponseError{std::string{"Unexpected failure getting next "
+                                         "record: "} +
+                             ToString(status)};
+    }
+  }
+}
+
+databento::DecodeStatus LiveBlocking::TryNextRecord(
+    const Record** record, std::chrono::milliseconds timeout) noexcept {
+  *record = nullptr;
+  try {
+    for (;;) {
+      // need some unread_bytes
+      const auto unread_bytes = buffer_size_ - buffer_idx_;
+      if (unread_bytes == 0) {
+        const auto read_res = FillBuffer(timeout);
+        if (read_res.status == detail::TcpClient::Status::Timeout) {
+          return DecodeStatus::Timeout;
+        }
+        if (read_res.status == detail::TcpClient::Status::Closed) {
+          return DecodeStatus::SessionClosed;
+        }
+      }
+      // check length
+      while (buffer_size_ - buffer_idx_ < BufferRecordHeader()->Size()) {
+        const auto read_res = FillBuffer(timeout);
+        if (read_res.status == detail::TcpClient::Status::Timeout) {
+          return DecodeStatus::Timeout;
+        }
+        if (read_res.status == detail::TcpClient::Status::Closed) {
+          return DecodeStatus::SessionClosed;
+        }
+      }
+      current_record_ = Record{BufferRecordHeader()};
+      buffer_idx_ += current_record_.Size();
+      current_record_ = DbnDecoder::DecodeRecordCompat(
+          version_, upgrade_policy_, send_ts_out_, &compat_buffer_,
+          current_record_);
+      stats_.AddRecords(1);
+      if (version_ == 1 && upgrade_policy_ == VersionUpgradePolicy::Upgrade) {
+        stats_.AddCompatUpgrades(1);
+      }
+      TouchLiveness();
+      if (suppress_heartbeats_ && IsHeartbeat(current_record_)) {
+        continue;
+      }
+      *record = &current_record_;
+      return DecodeStatus::Ok;
+    }
+  } catch (...) {
+    return DecodeStatus::InternalError;
   }
-  // check length
-  while (buffer_size_ - buffer_idx_ < BufferRecordHeader()->Size()) {
+}
+
+const databento::Record* LiveBlocking::NextRecord(
+    std::chrono::milliseconds timeout, std::chrono::microseconds spin_for) {
+  const auto spin_end = std::chrono::steady_clock::now() + spin_for;
+  do {
+    const Record* record = NextRecordNoWait();
+    if (record != nullptr) {
+      return record;
+    }
+  } while (std::chrono::steady_clock::now() < spin_end);
+  return NextRecord(timeout);
+}
+
+const databento::Record* LiveBlocking::NextRecordNoWait() {
+  const Record* record;
+  const auto status = TryNextRecordNoWait(&record);
+  switch (status) {
+    case DecodeStatus::Ok: {
+      return record;
+    }
+    case DecodeStatus::Timeout: {
+      return nullptr;
+    }
+    case DecodeStatus::SessionClosed: {
+      throw DbnResponseError{"Gateway closed the session"};
+    }
+    default: {
+      throw DbnResponseError{std::string{"Unexpected failure getting next "
+                                         "record: "} +
+                             ToString(status)};
+    }
+  }
+}
+
+databento::DecodeStatus LiveBlocking::TryNextRecordNoWait(
+    const Record** record) noexcept {
+  *record = nullptr;
+  try {
+    for (;;) {
+      auto unread_bytes = buffer_size_ - buffer_idx_;
+      if (unread_bytes == 0 || unread_bytes < BufferRecordHeader()->Size()) {
+        const auto read_res = FillBufferNoWait();
+        if (read_res.status == detail::TcpClient::Status::Closed) {
+          return DecodeStatus::SessionClosed;
+        }
+        unread_bytes = buffer_size_ - buffer_idx_;
+        if (unread_bytes == 0 ||
+            unread_bytes < BufferRecordHeader()->Size()) {
+          return DecodeStatus::Timeout;
+        }
+      }
+      current_record_ = Record{BufferRecordHeader()};
+      buffer_idx_ += current_record_.Size();
+      current_record_ = DbnDecoder::DecodeRecordCompat(
+          version_, upgrade_policy_, send_ts_out_, &compat_buffer_,
+          current_record_);
+      stats_.AddRecords(1);
+      if (version_ == 1 && upgrade_policy_ == VersionUpgradePolicy::Upgrade) {
+        stats_.AddCompatUpgrades(1);
+      }
+      TouchLiveness();
+      if (suppress_heartbeats_ && IsHeartbeat(current_record_)) {
+        continue;
+      }
+      *record = &current_record_;
+      return DecodeStatus::Ok;
+    }
+  } catch (...) {
+    return DecodeStatus::InternalError;
+  }
+}
+
+const std::vector<databento::Record>& LiveBlocking::NextRecordBatch(
+    std::chrono::milliseconds timeout) {
+  record_batch_.clear();
+  batch_compat_buffer_.clear();
+  // need at least one complete record
+  while (buffer_size_ - buffer_idx_ == 0 ||
+         buffer_size_ - buffer_idx_ < BufferRecordHeader()->Size()) {
     const auto read_res = FillBuffer(timeout);
     if (read_res.status == detail::TcpClient::Status::Timeout) {
-      return nullptr;
+      return record_batch_;
     }
     if (read_res.status == detail::TcpClient::Status::Closed) {
       throw DbnResponseError{"Gateway closed the session"};
     }
   }
-  current_record_ = Record{BufferRecordHeader()};
-  buffer_idx_ += current_record_.Size();
-  current_record_ =
-      DbnDecoder::DecodeRecordCompat(version_, upgrade_policy_, send_ts_out_,
-                                     &compat_buffer_, current_record_);
-  return &current_record_;
+  const bool upgrade_records =
+      version_ == 1 && upgrade_policy_ == VersionUpgradePolicy::Upgrade;
+  if (upgrade_records) {
+    // Reserve the worst-case size upfront so pointers into the arena remain
+    // stable while the batch grows
+    batch_compat_buffer_.reserve((buffer_size_ - buffer_idx_) /
+                                 sizeof(RecordHeader) * kMaxRecordLen);
+  }
+  std::size_t record_count = 0;
+  while (buffer_size_ - buffer_idx_ > 0 &&
+         buffer_size_ - buffer_idx_ >= BufferRecordHeader()->Size()) {
+    Record record{BufferRecordHeader()};
+    buffer_idx_ += record.Size();
+    if (upgrade_records) {
+      // kMaxRecordLen is a multiple of alignof(RecordHeader), so each chunk
+      // remains suitably aligned
+      const auto offset = batch_compat_buffer_.size();
+      batch_compat_buffer_.resize(offset + kMaxRecordLen);
+      record = DbnDecoder::DecodeRecordCompat(
+          version_, upgrade_policy_, send_ts_out_,
+          reinterpret_cast<std::array<std::uint8_t, kMaxRecordLen>*>(
+              &batch_compat_buffer_[offset]),
+          record);
+    }
+    ++record_count;
+    if (suppress_heartbeats_ && IsHeartbeat(record)) {
+      continue;
+    }
+    record_batch_.emplace_back(record);
+  }
+  stats_.AddRecords(record_count);
+  if (upgrade_records) {
+    stats_.AddCompatUpgrades(record_count);
+  }
+  TouchLiveness();
+  return record_batch_;
+}
+
+void LiveBlocking::EnableJournal(detail::JournalWriter::Conf conf) {
+  journal_ = std::unique_ptr<detail::JournalWriter>{
+      new detail::JournalWriter{log_receiver_, std::move(conf)}};
 }
 
 void LiveBlocking::Stop() { client_.Close(); }
 
+std::chrono::nanoseconds LiveBlocking::SinceLastHeartbeat() const {
+  const auto last_ns = last_heartbeat_ns_.load(std::memory_order_relaxed);
+  if (last_ns == 0) {
+    return std::chrono::nanoseconds::zero();
+  }
+  const auto now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now().time_since_epoch())
+                          .count();
+  return std::chrono::nanoseconds{now_ns - last_ns};
+}
+
+bool LiveBlocking::IsSessionStale(std::chrono::milliseconds threshold) const {
+  if (last_heartbeat_ns_.load(std::memory_order_relaxed) == 0) {
+    return false;
+  }
+  return SinceLastHeartbeat() > threshold;
+}
+
+void LiveBlocking::TouchLiveness() {
+  const auto now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now().time_since_epoch())
+                          .count();
+  last_heartbeat_ns_.store(now_ns, std::memory_order_relaxed);
+}
+
+bool LiveBlocking::IsHeartbeat(const Record& record) {
+  if (record.RType() != RType::System) {
+    return false;
+  }
+  // Version compat
+  if (record.Header().Size() >= sizeof(SystemMsgV2)) {
+    return record.Get<SystemMsgV2>().IsHeartbeat();
+  }
+  return record.Get<SystemMsgV1>().IsHeartbeat();
+}
+
 void LiveBlocking::Reconnect() {
-  client_ = detail::TcpClient{gateway_, port_};
+  try {
+    client_ = detail::TcpClient{gateway_addresses_, {}, socket_conf_};
+  } catch (const TcpError&) {
+    // The cached addresses may be stale; fall back to a fresh resolution
+    gateway_addresses_ = detail::TcpClient::Resolve(gateway_, port_);
+    client_ = detail::TcpClient{gateway_addresses_, {}, socket_conf_};
+  }
   session_id_ = this->Authenticate();
+  stats_.AddReconnect();
+  DATABENTO_TRACEPOINT(reconnect);
 }
 
 std::string LiveBlocking::DecodeChallenge() {
@@ -164,11 +534,11 @@ std::string LiveBlocking::DecodeChallenge() {
   }
   // first line is version
   std::string response{read_buffer_.data(), buffer_size_};
-  {
+  LogIf(log_receiver_, LogLevel::Debug, [&response] {
     std::ostringstream log_ss;
     log_ss << "[LiveBlocking::DecodeChallenge] Challenge: " << response;
-    log_receiver_->Receive(LogLevel::Debug, log_ss.str());
-  }
+    return log_ss.str();
+  });
   auto first_nl_pos = response.find('\n');
   if (first_nl_pos == std::string::npos) {
     throw LiveApiError::UnexpectedMsg("Received malformed initial message",
@@ -221,11 +591,13 @@ std::uint64_t LiveBlocking::Authenticate() {
   client_.WriteAll(req);
   const std::uint64_t session_id = DecodeAuthResp();
 
-  std::ostringstream log_ss;
-  log_ss << "[LiveBlocking::Authenticate] Successfully authenticated with "
-            "session_id "
-         << session_id;
-  log_receiver_->Receive(LogLevel::Info, log_ss.str());
+  LogIf(log_receiver_, LogLevel::Info, [session_id] {
+    std::ostringstream log_ss;
+    log_ss << "[LiveBlocking::Authenticate] Successfully authenticated with "
+              "session_id "
+           << session_id;
+    return log_ss.str();
+  });
 
   return session_id;
 }
@@ -276,12 +648,12 @@ std::uint64_t LiveBlocking::DecodeAuthResp() {
                       read_buffer_.begin() + buffer_size_, '\n');
   } while (nl_it == read_buffer_.end());
   const std::string response{read_buffer_.cbegin(), nl_it};
-  {
+  LogIf(log_receiver_, LogLevel::Debug, [&response] {
     std::ostringstream log_ss;
     log_ss << "[LiveBlocking::DecodeAuthResp] Authentication response: "
            << response;
-    log_receiver_->Receive(LogLevel::Debug, log_ss.str());
-  }
+    return log_ss.str();
+  });
   // set in case Read call also read records. One beyond newline
   buffer_idx_ = response.length() + 1;
 
@@ -332,6 +704,7 @@ std::uint64_t LiveBlocking::DecodeAuthResp() {
 
 databento::detail::TcpClient::Result LiveBlocking::FillBuffer(
     std::chrono::milliseconds timeout) {
+  DATABENTO_TRACEPOINT(live_fill_buffer_entry);
   // Shift data forward
   std::copy(read_buffer_.cbegin() + static_cast<std::ptrdiff_t>(buffer_idx_),
             read_buffer_.cend(), read_buffer_.begin());
@@ -339,7 +712,34 @@ databento::detail::TcpClient::Result LiveBlocking::FillBuffer(
   buffer_idx_ = 0;
   const auto read_res = client_.ReadSome(
       &read_buffer_[buffer_size_], read_buffer_.size() - buffer_size_, timeout);
+  if (journal_ && read_res.read_size > 0) {
+    journal_->Write(&read_buffer_[buffer_size_], read_res.read_size);
+  }
+  if (read_res.status == detail::TcpClient::Status::Ok) {
+    stats_.AddRead(read_res.read_size);
+  }
+  buffer_size_ += read_res.read_size;
+  DATABENTO_TRACEPOINT1(live_fill_buffer_exit, read_res.read_size);
+  return read_res;
+}
+
+databento::detail::TcpClient::Result LiveBlocking::FillBufferNoWait() {
+  DATABENTO_TRACEPOINT(live_fill_buffer_entry);
+  // Shift data forward
+  std::copy(read_buffer_.cbegin() + static_cast<std::ptrdiff_t>(buffer_idx_),
+            read_buffer_.cend(), read_buffer_.begin());
+  buffer_size_ -= buffer_idx_;
+  buffer_idx_ = 0;
+  const auto read_res = client_.ReadSomeNonBlocking(
+      &read_buffer_[buffer_size_], read_buffer_.size() - buffer_size_);
+  if (journal_ && read_res.read_size > 0) {
+    journal_->Write(&read_buffer_[buffer_size_], read_res.read_size);
+  }
+  if (read_res.status == detail::TcpClient::Status::Ok) {
+    stats_.AddRead(read_res.read_size);
+  }
   buffer_size_ += read_res.read_size;
+  DATABENTO_TRACEPOINT1(live_fill_buffer_exit, read_res.read_size);
   return read_res;
 }
 
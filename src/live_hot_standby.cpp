@@ -0,0 +1,178 @@
+#include "databento/live_hot_standby.hpp"
+
+#include <exception>
+#include <sstream>  // ostringstream
+#include <utility>  // move
+
+#include "databento/log.hpp"  // ILogReceiver, LogLevel
+
+using databento::LiveHotStandby;
+
+namespace {
+std::uint32_t SequenceOf(const databento::Record& record) {
+  using databento::RType;
+  switch (record.RType()) {
+    case RType::Mbo: {
+      return record.Get<databento::MboMsg>().sequence;
+    }
+    case RType::Mbp0: {
+      return record.Get<databento::TradeMsg>().sequence;
+    }
+    case RType::Mbp1: {
+      return record.Get<databento::Mbp1Msg>().sequence;
+    }
+    case RType::Mbp10: {
+      return record.Get<databento::Mbp10Msg>().sequence;
+    }
+    default: {
+      return 0;
+    }
+  }
+}
+}  // namespace
+
+LiveHotStandby::LiveHotStandby(ILogReceiver* log_receiver, std::string key,
+                               std::string dataset, bool send_ts_out,
+                               VersionUpgradePolicy upgrade_policy,
+                               detail::TcpClient::SocketConf socket_conf)
+    : log_receiver_{log_receiver},
+      sessions_{{LiveBlocking{log_receiver, key, dataset, send_ts_out,
+                              upgrade_policy, socket_conf},
+                 LiveBlocking{log_receiver, std::move(key), std::move(dataset),
+                              send_ts_out, upgrade_policy, socket_conf}}} {}
+
+LiveHotStandby::LiveHotStandby(ILogReceiver* log_receiver, std::string key,
+                               std::string dataset, std::string gateway,
+                               std::uint16_t port, bool send_ts_out,
+                               VersionUpgradePolicy upgrade_policy,
+                               detail::TcpClient::SocketConf socket_conf)
+    : log_receiver_{log_receiver},
+      sessions_{{LiveBlocking{log_receiver, key, dataset, gateway, port,
+                              send_ts_out, upgrade_policy, socket_conf},
+                 LiveBlocking{log_receiver, std::move(key), std::move(dataset),
+                              std::move(gateway), port, send_ts_out,
+                              upgrade_policy, socket_conf}}} {}
+
+void LiveHotStandby::Subscribe(const std::vector<std::string>& symbols,
+                               Schema schema, SType stype_in) {
+  Subscribe(symbols, schema, stype_in, UnixNanos{});
+}
+
+void LiveHotStandby::Subscribe(const std::vector<std::string>& symbols,
+                               Schema schema, SType stype_in, UnixNanos start) {
+  for (auto& session : sessions_) {
+    session.Subscribe(symbols, schema, stype_in, start);
+  }
+  subscriptions_.push_back({symbols, schema, stype_in, start, {}});
+}
+
+void LiveHotStandby::Subscribe(const std::vector<std::string>& symbols,
+                               Schema schema, SType stype_in,
+                               const std::string& start) {
+  for (auto& session : sessions_) {
+    session.Subscribe(symbols, schema, stype_in, start);
+  }
+  subscriptions_.push_back({symbols, schema, stype_in, UnixNanos{}, start});
+}
+
+databento::Metadata LiveHotStandby::Start() {
+  Standby().Start();
+  return Active().Start();
+}
+
+const databento::Record& LiveHotStandby::NextRecord() {
+  while (true) {
+    try {
+      const Record& record = Active().NextRecord();
+      if (dedupe_ && IsDuplicate(record)) {
+        continue;
+      }
+      RecordProgress(record);
+      return record;
+    } catch (const std::exception& exc) {
+      if (!Promote(exc)) {
+        throw;
+      }
+    }
+  }
+}
+
+const databento::Record* LiveHotStandby::NextRecord(
+    std::chrono::milliseconds timeout) {
+  while (true) {
+    try {
+      const Record* record = Active().NextRecord(timeout);
+      if (record == nullptr) {
+        return nullptr;
+      }
+      if (dedupe_ && IsDuplicate(*record)) {
+        continue;
+      }
+      RecordProgress(*record);
+      return record;
+    } catch (const std::exception& exc) {
+      if (!Promote(exc)) {
+        throw;
+      }
+    }
+  }
+}
+
+void LiveHotStandby::Stop() {
+  for (auto& session : sessions_) {
+    session.Stop();
+  }
+}
+
+void LiveHotStandby::RearmStandby() {
+  if (standby_ready_) {
+    return;
+  }
+  auto& standby = Standby();
+  standby.Reconnect();
+  for (const auto& subscription : subscriptions_) {
+    if (subscription.start_str.empty()) {
+      standby.Subscribe(subscription.symbols, subscription.schema,
+                        subscription.stype_in, subscription.start);
+    } else {
+      standby.Subscribe(subscription.symbols, subscription.schema,
+                        subscription.stype_in, subscription.start_str);
+    }
+  }
+  standby.Start();
+  standby_ready_ = true;
+}
+
+bool LiveHotStandby::Promote(const std::exception& exc) {
+  if (!standby_ready_) {
+    return false;
+  }
+  standby_ready_ = false;
+  active_ = 1 - active_;
+  dedupe_ = true;
+  ++failover_count_;
+  std::ostringstream log_ss;
+  log_ss << "[LiveHotStandby::Promote] Promoting standby connection after "
+            "exception: "
+         << exc.what();
+  log_receiver_->Receive(LogLevel::Warning, log_ss.str());
+  return true;
+}
+
+bool LiveHotStandby::IsDuplicate(const Record& record) const {
+  const auto progress_it = progress_.find(record.Header().instrument_id);
+  if (progress_it == progress_.end()) {
+    return false;
+  }
+  const auto ts_event = record.Header().ts_event.time_since_epoch().count();
+  const auto sequence = ::SequenceOf(record);
+  return ts_event < progress_it->second.ts_event ||
+         (ts_event == progress_it->second.ts_event &&
+          sequence <= progress_it->second.sequence);
+}
+
+void LiveHotStandby::RecordProgress(const Record& record) {
+  auto& progress = progress_[record.Header().instrument_id];
+  progress.ts_event = record.Header().ts_event.time_since_epoch().count();
+  progress.sequence = ::SequenceOf(record);
+}
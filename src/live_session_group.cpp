@@ -0,0 +1,342 @@
+#include "databento/live_session_group.hpp"
+
+#ifdef __linux__
+#include <sys/epoll.h>  // epoll_create1, epoll_ctl, epoll_event, epoll_wait
+#include <sys/poll.h>   // poll, pollfd, POLLIN
+
+#include <cerrno>  // errno
+#elif defined(_WIN32)
+#include <winsock2.h>  // WSAPoll
+#else
+#include <sys/poll.h>  // poll, pollfd, POLLIN
+
+#include <cerrno>  // errno
+#endif
+
+#include <chrono>   // milliseconds, steady_clock
+#include <cstring>  // memcpy
+#include <deque>
+#include <queue>    // priority_queue
+#include <sstream>  // ostringstream
+#include <utility>  // move
+
+#include "databento/detail/scoped_fd.hpp"  // ScopedFd
+#include "databento/exceptions.hpp"        // TcpError
+#include "databento/log.hpp"               // ILogReceiver, LogLevel
+
+using databento::LiveSessionGroup;
+
+namespace {
+// Bounds how long decoding one session may wait on a partially received
+// record before other ready sessions are serviced
+constexpr std::chrono::milliseconds kDrainTimeout{1};
+
+// Records copied out of one session awaiting the ordered merge, in FIFO
+// order. Each record is padded so every header stays suitably aligned.
+struct SessionBuffer {
+  static std::size_t PaddedSize(std::size_t size) {
+    constexpr auto kAlign = alignof(databento::RecordHeader);
+    return (size + kAlign - 1) & ~(kAlign - 1);
+  }
+
+  bool Empty() const { return read_offset == bytes.size(); }
+  const databento::RecordHeader* Head() const {
+    return reinterpret_cast<const databento::RecordHeader*>(
+        &bytes[read_offset]);
+  }
+  void Push(const databento::Record& record,
+            std::chrono::steady_clock::time_point arrival) {
+    if (Empty()) {
+      bytes.clear();
+      read_offset = 0;
+    }
+    const auto offset = bytes.size();
+    bytes.resize(offset + PaddedSize(record.Size()));
+    std::memcpy(&bytes[offset], &record.Header(), record.Size());
+    arrivals.push_back(arrival);
+  }
+  void PopFront() {
+    read_offset += PaddedSize(Head()->Size());
+    arrivals.pop_front();
+  }
+
+  std::vector<std::uint8_t> bytes;
+  std::size_t read_offset{};
+  // The local receive time of each buffered record, for the staleness window
+  std::deque<std::chrono::steady_clock::time_point> arrivals;
+};
+
+// An entry in the merge heap: the ts_event of one session's head record
+struct HeapEntry {
+  databento::UnixNanos ts_event;
+  std::size_t session;
+};
+
+struct HeapEntryAfter {
+  bool operator()(const HeapEntry& lhs, const HeapEntry& rhs) const {
+    return lhs.ts_event > rhs.ts_event;
+  }
+};
+}  // namespace
+
+LiveSessionGroup::LiveSessionGroup(ILogReceiver* log_receiver)
+    : log_receiver_{log_receiver} {}
+
+std::size_t LiveSessionGroup::AddSession(LiveBlocking session) {
+  sessions_.emplace_back(std::move(session));
+  return sessions_.size() - 1;
+}
+
+std::vector<databento::Metadata> LiveSessionGroup::Start() {
+  std::vector<Metadata> metadata;
+  metadata.reserve(sessions_.size());
+  for (auto& session : sessions_) {
+    metadata.emplace_back(session.Start());
+  }
+  return metadata;
+}
+
+void LiveSessionGroup::Run(const GroupRecordCallback& callback) {
+  static constexpr auto kMethodName = "LiveSessionGroup::Run";
+  std::vector<bool> open(sessions_.size(), true);
+  std::size_t open_count = sessions_.size();
+  const auto close_session = [this, &open, &open_count](
+                                 std::size_t session,
+                                 const std::exception& exc) {
+    sessions_[session].Stop();
+    open[session] = false;
+    --open_count;
+    std::ostringstream log_ss;
+    log_ss << kMethodName << " Closing session " << session
+           << " after exception: " << exc.what();
+    log_receiver_->Receive(LogLevel::Warning, log_ss.str());
+  };
+#ifdef __linux__
+  const detail::ScopedFd epoll_fd{::epoll_create1(0)};
+  if (epoll_fd.Get() < 0) {
+    throw TcpError{errno, "Failed to create epoll instance"};
+  }
+  for (std::size_t session = 0; session < sessions_.size(); ++session) {
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.u64 = session;
+    if (::epoll_ctl(epoll_fd.Get(), EPOLL_CTL_ADD,
+                    sessions_[session].SocketFd(), &ev) != 0) {
+      throw TcpError{errno, "Failed to register session socket"};
+    }
+  }
+  std::vector<epoll_event> events(sessions_.size());
+  while (open_count > 0) {
+    const int ready = ::epoll_wait(epoll_fd.Get(), events.data(),
+                                   static_cast<int>(events.size()), -1);
+    if (ready < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw TcpError{errno, "Failed to wait on session sockets"};
+    }
+    for (int i = 0; i < ready; ++i) {
+      const auto session = static_cast<std::size_t>(events[i].data.u64);
+      if (!open[session]) {
+        continue;
+      }
+      try {
+        if (!DrainSession(session, callback)) {
+          return;
+        }
+      } catch (const std::exception& exc) {
+        // Deregister before Stop closes the socket
+        ::epoll_ctl(epoll_fd.Get(), EPOLL_CTL_DEL,
+                    sessions_[session].SocketFd(), nullptr);
+        close_session(session, exc);
+      }
+    }
+  }
+#else
+  while (open_count > 0) {
+    std::vector<pollfd> fds;
+    std::vector<std::size_t> fd_sessions;
+    for (std::size_t session = 0; session < sessions_.size(); ++session) {
+      if (open[session]) {
+        fds.push_back({sessions_[session].SocketFd(), POLLIN, {}});
+        fd_sessions.push_back(session);
+      }
+    }
+    const int ready =
+#ifdef _WIN32
+        ::WSAPoll(fds.data(), static_cast<ULONG>(fds.size()), -1);
+#else
+        ::poll(fds.data(), fds.size(), -1);
+#endif
+    if (ready < 0) {
+#ifdef _WIN32
+      throw TcpError{::WSAGetLastError(), "Failed to wait on session sockets"};
+#else
+      if (errno == EINTR) {
+        continue;
+      }
+      throw TcpError{errno, "Failed to wait on session sockets"};
+#endif
+    }
+    for (std::size_t i = 0; i < fds.size(); ++i) {
+      if (fds[i].revents == 0) {
+        continue;
+      }
+      const auto session = fd_sessions[i];
+      try {
+        if (!DrainSession(session, callback)) {
+          return;
+        }
+      } catch (const std::exception& exc) {
+        close_session(session, exc);
+      }
+    }
+  }
+#endif
+}
+
+void LiveSessionGroup::RunOrdered(std::chrono::milliseconds staleness_window,
+                                  const GroupRecordCallback& callback) {
+  static constexpr auto kMethodName = "LiveSessionGroup::RunOrdered";
+  std::vector<bool> open(sessions_.size(), true);
+  std::size_t open_count = sessions_.size();
+  std::vector<SessionBuffer> buffers(sessions_.size());
+  // One entry per session with buffered records, keyed on its head's
+  // ts_event
+  std::priority_queue<HeapEntry, std::vector<HeapEntry>, HeapEntryAfter> heap;
+  const auto close_session = [this, &open, &open_count](
+                                 std::size_t session,
+                                 const std::exception& exc) {
+    sessions_[session].Stop();
+    open[session] = false;
+    --open_count;
+    std::ostringstream log_ss;
+    log_ss << kMethodName << " Closing session " << session
+           << " after exception: " << exc.what();
+    log_receiver_->Receive(LogLevel::Warning, log_ss.str());
+  };
+  // Copies every immediately available record from one session into its
+  // buffer, pushing a heap entry when the buffer gains a new head
+  const auto buffer_records = [this, &buffers, &heap](std::size_t session) {
+    const auto arrival = std::chrono::steady_clock::now();
+    while (const Record* record = sessions_[session].NextRecordNoWait()) {
+      auto& buffer = buffers[session];
+      const bool was_empty = buffer.Empty();
+      buffer.Push(*record, arrival);
+      if (was_empty) {
+        heap.push({buffer.Head()->ts_event, session});
+      }
+    }
+  };
+  // The arrival time of the oldest held record across all session heads, or
+  // a default-constructed time_point when nothing is held
+  const auto oldest_arrival = [this, &buffers] {
+    std::chrono::steady_clock::time_point res{};
+    bool found = false;
+    for (std::size_t session = 0; session < sessions_.size(); ++session) {
+      if (buffers[session].Empty()) {
+        continue;
+      }
+      const auto arrival = buffers[session].arrivals.front();
+      if (!found || arrival < res) {
+        res = arrival;
+        found = true;
+      }
+    }
+    return res;
+  };
+
+  while (open_count > 0 || !heap.empty()) {
+    // Deliver every record that's either safe to merge or past the
+    // staleness window
+    while (!heap.empty()) {
+      std::size_t buffered_open_count = 0;
+      for (std::size_t session = 0; session < sessions_.size(); ++session) {
+        if (open[session] && !buffers[session].Empty()) {
+          ++buffered_open_count;
+        }
+      }
+      if (buffered_open_count < open_count &&
+          std::chrono::steady_clock::now() <
+              oldest_arrival() + staleness_window) {
+        break;
+      }
+      const auto top = heap.top();
+      heap.pop();
+      auto& buffer = buffers[top.session];
+      const Record record{const_cast<RecordHeader*>(buffer.Head())};
+      const auto ret = callback(top.session, record);
+      buffer.PopFront();
+      if (!buffer.Empty()) {
+        heap.push({buffer.Head()->ts_event, top.session});
+      }
+      if (ret == KeepGoing::Stop) {
+        return;
+      }
+    }
+    if (open_count == 0) {
+      continue;
+    }
+    // Unlike Run, poll on every platform: the wait needs a fresh timeout
+    // each cycle for the staleness deadline, and k is small
+    int timeout = -1;
+    if (!heap.empty()) {
+      const auto deadline = oldest_arrival() + staleness_window;
+      const auto now = std::chrono::steady_clock::now();
+      if (deadline <= now) {
+        timeout = 0;
+      } else {
+        // Round up so the deadline has passed once the wait returns
+        timeout = static_cast<int>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline -
+                                                                  now)
+                .count() +
+            1);
+      }
+    }
+    std::vector<pollfd> fds;
+    std::vector<std::size_t> fd_sessions;
+    for (std::size_t session = 0; session < sessions_.size(); ++session) {
+      if (open[session]) {
+        fds.push_back({sessions_[session].SocketFd(), POLLIN, {}});
+        fd_sessions.push_back(session);
+      }
+    }
+    const int ready =
+#ifdef _WIN32
+        ::WSAPoll(fds.data(), static_cast<ULONG>(fds.size()), timeout);
+#else
+        ::poll(fds.data(), fds.size(), timeout);
+#endif
+    if (ready < 0) {
+#ifdef _WIN32
+      throw TcpError{::WSAGetLastError(), "Failed to wait on session sockets"};
+#else
+      if (errno == EINTR) {
+        continue;
+      }
+      throw TcpError{errno, "Failed to wait on session sockets"};
+#endif
+    }
+    for (std::size_t i = 0; i < fds.size(); ++i) {
+      if (fds[i].revents == 0) {
+        continue;
+      }
+      try {
+        buffer_records(fd_sessions[i]);
+      } catch (const std::exception& exc) {
+        close_session(fd_sessions[i], exc);
+      }
+    }
+  }
+}
+
+bool LiveSessionGroup::DrainSession(std::size_t session,
+                                    const GroupRecordCallback& callback) {
+  while (const Record* record = sessions_[session].NextRecord(kDrainTimeout)) {
+    if (callback(session, *record) == KeepGoing::Stop) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -1,5 +1,23 @@
 #include "databento/live_threaded.hpp"
 
+#ifdef _WIN32
+#include <windows.h>  // SetThreadAffinityMask, SetThreadPriority
+#else
+#include <pthread.h>  // pthread_self, pthread_setschedparam
+#include <sched.h>    // sched_param
+
+#include <cstring>  // strerror
+#ifdef __linux__
+#include <linux/mempolicy.h>  // MPOL_MF_MOVE, MPOL_PREFERRED
+#include <sys/syscall.h>  // __NR_get_mempolicy, __NR_mbind, __NR_set_mempolicy
+#include <unistd.h>       // syscall, sysconf
+
+#include <cerrno>   // errno
+#include <cstdint>  // uintptr_t
+#include <fstream>  // ifstream
+#endif
+#endif
+
 #include <atomic>
 #include <chrono>  // milliseconds
 #include <condition_variable>
@@ -9,12 +27,192 @@
 #include <thread>
 #include <utility>  // forward, move, swap
 
-#include "databento/detail/scoped_thread.hpp"  // ScopedThread
-#include "databento/live_blocking.hpp"         // LiveBlocking
+#include "databento/constants.hpp"                 // kUndefTimestamp
+#include "databento/detail/scoped_thread.hpp"      // ScopedThread
+#include "databento/detail/spsc_record_queue.hpp"  // SpscRecordQueue
+#include "databento/detail/trace.hpp"
+#include "databento/live_blocking.hpp"             // LiveBlocking
 #include "databento/log.hpp"
 
 using databento::LiveThreaded;
 
+namespace {
+void WarnThreadConf(databento::ILogReceiver* log_receiver, const char* action,
+                    int err_num) {
+  std::ostringstream log_ss;
+  log_ss << "[LiveThreaded::ProcessingThread] Failed to " << action << ": "
+#ifdef _WIN32
+         << err_num;
+#else
+         << std::strerror(err_num);
+#endif
+  log_receiver->Receive(databento::LogLevel::Warning, log_ss.str());
+}
+
+#ifdef __linux__
+// Sets the calling thread's allocation policy to prefer `node`, so buffers
+// it allocates and first touches land on that node.
+bool SetPreferredNode(int node) {
+  const unsigned long node_mask = 1UL << node;
+  return ::syscall(__NR_set_mempolicy, MPOL_PREFERRED, &node_mask,
+                   sizeof(node_mask) * 8) == 0;
+}
+
+// Pins the calling thread to the CPUs of `node`, read from sysfs. Returns
+// false when the node doesn't exist or the affinity call fails.
+bool BindThreadToNode(int node) {
+  std::ostringstream path_ss;
+  path_ss << "/sys/devices/system/node/node" << node << "/cpulist";
+  std::ifstream cpulist{path_ss.str()};
+  if (!cpulist) {
+    return false;
+  }
+  ::cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  // Comma-separated CPUs and hyphenated ranges, e.g. 0-3,8-11
+  std::string range;
+  while (std::getline(cpulist, range, ',')) {
+    std::istringstream range_ss{range};
+    int first{};
+    int last{};
+    char hyphen{};
+    range_ss >> first;
+    if (!(range_ss >> hyphen >> last)) {
+      last = first;
+    }
+    for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu) {
+      CPU_SET(cpu, &cpu_set);
+    }
+  }
+  return ::pthread_setaffinity_np(::pthread_self(), sizeof(cpu_set),
+                                  &cpu_set) == 0;
+}
+
+// Moves the pages backing [addr, addr + length) to `node`. The range is
+// widened to page boundaries as mbind requires.
+bool MigrateToNode(const void* addr, std::size_t length, int node) {
+  const auto page_size = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+  auto begin = reinterpret_cast<std::uintptr_t>(addr);
+  const auto end = begin + length;
+  begin &= ~(page_size - 1);
+  const unsigned long node_mask = 1UL << node;
+  return ::syscall(__NR_mbind, begin, end - begin, MPOL_PREFERRED, &node_mask,
+                   sizeof(node_mask) * 8, MPOL_MF_MOVE) == 0;
+}
+#endif
+
+// Allocates the record queue with the calling thread's allocation policy
+// temporarily set to prefer `node`, so its slots land there rather than on
+// whichever node Start was called from. Falls back to a default allocation
+// when the policy can't be saved or set.
+std::unique_ptr<databento::detail::SpscRecordQueue> AllocateQueueOnNode(
+    databento::ILogReceiver* log_receiver, std::size_t capacity, int node) {
+#ifdef __linux__
+  if (node >= 0 &&
+      static_cast<std::size_t>(node) < sizeof(unsigned long) * 8) {
+    int old_mode{};
+    unsigned long old_mask{};
+    const bool saved = ::syscall(__NR_get_mempolicy, &old_mode, &old_mask,
+                                 sizeof(old_mask) * 8, nullptr, 0UL) == 0;
+    if (saved && SetPreferredNode(node)) {
+      std::unique_ptr<databento::detail::SpscRecordQueue> queue{
+          new databento::detail::SpscRecordQueue{capacity}};
+      const unsigned long* restore_mask =
+          old_mode == MPOL_DEFAULT || old_mask == 0 ? nullptr : &old_mask;
+      if (::syscall(__NR_set_mempolicy, old_mode, restore_mask,
+                    restore_mask == nullptr ? 0 : sizeof(old_mask) * 8) != 0) {
+        WarnThreadConf(log_receiver, "restore NUMA memory policy", errno);
+      }
+      return queue;
+    }
+    WarnThreadConf(log_receiver, "allocate record queue on NUMA node", errno);
+  }
+#else
+  static_cast<void>(log_receiver);
+  static_cast<void>(node);
+#endif
+  return std::unique_ptr<databento::detail::SpscRecordQueue>{
+      new databento::detail::SpscRecordQueue{capacity}};
+}
+
+// Applies `numa_node` to the calling thread: binds it to the node's CPUs
+// (unless the thread is pinned more specifically elsewhere) and prefers the
+// node for its allocations. A no-op when negative or off Linux.
+void ApplyNumaConf(databento::ILogReceiver* log_receiver, int numa_node,
+                   bool bind_cpus) {
+#ifdef __linux__
+  if (numa_node < 0) {
+    return;
+  }
+  if (static_cast<std::size_t>(numa_node) >= sizeof(unsigned long) * 8) {
+    WarnThreadConf(log_receiver, "bind to NUMA node", EINVAL);
+    return;
+  }
+  if (bind_cpus && !BindThreadToNode(numa_node)) {
+    WarnThreadConf(log_receiver, "bind thread to NUMA node CPUs", errno);
+  }
+  if (!SetPreferredNode(numa_node)) {
+    WarnThreadConf(log_receiver, "set NUMA memory policy", errno);
+  }
+#else
+  static_cast<void>(log_receiver);
+  static_cast<void>(numa_node);
+  static_cast<void>(bind_cpus);
+#endif
+}
+
+// Applies `thread_conf` to the calling thread. Failures, e.g. from elevated
+// scheduling policies requiring privileges, are logged rather than thrown.
+void ApplyThreadConf(databento::ILogReceiver* log_receiver,
+                     const LiveThreaded::ThreadConf& thread_conf) {
+#ifdef _WIN32
+  if (thread_conf.cpu >= 0 &&
+      ::SetThreadAffinityMask(::GetCurrentThread(),
+                              DWORD_PTR{1} << thread_conf.cpu) == 0) {
+    WarnThreadConf(log_receiver, "pin thread to CPU",
+                   static_cast<int>(::GetLastError()));
+  }
+  if (thread_conf.sched_priority != 0 &&
+      ::SetThreadPriority(::GetCurrentThread(), thread_conf.sched_priority) ==
+          0) {
+    WarnThreadConf(log_receiver, "set thread priority",
+                   static_cast<int>(::GetLastError()));
+  }
+#else
+#ifdef __linux__
+  ApplyNumaConf(log_receiver, thread_conf.numa_node, thread_conf.cpu < 0);
+  if (thread_conf.cpu >= 0) {
+    ::cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(thread_conf.cpu, &cpu_set);
+    const auto res =
+        ::pthread_setaffinity_np(::pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (res != 0) {
+      WarnThreadConf(log_receiver, "pin thread to CPU", res);
+    }
+  }
+  if (!thread_conf.name.empty()) {
+    // Linux thread names are limited to 15 characters plus the NUL byte
+    const auto res = ::pthread_setname_np(
+        ::pthread_self(), thread_conf.name.substr(0, 15).c_str());
+    if (res != 0) {
+      WarnThreadConf(log_receiver, "set thread name", res);
+    }
+  }
+#endif
+  if (thread_conf.sched_policy >= 0) {
+    ::sched_param param{};
+    param.sched_priority = thread_conf.sched_priority;
+    const auto res = ::pthread_setschedparam(::pthread_self(),
+                                             thread_conf.sched_policy, &param);
+    if (res != 0) {
+      WarnThreadConf(log_receiver, "set scheduling policy", res);
+    }
+  }
+#endif
+}
+}  // namespace
+
 struct LiveThreaded::Impl {
   template <typename... A>
   explicit Impl(ILogReceiver* log_receiver, A&&... args)
@@ -33,11 +231,57 @@ struct LiveThreaded::Impl {
   KeepGoing last_cb_ret{KeepGoing::Continue};
   std::mutex last_cb_ret_mutex;
   std::condition_variable last_cb_ret_cv;
+  ThreadConf thread_conf{};
+  // The following four members are only used by the queued `Start` overloads
+  std::unique_ptr<detail::SpscRecordQueue> queue;
+  std::atomic<bool> producer_done{false};
+  std::atomic<bool> stop_requested{false};
+  std::atomic<std::uint64_t> queue_drop_count{0};
+  // Set via `EnableLatencyWatch`
+  bool latency_watch{false};
+  LatencyWatchConf latency_conf{};
+  LatencyHistogram latency_hist{};
+  // Set via `EnableStaleWatch`
+  bool stale_watch{false};
+  StaleWatchConf stale_conf{};
+  // Set via `EnableFastForward`
+  bool fast_forward{false};
+  FastForwardConf ff_conf{};
+  // Whether a fast-forward episode is in progress, and what it has skipped
+  // so far. Only touched by the processing thread.
+  bool ff_active{false};
+  std::uint64_t ff_episode_records{0};
+  std::uint64_t ff_episode_bytes{0};
+  std::atomic<std::uint64_t> ff_skip_count{0};
+  // Set via `EnableGapBackfill`
+  bool gap_backfill{false};
+  GapBackfillConf backfill_conf{};
+  // Subscriptions to replay on `Reconnect`, guarded by `subscriptions_mutex`
+  std::mutex subscriptions_mutex;
+  std::vector<SubscriptionRequest> subscriptions;
+  // ts_event of the last record delivered to the callback. Written by the
+  // processing thread; read by `Reconnect`, which may run on another thread.
+  std::atomic<std::uint64_t> last_ts_event{0};
+  // While nonzero, replayed records with ts_event at or before this cutoff
+  // are dropped as duplicates. Written by `Reconnect`.
+  std::atomic<std::uint64_t> backfill_cutoff{0};
+  // What the current backfill episode has deduped. Processing thread only.
+  std::uint64_t backfill_episode_deduped{0};
+  std::atomic<std::uint64_t> backfill_dedupe_count{0};
+  // Set via `EnableWireLatencyWatch`
+  bool wire_latency_watch{false};
+  LatencyHistogram wire_latency_hist{};
+  // Coarse receive clock for the wire latency watch, refreshed every
+  // kWireClockInterval records and on idle
+  std::int64_t wire_clock_ns{0};
+  std::uint32_t records_since_clock_refresh{0};
   LiveBlocking blocking;
 };
 
 LiveThreaded::LiveThreaded(LiveThreaded&& other) noexcept
-    : impl_{std::move(other.impl_)}, thread_{std::move(other.thread_)} {}
+    : impl_{std::move(other.impl_)},
+      thread_{std::move(other.thread_)},
+      consumer_thread_{std::move(other.consumer_thread_)} {}
 
 LiveThreaded& LiveThreaded::operator=(LiveThreaded&& rhs) noexcept {
   if (impl_) {
@@ -45,6 +289,7 @@ LiveThreaded& LiveThreaded::operator=(LiveThreaded&& rhs) noexcept {
   }
   std::swap(impl_, rhs.impl_);
   std::swap(thread_, rhs.thread_);
+  std::swap(consumer_thread_, rhs.consumer_thread_);
   return *this;
 }
 
@@ -60,6 +305,13 @@ LiveThreaded::LiveThreaded(ILogReceiver* log_receiver, std::string key,
     : impl_{new Impl{log_receiver, std::move(key), std::move(dataset),
                      send_ts_out, upgrade_policy}} {}
 
+LiveThreaded::LiveThreaded(ILogReceiver* log_receiver, std::string key,
+                           std::string dataset, bool send_ts_out,
+                           VersionUpgradePolicy upgrade_policy,
+                           detail::TcpClient::SocketConf socket_conf)
+    : impl_{new Impl{log_receiver, std::move(key), std::move(dataset),
+                     send_ts_out, upgrade_policy, socket_conf}} {}
+
 LiveThreaded::LiveThreaded(ILogReceiver* log_receiver, std::string key,
                            std::string dataset, std::string gateway,
                            std::uint16_t port, bool send_ts_out,
@@ -67,6 +319,15 @@ LiveThreaded::LiveThreaded(ILogReceiver* log_receiver, std::string key,
     : impl_{new Impl{log_receiver, std::move(key), std::move(dataset),
                      std::move(gateway), port, send_ts_out, upgrade_policy}} {}
 
+LiveThreaded::LiveThreaded(ILogReceiver* log_receiver, std::string key,
+                           std::string dataset, std::string gateway,
+                           std::uint16_t port, bool send_ts_out,
+                           VersionUpgradePolicy upgrade_policy,
+                           detail::TcpClient::SocketConf socket_conf)
+    : impl_{new Impl{log_receiver, std::move(key), std::move(dataset),
+                     std::move(gateway), port, send_ts_out, upgrade_policy,
+                     socket_conf}} {}
+
 const std::string& LiveThreaded::Key() const { return impl_->blocking.Key(); }
 
 const std::string& LiveThreaded::Dataset() const {
@@ -85,22 +346,93 @@ databento::VersionUpgradePolicy LiveThreaded::UpgradePolicy() const {
   return impl_->blocking.UpgradePolicy();
 }
 
+void LiveThreaded::SetThreadConf(ThreadConf thread_conf) {
+  impl_->thread_conf = std::move(thread_conf);
+}
+
 void LiveThreaded::Subscribe(const std::vector<std::string>& symbols,
                              Schema schema, SType stype_in) {
-  impl_->blocking.Subscribe(symbols, schema, stype_in);
+  Subscribe(symbols, schema, stype_in, UnixNanos{});
 }
 
 void LiveThreaded::Subscribe(const std::vector<std::string>& symbols,
                              Schema schema, SType stype_in, UnixNanos start) {
+  if (impl_->gap_backfill) {
+    SubscriptionRequest request{};
+    request.symbols = symbols;
+    request.schema = schema;
+    request.stype_in = stype_in;
+    request.start = start;
+    const std::lock_guard<std::mutex> lock{impl_->subscriptions_mutex};
+    impl_->subscriptions.emplace_back(std::move(request));
+  }
   impl_->blocking.Subscribe(symbols, schema, stype_in, start);
 }
 
 void LiveThreaded::Subscribe(const std::vector<std::string>& symbols,
                              Schema schema, SType stype_in,
                              const std::string& start) {
+  if (impl_->gap_backfill) {
+    // The replay start is re-derived from the last delivered record, so the
+    // original string start isn't needed for backfill
+    SubscriptionRequest request{};
+    request.symbols = symbols;
+    request.schema = schema;
+    request.stype_in = stype_in;
+    const std::lock_guard<std::mutex> lock{impl_->subscriptions_mutex};
+    impl_->subscriptions.emplace_back(std::move(request));
+  }
   impl_->blocking.Subscribe(symbols, schema, stype_in, start);
 }
 
+void LiveThreaded::Subscribe(const char* const* symbols,
+                             std::size_t symbol_count, Schema schema,
+                             SType stype_in) {
+  Subscribe(symbols, symbol_count, schema, stype_in, UnixNanos{});
+}
+
+void LiveThreaded::Subscribe(const char* const* symbols,
+                             std::size_t symbol_count, Schema schema,
+                             SType stype_in, UnixNanos start) {
+  if (impl_->gap_backfill) {
+    // Re-subscribing after a gap requires owned copies of the symbols
+    SubscriptionRequest request{};
+    request.symbols.assign(symbols, symbols + symbol_count);
+    request.schema = schema;
+    request.stype_in = stype_in;
+    request.start = start;
+    const std::lock_guard<std::mutex> lock{impl_->subscriptions_mutex};
+    impl_->subscriptions.emplace_back(std::move(request));
+  }
+  impl_->blocking.Subscribe(symbols, symbol_count, schema, stype_in, start);
+}
+
+void LiveThreaded::Subscribe(const char* const* symbols,
+                             std::size_t symbol_count, Schema schema,
+                             SType stype_in, const std::string& start) {
+  if (impl_->gap_backfill) {
+    // Re-subscribing after a gap requires owned copies of the symbols. The
+    // replay start is re-derived from the last delivered record, so the
+    // original string start isn't needed for backfill
+    SubscriptionRequest request{};
+    request.symbols.assign(symbols, symbols + symbol_count);
+    request.schema = schema;
+    request.stype_in = stype_in;
+    const std::lock_guard<std::mutex> lock{impl_->subscriptions_mutex};
+    impl_->subscriptions.emplace_back(std::move(request));
+  }
+  impl_->blocking.Subscribe(symbols, symbol_count, schema, stype_in, start);
+}
+
+void LiveThreaded::Subscribe(const std::vector<SubscriptionRequest>& requests) {
+  if (impl_->gap_backfill) {
+    const std::lock_guard<std::mutex> lock{impl_->subscriptions_mutex};
+    impl_->subscriptions.insert(impl_->subscriptions.end(), requests.begin(),
+                                requests.end());
+  }
+  impl_->blocking.Subscribe(requests);
+}
+
 void LiveThreaded::Start(RecordCallback callback) {
   Start({}, std::move(callback), {});
 }
@@ -128,7 +460,162 @@ void LiveThreaded::Start(MetadataCallback metadata_callback,
                                  std::move(exception_callback)};
 }
 
-void LiveThreaded::Reconnect() { impl_->blocking.Reconnect(); }
+void LiveThreaded::Start(BatchRecordCallback batch_callback) {
+  Start({}, std::move(batch_callback), {});
+}
+
+void LiveThreaded::Start(MetadataCallback metadata_callback,
+                         BatchRecordCallback batch_callback) {
+  Start(std::move(metadata_callback), std::move(batch_callback), {});
+}
+
+void LiveThreaded::Start(MetadataCallback metadata_callback,
+                         BatchRecordCallback batch_callback,
+                         ExceptionCallback exception_callback) {
+  // Deadlock check
+  if (std::this_thread::get_id() == thread_.Id()) {
+    std::ostringstream log_ss;
+    log_ss << "[LiveThreaded::Start] Called Start from callback thread, which "
+              "would cause a deadlock. Ignoring.";
+    impl_->log_receiver->Receive(LogLevel::Warning, log_ss.str());
+    return;
+  }
+  // Safe to pass raw pointer because `thread_` cannot outlive `impl_`
+  thread_ = detail::ScopedThread{
+      &LiveThreaded::BatchProcessingThread, impl_.get(),
+      std::move(metadata_callback), std::move(batch_callback),
+      std::move(exception_callback)};
+}
+
+void LiveThreaded::Start(QueueConf queue_conf,
+                         RecordCallback record_callback) {
+  Start(queue_conf, {}, std::move(record_callback), {});
+}
+
+void LiveThreaded::Start(QueueConf queue_conf,
+                         MetadataCallback metadata_callback,
+                         RecordCallback record_callback,
+                         ExceptionCallback exception_callback) {
+  // Deadlock check
+  if (std::this_thread::get_id() == thread_.Id() ||
+      std::this_thread::get_id() == consumer_thread_.Id()) {
+    std::ostringstream log_ss;
+    log_ss << "[LiveThreaded::Start] Called Start from callback thread, which "
+              "would cause a deadlock. Ignoring.";
+    impl_->log_receiver->Receive(LogLevel::Warning, log_ss.str());
+    return;
+  }
+  impl_->queue = AllocateQueueOnNode(impl_->log_receiver, queue_conf.capacity,
+                                     impl_->thread_conf.numa_node);
+  impl_->producer_done.store(false, std::memory_order_relaxed);
+  impl_->stop_requested.store(false, std::memory_order_relaxed);
+  // Safe to pass raw pointers because the threads cannot outlive `impl_`
+  thread_ = detail::ScopedThread{
+      &LiveThreaded::QueuedProcessingThread, impl_.get(),
+      std::move(metadata_callback), std::move(exception_callback),
+      queue_conf.overflow_policy};
+  consumer_thread_ = detail::ScopedThread{&LiveThreaded::QueueConsumerThread,
+                                          impl_.get(),
+                                          std::move(record_callback)};
+}
+
+std::uint64_t LiveThreaded::QueueDropCount() const {
+  return impl_->queue_drop_count.load(std::memory_order_relaxed);
+}
+
+databento::ClientStats LiveThreaded::Stats() const {
+  return impl_->blocking.Stats();
+}
+
+void LiveThreaded::SuppressHeartbeats(bool suppress) {
+  impl_->blocking.SuppressHeartbeats(suppress);
+}
+
+bool LiveThreaded::IsSessionStale(std::chrono::milliseconds threshold) const {
+  return impl_->blocking.IsSessionStale(threshold);
+}
+
+void LiveThreaded::EnableStaleWatch(StaleWatchConf conf) {
+  impl_->stale_watch =
+      conf.threshold.count() > 0 && static_cast<bool>(conf.stale_hook);
+  impl_->stale_conf = std::move(conf);
+}
+
+void LiveThreaded::EnableFastForward(FastForwardConf conf) {
+  impl_->fast_forward = conf.backlog_threshold_bytes > 0 &&
+                        conf.staleness_bound.count() > 0;
+  impl_->ff_conf = std::move(conf);
+}
+
+std::uint64_t LiveThreaded::FastForwardSkipCount() const {
+  return impl_->ff_skip_count.load(std::memory_order_relaxed);
+}
+
+void LiveThreaded::EnableGapBackfill(GapBackfillConf conf) {
+  impl_->gap_backfill = true;
+  impl_->backfill_conf = std::move(conf);
+}
+
+std::uint64_t LiveThreaded::GapBackfillDedupeCount() const {
+  return impl_->backfill_dedupe_count.load(std::memory_order_relaxed);
+}
+
+void LiveThreaded::EnableLatencyWatch(LatencyWatchConf conf) {
+  impl_->latency_conf = std::move(conf);
+  impl_->latency_watch = true;
+}
+
+void LiveThreaded::EnableWireLatencyWatch() {
+  if (!impl_->blocking.SendTsOut()) {
+    impl_->log_receiver->Receive(
+        LogLevel::Warning,
+        "[LiveThreaded::EnableWireLatencyWatch] Wire latency requires "
+        "send_ts_out; watch disabled");
+    return;
+  }
+  impl_->wire_latency_watch = true;
+}
+
+const databento::LatencyHistogram& LiveThreaded::WireLatencies() const {
+  return impl_->wire_latency_hist;
+}
+
+const databento::LatencyHistogram& LiveThreaded::CallbackLatencies() const {
+  return impl_->latency_hist;
+}
+
+void LiveThreaded::EnableJournal(detail::JournalWriter::Conf conf) {
+  impl_->blocking.EnableJournal(std::move(conf));
+}
+
+void LiveThreaded::Reconnect() {
+  impl_->blocking.Reconnect();
+  if (!impl_->gap_backfill) {
+    return;
+  }
+  std::vector<SubscriptionRequest> requests;
+  {
+    const std::lock_guard<std::mutex> lock{impl_->subscriptions_mutex};
+    requests = impl_->subscriptions;
+  }
+  if (requests.empty()) {
+    return;
+  }
+  const auto last = impl_->last_ts_event.load(std::memory_order_relaxed);
+  if (last > 0) {
+    // Replay from the last delivered record; the overlap is deduped on the
+    // processing thread
+    for (auto& request : requests) {
+      request.start = UnixNanos{std::chrono::nanoseconds{last}};
+    }
+    impl_->backfill_cutoff.store(last, std::memory_order_relaxed);
+    std::ostringstream log_ss;
+    log_ss << "[LiveThreaded::Reconnect] Replaying from ts_event " << last
+           << " to backfill the reconnect gap";
+    impl_->log_receiver->Receive(LogLevel::Info, log_ss.str());
+  }
+  impl_->blocking.Subscribe(requests);
+}
 
 void LiveThreaded::BlockForStop() {
   std::unique_lock<std::mutex> lock{impl_->last_cb_ret_mutex};
@@ -151,6 +638,134 @@ databento::KeepGoing LiveThreaded::BlockForStop(
   return KeepGoing::Continue;
 }
 
+void LiveThreaded::RecordWireLatency(Impl* impl, const Record& rec) {
+  // How many records share one reading of the coarse receive clock
+  constexpr std::uint32_t kWireClockInterval = 32;
+  if (impl->records_since_clock_refresh == 0) {
+    impl->wire_clock_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count();
+  }
+  impl->records_since_clock_refresh =
+      (impl->records_since_clock_refresh + 1) % kWireClockInterval;
+  // The gateway appends ts_out as the trailing 8 bytes of each record
+  UnixNanos ts_out;
+  std::memcpy(&ts_out,
+              reinterpret_cast<const char*>(&rec.Header()) + rec.Size() -
+                  sizeof(UnixNanos),
+              sizeof(UnixNanos));
+  const auto latency =
+      impl->wire_clock_ns -
+      static_cast<std::int64_t>(ts_out.time_since_epoch().count());
+  // Clamped at zero: the coarse clock can lag ts_out by up to the refresh
+  // interval
+  impl->wire_latency_hist.Record(
+      latency > 0 ? static_cast<std::uint64_t>(latency) : 0);
+}
+
+bool LiveThreaded::FastForward(Impl* impl, const Record& rec) {
+  if (!impl->ff_active && impl->blocking.BufferedBytes() <
+                              impl->ff_conf.backlog_threshold_bytes) {
+    return false;
+  }
+  // Header-only staleness check: no payload decode, no callback
+  const auto ts_event = rec.Header().ts_event.time_since_epoch();
+  if (ts_event.count() != 0 &&
+      static_cast<std::uint64_t>(ts_event.count()) != kUndefTimestamp) {
+    const auto age = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch() - ts_event);
+    if (age > impl->ff_conf.staleness_bound) {
+      // The first skipped record opens the episode
+      impl->ff_active = true;
+      ++impl->ff_episode_records;
+      impl->ff_episode_bytes += rec.Size();
+      impl->ff_skip_count.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  // A fresh (or unstamped) record ends the episode
+  EndFastForward(impl);
+  return false;
+}
+
+void LiveThreaded::EndFastForward(Impl* impl) {
+  if (!impl->ff_active) {
+    return;
+  }
+  impl->ff_active = false;
+  std::ostringstream log_ss;
+  log_ss << "[LiveThreaded::ProcessingThread] Fast-forwarded through "
+         << impl->ff_episode_records << " stale records ("
+         << impl->ff_episode_bytes << " bytes) to catch up";
+  impl->log_receiver->Receive(LogLevel::Info, log_ss.str());
+  if (impl->ff_conf.report_hook) {
+    impl->ff_conf.report_hook(impl->ff_episode_records,
+                              impl->ff_episode_bytes);
+  }
+  impl->ff_episode_records = 0;
+  impl->ff_episode_bytes = 0;
+}
+
+bool LiveThreaded::GapBackfillDedupe(Impl* impl, const Record& rec) {
+  // System and error records are stamped with the current time and are never
+  // part of the replayed overlap
+  const auto rtype = rec.Header().rtype;
+  if (rtype == RType::System || rtype == RType::Error) {
+    return false;
+  }
+  const auto ts_event = static_cast<std::uint64_t>(
+      rec.Header().ts_event.time_since_epoch().count());
+  if (ts_event == 0 || ts_event == kUndefTimestamp) {
+    return false;
+  }
+  const auto cutoff = impl->backfill_cutoff.load(std::memory_order_relaxed);
+  if (cutoff != 0) {
+    if (ts_event <= cutoff) {
+      ++impl->backfill_episode_deduped;
+      impl->backfill_dedupe_count.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+    // The replay has passed the resume point: the stream is whole again
+    EndGapBackfill(impl);
+  }
+  impl->last_ts_event.store(ts_event, std::memory_order_relaxed);
+  return false;
+}
+
+void LiveThreaded::EndGapBackfill(Impl* impl) {
+  impl->backfill_cutoff.store(0, std::memory_order_relaxed);
+  std::ostringstream log_ss;
+  log_ss << "[LiveThreaded::ProcessingThread] Backfill complete after "
+            "dropping "
+         << impl->backfill_episode_deduped
+         << " duplicate records from the replay overlap";
+  impl->log_receiver->Receive(LogLevel::Info, log_ss.str());
+  if (impl->backfill_conf.report_hook) {
+    impl->backfill_conf.report_hook(impl->backfill_episode_deduped);
+  }
+  impl->backfill_episode_deduped = 0;
+}
+
+void LiveThreaded::ApplyNumaPlacement(Impl* impl) {
+#ifdef __linux__
+  const int node = impl->thread_conf.numa_node;
+  if (node < 0 ||
+      static_cast<std::size_t>(node) >= sizeof(unsigned long) * 8) {
+    return;
+  }
+  // Impl embeds the blocking client along with its receive and compat
+  // buffers, which were first touched on whichever thread constructed the
+  // session
+  if (!MigrateToNode(impl, sizeof(Impl), node)) {
+    WarnThreadConf(impl->log_receiver, "migrate session state to NUMA node",
+                   errno);
+  }
+#else
+  static_cast<void>(impl);
+#endif
+}
+
 void LiveThreaded::ProcessingThread(Impl* impl,
                                     MetadataCallback&& metadata_callback,
                                     RecordCallback&& record_callback,
@@ -161,6 +776,8 @@ void LiveThreaded::ProcessingThread(Impl* impl,
   static constexpr auto kMethodName = "LiveThreaded::ProcessingThread";
   constexpr std::chrono::milliseconds kTimeout{50};
 
+  ApplyThreadConf(impl->log_receiver, impl->thread_conf);
+  ApplyNumaPlacement(impl);
   const auto metadata_cb{std::move(metadata_callback)};
   const auto record_cb{std::move(record_callback)};
   const auto exception_cb{std::move(exception_callback)};
@@ -181,15 +798,186 @@ void LiveThreaded::ProcessingThread(Impl* impl,
       }
     }
     // NextRecord loop
+    // Whether the stale hook has fired for the current stale episode
+    bool stale_notified = false;
     while (impl->keep_going.load(std::memory_order_relaxed)) {
       try {
         const Record* rec = impl->blocking.NextRecord(kTimeout);
+        if (impl->wire_latency_watch) {
+          if (rec) {
+            RecordWireLatency(impl, *rec);
+          } else {
+            // Refresh on idle so the first record after a lull doesn't see
+            // a stale clock
+            impl->records_since_clock_refresh = 0;
+          }
+        }
+        if (impl->stale_watch) {
+          if (impl->blocking.IsSessionStale(impl->stale_conf.threshold)) {
+            if (!stale_notified) {
+              stale_notified = true;
+              impl->stale_conf.stale_hook();
+            }
+          } else {
+            stale_notified = false;
+          }
+        }
         if (rec) {
-          if (record_cb(*rec) == KeepGoing::Stop) {
+          if (impl->gap_backfill && GapBackfillDedupe(impl, *rec)) {
+            continue;
+          }
+          if (impl->fast_forward && FastForward(impl, *rec)) {
+            continue;
+          }
+          KeepGoing cb_ret;
+          DATABENTO_TRACEPOINT1(
+              callback_entry, static_cast<std::uint8_t>(rec->Header().rtype));
+          if (impl->latency_watch) {
+            const auto cb_start = std::chrono::steady_clock::now();
+            cb_ret = record_cb(*rec);
+            const auto elapsed =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - cb_start);
+            impl->latency_hist.Record(
+                static_cast<std::uint64_t>(elapsed.count()));
+            if (impl->latency_conf.slow_hook &&
+                impl->latency_conf.slow_threshold.count() > 0 &&
+                elapsed >= impl->latency_conf.slow_threshold) {
+              impl->latency_conf.slow_hook(elapsed);
+            }
+          } else {
+            cb_ret = record_cb(*rec);
+          }
+          DATABENTO_TRACEPOINT(callback_exit);
+          if (cb_ret == KeepGoing::Stop) {
             impl->blocking.Stop();
             impl->NotifyOfStop();
             return;
           }
+        } else {  // timeout
+          // An idle read means the backlog is gone: close out any episode
+          // rather than waiting for a fresh record to end it
+          EndFastForward(impl);
+        }
+      } catch (const std::exception& exc) {
+        if (ExceptionHandler(impl, exception_cb, exc, kMethodName,
+                             "Caught exception reading next record: ") ==
+            ExceptionAction::Restart) {
+          break;  // break out of NextRecord loop, to restart Start loop
+        } else {
+          impl->NotifyOfStop();
+          return;
+        }
+      }
+    }
+  }
+}
+
+void LiveThreaded::BatchProcessingThread(
+    Impl* impl, MetadataCallback&& metadata_callback,
+    BatchRecordCallback&& batch_callback,
+    ExceptionCallback&& exception_callback) {
+  // Thread safety: non-const calls to `blocking` are only performed from this
+  // thread
+
+  static constexpr auto kMethodName = "LiveThreaded::BatchProcessingThread";
+  constexpr std::chrono::milliseconds kTimeout{50};
+
+  ApplyThreadConf(impl->log_receiver, impl->thread_conf);
+  ApplyNumaPlacement(impl);
+  const auto metadata_cb{std::move(metadata_callback)};
+  const auto batch_cb{std::move(batch_callback)};
+  const auto exception_cb{std::move(exception_callback)};
+  // Start loop
+  while (impl->keep_going.load(std::memory_order_relaxed)) {
+    try {
+      auto metadata = impl->blocking.Start();
+      if (metadata_cb) {
+        metadata_cb(std::move(metadata));
+      }
+    } catch (const std::exception& exc) {
+      if (ExceptionHandler(impl, exception_cb, exc, kMethodName,
+                           "Caught exception starting session: ") ==
+          ExceptionAction::Restart) {
+        continue;  // restart Start loop
+      } else {
+        return;
+      }
+    }
+    // NextRecordBatch loop
+    while (impl->keep_going.load(std::memory_order_relaxed)) {
+      try {
+        const auto& batch = impl->blocking.NextRecordBatch(kTimeout);
+        if (!batch.empty()) {
+          if (batch_cb(batch) == KeepGoing::Stop) {
+            impl->blocking.Stop();
+            impl->NotifyOfStop();
+            return;
+          }
+        }  // else timeout
+      } catch (const std::exception& exc) {
+        if (ExceptionHandler(impl, exception_cb, exc, kMethodName,
+                             "Caught exception reading next record batch: ") ==
+            ExceptionAction::Restart) {
+          break;  // break out of NextRecordBatch loop, to restart Start loop
+        } else {
+          impl->NotifyOfStop();
+          return;
+        }
+      }
+    }
+  }
+}
+
+void LiveThreaded::QueuedProcessingThread(
+    Impl* impl, MetadataCallback&& metadata_callback,
+    ExceptionCallback&& exception_callback,
+    QueueOverflowPolicy overflow_policy) {
+  // Thread safety: non-const calls to `blocking` are only performed from this
+  // thread
+
+  static constexpr auto kMethodName = "LiveThreaded::QueuedProcessingThread";
+  constexpr std::chrono::milliseconds kTimeout{50};
+
+  ApplyThreadConf(impl->log_receiver, impl->thread_conf);
+  ApplyNumaPlacement(impl);
+  const auto metadata_cb{std::move(metadata_callback)};
+  const auto exception_cb{std::move(exception_callback)};
+  // Start loop
+  while (impl->keep_going.load(std::memory_order_relaxed)) {
+    try {
+      auto metadata = impl->blocking.Start();
+      if (metadata_cb) {
+        metadata_cb(std::move(metadata));
+      }
+    } catch (const std::exception& exc) {
+      if (ExceptionHandler(impl, exception_cb, exc, kMethodName,
+                           "Caught exception starting session: ") ==
+          ExceptionAction::Restart) {
+        continue;  // restart Start loop
+      } else {
+        impl->producer_done.store(true, std::memory_order_release);
+        return;
+      }
+    }
+    // NextRecord loop
+    while (impl->keep_going.load(std::memory_order_relaxed)) {
+      try {
+        const Record* rec = impl->blocking.NextRecord(kTimeout);
+        if (rec && !impl->queue->TryPush(*rec)) {
+          if (overflow_policy == QueueOverflowPolicy::Drop) {
+            impl->queue_drop_count.fetch_add(1, std::memory_order_relaxed);
+          } else {
+            // Block: wait for the consumer to free a slot, leaving further
+            // records to back up in the kernel receive buffer
+            do {
+              if (!impl->keep_going.load(std::memory_order_relaxed)) {
+                impl->producer_done.store(true, std::memory_order_release);
+                return;
+              }
+              std::this_thread::yield();
+            } while (!impl->queue->TryPush(*rec));
+          }
         }  // else timeout
       } catch (const std::exception& exc) {
         if (ExceptionHandler(impl, exception_cb, exc, kMethodName,
@@ -197,12 +985,50 @@ void LiveThreaded::ProcessingThread(Impl* impl,
             ExceptionAction::Restart) {
           break;  // break out of NextRecord loop, to restart Start loop
         } else {
+          impl->producer_done.store(true, std::memory_order_release);
           impl->NotifyOfStop();
           return;
         }
       }
     }
   }
+  if (impl->stop_requested.load(std::memory_order_relaxed)) {
+    impl->blocking.Stop();
+  }
+  impl->producer_done.store(true, std::memory_order_release);
+}
+
+void LiveThreaded::QueueConsumerThread(Impl* impl,
+                                       RecordCallback&& record_callback) {
+  constexpr std::chrono::microseconds kIdleSleep{50};
+
+  // The consumer isn't pinned to `thread_conf.cpu`, but belongs on the same
+  // node as the queue it drains
+  ApplyNumaConf(impl->log_receiver, impl->thread_conf.numa_node, true);
+  const auto record_cb{std::move(record_callback)};
+  while (impl->keep_going.load(std::memory_order_relaxed)) {
+    const Record* rec = impl->queue->TryPop();
+    if (rec) {
+      if (record_cb(*rec) == KeepGoing::Stop) {
+        impl->stop_requested.store(true, std::memory_order_relaxed);
+        impl->keep_going.store(false, std::memory_order_relaxed);
+        impl->NotifyOfStop();
+        return;
+      }
+    } else if (impl->producer_done.load(std::memory_order_acquire)) {
+      // Drain anything pushed between the failed pop and the producer
+      // finishing
+      while ((rec = impl->queue->TryPop()) != nullptr) {
+        if (record_cb(*rec) == KeepGoing::Stop) {
+          break;
+        }
+      }
+      impl->NotifyOfStop();
+      return;
+    } else {
+      std::this_thread::sleep_for(kIdleSleep);
+    }
+  }
 }
 
 LiveThreaded::ExceptionAction LiveThreaded::ExceptionHandler(
@@ -1,7 +1,12 @@
 #include "databento/log.hpp"
 
+#include <algorithm>  // min
+#include <chrono>     // milliseconds
+#include <cstring>  // memcpy
 #include <iostream>
 #include <memory>
+#include <sstream>
+#include <thread>  // this_thread
 
 databento::ILogReceiver* databento::ILogReceiver::Default() {
   static const std::unique_ptr<ILogReceiver> gDefaultLogger{
@@ -25,3 +30,110 @@ void ConsoleLogReceiver::Receive(LogLevel level, const std::string& msg) {
     stream_ << msg << '\n';
   }
 }
+
+using databento::AsyncLogReceiver;
+
+namespace {
+constexpr std::size_t kDefaultAsyncCapacity = 1024;
+// How long the writer thread sleeps when the ring is empty
+constexpr std::chrono::milliseconds kIdleSleep{1};
+
+std::size_t NextPowerOfTwo(std::size_t capacity) {
+  std::size_t res = 1;
+  while (res < capacity) {
+    res <<= 1;
+  }
+  return res;
+}
+}  // namespace
+
+// definition required for ODR-use in C++11
+constexpr std::size_t AsyncLogReceiver::kMaxMsgLen;
+
+AsyncLogReceiver::AsyncLogReceiver(ILogReceiver* downstream)
+    : AsyncLogReceiver{downstream, kDefaultAsyncCapacity} {}
+
+AsyncLogReceiver::AsyncLogReceiver(ILogReceiver* downstream,
+                                   std::size_t capacity)
+    : downstream_{downstream},
+      mask_{NextPowerOfTwo(capacity) - 1},
+      slots_(mask_ + 1) {
+  for (std::size_t i = 0; i < slots_.size(); ++i) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  writer_thread_ = detail::ScopedThread{&AsyncLogReceiver::WriteLoop, this};
+}
+
+AsyncLogReceiver::~AsyncLogReceiver() {
+  keep_running_.store(false, std::memory_order_release);
+  writer_thread_.Join();
+}
+
+void AsyncLogReceiver::Receive(LogLevel level, const std::string& msg) {
+  if (!downstream_->ShouldLog(level)) {
+    return;
+  }
+  auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Entry* slot;
+  while (true) {
+    slot = &slots_[pos & mask_];
+    const auto seq = slot->sequence.load(std::memory_order_acquire);
+    const auto dif = static_cast<std::intptr_t>(seq) -
+                     static_cast<std::intptr_t>(pos);
+    if (dif == 0) {
+      // The slot is free: race other producers to claim it
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (dif < 0) {
+      // The slot is a full lap behind: the ring is full
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    } else {
+      // Another producer claimed the slot: reload and retry
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  const auto length = std::min(msg.size(), kMaxMsgLen);
+  std::memcpy(slot->msg.data(), msg.data(), length);
+  slot->level = level;
+  slot->length = static_cast<std::uint8_t>(length);
+  // Publish the entry to the writer thread
+  slot->sequence.store(pos + 1, std::memory_order_release);
+}
+
+bool AsyncLogReceiver::ShouldLog(LogLevel level) const {
+  return downstream_->ShouldLog(level);
+}
+
+void AsyncLogReceiver::WriteLoop() {
+  while (true) {
+    Entry& slot = slots_[dequeue_pos_ & mask_];
+    const auto seq = slot.sequence.load(std::memory_order_acquire);
+    if (seq == dequeue_pos_ + 1) {
+      downstream_->Receive(slot.level,
+                           std::string{slot.msg.data(), slot.length});
+      // Mark the slot free for the next lap
+      slot.sequence.store(dequeue_pos_ + mask_ + 1,
+                          std::memory_order_release);
+      ++dequeue_pos_;
+      continue;
+    }
+    // The ring is drained: report any new drops, then stop or sleep
+    const auto dropped = dropped_count_.load(std::memory_order_relaxed);
+    if (dropped > reported_dropped_) {
+      std::ostringstream log_ss;
+      log_ss << "[AsyncLogReceiver::WriteLoop] Dropped "
+             << dropped - reported_dropped_
+             << " messages because the ring was full";
+      downstream_->Receive(LogLevel::Warning, log_ss.str());
+      reported_dropped_ = dropped;
+      continue;
+    }
+    if (!keep_running_.load(std::memory_order_acquire)) {
+      return;
+    }
+    std::this_thread::sleep_for(kIdleSleep);
+  }
+}
@@ -0,0 +1,211 @@
+#include "databento/multi_file_replay.hpp"
+
+#include <algorithm>  // min, pop_heap, push_heap
+#include <cstdint>
+#include <deque>
+#include <exception>  // exception_ptr
+#include <thread>     // hardware_concurrency
+#include <utility>    // move
+
+#include "databento/dbn_decoder.hpp"
+#include "databento/detail/file_stream.hpp"
+#include "databento/detail/scoped_thread.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/ireadable.hpp"
+#include "databento/record.hpp"
+
+using databento::MultiFileReplay;
+
+namespace {
+// Bounds the decoded chunks buffered per file before its producer blocks
+constexpr std::size_t kMaxQueuedChunks = 4;
+}  // namespace
+
+// One replayed file: a decoder fed by the thread pool and a bounded queue of
+// chunks of contiguous decoded records consumed by the merging thread. Queue
+// state is guarded by the engine mutex; `chunk` and `chunk_idx` are only
+// touched by the merging thread.
+struct MultiFileReplay::Source {
+  Source(const std::string& file_path, VersionUpgradePolicy upgrade_policy,
+         std::size_t index)
+      : decoder{std::unique_ptr<IReadable>{new detail::FileStream{file_path}},
+                upgrade_policy},
+        index{index} {}
+
+  DbnDecoder decoder;
+  const std::size_t index;
+  std::deque<std::vector<std::uint8_t>> chunks;
+  std::exception_ptr error;
+  bool claimed{false};
+  bool finished{false};
+  // Merging thread state
+  std::vector<std::uint8_t> chunk;
+  std::size_t chunk_idx{};
+  Record current_record{nullptr};
+};
+
+MultiFileReplay::MultiFileReplay(std::vector<std::string> file_paths)
+    : MultiFileReplay{std::move(file_paths), VersionUpgradePolicy::Upgrade,
+                      std::thread::hardware_concurrency()} {}
+
+MultiFileReplay::MultiFileReplay(std::vector<std::string> file_paths,
+                                 VersionUpgradePolicy upgrade_policy,
+                                 std::size_t thread_count)
+    : file_paths_{std::move(file_paths)},
+      upgrade_policy_{upgrade_policy},
+      thread_count_{std::max<std::size_t>(thread_count, 1)} {
+  if (file_paths_.empty()) {
+    throw InvalidArgumentError{"MultiFileReplay", "file_paths",
+                               "At least one file path is required"};
+  }
+}
+
+MultiFileReplay::~MultiFileReplay() = default;
+
+void MultiFileReplay::Replay(const MetadataCallback& metadata_callback,
+                             const RecordCallback& record_callback) {
+  sources_.clear();
+  shutdown_ = false;
+  for (const auto& file_path : file_paths_) {
+    sources_.emplace_back(
+        new Source{file_path, upgrade_policy_, sources_.size()});
+    auto metadata = sources_.back()->decoder.DecodeMetadata();
+    if (metadata_callback) {
+      metadata_callback(std::move(metadata));
+    }
+  }
+  std::vector<detail::ScopedThread> threads;
+  // Destroyed before the threads are joined, so a stopped or throwing replay
+  // can't deadlock producers blocked on full queues
+  struct ShutdownGuard {
+    ~ShutdownGuard() {
+      const std::lock_guard<std::mutex> lock{self->mutex_};
+      self->shutdown_ = true;
+      self->producer_cv_.notify_all();
+    }
+    MultiFileReplay* self;
+  } guard{this};
+  const auto num_threads = std::min(thread_count_, sources_.size());
+  threads.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back([this] { ProcessSources(); });
+  }
+  // k-way merge on ts_event with a min-heap. Ties broken by file order to
+  // keep the merge stable.
+  std::vector<Source*> heap;
+  heap.reserve(sources_.size());
+  const auto later = [](const Source* lhs, const Source* rhs) {
+    const auto lhs_ts = lhs->current_record.Header().ts_event;
+    const auto rhs_ts = rhs->current_record.Header().ts_event;
+    if (lhs_ts != rhs_ts) {
+      return lhs_ts > rhs_ts;
+    }
+    return lhs->index > rhs->index;
+  };
+  for (auto& source : sources_) {
+    if (AdvanceSource(source.get())) {
+      heap.emplace_back(source.get());
+    }
+  }
+  std::make_heap(heap.begin(), heap.end(), later);
+  while (!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), later);
+    Source* source = heap.back();
+    heap.pop_back();
+    if (record_callback(source->current_record) == KeepGoing::Stop) {
+      return;
+    }
+    if (AdvanceSource(source)) {
+      heap.emplace_back(source);
+      std::push_heap(heap.begin(), heap.end(), later);
+    }
+  }
+}
+
+void MultiFileReplay::Replay(const RecordCallback& record_callback) {
+  Replay({}, record_callback);
+}
+
+// Thread pool loop: repeatedly claims a source with queue space, decodes one
+// batch outside the lock, and queues it.
+void MultiFileReplay::ProcessSources() {
+  std::unique_lock<std::mutex> lock{mutex_};
+  while (!shutdown_) {
+    Source* source = nullptr;
+    bool all_finished = true;
+    for (auto& candidate : sources_) {
+      if (candidate->finished) {
+        continue;
+      }
+      all_finished = false;
+      if (!candidate->claimed && candidate->chunks.size() < kMaxQueuedChunks) {
+        source = candidate.get();
+        break;
+      }
+    }
+    if (all_finished) {
+      return;
+    }
+    if (source == nullptr) {
+      producer_cv_.wait(lock);
+      continue;
+    }
+    source->claimed = true;
+    lock.unlock();
+    std::vector<std::uint8_t> chunk;
+    std::exception_ptr error;
+    try {
+      chunk = DecodeChunk(source);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    lock.lock();
+    source->claimed = false;
+    if (error) {
+      source->error = error;
+      source->finished = true;
+    } else if (chunk.empty()) {
+      source->finished = true;
+    } else {
+      source->chunks.emplace_back(std::move(chunk));
+    }
+    consumer_cv_.notify_all();
+    // Wake any producers waiting on this source now that it's released
+    producer_cv_.notify_all();
+  }
+}
+
+std::vector<std::uint8_t> MultiFileReplay::DecodeChunk(Source* source) {
+  std::vector<std::uint8_t> chunk;
+  const auto& batch = source->decoder.DecodeRecords();
+  for (const auto& record : batch) {
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(&record.Header());
+    chunk.insert(chunk.end(), bytes, bytes + record.Size());
+  }
+  return chunk;
+}
+
+// Sets the source's current record to the next decoded record, blocking on
+// the producers if necessary. Returns false once the source is exhausted.
+bool MultiFileReplay::AdvanceSource(Source* source) {
+  if (source->chunk_idx >= source->chunk.size()) {
+    std::unique_lock<std::mutex> lock{mutex_};
+    consumer_cv_.wait(lock, [source] {
+      return !source->chunks.empty() || source->finished;
+    });
+    if (source->error) {
+      std::rethrow_exception(source->error);
+    }
+    if (source->chunks.empty()) {
+      return false;
+    }
+    source->chunk = std::move(source->chunks.front());
+    source->chunks.pop_front();
+    source->chunk_idx = 0;
+    producer_cv_.notify_all();
+  }
+  source->current_record =
+      Record{reinterpret_cast<RecordHeader*>(&source->chunk[source->chunk_idx])};
+  source->chunk_idx += source->current_record.Size();
+  return true;
+}
@@ -0,0 +1,217 @@
+#include "databento/order_book.hpp"
+
+#include <algorithm>  // lower_bound
+
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+
+using databento::OrderBook;
+
+namespace {
+constexpr databento::PriceLevel kEmptyLevel{databento::kUndefPrice, 0, 0};
+
+// Finds the first level at or past `price` in a side's level array. The
+// comparison flips per side so both arrays keep the best price at the back.
+std::vector<databento::PriceLevel>::iterator LevelBound(
+    std::vector<databento::PriceLevel>& levels, databento::Side side,
+    std::int64_t price) {
+  if (side == databento::Side::Bid) {
+    return std::lower_bound(levels.begin(), levels.end(), price,
+                            [](const databento::PriceLevel& level,
+                               std::int64_t target) {
+                              return level.price < target;
+                            });
+  }
+  return std::lower_bound(levels.begin(), levels.end(), price,
+                          [](const databento::PriceLevel& level,
+                             std::int64_t target) {
+                            return level.price > target;
+                          });
+}
+}  // namespace
+
+void OrderBook::Apply(const MboMsg& mbo) {
+  switch (mbo.action) {
+    case Action::Add: {
+      Add(mbo);
+      break;
+    }
+    case Action::Cancel: {
+      Cancel(mbo);
+      break;
+    }
+    case Action::Modify: {
+      Modify(mbo);
+      break;
+    }
+    case Action::Fill: {
+      Fill(mbo);
+      break;
+    }
+    case Action::Trade: {
+      // Book state changes arrive as separate Fill and Cancel records
+      break;
+    }
+    case Action::Clear: {
+      Clear();
+      break;
+    }
+    default: {
+      throw InvalidArgumentError{
+          "OrderBook::Apply", "mbo",
+          std::string{"Unknown action '"} +
+              static_cast<char>(mbo.action) + "'"};
+    }
+  }
+}
+
+void OrderBook::Clear() {
+  bids_.clear();
+  asks_.clear();
+  order_pool_.clear();
+  free_list_.clear();
+  order_lookup_.clear();
+}
+
+const databento::PriceLevel& OrderBook::BidLevel(std::size_t depth) const {
+  if (depth >= bids_.size()) {
+    return kEmptyLevel;
+  }
+  return bids_[bids_.size() - 1 - depth];
+}
+
+const databento::PriceLevel& OrderBook::AskLevel(std::size_t depth) const {
+  if (depth >= asks_.size()) {
+    return kEmptyLevel;
+  }
+  return asks_[asks_.size() - 1 - depth];
+}
+
+const databento::BookOrder* OrderBook::GetOrder(
+    std::uint64_t order_id) const {
+  const auto order_it = order_lookup_.find(order_id);
+  if (order_it == order_lookup_.end()) {
+    return nullptr;
+  }
+  return &order_pool_[order_it->second];
+}
+
+void OrderBook::Add(const MboMsg& mbo) {
+  if (mbo.side == Side::None) {
+    return;
+  }
+  const auto index = AllocOrder();
+  const auto res = order_lookup_.emplace(mbo.order_id, index);
+  if (!res.second) {
+    FreeOrder(index);
+    throw InvalidArgumentError{"OrderBook::Apply", "mbo",
+                               "Add for duplicate order ID"};
+  }
+  order_pool_[index] = BookOrder{mbo.order_id, mbo.price, mbo.size, mbo.side};
+  AddToLevel(mbo.side, mbo.price, mbo.size);
+}
+
+void OrderBook::Cancel(const MboMsg& mbo) {
+  const auto order_it = order_lookup_.find(mbo.order_id);
+  if (order_it == order_lookup_.end()) {
+    throw InvalidArgumentError{"OrderBook::Apply", "mbo",
+                               "Cancel for unknown order ID"};
+  }
+  Reduce(order_it, mbo.size, "Cancel");
+}
+
+void OrderBook::Modify(const MboMsg& mbo) {
+  const auto order_it = order_lookup_.find(mbo.order_id);
+  if (order_it == order_lookup_.end()) {
+    // A modify of an order that's no longer resting acts as an add
+    Add(mbo);
+    return;
+  }
+  BookOrder& order = order_pool_[order_it->second];
+  RemoveFromLevel(order.side, order.price, order.size, true, "Modify");
+  order.price = mbo.price;
+  order.size = mbo.size;
+  AddToLevel(order.side, order.price, order.size);
+}
+
+void OrderBook::Fill(const MboMsg& mbo) {
+  const auto order_it = order_lookup_.find(mbo.order_id);
+  if (order_it == order_lookup_.end()) {
+    throw InvalidArgumentError{"OrderBook::Apply", "mbo",
+                               "Fill for unknown order ID"};
+  }
+  Reduce(order_it, mbo.size, "Fill");
+}
+
+void OrderBook::Reduce(
+    std::unordered_map<std::uint64_t, std::uint32_t>::iterator order_it,
+    std::uint32_t size, const char* method_name) {
+  BookOrder& order = order_pool_[order_it->second];
+  if (size > order.size) {
+    throw InvalidArgumentError{
+        "OrderBook::Apply", "mbo",
+        std::string{method_name} + " for more than the order's size"};
+  }
+  order.size -= size;
+  RemoveFromLevel(order.side, order.price, size, order.size == 0,
+                  method_name);
+  if (order.size == 0) {
+    FreeOrder(order_it->second);
+    order_lookup_.erase(order_it);
+  }
+}
+
+void OrderBook::AddToLevel(Side side, std::int64_t price,
+                           std::uint32_t size) {
+  auto& levels = SideLevels(side);
+  const auto level_it = LevelBound(levels, side, price);
+  if (level_it != levels.end() && level_it->price == price) {
+    level_it->size += size;
+    ++level_it->count;
+    return;
+  }
+  levels.insert(level_it, PriceLevel{price, size, 1});
+}
+
+void OrderBook::RemoveFromLevel(Side side, std::int64_t price,
+                                std::uint32_t size, bool order_removed,
+                                const char* method_name) {
+  auto& levels = SideLevels(side);
+  const auto level_it = LevelBound(levels, side, price);
+  if (level_it == levels.end() || level_it->price != price) {
+    throw InvalidArgumentError{
+        "OrderBook::Apply", "mbo",
+        std::string{method_name} + " for a price with no level"};
+  }
+  level_it->size -= size;
+  if (order_removed) {
+    --level_it->count;
+    if (level_it->count == 0) {
+      levels.erase(level_it);
+    }
+  }
+}
+
+databento::BidAskPair OrderBook::LevelPair(std::size_t depth) const {
+  const PriceLevel& bid = BidLevel(depth);
+  const PriceLevel& ask = AskLevel(depth);
+  return BidAskPair{bid.price,
+                    ask.price,
+                    static_cast<std::uint32_t>(bid.size),
+                    static_cast<std::uint32_t>(ask.size),
+                    bid.count,
+                    ask.count};
+}
+
+std::uint32_t OrderBook::AllocOrder() {
+  if (!free_list_.empty()) {
+    const auto index = free_list_.back();
+    free_list_.pop_back();
+    return index;
+  }
+  order_pool_.emplace_back();
+  return static_cast<std::uint32_t>(order_pool_.size() - 1);
+}
+
+void OrderBook::FreeOrder(std::uint32_t index) {
+  free_list_.emplace_back(index);
+}
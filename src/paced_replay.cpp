@@ -0,0 +1,81 @@
+#include "databento/paced_replay.hpp"
+
+#include <chrono>   // nanoseconds, steady_clock
+#include <cstdint>  // int64_t
+#include <thread>   // this_thread
+#include <utility>  // move
+
+#include "databento/constants.hpp"      // kUndefTimestamp
+#include "databento/datetime.hpp"       // UnixNanos
+#include "databento/dbn_file_store.hpp"
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+#include "databento/record.hpp"      // Record
+
+using databento::PacedReplay;
+
+namespace {
+// Sleeps until within `spin_threshold` of `target`, then busy-spins the
+// remainder for sub-sleep-quantum precision
+void WaitUntil(std::chrono::steady_clock::time_point target,
+               std::chrono::microseconds spin_threshold) {
+  const auto sleep_until = target - spin_threshold;
+  if (std::chrono::steady_clock::now() < sleep_until) {
+    std::this_thread::sleep_until(sleep_until);
+  }
+  while (std::chrono::steady_clock::now() < target) {
+  }
+}
+}  // namespace
+
+PacedReplay::PacedReplay(std::string file_path)
+    : PacedReplay{std::move(file_path), Conf{}} {}
+
+PacedReplay::PacedReplay(std::string file_path, Conf conf)
+    : PacedReplay{std::move(file_path), VersionUpgradePolicy::Upgrade, conf} {}
+
+PacedReplay::PacedReplay(std::string file_path,
+                         VersionUpgradePolicy upgrade_policy, Conf conf)
+    : file_path_{std::move(file_path)},
+      upgrade_policy_{upgrade_policy},
+      conf_{conf} {
+  if (conf_.speed <= 0) {
+    throw InvalidArgumentError{"PacedReplay::PacedReplay", "conf.speed",
+                               "must be positive"};
+  }
+}
+
+void PacedReplay::Replay(const MetadataCallback& metadata_callback,
+                         const RecordCallback& record_callback) {
+  DbnFileStore store{file_path_, upgrade_policy_};
+  std::chrono::steady_clock::time_point start_time{};
+  UnixNanos first_ts{};
+  bool anchored = false;
+  store.Replay(metadata_callback, [this, &start_time, &first_ts, &anchored,
+                                   &record_callback](const Record& record) {
+    const auto ts_event = record.Header().ts_event;
+    if (ts_event.time_since_epoch().count() == kUndefTimestamp) {
+      return record_callback(record);
+    }
+    if (!anchored) {
+      // The first timed record anchors the schedule: every later record is
+      // due at its ts_event delta from here, scaled by the speed multiplier
+      anchored = true;
+      first_ts = ts_event;
+      start_time = std::chrono::steady_clock::now();
+      return record_callback(record);
+    }
+    if (ts_event > first_ts) {
+      const auto sim_elapsed =
+          std::chrono::nanoseconds{ts_event - first_ts}.count();
+      const auto paced_elapsed = std::chrono::nanoseconds{
+          static_cast<std::int64_t>(static_cast<double>(sim_elapsed) /
+                                    conf_.speed)};
+      WaitUntil(start_time + paced_elapsed, conf_.spin_threshold);
+    }
+    return record_callback(record);
+  });
+}
+
+void PacedReplay::Replay(const RecordCallback& record_callback) {
+  Replay([](Metadata&&) {}, record_callback);
+}
@@ -0,0 +1,166 @@
+#include "databento/partitioned_replay.hpp"
+
+#include <algorithm>  // max, min
+#include <array>
+#include <atomic>
+#include <cstring>    // memcmp, memcpy
+#include <exception>  // exception_ptr
+#include <thread>     // hardware_concurrency
+#include <vector>
+
+#include "databento/dbn_decoder.hpp"
+#include "databento/detail/scoped_thread.hpp"
+#include "databento/exceptions.hpp"
+
+using databento::PartitionedReplay;
+
+namespace {
+constexpr std::uint32_t kZstdMagicNumber = 0xFD2FB528;
+// The number of consecutive plausible headers required to accept an offset
+// as a record boundary during resynchronization
+constexpr std::size_t kResyncChainLen = 3;
+
+const std::array<bool, 256>& KnownRTypes() {
+  static const std::array<bool, 256> known = [] {
+    std::array<bool, 256> res{};
+    for (const auto rtype :
+         {databento::RType::Mbp0, databento::RType::Mbp1,
+          databento::RType::Mbp10, databento::RType::OhlcvDeprecated,
+          databento::RType::Ohlcv1S, databento::RType::Ohlcv1M,
+          databento::RType::Ohlcv1H, databento::RType::Ohlcv1D,
+          databento::RType::InstrumentDef, databento::RType::Imbalance,
+          databento::RType::Error, databento::RType::SymbolMapping,
+          databento::RType::System, databento::RType::Statistics,
+          databento::RType::Mbo}) {
+      res[static_cast<std::uint8_t>(rtype)] = true;
+    }
+    return res;
+  }();
+  return known;
+}
+}  // namespace
+
+PartitionedReplay::PartitionedReplay(const std::string& file_path)
+    : PartitionedReplay{file_path, VersionUpgradePolicy::Upgrade,
+                        std::thread::hardware_concurrency()} {}
+
+PartitionedReplay::PartitionedReplay(const std::string& file_path,
+                                     VersionUpgradePolicy upgrade_policy,
+                                     std::size_t partition_count)
+    : file_{file_path},
+      upgrade_policy_{upgrade_policy},
+      partition_count_{std::max<std::size_t>(partition_count, 1)} {
+  if (file_.Size() >= sizeof(kZstdMagicNumber) &&
+      std::memcmp(file_.Data(), &kZstdMagicNumber,
+                  sizeof(kZstdMagicNumber)) == 0) {
+    throw InvalidArgumentError{
+        "PartitionedReplay", "file_path",
+        "Compressed DBN files can't be decoded in partitions"};
+  }
+  const auto version_and_size =
+      DbnDecoder::DecodeMetadataVersionAndSize(file_.Data(), file_.Size());
+  records_start_ = 8 + version_and_size.second;
+  if (records_start_ > file_.Size()) {
+    throw DbnResponseError{"Unexpected end of file within metadata"};
+  }
+  const std::vector<std::uint8_t> metadata_buffer{
+      file_.Data() + 8, file_.Data() + records_start_};
+  metadata_ =
+      DbnDecoder::DecodeMetadataFields(version_and_size.first,
+                                       metadata_buffer);
+  partition_count_ =
+      std::min(partition_count_,
+               std::max<std::size_t>(
+                   (file_.Size() - records_start_) / sizeof(RecordHeader), 1));
+}
+
+bool PartitionedReplay::IsRecordBoundary(std::size_t offset) const {
+  // Walk a chain of headers validating each one. A chain that reaches the
+  // end of the file exactly is also accepted.
+  for (std::size_t i = 0; i < kResyncChainLen; ++i) {
+    if (offset == file_.Size()) {
+      return true;
+    }
+    if (offset + sizeof(RecordHeader) > file_.Size()) {
+      return false;
+    }
+    RecordHeader header;
+    std::memcpy(&header, file_.Data() + offset, sizeof(header));
+    const auto size = header.Size();
+    if (size < sizeof(RecordHeader) || size > kMaxRecordLen ||
+        offset + size > file_.Size() ||
+        !KnownRTypes()[static_cast<std::uint8_t>(header.rtype)]) {
+      return false;
+    }
+    offset += size;
+  }
+  return true;
+}
+
+std::size_t PartitionedReplay::Resync(std::size_t offset) const {
+  // Record lengths are multiples of 4 bytes, so every record boundary is
+  // 4-aligned relative to the start of the record region
+  constexpr auto kAlign = RecordHeader::kLengthMultiplier;
+  auto pos = records_start_ +
+             (offset - records_start_ + kAlign - 1) / kAlign * kAlign;
+  for (; pos < file_.Size(); pos += kAlign) {
+    if (IsRecordBoundary(pos)) {
+      return pos;
+    }
+  }
+  return file_.Size();
+}
+
+void PartitionedReplay::Replay(const PartitionRecordCallback& callback) {
+  // Boundaries are a pure function of the cut offset, so adjacent partitions
+  // agree on where one ends and the next begins
+  std::vector<std::size_t> boundaries(partition_count_ + 1);
+  const auto region_size = file_.Size() - records_start_;
+  boundaries.front() = records_start_;
+  boundaries.back() = file_.Size();
+  for (std::size_t i = 1; i < partition_count_; ++i) {
+    boundaries[i] = Resync(records_start_ + i * (region_size / partition_count_));
+  }
+  std::atomic<bool> stopped{false};
+  std::vector<std::exception_ptr> errors(partition_count_);
+  {
+    std::vector<detail::ScopedThread> threads;
+    threads.reserve(partition_count_);
+    for (std::size_t partition = 0; partition < partition_count_;
+         ++partition) {
+      threads.emplace_back([this, partition, &boundaries, &callback, &stopped,
+                            &errors] {
+        alignas(RecordHeader) std::array<std::uint8_t, kMaxRecordLen>
+            compat_buffer{};
+        auto offset = boundaries[partition];
+        const auto end = boundaries[partition + 1];
+        try {
+          while (offset < end && !stopped.load(std::memory_order_relaxed)) {
+            auto* header = reinterpret_cast<RecordHeader*>(
+                const_cast<std::uint8_t*>(file_.Data() + offset));
+            if (offset + header->Size() > file_.Size()) {
+              throw DbnResponseError{
+                  "Unexpected end of file, partial record remaining"};
+            }
+            const auto record = DbnDecoder::DecodeRecordCompat(
+                metadata_.version, upgrade_policy_, metadata_.ts_out,
+                &compat_buffer, Record{header});
+            if (callback(partition, record) == KeepGoing::Stop) {
+              stopped.store(true, std::memory_order_relaxed);
+              return;
+            }
+            offset += header->Size();
+          }
+        } catch (const std::exception&) {
+          errors[partition] = std::current_exception();
+        }
+      });
+    }
+    // joins all threads
+  }
+  for (const auto& error : errors) {
+    if (error != nullptr) {
+      std::rethrow_exception(error);
+    }
+  }
+}
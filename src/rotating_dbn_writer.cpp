@@ -0,0 +1,172 @@
+#include "databento/rotating_dbn_writer.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>   // open
+#include <unistd.h>  // close, fsync
+#endif
+
+#include <cstdio>   // rename
+#include <cstring>  // strerror
+#include <fstream>
+#include <iomanip>  // setfill, setw
+#include <sstream>
+
+#include "databento/detail/file_write_stream.hpp"
+#include "databento/exceptions.hpp"
+
+using databento::RotatingDbnWriter;
+
+namespace {
+constexpr auto kInProgressSuffix = ".inprogress";
+// Byte offsets of the start and end timestamps within an encoded metadata
+// frame, identical for DBN versions 1 and 2: the 8-byte prefix, the
+// 16-byte dataset, and the 2-byte schema precede start
+constexpr std::size_t kMetadataStartOffset = 26;
+
+// FileWriteStream that counts the bytes written, for size-based rotation
+class CountingFileStream : public databento::IWritable {
+ public:
+  CountingFileStream(const std::string& file_path, std::size_t* counter)
+      : stream_{file_path}, counter_{counter} {}
+
+  void WriteAll(const std::uint8_t* buffer, std::size_t length) override {
+    stream_.WriteAll(buffer, length);
+    *counter_ += length;
+  }
+
+ private:
+  databento::detail::FileWriteStream stream_;
+  std::size_t* counter_;
+};
+
+void Fsync(const std::string& file_path) {
+#ifdef _WIN32
+  (void)file_path;
+#else
+  const int fd = ::open(file_path.c_str(), O_WRONLY);
+  if (fd < 0) {
+    throw databento::Exception{"Unable to open " + file_path +
+                               " for fsync: " + ::strerror(errno)};
+  }
+  const int ret = ::fsync(fd);
+  ::close(fd);
+  if (ret != 0) {
+    throw databento::Exception{"Unable to fsync " + file_path + ": " +
+                               ::strerror(errno)};
+  }
+#endif
+}
+
+// Patches the sealed file's metadata start and end timestamps to the
+// ts_event range of its records, then fsyncs and renames it to its final
+// name. Runs on the seal thread.
+void SealFile(const std::string& tmp_path, const std::string& final_path,
+              bool has_records, databento::UnixNanos first_ts,
+              databento::UnixNanos last_ts) {
+  if (has_records) {
+    std::fstream stream{tmp_path,
+                        std::ios::binary | std::ios::in | std::ios::out};
+    std::uint64_t timestamps[2] = {
+        static_cast<std::uint64_t>(first_ts.time_since_epoch().count()),
+        static_cast<std::uint64_t>(last_ts.time_since_epoch().count())};
+    stream.seekp(static_cast<std::streamoff>(kMetadataStartOffset));
+    stream.write(reinterpret_cast<const char*>(timestamps),
+                 sizeof(timestamps));
+    if (stream.fail()) {
+      throw databento::Exception{"Unable to finalize metadata in " +
+                                 tmp_path};
+    }
+  }
+  Fsync(tmp_path);
+  if (std::rename(tmp_path.c_str(), final_path.c_str()) != 0) {
+    throw databento::Exception{"Unable to rename " + tmp_path + " to " +
+                               final_path + ": " + ::strerror(errno)};
+  }
+}
+}  // namespace
+
+RotatingDbnWriter::RotatingDbnWriter(const std::string& output_dir,
+                                     const std::string& file_prefix,
+                                     const Metadata& metadata,
+                                     RotationPolicy policy)
+    : output_dir_{output_dir},
+      file_prefix_{file_prefix},
+      metadata_{metadata},
+      policy_{policy} {
+  if (policy_.max_file_size == 0 && policy_.max_file_duration.count() <= 0) {
+    throw InvalidArgumentError{"RotatingDbnWriter::RotatingDbnWriter",
+                               "policy",
+                               "At least one rotation limit is required"};
+  }
+  OpenNextFile();
+}
+
+RotatingDbnWriter::~RotatingDbnWriter() {
+  if (output_ == nullptr) {
+    return;
+  }
+  try {
+    Close();
+  } catch (const std::exception&) {
+    // Destructors can't throw; call Close to surface seal errors
+  }
+}
+
+void RotatingDbnWriter::WriteRecord(const Record& record) {
+  const bool over_size =
+      policy_.max_file_size > 0 && bytes_written_ >= policy_.max_file_size;
+  const bool over_age =
+      policy_.max_file_duration.count() > 0 &&
+      std::chrono::steady_clock::now() - opened_at_ >=
+          policy_.max_file_duration;
+  if (over_size || over_age) {
+    SealCurrentFile();
+    OpenNextFile();
+  }
+  encoder_->EncodeRecord(record);
+  if (file_record_count_ == 0) {
+    first_ts_event_ = record.Header().ts_event;
+  }
+  ++file_record_count_;
+  last_ts_event_ = record.Header().ts_event;
+}
+
+void RotatingDbnWriter::Close() {
+  SealCurrentFile();
+  for (auto& seal : pending_seals_) {
+    seal.get();
+  }
+  pending_seals_.clear();
+}
+
+void RotatingDbnWriter::OpenNextFile() {
+  std::ostringstream path;
+  path << output_dir_ << '/' << file_prefix_ << '-' << std::setfill('0')
+       << std::setw(6) << file_index_ << ".dbn";
+  ++file_index_;
+  current_path_ = path.str();
+  bytes_written_ = 0;
+  file_record_count_ = 0;
+  first_ts_event_ = UnixNanos{};
+  last_ts_event_ = UnixNanos{};
+  opened_at_ = std::chrono::steady_clock::now();
+  output_.reset(new CountingFileStream{current_path_ + kInProgressSuffix,
+                                       &bytes_written_});
+  encoder_.reset(new DbnEncoder{metadata_, output_.get()});
+}
+
+void RotatingDbnWriter::SealCurrentFile() {
+  // Flush and close before handing the file to the seal thread
+  encoder_.reset();
+  output_.reset();
+  const auto tmp_path = current_path_ + kInProgressSuffix;
+  const auto final_path = current_path_;
+  const bool has_records = file_record_count_ != 0;
+  const auto first_ts = first_ts_event_;
+  const auto last_ts = last_ts_event_;
+  pending_seals_.emplace_back(
+      seal_pool_.Submit([tmp_path, final_path, has_records, first_ts,
+                         last_ts]() {
+        ::SealFile(tmp_path, final_path, has_records, first_ts, last_ts);
+      }));
+}
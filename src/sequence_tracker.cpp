@@ -0,0 +1,29 @@
+#include "databento/sequence_tracker.hpp"
+
+#include "databento/flag_set.hpp"  // FlagSet
+
+using databento::SequenceTracker;
+
+void SequenceTracker::Track(const MboMsg& mbo) {
+  bad_book_count_.fetch_add((mbo.flags & FlagSet::kMaybeBadBook).Any(),
+                            std::memory_order_relaxed);
+  const auto res = last_sequence_.emplace(mbo.hd.instrument_id, mbo.sequence);
+  if (res.second) {
+    // First record for the instrument establishes the baseline
+    return;
+  }
+  auto& last = res.first->second;
+  const std::uint32_t expected = last + 1;
+  // One wrapping subtraction classifies both directions: ahead of expected
+  // is a gap, behind it is reordering
+  const auto delta = static_cast<std::int32_t>(mbo.sequence - expected);
+  const bool gap = delta > 0;
+  const bool out_of_order = delta < 0;
+  gap_count_.fetch_add(gap, std::memory_order_relaxed);
+  out_of_order_count_.fetch_add(out_of_order, std::memory_order_relaxed);
+  // Don't rewind the baseline on a reordered record
+  last = out_of_order ? last : mbo.sequence;
+  if (gap && on_gap_) {
+    on_gap_({mbo.hd.instrument_id, expected, mbo.sequence, mbo.hd.ts_event});
+  }
+}
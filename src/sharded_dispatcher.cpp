@@ -0,0 +1,125 @@
+#include "databento/sharded_dispatcher.hpp"
+
+#include <thread>   // this_thread
+#include <utility>  // move
+
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+
+using databento::ShardedDispatcher;
+
+constexpr std::size_t ShardedDispatcher::kDefaultQueueCapacity;
+
+ShardedDispatcher::ShardedDispatcher(std::size_t worker_count,
+                                     RecordCallback callback)
+    : ShardedDispatcher{worker_count, kDefaultQueueCapacity,
+                        std::move(callback)} {}
+
+ShardedDispatcher::ShardedDispatcher(std::size_t worker_count,
+                                     std::size_t queue_capacity,
+                                     RecordCallback callback)
+    : callback_{std::move(callback)} {
+  if (worker_count == 0) {
+    throw InvalidArgumentError{"ShardedDispatcher::ShardedDispatcher",
+                               "worker_count", "Must be non-zero"};
+  }
+  shards_.reserve(worker_count);
+  for (std::size_t i = 0; i < worker_count; ++i) {
+    shards_.emplace_back(new Shard{queue_capacity});
+  }
+  workers_.reserve(worker_count);
+  for (std::size_t i = 0; i < worker_count; ++i) {
+    workers_.emplace_back(&ShardedDispatcher::WorkerLoop, this, i);
+  }
+}
+
+ShardedDispatcher::~ShardedDispatcher() {
+  closed_.store(true, std::memory_order_release);
+  // Workers are joined by the ScopedThread destructors
+}
+
+void ShardedDispatcher::Dispatch(const Record& record) {
+  if (stopped_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  auto& shard = *shards_[record.Header().instrument_id % shards_.size()];
+  while (!shard.queue.TryPush(record)) {
+    if (stopped_.load(std::memory_order_relaxed)) {
+      return;
+    }
+    std::this_thread::yield();
+  }
+}
+
+void ShardedDispatcher::Close() {
+  closed_.store(true, std::memory_order_release);
+  for (auto& worker : workers_) {
+    worker.Join();
+  }
+  workers_.clear();
+  if (exception_) {
+    std::exception_ptr exception = exception_;
+    exception_ = nullptr;
+    std::rethrow_exception(exception);
+  }
+}
+
+void ShardedDispatcher::WorkerLoop(std::size_t worker_idx) {
+  const auto shard_count = shards_.size();
+  while (true) {
+    bool processed = false;
+    // Start at the worker's own shard so stealing only happens when it
+    // would otherwise idle
+    for (std::size_t i = 0; i < shard_count; ++i) {
+      Shard& shard = *shards_[(worker_idx + i) % shard_count];
+      bool expected = false;
+      if (!shard.claimed.compare_exchange_strong(
+              expected, true, std::memory_order_acquire)) {
+        continue;
+      }
+      processed |= DrainShard(&shard);
+      shard.claimed.store(false, std::memory_order_release);
+      if (stopped_.load(std::memory_order_relaxed)) {
+        return;
+      }
+    }
+    if (!processed) {
+      if (closed_.load(std::memory_order_acquire) && AllShardsEmpty()) {
+        return;
+      }
+      std::this_thread::yield();
+    }
+  }
+}
+
+bool ShardedDispatcher::DrainShard(Shard* shard) {
+  bool processed = false;
+  while (const Record* record = shard->queue.TryPop()) {
+    processed = true;
+    if (stopped_.load(std::memory_order_relaxed)) {
+      // Keep popping to discard the backlog so Dispatch can't block on a
+      // full shard
+      continue;
+    }
+    try {
+      if (callback_(*record) == KeepGoing::Stop) {
+        stopped_.store(true, std::memory_order_relaxed);
+      }
+    } catch (const std::exception&) {
+      const std::lock_guard<std::mutex> lock{exception_mutex_};
+      if (!exception_) {
+        exception_ = std::current_exception();
+      }
+      stopped_.store(true, std::memory_order_relaxed);
+    }
+  }
+  return processed;
+}
+
+bool ShardedDispatcher::AllShardsEmpty() const {
+  for (const auto& shard : shards_) {
+    if (!shard->queue.Empty()) {
+      return false;
+    }
+  }
+  return true;
+}
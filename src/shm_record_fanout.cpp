@@ -0,0 +1,299 @@
+#include "databento/shm_record_fanout.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close, ftruncate
+#endif
+
+#include <atomic>
+#include <cerrno>   // errno
+#include <cstring>  // memcpy, strerror
+#include <new>      // placement new
+
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+
+using databento::ShmRecordPublisher;
+using databento::ShmRecordSubscriber;
+
+namespace {
+constexpr std::uint64_t kRingMagic = 0x44424E53484D5247ULL;  // "DBNSHMRG"
+constexpr std::uint32_t kRingVersion = 1;
+
+// The fixed-size preamble of the shared ring. The atomics are operated on
+// in place by every attached process, so the layout must not change without
+// bumping kRingVersion.
+struct RingHeader {
+  std::uint64_t magic;
+  std::uint32_t version;
+  // The number of record slots, always a power of two
+  std::uint32_t slot_count;
+  // The total number of records published
+  std::atomic<std::uint64_t> head;
+};
+
+struct RingSlot {
+  // Seqlock stamp: 0 when never written, 2s + 1 while record sequence s is
+  // being copied in, and 2s + 2 once it's complete
+  std::atomic<std::uint64_t> seq;
+  std::uint8_t payload[databento::kMaxRecordLen];
+};
+
+std::size_t NextPowerOfTwo(std::size_t size) {
+  std::size_t res = 2;
+  while (res < size) {
+    res <<= 1;
+  }
+  return res;
+}
+
+std::size_t RingSize(std::size_t slot_count) {
+  return sizeof(RingHeader) + slot_count * sizeof(RingSlot);
+}
+
+const RingHeader& HeaderAt(const void* map) {
+  return *static_cast<const RingHeader*>(map);
+}
+
+RingSlot* SlotsAt(void* map) {
+  return reinterpret_cast<RingSlot*>(static_cast<std::uint8_t*>(map) +
+                                     sizeof(RingHeader));
+}
+
+const RingSlot* SlotsAt(const void* map) {
+  return reinterpret_cast<const RingSlot*>(
+      static_cast<const std::uint8_t*>(map) + sizeof(RingHeader));
+}
+
+void UnmapRing(const void* map, std::size_t map_size) {
+  if (map == nullptr) {
+    return;
+  }
+#ifdef _WIN32
+  ::UnmapViewOfFile(map);
+#else
+  ::munmap(const_cast<void*>(map), map_size);
+#endif
+}
+}  // namespace
+
+ShmRecordPublisher::ShmRecordPublisher(const std::string& path,
+                                       std::size_t min_slot_count) {
+  if (min_slot_count == 0) {
+    throw InvalidArgumentError{"ShmRecordPublisher", "min_slot_count",
+                               "must be nonzero"};
+  }
+  const auto slot_count = NextPowerOfTwo(min_slot_count);
+  map_size_ = RingSize(slot_count);
+#ifdef _WIN32
+  void* file_handle = ::CreateFileA(
+      path.c_str(), GENERIC_READ | GENERIC_WRITE,
+      FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, CREATE_ALWAYS,
+      FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file_handle == INVALID_HANDLE_VALUE) {
+    throw InvalidArgumentError{"ShmRecordPublisher", "path",
+                               "Unable to create ring file"};
+  }
+  // Creating the mapping extends the file to the ring size
+  void* mapping_handle = ::CreateFileMappingA(
+      file_handle, nullptr, PAGE_READWRITE,
+      static_cast<DWORD>(static_cast<std::uint64_t>(map_size_) >> 32),
+      static_cast<DWORD>(map_size_ & 0xFFFFFFFF), nullptr);
+  if (mapping_handle == nullptr) {
+    ::CloseHandle(file_handle);
+    throw InvalidArgumentError{"ShmRecordPublisher", "path",
+                               "Unable to memory map ring file"};
+  }
+  map_ = ::MapViewOfFile(mapping_handle, FILE_MAP_WRITE, 0, 0, 0);
+  // The view keeps the mapping and file alive
+  ::CloseHandle(mapping_handle);
+  ::CloseHandle(file_handle);
+  if (map_ == nullptr) {
+    throw InvalidArgumentError{"ShmRecordPublisher", "path",
+                               "Unable to memory map ring file"};
+  }
+#else
+  const int fd = ::open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+  if (fd < 0) {
+    throw InvalidArgumentError{"ShmRecordPublisher", "path",
+                               std::strerror(errno)};
+  }
+  if (::ftruncate(fd, static_cast<::off_t>(map_size_)) != 0) {
+    const int err_num = errno;
+    ::close(fd);
+    throw InvalidArgumentError{"ShmRecordPublisher", "path",
+                               std::strerror(err_num)};
+  }
+  void* map = ::mmap(nullptr, map_size_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     fd, 0);
+  // The mapping keeps the file alive
+  ::close(fd);
+  if (map == MAP_FAILED) {  // NOLINT(performance-no-int-to-ptr)
+    throw InvalidArgumentError{"ShmRecordPublisher", "path",
+                               "Unable to memory map ring file"};
+  }
+  map_ = map;
+#endif
+  // The freshly-sized file is zero-filled, which is a valid initial state
+  // for every slot stamp. Only the header needs explicit initialization,
+  // and the magic is written last so a subscriber never attaches to a
+  // half-initialized ring.
+  auto* header = new (map_) RingHeader{};
+  header->version = kRingVersion;
+  header->slot_count = static_cast<std::uint32_t>(slot_count);
+  std::atomic_thread_fence(std::memory_order_release);
+  header->magic = kRingMagic;
+}
+
+ShmRecordPublisher::~ShmRecordPublisher() { UnmapRing(map_, map_size_); }
+
+std::size_t ShmRecordPublisher::Capacity() const {
+  return HeaderAt(map_).slot_count;
+}
+
+std::uint64_t ShmRecordPublisher::RecordCount() const {
+  return HeaderAt(map_).head.load(std::memory_order_relaxed);
+}
+
+void ShmRecordPublisher::Publish(const Record& record) {
+  if (record.Size() > kMaxRecordLen) {
+    // A corrupt length byte would otherwise overflow the slot into the
+    // rest of the shared mapping
+    throw InvalidArgumentError{"ShmRecordPublisher::Publish", "record",
+                               "Larger than kMaxRecordLen"};
+  }
+  auto* header = static_cast<RingHeader*>(map_);
+  const auto seq = header->head.load(std::memory_order_relaxed);
+  RingSlot& slot = SlotsAt(map_)[seq & (header->slot_count - 1)];
+  // Seqlock write: stamp the slot in-progress, copy the payload, then stamp
+  // it complete. Readers that overlap either stamp discard their copy.
+  slot.seq.store(2 * seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(slot.payload, &record.Header(), record.Size());
+  slot.seq.store(2 * seq + 2, std::memory_order_release);
+  header->head.store(seq + 1, std::memory_order_release);
+}
+
+ShmRecordSubscriber::ShmRecordSubscriber(const std::string& path) {
+#ifdef _WIN32
+  void* file_handle =
+      ::CreateFileA(path.c_str(), GENERIC_READ,
+                    FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                    FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file_handle == INVALID_HANDLE_VALUE) {
+    throw InvalidArgumentError{"ShmRecordSubscriber", "path",
+                               "Non-existent or invalid ring file"};
+  }
+  LARGE_INTEGER file_size;
+  if (::GetFileSizeEx(file_handle, &file_size) == 0) {
+    ::CloseHandle(file_handle);
+    throw InvalidArgumentError{"ShmRecordSubscriber", "path",
+                               "Unable to determine ring file size"};
+  }
+  map_size_ = static_cast<std::size_t>(file_size.QuadPart);
+  void* mapping_handle = ::CreateFileMappingA(file_handle, nullptr,
+                                              PAGE_READONLY, 0, 0, nullptr);
+  if (mapping_handle == nullptr) {
+    ::CloseHandle(file_handle);
+    throw InvalidArgumentError{"ShmRecordSubscriber", "path",
+                               "Unable to memory map ring file"};
+  }
+  map_ = ::MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+  ::CloseHandle(mapping_handle);
+  ::CloseHandle(file_handle);
+  if (map_ == nullptr) {
+    throw InvalidArgumentError{"ShmRecordSubscriber", "path",
+                               "Unable to memory map ring file"};
+  }
+#else
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw InvalidArgumentError{"ShmRecordSubscriber", "path",
+                               std::strerror(errno)};
+  }
+  struct stat stat_buf;
+  if (::fstat(fd, &stat_buf) != 0) {
+    const int err_num = errno;
+    ::close(fd);
+    throw InvalidArgumentError{"ShmRecordSubscriber", "path",
+                               std::strerror(err_num)};
+  }
+  map_size_ = static_cast<std::size_t>(stat_buf.st_size);
+  if (map_size_ < sizeof(RingHeader)) {
+    ::close(fd);
+    throw InvalidArgumentError{"ShmRecordSubscriber", "path",
+                               "File is too small to contain a record ring"};
+  }
+  const void* map = ::mmap(nullptr, map_size_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (map == MAP_FAILED) {  // NOLINT(performance-no-int-to-ptr)
+    throw InvalidArgumentError{"ShmRecordSubscriber", "path",
+                               "Unable to memory map ring file"};
+  }
+  map_ = map;
+#endif
+  const RingHeader& header = HeaderAt(map_);
+  if (header.magic != kRingMagic || header.version != kRingVersion ||
+      header.slot_count == 0 || map_size_ < RingSize(header.slot_count)) {
+    UnmapRing(map_, map_size_);
+    map_ = nullptr;
+    throw InvalidArgumentError{"ShmRecordSubscriber", "path",
+                               "File doesn't contain a valid record ring"};
+  }
+  // Begin from the oldest record still in the ring rather than counting
+  // everything published before attaching as lost
+  const auto head = header.head.load(std::memory_order_acquire);
+  next_seq_ = head > header.slot_count ? head - header.slot_count : 0;
+}
+
+ShmRecordSubscriber::~ShmRecordSubscriber() { UnmapRing(map_, map_size_); }
+
+std::size_t ShmRecordSubscriber::Capacity() const {
+  return HeaderAt(map_).slot_count;
+}
+
+const databento::Record* ShmRecordSubscriber::Next() {
+  const RingHeader& header = HeaderAt(map_);
+  const RingSlot* slots = SlotsAt(map_);
+  const std::uint64_t mask = header.slot_count - 1;
+  for (;;) {
+    const auto head = header.head.load(std::memory_order_acquire);
+    if (next_seq_ >= head) {
+      return nullptr;
+    }
+    if (head - next_seq_ > header.slot_count) {
+      // Lapped before reading: skip to the oldest record still in the ring
+      const auto oldest = head - header.slot_count;
+      lost_count_ += oldest - next_seq_;
+      next_seq_ = oldest;
+    }
+    const RingSlot& slot = slots[next_seq_ & mask];
+    const auto expected = 2 * next_seq_ + 2;
+    const auto stamp = slot.seq.load(std::memory_order_acquire);
+    if (stamp < expected) {
+      // Publication of next_seq_ is still in flight
+      return nullptr;
+    }
+    if (stamp == expected) {
+      // Seqlock read: copy the slot out, then re-check the stamp to detect
+      // a concurrent overwrite
+      std::memcpy(buffer_.data(), slot.payload, buffer_.size());
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.seq.load(std::memory_order_relaxed) == expected) {
+        ++next_seq_;
+        record_ = Record{reinterpret_cast<RecordHeader*>(buffer_.data())};
+        return &record_;
+      }
+      continue;
+    }
+    // The slot already holds a later record: skip to the oldest sequence
+    // that can still be intact given what now occupies this slot
+    const auto newest = (stamp - 1) / 2;
+    const auto oldest = newest + 1 - header.slot_count;
+    lost_count_ += oldest - next_seq_;
+    next_seq_ = oldest;
+  }
+}
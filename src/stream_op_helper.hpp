@@ -9,8 +9,9 @@
 #include <string>
 #include <utility>  // move
 
-#include "databento/datetime.hpp"  // TimeDeltaNanos, UnixNanos
-#include "databento/enums.hpp"     // RType
+#include "databento/datetime.hpp"      // TimeDeltaNanos, UnixNanos
+#include "databento/enums.hpp"         // RType
+#include "databento/fixed_string.hpp"  // FixedString
 
 namespace databento {
 template <typename T>
@@ -33,6 +34,12 @@ class StreamOpHelper {
     stream_ << '"' << val << '"';
   }
 
+  template <std::size_t Capacity>
+  void FmtToStream(const FixedString<Capacity>& val) {
+    // quoted to match std::string fields
+    stream_ << '"' << val.c_str() << '"';
+  }
+
   void FmtToStream(const bool& val) {
     // otherwise bool is formatted (1|0)
     stream_ << std::boolalpha << val;
@@ -0,0 +1,121 @@
+#include "databento/symbol_intern_pool.hpp"
+
+#include <cstdint>  // uint64_t
+#include <cstring>  // memcmp, memcpy
+
+#include "databento/exceptions.hpp"  // Exception, InvalidArgumentError
+
+using databento::SymbolInternPool;
+
+namespace {
+// FNV-1a: cheap and well-distributed for short symbol strings
+std::uint64_t HashSymbol(const char* symbol, std::size_t length) {
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (std::size_t i = 0; i < length; ++i) {
+    hash ^= static_cast<unsigned char>(symbol[i]);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+bool Equals(const char* handle, const char* symbol, std::size_t length) {
+  return std::memcmp(handle, symbol, length) == 0 && handle[length] == '\0';
+}
+
+std::size_t NextPowerOfTwo(std::size_t size) {
+  std::size_t res = 2;
+  while (res < size) {
+    res <<= 1;
+  }
+  return res;
+}
+}  // namespace
+
+constexpr std::size_t SymbolInternPool::kChunkSize;
+
+SymbolInternPool::SymbolInternPool(std::size_t capacity)
+    // Doubled so the open-addressing index stays under half full
+    : index_(NextPowerOfTwo(capacity * 2)),
+      index_mask_{NextPowerOfTwo(capacity * 2) - 1},
+      capacity_{capacity} {
+  if (capacity == 0) {
+    throw InvalidArgumentError{"SymbolInternPool", "capacity",
+                               "must be nonzero"};
+  }
+}
+
+SymbolInternPool& SymbolInternPool::Shared() {
+  static SymbolInternPool pool{};
+  return pool;
+}
+
+const char* SymbolInternPool::Intern(const std::string& symbol) {
+  return Intern(symbol.data(), symbol.size());
+}
+
+const char* SymbolInternPool::Intern(const char* symbol, std::size_t length) {
+  // Fast path: a symbol seen before is resolved without the mutex
+  const char* found = Find(symbol, length);
+  if (found != nullptr) {
+    return found;
+  }
+  const auto hash = HashSymbol(symbol, length);
+  const std::lock_guard<std::mutex> lock{mutex_};
+  std::size_t idx = static_cast<std::size_t>(hash) & index_mask_;
+  for (std::size_t i = 0; i <= index_mask_; ++i) {
+    const char* existing = index_[idx].load(std::memory_order_acquire);
+    if (existing == nullptr) {
+      if (size_.load(std::memory_order_relaxed) == capacity_) {
+        throw Exception{"SymbolInternPool is full; increase capacity"};
+      }
+      const char* handle = Append(symbol, length);
+      // The release publishes the complete string to lock-free probes
+      index_[idx].store(handle, std::memory_order_release);
+      size_.fetch_add(1, std::memory_order_relaxed);
+      return handle;
+    }
+    if (Equals(existing, symbol, length)) {
+      // Another writer interned it between the fast path and the lock
+      return existing;
+    }
+    idx = (idx + 1) & index_mask_;
+  }
+  // Unreachable: the index is at least twice the capacity
+  throw Exception{"SymbolInternPool is full; increase capacity"};
+}
+
+const char* SymbolInternPool::Find(const std::string& symbol) const {
+  return Find(symbol.data(), symbol.size());
+}
+
+const char* SymbolInternPool::Find(const char* symbol,
+                                   std::size_t length) const {
+  const auto hash = HashSymbol(symbol, length);
+  std::size_t idx = static_cast<std::size_t>(hash) & index_mask_;
+  for (std::size_t i = 0; i <= index_mask_; ++i) {
+    const char* existing = index_[idx].load(std::memory_order_acquire);
+    if (existing == nullptr) {
+      // Symbols are never removed, so an empty slot ends the probe chain
+      return nullptr;
+    }
+    if (Equals(existing, symbol, length)) {
+      return existing;
+    }
+    idx = (idx + 1) & index_mask_;
+  }
+  return nullptr;
+}
+
+const char* SymbolInternPool::Append(const char* symbol, std::size_t length) {
+  if (chunk_used_ + length + 1 > kChunkSize) {
+    // Symbols longer than a chunk get a chunk of their own
+    const auto chunk_size = length + 1 > kChunkSize ? length + 1 : kChunkSize;
+    chunks_.emplace_back(new char[chunk_size]);
+    chunk_used_ = 0;
+  }
+  char* dest = chunks_.back().get() + chunk_used_;
+  std::memcpy(dest, symbol, length);
+  dest[length] = '\0';
+  chunk_used_ += length + 1;
+  return dest;
+}
@@ -1,8 +1,21 @@
 #include "databento/symbol_map.hpp"
 
+#include <algorithm>  // sort, upper_bound
+#include <cstring>    // strncpy
+#include <iterator>   // prev
+#include <limits>
+#include <stdexcept>  // invalid_argument, logic_error
+#include <string>
+#include <unordered_map>
+#include <utility>  // swap
+
 #include "databento/compat.hpp"
+#include "databento/exceptions.hpp"  // InvalidArgumentError
 
+using databento::DensePitSymbolMap;
+using databento::FlatPitSymbolMap;
 using databento::PitSymbolMap;
+using databento::TsSymbolMap;
 
 template <typename SymbolMappingRec>
 void PitSymbolMap::OnSymbolMapping(const SymbolMappingRec& symbol_mapping) {
@@ -31,3 +44,240 @@ template void PitSymbolMap::OnSymbolMapping(
     const SymbolMappingMsgV1& symbol_mapping);
 template void PitSymbolMap::OnSymbolMapping(
     const SymbolMappingMsgV2& symbol_mapping);
+
+namespace {
+// Must be a power of two so probing can mask instead of mod
+constexpr std::size_t kInitialSlotCount = 64;
+
+// Fibonacci hashing spreads the sequential instrument IDs common within one
+// dataset across the table
+std::size_t HashInstrumentId(std::uint32_t instrument_id) {
+  return static_cast<std::size_t>(instrument_id) * 2654435761UL;
+}
+}  // namespace
+
+FlatPitSymbolMap::FlatPitSymbolMap() : slots_(kInitialSlotCount) {}
+
+const char* FlatPitSymbolMap::Find(std::uint32_t instrument_id) const {
+  const std::size_t mask = slots_.size() - 1;
+  std::size_t idx = HashInstrumentId(instrument_id) & mask;
+  // Mappings are never removed, so an unoccupied slot ends the probe chain
+  while (slots_[idx].is_occupied) {
+    if (slots_[idx].instrument_id == instrument_id) {
+      return slots_[idx].symbol.data();
+    }
+    idx = (idx + 1) & mask;
+  }
+  return nullptr;
+}
+
+void FlatPitSymbolMap::Insert(std::uint32_t instrument_id,
+                              const char* symbol) {
+  // Keep at most half the slots occupied so probe chains stay short
+  if ((size_ + 1) * 2 > slots_.size()) {
+    Grow();
+  }
+  Slot& slot = FindSlot(instrument_id);
+  if (!slot.is_occupied) {
+    slot.is_occupied = true;
+    slot.instrument_id = instrument_id;
+    ++size_;
+  }
+  std::strncpy(slot.symbol.data(), symbol, slot.symbol.size() - 1);
+  slot.symbol[slot.symbol.size() - 1] = '\0';
+}
+
+template <typename SymbolMappingRec>
+void FlatPitSymbolMap::OnSymbolMapping(
+    const SymbolMappingRec& symbol_mapping) {
+  Insert(symbol_mapping.hd.instrument_id, symbol_mapping.STypeOutSymbol());
+}
+
+void FlatPitSymbolMap::OnRecord(const Record& record) {
+  if (record.RType() == RType::SymbolMapping) {
+    // Version compat
+    if (record.Header().Size() >= sizeof(SymbolMappingMsgV2)) {
+      OnSymbolMapping(record.Get<SymbolMappingMsgV2>());
+    } else {
+      OnSymbolMapping(record.Get<SymbolMappingMsgV1>());
+    }
+  }
+}
+
+// Returns the slot holding instrument_id, or the unoccupied slot where it
+// should be inserted.
+FlatPitSymbolMap::Slot& FlatPitSymbolMap::FindSlot(
+    std::uint32_t instrument_id) {
+  const std::size_t mask = slots_.size() - 1;
+  std::size_t idx = HashInstrumentId(instrument_id) & mask;
+  while (slots_[idx].is_occupied &&
+         slots_[idx].instrument_id != instrument_id) {
+    idx = (idx + 1) & mask;
+  }
+  return slots_[idx];
+}
+
+void FlatPitSymbolMap::Grow() {
+  std::vector<Slot> old_slots(slots_.size() * 2);
+  std::swap(slots_, old_slots);
+  for (const Slot& slot : old_slots) {
+    if (slot.is_occupied) {
+      FindSlot(slot.instrument_id) = slot;
+    }
+  }
+}
+
+// Explicit instantiation
+template void FlatPitSymbolMap::OnSymbolMapping(
+    const SymbolMappingMsgV1& symbol_mapping);
+template void FlatPitSymbolMap::OnSymbolMapping(
+    const SymbolMappingMsgV2& symbol_mapping);
+
+namespace {
+// The widest ID range stored direct-indexed. At kSymbolCstrLen bytes per
+// slot, a fully-extended window is a few MiB; IDs further from the base go
+// to the sparse fallback instead.
+constexpr std::uint32_t kMaxDenseSpan = 1 << 16;
+// The window base starts this far below the first-seen ID, so slightly
+// smaller IDs arriving later still land in the window
+constexpr std::uint32_t kDenseHeadroom = 1024;
+}  // namespace
+
+const char* DensePitSymbolMap::Find(std::uint32_t instrument_id) const {
+  // Wraps for IDs below the base, yielding an offset beyond the window
+  const std::uint32_t offset = instrument_id - base_;
+  if (offset < dense_.size()) {
+    const DenseSlot& slot = dense_[offset];
+    return slot[0] == '\0' ? nullptr : slot.data();
+  }
+  if (offset < kMaxDenseSpan) {
+    // Within the window but never inserted, so it can't be in the fallback
+    return nullptr;
+  }
+  return sparse_.Find(instrument_id);
+}
+
+void DensePitSymbolMap::Insert(std::uint32_t instrument_id,
+                               const char* symbol) {
+  if (!has_base_) {
+    has_base_ = true;
+    base_ = instrument_id > kDenseHeadroom ? instrument_id - kDenseHeadroom
+                                           : 0;
+  }
+  const std::uint32_t offset = instrument_id - base_;
+  if (offset >= kMaxDenseSpan) {
+    sparse_.Insert(instrument_id, symbol);
+    return;
+  }
+  if (offset >= dense_.size()) {
+    dense_.resize(offset + 1);
+  }
+  DenseSlot& slot = dense_[offset];
+  if (slot[0] == '\0') {
+    ++dense_size_;
+  }
+  std::strncpy(slot.data(), symbol, slot.size() - 1);
+  slot[slot.size() - 1] = '\0';
+}
+
+template <typename SymbolMappingRec>
+void DensePitSymbolMap::OnSymbolMapping(
+    const SymbolMappingRec& symbol_mapping) {
+  Insert(symbol_mapping.hd.instrument_id, symbol_mapping.STypeOutSymbol());
+}
+
+void DensePitSymbolMap::OnRecord(const Record& record) {
+  if (record.RType() == RType::SymbolMapping) {
+    // Version compat
+    if (record.Header().Size() >= sizeof(SymbolMappingMsgV2)) {
+      OnSymbolMapping(record.Get<SymbolMappingMsgV2>());
+    } else {
+      OnSymbolMapping(record.Get<SymbolMappingMsgV1>());
+    }
+  }
+}
+
+// Explicit instantiation
+template void DensePitSymbolMap::OnSymbolMapping(
+    const SymbolMappingMsgV1& symbol_mapping);
+template void DensePitSymbolMap::OnSymbolMapping(
+    const SymbolMappingMsgV2& symbol_mapping);
+
+namespace {
+std::uint32_t ParseInstrumentId(const std::string& symbol) {
+  try {
+    std::size_t pos{};
+    const unsigned long res = std::stoul(symbol, &pos);
+    if (pos != symbol.size() ||
+        res > std::numeric_limits<std::uint32_t>::max()) {
+      throw std::invalid_argument{symbol};
+    }
+    return static_cast<std::uint32_t>(res);
+  } catch (const std::logic_error&) {  // invalid_argument or out_of_range
+    throw databento::InvalidArgumentError{
+        "TsSymbolMap::TsSymbolMap", "metadata",
+        "Found mapping with invalid instrument ID: " + symbol};
+  }
+}
+}  // namespace
+
+TsSymbolMap::TsSymbolMap(const Metadata& metadata) {
+  const bool out_is_id = metadata.stype_out == SType::InstrumentId;
+  if (!out_is_id && metadata.stype_in != SType::InstrumentId) {
+    throw InvalidArgumentError{
+        "TsSymbolMap::TsSymbolMap", "metadata",
+        "Can only build map from metadata where either stype_out or "
+        "stype_in is instrument ID"};
+  }
+  std::unordered_map<std::string, std::uint32_t> intern_idx;
+  const auto intern = [this, &intern_idx](const std::string& symbol) {
+    const auto res = intern_idx.emplace(
+        symbol, static_cast<std::uint32_t>(symbols_.size()));
+    if (res.second) {
+      symbols_.emplace_back(symbol);
+    }
+    return res.first->second;
+  };
+  for (const auto& mapping : metadata.mappings) {
+    for (const auto& interval : mapping.intervals) {
+      if (interval.symbol.empty()) {
+        // The symbol didn't resolve for these days
+        continue;
+      }
+      // The instrument ID is on whichever side of the mapping uses that
+      // symbology type
+      const auto instrument_id =
+          ParseInstrumentId(out_is_id ? interval.symbol : mapping.raw_symbol);
+      const auto symbol_idx =
+          intern(out_is_id ? mapping.raw_symbol : interval.symbol);
+      entries_.push_back(Entry{instrument_id, interval.start_date,
+                               interval.end_date, symbol_idx});
+    }
+  }
+  std::sort(entries_.begin(), entries_.end(),
+            [](const Entry& lhs, const Entry& rhs) {
+              return lhs.instrument_id < rhs.instrument_id ||
+                     (lhs.instrument_id == rhs.instrument_id &&
+                      lhs.start_date < rhs.start_date);
+            });
+}
+
+const std::string* TsSymbolMap::Find(std::uint32_t date,
+                                     std::uint32_t instrument_id) const {
+  // The last entry for instrument_id with start_date <= date, if any
+  const auto it = std::upper_bound(
+      entries_.begin(), entries_.end(), date,
+      [instrument_id](std::uint32_t target, const Entry& entry) {
+        return instrument_id < entry.instrument_id ||
+               (instrument_id == entry.instrument_id &&
+                target < entry.start_date);
+      });
+  if (it == entries_.begin()) {
+    return nullptr;
+  }
+  const Entry& entry = *std::prev(it);
+  if (entry.instrument_id != instrument_id || date >= entry.end_date) {
+    return nullptr;
+  }
+  return &symbols_[entry.symbol_idx];
+}
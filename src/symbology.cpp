@@ -1,7 +1,11 @@
 #include "databento/symbology.hpp"
 
-#include <numeric>  // accumulate
+#include <algorithm>  // lower_bound, sort
+#include <cstring>    // strcmp
+#include <numeric>    // accumulate
 #include <sstream>
+#include <unordered_map>
+#include <utility>  // move
 
 #include "databento/exceptions.hpp"  // InvalidArgumentError
 #include "stream_op_helper.hpp"      // StreamOpBuilder
@@ -29,6 +33,20 @@ std::string JoinSymbolStrings(const std::string& method_name,
   return JoinSymbolStrings(method_name, symbols.begin(), symbols.end());
 }
 
+std::string JoinSymbolStrings(const std::string& method_name,
+                              const char* const* symbols,
+                              std::size_t symbol_count) {
+  if (symbol_count == 0) {
+    throw InvalidArgumentError{method_name, "symbols", "Cannot be empty"};
+  }
+  std::string res{symbols[0]};
+  for (std::size_t i = 1; i < symbol_count; ++i) {
+    res += ',';
+    res += symbols[i];
+  }
+  return res;
+}
+
 std::string ToString(const StrMappingInterval& mapping_interval) {
   return MakeString(mapping_interval);
 }
@@ -97,4 +115,86 @@ std::ostream& operator<<(std::ostream& stream,
 
   return stream_helper.Finish();
 }
+
+FlatSymbologyResolution::FlatSymbologyResolution(
+    const SymbologyResolution& resolution) {
+  // Worst-case pool size assuming no text repeats, so interning never
+  // reallocates out from under the views
+  std::size_t pool_capacity{};
+  std::size_t interval_count{};
+  for (const auto& mapping : resolution.mappings) {
+    pool_capacity += mapping.first.size() + 1;
+    interval_count += mapping.second.size();
+    for (const auto& interval : mapping.second) {
+      pool_capacity += interval.start_date.size() + interval.end_date.size() +
+                       interval.symbol.size() + 3;
+    }
+  }
+  for (const auto& symbol : resolution.partial) {
+    pool_capacity += symbol.size() + 1;
+  }
+  for (const auto& symbol : resolution.not_found) {
+    pool_capacity += symbol.size() + 1;
+  }
+  auto pool = std::make_shared<std::vector<char>>();
+  pool->reserve(pool_capacity);
+  std::unordered_map<std::string, const char*> intern_idx;
+  const auto intern = [&pool, &intern_idx](const std::string& text) {
+    const auto it = intern_idx.find(text);
+    if (it != intern_idx.end()) {
+      return it->second;
+    }
+    const char* interned = pool->data() + pool->size();
+    pool->insert(pool->end(), text.c_str(), text.c_str() + text.size() + 1);
+    intern_idx.emplace(text, interned);
+    return interned;
+  };
+  mappings_.reserve(resolution.mappings.size());
+  intervals_.reserve(interval_count);
+  for (const auto& mapping : resolution.mappings) {
+    const FlatSymbolMapping flat{
+        intern(mapping.first), static_cast<std::uint32_t>(intervals_.size()),
+        static_cast<std::uint32_t>(mapping.second.size())};
+    for (const auto& interval : mapping.second) {
+      intervals_.push_back(FlatStrMappingInterval{intern(interval.start_date),
+                                                  intern(interval.end_date),
+                                                  intern(interval.symbol)});
+    }
+    std::sort(intervals_.begin() +
+                  static_cast<std::ptrdiff_t>(flat.interval_begin),
+              intervals_.end(),
+              [](const FlatStrMappingInterval& lhs,
+                 const FlatStrMappingInterval& rhs) {
+                return std::strcmp(lhs.start_date, rhs.start_date) < 0;
+              });
+    mappings_.push_back(flat);
+  }
+  std::sort(mappings_.begin(), mappings_.end(),
+            [](const FlatSymbolMapping& lhs, const FlatSymbolMapping& rhs) {
+              return std::strcmp(lhs.input_symbol, rhs.input_symbol) < 0;
+            });
+  partial_.reserve(resolution.partial.size());
+  for (const auto& symbol : resolution.partial) {
+    partial_.push_back(intern(symbol));
+  }
+  not_found_.reserve(resolution.not_found.size());
+  for (const auto& symbol : resolution.not_found) {
+    not_found_.push_back(intern(symbol));
+  }
+  pool_ = std::move(pool);
+}
+
+const FlatSymbolMapping* FlatSymbologyResolution::Find(
+    const char* input_symbol) const {
+  const auto it = std::lower_bound(
+      mappings_.begin(), mappings_.end(), input_symbol,
+      [](const FlatSymbolMapping& mapping, const char* target) {
+        return std::strcmp(mapping.input_symbol, target) < 0;
+      });
+  if (it == mappings_.end() ||
+      std::strcmp(it->input_symbol, input_symbol) != 0) {
+    return nullptr;
+  }
+  return &*it;
+}
 }  // namespace databento
@@ -30,12 +30,20 @@ class MockHttpServer {
   void MockGetJson(const std::string& path,
                    const std::map<std::string, std::string>& params,
                    const nlohmann::json& json, const nlohmann::json& warnings);
+  // Like `MockGetJson`, but serves the body zstd-compressed with a
+  // Content-Encoding header, for testing negotiated transfer encoding.
+  void MockGetJsonZstd(const std::string& path, const nlohmann::json& json);
   void MockPostJson(const std::string& path,
                     const std::map<std::string, std::string>& params,
                     const nlohmann::json& json);
   void MockStreamDbn(const std::string& path,
                      const std::map<std::string, std::string>& params,
                      const std::string& dbn_path);
+  // Like `MockStreamDbn`, but serves the whole file up front so httplib
+  // can answer HTTP range requests.
+  void MockStreamDbnRanged(const std::string& path,
+                           const std::map<std::string, std::string>& params,
+                           const std::string& dbn_path);
 
  private:
   static void CheckParams(const std::map<std::string, std::string>& params,
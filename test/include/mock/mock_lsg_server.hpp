@@ -10,7 +10,9 @@ using ssize_t = SSIZE_T;
 #include <sys/socket.h>  // send
 #endif
 
+#include <chrono>  // nanoseconds
 #include <condition_variable>
+#include <cstddef>     // size_t
 #include <functional>  // function
 #include <mutex>
 #include <string>
@@ -32,9 +34,16 @@ class MockLsgServer {
   std::uint16_t Port() const { return port_; }
 
   void Accept();
+  // Accept a second connection, stashing the current one. `SwapConn`
+  // switches which of the two subsequent calls operate on.
+  void AcceptSwapConn();
+  void SwapConn();
   void Authenticate();
   void Subscribe(const std::vector<std::string>& symbols, Schema schema,
                  SType stype);
+  // Like `Subscribe`, but additionally checks the intraday replay start
+  void Subscribe(const std::vector<std::string>& symbols, Schema schema,
+                 SType stype, const std::string& start);
   void Start();
   std::size_t Send(const std::string& msg);
   ::ssize_t UncheckedSend(const std::string& msg);
@@ -61,12 +70,26 @@ class MockLsgServer {
     Send(second_part);
   }
 
+  // Streams `record_count` generated MBO records as fast as the socket
+  // accepts them, in bursts of `records_per_burst` records separated by
+  // `burst_interval` (zero streams a sustained max-rate firehose). Each
+  // record's `sequence` field carries its index so consumers can detect
+  // drops. Returns the number of records fully written, which is less than
+  // `record_count` if the peer closed the connection mid-stream; pass
+  // `SIZE_MAX` to stream until the peer disconnects.
+  std::size_t StreamMboBursts(std::size_t record_count,
+                              std::size_t records_per_burst,
+                              std::chrono::nanoseconds burst_interval);
+
   void Close();
 
  private:
   detail::Socket InitSocketAndSetPort();
   detail::Socket InitSocketAndSetPort(int port);
   std::string Receive();
+  static void CheckSubscription(const std::string& received,
+                                const std::vector<std::string>& symbols,
+                                Schema schema, SType stype);
 
   template <typename T>
   std::size_t SendBytes(T bytes) {
@@ -82,6 +105,7 @@ class MockLsgServer {
   std::uint16_t port_{};
   detail::ScopedFd socket_{};
   detail::ScopedFd conn_fd_{};
+  detail::ScopedFd held_fd_{};
   detail::ScopedThread thread_;
 };
 }  // namespace mock
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "databento/bar_aggregator.hpp"
+#include "databento/enums.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+class BarAggregatorTests : public testing::Test {
+ protected:
+  static constexpr std::uint64_t kNanosPerSecond = 1000000000ULL;
+
+  static TradeMsg MakeTrade(std::uint32_t instrument_id, std::uint64_t ts,
+                            std::int64_t price, std::uint32_t size) {
+    TradeMsg trade{};
+    trade.hd = RecordHeader{sizeof(TradeMsg) / RecordHeader::kLengthMultiplier,
+                            RType::Mbp0, 1, instrument_id,
+                            UnixNanos{std::chrono::nanoseconds{ts}}};
+    trade.price = price;
+    trade.size = size;
+    trade.action = Action::Trade;
+    return trade;
+  }
+
+  std::vector<OhlcvMsg> bars_;
+};
+
+TEST_F(BarAggregatorTests, TestSingleInstrument) {
+  BarAggregator target{std::chrono::seconds{1},
+                       [this](const OhlcvMsg& bar) { bars_.push_back(bar); }};
+  auto trade = MakeTrade(1, kNanosPerSecond + 100, 10, 2);
+  target.OnRecord(Record{&trade.hd});
+  trade = MakeTrade(1, kNanosPerSecond + 200, 12, 1);
+  target.OnRecord(Record{&trade.hd});
+  trade = MakeTrade(1, kNanosPerSecond + 300, 9, 3);
+  target.OnRecord(Record{&trade.hd});
+  EXPECT_TRUE(bars_.empty());
+  EXPECT_EQ(target.OpenBarCount(), 1);
+  // A trade in the next interval closes the bar
+  trade = MakeTrade(1, 2 * kNanosPerSecond, 11, 1);
+  target.OnRecord(Record{&trade.hd});
+  ASSERT_EQ(bars_.size(), 1);
+  EXPECT_EQ(bars_[0].hd.rtype, RType::Ohlcv1S);
+  EXPECT_EQ(bars_[0].hd.instrument_id, 1);
+  EXPECT_EQ(bars_[0].hd.ts_event.time_since_epoch().count(),
+            kNanosPerSecond);
+  EXPECT_EQ(bars_[0].open, 10);
+  EXPECT_EQ(bars_[0].high, 12);
+  EXPECT_EQ(bars_[0].low, 9);
+  EXPECT_EQ(bars_[0].close, 9);
+  EXPECT_EQ(bars_[0].volume, 6);
+  target.Flush();
+  ASSERT_EQ(bars_.size(), 2);
+  EXPECT_EQ(bars_[1].open, 11);
+  EXPECT_EQ(bars_[1].volume, 1);
+  EXPECT_EQ(target.OpenBarCount(), 0);
+}
+
+TEST_F(BarAggregatorTests, TestMultipleInstruments) {
+  BarAggregator target{std::chrono::seconds{1},
+                       [this](const OhlcvMsg& bar) { bars_.push_back(bar); }};
+  auto trade = MakeTrade(10, 100, 5, 1);
+  target.OnRecord(Record{&trade.hd});
+  trade = MakeTrade(12, 200, 7, 2);
+  target.OnRecord(Record{&trade.hd});
+  // An instrument ID far from the first-seen ID takes the sparse path
+  trade = MakeTrade(10000000, 300, 9, 3);
+  target.OnRecord(Record{&trade.hd});
+  EXPECT_EQ(target.OpenBarCount(), 3);
+  target.Flush();
+  ASSERT_EQ(bars_.size(), 3);
+  EXPECT_EQ(bars_[0].hd.instrument_id, 10);
+  EXPECT_EQ(bars_[1].hd.instrument_id, 12);
+  EXPECT_EQ(bars_[2].hd.instrument_id, 10000000);
+  EXPECT_EQ(bars_[2].open, 9);
+}
+
+TEST_F(BarAggregatorTests, TestCustomInterval) {
+  BarAggregator target{std::chrono::milliseconds{250},
+                       [this](const OhlcvMsg& bar) { bars_.push_back(bar); }};
+  auto trade = MakeTrade(1, 100000000, 10, 1);
+  target.OnRecord(Record{&trade.hd});
+  trade = MakeTrade(1, 260000000, 11, 1);
+  target.OnRecord(Record{&trade.hd});
+  ASSERT_EQ(bars_.size(), 1);
+  EXPECT_EQ(bars_[0].hd.rtype, RType::OhlcvDeprecated);
+  EXPECT_EQ(bars_[0].hd.ts_event.time_since_epoch().count(), 0);
+  target.Flush();
+  ASSERT_EQ(bars_.size(), 2);
+  EXPECT_EQ(bars_[1].hd.ts_event.time_since_epoch().count(), 250000000);
+}
+
+TEST_F(BarAggregatorTests, TestMboTrades) {
+  BarAggregator target{std::chrono::seconds{1},
+                       [this](const OhlcvMsg& bar) { bars_.push_back(bar); }};
+  MboMsg mbo{};
+  mbo.hd = RecordHeader{sizeof(MboMsg) / RecordHeader::kLengthMultiplier,
+                        RType::Mbo, 1, 1,
+                        UnixNanos{std::chrono::nanoseconds{100}}};
+  mbo.price = 10;
+  mbo.size = 2;
+  mbo.action = Action::Trade;
+  mbo.side = Side::Ask;
+  target.OnRecord(Record{&mbo.hd});
+  // Non-trade actions don't contribute
+  mbo.action = Action::Add;
+  mbo.size = 100;
+  target.OnRecord(Record{&mbo.hd});
+  target.Flush();
+  ASSERT_EQ(bars_.size(), 1);
+  EXPECT_EQ(bars_[0].volume, 2);
+}
+
+TEST_F(BarAggregatorTests, TestInvalidInterval) {
+  EXPECT_THROW(
+      BarAggregator(std::chrono::seconds{0}, [](const OhlcvMsg&) {}),
+      InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
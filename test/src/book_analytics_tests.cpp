@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <cmath>  // isnan
+#include <vector>
+
+#include "databento/book_analytics.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+class BookAnalyticsTests : public testing::Test {
+ protected:
+  static BidAskPair MakeLevel(std::int64_t bid_px, std::int64_t ask_px,
+                              std::uint32_t bid_sz, std::uint32_t ask_sz) {
+    return BidAskPair{bid_px, ask_px, bid_sz, ask_sz, 1, 1};
+  }
+
+  Mbp10Msg MakeMbp10(std::uint32_t bid_sz, std::uint32_t ask_sz) {
+    Mbp10Msg mbp{};
+    mbp.hd = RecordHeader{sizeof(Mbp10Msg) / RecordHeader::kLengthMultiplier,
+                          RType::Mbp10, 1, 1, UnixNanos{}};
+    mbp.levels[0] = MakeLevel(100, 102, bid_sz, ask_sz);
+    for (std::size_t i = 1; i < mbp.levels.size(); ++i) {
+      mbp.levels[i] =
+          MakeLevel(100 - static_cast<std::int64_t>(i),
+                    102 + static_cast<std::int64_t>(i), bid_sz, ask_sz);
+    }
+    return mbp;
+  }
+};
+
+TEST_F(BookAnalyticsTests, TestSizeWeightedMid) {
+  // Equal sizes reduce to the plain mid
+  EXPECT_DOUBLE_EQ(book_analytics::SizeWeightedMid(MakeLevel(100, 102, 5, 5)),
+                   101.0);
+  // Weighted toward the heavier side
+  EXPECT_DOUBLE_EQ(book_analytics::SizeWeightedMid(MakeLevel(100, 102, 3, 1)),
+                   100.5);
+  EXPECT_TRUE(
+      std::isnan(book_analytics::SizeWeightedMid(MakeLevel(100, 102, 0, 0))));
+}
+
+TEST_F(BookAnalyticsTests, TestMicroprice) {
+  EXPECT_DOUBLE_EQ(book_analytics::Microprice(MakeLevel(100, 102, 5, 5)),
+                   101.0);
+  // Weighted toward the side with less resting quantity
+  EXPECT_DOUBLE_EQ(book_analytics::Microprice(MakeLevel(100, 102, 3, 1)),
+                   101.5);
+  EXPECT_TRUE(
+      std::isnan(book_analytics::Microprice(MakeLevel(100, 102, 0, 0))));
+}
+
+TEST_F(BookAnalyticsTests, TestImbalance) {
+  const std::array<BidAskPair, 3> balanced{MakeLevel(100, 102, 5, 5),
+                                           MakeLevel(99, 103, 2, 2),
+                                           MakeLevel(98, 104, 1, 1)};
+  EXPECT_DOUBLE_EQ(book_analytics::Imbalance(balanced), 0.0);
+  const std::array<BidAskPair, 2> bid_heavy{MakeLevel(100, 102, 6, 2),
+                                            MakeLevel(99, 103, 3, 1)};
+  EXPECT_DOUBLE_EQ(book_analytics::Imbalance(bid_heavy), 0.5);
+  const std::array<BidAskPair, 1> ask_only{MakeLevel(100, 102, 0, 4)};
+  EXPECT_DOUBLE_EQ(book_analytics::Imbalance(ask_only), -1.0);
+}
+
+TEST_F(BookAnalyticsTests, TestBatchKernels) {
+  auto bid_heavy = MakeMbp10(3, 1);
+  auto balanced = MakeMbp10(5, 5);
+  TradeMsg trade{};
+  trade.hd = RecordHeader{sizeof(TradeMsg) / RecordHeader::kLengthMultiplier,
+                          RType::Mbp0, 1, 1, UnixNanos{}};
+  const std::vector<Record> records{Record{&bid_heavy.hd},
+                                    Record{&trade.hd},
+                                    Record{&balanced.hd}};
+  std::vector<double> out;
+  // Non-MBP-10 records are skipped
+  EXPECT_EQ(book_analytics::SizeWeightedMid(records, &out), 2);
+  ASSERT_EQ(out.size(), 2);
+  EXPECT_DOUBLE_EQ(out[0], 100.5);
+  EXPECT_DOUBLE_EQ(out[1], 101.0);
+  // Batch calls append to the output
+  EXPECT_EQ(book_analytics::Microprice(records, &out), 2);
+  ASSERT_EQ(out.size(), 4);
+  EXPECT_DOUBLE_EQ(out[2], 101.5);
+  EXPECT_EQ(book_analytics::Imbalance(records, &out), 2);
+  ASSERT_EQ(out.size(), 6);
+  EXPECT_DOUBLE_EQ(out[4], 0.5);
+  EXPECT_DOUBLE_EQ(out[5], 0.0);
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "databento/detail/buffer_channel.hpp"
+#include "databento/detail/scoped_thread.hpp"
+#include "databento/exceptions.hpp"
+
+namespace databento {
+namespace detail {
+namespace test {
+class BufferChannelTests : public testing::Test {
+ protected:
+  void Write(const std::vector<std::string>& inputs) {
+    for (const auto& input : inputs) {
+      target_.Write(reinterpret_cast<const std::uint8_t*>(input.data()),
+                    input.size());
+    }
+    target_.Finish();
+  }
+
+  BufferChannel target_;
+  ScopedThread write_thread_;
+};
+
+TEST_F(BufferChannelTests, TestNextSlice) {
+  this->Write({"parse", "slices", "end"});
+  std::vector<std::uint8_t> slice;
+  std::size_t offset{};
+  ASSERT_TRUE(target_.NextSlice(&slice, &offset));
+  EXPECT_EQ(offset, 0);
+  EXPECT_EQ(std::string(slice.begin(), slice.end()), "parse");
+  ASSERT_TRUE(target_.NextSlice(&slice, &offset));
+  EXPECT_EQ(std::string(slice.begin(), slice.end()), "slices");
+  ASSERT_TRUE(target_.NextSlice(&slice, &offset));
+  EXPECT_EQ(std::string(slice.begin(), slice.end()), "end");
+  ASSERT_FALSE(target_.NextSlice(&slice, &offset));
+  EXPECT_TRUE(slice.empty());
+}
+
+TEST_F(BufferChannelTests, TestNextSliceOffsetAfterReadSome) {
+  this->Write({"header+payload", "rest"});
+  std::array<std::uint8_t, 8> buffer{};
+  // Consume part of the first slice through the byte-stream interface
+  ASSERT_EQ(target_.ReadSome(buffer.data(), 6), 6);
+  EXPECT_STREQ(reinterpret_cast<const char*>(buffer.data()), "header");
+  std::vector<std::uint8_t> slice;
+  std::size_t offset{};
+  ASSERT_TRUE(target_.NextSlice(&slice, &offset));
+  EXPECT_EQ(offset, 6);
+  EXPECT_EQ(std::string(slice.begin() + static_cast<std::ptrdiff_t>(offset),
+                        slice.end()),
+            "+payload");
+  ASSERT_TRUE(target_.NextSlice(&slice, &offset));
+  EXPECT_EQ(offset, 0);
+  EXPECT_EQ(std::string(slice.begin(), slice.end()), "rest");
+}
+
+TEST_F(BufferChannelTests, TestWriteMovedSlice) {
+  const std::string contents = "moved without copying";
+  std::vector<std::uint8_t> input{contents.begin(), contents.end()};
+  const auto* data_ptr = input.data();
+  target_.Write(std::move(input));
+  target_.Finish();
+  std::vector<std::uint8_t> slice;
+  std::size_t offset{};
+  ASSERT_TRUE(target_.NextSlice(&slice, &offset));
+  // The reader takes ownership of the writer's allocation
+  EXPECT_EQ(slice.data(), data_ptr);
+  EXPECT_EQ(std::string(slice.begin(), slice.end()), contents);
+}
+
+TEST_F(BufferChannelTests, TestReadExact) {
+  write_thread_ = ScopedThread{[this] {
+    this->Write({"parse", "stream", "tests", "end"});
+  }};
+  std::array<std::uint8_t, 16> buffer{};
+  target_.ReadExact(buffer.data(), 3);
+  EXPECT_STREQ(reinterpret_cast<const char*>(buffer.data()), "par");
+  target_.ReadExact(buffer.data(), 8);
+  EXPECT_STREQ(reinterpret_cast<const char*>(buffer.data()), "sestream");
+  target_.ReadExact(buffer.data(), 8);
+  EXPECT_STREQ(reinterpret_cast<const char*>(buffer.data()), "testsend");
+  ASSERT_THROW(target_.ReadExact(buffer.data(), 1), DbnResponseError);
+}
+
+TEST_F(BufferChannelTests, TestMixedReadSomeAndNextSlice) {
+  write_thread_ = ScopedThread{[this] {
+    this->Write({"alpha", "beta", "gamma", "delta"});
+  }};
+  std::string res;
+  std::array<std::uint8_t, 4> buffer{};
+  std::vector<std::uint8_t> slice;
+  std::size_t offset{};
+  bool use_slice = false;
+  while (true) {
+    if (use_slice) {
+      if (!target_.NextSlice(&slice, &offset)) {
+        break;
+      }
+      res.append(slice.begin() + static_cast<std::ptrdiff_t>(offset),
+                 slice.end());
+    } else {
+      const auto read_size = target_.ReadSome(buffer.data(), buffer.size());
+      if (read_size == 0) {
+        break;
+      }
+      res.append(reinterpret_cast<const char*>(buffer.data()), read_size);
+    }
+    use_slice = !use_slice;
+  }
+  ASSERT_EQ(res, "alphabetagammadelta");
+}
+
+TEST_F(BufferChannelTests, TestAbortReleasesBlockedWriter) {
+  write_thread_ = ScopedThread{[this] {
+    // The first slice reaches the high watermark, so the second write
+    // blocks until the channel is aborted
+    const std::vector<std::uint8_t> slice(1UL << 20, 0xFF);
+    target_.Write(slice.data(), slice.size());
+    target_.Write(slice.data(), slice.size());
+    target_.Finish();
+  }};
+  target_.Abort();
+  // Joining proves the abort released the writer without a reader draining
+  // the channel
+  write_thread_.Join();
+  std::array<std::uint8_t, 16> buffer{};
+  EXPECT_EQ(target_.ReadSome(buffer.data(), buffer.size()), 0);
+  std::vector<std::uint8_t> slice;
+  std::size_t offset{};
+  EXPECT_FALSE(target_.NextSlice(&slice, &offset));
+}
+}  // namespace test
+}  // namespace detail
+}  // namespace databento
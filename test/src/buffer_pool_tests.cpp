@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "databento/detail/buffer_pool.hpp"
+
+namespace databento {
+namespace detail {
+namespace test {
+TEST(BufferPoolTests, TestAcquireReturnsEmptyWithCapacity) {
+  BufferPool target;
+  const auto buffer = target.Acquire(5000);
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_GE(buffer.capacity(), 5000);
+}
+
+TEST(BufferPoolTests, TestThreadCacheRoundTrip) {
+  BufferPool target;
+  auto buffer = target.Acquire(16384);
+  buffer.resize(16384);
+  const auto* const data = buffer.data();
+  target.Release(std::move(buffer));
+  auto recycled = target.Acquire(16384);
+  recycled.resize(16384);
+  // Came back from the thread-local cache: same allocation, no lock taken
+  EXPECT_EQ(recycled.data(), data);
+  EXPECT_EQ(target.PooledCount(), 0);
+}
+
+TEST(BufferPoolTests, TestOverflowToSharedFreeList) {
+  BufferPool target;
+  std::vector<std::vector<std::uint8_t>> buffers;
+  for (std::size_t i = 0; i < 3; ++i) {
+    buffers.emplace_back(target.Acquire(32768));
+  }
+  for (auto& buffer : buffers) {
+    target.Release(std::move(buffer));
+  }
+  // The first release fills the thread cache; the rest overflow to the pool
+  EXPECT_EQ(target.PooledCount(), 2);
+}
+
+TEST(BufferPoolTests, TestRetentionCap) {
+  BufferPool target;
+  std::vector<std::vector<std::uint8_t>> buffers;
+  for (std::size_t i = 0; i < 12; ++i) {
+    buffers.emplace_back(target.Acquire(4096));
+  }
+  for (auto& buffer : buffers) {
+    target.Release(std::move(buffer));
+  }
+  EXPECT_EQ(target.PooledCount(), 8);
+}
+
+TEST(BufferPoolTests, TestUnpoolableCapacitiesFreed) {
+  BufferPool target;
+  std::vector<std::uint8_t> tiny;
+  tiny.reserve(100);
+  target.Release(std::move(tiny));
+  // Larger than the largest size class, so served and freed by the allocator
+  auto oversize = target.Acquire(std::size_t{16} << 20);
+  EXPECT_GE(oversize.capacity(), std::size_t{16} << 20);
+  target.Release(std::move(oversize));
+  EXPECT_EQ(target.PooledCount(), 0);
+}
+
+TEST(BufferPoolTests, TestConcurrentChurn) {
+  BufferPool target;
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < 4; ++i) {
+    threads.emplace_back([&target] {
+      for (std::size_t j = 0; j < 1000; ++j) {
+        auto buffer = target.Acquire(8192);
+        buffer.resize(8192);
+        buffer[j % buffer.size()] = static_cast<std::uint8_t>(j);
+        target.Release(std::move(buffer));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_LE(target.PooledCount(), 8);
+}
+
+TEST(BufferPoolTests, TestSharedInstance) {
+  EXPECT_EQ(&BufferPool::Shared(), &BufferPool::Shared());
+}
+}  // namespace test
+}  // namespace detail
+}  // namespace databento
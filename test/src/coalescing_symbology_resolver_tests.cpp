@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <chrono>  // milliseconds
+#include <cstdint>
+#include <future>  // future
+#include <memory>
+#include <nlohmann/json.hpp>
+
+#include "databento/coalescing_symbology_resolver.hpp"
+#include "databento/constants.hpp"  // dataset
+#include "databento/enums.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/historical.hpp"
+#include "databento/log.hpp"
+#include "databento/symbology.hpp"
+#include "mock/mock_http_server.hpp"
+
+namespace databento {
+namespace test {
+class CoalescingSymbologyResolverTests : public ::testing::Test {
+ protected:
+  static constexpr auto kApiKey = "HIST_SECRET";
+
+  static nlohmann::json ResolutionResp(const nlohmann::json& result) {
+    return nlohmann::json{
+        {"result", result},
+        {"partial", nlohmann::json::array()},
+        {"not_found", nlohmann::json::array()},
+        {"message", "OK"},
+        {"status", 0},
+    };
+  }
+
+  mock::MockHttpServer mock_server_{kApiKey};
+  std::unique_ptr<ILogReceiver> logger_{new NullLogReceiver};
+};
+
+TEST_F(CoalescingSymbologyResolverTests, TestCoalescesOverlappingRequests) {
+  const nlohmann::json kResult{{"ESM2",
+                                {{
+                                    {"d0", "2022-06-06"},
+                                    {"d1", "2022-06-10"},
+                                    {"s", "3403"},
+                                }}},
+                               {"NQZ2",
+                                {{
+                                    {"d0", "2022-06-06"},
+                                    {"d1", "2022-06-10"},
+                                    {"s", "15921"},
+                                }}}};
+  // The mock only answers the deduplicated union request; separate requests
+  // per caller would fail to match and error
+  mock_server_.MockPostJson("/v0/symbology.resolve",
+                            {
+                                {"dataset", dataset::kGlbxMdp3},
+                                {"start_date", "2022-06-06"},
+                                {"end_date", "2022-06-10"},
+                                {"symbols", "ESM2,NQZ2"},
+                                {"stype_in", "raw_symbol"},
+                                {"stype_out", "instrument_id"},
+                            },
+                            ResolutionResp(kResult));
+  const auto port = mock_server_.ListenOnThread();
+
+  Historical target{logger_.get(), kApiKey, "localhost",
+                    static_cast<std::uint16_t>(port)};
+  CoalescingSymbologyResolver resolver{&target,
+                                       std::chrono::milliseconds{50}};
+  auto esm2_future =
+      resolver.Resolve(dataset::kGlbxMdp3, {"ESM2"}, SType::RawSymbol,
+                       SType::InstrumentId, {"2022-06-06", "2022-06-10"});
+  auto both_future = resolver.Resolve(
+      dataset::kGlbxMdp3, {"NQZ2", "ESM2"}, SType::RawSymbol,
+      SType::InstrumentId, {"2022-06-06", "2022-06-10"});
+  const auto esm2_res = esm2_future.get();
+  ASSERT_EQ(esm2_res.mappings.size(), 1);
+  EXPECT_EQ(esm2_res.mappings.at("ESM2").at(0).symbol, "3403");
+  EXPECT_TRUE(esm2_res.partial.empty());
+  EXPECT_TRUE(esm2_res.not_found.empty());
+  const auto both_res = both_future.get();
+  ASSERT_EQ(both_res.mappings.size(), 2);
+  EXPECT_EQ(both_res.mappings.at("ESM2").at(0).symbol, "3403");
+  EXPECT_EQ(both_res.mappings.at("NQZ2").at(0).symbol, "15921");
+}
+
+TEST_F(CoalescingSymbologyResolverTests, TestSeparateParamsArentMerged) {
+  const nlohmann::json kResult{{"ESM2",
+                                {{
+                                    {"d0", "2022-06-06"},
+                                    {"d1", "2022-06-10"},
+                                    {"s", "3403"},
+                                }}}};
+  mock_server_.MockPostJson("/v0/symbology.resolve",
+                            {
+                                {"dataset", dataset::kGlbxMdp3},
+                                {"start_date", "2022-06-06"},
+                                {"end_date", "2022-06-10"},
+                                {"symbols", "ESM2"},
+                                {"stype_in", "raw_symbol"},
+                                {"stype_out", "instrument_id"},
+                            },
+                            ResolutionResp(kResult));
+  const auto port = mock_server_.ListenOnThread();
+
+  Historical target{logger_.get(), kApiKey, "localhost",
+                    static_cast<std::uint16_t>(port)};
+  CoalescingSymbologyResolver resolver{&target,
+                                       std::chrono::milliseconds{10}};
+  auto matched_future =
+      resolver.Resolve(dataset::kGlbxMdp3, {"ESM2"}, SType::RawSymbol,
+                       SType::InstrumentId, {"2022-06-06", "2022-06-10"});
+  // A different date range forms its own batch, whose request the mock
+  // doesn't answer
+  auto unmatched_future =
+      resolver.Resolve(dataset::kGlbxMdp3, {"ESM2"}, SType::RawSymbol,
+                       SType::InstrumentId, {"2022-06-06", "2022-06-11"});
+  EXPECT_EQ(matched_future.get().mappings.at("ESM2").at(0).symbol, "3403");
+  EXPECT_THROW(unmatched_future.get(), Exception);
+}
+
+TEST_F(CoalescingSymbologyResolverTests, TestDestructorFlushesPending) {
+  const nlohmann::json kResult{{"ESM2",
+                                {{
+                                    {"d0", "2022-06-06"},
+                                    {"d1", "2022-06-10"},
+                                    {"s", "3403"},
+                                }}}};
+  mock_server_.MockPostJson("/v0/symbology.resolve",
+                            {
+                                {"dataset", dataset::kGlbxMdp3},
+                                {"start_date", "2022-06-06"},
+                                {"end_date", "2022-06-10"},
+                                {"symbols", "ESM2"},
+                                {"stype_in", "raw_symbol"},
+                                {"stype_out", "instrument_id"},
+                            },
+                            ResolutionResp(kResult));
+  const auto port = mock_server_.ListenOnThread();
+
+  Historical target{logger_.get(), kApiKey, "localhost",
+                    static_cast<std::uint16_t>(port)};
+  std::future<SymbologyResolution> future;
+  {
+    // A window far longer than the test: only the destructor flush can
+    // complete the future promptly
+    CoalescingSymbologyResolver resolver{&target,
+                                         std::chrono::milliseconds{60000}};
+    future = resolver.Resolve(dataset::kGlbxMdp3, {"ESM2"}, SType::RawSymbol,
+                              SType::InstrumentId,
+                              {"2022-06-06", "2022-06-10"});
+  }
+  ASSERT_EQ(future.wait_for(std::chrono::milliseconds{0}),
+            std::future_status::ready);
+  EXPECT_EQ(future.get().mappings.at("ESM2").at(0).symbol, "3403");
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>  // unique_ptr
+#include <vector>
+
+#include "databento/columnar.hpp"
+#include "databento/corpus_generator.hpp"
+#include "databento/datetime.hpp"
+#include "databento/dbn_decoder.hpp"
+#include "databento/detail/shared_channel.hpp"
+#include "databento/enums.hpp"
+#include "databento/ireadable.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+class ColumnarTests : public testing::Test {
+ protected:
+  // Returns a decoder over a generated fixed-schema stream with metadata
+  // already decoded.
+  static std::unique_ptr<DbnDecoder> MakeDecoder(Schema schema,
+                                                 std::size_t record_count) {
+    CorpusConfig config;
+    config.schema = schema;
+    config.record_count = record_count;
+    config.instrument_count = 4;
+    config.start = UnixNanos{std::chrono::nanoseconds{1'000'000}};
+    CorpusGenerator generator{config};
+    const auto bytes = generator.Generate();
+    detail::SharedChannel channel;
+    channel.Write(bytes.data(), bytes.size());
+    channel.Finish();
+    std::unique_ptr<DbnDecoder> decoder{new DbnDecoder{
+        std::unique_ptr<IReadable>{new detail::SharedChannel{channel}}}};
+    decoder->DecodeMetadata();
+    return decoder;
+  }
+};
+
+TEST_F(ColumnarTests, TestMboColumns) {
+  auto decoder = MakeDecoder(Schema::Mbo, 100);
+  auto reference = MakeDecoder(Schema::Mbo, 100);
+  MboColumns columns;
+  columns.Reserve(100);
+  ASSERT_EQ(DecodeColumns(decoder.get(), &columns), 100);
+  ASSERT_EQ(columns.Size(), 100);
+  for (std::size_t i = 0; i < columns.Size(); ++i) {
+    const auto* record = reference->DecodeRecord();
+    ASSERT_NE(record, nullptr);
+    const auto& mbo = record->Get<MboMsg>();
+    EXPECT_EQ(columns.ts_event[i], mbo.hd.ts_event.time_since_epoch().count());
+    EXPECT_EQ(columns.instrument_id[i], mbo.hd.instrument_id);
+    EXPECT_EQ(columns.order_id[i], mbo.order_id);
+    EXPECT_EQ(columns.price[i], mbo.price);
+    EXPECT_EQ(columns.size[i], mbo.size);
+    EXPECT_EQ(columns.action[i], static_cast<char>(mbo.action));
+    EXPECT_EQ(columns.side[i], static_cast<char>(mbo.side));
+    EXPECT_EQ(columns.sequence[i], mbo.sequence);
+  }
+  ASSERT_EQ(reference->DecodeRecord(), nullptr);
+  columns.Clear();
+  EXPECT_EQ(columns.Size(), 0);
+}
+
+TEST_F(ColumnarTests, TestTradeColumns) {
+  auto decoder = MakeDecoder(Schema::Trades, 50);
+  auto reference = MakeDecoder(Schema::Trades, 50);
+  TradeColumns columns;
+  ASSERT_EQ(DecodeColumns(decoder.get(), &columns), 50);
+  ASSERT_EQ(columns.Size(), 50);
+  for (std::size_t i = 0; i < columns.Size(); ++i) {
+    const auto* record = reference->DecodeRecord();
+    ASSERT_NE(record, nullptr);
+    const auto& trade = record->Get<TradeMsg>();
+    EXPECT_EQ(columns.ts_event[i],
+              trade.hd.ts_event.time_since_epoch().count());
+    EXPECT_EQ(columns.price[i], trade.price);
+    EXPECT_EQ(columns.size[i], trade.size);
+    EXPECT_EQ(columns.side[i], static_cast<char>(trade.side));
+    EXPECT_EQ(columns.depth[i], trade.depth);
+  }
+}
+
+TEST_F(ColumnarTests, TestAppendAcrossStreams) {
+  // Decoding into non-empty columns appends
+  auto first = MakeDecoder(Schema::Trades, 20);
+  auto second = MakeDecoder(Schema::Trades, 30);
+  TradeColumns columns;
+  ASSERT_EQ(DecodeColumns(first.get(), &columns), 20);
+  ASSERT_EQ(DecodeColumns(second.get(), &columns), 30);
+  EXPECT_EQ(columns.Size(), 50);
+  EXPECT_EQ(columns.price.size(), 50);
+  EXPECT_EQ(columns.sequence.size(), 50);
+}
+}  // namespace test
+}  // namespace databento
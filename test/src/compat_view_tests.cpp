@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <cstring>  // strncpy
+
+#include "databento/compat.hpp"
+#include "databento/compat_view.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+class CompatViewTests : public testing::Test {
+ protected:
+  static InstrumentDefMsgV1 DummyDefV1() {
+    InstrumentDefMsgV1 def{};
+    def.hd = {sizeof(InstrumentDefMsgV1) / RecordHeader::kLengthMultiplier,
+              RType::InstrumentDef, 1, 42, UnixNanos{}};
+    def.min_price_increment = 25;
+    def.strike_price = 1000;
+    def.maturity_year = 2026;
+    def.instrument_class = InstrumentClass::Future;
+    std::strncpy(def.raw_symbol.data(), "ESH6", def.raw_symbol.size() - 1);
+    return def;
+  }
+
+  static SymbolMappingMsgV1 DummyMappingV1() {
+    SymbolMappingMsgV1 mapping{};
+    mapping.hd = {sizeof(SymbolMappingMsgV1) / RecordHeader::kLengthMultiplier,
+                  RType::SymbolMapping, 1, 42, UnixNanos{}};
+    std::strncpy(mapping.stype_in_symbol.data(), "ESH6",
+                 mapping.stype_in_symbol.size() - 1);
+    std::strncpy(mapping.stype_out_symbol.data(), "5602",
+                 mapping.stype_out_symbol.size() - 1);
+    mapping.start_ts = UnixNanos{std::chrono::nanoseconds{10}};
+    mapping.end_ts = UnixNanos{std::chrono::nanoseconds{20}};
+    return mapping;
+  }
+};
+
+TEST_F(CompatViewTests, TestInstrumentDefViewOverV1) {
+  auto def = DummyDefV1();
+  const InstrumentDefView view{Record{&def.hd}};
+  EXPECT_EQ(view.Version(), 1);
+  EXPECT_EQ(view.Header().instrument_id, 42);
+  EXPECT_EQ(view.MinPriceIncrement(), 25);
+  EXPECT_EQ(view.StrikePrice(), 1000);
+  EXPECT_EQ(view.MaturityYear(), 2026);
+  EXPECT_EQ(view.Class(), InstrumentClass::Future);
+  EXPECT_STREQ(view.RawSymbol(), "ESH6");
+  // Materializing matches the eager upgrade
+  EXPECT_EQ(view.ToV2(), def.ToV2());
+}
+
+TEST_F(CompatViewTests, TestInstrumentDefViewOverV2) {
+  auto def = DummyDefV1().ToV2();
+  const InstrumentDefView view{Record{&def.hd}};
+  EXPECT_EQ(view.Version(), 2);
+  EXPECT_EQ(view.MinPriceIncrement(), 25);
+  EXPECT_EQ(view.StrikePrice(), 1000);
+  EXPECT_STREQ(view.RawSymbol(), "ESH6");
+  EXPECT_EQ(view.ToV2(), def);
+}
+
+TEST_F(CompatViewTests, TestInstrumentDefViewRejectsOtherRTypes) {
+  MboMsg mbo{};
+  mbo.hd = {sizeof(MboMsg) / RecordHeader::kLengthMultiplier, RType::Mbo, 1,
+            42, UnixNanos{}};
+  ASSERT_THROW(InstrumentDefView{Record{&mbo.hd}}, InvalidArgumentError);
+}
+
+TEST_F(CompatViewTests, TestSymbolMappingViewOverV1) {
+  auto mapping = DummyMappingV1();
+  const SymbolMappingView view{Record{&mapping.hd}};
+  EXPECT_EQ(view.Version(), 1);
+  EXPECT_STREQ(view.STypeInSymbol(), "ESH6");
+  EXPECT_STREQ(view.STypeOutSymbol(), "5602");
+  EXPECT_EQ(view.StartTs().time_since_epoch().count(), 10);
+  EXPECT_EQ(view.EndTs().time_since_epoch().count(), 20);
+  // v1 records carry no symbology types: the same sentinel as the upgrade
+  EXPECT_EQ(view.STypeIn(), mapping.ToV2().stype_in);
+  EXPECT_EQ(view.ToV2(), mapping.ToV2());
+}
+
+TEST_F(CompatViewTests, TestSymbolMappingViewOverV2) {
+  auto mapping = DummyMappingV1().ToV2();
+  mapping.stype_in = SType::RawSymbol;
+  mapping.stype_out = SType::InstrumentId;
+  const SymbolMappingView view{Record{&mapping.hd}};
+  EXPECT_EQ(view.Version(), 2);
+  EXPECT_EQ(view.STypeIn(), SType::RawSymbol);
+  EXPECT_EQ(view.STypeOut(), SType::InstrumentId);
+  EXPECT_STREQ(view.STypeInSymbol(), "ESH6");
+  EXPECT_EQ(view.ToV2(), mapping);
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+
+#include "databento/conflation_table.hpp"
+#include "databento/datetime.hpp"
+#include "databento/detail/scoped_thread.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+class ConflationTableTests : public testing::Test {
+ protected:
+  static MboMsg DummyMbo(std::uint32_t instrument_id, std::uint64_t order_id,
+                         std::uint32_t sequence) {
+    MboMsg rec{};
+    rec.hd = {sizeof(MboMsg) / RecordHeader::kLengthMultiplier, RType::Mbo, 1,
+              instrument_id, UnixNanos{}};
+    rec.order_id = order_id;
+    rec.sequence = sequence;
+    return rec;
+  }
+};
+
+TEST_F(ConflationTableTests, TestUpdateAndGetLatest) {
+  ConflationTable target{100, 8};
+  EXPECT_EQ(target.Size(), 8);
+  ConflatedRecord snapshot;
+  // Nothing stored yet
+  EXPECT_FALSE(target.GetLatest(100, &snapshot));
+  EXPECT_EQ(target.UpdateCount(100), 0);
+  auto rec = DummyMbo(100, 1, 1);
+  EXPECT_TRUE(target.Update(Record{&rec.hd}));
+  ASSERT_TRUE(target.GetLatest(100, &snapshot));
+  ASSERT_TRUE(snapshot.AsRecord().Holds<MboMsg>());
+  EXPECT_EQ(snapshot.AsRecord().Get<MboMsg>().sequence, 1);
+  // Later updates replace earlier ones
+  rec = DummyMbo(100, 2, 2);
+  EXPECT_TRUE(target.Update(Record{&rec.hd}));
+  rec = DummyMbo(100, 3, 3);
+  EXPECT_TRUE(target.Update(Record{&rec.hd}));
+  ASSERT_TRUE(target.GetLatest(100, &snapshot));
+  EXPECT_EQ(snapshot.AsRecord().Get<MboMsg>().sequence, 3);
+  EXPECT_EQ(target.UpdateCount(100), 3);
+  // Other instruments are unaffected
+  EXPECT_FALSE(target.GetLatest(101, &snapshot));
+}
+
+TEST_F(ConflationTableTests, TestOutOfWindow) {
+  ConflationTable target{100, 8};
+  ConflatedRecord snapshot;
+  auto below = DummyMbo(99, 1, 1);
+  EXPECT_FALSE(target.Update(Record{&below.hd}));
+  auto above = DummyMbo(108, 1, 1);
+  EXPECT_FALSE(target.Update(Record{&above.hd}));
+  EXPECT_FALSE(target.GetLatest(99, &snapshot));
+  EXPECT_FALSE(target.GetLatest(108, &snapshot));
+  EXPECT_EQ(target.UpdateCount(108), 0);
+}
+
+TEST_F(ConflationTableTests, TestOversizedRecordRejected) {
+  ConflationTable target{100, 8};
+  auto rec = DummyMbo(100, 1, 1);
+  // A corrupt length byte claiming more than kMaxRecordLen bytes must not
+  // be copied into the slot
+  rec.hd.length = 255;
+  EXPECT_FALSE(target.Update(Record{&rec.hd}));
+  ConflatedRecord snapshot;
+  EXPECT_FALSE(target.GetLatest(100, &snapshot));
+}
+
+TEST_F(ConflationTableTests, TestConcurrentReaders) {
+  constexpr std::uint32_t kUpdates = 100000;
+  ConflationTable target{1, 4};
+  std::atomic<bool> done{false};
+  std::atomic<std::uint32_t> torn_reads{0};
+  auto read_loop = [&target, &done, &torn_reads]() {
+    ConflatedRecord snapshot;
+    std::uint32_t last_seen = 0;
+    while (!done.load()) {
+      if (!target.GetLatest(2, &snapshot)) {
+        continue;
+      }
+      const auto& mbo = snapshot.AsRecord().Get<MboMsg>();
+      // The writer keeps order_id == sequence, so any disagreement is a
+      // torn read
+      if (mbo.order_id != mbo.sequence) {
+        ++torn_reads;
+      }
+      // Updates are observed monotonically
+      if (mbo.sequence < last_seen) {
+        ++torn_reads;
+      }
+      last_seen = mbo.sequence;
+    }
+  };
+  {
+    const detail::ScopedThread reader_a{read_loop};
+    const detail::ScopedThread reader_b{read_loop};
+    for (std::uint32_t i = 1; i <= kUpdates; ++i) {
+      auto rec = DummyMbo(2, i, i);
+      target.Update(Record{&rec.hd});
+    }
+    done = true;
+  }
+  EXPECT_EQ(torn_reads, 0);
+  EXPECT_EQ(target.UpdateCount(2), kUpdates);
+}
+
+TEST_F(ConflationTableTests, TestInvalidInstrumentCount) {
+  EXPECT_THROW(ConflationTable(0, 0), InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
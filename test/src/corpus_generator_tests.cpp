@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>  // min
+#include <cstddef>    // size_t
+#include <cstdint>
+#include <cstring>  // memcpy
+#include <memory>   // unique_ptr
+#include <vector>
+
+#include "databento/corpus_generator.hpp"
+#include "databento/dbn_decoder.hpp"
+#include "databento/enums.hpp"
+#include "databento/exceptions.hpp"  // InvalidArgumentError
+#include "databento/ireadable.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+namespace {
+// Reads back an encoded corpus from memory.
+class VectorReadable : public IReadable {
+ public:
+  explicit VectorReadable(const std::vector<std::uint8_t>* buffer)
+      : buffer_{buffer} {}
+
+  void ReadExact(std::uint8_t* buffer, std::size_t length) override {
+    ASSERT_LE(pos_ + length, buffer_->size());
+    std::memcpy(buffer, &(*buffer_)[pos_], length);
+    pos_ += length;
+  }
+
+  std::size_t ReadSome(std::uint8_t* buffer, std::size_t length) override {
+    const auto read_size = std::min(length, buffer_->size() - pos_);
+    std::memcpy(buffer, &(*buffer_)[pos_], read_size);
+    pos_ += read_size;
+    return read_size;
+  }
+
+ private:
+  const std::vector<std::uint8_t>* buffer_;
+  std::size_t pos_{};
+};
+
+std::vector<MboMsg> DecodeMboCorpus(const std::vector<std::uint8_t>& corpus) {
+  DbnDecoder decoder{
+      std::unique_ptr<IReadable>{new VectorReadable{&corpus}}};
+  decoder.DecodeMetadata();
+  std::vector<MboMsg> records;
+  while (const auto* record = decoder.DecodeRecord()) {
+    records.emplace_back(record->Get<MboMsg>());
+  }
+  return records;
+}
+}  // namespace
+
+TEST(CorpusGeneratorTests, TestDeterminism) {
+  CorpusConfig config;
+  config.record_count = 500;
+  CorpusGenerator generator{config};
+  const auto first = generator.Generate();
+  const auto second = generator.Generate();
+  ASSERT_FALSE(first.empty());
+  ASSERT_EQ(first, second);
+  config.seed = 1;
+  CorpusGenerator reseeded{config};
+  ASSERT_NE(first, reseeded.Generate());
+}
+
+TEST(CorpusGeneratorTests, TestDecodeRoundTrip) {
+  CorpusConfig config;
+  config.record_count = 500;
+  config.instrument_count = 10;
+  CorpusGenerator generator{config};
+  const auto corpus = generator.Generate();
+  DbnDecoder decoder{
+      std::unique_ptr<IReadable>{new VectorReadable{&corpus}}};
+  const auto metadata = decoder.DecodeMetadata();
+  ASSERT_EQ(metadata.schema, Schema::Mbo);
+  std::size_t count = 0;
+  while (const auto* record = decoder.DecodeRecord()) {
+    ASSERT_TRUE(record->Holds<MboMsg>());
+    const auto& mbo = record->Get<MboMsg>();
+    ASSERT_GE(mbo.hd.instrument_id, 1U);
+    ASSERT_LE(mbo.hd.instrument_id, config.instrument_count);
+    ASSERT_GT(mbo.price, 0);
+    ++count;
+  }
+  ASSERT_EQ(count, config.record_count);
+}
+
+TEST(CorpusGeneratorTests, TestAllSupportedSchemas) {
+  for (const auto schema :
+       {Schema::Mbo, Schema::Trades, Schema::Mbp1, Schema::Mbp10,
+        Schema::Ohlcv1S}) {
+    CorpusConfig config;
+    config.schema = schema;
+    config.record_count = 100;
+    CorpusGenerator generator{config};
+    const auto corpus = generator.Generate();
+    DbnDecoder decoder{
+        std::unique_ptr<IReadable>{new VectorReadable{&corpus}}};
+    decoder.DecodeMetadata();
+    std::size_t count = 0;
+    while (decoder.DecodeRecord() != nullptr) {
+      ++count;
+    }
+    ASSERT_EQ(count, config.record_count) << "schema " << ToString(schema);
+  }
+}
+
+TEST(CorpusGeneratorTests, TestBurstiness) {
+  CorpusConfig config;
+  config.record_count = 100;
+  config.burst_size = 4;
+  config.intra_burst_gap_ns = 1000;
+  config.inter_burst_gap_ns = 1000000;
+  CorpusGenerator generator{config};
+  const auto records = DecodeMboCorpus(generator.Generate());
+  ASSERT_EQ(records.size(), config.record_count);
+  for (std::size_t i = 1; i < records.size(); ++i) {
+    const auto gap =
+        (records[i].hd.ts_event - records[i - 1].hd.ts_event).count();
+    if (i % config.burst_size == 0) {
+      ASSERT_EQ(gap, config.inter_burst_gap_ns) << "record " << i;
+    } else {
+      ASSERT_EQ(gap, config.intra_burst_gap_ns) << "record " << i;
+    }
+  }
+}
+
+TEST(CorpusGeneratorTests, TestSkewedInstrumentDistribution) {
+  CorpusConfig config;
+  config.record_count = 2000;
+  config.instrument_count = 100;
+  config.instrument_distribution = InstrumentDistribution::Skewed;
+  CorpusGenerator generator{config};
+  const auto records = DecodeMboCorpus(generator.Generate());
+  // The minimum of two uniform draws lands in the lower half three quarters
+  // of the time
+  std::size_t low_half = 0;
+  for (const auto& record : records) {
+    if (record.hd.instrument_id <= config.instrument_count / 2) {
+      ++low_half;
+    }
+  }
+  ASSERT_GT(low_half, records.size() * 6 / 10);
+}
+
+TEST(CorpusGeneratorTests, TestUnsupportedSchema) {
+  CorpusConfig config;
+  config.schema = Schema::Definition;
+  CorpusGenerator generator{config};
+  ASSERT_THROW(generator.Generate(), InvalidArgumentError);
+}
+
+TEST(CorpusGeneratorTests, TestInvalidConfig) {
+  CorpusConfig config;
+  config.instrument_count = 0;
+  ASSERT_THROW(CorpusGenerator{config}, InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
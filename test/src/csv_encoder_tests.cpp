@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "databento/csv_encoder.hpp"
+#include "databento/datetime.hpp"
+#include "databento/enums.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/iwritable.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+namespace {
+class StringWritable : public IWritable {
+ public:
+  void WriteAll(const std::uint8_t* buffer, std::size_t length) override {
+    contents_.append(reinterpret_cast<const char*>(buffer), length);
+    ++write_count_;
+  }
+
+  const std::string& Contents() const { return contents_; }
+  std::size_t WriteCount() const { return write_count_; }
+
+ private:
+  std::string contents_;
+  std::size_t write_count_{};
+};
+
+MboMsg MakeMboMsg() {
+  MboMsg res{};
+  res.hd = RecordHeader{
+      sizeof(MboMsg) / RecordHeader::kLengthMultiplier, RType::Mbo, 1, 5482,
+      UnixNanos{std::chrono::nanoseconds{1609160400000429831}}};
+  res.order_id = 647784973705;
+  res.price = 3722750000000;
+  res.size = 2;
+  res.flags = FlagSet{128};
+  res.channel_id = 0;
+  res.action = Action::Add;
+  res.side = Side::Bid;
+  res.ts_recv = UnixNanos{std::chrono::nanoseconds{1609160400000704060}};
+  res.ts_in_delta = TimeDeltaNanos{22969};
+  res.sequence = 1170352;
+  return res;
+}
+}  // namespace
+
+TEST(CsvEncoderTests, TestEncodeMboMsg) {
+  StringWritable writable;
+  {
+    CsvEncoder target{&writable, false, false};
+    target.WriteHeader(Schema::Mbo);
+    target.EncodeRecord(MakeMboMsg());
+  }
+  ASSERT_EQ(writable.Contents(),
+            "ts_recv,ts_event,rtype,publisher_id,instrument_id,action,side,"
+            "price,size,channel_id,order_id,flags,ts_in_delta,sequence\n"
+            "1609160400000704060,1609160400000429831,160,1,5482,A,B,"
+            "3722750000000,2,0,647784973705,128,22969,1170352\n");
+}
+
+TEST(CsvEncoderTests, TestEncodePretty) {
+  StringWritable writable;
+  {
+    CsvEncoder target{&writable, true, true};
+    target.EncodeRecord(MakeMboMsg());
+  }
+  EXPECT_EQ(writable.Contents().find("2020-12-28T13:00:00.000704060Z,"), 0);
+  EXPECT_NE(writable.Contents().find(",3722.750000000,"), std::string::npos);
+}
+
+TEST(CsvEncoderTests, TestEncodeMbp1ThroughRecord) {
+  StringWritable writable;
+  Mbp1Msg record{};
+  record.hd = RecordHeader{sizeof(Mbp1Msg) / RecordHeader::kLengthMultiplier,
+                           RType::Mbp1, 1, 5482, UnixNanos{}};
+  record.price = 10;
+  record.size = 3;
+  record.action = Action::Trade;
+  record.side = Side::Ask;
+  record.depth = 0;
+  record.ts_in_delta = TimeDeltaNanos{-5};
+  record.sequence = 7;
+  record.levels[0] = BidAskPair{8, 12, 100, 200, 1, 2};
+  {
+    CsvEncoder target{&writable, false, false};
+    target.EncodeRecord(Record{&record.hd});
+  }
+  ASSERT_EQ(writable.Contents(),
+            "0,0,1,1,5482,T,A,0,10,3,0,-5,7,8,12,100,200,1,2\n");
+}
+
+TEST(CsvEncoderTests, TestMbp10HeaderColumns) {
+  StringWritable writable;
+  {
+    CsvEncoder target{&writable, false, false};
+    target.WriteHeader(Schema::Mbp10);
+  }
+  std::size_t column_count = 1;
+  for (const char c : writable.Contents()) {
+    column_count += c == ',';
+  }
+  // 13 body columns plus 6 per level
+  EXPECT_EQ(column_count, 13 + 10 * 6);
+  EXPECT_NE(writable.Contents().find("bid_px_00"), std::string::npos);
+  EXPECT_NE(writable.Contents().find("ask_ct_09"), std::string::npos);
+}
+
+TEST(CsvEncoderTests, TestBatchedFlushing) {
+  StringWritable writable;
+  {
+    CsvEncoder target{&writable, false, false, 8192};
+    for (std::size_t i = 0; i < 1000; ++i) {
+      target.EncodeRecord(MakeMboMsg());
+    }
+  }
+  // Rows should be flushed in batches, not per record
+  EXPECT_GT(writable.WriteCount(), 1);
+  EXPECT_LT(writable.WriteCount(), 1000);
+  std::size_t row_count = 0;
+  for (const char c : writable.Contents()) {
+    row_count += c == '\n';
+  }
+  EXPECT_EQ(row_count, 1000);
+}
+
+TEST(CsvEncoderTests, TestUnsupported) {
+  StringWritable writable;
+  CsvEncoder target{&writable, false, false};
+  EXPECT_THROW(target.WriteHeader(Schema::Definition), InvalidArgumentError);
+  ErrorMsg error{};
+  error.hd = RecordHeader{sizeof(ErrorMsg) / RecordHeader::kLengthMultiplier,
+                          RType::Error, 0, 0, UnixNanos{}};
+  EXPECT_THROW(target.EncodeRecord(Record{&error.hd}), InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
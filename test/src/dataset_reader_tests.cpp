@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>  // mkdir
+
+#include <cstdio>   // remove
+#include <fstream>  // ofstream
+#include <string>
+#include <vector>
+
+#include "databento/corpus_generator.hpp"
+#include "databento/dataset_reader.hpp"
+#include "databento/datetime.hpp"
+#include "databento/enums.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+// Creates a directory tree of generated DBN files and removes it on
+// destruction.
+class DatasetReaderTests : public testing::Test {
+ protected:
+  static constexpr auto kRootDir = TEST_BUILD_DIR "/dataset_reader_test_data";
+
+  void SetUp() override {
+    MakeDir(kRootDir);
+    MakeDir(std::string{kRootDir} + "/2024-01-01");
+    MakeDir(std::string{kRootDir} + "/2024-01-02");
+  }
+
+  void TearDown() override {
+    for (auto it = file_paths_.rbegin(); it != file_paths_.rend(); ++it) {
+      std::remove(it->c_str());
+    }
+    std::remove((std::string{kRootDir} + "/2024-01-01").c_str());
+    std::remove((std::string{kRootDir} + "/2024-01-02").c_str());
+    std::remove(kRootDir);
+  }
+
+  static void MakeDir(const std::string& path) {
+#ifdef _WIN32
+    ::_mkdir(path.c_str());
+#else
+    ::mkdir(path.c_str(), 0777);
+#endif
+  }
+
+  void WriteCorpusFile(const std::string& rel_path, Schema schema,
+                       std::uint64_t start_ns, std::size_t record_count) {
+    CorpusConfig config;
+    config.schema = schema;
+    config.record_count = record_count;
+    config.instrument_count = 4;
+    config.start = UnixNanos{std::chrono::nanoseconds{start_ns}};
+    CorpusGenerator generator{config};
+    const auto bytes = generator.Generate();
+    const auto path = std::string{kRootDir} + '/' + rel_path;
+    std::ofstream stream{path, std::ios::binary};
+    stream.write(reinterpret_cast<const char*>(bytes.data()),
+                 static_cast<std::streamsize>(bytes.size()));
+    file_paths_.emplace_back(path);
+  }
+
+  std::vector<std::string> file_paths_;
+};
+
+TEST_F(DatasetReaderTests, TestDiscoveryAndConcatenatedReplay) {
+  WriteCorpusFile("2024-01-01/mbo.dbn", Schema::Mbo, 1000000, 100);
+  WriteCorpusFile("2024-01-02/mbo.dbn", Schema::Mbo, 2000000000000, 150);
+  // Non-DBN files are ignored
+  const auto stray_path = std::string{kRootDir} + "/2024-01-01/notes.txt";
+  std::ofstream{stray_path} << "not a DBN file";
+  file_paths_.emplace_back(stray_path);
+  DatasetReader target{kRootDir};
+  ASSERT_EQ(target.FilePaths().size(), 2);
+  EXPECT_EQ(target.FilePaths()[0],
+            std::string{kRootDir} + "/2024-01-01/mbo.dbn");
+  std::size_t metadata_count{};
+  std::size_t record_count{};
+  UnixNanos prev_ts{};
+  target.ReplayConcatenated(
+      [&metadata_count](Metadata&&) { ++metadata_count; },
+      [&record_count, &prev_ts](const Record& record) {
+        // Files are date-ordered, so the concatenation is time-ordered
+        EXPECT_GE(record.Header().ts_event, prev_ts);
+        prev_ts = record.Header().ts_event;
+        ++record_count;
+        return KeepGoing::Continue;
+      });
+  EXPECT_EQ(metadata_count, 2);
+  EXPECT_EQ(record_count, 250);
+}
+
+TEST_F(DatasetReaderTests, TestMergedReplay) {
+  // Overlapping time ranges, so merging must interleave the files
+  WriteCorpusFile("2024-01-01/mbo.dbn", Schema::Mbo, 1000000, 100);
+  WriteCorpusFile("2024-01-02/mbo.dbn", Schema::Mbo, 1500000, 150);
+  DatasetReader target{kRootDir, VersionUpgradePolicy::Upgrade, 2};
+  std::size_t record_count{};
+  UnixNanos prev_ts{};
+  target.ReplayMerged([&record_count, &prev_ts](const Record& record) {
+    EXPECT_GE(record.Header().ts_event, prev_ts);
+    prev_ts = record.Header().ts_event;
+    ++record_count;
+    return KeepGoing::Continue;
+  });
+  EXPECT_EQ(record_count, 250);
+}
+
+TEST_F(DatasetReaderTests, TestStop) {
+  WriteCorpusFile("2024-01-01/mbo.dbn", Schema::Mbo, 1000000, 100);
+  WriteCorpusFile("2024-01-02/mbo.dbn", Schema::Mbo, 2000000000000, 150);
+  DatasetReader target{kRootDir};
+  std::size_t record_count{};
+  target.ReplayConcatenated([&record_count](const Record&) {
+    ++record_count;
+    return KeepGoing::Stop;
+  });
+  EXPECT_EQ(record_count, 1);
+}
+
+TEST_F(DatasetReaderTests, TestMismatchedSchema) {
+  WriteCorpusFile("2024-01-01/mbo.dbn", Schema::Mbo, 1000000, 10);
+  WriteCorpusFile("2024-01-01/trades.dbn", Schema::Trades, 1000000, 10);
+  ASSERT_THROW(DatasetReader{kRootDir}, InvalidArgumentError);
+}
+
+TEST_F(DatasetReaderTests, TestEmptyDirectory) {
+  ASSERT_THROW(DatasetReader{kRootDir}, InvalidArgumentError);
+}
+
+TEST_F(DatasetReaderTests, TestNonExistentDirectory) {
+  ASSERT_THROW(DatasetReader{TEST_BUILD_DIR "/no_such_dir"},
+               InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <array>
+#include <chrono>
+
+#include "databento/constants.hpp"
 #include "databento/datetime.hpp"
+#include "databento/exceptions.hpp"
 
 namespace databento {
 namespace test {
@@ -11,5 +16,62 @@ TEST(DateFromIso8601IntTests, TestValid) {
 TEST(DateFromIso8601IntTests, TestPadding) {
   ASSERT_EQ(databento::DateFromIso8601Int(20190801), "2019-08-01");
 }
+
+TEST(ToIso8601Tests, TestValid) {
+  EXPECT_EQ(ToIso8601(UnixNanos{}), "1970-01-01T00:00:00.000000000Z");
+  EXPECT_EQ(ToIso8601(UnixNanos{std::chrono::nanoseconds{
+                1633305600000000000ULL}}),
+            "2021-10-04T00:00:00.000000000Z");
+  EXPECT_EQ(ToIso8601(UnixNanos{std::chrono::nanoseconds{
+                1583504967251000000ULL}}),
+            "2020-03-06T14:29:27.251000000Z");
+  // Leap day
+  EXPECT_EQ(ToIso8601(UnixNanos{std::chrono::nanoseconds{
+                1582934400123456789ULL}}),
+            "2020-02-29T00:00:00.123456789Z");
+  EXPECT_EQ(ToIso8601(UnixNanos{std::chrono::nanoseconds{kUndefTimestamp}}),
+            "UNDEF_TIMESTAMP");
+}
+
+TEST(ToIso8601Tests, TestBufferTooSmall) {
+  std::array<char, 10> buffer;
+  EXPECT_EQ(
+      ToIso8601Chars(UnixNanos{}, buffer.data(), buffer.data() + buffer.size()),
+      nullptr);
+}
+
+TEST(FromIso8601Tests, TestRoundTrip) {
+  for (const auto raw :
+       {0ULL, 1633305600000000000ULL, 1583504967251000000ULL,
+        1582934400123456789ULL}) {
+    const UnixNanos ts{std::chrono::nanoseconds{raw}};
+    EXPECT_EQ(FromIso8601(ToIso8601(ts)), ts);
+  }
+}
+
+TEST(FromIso8601Tests, TestPartialTimestamps) {
+  EXPECT_EQ(FromIso8601("1970-01-01").time_since_epoch().count(), 0);
+  EXPECT_EQ(FromIso8601("2021-10-04").time_since_epoch().count(),
+            1633305600000000000ULL);
+  // 'T' and ' ' separators, with and without 'Z' and fractional seconds
+  EXPECT_EQ(FromIso8601("2020-03-06T14:29:27").time_since_epoch().count(),
+            1583504967000000000ULL);
+  EXPECT_EQ(FromIso8601("2020-03-06 14:29:27Z").time_since_epoch().count(),
+            1583504967000000000ULL);
+  // Fractional seconds shorter than nanosecond precision are right-padded
+  EXPECT_EQ(FromIso8601("2020-03-06T14:29:27.251").time_since_epoch().count(),
+            1583504967251000000ULL);
+}
+
+TEST(FromIso8601Tests, TestInvalid) {
+  EXPECT_THROW(FromIso8601(""), InvalidArgumentError);
+  EXPECT_THROW(FromIso8601("20211004"), InvalidArgumentError);
+  EXPECT_THROW(FromIso8601("2021-13-04"), InvalidArgumentError);
+  EXPECT_THROW(FromIso8601("2021-02-30"), InvalidArgumentError);
+  EXPECT_THROW(FromIso8601("2021-10-04T25:00:00"), InvalidArgumentError);
+  EXPECT_THROW(FromIso8601("2021-10-04T00:00:00."), InvalidArgumentError);
+  EXPECT_THROW(FromIso8601("2021-10-04T00:00:00Zx"), InvalidArgumentError);
+  EXPECT_THROW(FromIso8601("1969-12-31"), InvalidArgumentError);
+}
 }  // namespace test
 }  // namespace databento
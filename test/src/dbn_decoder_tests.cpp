@@ -13,6 +13,7 @@
 #include "databento/datetime.hpp"
 #include "databento/dbn.hpp"
 #include "databento/dbn_decoder.hpp"
+#include "databento/detail/buffer_channel.hpp"
 #include "databento/detail/file_stream.hpp"
 #include "databento/detail/scoped_thread.hpp"
 #include "databento/detail/shared_channel.hpp"
@@ -21,6 +22,7 @@
 #include "databento/ireadable.hpp"
 #include "databento/record.hpp"
 #include "databento/with_ts_out.hpp"
+#include "temp_file.hpp"
 
 namespace databento {
 namespace test {
@@ -116,7 +118,7 @@ TEST_F(DbnDecoderTests, TestDecodeDefinitionUpgrade) {
   EXPECT_EQ(ch_metadata.limit, 2);
   EXPECT_EQ(ch_metadata.stype_in, SType::RawSymbol);
   EXPECT_EQ(ch_metadata.stype_out, SType::InstrumentId);
-  EXPECT_EQ(ch_metadata.symbols, std::vector<std::string>{"MSFT"});
+  EXPECT_EQ(ch_metadata.symbols, std::vector<SymbolString>{"MSFT"});
   EXPECT_TRUE(ch_metadata.partial.empty());
   EXPECT_TRUE(ch_metadata.not_found.empty());
   EXPECT_EQ(ch_metadata.mappings.size(), 1);
@@ -232,7 +234,7 @@ TEST_P(DbnDecoderSchemaTests, TestDecodeMbo) {
   EXPECT_EQ(ch_metadata.limit, 2);
   EXPECT_EQ(ch_metadata.stype_in, SType::RawSymbol);
   EXPECT_EQ(ch_metadata.stype_out, SType::InstrumentId);
-  EXPECT_EQ(ch_metadata.symbols, std::vector<std::string>{"ESH1"});
+  EXPECT_EQ(ch_metadata.symbols, std::vector<SymbolString>{"ESH1"});
   EXPECT_TRUE(ch_metadata.partial.empty());
   EXPECT_TRUE(ch_metadata.not_found.empty());
 
@@ -301,7 +303,7 @@ TEST_P(DbnDecoderSchemaTests, TestDecodeMbp1) {
   EXPECT_EQ(ch_metadata.limit, 2);
   EXPECT_EQ(ch_metadata.stype_in, SType::RawSymbol);
   EXPECT_EQ(ch_metadata.stype_out, SType::InstrumentId);
-  EXPECT_EQ(ch_metadata.symbols, std::vector<std::string>{"ESH1"});
+  EXPECT_EQ(ch_metadata.symbols, std::vector<SymbolString>{"ESH1"});
   EXPECT_TRUE(ch_metadata.partial.empty());
   EXPECT_TRUE(ch_metadata.not_found.empty());
   AssertMappings(ch_metadata.mappings);
@@ -381,7 +383,7 @@ TEST_P(DbnDecoderSchemaTests, TestDecodeMbp10) {
   EXPECT_EQ(ch_metadata.limit, 2);
   EXPECT_EQ(ch_metadata.stype_in, SType::RawSymbol);
   EXPECT_EQ(ch_metadata.stype_out, SType::InstrumentId);
-  EXPECT_EQ(ch_metadata.symbols, std::vector<std::string>{"ESH1"});
+  EXPECT_EQ(ch_metadata.symbols, std::vector<SymbolString>{"ESH1"});
   EXPECT_TRUE(ch_metadata.partial.empty());
   EXPECT_TRUE(ch_metadata.not_found.empty());
   AssertMappings(ch_metadata.mappings);
@@ -485,7 +487,7 @@ TEST_P(DbnDecoderSchemaTests, TestDecodeTbbo) {
   EXPECT_EQ(ch_metadata.limit, 2);
   EXPECT_EQ(ch_metadata.stype_in, SType::RawSymbol);
   EXPECT_EQ(ch_metadata.stype_out, SType::InstrumentId);
-  EXPECT_EQ(ch_metadata.symbols, std::vector<std::string>{"ESH1"});
+  EXPECT_EQ(ch_metadata.symbols, std::vector<SymbolString>{"ESH1"});
   EXPECT_TRUE(ch_metadata.partial.empty());
   EXPECT_TRUE(ch_metadata.not_found.empty());
   AssertMappings(ch_metadata.mappings);
@@ -565,7 +567,7 @@ TEST_P(DbnDecoderSchemaTests, TestDecodeTrades) {
   EXPECT_EQ(ch_metadata.limit, 2);
   EXPECT_EQ(ch_metadata.stype_in, SType::RawSymbol);
   EXPECT_EQ(ch_metadata.stype_out, SType::InstrumentId);
-  EXPECT_EQ(ch_metadata.symbols, std::vector<std::string>{"ESH1"});
+  EXPECT_EQ(ch_metadata.symbols, std::vector<SymbolString>{"ESH1"});
   EXPECT_TRUE(ch_metadata.partial.empty());
   EXPECT_TRUE(ch_metadata.not_found.empty());
   AssertMappings(ch_metadata.mappings);
@@ -633,7 +635,7 @@ TEST_P(DbnDecoderSchemaTests, TestDecodeOhlcv1D) {
   EXPECT_EQ(ch_metadata.limit, 2);
   EXPECT_EQ(ch_metadata.stype_in, SType::RawSymbol);
   EXPECT_EQ(ch_metadata.stype_out, SType::InstrumentId);
-  EXPECT_EQ(ch_metadata.symbols, std::vector<std::string>{"ESH1"});
+  EXPECT_EQ(ch_metadata.symbols, std::vector<SymbolString>{"ESH1"});
   EXPECT_TRUE(ch_metadata.partial.empty());
   EXPECT_TRUE(ch_metadata.not_found.empty());
   AssertMappings(ch_metadata.mappings);
@@ -655,7 +657,7 @@ TEST_P(DbnDecoderSchemaTests, TestDecodeOhlcv1H) {
   EXPECT_EQ(ch_metadata.limit, 2);
   EXPECT_EQ(ch_metadata.stype_in, SType::RawSymbol);
   EXPECT_EQ(ch_metadata.stype_out, SType::InstrumentId);
-  EXPECT_EQ(ch_metadata.symbols, std::vector<std::string>{"ESH1"});
+  EXPECT_EQ(ch_metadata.symbols, std::vector<SymbolString>{"ESH1"});
   EXPECT_TRUE(ch_metadata.partial.empty());
   EXPECT_TRUE(ch_metadata.not_found.empty());
   AssertMappings(ch_metadata.mappings);
@@ -715,7 +717,7 @@ TEST_P(DbnDecoderSchemaTests, TestDecodeOhlcv1M) {
   EXPECT_EQ(ch_metadata.limit, 2);
   EXPECT_EQ(ch_metadata.stype_in, SType::RawSymbol);
   EXPECT_EQ(ch_metadata.stype_out, SType::InstrumentId);
-  EXPECT_EQ(ch_metadata.symbols, std::vector<std::string>{"ESH1"});
+  EXPECT_EQ(ch_metadata.symbols, std::vector<SymbolString>{"ESH1"});
   EXPECT_TRUE(ch_metadata.partial.empty());
   EXPECT_TRUE(ch_metadata.not_found.empty());
   AssertMappings(ch_metadata.mappings);
@@ -775,7 +777,7 @@ TEST_P(DbnDecoderSchemaTests, TestDecodeOhlcv1S) {
   EXPECT_EQ(ch_metadata.limit, 2);
   EXPECT_EQ(ch_metadata.stype_in, SType::RawSymbol);
   EXPECT_EQ(ch_metadata.stype_out, SType::InstrumentId);
-  EXPECT_EQ(ch_metadata.symbols, std::vector<std::string>{"ESH1"});
+  EXPECT_EQ(ch_metadata.symbols, std::vector<SymbolString>{"ESH1"});
   EXPECT_TRUE(ch_metadata.partial.empty());
   EXPECT_TRUE(ch_metadata.not_found.empty());
   AssertMappings(ch_metadata.mappings);
@@ -835,7 +837,7 @@ TEST_P(DbnDecoderSchemaTests, TestDecodeDefinition) {
   EXPECT_EQ(ch_metadata.limit, 2);
   EXPECT_EQ(ch_metadata.stype_in, SType::RawSymbol);
   EXPECT_EQ(ch_metadata.stype_out, SType::InstrumentId);
-  EXPECT_EQ(ch_metadata.symbols, std::vector<std::string>{"MSFT"});
+  EXPECT_EQ(ch_metadata.symbols, std::vector<SymbolString>{"MSFT"});
   EXPECT_TRUE(ch_metadata.partial.empty());
   EXPECT_TRUE(ch_metadata.not_found.empty());
   EXPECT_EQ(ch_metadata.mappings.size(), 1);
@@ -881,7 +883,7 @@ TEST_P(DbnDecoderSchemaTests, TestDecodeImbalance) {
   EXPECT_EQ(ch_metadata.limit, 2);
   EXPECT_EQ(ch_metadata.stype_in, SType::RawSymbol);
   EXPECT_EQ(ch_metadata.stype_out, SType::InstrumentId);
-  EXPECT_EQ(ch_metadata.symbols, std::vector<std::string>{"SPOT"});
+  EXPECT_EQ(ch_metadata.symbols, std::vector<SymbolString>{"SPOT"});
   EXPECT_TRUE(ch_metadata.partial.empty());
   EXPECT_TRUE(ch_metadata.not_found.empty());
   EXPECT_EQ(ch_metadata.mappings.size(), 1);
@@ -954,5 +956,361 @@ TEST_P(DbnDecoderSchemaTests, TestDecodeStatistics) {
   EXPECT_EQ(ch_stat2.stat_type, StatType::TradingSessionHighPrice);
   EXPECT_EQ(ch_stat2.price, 100 * kFixedPriceScale);
 }
+
+TEST_F(DbnDecoderTests, TestDecodeArenaMetadata) {
+  ReadFromFile("mbo", ".dbn", 2);
+
+  const Metadata f_metadata = file_target_->DecodeMetadata();
+  const ArenaMetadata ch_metadata = channel_target_->DecodeArenaMetadata();
+  EXPECT_EQ(ch_metadata.version, f_metadata.version);
+  EXPECT_EQ(ch_metadata.dataset, f_metadata.dataset);
+  EXPECT_EQ(ch_metadata.schema, f_metadata.schema);
+  EXPECT_EQ(ch_metadata.start, f_metadata.start);
+  EXPECT_EQ(ch_metadata.end, f_metadata.end);
+  EXPECT_EQ(ch_metadata.stype_in, f_metadata.stype_in);
+  EXPECT_EQ(ch_metadata.stype_out, f_metadata.stype_out);
+  EXPECT_EQ(ch_metadata.symbol_cstr_len, f_metadata.symbol_cstr_len);
+  ASSERT_EQ(ch_metadata.symbols.size(), f_metadata.symbols.size());
+  for (std::size_t i = 0; i < f_metadata.symbols.size(); ++i) {
+    EXPECT_STREQ(ch_metadata.symbols[i], f_metadata.symbols[i].c_str());
+  }
+  ASSERT_EQ(ch_metadata.mappings.size(), f_metadata.mappings.size());
+  for (std::size_t i = 0; i < f_metadata.mappings.size(); ++i) {
+    const auto& arena_mapping = ch_metadata.mappings[i];
+    const auto& mapping = f_metadata.mappings[i];
+    EXPECT_STREQ(arena_mapping.raw_symbol, mapping.raw_symbol.c_str());
+    ASSERT_EQ(arena_mapping.interval_count, mapping.intervals.size());
+    for (std::uint32_t j = 0; j < arena_mapping.interval_count; ++j) {
+      const auto& arena_interval =
+          ch_metadata.intervals[arena_mapping.interval_begin + j];
+      const auto& interval = mapping.intervals[j];
+      EXPECT_EQ(arena_interval.start_date, interval.start_date);
+      EXPECT_EQ(arena_interval.end_date, interval.end_date);
+      EXPECT_STREQ(arena_interval.symbol, interval.symbol.c_str());
+    }
+  }
+  // Records should still decode normally after arena metadata
+  const auto* ch_record = channel_target_->DecodeRecord();
+  ASSERT_NE(ch_record, nullptr);
+  ASSERT_TRUE(ch_record->Holds<MboMsg>());
+}
+
+TEST_F(DbnDecoderTests, TestRecordFilter) {
+  ReadFromFile("mbo", ".dbn", 2);
+  channel_target_->DecodeMetadata();
+  file_target_->DecodeMetadata();
+
+  // Matching filter passes all records through
+  RecordFilter matching;
+  matching.SetInstrumentIds({5482});
+  matching.SetRTypes({RType::Mbo});
+  file_target_->SetRecordFilter(matching);
+  std::size_t count{};
+  while (file_target_->DecodeRecord() != nullptr) {
+    ++count;
+  }
+  ASSERT_EQ(count, 2);
+
+  // Non-matching instrument ID skips every record
+  RecordFilter non_matching;
+  non_matching.SetInstrumentIds({1});
+  channel_target_->SetRecordFilter(non_matching);
+  ASSERT_EQ(channel_target_->DecodeRecord(), nullptr);
+}
+
+TEST_F(DbnDecoderTests, TestRecordFilterRType) {
+  ReadFromFile("mbo", ".dbn", 2);
+  file_target_->DecodeMetadata();
+  RecordFilter filter;
+  filter.SetRTypes({RType::Ohlcv1D});
+  file_target_->SetRecordFilter(filter);
+  ASSERT_TRUE(file_target_->DecodeRecords().empty());
+}
+
+TEST_F(DbnDecoderTests, TestDecodeRecordsMatchesDecodeRecord) {
+  ReadFromFile("mbo", ".dbn", 2);
+
+  channel_target_->DecodeMetadata();
+  file_target_->DecodeMetadata();
+  std::size_t batch_count{};
+  while (true) {
+    const auto& batch = file_target_->DecodeRecords();
+    if (batch.empty()) {
+      break;
+    }
+    for (const auto& f_record : batch) {
+      const auto* ch_record = channel_target_->DecodeRecord();
+      ASSERT_NE(ch_record, nullptr);
+      ASSERT_TRUE(f_record.Holds<MboMsg>());
+      ASSERT_TRUE(ch_record->Holds<MboMsg>());
+      EXPECT_EQ(f_record.Get<MboMsg>(), ch_record->Get<MboMsg>());
+      ++batch_count;
+    }
+  }
+  // Batch decoding should exhaust the input at the same point
+  ASSERT_EQ(channel_target_->DecodeRecord(), nullptr);
+  ASSERT_EQ(batch_count, 2);
+}
+
+TEST_F(DbnDecoderTests, TestDecodeAllMatchesDecodeRecord) {
+  ReadFromFile("mbo", ".dbn", 2);
+
+  channel_target_->DecodeMetadata();
+  file_target_->DecodeMetadata();
+  std::uint64_t count{};
+  const auto res =
+      file_target_->DecodeAll<MboMsg>([this, &count](const MboMsg& mbo) {
+        const auto* ch_record = channel_target_->DecodeRecord();
+        ASSERT_NE(ch_record, nullptr);
+        ASSERT_TRUE(ch_record->Holds<MboMsg>());
+        EXPECT_EQ(mbo, ch_record->Get<MboMsg>());
+        ++count;
+      });
+  EXPECT_EQ(res, count);
+  ASSERT_EQ(count, 2);
+  // The typed loop should exhaust the input at the same point
+  ASSERT_EQ(channel_target_->DecodeRecord(), nullptr);
+}
+
+TEST_F(DbnDecoderTests, TestTrustedInput) {
+  ReadFromFile("mbo", ".dbn", 2);
+  channel_target_->DecodeMetadata();
+  file_target_->DecodeMetadata();
+  // Trusted batch decoding produces the same records as the generic path
+  file_target_->SetTrustedInput(true);
+  std::size_t record_count{};
+  while (true) {
+    const auto& batch = file_target_->DecodeRecords();
+    if (batch.empty()) {
+      break;
+    }
+    for (const auto& f_record : batch) {
+      const auto* ch_record = channel_target_->DecodeRecord();
+      ASSERT_NE(ch_record, nullptr);
+      ASSERT_TRUE(f_record.Holds<MboMsg>());
+      EXPECT_EQ(f_record.GetUnchecked<MboMsg>(), ch_record->Get<MboMsg>());
+      ++record_count;
+    }
+  }
+  ASSERT_EQ(channel_target_->DecodeRecord(), nullptr);
+  ASSERT_EQ(record_count, 2);
+}
+
+TEST_F(DbnDecoderTests, TestTryDecodeRecord) {
+  ReadFromFile("mbo", ".dbn", 2);
+  file_target_->DecodeMetadata();
+  const Record* record;
+  ASSERT_EQ(file_target_->TryDecodeRecord(&record), DecodeStatus::Ok);
+  ASSERT_NE(record, nullptr);
+  EXPECT_TRUE(record->Holds<MboMsg>());
+  ASSERT_EQ(file_target_->TryDecodeRecord(&record), DecodeStatus::Ok);
+  ASSERT_EQ(file_target_->TryDecodeRecord(&record), DecodeStatus::EndOfInput);
+  EXPECT_EQ(record, nullptr);
+}
+
+TEST_F(DbnDecoderTests, TestDecodeAllFilter) {
+  ReadFromFile("mbo", ".dbn", 2);
+  file_target_->DecodeMetadata();
+  RecordFilter filter;
+  filter.SetInstrumentIds({1});
+  file_target_->SetRecordFilter(filter);
+  const auto res = file_target_->DecodeAll<MboMsg>([](const MboMsg&) {
+    FAIL() << "No record should match the filter";
+  });
+  ASSERT_EQ(res, 0);
+}
+
+TEST_F(DbnDecoderTests, TestDecodeAllUpgradeFallback) {
+  // DBNv1 definitions need upgrading, so every record takes the generic
+  // fallback path within the typed loop
+  ReadFromFile("definition", ".dbn", 1, VersionUpgradePolicy::Upgrade);
+  file_target_->DecodeMetadata();
+  std::uint64_t count{};
+  const auto res = file_target_->DecodeAll<InstrumentDefMsgV2>(
+      [&count](const InstrumentDefMsgV2& def) {
+        EXPECT_STREQ(def.RawSymbol(), "MSFT");
+        ++count;
+      });
+  EXPECT_EQ(res, count);
+  ASSERT_EQ(count, 2);
+}
+
+TEST_F(DbnDecoderTests, TestDecodePrefetch) {
+  ReadFromFile("mbo", ".dbn.zst", 2);
+  file_target_->EnablePrefetch();
+
+  channel_target_->DecodeMetadata();
+  file_target_->DecodeMetadata();
+  std::size_t record_count{};
+  while (true) {
+    const auto* f_record = file_target_->DecodeRecord();
+    const auto* ch_record = channel_target_->DecodeRecord();
+    if (f_record == nullptr) {
+      ASSERT_EQ(ch_record, nullptr);
+      break;
+    }
+    ASSERT_NE(ch_record, nullptr);
+    ASSERT_TRUE(f_record->Holds<MboMsg>());
+    ASSERT_TRUE(ch_record->Holds<MboMsg>());
+    EXPECT_EQ(f_record->Get<MboMsg>(), ch_record->Get<MboMsg>());
+    ++record_count;
+  }
+  ASSERT_EQ(record_count, 2);
+}
+
+TEST_F(DbnDecoderTests, TestDecodeRecordsUpgrade) {
+  ReadFromFile("definition", ".dbn", 1, VersionUpgradePolicy::Upgrade);
+
+  channel_target_->DecodeMetadata();
+  file_target_->DecodeMetadata();
+  std::size_t record_count{};
+  while (true) {
+    const auto& batch = file_target_->DecodeRecords();
+    if (batch.empty()) {
+      break;
+    }
+    for (const auto& f_record : batch) {
+      // Records should be upgraded to the V2 definition
+      ASSERT_TRUE(f_record.Holds<InstrumentDefMsgV2>());
+      EXPECT_STREQ(f_record.Get<InstrumentDefMsgV2>().RawSymbol(), "MSFT");
+      ++record_count;
+    }
+  }
+  ASSERT_EQ(record_count, 2);
+}
+
+// Decoding from a BufferChannel should produce the same records as decoding
+// the file directly, regardless of how the writer's chunks align with record
+// boundaries.
+TEST_F(DbnDecoderTests, TestDecodeFromBufferChannel) {
+  for (const auto extension : {".dbn", ".dbn.zst"}) {
+    // Chunk sizes smaller than, comparable to, and larger than a record
+    for (const std::size_t chunk_size : {std::size_t{7}, std::size_t{64},
+                                         std::size_t{1024}}) {
+      const std::string file_path =
+          TEST_BUILD_DIR "/data/test_data.mbo" + std::string{extension};
+      detail::BufferChannel buffer_channel;
+      detail::ScopedThread write_thread{[buffer_channel, file_path,
+                                         chunk_size]() mutable {
+        std::ifstream input_file{file_path, std::ios::binary};
+        ASSERT_TRUE(input_file.good());
+        std::vector<std::uint8_t> chunk(chunk_size);
+        while (input_file) {
+          input_file.read(reinterpret_cast<char*>(chunk.data()),
+                          static_cast<std::streamsize>(chunk.size()));
+          chunk.resize(static_cast<std::size_t>(input_file.gcount()));
+          buffer_channel.Write(std::move(chunk));
+          chunk = std::vector<std::uint8_t>(chunk_size);
+        }
+        buffer_channel.Finish();
+      }};
+      DbnDecoder slice_target{buffer_channel};
+      DbnDecoder f_target{
+          std::unique_ptr<IReadable>{new detail::FileStream{file_path}}};
+      EXPECT_EQ(slice_target.DecodeMetadata(), f_target.DecodeMetadata());
+      std::size_t record_count{};
+      while (true) {
+        const auto* s_record = slice_target.DecodeRecord();
+        const auto* f_record = f_target.DecodeRecord();
+        if (f_record == nullptr) {
+          ASSERT_EQ(s_record, nullptr);
+          break;
+        }
+        ASSERT_NE(s_record, nullptr);
+        ASSERT_TRUE(s_record->Holds<MboMsg>());
+        EXPECT_EQ(s_record->Get<MboMsg>(), f_record->Get<MboMsg>());
+        ++record_count;
+      }
+      ASSERT_EQ(record_count, 2);
+    }
+  }
+}
+
+TEST_F(DbnDecoderTests, TestStats) {
+  ReadFromFile("mbo", ".dbn", 1, VersionUpgradePolicy::Upgrade);
+
+  channel_target_->DecodeMetadata();
+  file_target_->DecodeMetadata();
+  std::size_t record_count{};
+  while (file_target_->DecodeRecord() != nullptr) {
+    channel_target_->DecodeRecord();
+    ++record_count;
+  }
+  for (const auto* target : {file_target_.get(), channel_target_.get()}) {
+    const auto stats = target->Stats();
+    EXPECT_EQ(stats.records, record_count);
+    EXPECT_EQ(stats.compat_upgrades, record_count);
+    EXPECT_GT(stats.bytes_read, 0);
+    EXPECT_GT(stats.read_calls, 0);
+  }
+}
+namespace {
+// Writes `file_path` to `output_path` `count` times back to back, as if
+// rotated capture files had been concatenated
+void ConcatenateFile(const std::string& file_path,
+                     const std::string& output_path, std::size_t count) {
+  std::ifstream input{file_path, std::ios::binary};
+  ASSERT_TRUE(input.good());
+  std::ofstream output{output_path, std::ios::binary};
+  for (std::size_t i = 0; i < count; ++i) {
+    input.clear();
+    input.seekg(0, std::ios::beg);
+    output << input.rdbuf();
+  }
+}
+}  // namespace
+
+TEST_F(DbnDecoderTests, TestStreamChaining) {
+  TempFile chained_file{testing::TempDir() + "/chained.dbn"};
+  ConcatenateFile(TEST_BUILD_DIR "/data/test_data.mbo.dbn",
+                  chained_file.Path(), 2);
+  DbnDecoder target{
+      std::unique_ptr<IReadable>{new detail::FileStream{chained_file.Path()}},
+      VersionUpgradePolicy::AsIs};
+  target.EnableStreamChaining();
+  const auto metadata = target.DecodeMetadata();
+  EXPECT_EQ(target.ChainedMetadata(), nullptr);
+  std::size_t count{};
+  while (true) {
+    const auto* record = target.DecodeRecord();
+    if (record == nullptr) {
+      break;
+    }
+    ASSERT_TRUE(record->Holds<MboMsg>());
+    ++count;
+    if (count <= 2) {
+      // Still within the first stream
+      EXPECT_EQ(target.ChainedMetadata(), nullptr);
+    }
+  }
+  // Both streams' records decode through the same decoder
+  EXPECT_EQ(count, 4);
+  ASSERT_NE(target.ChainedMetadata(), nullptr);
+  EXPECT_EQ(target.ChainedMetadata()->schema, metadata.schema);
+  EXPECT_EQ(target.ChainedMetadata()->version, metadata.version);
+}
+
+TEST_F(DbnDecoderTests, TestStreamChainingZstd) {
+  // Concatenated zstd frames decompress into one continuous byte stream,
+  // so the boundary is crossed the same way as for uncompressed input
+  TempFile chained_file{testing::TempDir() + "/chained.dbn.zst"};
+  ConcatenateFile(TEST_BUILD_DIR "/data/test_data.mbo.dbn.zst",
+                  chained_file.Path(), 3);
+  DbnDecoder target{
+      std::unique_ptr<IReadable>{new detail::FileStream{chained_file.Path()}},
+      VersionUpgradePolicy::AsIs};
+  target.EnableStreamChaining();
+  target.DecodeMetadata();
+  std::size_t count{};
+  while (true) {
+    const auto& batch = target.DecodeRecords();
+    if (batch.empty()) {
+      break;
+    }
+    count += batch.size();
+  }
+  EXPECT_EQ(count, 6);
+  ASSERT_NE(target.ChainedMetadata(), nullptr);
+}
 }  // namespace test
 }  // namespace databento
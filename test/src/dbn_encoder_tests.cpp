@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "databento/dbn_encoder.hpp"
+#include "databento/dbn_file_store.hpp"
+#include "databento/enums.hpp"
+#include "databento/record.hpp"
+#include "temp_file.hpp"
+
+namespace databento {
+namespace test {
+class DbnEncoderTests : public testing::TestWithParam<DbnFileWriter::Codec> {
+};
+
+TEST_P(DbnEncoderTests, TestRoundTrip) {
+  const DbnFileWriter::Codec codec = GetParam();
+  const std::string input_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn";
+  TempFile output_file{testing::TempDir() + "/round_trip.dbn"};
+  Metadata orig_metadata;
+  std::vector<MboMsg> orig_records;
+  {
+    DbnFileStore input{input_path};
+    // Scoped so the writer is flushed and finished before reading back
+    std::unique_ptr<DbnFileWriter> writer;
+    input.Replay(
+        [&writer, &orig_metadata, &output_file, codec](Metadata&& metadata) {
+          orig_metadata = metadata;
+          writer.reset(
+              new DbnFileWriter{output_file.Path(), metadata, codec});
+        },
+        [&writer, &orig_records](const Record& record) {
+          orig_records.emplace_back(record.Get<MboMsg>());
+          writer->WriteRecord(record);
+          return KeepGoing::Continue;
+        });
+  }
+  DbnFileStore output{output_file.Path()};
+  std::size_t record_count{};
+  output.Replay(
+      [&orig_metadata](Metadata&& metadata) {
+        EXPECT_EQ(metadata, orig_metadata);
+      },
+      [&orig_records, &record_count](const Record& record) {
+        EXPECT_EQ(record.Get<MboMsg>(), orig_records.at(record_count));
+        ++record_count;
+        return KeepGoing::Continue;
+      });
+  EXPECT_EQ(record_count, orig_records.size());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Compression, DbnEncoderTests,
+    testing::Values(DbnFileWriter::Codec::None, DbnFileWriter::Codec::Zstd,
+                    DbnFileWriter::Codec::Lz4),
+    [](const testing::TestParamInfo<DbnFileWriter::Codec>& param_info) {
+      switch (param_info.param) {
+        case DbnFileWriter::Codec::Zstd:
+          return "Zstd";
+        case DbnFileWriter::Codec::Lz4:
+          return "Lz4";
+        case DbnFileWriter::Codec::None:
+        default:
+          return "Uncompressed";
+      }
+    });
+}  // namespace test
+}  // namespace databento
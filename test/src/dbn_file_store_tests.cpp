@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+
+#include "databento/dbn_file_store.hpp"
+#include "databento/enums.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+TEST(DbnFileStoreTests, TestReplayWith) {
+  DbnFileStore target{TEST_BUILD_DIR "/data/test_data.mbo.dbn"};
+  std::size_t metadata_calls{};
+  std::size_t record_count{};
+  target.ReplayWith(
+      [&metadata_calls](Metadata&& metadata) {
+        ++metadata_calls;
+        EXPECT_EQ(metadata.schema, Schema::Mbo);
+      },
+      [&record_count](const Record& record) {
+        EXPECT_TRUE(record.Holds<MboMsg>());
+        ++record_count;
+        return KeepGoing::Continue;
+      });
+  EXPECT_EQ(metadata_calls, 1);
+  EXPECT_EQ(record_count, 2);
+}
+
+TEST(DbnFileStoreTests, TestReplayWithStop) {
+  DbnFileStore target{TEST_BUILD_DIR "/data/test_data.mbo.dbn"};
+  std::size_t record_count{};
+  target.ReplayWith([&record_count](const Record&) {
+    ++record_count;
+    return KeepGoing::Stop;
+  });
+  EXPECT_EQ(record_count, 1);
+}
+}  // namespace test
+}  // namespace databento
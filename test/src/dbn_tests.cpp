@@ -49,5 +49,54 @@ TEST(DbnTests, TestMetadataToString) {
     }
 })");
 }
+
+TEST(DbnTests, TestShareMetadata) {
+  const Metadata deep{kDbnVersion,
+                      dataset::kGlbxMdp3,
+                      false,
+                      Schema::Mbo,
+                      UnixNanos{std::chrono::seconds{1696959347}},
+                      UnixNanos{std::chrono::seconds{1696950000}},
+                      {},
+                      false,
+                      SType::RawSymbol,
+                      SType::InstrumentId,
+                      false,
+                      kSymbolCstrLen,
+                      {"NGG3", "NGQ4"},
+                      {"ng"},
+                      {"nf"},
+                      {{"NGG3", {{20220601, 20220701, "3"}}},
+                       {"NGQ4", {{20220601, 20220701, "4"}}}}};
+  const SharedMetadata shared = ShareMetadata(deep);
+  ASSERT_NE(shared, nullptr);
+  ASSERT_NE(shared->arena, nullptr);
+  EXPECT_EQ(shared->version, deep.version);
+  EXPECT_EQ(shared->dataset, deep.dataset);
+  EXPECT_EQ(shared->schema, deep.schema);
+  EXPECT_EQ(shared->start, deep.start);
+  EXPECT_EQ(shared->end, deep.end);
+  EXPECT_EQ(shared->stype_in, deep.stype_in);
+  EXPECT_EQ(shared->stype_out, deep.stype_out);
+  EXPECT_EQ(shared->symbol_cstr_len, deep.symbol_cstr_len);
+  ASSERT_EQ(shared->symbols.size(), 2);
+  EXPECT_STREQ(shared->symbols[0], "NGG3");
+  EXPECT_STREQ(shared->symbols[1], "NGQ4");
+  ASSERT_EQ(shared->partial.size(), 1);
+  EXPECT_STREQ(shared->partial[0], "ng");
+  ASSERT_EQ(shared->not_found.size(), 1);
+  EXPECT_STREQ(shared->not_found[0], "nf");
+  ASSERT_EQ(shared->mappings.size(), 2);
+  EXPECT_STREQ(shared->mappings[0].raw_symbol, "NGG3");
+  ASSERT_EQ(shared->mappings[1].interval_count, 1);
+  const auto& interval = shared->intervals[shared->mappings[1].interval_begin];
+  EXPECT_EQ(interval.start_date, 20220601);
+  EXPECT_EQ(interval.end_date, 20220701);
+  EXPECT_STREQ(interval.symbol, "4");
+  // Handing the snapshot to another consumer copies one pointer: both
+  // handles refer to the same immutable object.
+  const SharedMetadata other = shared;
+  EXPECT_EQ(other.get(), shared.get());
+}
 }  // namespace test
 }  // namespace databento
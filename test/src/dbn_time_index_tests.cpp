@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "databento/datetime.hpp"
+#include "databento/dbn_file_store.hpp"
+#include "databento/dbn_time_index.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/record.hpp"
+#include "temp_file.hpp"
+
+namespace databento {
+namespace test {
+namespace {
+std::vector<UnixNanos> RecordTimestamps(const std::string& file_path) {
+  std::vector<UnixNanos> timestamps;
+  DbnFileStore store{file_path};
+  store.Replay([&timestamps](const Record& record) {
+    timestamps.emplace_back(record.Header().ts_event);
+    return KeepGoing::Continue;
+  });
+  return timestamps;
+}
+}  // namespace
+
+TEST(DbnTimeIndexTests, TestWriteAndReadRoundTrip) {
+  const std::string dbn_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn";
+  TempFile index_file{testing::TempDir() + "/test_data.mbo.dbn.idx"};
+  DbnTimeIndex::WriteIndexFile(dbn_path, index_file.Path(), 1);
+  ASSERT_TRUE(index_file.Exists());
+  const auto index = DbnTimeIndex::ReadIndexFile(index_file.Path());
+  const auto timestamps = RecordTimestamps(dbn_path);
+  ASSERT_EQ(index.Checkpoints().size(), timestamps.size());
+  for (std::size_t i = 0; i < timestamps.size(); ++i) {
+    EXPECT_EQ(index.Checkpoints()[i].ts_event, timestamps[i]);
+  }
+}
+
+TEST(DbnTimeIndexTests, TestSeekToTime) {
+  const std::string dbn_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn";
+  TempFile index_file{testing::TempDir() + "/test_data.mbo.seek.idx"};
+  DbnTimeIndex::WriteIndexFile(dbn_path, index_file.Path(), 1);
+  const auto index = DbnTimeIndex::ReadIndexFile(index_file.Path());
+  const auto timestamps = RecordTimestamps(dbn_path);
+  ASSERT_EQ(timestamps.size(), 2);
+
+  DbnFileStore store{dbn_path};
+  store.SeekToTime(timestamps.back(), index);
+  std::size_t remaining{};
+  store.Replay([&remaining, &timestamps](const Record& record) {
+    EXPECT_GE(record.Header().ts_event, timestamps.back());
+    ++remaining;
+    return KeepGoing::Continue;
+  });
+  EXPECT_EQ(remaining, 1);
+}
+
+TEST(DbnTimeIndexTests, TestSeekCompressedThrows) {
+  const std::string dbn_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn";
+  TempFile index_file{testing::TempDir() + "/test_data.mbo.zst.idx"};
+  DbnTimeIndex::WriteIndexFile(dbn_path, index_file.Path(), 1);
+  const auto index = DbnTimeIndex::ReadIndexFile(index_file.Path());
+  DbnFileStore store{TEST_BUILD_DIR "/data/test_data.mbo.dbn.zst"};
+  ASSERT_THROW(store.SeekToTime(UnixNanos{}, index), InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
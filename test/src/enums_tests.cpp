@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "databento/enums.hpp"
+#include "databento/exceptions.hpp"
+
+namespace databento {
+namespace test {
+template <typename E>
+void AssertRoundTrips(E enumerator) {
+  EXPECT_EQ(FromString<E>(ToString(enumerator)), enumerator)
+      << ToString(enumerator);
+}
+
+TEST(EnumsTests, TestRoundTrip) {
+  for (const auto schema :
+       {Schema::Mbo, Schema::Mbp1, Schema::Mbp10, Schema::Tbbo, Schema::Trades,
+        Schema::Ohlcv1S, Schema::Ohlcv1M, Schema::Ohlcv1H, Schema::Ohlcv1D,
+        Schema::Definition, Schema::Statistics, Schema::Status,
+        Schema::Imbalance}) {
+    AssertRoundTrips(schema);
+  }
+  for (const auto encoding : {Encoding::Dbn, Encoding::Csv, Encoding::Json}) {
+    AssertRoundTrips(encoding);
+  }
+  for (const auto mode : {FeedMode::Historical, FeedMode::HistoricalStreaming,
+                          FeedMode::Live}) {
+    AssertRoundTrips(mode);
+  }
+  for (const auto compression : {Compression::None, Compression::Zstd}) {
+    AssertRoundTrips(compression);
+  }
+  for (const auto stype : {SType::InstrumentId, SType::RawSymbol,
+                           SType::Continuous, SType::Parent}) {
+    AssertRoundTrips(stype);
+  }
+  for (const auto duration : {SplitDuration::Day, SplitDuration::Week,
+                              SplitDuration::Month, SplitDuration::None}) {
+    AssertRoundTrips(duration);
+  }
+  for (const auto packaging :
+       {Packaging::None, Packaging::Zip, Packaging::Tar}) {
+    AssertRoundTrips(packaging);
+  }
+  for (const auto delivery :
+       {Delivery::Download, Delivery::S3, Delivery::Disk}) {
+    AssertRoundTrips(delivery);
+  }
+  for (const auto state : {JobState::Received, JobState::Queued,
+                           JobState::Processing, JobState::Done,
+                           JobState::Expired}) {
+    AssertRoundTrips(state);
+  }
+  for (const auto condition :
+       {DatasetCondition::Available, DatasetCondition::Degraded,
+        DatasetCondition::Pending, DatasetCondition::Missing,
+        DatasetCondition::Bad}) {
+    AssertRoundTrips(condition);
+  }
+}
+
+TEST(EnumsTests, TestToStringSparse) {
+  EXPECT_STREQ(ToString(RType::OhlcvDeprecated), "OhlcvDeprecated");
+  EXPECT_STREQ(ToString(RType::Mbo), "Mbo");
+  EXPECT_STREQ(ToString(static_cast<RType>(0xFF)), "Unknown");
+  EXPECT_STREQ(ToString(Action::Clear), "Clear");
+  EXPECT_STREQ(ToString(Side::None), "None");
+  EXPECT_STREQ(ToString(InstrumentClass::FxSpot), "FxSpot");
+  EXPECT_STREQ(ToString(MatchAlgorithm::ThresholdProRataLmm),
+               "ThresholdProRataLmm");
+  EXPECT_STREQ(ToString(static_cast<MatchAlgorithm>('Z')), "Unknown");
+  EXPECT_STREQ(ToString(StatType::Vwap), "Vwap");
+  EXPECT_STREQ(ToString(static_cast<StatType>(0)), "Unknown");
+}
+
+TEST(PublishersTests, TestRoundTrip) {
+  for (std::uint16_t raw = 1; raw <= 80; ++raw) {
+    const auto publisher = static_cast<Publisher>(raw);
+    AssertRoundTrips(publisher);
+    // The publisher name is "<dataset>.<venue>"
+    const std::string name = ToString(publisher);
+    const std::string dataset = ToString(PublisherDataset(publisher));
+    const std::string venue = ToString(PublisherVenue(publisher));
+    EXPECT_EQ(name.compare(0, dataset.size(), dataset), 0) << name;
+    EXPECT_EQ(name.compare(name.size() - venue.size(), venue.size(), venue), 0)
+        << name;
+  }
+  for (std::uint16_t raw = 1; raw <= 42; ++raw) {
+    AssertRoundTrips(static_cast<Venue>(raw));
+  }
+  for (std::uint16_t raw = 1; raw <= 30; ++raw) {
+    AssertRoundTrips(static_cast<Dataset>(raw));
+  }
+}
+
+TEST(PublishersTests, TestUnknown) {
+  EXPECT_STREQ(ToString(static_cast<Venue>(0)), "Unknown");
+  EXPECT_STREQ(ToString(static_cast<Publisher>(999)), "Unknown");
+  EXPECT_THROW(PublisherVenue(static_cast<Publisher>(0)),
+               InvalidArgumentError);
+  EXPECT_THROW(PublisherDataset(static_cast<Publisher>(81)),
+               InvalidArgumentError);
+  EXPECT_THROW(FromString<Venue>("glbx"), InvalidArgumentError);
+  EXPECT_THROW(FromString<Publisher>("GLBX.MDP3"), InvalidArgumentError);
+}
+
+TEST(EnumsTests, TestFromStringInvalid) {
+  EXPECT_THROW(FromString<Schema>("bbo"), InvalidArgumentError);
+  EXPECT_THROW(FromString<Schema>(""), InvalidArgumentError);
+  EXPECT_THROW(FromString<SType>("smart"), InvalidArgumentError);
+  EXPECT_THROW(FromString<Encoding>("dbz"), InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
@@ -30,6 +30,27 @@ TEST(FileStreamTests, TestReadSomeLessThanMax) {
   ASSERT_TRUE(std::any_of(buffer.cbegin(), buffer.cend(),
                           [](std::uint8_t byte) { return byte != 0; }));
 }
+TEST(FileStreamTests, TestReadAdvice) {
+  const std::string file_path =
+      TEST_BUILD_DIR "/data/test_data.ohlcv-1d.v1.dbn";
+  databento::detail::FileStream plain{file_path};
+  std::vector<std::uint8_t> expected(1024);
+  const auto expected_size = plain.ReadSome(expected.data(), expected.size());
+  // Advice never changes what's read, only how the kernel caches it
+  ReadAdvice advice;
+  advice.sequential = true;
+  advice.readahead_size = 1 << 20;
+  advice.drop_consumed = true;
+  databento::detail::FileStream target{file_path, advice};
+  std::vector<std::uint8_t> buffer(1024);
+  const auto read_size = target.ReadSome(buffer.data(), buffer.size());
+  ASSERT_EQ(read_size, expected_size);
+  ASSERT_EQ(buffer, expected);
+  // Seeking restarts the advice windows without affecting reads
+  target.Seek(1);
+  ASSERT_EQ(target.ReadSome(buffer.data(), buffer.size()), expected_size - 1);
+  ASSERT_EQ(buffer[0], expected[1]);
+}
 }  // namespace test
 }  // namespace detail
 }  // namespace databento
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include "databento/constants.hpp"
+#include "databento/fixed_price.hpp"
+
+namespace databento {
+namespace test {
+TEST(FixedPriceTests, TestPxToString) {
+  EXPECT_EQ(PxToString(0), "0.000000000");
+  EXPECT_EQ(PxToString(1), "0.000000001");
+  EXPECT_EQ(PxToString(-1), "-0.000000001");
+  EXPECT_EQ(PxToString(kFixedPriceScale), "1.000000000");
+  EXPECT_EQ(PxToString(3250 * kFixedPriceScale + 250000000),
+            "3250.250000000");
+  EXPECT_EQ(PxToString(-3250 * kFixedPriceScale - 250000000),
+            "-3250.250000000");
+  EXPECT_EQ(PxToString(kUndefPrice), "kUndefPrice");
+  EXPECT_EQ(PxToString(std::numeric_limits<std::int64_t>::min()),
+            "-9223372036.854775808");
+}
+
+TEST(FixedPriceTests, TestPxToCharsBufferTooSmall) {
+  std::array<char, 5> buffer;
+  EXPECT_EQ(PxToChars(kFixedPriceScale, buffer.data(),
+                      buffer.data() + buffer.size()),
+            nullptr);
+  EXPECT_EQ(PxToChars(kUndefPrice, buffer.data(),
+                      buffer.data() + buffer.size()),
+            nullptr);
+}
+
+TEST(FixedPriceTests, TestStreamOpMatchesPxToString) {
+  for (const auto px : {std::int64_t{0}, std::int64_t{-1},
+                        572 * kFixedPriceScale + 500000, kUndefPrice}) {
+    std::ostringstream stream;
+    stream << FixPx{px};
+    EXPECT_EQ(stream.str(), PxToString(px));
+  }
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "databento/constants.hpp"  // kSymbolCstrLen
+#include "databento/fixed_string.hpp"
+
+namespace databento {
+namespace test {
+TEST(FixedStringTests, TestDefaultEmpty) {
+  const SymbolString symbol;
+  EXPECT_TRUE(symbol.empty());
+  EXPECT_EQ(symbol.size(), 0);
+  EXPECT_EQ(symbol, "");
+}
+
+TEST(FixedStringTests, TestConstruction) {
+  const SymbolString from_cstr = "ES.FUT";
+  EXPECT_EQ(from_cstr.size(), 6);
+  EXPECT_FALSE(from_cstr.empty());
+  const SymbolString from_string = std::string{"ES.FUT"};
+  EXPECT_EQ(from_cstr, from_string);
+  EXPECT_EQ(SymbolString::MaxSize(), kSymbolCstrLen - 1);
+  EXPECT_TRUE(std::is_trivially_copyable<SymbolString>::value);
+}
+
+TEST(FixedStringTests, TestTruncation) {
+  const FixedString<4> truncated = "ABCDEF";
+  EXPECT_EQ(truncated.size(), 3);
+  EXPECT_EQ(truncated, "ABC");
+  const FixedString<4> exact = "ABC";
+  EXPECT_EQ(exact, truncated);
+}
+
+TEST(FixedStringTests, TestComparison) {
+  const SymbolString symbol = "NGG3";
+  EXPECT_EQ(symbol, "NGG3");
+  EXPECT_EQ("NGG3", symbol);
+  EXPECT_EQ(symbol, std::string{"NGG3"});
+  EXPECT_EQ(std::string{"NGG3"}, symbol);
+  EXPECT_NE(symbol, "NGQ4");
+  EXPECT_NE("NGQ4", symbol);
+  EXPECT_NE(symbol, std::string{"NGQ4"});
+  EXPECT_LT(SymbolString{"NGG3"}, SymbolString{"NGQ4"});
+}
+
+TEST(FixedStringTests, TestStringConversion) {
+  const SymbolString symbol = "CL.FUT";
+  const std::string str = symbol;
+  EXPECT_EQ(str, "CL.FUT");
+  EXPECT_STREQ(symbol.c_str(), "CL.FUT");
+}
+
+TEST(FixedStringTests, TestStreamOp) {
+  std::ostringstream stream;
+  stream << SymbolString{"MSFT"};
+  EXPECT_EQ(stream.str(), "MSFT");
+}
+
+TEST(FixedStringTests, TestVector) {
+  const std::vector<SymbolString> symbols = {"NGG3", "NGQ4"};
+  const std::vector<SymbolString> same = {"NGG3", "NGQ4"};
+  const std::vector<SymbolString> different = {"NGG3", "NGQ5"};
+  EXPECT_EQ(symbols, same);
+  EXPECT_NE(symbols, different);
+}
+}  // namespace test
+}  // namespace databento
@@ -2,9 +2,14 @@
 #include <httplib.h>
 #include <nlohmann/json_fwd.hpp>
 
+#include <dirent.h>  // closedir, opendir, readdir
+
 #include <algorithm>
 #include <chrono>
+#include <cstdio>     // remove
 #include <cstdlib>
+#include <fstream>    // ifstream
+#include <sstream>    // stringstream
 #include <stdexcept>  // logic_error
 #include <utility>    // move
 
@@ -283,6 +288,188 @@ TEST_F(HistoricalTests, TestBatchDownloadSingleInvalidFile) {
                InvalidArgumentError);
 }
 
+// sha256 of test/data/test_data.mbo.dbn (465 bytes)
+static const nlohmann::json kRangedListFilesResp{
+    {{"filename", "test.dbn"},
+     {"size", 465},
+     {"hash",
+      "sha256:"
+      "31403d17bf9801842acf59bca668e6b8f19ff4b5d70dce05f0fe70d995fc70d6"},
+     {"urls",
+      {{"https", "https://api.databento.com/v0/job_id/test.dbn"},
+       {"ftp", "ftp://ftp.databento.com/job_id/test.dbn"}}}}};
+
+namespace {
+std::string ReadFileToString(const std::string& path) {
+  std::ifstream file{path, std::ios::binary};
+  std::stringstream ss;
+  ss << file.rdbuf();
+  return ss.str();
+}
+
+// Removes a response cache directory and the entries within it.
+void RemoveCacheDir(const std::string& dir_path) {
+  std::unique_ptr<DIR, int (*)(DIR*)> dir{::opendir(dir_path.c_str()),
+                                          &::closedir};
+  if (dir == nullptr) {
+    return;
+  }
+  while (const dirent* entry = ::readdir(dir.get())) {
+    const std::string name = entry->d_name;
+    if (name != "." && name != "..") {
+      std::remove((dir_path + '/' + name).c_str());
+    }
+  }
+  // `remove` on an empty directory removes it
+  std::remove(dir_path.c_str());
+}
+}  // namespace
+
+TEST_F(HistoricalTests, TestBatchDownloadParallelRanged) {
+  const auto kJobId = "job456";
+  const TempFile temp_dbn_file{TEST_BUILD_DIR "/job456/test.dbn"};
+  mock_server_.MockGetJson("/v0/batch.list_files", {{"job_id", kJobId}},
+                           kRangedListFilesResp);
+  mock_server_.MockStreamDbnRanged("/v0/job_id/test.dbn", {},
+                                   TEST_BUILD_DIR "/data/test_data.mbo.dbn");
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  ASSERT_FALSE(temp_dbn_file.Exists());
+  // Force the file to be split into ranged parts
+  const Historical::DownloadConf kConf{2, 64};
+  const std::vector<std::string> paths =
+      target.BatchDownload(TEST_BUILD_DIR, kJobId, kConf);
+  ASSERT_EQ(paths.size(), 1);
+  EXPECT_EQ(paths[0], temp_dbn_file.Path());
+  ASSERT_TRUE(temp_dbn_file.Exists());
+  EXPECT_EQ(ReadFileToString(temp_dbn_file.Path()),
+            ReadFileToString(TEST_BUILD_DIR "/data/test_data.mbo.dbn"));
+}
+
+TEST_F(HistoricalTests, TestBatchStream) {
+  const auto kJobId = "job321";
+  const TempFile temp_dbn_file{TEST_BUILD_DIR "/job321/test.dbn"};
+  mock_server_.MockGetJson("/v0/batch.list_files", {{"job_id", kJobId}},
+                           kListFilesResp);
+  mock_server_.MockStreamDbn("/v0/job_id/test.dbn", {},
+                             TEST_BUILD_DIR "/data/test_data.mbo.dbn");
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  std::size_t metadata_calls{};
+  std::size_t record_count{};
+  target.BatchStream(
+      TEST_BUILD_DIR, kJobId,
+      [&metadata_calls](Metadata&& metadata) {
+        ++metadata_calls;
+        EXPECT_EQ(metadata.schema, Schema::Mbo);
+      },
+      [&record_count](const Record& record) {
+        EXPECT_TRUE(record.Holds<MboMsg>());
+        ++record_count;
+        return KeepGoing::Continue;
+      });
+  // The JSON metadata file is skipped
+  EXPECT_EQ(metadata_calls, 1);
+  EXPECT_EQ(record_count, 2);
+  // The raw bytes were persisted alongside the decode
+  ASSERT_TRUE(temp_dbn_file.Exists());
+  EXPECT_EQ(ReadFileToString(temp_dbn_file.Path()),
+            ReadFileToString(TEST_BUILD_DIR "/data/test_data.mbo.dbn"));
+}
+
+TEST_F(HistoricalTests, TestBatchStreamStop) {
+  const auto kJobId = "job322";
+  mock_server_.MockGetJson("/v0/batch.list_files", {{"job_id", kJobId}},
+                           kListFilesResp);
+  mock_server_.MockStreamDbn("/v0/job_id/test.dbn", {},
+                             TEST_BUILD_DIR "/data/test_data.mbo.dbn");
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  std::size_t record_count{};
+  target.BatchStream(kJobId, {}, [&record_count](const Record&) {
+    ++record_count;
+    return KeepGoing::Stop;
+  });
+  EXPECT_EQ(record_count, 1);
+}
+
+TEST_F(HistoricalTests, TestBatchDownloadResume) {
+  const auto kJobId = "job654";
+  const TempFile temp_dbn_file{TEST_BUILD_DIR "/job654/test.dbn"};
+  mock_server_.MockGetJson("/v0/batch.list_files", {{"job_id", kJobId}},
+                           kRangedListFilesResp);
+  mock_server_.MockStreamDbnRanged("/v0/job_id/test.dbn", {},
+                                   TEST_BUILD_DIR "/data/test_data.mbo.dbn");
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  target.BatchDownload(TEST_BUILD_DIR, kJobId, "test.dbn");
+  const std::string full = ReadFileToString(temp_dbn_file.Path());
+  ASSERT_EQ(full.size(), 465);
+  // Simulate an interrupted transfer by truncating to the first 200 bytes
+  {
+    std::ofstream partial{temp_dbn_file.Path(),
+                          std::ios::binary | std::ios::trunc};
+    partial.write(full.data(), 200);
+  }
+  // Resumes from the partial file and verifies the hash of the whole file
+  target.BatchDownload(TEST_BUILD_DIR, kJobId, "test.dbn");
+  EXPECT_EQ(ReadFileToString(temp_dbn_file.Path()), full);
+}
+
+TEST_F(HistoricalTests, TestBatchDownloadResumeCorruptPrefix) {
+  const auto kJobId = "job987";
+  const TempFile temp_dbn_file{TEST_BUILD_DIR "/job987/test.dbn"};
+  mock_server_.MockGetJson("/v0/batch.list_files", {{"job_id", kJobId}},
+                           kRangedListFilesResp);
+  mock_server_.MockStreamDbnRanged("/v0/job_id/test.dbn", {},
+                                   TEST_BUILD_DIR "/data/test_data.mbo.dbn");
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  target.BatchDownload(TEST_BUILD_DIR, kJobId, "test.dbn");
+  // Corrupt the on-disk prefix. The resumed download only fetches the tail,
+  // so the streaming digest sees the corruption and verification fails
+  {
+    std::ofstream partial{temp_dbn_file.Path(),
+                          std::ios::binary | std::ios::trunc};
+    const std::string corrupt(200, 'X');
+    partial.write(corrupt.data(),
+                  static_cast<std::streamsize>(corrupt.size()));
+  }
+  ASSERT_THROW(target.BatchDownload(TEST_BUILD_DIR, kJobId, "test.dbn"),
+               DbnResponseError);
+}
+
+TEST_F(HistoricalTests, TestBatchDownloadHashMismatch) {
+  const auto kJobId = "job789";
+  const TempFile temp_dbn_file{TEST_BUILD_DIR "/job789/test.dbn"};
+  nlohmann::json list_files_resp = kRangedListFilesResp;
+  list_files_resp[0]["hash"] =
+      "sha256:0000000000000000000000000000000000000000000000000000000000000000";
+  mock_server_.MockGetJson("/v0/batch.list_files", {{"job_id", kJobId}},
+                           list_files_resp);
+  mock_server_.MockStreamDbnRanged("/v0/job_id/test.dbn", {},
+                                   TEST_BUILD_DIR "/data/test_data.mbo.dbn");
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  ASSERT_THROW(
+      target.BatchDownload(TEST_BUILD_DIR, kJobId, Historical::DownloadConf{}),
+      DbnResponseError);
+  // The corrupt-looking file is still left on disk for inspection
+  EXPECT_TRUE(temp_dbn_file.Exists());
+}
+
 TEST_F(HistoricalTests, TestMetadataListPublishers) {
   const nlohmann::json kResp{
       {{"publisher_id", 1},
@@ -309,6 +496,110 @@ TEST_F(HistoricalTests, TestMetadataListPublishers) {
   EXPECT_EQ(res[1], xnas_exp);
 }
 
+TEST_F(HistoricalTests, TestAsync) {
+  const nlohmann::json kPublishersResp{
+      {{"publisher_id", 1},
+       {"dataset", "GLBX.MDP3"},
+       {"venue", "GLBX"},
+       {"description", "CME Globex MDP 3.0"}},
+  };
+  const nlohmann::json kDatasetsResp{"GLBX.MDP3", "XNAS.ITCH"};
+  mock_server_.MockGetJson("/v0/metadata.list_publishers", kPublishersResp);
+  mock_server_.MockGetJson("/v0/metadata.list_datasets", kDatasetsResp);
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  auto publishers_fut = target.Async(&Historical::MetadataListPublishers);
+  auto datasets_fut = target.Async<std::vector<std::string>>(
+      &Historical::MetadataListDatasets);
+  const auto publishers = publishers_fut.get();
+  const auto datasets = datasets_fut.get();
+  ASSERT_EQ(publishers.size(), 1);
+  EXPECT_EQ(publishers[0].dataset, "GLBX.MDP3");
+  ASSERT_EQ(datasets.size(), 2);
+  EXPECT_EQ(datasets[0], "GLBX.MDP3");
+}
+
+TEST_F(HistoricalTests, TestMetadataListPublishersCached) {
+  const nlohmann::json kResp{
+      {{"publisher_id", 1},
+       {"dataset", "GLBX.MDP3"},
+       {"venue", "GLBX"},
+       {"description", "CME Globex MDP 3.0"}},
+  };
+  mock_server_.MockGetJson("/v0/metadata.list_publishers", kResp);
+  const auto port = mock_server_.ListenOnThread();
+  const std::string cache_dir = testing::TempDir() + "/TestMetadataCache";
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  target.SetCacheDir(cache_dir);
+  const auto res = target.MetadataListPublishers();
+  ASSERT_EQ(res.size(), 1);
+  // A client pointing at an unreachable gateway can only succeed if the
+  // response is served from the cache
+  databento::Historical offline{logger_.get(), kApiKey, "localhost", 1};
+  offline.SetCacheDir(cache_dir);
+  const auto cached_res = offline.MetadataListPublishers();
+  ASSERT_EQ(cached_res.size(), 1);
+  EXPECT_EQ(cached_res[0].publisher_id, res[0].publisher_id);
+  EXPECT_EQ(cached_res[0].dataset, res[0].dataset);
+  EXPECT_EQ(cached_res[0].venue, res[0].venue);
+  EXPECT_EQ(cached_res[0].description, res[0].description);
+  RemoveCacheDir(cache_dir);
+}
+
+TEST_F(HistoricalTests, TestSymbologyResolveCached) {
+  const nlohmann::json kResp{
+      {"result",
+       {{"ESM2",
+         {{
+             {"d0", "2022-06-06"},
+             {"d1", "2022-06-10"},
+             {"s", "3403"},
+         }}}}},
+      {"partial", nlohmann::json::array()},
+      {"not_found", {"EZM2"}},
+      {"message", "OK"},
+      {"status", 0},
+  };
+  mock_server_.MockPostJson("/v0/symbology.resolve",
+                            {
+                                {"dataset", dataset::kGlbxMdp3},
+                                {"start_date", "2022-06-06"},
+                                {"end_date", "2022-06-10"},
+                                {"symbols", "ESM2,EZM2"},
+                                {"stype_in", "raw_symbol"},
+                                {"stype_out", "instrument_id"},
+                            },
+                            kResp);
+  const auto port = mock_server_.ListenOnThread();
+  const std::string cache_dir = testing::TempDir() + "/TestSymbologyCache";
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  target.SetCacheDir(cache_dir);
+  const auto res = target.SymbologyResolve(dataset::kGlbxMdp3,
+                                           {"ESM2", "EZM2"}, SType::RawSymbol,
+                                           SType::InstrumentId,
+                                           {"2022-06-06", "2022-06-10"});
+  databento::Historical offline{logger_.get(), kApiKey, "localhost", 1};
+  offline.SetCacheDir(cache_dir);
+  const auto cached_res = offline.SymbologyResolve(
+      dataset::kGlbxMdp3, {"ESM2", "EZM2"}, SType::RawSymbol,
+      SType::InstrumentId, {"2022-06-06", "2022-06-10"});
+  ASSERT_EQ(cached_res.mappings.size(), res.mappings.size());
+  const auto& esm2_mappings = cached_res.mappings.at("ESM2");
+  ASSERT_EQ(esm2_mappings.size(), 1);
+  EXPECT_EQ(esm2_mappings[0].start_date, "2022-06-06");
+  EXPECT_EQ(esm2_mappings[0].end_date, "2022-06-10");
+  EXPECT_EQ(esm2_mappings[0].symbol, "3403");
+  EXPECT_EQ(cached_res.not_found, res.not_found);
+  EXPECT_TRUE(cached_res.partial.empty());
+  RemoveCacheDir(cache_dir);
+}
+
 TEST_F(HistoricalTests, TestMetadataListDatasets_Simple) {
   const nlohmann::json kResp{
       dataset::kGlbxMdp3,
@@ -607,6 +898,48 @@ TEST_F(HistoricalTests, TestSymbologyResolve) {
   EXPECT_EQ(esm2_mapping.symbol, "3403");
 }
 
+TEST_F(HistoricalTests, TestSymbologyResolveSymbolSpan) {
+  const nlohmann::json kResp{
+      {"result",
+       {{"ESM2",
+         {{
+             {"d0", "2022-06-06"},
+             {"d1", "2022-06-10"},
+             {"s", "3403"},
+         }}}}},
+      {"symbols", {"ESM2"}},
+      {"stype_in", "raw_symbol"},
+      {"stype_out", "instrument_id"},
+      {"start_date", "2022-06-06"},
+      {"end_date", "2022-06-10"},
+      {"partial", nlohmann::json::array()},
+      {"not_found", nlohmann::json::array()},
+      {"message", "OK"},
+      {"status", 0},
+  };
+
+  mock_server_.MockPostJson("/v0/symbology.resolve",
+                            {
+                                {"dataset", dataset::kGlbxMdp3},
+                                {"start_date", "2022-06-06"},
+                                {"end_date", "2022-06-10"},
+                                {"symbols", "ESM2,NQM2"},
+                                {"stype_in", "raw_symbol"},
+                                {"stype_out", "instrument_id"},
+                            },
+                            kResp);
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  // e.g. handles into an interning pool, with no per-call string vector
+  const std::vector<const char*> kSymbolSpan{"ESM2", "NQM2"};
+  const auto res = target.SymbologyResolve(
+      dataset::kGlbxMdp3, kSymbolSpan.data(), kSymbolSpan.size(),
+      SType::RawSymbol, SType::InstrumentId, {"2022-06-06", "2022-06-10"});
+  ASSERT_EQ(res.mappings.size(), 1);
+}
+
 TEST_F(HistoricalTests, TestTimeseriesGetRange_Basic) {
   mock_server_.MockStreamDbn("/v0/timeseries.get_range",
                              {{"dataset", dataset::kGlbxMdp3},
@@ -669,6 +1002,80 @@ TEST_F(HistoricalTests, TestTimeseriesGetRange_NoMetadataCallback) {
   EXPECT_EQ(mbo_records.size(), 2);
 }
 
+TEST_F(HistoricalTests, TestTimeseriesSession) {
+  mock_server_.MockStreamDbn("/v0/timeseries.get_range",
+                             {{"dataset", dataset::kGlbxMdp3},
+                              {"symbols", "ESH1"},
+                              {"schema", "mbo"},
+                              {"start", "1609160400000711344"},
+                              {"end", "1609160800000711344"},
+                              {"encoding", "dbn"},
+                              {"stype_in", "raw_symbol"},
+                              {"stype_out", "instrument_id"},
+                              {"limit", "2"}},
+                             TEST_BUILD_DIR "/data/test_data.mbo.dbn.zst");
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical client{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  databento::TimeseriesSession target{&client};
+  // Successive requests reuse the session's channel and decoder buffers
+  for (std::size_t i = 0; i < 3; ++i) {
+    std::unique_ptr<Metadata> metadata_ptr;
+    std::vector<MboMsg> mbo_records;
+    target.GetRange(
+        dataset::kGlbxMdp3,
+        {UnixNanos{std::chrono::nanoseconds{1609160400000711344}},
+         UnixNanos{std::chrono::nanoseconds{1609160800000711344}}},
+        {"ESH1"}, Schema::Mbo, SType::RawSymbol, SType::InstrumentId, 2,
+        [&metadata_ptr](Metadata&& metadata) {
+          metadata_ptr =
+              std::unique_ptr<Metadata>{new Metadata(std::move(metadata))};
+        },
+        [&mbo_records](const Record& record) {
+          mbo_records.emplace_back(record.Get<MboMsg>());
+          return KeepGoing::Continue;
+        });
+    ASSERT_NE(metadata_ptr, nullptr) << "request " << i;
+    EXPECT_EQ(metadata_ptr->schema, Schema::Mbo);
+    EXPECT_EQ(mbo_records.size(), 2) << "request " << i;
+  }
+}
+
+TEST_F(HistoricalTests, TestTimeseriesSessionStop) {
+  mock_server_.MockStreamDbn("/v0/timeseries.get_range",
+                             {{"dataset", dataset::kGlbxMdp3},
+                              {"symbols", "ESH1"},
+                              {"schema", "mbo"},
+                              {"start", "1609160400000711344"},
+                              {"encoding", "dbn"},
+                              {"stype_in", "raw_symbol"},
+                              {"stype_out", "instrument_id"}},
+                             TEST_BUILD_DIR "/data/test_data.mbo.dbn.zst");
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical client{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  databento::TimeseriesSession target{&client};
+  const databento::DateTimeRange<UnixNanos> range{
+      UnixNanos{std::chrono::nanoseconds{1609160400000711344}}};
+  // Stopping a request early shouldn't corrupt the next one
+  std::size_t first_count = 0;
+  target.GetRange(dataset::kGlbxMdp3, range, {"ESH1"}, Schema::Mbo,
+                  [&first_count](const Record&) {
+                    ++first_count;
+                    return KeepGoing::Stop;
+                  });
+  EXPECT_EQ(first_count, 1);
+  std::size_t second_count = 0;
+  target.GetRange(dataset::kGlbxMdp3, range, {"ESH1"}, Schema::Mbo,
+                  [&second_count](const Record&) {
+                    ++second_count;
+                    return KeepGoing::Continue;
+                  });
+  EXPECT_EQ(second_count, 2);
+}
+
 // should get helpful message if there's a problem with the request
 TEST_F(HistoricalTests, TestTimeseriesGetRange_BadRequest) {
   const nlohmann::json resp{
@@ -697,6 +1104,76 @@ TEST_F(HistoricalTests, TestTimeseriesGetRange_BadRequest) {
   }
 }
 
+TEST_F(HistoricalTests, TestTimeseriesGetRangeParallel_Ordered) {
+  // Each shard's request receives the same two-record file
+  mock_server_.MockStreamDbn("/v0/timeseries.get_range", {},
+                             TEST_BUILD_DIR "/data/test_data.mbo.dbn.zst");
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  const UnixNanos kStart{std::chrono::nanoseconds{1609160400000711344}};
+  const UnixNanos kEnd{std::chrono::nanoseconds{1609160800000711344}};
+  std::size_t metadata_calls{};
+  std::size_t record_count{};
+  target.TimeseriesGetRangeParallel(
+      dataset::kGlbxMdp3, {kStart, kEnd}, {"ESH1"}, Schema::Mbo, 3,
+      Historical::ShardOrdering::Ordered,
+      [&metadata_calls, kEnd](Metadata&& metadata) {
+        ++metadata_calls;
+        EXPECT_EQ(metadata.schema, Schema::Mbo);
+        // The merged stream reports the full requested range
+        EXPECT_EQ(metadata.end, kEnd);
+      },
+      [&record_count](const Record& record) {
+        EXPECT_TRUE(record.Holds<MboMsg>());
+        ++record_count;
+        return KeepGoing::Continue;
+      });
+  EXPECT_EQ(metadata_calls, 1);
+  EXPECT_EQ(record_count, 6);
+}
+
+TEST_F(HistoricalTests, TestTimeseriesGetRangeParallel_Unordered) {
+  mock_server_.MockStreamDbn("/v0/timeseries.get_range", {},
+                             TEST_BUILD_DIR "/data/test_data.mbo.dbn.zst");
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  std::size_t metadata_calls{};
+  std::size_t record_count{};
+  target.TimeseriesGetRangeParallel(
+      dataset::kGlbxMdp3,
+      {UnixNanos{std::chrono::nanoseconds{1609160400000711344}},
+       UnixNanos{std::chrono::nanoseconds{1609160800000711344}}},
+      {"ESH1"}, Schema::Mbo, 4, Historical::ShardOrdering::Unordered,
+      [&metadata_calls](Metadata&&) { ++metadata_calls; },
+      [&record_count](const Record&) {
+        ++record_count;
+        return KeepGoing::Continue;
+      });
+  EXPECT_EQ(metadata_calls, 1);
+  EXPECT_EQ(record_count, 8);
+}
+
+TEST_F(HistoricalTests, TestTimeseriesGetRangeParallel_BadArgs) {
+  databento::Historical target{logger_.get(), kApiKey, "localhost", 80};
+  const UnixNanos kStart{std::chrono::nanoseconds{1609160400000711344}};
+  const UnixNanos kEnd{std::chrono::nanoseconds{1609160800000711344}};
+  EXPECT_THROW(target.TimeseriesGetRangeParallel(
+                   dataset::kGlbxMdp3, {kStart, kEnd}, {"ESH1"}, Schema::Mbo,
+                   0, Historical::ShardOrdering::Ordered, {},
+                   [](const Record&) { return KeepGoing::Continue; }),
+               InvalidArgumentError);
+  // An open-ended range can't be sharded
+  EXPECT_THROW(target.TimeseriesGetRangeParallel(
+                   dataset::kGlbxMdp3, DateTimeRange<UnixNanos>{kStart},
+                   {"ESH1"}, Schema::Mbo, 2, Historical::ShardOrdering::Ordered,
+                   {}, [](const Record&) { return KeepGoing::Continue; }),
+               InvalidArgumentError);
+}
+
 TEST_F(HistoricalTests, TestTimeseriesGetRange_CallbackException) {
   mock_server_.MockStreamDbn("/v0/timeseries.get_range", {},
                              TEST_BUILD_DIR "/data/test_data.mbo.dbn.zst");
@@ -770,6 +1247,35 @@ TEST_F(HistoricalTests, TestTimeseriesGetRangeToFile) {
   ASSERT_EQ(counter, 2);
 }
 
+TEST_F(HistoricalTests, TestTimeseriesGetRangeToFileDropCache) {
+  mock_server_.MockStreamDbn("/v0/timeseries.get_range",
+                             {{"dataset", dataset::kGlbxMdp3},
+                              {"start", "2022-10-21T13:30"},
+                              {"end", "2022-10-21T20:00"},
+                              {"symbols", "CYZ2"},
+                              {"schema", "tbbo"},
+                              {"encoding", "dbn"},
+                              {"stype_in", "raw_symbol"},
+                              {"stype_out", "instrument_id"}},
+                             TEST_BUILD_DIR "/data/test_data.tbbo.dbn.zst");
+  const auto port = mock_server_.ListenOnThread();
+
+  databento::Historical target{logger_.get(), kApiKey, "localhost",
+                               static_cast<std::uint16_t>(port)};
+  const TempFile temp_file{testing::TempDir() +
+                           "/TestTimeseriesGetRangeToFileDropCache"};
+  DbnFileStore bento = target.TimeseriesGetRangeToFile(
+      dataset::kGlbxMdp3, {"2022-10-21T13:30", "2022-10-21T20:00"}, {"CYZ2"},
+      Schema::Tbbo, SType::RawSymbol, SType::InstrumentId, {},
+      temp_file.Path(), Historical::FileWriteMode::DropCache);
+  std::size_t counter{};
+  bento.Replay([&counter](const Record&) {
+    ++counter;
+    return KeepGoing::Continue;
+  });
+  ASSERT_EQ(counter, 2);
+}
+
 TEST(JsonImplementationTests,
      TestParsingNumberNotPreciselyRepresentableAsDouble) {
   auto const number_json = nlohmann::json::parse("1609160400000711344");
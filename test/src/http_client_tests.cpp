@@ -2,9 +2,13 @@
 #include <nlohmann/json.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include "databento/detail/http_client.hpp"
+#include "databento/exceptions.hpp"
 #include "databento/log.hpp"
 #include "mock/mock_http_server.hpp"
 
@@ -36,6 +40,67 @@ TEST_F(HttpClientTests, TestLogWarnings) {
       std::string::npos);
   EXPECT_NE(output.find("Server Warning: Large request"), std::string::npos);
 }
+
+TEST_F(HttpClientTests, TestZstdEncodedResponse) {
+  const nlohmann::json kResp{{"result", {{"key", "value"}}},
+                             {"message", "OK"}};
+  mock_server_.MockGetJsonZstd("/zstd", kResp);
+  const auto port = mock_server_.ListenOnThread();
+  HttpClient target{ILogReceiver::Default(), kApiKey, "localhost",
+                    static_cast<std::uint16_t>(port)};
+  const auto res = target.GetJson("/zstd", {});
+  EXPECT_EQ(res, kResp);
+}
+
+TEST_F(HttpClientTests, TestConcurrentRequests) {
+  const nlohmann::json kResp{{"key", "value"}};
+  mock_server_.MockGetJson("/json", kResp);
+  const auto port = mock_server_.ListenOnThread();
+  HttpClient target{ILogReceiver::Default(), kApiKey, "localhost",
+                    static_cast<std::uint16_t>(port)};
+  std::vector<std::thread> threads;
+  std::atomic<std::size_t> success_count{};
+  for (std::size_t i = 0; i < 4; ++i) {
+    threads.emplace_back([&target, &kResp, &success_count] {
+      // Repeated calls on one connection exercise keep-alive reuse
+      for (std::size_t j = 0; j < 3; ++j) {
+        if (target.GetJson("/json", {}) == kResp) {
+          ++success_count;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(success_count, 12);
+}
+
+TEST_F(HttpClientTests, TestConnectionCap) {
+  const nlohmann::json kResp{{"key", "value"}};
+  mock_server_.MockGetJson("/json", kResp);
+  const auto port = mock_server_.ListenOnThread();
+  HttpClient target{ILogReceiver::Default(), kApiKey, "localhost",
+                    static_cast<std::uint16_t>(port)};
+  ASSERT_THROW(target.SetMaxConnections(0), InvalidArgumentError);
+  // All requests serialize over a single shared connection
+  target.SetMaxConnections(1);
+  std::vector<std::thread> threads;
+  std::atomic<std::size_t> success_count{};
+  for (std::size_t i = 0; i < 4; ++i) {
+    threads.emplace_back([&target, &kResp, &success_count] {
+      for (std::size_t j = 0; j < 3; ++j) {
+        if (target.GetJson("/json", {}) == kResp) {
+          ++success_count;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(success_count, 12);
+}
 }  // namespace test
 }  // namespace detail
 }  // namespace databento
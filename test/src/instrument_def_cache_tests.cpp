@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>  // strncpy
+#include <thread>
+
+#include "databento/datetime.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/instrument_def_cache.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+class InstrumentDefCacheTests : public testing::Test {
+ protected:
+  static InstrumentDefMsg DummyDef(std::uint32_t instrument_id,
+                                   const char* raw_symbol) {
+    InstrumentDefMsg def{};
+    def.hd = {sizeof(InstrumentDefMsg) / RecordHeader::kLengthMultiplier,
+              RType::InstrumentDef, 1, instrument_id, UnixNanos{}};
+    std::strncpy(def.raw_symbol.data(), raw_symbol,
+                 def.raw_symbol.size() - 1);
+    return def;
+  }
+};
+
+TEST_F(InstrumentDefCacheTests, TestInsertFindUpdate) {
+  InstrumentDefCache target{1 << 10, 16};
+  InstrumentDefMsg res;
+  ASSERT_FALSE(target.Find(42, &res));
+  target.Insert(DummyDef(42, "ESM4"));
+  ASSERT_EQ(target.Size(), 1);
+  ASSERT_TRUE(target.Find(42, &res));
+  EXPECT_STREQ(res.raw_symbol.data(), "ESM4");
+  ASSERT_FALSE(target.Find(43, &res));
+  // Updating in place doesn't grow the cache
+  auto update = DummyDef(42, "ESM4");
+  update.min_price_increment = 25;
+  target.Insert(update);
+  ASSERT_EQ(target.Size(), 1);
+  ASSERT_TRUE(target.Find(42, &res));
+  EXPECT_EQ(res.min_price_increment, 25);
+}
+
+TEST_F(InstrumentDefCacheTests, TestOnRecord) {
+  InstrumentDefCache target{1 << 10, 16};
+  auto def = DummyDef(7, "NGG3");
+  target.OnRecord(Record{&def.hd});
+  auto mbo = MboMsg{};
+  mbo.hd = {sizeof(MboMsg) / RecordHeader::kLengthMultiplier, RType::Mbo, 1,
+            7, UnixNanos{}};
+  // Non-definition records are ignored
+  target.OnRecord(Record{&mbo.hd});
+  ASSERT_EQ(target.Size(), 1);
+  InstrumentDefMsg res;
+  ASSERT_TRUE(target.Find(7, &res));
+  EXPECT_STREQ(res.raw_symbol.data(), "NGG3");
+}
+
+TEST_F(InstrumentDefCacheTests, TestOutliersFallBackToSparseRegion) {
+  InstrumentDefCache target{16, 8};
+  target.Insert(DummyDef(2000, "A"));
+  // Far outside the dense window in both directions
+  target.Insert(DummyDef(5, "B"));
+  target.Insert(DummyDef(2'000'000, "C"));
+  ASSERT_EQ(target.Size(), 3);
+  InstrumentDefMsg res;
+  ASSERT_TRUE(target.Find(2000, &res));
+  EXPECT_STREQ(res.raw_symbol.data(), "A");
+  ASSERT_TRUE(target.Find(5, &res));
+  EXPECT_STREQ(res.raw_symbol.data(), "B");
+  ASSERT_TRUE(target.Find(2'000'000, &res));
+  EXPECT_STREQ(res.raw_symbol.data(), "C");
+  ASSERT_FALSE(target.Find(3'000'000, &res));
+}
+
+TEST_F(InstrumentDefCacheTests, TestSparseRegionFull) {
+  InstrumentDefCache target{16, 2};
+  target.Insert(DummyDef(1000, "A"));
+  target.Insert(DummyDef(1'000'000, "B"));
+  target.Insert(DummyDef(2'000'000, "C"));
+  ASSERT_THROW(target.Insert(DummyDef(3'000'000, "D")), Exception);
+}
+
+TEST_F(InstrumentDefCacheTests, TestConcurrentReaderSeesConsistentDefs) {
+  constexpr std::uint32_t kIterations = 20000;
+  InstrumentDefCache target{1 << 8, 16};
+  std::thread writer{[&target] {
+    for (std::uint32_t i = 0; i < kIterations; ++i) {
+      auto def = DummyDef(100 + i % 8, "SYM");
+      // Keep two fields in lockstep to detect torn reads
+      def.min_price_increment = i;
+      def.display_factor = i;
+      target.Insert(def);
+    }
+  }};
+  InstrumentDefMsg res;
+  for (std::uint32_t i = 0; i < kIterations; ++i) {
+    if (target.Find(100 + i % 8, &res)) {
+      ASSERT_EQ(res.min_price_increment, res.display_factor);
+      ASSERT_EQ(res.hd.instrument_id, 100 + i % 8);
+    }
+  }
+  writer.join();
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "databento/datetime.hpp"
+#include "databento/enums.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/instrument_state_cache.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+class InstrumentStateCacheTests : public testing::Test {
+ protected:
+  static StatMsg DummyStat(std::uint32_t instrument_id, StatType stat_type,
+                           std::int64_t price, std::int32_t quantity) {
+    StatMsg stat{};
+    stat.hd = {sizeof(StatMsg) / RecordHeader::kLengthMultiplier,
+               RType::Statistics, 1, instrument_id, UnixNanos{}};
+    stat.ts_recv = UnixNanos{std::chrono::nanoseconds{1}};
+    stat.price = price;
+    stat.quantity = quantity;
+    stat.stat_type = stat_type;
+    stat.update_action = StatUpdateAction::New;
+    return stat;
+  }
+
+  static ImbalanceMsg DummyImbalance(std::uint32_t instrument_id,
+                                     std::int64_t ref_price) {
+    ImbalanceMsg imbalance{};
+    imbalance.hd = {sizeof(ImbalanceMsg) / RecordHeader::kLengthMultiplier,
+                    RType::Imbalance, 1, instrument_id, UnixNanos{}};
+    imbalance.ts_recv = UnixNanos{std::chrono::nanoseconds{1}};
+    imbalance.ref_price = ref_price;
+    return imbalance;
+  }
+};
+
+TEST_F(InstrumentStateCacheTests, TestStatsKeyedByType) {
+  InstrumentStateCache target{1 << 10, 16};
+  InstrumentStateCache::StatValue res;
+  ASSERT_FALSE(target.FindStat(42, StatType::SettlementPrice, &res));
+  target.Insert(DummyStat(42, StatType::SettlementPrice, 100, 0));
+  target.Insert(DummyStat(42, StatType::OpenInterest, 0, 5000));
+  ASSERT_EQ(target.Size(), 1);
+  ASSERT_TRUE(target.FindStat(42, StatType::SettlementPrice, &res));
+  EXPECT_EQ(res.price, 100);
+  ASSERT_TRUE(target.FindStat(42, StatType::OpenInterest, &res));
+  EXPECT_EQ(res.quantity, 5000);
+  // Other stat types and instruments remain unset
+  ASSERT_FALSE(target.FindStat(42, StatType::OpeningPrice, &res));
+  ASSERT_FALSE(target.FindStat(43, StatType::SettlementPrice, &res));
+  // Updating in place doesn't grow the cache
+  target.Insert(DummyStat(42, StatType::SettlementPrice, 125, 0));
+  ASSERT_EQ(target.Size(), 1);
+  ASSERT_TRUE(target.FindStat(42, StatType::SettlementPrice, &res));
+  EXPECT_EQ(res.price, 125);
+}
+
+TEST_F(InstrumentStateCacheTests, TestDeleteClearsStat) {
+  InstrumentStateCache target{1 << 10, 16};
+  target.Insert(DummyStat(7, StatType::ClosePrice, 99, 0));
+  InstrumentStateCache::StatValue res;
+  ASSERT_TRUE(target.FindStat(7, StatType::ClosePrice, &res));
+  auto del = DummyStat(7, StatType::ClosePrice, 0, 0);
+  del.update_action = StatUpdateAction::Delete;
+  target.Insert(del);
+  ASSERT_FALSE(target.FindStat(7, StatType::ClosePrice, &res));
+}
+
+TEST_F(InstrumentStateCacheTests, TestImbalance) {
+  InstrumentStateCache target{1 << 10, 16};
+  ImbalanceMsg res;
+  ASSERT_FALSE(target.FindImbalance(42, &res));
+  target.Insert(DummyImbalance(42, 250));
+  ASSERT_TRUE(target.FindImbalance(42, &res));
+  EXPECT_EQ(res.ref_price, 250);
+  // Stats and imbalance for one instrument share a slot
+  target.Insert(DummyStat(42, StatType::OpeningPrice, 240, 0));
+  ASSERT_EQ(target.Size(), 1);
+  target.Insert(DummyImbalance(42, 260));
+  ASSERT_TRUE(target.FindImbalance(42, &res));
+  EXPECT_EQ(res.ref_price, 260);
+}
+
+TEST_F(InstrumentStateCacheTests, TestOnRecord) {
+  InstrumentStateCache target{1 << 10, 16};
+  auto stat = DummyStat(7, StatType::OpeningPrice, 10, 0);
+  target.OnRecord(Record{&stat.hd});
+  auto imbalance = DummyImbalance(8, 20);
+  target.OnRecord(Record{&imbalance.hd});
+  auto mbo = MboMsg{};
+  mbo.hd = {sizeof(MboMsg) / RecordHeader::kLengthMultiplier, RType::Mbo, 1,
+            7, UnixNanos{}};
+  // Other record types are ignored
+  target.OnRecord(Record{&mbo.hd});
+  ASSERT_EQ(target.Size(), 2);
+  InstrumentStateCache::StatValue stat_res;
+  ASSERT_TRUE(target.FindStat(7, StatType::OpeningPrice, &stat_res));
+  EXPECT_EQ(stat_res.price, 10);
+  ImbalanceMsg imbalance_res;
+  ASSERT_TRUE(target.FindImbalance(8, &imbalance_res));
+  EXPECT_EQ(imbalance_res.ref_price, 20);
+}
+
+TEST_F(InstrumentStateCacheTests, TestOutliersFallBackToSparseRegion) {
+  InstrumentStateCache target{16, 8};
+  target.Insert(DummyStat(2000, StatType::ClosePrice, 1, 0));
+  // Far outside the dense window in both directions
+  target.Insert(DummyStat(5, StatType::ClosePrice, 2, 0));
+  target.Insert(DummyStat(2'000'000, StatType::ClosePrice, 3, 0));
+  ASSERT_EQ(target.Size(), 3);
+  InstrumentStateCache::StatValue res;
+  ASSERT_TRUE(target.FindStat(2000, StatType::ClosePrice, &res));
+  EXPECT_EQ(res.price, 1);
+  ASSERT_TRUE(target.FindStat(5, StatType::ClosePrice, &res));
+  EXPECT_EQ(res.price, 2);
+  ASSERT_TRUE(target.FindStat(2'000'000, StatType::ClosePrice, &res));
+  EXPECT_EQ(res.price, 3);
+  ASSERT_FALSE(target.FindStat(3'000'000, StatType::ClosePrice, &res));
+}
+
+TEST_F(InstrumentStateCacheTests, TestSparseRegionFull) {
+  InstrumentStateCache target{16, 2};
+  target.Insert(DummyStat(1000, StatType::ClosePrice, 1, 0));
+  target.Insert(DummyStat(1'000'000, StatType::ClosePrice, 2, 0));
+  target.Insert(DummyStat(2'000'000, StatType::ClosePrice, 3, 0));
+  ASSERT_THROW(target.Insert(DummyStat(3'000'000, StatType::ClosePrice, 4, 0)),
+               Exception);
+}
+
+TEST_F(InstrumentStateCacheTests, TestConcurrentReaderSeesConsistentState) {
+  constexpr std::uint32_t kIterations = 20000;
+  InstrumentStateCache target{1 << 8, 16};
+  std::thread writer{[&target] {
+    for (std::uint32_t i = 0; i < kIterations; ++i) {
+      // Keep two fields in lockstep to detect torn reads
+      target.Insert(DummyStat(100 + i % 8, StatType::Vwap,
+                              static_cast<std::int64_t>(i),
+                              static_cast<std::int32_t>(i)));
+    }
+  }};
+  InstrumentStateCache::StatValue res;
+  for (std::uint32_t i = 0; i < kIterations; ++i) {
+    if (target.FindStat(100 + i % 8, StatType::Vwap, &res)) {
+      ASSERT_EQ(res.price, res.quantity);
+    }
+  }
+  writer.join();
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>  // ifstream
+#include <iterator>  // istreambuf_iterator
+#include <memory>  // unique_ptr
+#include <string>
+#include <vector>
+
+#include "databento/detail/file_stream.hpp"
+#include "databento/detail/journal_writer.hpp"
+#include "databento/detail/lz4_stream.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/ireadable.hpp"
+#include "databento/log.hpp"
+#include "temp_file.hpp"
+
+namespace databento {
+namespace test {
+class JournalWriterTests : public testing::Test {
+ protected:
+  static std::vector<char> ReadSegments(const std::string& path_prefix) {
+    std::vector<char> res;
+    for (std::size_t i = 0;; ++i) {
+      std::ifstream segment{path_prefix + '.' + std::to_string(i),
+                            std::ios::binary};
+      if (!segment.good()) {
+        return res;
+      }
+      res.insert(res.end(), std::istreambuf_iterator<char>{segment},
+                 std::istreambuf_iterator<char>{});
+    }
+  }
+
+  NullLogReceiver logger_{};
+};
+
+TEST_F(JournalWriterTests, TestEmptyPathPrefix) {
+  ASSERT_THROW(detail::JournalWriter(&logger_, {}), InvalidArgumentError);
+}
+
+TEST_F(JournalWriterTests, TestSegmentRotation) {
+  const std::string path_prefix = testing::TempDir() + "/journal_rotation";
+  detail::JournalWriter::Conf conf;
+  conf.path_prefix = path_prefix;
+  conf.segment_size = 4096;
+  conf.buffer_size = 1024;
+  // 10000 bytes across 4096-byte segments: two full segments and a
+  // truncated third
+  TempFile segment_0{path_prefix + ".0"};
+  TempFile segment_1{path_prefix + ".1"};
+  TempFile segment_2{path_prefix + ".2"};
+  std::vector<char> expected;
+  {
+    detail::JournalWriter target{&logger_, conf};
+    std::vector<char> chunk(625);
+    for (std::size_t i = 0; i < 16; ++i) {
+      for (std::size_t j = 0; j < chunk.size(); ++j) {
+        chunk[j] = static_cast<char>(i * 31 + j);
+      }
+      target.Write(chunk.data(), chunk.size());
+      expected.insert(expected.end(), chunk.begin(), chunk.end());
+    }
+    // The destructor flushes the ring and trims the final segment
+  }
+  EXPECT_EQ(ReadSegments(path_prefix), expected);
+  std::ifstream last_segment{segment_2.Path(),
+                             std::ios::binary | std::ios::ate};
+  EXPECT_EQ(last_segment.tellg(), 10000 - 2 * 4096);
+}
+
+TEST_F(JournalWriterTests, TestLz4Compression) {
+  const std::string path_prefix = testing::TempDir() + "/journal_lz4";
+  detail::JournalWriter::Conf conf;
+  conf.path_prefix = path_prefix;
+  conf.segment_size = 1UL << 20;
+  conf.buffer_size = 1024;
+  conf.lz4_compress = true;
+  TempFile segment_0{path_prefix + ".0"};
+  std::vector<char> expected;
+  {
+    detail::JournalWriter target{&logger_, conf};
+    std::vector<char> chunk(625);
+    for (std::size_t i = 0; i < 16; ++i) {
+      for (std::size_t j = 0; j < chunk.size(); ++j) {
+        chunk[j] = static_cast<char>(i * 31 + j);
+      }
+      target.Write(chunk.data(), chunk.size());
+      expected.insert(expected.end(), chunk.begin(), chunk.end());
+    }
+    // The destructor flushes the ring and finishes the segment's frame
+  }
+  // Each segment is a standalone LZ4 frame
+  detail::Lz4Stream stream{std::unique_ptr<IReadable>{
+      new detail::FileStream{segment_0.Path()}}};
+  std::vector<char> res(expected.size());
+  stream.ReadExact(reinterpret_cast<std::uint8_t*>(res.data()), res.size());
+  EXPECT_EQ(res, expected);
+  std::uint8_t extra;
+  EXPECT_EQ(stream.ReadSome(&extra, 1), 0);
+}
+}  // namespace test
+}  // namespace databento
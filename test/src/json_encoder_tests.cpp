@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <string>
+
+#include "databento/datetime.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/iwritable.hpp"
+#include "databento/json_encoder.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+namespace {
+class StringWritable : public IWritable {
+ public:
+  void WriteAll(const std::uint8_t* buffer, std::size_t length) override {
+    contents_.append(reinterpret_cast<const char*>(buffer), length);
+  }
+
+  const std::string& Contents() const { return contents_; }
+
+ private:
+  std::string contents_;
+};
+
+MboMsg MakeMboMsg() {
+  MboMsg res{};
+  res.hd = RecordHeader{
+      sizeof(MboMsg) / RecordHeader::kLengthMultiplier, RType::Mbo, 1, 5482,
+      UnixNanos{std::chrono::nanoseconds{1609160400000429831}}};
+  res.order_id = 647784973705;
+  res.price = 3722750000000;
+  res.size = 2;
+  res.flags = FlagSet{128};
+  res.channel_id = 0;
+  res.action = Action::Add;
+  res.side = Side::Bid;
+  res.ts_recv = UnixNanos{std::chrono::nanoseconds{1609160400000704060}};
+  res.ts_in_delta = TimeDeltaNanos{22969};
+  res.sequence = 1170352;
+  return res;
+}
+}  // namespace
+
+TEST(JsonEncoderTests, TestEncodeMboMsg) {
+  StringWritable writable;
+  {
+    JsonEncoder target{&writable, false, false};
+    target.EncodeRecord(MakeMboMsg());
+  }
+  const auto json = nlohmann::json::parse(writable.Contents());
+  EXPECT_EQ(json.at("hd").at("rtype"), 160);
+  EXPECT_EQ(json.at("hd").at("publisher_id"), 1);
+  EXPECT_EQ(json.at("hd").at("instrument_id"), 5482);
+  EXPECT_EQ(json.at("hd").at("ts_event"), "1609160400000429831");
+  // 64-bit fields are encoded as strings to avoid loss of precision
+  EXPECT_EQ(json.at("order_id"), "647784973705");
+  EXPECT_EQ(json.at("price"), "3722750000000");
+  EXPECT_EQ(json.at("ts_recv"), "1609160400000704060");
+  EXPECT_EQ(json.at("size"), 2);
+  EXPECT_EQ(json.at("flags"), 128);
+  EXPECT_EQ(json.at("action"), "A");
+  EXPECT_EQ(json.at("side"), "B");
+  EXPECT_EQ(json.at("ts_in_delta"), 22969);
+  EXPECT_EQ(json.at("sequence"), 1170352);
+}
+
+TEST(JsonEncoderTests, TestEncodePretty) {
+  StringWritable writable;
+  {
+    JsonEncoder target{&writable, true, true};
+    target.EncodeRecord(MakeMboMsg());
+  }
+  const auto json = nlohmann::json::parse(writable.Contents());
+  EXPECT_EQ(json.at("hd").at("ts_event"), "2020-12-28T13:00:00.000429831Z");
+  EXPECT_EQ(json.at("price"), "3722.750000000");
+}
+
+TEST(JsonEncoderTests, TestEncodeMbp1Levels) {
+  StringWritable writable;
+  Mbp1Msg record{};
+  record.hd = RecordHeader{sizeof(Mbp1Msg) / RecordHeader::kLengthMultiplier,
+                           RType::Mbp1, 1, 5482, UnixNanos{}};
+  record.price = 10;
+  record.action = Action::Trade;
+  record.side = Side::Ask;
+  record.levels[0] = BidAskPair{8, 12, 100, 200, 1, 2};
+  {
+    JsonEncoder target{&writable, false, false};
+    target.EncodeRecord(Record{&record.hd});
+  }
+  const auto json = nlohmann::json::parse(writable.Contents());
+  ASSERT_EQ(json.at("levels").size(), 1);
+  EXPECT_EQ(json.at("levels")[0].at("bid_px"), "8");
+  EXPECT_EQ(json.at("levels")[0].at("ask_px"), "12");
+  EXPECT_EQ(json.at("levels")[0].at("bid_sz"), 100);
+  EXPECT_EQ(json.at("levels")[0].at("ask_ct"), 2);
+}
+
+TEST(JsonEncoderTests, TestOneObjectPerLine) {
+  StringWritable writable;
+  {
+    JsonEncoder target{&writable, false, false};
+    for (std::size_t i = 0; i < 10; ++i) {
+      target.EncodeRecord(MakeMboMsg());
+    }
+  }
+  std::istringstream lines{writable.Contents()};
+  std::string line;
+  std::size_t line_count = 0;
+  while (std::getline(lines, line)) {
+    EXPECT_NO_THROW(nlohmann::json::parse(line));
+    ++line_count;
+  }
+  EXPECT_EQ(line_count, 10);
+}
+
+TEST(JsonEncoderTests, TestUnsupported) {
+  StringWritable writable;
+  JsonEncoder target{&writable, false, false};
+  ErrorMsg error{};
+  error.hd = RecordHeader{sizeof(ErrorMsg) / RecordHeader::kLengthMultiplier,
+                          RType::Error, 0, 0, UnixNanos{}};
+  EXPECT_THROW(target.EncodeRecord(Record{&error.hd}), InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <cmath>  // fabs
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "databento/latency_histogram.hpp"
+
+namespace databento {
+namespace test {
+TEST(LatencyHistogramTests, TestEmpty) {
+  LatencyHistogram target;
+  EXPECT_EQ(target.Count(), 0);
+  EXPECT_EQ(target.Max(), 0);
+  EXPECT_EQ(target.ValueAtPercentile(99.0), 0);
+}
+
+TEST(LatencyHistogramTests, TestPercentileAccuracy) {
+  LatencyHistogram target;
+  for (std::uint64_t value = 1; value <= 100000; ++value) {
+    target.Record(value);
+  }
+  EXPECT_EQ(target.Count(), 100000);
+  EXPECT_EQ(target.Max(), 100000);
+  EXPECT_EQ(target.ValueAtPercentile(100.0), 100000);
+  for (const double percentile : {10.0, 50.0, 90.0, 99.0, 99.9}) {
+    const double expected = percentile / 100.0 * 100000;
+    const auto actual =
+        static_cast<double>(target.ValueAtPercentile(percentile));
+    // Buckets are within ~3% of the recorded value
+    EXPECT_LT(std::fabs(actual - expected) / expected, 0.04) << percentile;
+  }
+}
+
+TEST(LatencyHistogramTests, TestExtremeValues) {
+  LatencyHistogram target;
+  target.Record(0);
+  target.Record(1);
+  target.Record(std::uint64_t{1} << 63);
+  target.Record(~std::uint64_t{0});
+  EXPECT_EQ(target.Count(), 4);
+  EXPECT_EQ(target.Max(), ~std::uint64_t{0});
+  EXPECT_EQ(target.ValueAtPercentile(100.0), ~std::uint64_t{0});
+  EXPECT_EQ(target.ValueAtPercentile(1.0), 0);
+}
+
+TEST(LatencyHistogramTests, TestConcurrentRecording) {
+  LatencyHistogram target;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&target] {
+      for (std::uint64_t value = 0; value < 10000; ++value) {
+        target.Record(value);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(target.Count(), 40000);
+  EXPECT_EQ(target.Max(), 9999);
+}
+}  // namespace test
+}  // namespace databento
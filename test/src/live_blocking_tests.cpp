@@ -4,6 +4,7 @@
 #include <atomic>
 #include <chrono>  // milliseconds
 #include <condition_variable>
+#include <cstring>  // strncpy
 #include <memory>
 #include <mutex>   // lock_guard, mutex, unique_lock
 #include <thread>  // this_thread
@@ -11,6 +12,7 @@
 
 #include "databento/constants.hpp"  // dataset
 #include "databento/datetime.hpp"
+#include "databento/dbn_file_store.hpp"
 #include "databento/enums.hpp"  // Schema, SType
 #include "databento/exceptions.hpp"
 #include "databento/live_blocking.hpp"
@@ -19,6 +21,7 @@
 #include "databento/symbology.hpp"
 #include "databento/with_ts_out.hpp"
 #include "mock/mock_lsg_server.hpp"  // MockLsgServer
+#include "temp_file.hpp"             // TempFile
 
 namespace databento {
 namespace test {
@@ -91,6 +94,32 @@ TEST_F(LiveBlockingTests, TestSubscribe) {
   target.Subscribe(kSymbols, kSchema, kSType);
 }
 
+TEST_F(LiveBlockingTests, TestSubscribeSymbolSpan) {
+  constexpr auto kTsOut = false;
+  constexpr auto kDataset = dataset::kXnasItch;
+  const std::vector<std::string> kSymbols{"MSFT", "TSLA", "QQQ"};
+  constexpr auto kSchema = Schema::Ohlcv1M;
+  constexpr auto kSType = SType::RawSymbol;
+
+  const mock::MockLsgServer mock_server{
+      kDataset, kTsOut, [&kSymbols](mock::MockLsgServer& self) {
+        self.Accept();
+        self.Authenticate();
+        self.Subscribe(kSymbols, kSchema, kSType);
+      }};
+
+  LiveBlocking target{logger_.get(),
+                      kKey,
+                      kDataset,
+                      kLocalhost,
+                      mock_server.Port(),
+                      kTsOut,
+                      VersionUpgradePolicy{}};
+  // e.g. handles into an interning pool, with no per-call string vector
+  const std::vector<const char*> kSymbolSpan{"MSFT", "TSLA", "QQQ"};
+  target.Subscribe(kSymbolSpan.data(), kSymbolSpan.size(), kSchema, kSType);
+}
+
 TEST_F(LiveBlockingTests, TestSubscriptionChunking) {
   constexpr auto kTsOut = false;
   constexpr auto kDataset = dataset::kXnasItch;
@@ -124,6 +153,39 @@ TEST_F(LiveBlockingTests, TestSubscriptionChunking) {
   target.Subscribe(kSymbols, kSchema, kSType);
 }
 
+TEST_F(LiveBlockingTests, TestBulkSubscribe) {
+  constexpr auto kTsOut = false;
+  constexpr auto kDataset = dataset::kXnasItch;
+  const std::vector<std::string> kMboSymbols{"MSFT", "TSLA"};
+  constexpr auto kTradesSymbol = "TEST";
+  constexpr std::size_t kTradesSymbolCount = 200;
+  constexpr auto kSType = SType::RawSymbol;
+
+  const mock::MockLsgServer mock_server{
+      kDataset, kTsOut, [&kMboSymbols](mock::MockLsgServer& self) {
+        self.Accept();
+        self.Authenticate();
+        self.Subscribe(kMboSymbols, Schema::Mbo, kSType);
+        // the second request's symbols are chunked
+        self.Subscribe({128, kTradesSymbol}, Schema::Trades, kSType);
+        self.Subscribe({kTradesSymbolCount - 128, kTradesSymbol},
+                       Schema::Trades, kSType);
+      }};
+
+  LiveBlocking target{logger_.get(),
+                      kKey,
+                      kDataset,
+                      kLocalhost,
+                      mock_server.Port(),
+                      kTsOut,
+                      VersionUpgradePolicy{}};
+  const std::vector<SubscriptionRequest> kRequests{
+      {kMboSymbols, Schema::Mbo, kSType, UnixNanos{}},
+      {std::vector<std::string>(kTradesSymbolCount, kTradesSymbol),
+       Schema::Trades, kSType, UnixNanos{}}};
+  target.Subscribe(kRequests);
+}
+
 TEST_F(LiveBlockingTests, TestNextRecord) {
   constexpr auto kTsOut = false;
   constexpr auto kRecCount = 12;
@@ -147,6 +209,172 @@ TEST_F(LiveBlockingTests, TestNextRecord) {
   }
 }
 
+TEST_F(LiveBlockingTests, TestTryNextRecord) {
+  constexpr auto kTsOut = false;
+  constexpr auto kRecCount = 3;
+  constexpr OhlcvMsg kRec{DummyHeader<OhlcvMsg>(RType::Ohlcv1M), 1, 2, 3, 4, 5};
+  const mock::MockLsgServer mock_server{
+      dataset::kXnasItch, kTsOut, [kRec](mock::MockLsgServer& self) {
+        self.Accept();
+        self.Authenticate();
+        for (size_t i = 0; i < kRecCount; ++i) {
+          self.SendRecord(kRec);
+        }
+      }};
+
+  LiveBlocking target{
+      logger_.get(),      kKey,   dataset::kXnasItch,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  for (size_t i = 0; i < kRecCount; ++i) {
+    const Record* rec;
+    ASSERT_EQ(target.TryNextRecord(&rec, std::chrono::seconds{1}),
+              DecodeStatus::Ok)
+        << "Failed on call " << i;
+    ASSERT_TRUE(rec->Holds<OhlcvMsg>());
+    EXPECT_EQ(rec->Get<OhlcvMsg>(), kRec);
+  }
+  // With no more records in flight, the non-throwing API reports the
+  // timeout as a status
+  const Record* rec;
+  EXPECT_EQ(target.TryNextRecord(&rec, std::chrono::milliseconds{50}),
+            DecodeStatus::Timeout);
+  EXPECT_EQ(rec, nullptr);
+  EXPECT_EQ(target.TryNextRecordNoWait(&rec), DecodeStatus::Timeout);
+  EXPECT_EQ(rec, nullptr);
+}
+
+TEST_F(LiveBlockingTests, TestSuppressHeartbeats) {
+  constexpr auto kTsOut = false;
+  constexpr OhlcvMsg kRec{DummyHeader<OhlcvMsg>(RType::Ohlcv1M), 1, 2, 3, 4, 5};
+  SystemMsg heartbeat{DummyHeader<SystemMsg>(RType::System), {}, 0};
+  std::strncpy(heartbeat.msg.data(), "Heartbeat", heartbeat.msg.size() - 1);
+  const mock::MockLsgServer mock_server{
+      dataset::kXnasItch, kTsOut,
+      [kRec, heartbeat](mock::MockLsgServer& self) {
+        self.Accept();
+        self.Authenticate();
+        self.SendRecord(heartbeat);
+        self.SendRecord(kRec);
+        self.SendRecord(heartbeat);
+        self.SendRecord(kRec);
+      }};
+
+  LiveBlocking target{
+      logger_.get(),      kKey,   dataset::kXnasItch,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  target.SuppressHeartbeats(true);
+  // No records yet, so the session can't be considered stale
+  EXPECT_FALSE(target.IsSessionStale(std::chrono::milliseconds{1}));
+  // The heartbeats are consumed internally
+  for (std::size_t i = 0; i < 2; ++i) {
+    const Record& rec = target.NextRecord();
+    ASSERT_TRUE(rec.Holds<OhlcvMsg>()) << "Failed on call " << i;
+    EXPECT_EQ(rec.Get<OhlcvMsg>(), kRec);
+  }
+  EXPECT_FALSE(target.IsSessionStale(std::chrono::seconds{10}));
+  std::this_thread::sleep_for(std::chrono::milliseconds{20});
+  EXPECT_TRUE(target.IsSessionStale(std::chrono::milliseconds{1}));
+  EXPECT_GT(target.SinceLastHeartbeat().count(), 0);
+}
+
+TEST_F(LiveBlockingTests, TestNextRecordBatch) {
+  constexpr auto kTsOut = false;
+  constexpr std::size_t kRecCount = 12;
+  constexpr OhlcvMsg kRec{DummyHeader<OhlcvMsg>(RType::Ohlcv1M), 1, 2, 3, 4, 5};
+  const mock::MockLsgServer mock_server{
+      dataset::kXnasItch, kTsOut, [kRec](mock::MockLsgServer& self) {
+        self.Accept();
+        self.Authenticate();
+        for (std::size_t i = 0; i < kRecCount; ++i) {
+          self.SendRecord(kRec);
+        }
+      }};
+
+  LiveBlocking target{
+      logger_.get(),      kKey,   dataset::kXnasItch,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  std::size_t rec_count{};
+  while (rec_count < kRecCount) {
+    const auto& batch = target.NextRecordBatch(std::chrono::milliseconds{100});
+    for (const auto& rec : batch) {
+      ASSERT_TRUE(rec.Holds<OhlcvMsg>()) << "Failed on record " << rec_count;
+      EXPECT_EQ(rec.Get<OhlcvMsg>(), kRec);
+      ++rec_count;
+    }
+  }
+  EXPECT_EQ(rec_count, kRecCount);
+}
+
+TEST_F(LiveBlockingTests, TestNextRecordNoWait) {
+  constexpr auto kTsOut = false;
+  constexpr OhlcvMsg kRec{DummyHeader<OhlcvMsg>(RType::Ohlcv1M), 1, 2, 3, 4, 5};
+  const mock::MockLsgServer mock_server{dataset::kXnasItch, kTsOut,
+                                        [kRec](mock::MockLsgServer& self) {
+                                          self.Accept();
+                                          self.Authenticate();
+                                          self.SendRecord(kRec);
+                                          self.SendRecord(kRec);
+                                        }};
+
+  LiveBlocking target{
+      logger_.get(),      kKey,   dataset::kXnasItch,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  // spin-then-poll wait for the first record
+  const auto* rec = target.NextRecord(std::chrono::milliseconds{100},
+                                      std::chrono::microseconds{10});
+  ASSERT_NE(rec, nullptr);
+  EXPECT_EQ(rec->Get<OhlcvMsg>(), kRec);
+  // poll for the second
+  do {
+    rec = target.NextRecordNoWait();
+  } while (rec == nullptr);
+  EXPECT_EQ(rec->Get<OhlcvMsg>(), kRec);
+}
+
+TEST_F(LiveBlockingTests, TestJournal) {
+  constexpr auto kTsOut = false;
+  constexpr std::size_t kRecCount = 5;
+  constexpr OhlcvMsg kRec{DummyHeader<OhlcvMsg>(RType::Ohlcv1M), 1, 2, 3, 4, 5};
+  const std::string path_prefix = testing::TempDir() + "/live_journal";
+  const TempFile segment_file{path_prefix + ".0"};
+  {
+    const mock::MockLsgServer mock_server{
+        dataset::kXnasItch, kTsOut, [kRec](mock::MockLsgServer& self) {
+          self.Accept();
+          self.Authenticate();
+          self.Start();
+          for (std::size_t i = 0; i < kRecCount; ++i) {
+            self.SendRecord(kRec);
+          }
+        }};
+
+    LiveBlocking target{
+        logger_.get(),      kKey,   dataset::kXnasItch,    kLocalhost,
+        mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+    detail::JournalWriter::Conf journal_conf;
+    journal_conf.path_prefix = path_prefix;
+    target.EnableJournal(journal_conf);
+    target.Start();
+    for (std::size_t i = 0; i < kRecCount; ++i) {
+      target.NextRecord();
+    }
+    // Destroying the client flushes the journal
+  }
+  // The journal is a valid DBN stream reproducing the session byte-for-byte
+  DbnFileStore replay{segment_file.Path(), VersionUpgradePolicy::AsIs};
+  std::size_t rec_count{};
+  replay.Replay(
+      [](Metadata&& metadata) {
+        EXPECT_EQ(metadata.dataset, dataset::kXnasItch);
+      },
+      [&rec_count, kRec](const Record& rec) {
+        EXPECT_EQ(rec.Get<OhlcvMsg>(), kRec);
+        ++rec_count;
+        return KeepGoing::Continue;
+      });
+  EXPECT_EQ(rec_count, kRecCount);
+}
+
 TEST_F(LiveBlockingTests, TestNextRecordTimeout) {
   constexpr std::chrono::milliseconds kTimeout{50};
   constexpr auto kTsOut = false;
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "databento/constants.hpp"  // dataset
+#include "databento/datetime.hpp"
+#include "databento/enums.hpp"  // Schema, SType
+#include "databento/live_hot_standby.hpp"
+#include "databento/log.hpp"
+#include "databento/record.hpp"
+#include "mock/mock_lsg_server.hpp"  // MockLsgServer
+
+namespace databento {
+namespace test {
+class LiveHotStandbyTests : public testing::Test {
+ protected:
+  template <typename T>
+  static constexpr RecordHeader DummyHeader(RType rtype) {
+    return {sizeof(T) / RecordHeader::kLengthMultiplier, rtype, 1, 1,
+            UnixNanos{}};
+  }
+
+  static MboMsg DummyMbo(std::uint32_t sequence) {
+    MboMsg rec{};
+    rec.hd = DummyHeader<MboMsg>(RType::Mbo);
+    rec.sequence = sequence;
+    return rec;
+  }
+
+  static constexpr auto kKey = "32-character-with-lots-of-filler";
+  static constexpr auto kLocalhost = "127.0.0.1";
+
+  std::unique_ptr<ILogReceiver> logger_{new NullLogReceiver};
+};
+
+TEST_F(LiveHotStandbyTests, TestFailoverDedupe) {
+  constexpr auto kTsOut = false;
+  constexpr auto kDataset = dataset::kXnasItch;
+  const std::vector<std::string> kSymbols{"MSFT"};
+  constexpr auto kSchema = Schema::Mbo;
+  constexpr auto kSType = SType::RawSymbol;
+
+  const mock::MockLsgServer mock_server{
+      kDataset, kTsOut, [&kSymbols](mock::MockLsgServer& self) {
+        // primary connection
+        self.Accept();
+        self.Authenticate();
+        // standby connection
+        self.AcceptSwapConn();
+        self.Authenticate();
+        // the client subscribes the primary first
+        self.SwapConn();
+        self.Subscribe(kSymbols, kSchema, kSType);
+        self.SwapConn();
+        self.Subscribe(kSymbols, kSchema, kSType);
+        // the standby is started first so its stream covers the primary's
+        self.Start();
+        self.SwapConn();
+        self.Start();
+        // two records on the primary, then it dies
+        self.SendRecord(DummyMbo(1));
+        self.SendRecord(DummyMbo(2));
+        self.Close();
+        // the standby repeats the overlap before making progress
+        self.SwapConn();
+        self.SendRecord(DummyMbo(1));
+        self.SendRecord(DummyMbo(2));
+        self.SendRecord(DummyMbo(3));
+      }};
+
+  LiveHotStandby target{logger_.get(),
+                        kKey,
+                        kDataset,
+                        kLocalhost,
+                        mock_server.Port(),
+                        kTsOut,
+                        VersionUpgradePolicy{},
+                        {}};
+  target.Subscribe(kSymbols, kSchema, kSType);
+  target.Start();
+  for (std::uint32_t seq = 1; seq <= 3; ++seq) {
+    const auto& rec = target.NextRecord();
+    ASSERT_TRUE(rec.Holds<MboMsg>()) << "Failed on sequence " << seq;
+    // sequences 1 and 2 are replayed by the standby after the failover, but
+    // should only be delivered once
+    EXPECT_EQ(rec.Get<MboMsg>().sequence, seq);
+  }
+  EXPECT_EQ(target.FailoverCount(), 1);
+  EXPECT_FALSE(target.StandbyReady());
+}
+
+TEST_F(LiveHotStandbyTests, TestNoStandbyRethrows) {
+  constexpr auto kTsOut = false;
+  constexpr auto kDataset = dataset::kXnasItch;
+
+  const mock::MockLsgServer mock_server{kDataset, kTsOut,
+                                        [](mock::MockLsgServer& self) {
+                                          self.Accept();
+                                          self.Authenticate();
+                                          self.AcceptSwapConn();
+                                          self.Authenticate();
+                                          self.Start();
+                                          self.SwapConn();
+                                          self.Start();
+                                          self.SendRecord(DummyMbo(1));
+                                          self.Close();
+                                          self.SwapConn();
+                                          self.Close();
+                                        }};
+
+  LiveHotStandby target{logger_.get(),
+                        kKey,
+                        kDataset,
+                        kLocalhost,
+                        mock_server.Port(),
+                        kTsOut,
+                        VersionUpgradePolicy{},
+                        {}};
+  target.Start();
+  const auto& rec = target.NextRecord();
+  EXPECT_EQ(rec.Get<MboMsg>().sequence, 1);
+  // both connections are gone: the failure should surface after one failover
+  EXPECT_THROW(target.NextRecord(), std::exception);
+  EXPECT_EQ(target.FailoverCount(), 1);
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>   // milliseconds, steady_clock
+#include <cstddef>
+#include <memory>
+#include <thread>  // this_thread
+
+#include "databento/constants.hpp"  // dataset
+#include "databento/enums.hpp"      // RType, VersionUpgradePolicy
+#include "databento/live_blocking.hpp"
+#include "databento/live_session_group.hpp"
+#include "databento/log.hpp"
+#include "databento/record.hpp"
+#include "mock/mock_lsg_server.hpp"  // MockLsgServer
+
+namespace databento {
+namespace test {
+class LiveSessionGroupTests : public testing::Test {
+ protected:
+  template <typename T>
+  static constexpr RecordHeader DummyHeader(RType rtype) {
+    return {sizeof(T) / RecordHeader::kLengthMultiplier, rtype, 1, 1,
+            UnixNanos{}};
+  }
+
+  static constexpr auto kKey = "32-character-with-lots-of-filler";
+  static constexpr auto kLocalhost = "127.0.0.1";
+
+  LiveBlocking MakeSession(const mock::MockLsgServer& mock_server,
+                           const char* dataset) {
+    return LiveBlocking{logger_.get(), kKey,  dataset,
+                        kLocalhost,    mock_server.Port(),
+                        false,         VersionUpgradePolicy{}};
+  }
+
+  std::unique_ptr<ILogReceiver> logger_{new NullLogReceiver};
+};
+
+TEST_F(LiveSessionGroupTests, TestMultiplexedSessions) {
+  constexpr auto kTsOut = false;
+  constexpr auto kRecCount = 5;
+  constexpr OhlcvMsg kRec{DummyHeader<OhlcvMsg>(RType::Ohlcv1M), 1, 2, 3, 4, 5};
+  const auto serve_fn = [kRec](mock::MockLsgServer& self) {
+    self.Accept();
+    self.Authenticate();
+    self.Start();
+    for (std::size_t i = 0; i < kRecCount; ++i) {
+      self.SendRecord(kRec);
+    }
+    self.Close();
+  };
+  const mock::MockLsgServer server_a{dataset::kXnasItch, kTsOut, serve_fn};
+  const mock::MockLsgServer server_b{dataset::kGlbxMdp3, kTsOut, serve_fn};
+
+  LiveSessionGroup target{logger_.get()};
+  ASSERT_EQ(target.AddSession(MakeSession(server_a, dataset::kXnasItch)), 0);
+  ASSERT_EQ(target.AddSession(MakeSession(server_b, dataset::kGlbxMdp3)), 1);
+  ASSERT_EQ(target.SessionCount(), 2);
+  const auto metadata = target.Start();
+  ASSERT_EQ(metadata.size(), 2);
+  std::array<std::size_t, 2> counts{};
+  // runs until both servers close their session
+  target.Run([&counts, kRec](std::size_t session, const Record& record) {
+    EXPECT_TRUE(record.Holds<OhlcvMsg>());
+    EXPECT_EQ(record.Get<OhlcvMsg>(), kRec);
+    ++counts.at(session);
+    return KeepGoing::Continue;
+  });
+  EXPECT_EQ(counts[0], kRecCount);
+  EXPECT_EQ(counts[1], kRecCount);
+}
+
+TEST_F(LiveSessionGroupTests, TestRunOrdered) {
+  constexpr auto kTsOut = false;
+  constexpr auto kRecCount = 5;
+  // A generous window so the expected order is deterministic: records are
+  // only delivered once both sessions have records (or close)
+  constexpr std::chrono::seconds kStalenessWindow{10};
+  // Sends records with ts_event values first, first + 2, ...
+  const auto make_serve_fn = [](std::uint64_t first) {
+    return [first](mock::MockLsgServer& self) {
+      self.Accept();
+      self.Authenticate();
+      self.Start();
+      for (std::size_t i = 0; i < kRecCount; ++i) {
+        OhlcvMsg rec{DummyHeader<OhlcvMsg>(RType::Ohlcv1M), 0, 0, 0, 0, 0};
+        rec.hd.ts_event = UnixNanos{std::chrono::nanoseconds{first + 2 * i}};
+        self.SendRecord(rec);
+      }
+      self.Close();
+    };
+  };
+  const mock::MockLsgServer server_a{dataset::kXnasItch, kTsOut,
+                                     make_serve_fn(1)};
+  const mock::MockLsgServer server_b{dataset::kGlbxMdp3, kTsOut,
+                                     make_serve_fn(2)};
+
+  LiveSessionGroup target{logger_.get()};
+  target.AddSession(MakeSession(server_a, dataset::kXnasItch));
+  target.AddSession(MakeSession(server_b, dataset::kGlbxMdp3));
+  target.Start();
+  std::uint64_t expected_ts = 1;
+  // runs until both servers close their session
+  target.RunOrdered(
+      kStalenessWindow,
+      [&expected_ts](std::size_t, const Record& record) {
+        EXPECT_EQ(record.Header().ts_event.time_since_epoch().count(),
+                  expected_ts);
+        ++expected_ts;
+        return KeepGoing::Continue;
+      });
+  EXPECT_EQ(expected_ts, 2 * kRecCount + 1);
+}
+
+TEST_F(LiveSessionGroupTests, TestRunOrderedStalenessWindow) {
+  constexpr auto kTsOut = false;
+  constexpr std::chrono::milliseconds kStalenessWindow{50};
+  std::atomic<bool> done{false};
+  const auto serve_fn = [&done](bool send) {
+    return [&done, send](mock::MockLsgServer& self) {
+      self.Accept();
+      self.Authenticate();
+      self.Start();
+      if (send) {
+        OhlcvMsg rec{DummyHeader<OhlcvMsg>(RType::Ohlcv1M), 1, 2, 3, 4, 5};
+        self.SendRecord(rec);
+      }
+      // Keep the session open so only the staleness window can release the
+      // held record
+      while (!done) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+      }
+    };
+  };
+  const mock::MockLsgServer server_a{dataset::kXnasItch, kTsOut,
+                                     serve_fn(true)};
+  const mock::MockLsgServer server_b{dataset::kGlbxMdp3, kTsOut,
+                                     serve_fn(false)};
+
+  LiveSessionGroup target{logger_.get()};
+  target.AddSession(MakeSession(server_a, dataset::kXnasItch));
+  target.AddSession(MakeSession(server_b, dataset::kGlbxMdp3));
+  target.Start();
+  std::size_t count{};
+  const auto start = std::chrono::steady_clock::now();
+  target.RunOrdered(kStalenessWindow,
+                    [&count](std::size_t, const Record&) {
+                      ++count;
+                      return KeepGoing::Stop;
+                    });
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  done = true;
+  EXPECT_EQ(count, 1);
+  EXPECT_GE(elapsed, kStalenessWindow);
+}
+
+TEST_F(LiveSessionGroupTests, TestStop) {
+  constexpr auto kTsOut = false;
+  constexpr OhlcvMsg kRec{DummyHeader<OhlcvMsg>(RType::Ohlcv1M), 1, 2, 3, 4, 5};
+  const mock::MockLsgServer mock_server{
+      dataset::kXnasItch, kTsOut, [kRec](mock::MockLsgServer& self) {
+        self.Accept();
+        self.Authenticate();
+        self.Start();
+        for (std::size_t i = 0; i < 3; ++i) {
+          self.SendRecord(kRec);
+        }
+      }};
+
+  LiveSessionGroup target{logger_.get()};
+  target.AddSession(MakeSession(mock_server, dataset::kXnasItch));
+  target.Start();
+  std::size_t count{};
+  target.Run([&count](std::size_t, const Record&) {
+    ++count;
+    return KeepGoing::Stop;
+  });
+  EXPECT_EQ(count, 1);
+}
+}  // namespace test
+}  // namespace databento
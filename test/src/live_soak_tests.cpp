@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>   // milliseconds, steady_clock
+#include <cstdint>
+#include <cstdlib>  // getenv, strtoull
+#include <iostream>
+#include <limits>  // numeric_limits
+#include <memory>
+
+#include "databento/constants.hpp"
+#include "databento/enums.hpp"
+#include "databento/live_threaded.hpp"
+#include "databento/log.hpp"
+#include "databento/record.hpp"
+#include "mock/mock_lsg_server.hpp"
+
+namespace databento {
+namespace test {
+// Soak and throughput tests running LiveThreaded against a mock gateway
+// streaming generated DBN at max rate. Record counts are sized to finish in
+// well under a second on CI; set DATABENTO_SOAK_RECORDS to scale them up
+// for a real capacity soak.
+class LiveSoakTests : public testing::Test {
+ protected:
+  static std::size_t SoakRecordCount(std::size_t default_count) {
+    const char* env = std::getenv("DATABENTO_SOAK_RECORDS");
+    if (env == nullptr) {
+      return default_count;
+    }
+    return static_cast<std::size_t>(std::strtoull(env, nullptr, 10));
+  }
+
+  static constexpr auto kKey = "32-character-with-lots-of-filler";
+  static constexpr auto kTsOut = false;
+  static constexpr auto kLocalhost = "127.0.0.1";
+
+  std::unique_ptr<ILogReceiver> logger_{new NullLogReceiver};
+};
+
+TEST_F(LiveSoakTests, TestMaxRateThroughputNoDrops) {
+  const auto kRecordCount = SoakRecordCount(200000);
+  std::atomic<std::size_t> sent_count{};
+  const mock::MockLsgServer mock_server{
+      dataset::kGlbxMdp3, kTsOut,
+      [kRecordCount, &sent_count](mock::MockLsgServer& self) {
+        self.Accept();
+        self.Authenticate();
+        self.Start();
+        sent_count = self.StreamMboBursts(kRecordCount, 1024,
+                                          std::chrono::nanoseconds{});
+      }};
+
+  LiveThreaded target{
+      logger_.get(),      kKey,   dataset::kGlbxMdp3,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  std::size_t recv_count{};
+  std::size_t gap_count{};
+  std::chrono::steady_clock::time_point first_recv;
+  std::chrono::steady_clock::time_point last_recv;
+  target.Start([kRecordCount, &recv_count, &gap_count, &first_recv,
+                &last_recv](const Record& rec) {
+    if (recv_count == 0) {
+      first_recv = std::chrono::steady_clock::now();
+    }
+    // A sequence jump means a record was dropped somewhere on the path
+    if (rec.Get<MboMsg>().sequence != static_cast<std::uint32_t>(recv_count)) {
+      ++gap_count;
+    }
+    ++recv_count;
+    if (recv_count < kRecordCount) {
+      return KeepGoing::Continue;
+    }
+    last_recv = std::chrono::steady_clock::now();
+    return KeepGoing::Stop;
+  });
+  target.BlockForStop();
+  EXPECT_EQ(sent_count.load(), kRecordCount);
+  EXPECT_EQ(recv_count, kRecordCount);
+  EXPECT_EQ(gap_count, 0);
+  const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      last_recv - first_recv);
+  ASSERT_GT(elapsed.count(), 0);
+  std::cout << "Sustained " << kRecordCount << " records in "
+            << elapsed.count() / 1000000 << " ms ("
+            << kRecordCount * 1000000000ULL /
+                   static_cast<std::uint64_t>(elapsed.count())
+            << " records/s)\n";
+}
+
+TEST_F(LiveSoakTests, TestBurstPatternKeepsUp) {
+  const auto kRecordCount = SoakRecordCount(50000);
+  const mock::MockLsgServer mock_server{
+      dataset::kGlbxMdp3, kTsOut,
+      [kRecordCount](mock::MockLsgServer& self) {
+        self.Accept();
+        self.Authenticate();
+        self.Start();
+        // 500-record bursts every 100us approximate a venue's bursty
+        // microstructure rather than a smooth firehose
+        self.StreamMboBursts(kRecordCount, 500,
+                             std::chrono::nanoseconds{100000});
+      }};
+
+  LiveThreaded target{
+      logger_.get(),      kKey,   dataset::kGlbxMdp3,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  std::size_t recv_count{};
+  std::size_t gap_count{};
+  target.Start([kRecordCount, &recv_count, &gap_count](const Record& rec) {
+    if (rec.Get<MboMsg>().sequence != static_cast<std::uint32_t>(recv_count)) {
+      ++gap_count;
+    }
+    ++recv_count;
+    return recv_count < kRecordCount ? KeepGoing::Continue : KeepGoing::Stop;
+  });
+  target.BlockForStop();
+  EXPECT_EQ(recv_count, kRecordCount);
+  EXPECT_EQ(gap_count, 0);
+}
+
+TEST_F(LiveSoakTests, TestShutdownLatencyUnderLoad) {
+  std::unique_ptr<mock::MockLsgServer> mock_server{new mock::MockLsgServer{
+      dataset::kGlbxMdp3, kTsOut, [](mock::MockLsgServer& self) {
+        self.Accept();
+        self.Authenticate();
+        self.Start();
+        // Firehose until the client disconnects
+        self.StreamMboBursts(std::numeric_limits<std::size_t>::max(), 1024,
+                             std::chrono::nanoseconds{});
+      }}};
+
+  std::chrono::steady_clock::time_point stop_requested;
+  {
+    LiveThreaded target{
+        logger_.get(),       kKey,   dataset::kGlbxMdp3,    kLocalhost,
+        mock_server->Port(), kTsOut, VersionUpgradePolicy{}};
+    std::size_t recv_count{};
+    target.Start([&recv_count, &stop_requested](const Record&) {
+      ++recv_count;
+      if (recv_count < 10000) {
+        return KeepGoing::Continue;
+      }
+      stop_requested = std::chrono::steady_clock::now();
+      return KeepGoing::Stop;
+    });
+    target.BlockForStop();
+  }
+  // The session must wind down promptly even with the gateway still
+  // blasting records at it
+  const auto shutdown_latency =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - stop_requested);
+  EXPECT_LT(shutdown_latency.count(), 1000);
+  // Join the server thread; the stream ends when it observes the disconnect
+  mock_server.reset();
+}
+}  // namespace test
+}  // namespace databento
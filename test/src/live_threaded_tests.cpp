@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>  // milliseconds, nanoseconds
 #include <cstdint>
 #include <exception>
 #include <iostream>
@@ -18,6 +19,7 @@
 #include "databento/record.hpp"
 #include "databento/symbology.hpp"
 #include "databento/timeseries.hpp"
+#include "databento/with_ts_out.hpp"
 #include "gtest/gtest.h"
 #include "mock/mock_lsg_server.hpp"
 
@@ -72,6 +74,330 @@ TEST_F(LiveThreadedTests, TestBasic) {
   target.BlockForStop();
 }
 
+TEST_F(LiveThreadedTests, TestLatencyWatch) {
+  const MboMsg kRec{DummyHeader<MboMsg>(RType::Mbo),
+                    1,
+                    2,
+                    3,
+                    0,
+                    4,
+                    Action::Add,
+                    Side::Bid,
+                    UnixNanos{},
+                    TimeDeltaNanos{},
+                    100};
+  const mock::MockLsgServer mock_server{dataset::kGlbxMdp3, kTsOut,
+                                        [&kRec](mock::MockLsgServer& self) {
+                                          self.Accept();
+                                          self.Authenticate();
+                                          self.Start();
+                                          self.SendRecord(kRec);
+                                          self.SendRecord(kRec);
+                                        }};
+
+  LiveThreaded target{
+      logger_.get(),      kKey,   dataset::kGlbxMdp3,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  std::atomic<std::uint32_t> slow_count{};
+  LiveThreaded::LatencyWatchConf latency_conf;
+  latency_conf.slow_threshold = std::chrono::milliseconds{5};
+  latency_conf.slow_hook =
+      [&slow_count](std::chrono::nanoseconds) { ++slow_count; };
+  target.EnableLatencyWatch(std::move(latency_conf));
+  std::uint32_t call_count{};
+  target.Start([&call_count](const Record&) {
+    ++call_count;
+    if (call_count == 2) {
+      // Only the second callback should trip the slow hook
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+      return KeepGoing::Stop;
+    }
+    return KeepGoing::Continue;
+  });
+  target.BlockForStop();
+  EXPECT_EQ(target.CallbackLatencies().Count(), 2);
+  EXPECT_GE(target.CallbackLatencies().ValueAtPercentile(100.0), 5000000);
+  EXPECT_EQ(slow_count, 1);
+}
+
+TEST_F(LiveThreadedTests, TestWireLatencyWatch) {
+  constexpr auto kSendTsOut = true;
+  constexpr std::uint32_t kRecCount = 3;
+  const auto ts_out =
+      std::chrono::time_point_cast<UnixNanos::duration>(
+          std::chrono::system_clock::now());
+  const WithTsOut<MboMsg> kRec{{DummyHeader<MboMsg>(RType::Mbo),
+                                1,
+                                2,
+                                3,
+                                0,
+                                4,
+                                Action::Add,
+                                Side::Bid,
+                                UnixNanos{},
+                                TimeDeltaNanos{},
+                                100},
+                               ts_out};
+  const mock::MockLsgServer mock_server{dataset::kGlbxMdp3, kSendTsOut,
+                                        [&kRec](mock::MockLsgServer& self) {
+                                          self.Accept();
+                                          self.Authenticate();
+                                          self.Start();
+                                          for (std::uint32_t i = 0;
+                                               i < kRecCount; ++i) {
+                                            self.SendRecord(kRec);
+                                          }
+                                        }};
+
+  LiveThreaded target{
+      logger_.get(),      kKey,        dataset::kGlbxMdp3,    kLocalhost,
+      mock_server.Port(), kSendTsOut,  VersionUpgradePolicy{}};
+  target.EnableWireLatencyWatch();
+  std::uint32_t call_count{};
+  target.Start([&call_count](const Record&) {
+    ++call_count;
+    return call_count == kRecCount ? KeepGoing::Stop : KeepGoing::Continue;
+  });
+  target.BlockForStop();
+  EXPECT_EQ(target.WireLatencies().Count(), kRecCount);
+  // ts_out was stamped just before sending, so the measured wire latency
+  // should be positive and well under a minute
+  EXPECT_GT(target.WireLatencies().Max(), 0);
+  EXPECT_LT(target.WireLatencies().Max(), 60000000000ULL);
+}
+
+TEST_F(LiveThreadedTests, TestFastForward) {
+  constexpr std::size_t kStaleCount = 20;
+  constexpr std::size_t kFreshCount = 3;
+  MboMsg stale_rec{DummyHeader<MboMsg>(RType::Mbo),
+                   1,
+                   2,
+                   3,
+                   0,
+                   4,
+                   Action::Add,
+                   Side::Bid,
+                   UnixNanos{},
+                   TimeDeltaNanos{},
+                   100};
+  const auto now = std::chrono::time_point_cast<UnixNanos::duration>(
+      std::chrono::system_clock::now());
+  stale_rec.hd.ts_event = now - std::chrono::seconds{10};
+  MboMsg fresh_rec{stale_rec};
+  fresh_rec.hd.ts_event = now;
+  const mock::MockLsgServer mock_server{
+      dataset::kGlbxMdp3, kTsOut,
+      [&stale_rec, &fresh_rec](mock::MockLsgServer& self) {
+        self.Accept();
+        self.Authenticate();
+        self.Start();
+        // One send so the whole backlog arrives in a single read and the
+        // client sees it as buffered data
+        std::string backlog;
+        for (std::size_t i = 0; i < kStaleCount; ++i) {
+          backlog.append(reinterpret_cast<const char*>(&stale_rec),
+                         sizeof(stale_rec));
+        }
+        for (std::size_t i = 0; i < kFreshCount; ++i) {
+          backlog.append(reinterpret_cast<const char*>(&fresh_rec),
+                         sizeof(fresh_rec));
+        }
+        self.Send(backlog);
+      }};
+
+  LiveThreaded target{
+      logger_.get(),      kKey,   dataset::kGlbxMdp3,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  std::atomic<std::uint64_t> reported_records{};
+  std::atomic<std::uint64_t> reported_bytes{};
+  LiveThreaded::FastForwardConf ff_conf;
+  ff_conf.backlog_threshold_bytes = 1;
+  ff_conf.staleness_bound = std::chrono::seconds{1};
+  ff_conf.report_hook = [&reported_records, &reported_bytes](
+                            std::uint64_t records, std::uint64_t bytes) {
+    reported_records = records;
+    reported_bytes = bytes;
+  };
+  target.EnableFastForward(std::move(ff_conf));
+  std::uint32_t call_count{};
+  target.Start([&call_count, &now](const Record& rec) {
+    ++call_count;
+    // Stale records were skipped without reaching the callback
+    EXPECT_EQ(rec.Header().ts_event, now);
+    return call_count < kFreshCount ? KeepGoing::Continue : KeepGoing::Stop;
+  });
+  target.BlockForStop();
+  EXPECT_EQ(call_count, kFreshCount);
+  EXPECT_EQ(target.FastForwardSkipCount(), kStaleCount);
+  EXPECT_EQ(reported_records.load(), kStaleCount);
+  EXPECT_EQ(reported_bytes.load(), kStaleCount * sizeof(MboMsg));
+}
+
+TEST_F(LiveThreadedTests, TestStaleWatch) {
+  const MboMsg kRec{DummyHeader<MboMsg>(RType::Mbo),
+                    1,
+                    2,
+                    3,
+                    0,
+                    4,
+                    Action::Add,
+                    Side::Bid,
+                    UnixNanos{},
+                    TimeDeltaNanos{},
+                    100};
+  const mock::MockLsgServer mock_server{dataset::kGlbxMdp3, kTsOut,
+                                        [&kRec](mock::MockLsgServer& self) {
+                                          self.Accept();
+                                          self.Authenticate();
+                                          self.Start();
+                                          self.SendRecord(kRec);
+                                          // then go silent
+                                        }};
+
+  LiveThreaded target{
+      logger_.get(),      kKey,   dataset::kGlbxMdp3,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  std::atomic<std::uint32_t> stale_count{};
+  LiveThreaded::StaleWatchConf stale_conf;
+  stale_conf.threshold = std::chrono::milliseconds{10};
+  stale_conf.stale_hook = [&stale_count] { ++stale_count; };
+  target.EnableStaleWatch(std::move(stale_conf));
+  std::atomic<bool> got_record{false};
+  target.Start([&got_record](const Record&) {
+    got_record = true;
+    return KeepGoing::Continue;
+  });
+  while (!got_record) {
+    std::this_thread::yield();
+  }
+  EXPECT_FALSE(target.IsSessionStale(std::chrono::seconds{10}));
+  // The gateway went silent, so the watch should fire exactly once
+  while (stale_count == 0) {
+    std::this_thread::yield();
+  }
+  EXPECT_TRUE(target.IsSessionStale(std::chrono::milliseconds{10}));
+  std::this_thread::sleep_for(std::chrono::milliseconds{120});
+  EXPECT_EQ(stale_count, 1);
+}
+
+TEST_F(LiveThreadedTests, TestThreadConf) {
+  const MboMsg kRec{DummyHeader<MboMsg>(RType::Mbo),
+                    1,
+                    2,
+                    3,
+                    0,
+                    4,
+                    Action::Add,
+                    Side::Bid,
+                    UnixNanos{},
+                    TimeDeltaNanos{},
+                    100};
+  const mock::MockLsgServer mock_server{dataset::kGlbxMdp3, kTsOut,
+                                        [&kRec](mock::MockLsgServer& self) {
+                                          self.Accept();
+                                          self.Authenticate();
+                                          self.Start();
+                                          self.SendRecord(kRec);
+                                        }};
+
+  LiveThreaded target{
+      logger_.get(),      kKey,   dataset::kGlbxMdp3,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  LiveThreaded::ThreadConf thread_conf;
+  thread_conf.cpu = 0;
+  thread_conf.numa_node = 0;
+  thread_conf.name = "db-live";
+  target.SetThreadConf(thread_conf);
+  target.Start([&kRec](const Record& rec) {
+    EXPECT_TRUE(rec.Holds<MboMsg>());
+    EXPECT_EQ(rec.Get<MboMsg>(), kRec);
+    return KeepGoing::Stop;
+  });
+  target.BlockForStop();
+}
+
+TEST_F(LiveThreadedTests, TestBatchedCallback) {
+  constexpr std::uint32_t kRecCount = 4;
+  const MboMsg kRec{DummyHeader<MboMsg>(RType::Mbo),
+                    1,
+                    2,
+                    3,
+                    0,
+                    4,
+                    Action::Add,
+                    Side::Bid,
+                    UnixNanos{},
+                    TimeDeltaNanos{},
+                    100};
+  const mock::MockLsgServer mock_server{dataset::kGlbxMdp3, kTsOut,
+                                        [&kRec](mock::MockLsgServer& self) {
+                                          self.Accept();
+                                          self.Authenticate();
+                                          self.Start();
+                                          for (std::uint32_t i = 0;
+                                               i < kRecCount; ++i) {
+                                            self.SendRecord(kRec);
+                                          }
+                                        }};
+
+  LiveThreaded target{
+      logger_.get(),      kKey,   dataset::kGlbxMdp3,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  std::uint32_t rec_count{};
+  target.Start([&rec_count, &kRec](const std::vector<Record>& batch) {
+    EXPECT_FALSE(batch.empty());
+    for (const auto& rec : batch) {
+      ++rec_count;
+      EXPECT_TRUE(rec.Holds<MboMsg>());
+      EXPECT_EQ(rec.Get<MboMsg>(), kRec);
+    }
+    return rec_count < kRecCount ? KeepGoing::Continue : KeepGoing::Stop;
+  });
+  target.BlockForStop();
+  EXPECT_EQ(rec_count, kRecCount);
+}
+
+TEST_F(LiveThreadedTests, TestQueuedCallback) {
+  constexpr std::uint32_t kRecCount = 8;
+  const MboMsg kRec{DummyHeader<MboMsg>(RType::Mbo),
+                    1,
+                    2,
+                    3,
+                    0,
+                    4,
+                    Action::Add,
+                    Side::Bid,
+                    UnixNanos{},
+                    TimeDeltaNanos{},
+                    100};
+  const mock::MockLsgServer mock_server{dataset::kGlbxMdp3, kTsOut,
+                                        [&kRec](mock::MockLsgServer& self) {
+                                          self.Accept();
+                                          self.Authenticate();
+                                          self.Start();
+                                          for (std::uint32_t i = 0;
+                                               i < kRecCount; ++i) {
+                                            self.SendRecord(kRec);
+                                          }
+                                        }};
+
+  LiveThreaded target{
+      logger_.get(),      kKey,   dataset::kGlbxMdp3,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  LiveThreaded::QueueConf queue_conf;
+  queue_conf.capacity = 4;
+  std::uint32_t rec_count{};
+  target.Start(queue_conf, [&rec_count, &kRec](const Record& rec) {
+    ++rec_count;
+    EXPECT_TRUE(rec.Holds<MboMsg>());
+    EXPECT_EQ(rec.Get<MboMsg>(), kRec);
+    return rec_count < kRecCount ? KeepGoing::Continue : KeepGoing::Stop;
+  });
+  target.BlockForStop();
+  EXPECT_EQ(rec_count, kRecCount);
+  EXPECT_EQ(target.QueueDropCount(), 0);
+}
+
 TEST_F(LiveThreadedTests, TestTimeoutRecovery) {
   const MboMsg kRec{DummyHeader<MboMsg>(RType::Mbo),
                     1,
@@ -244,6 +570,93 @@ TEST_F(LiveThreadedTests, TestExceptionCallbackAndReconnect) {
   EXPECT_EQ(record_calls, 1);
 }
 
+TEST_F(LiveThreadedTests, TestGapBackfillOnReconnect) {
+  constexpr auto kSchema = Schema::Mbo;
+  constexpr auto kSType = SType::RawSymbol;
+  MboMsg rec{DummyHeader<MboMsg>(RType::Mbo),
+             1,
+             2,
+             3,
+             0,
+             4,
+             Action::Add,
+             Side::Bid,
+             UnixNanos{},
+             TimeDeltaNanos{},
+             100};
+  bool should_close{};
+  std::mutex should_close_mutex;
+  std::condition_variable should_close_cv;
+  const mock::MockLsgServer mock_server{
+      dataset::kGlbxMdp3, kTsOut,
+      [&rec, &should_close, &should_close_mutex,
+       &should_close_cv](mock::MockLsgServer& self) {
+        self.Accept();
+        self.Authenticate();
+        self.Subscribe(kAllSymbols, kSchema, kSType);
+        self.Start();
+        for (const auto ts_event : {1000, 2000, 3000}) {
+          rec.hd.ts_event = UnixNanos{std::chrono::nanoseconds{ts_event}};
+          self.SendRecord(rec);
+        }
+        {
+          std::unique_lock<std::mutex> shutdown_lock{should_close_mutex};
+          should_close_cv.wait(shutdown_lock,
+                               [&should_close] { return should_close; });
+        }
+        self.Close();
+        self.Accept();
+        self.Authenticate();
+        // `Reconnect` re-subscribes on its own, with the replay start set to
+        // the last delivered ts_event
+        self.Subscribe(kAllSymbols, kSchema, kSType, "3000");
+        self.Start();
+        // The replay overlaps the records sent before the disconnect
+        for (const auto ts_event : {2000, 3000, 4000, 5000}) {
+          rec.hd.ts_event = UnixNanos{std::chrono::nanoseconds{ts_event}};
+          self.SendRecord(rec);
+        }
+      }};
+  LiveThreaded target{
+      logger_.get(),      kKey,   dataset::kGlbxMdp3,    kLocalhost,
+      mock_server.Port(), kTsOut, VersionUpgradePolicy{}};
+  std::atomic<std::uint64_t> reported_deduped{};
+  LiveThreaded::GapBackfillConf backfill_conf;
+  backfill_conf.report_hook = [&reported_deduped](std::uint64_t deduped) {
+    reported_deduped = deduped;
+  };
+  target.EnableGapBackfill(std::move(backfill_conf));
+  // Only touched by the processing thread
+  std::vector<std::uint64_t> delivered;
+  const auto record_cb = [&delivered, &should_close, &should_close_mutex,
+                          &should_close_cv](const Record& record) {
+    delivered.emplace_back(record.Header().ts_event.time_since_epoch().count());
+    if (delivered.size() == 3) {
+      // close server to force a reconnect
+      const std::lock_guard<std::mutex> _lock{should_close_mutex};
+      should_close = true;
+      should_close_cv.notify_one();
+      return KeepGoing::Continue;
+    }
+    return delivered.size() < 5 ? KeepGoing::Continue : KeepGoing::Stop;
+  };
+  const auto exception_cb = [&target](const std::exception& exc) {
+    EXPECT_NE(dynamic_cast<const databento::DbnResponseError*>(&exc), nullptr)
+        << "Unexpected exception type";
+    // No manual re-subscription: backfill replays the remembered one
+    target.Reconnect();
+    return LiveThreaded::ExceptionAction::Restart;
+  };
+  target.Subscribe(kAllSymbols, kSchema, kSType);
+  target.Start({}, record_cb, exception_cb);
+  target.BlockForStop();
+  // The duplicated overlap was dropped, leaving one complete stream
+  const std::vector<std::uint64_t> kExpDelivered{1000, 2000, 3000, 4000, 5000};
+  EXPECT_EQ(delivered, kExpDelivered);
+  EXPECT_EQ(target.GapBackfillDedupeCount(), 2);
+  EXPECT_EQ(reported_deduped.load(), 2);
+}
+
 TEST_F(LiveThreadedTests, TestDeadlockPrevention) {
   constexpr auto kSchema = Schema::Trades;
   constexpr auto kSType = SType::Parent;
@@ -1,8 +1,16 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>  // find_if
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <iostream>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <thread>
+#include <utility>  // pair
+#include <vector>
 
 #include "databento/log.hpp"
 
@@ -29,10 +37,136 @@ TEST_F(ConsoleLogReceiverTests, TestFilter) {
   ASSERT_TRUE(output.empty());
 }
 
+TEST_F(ConsoleLogReceiverTests, TestShouldLog) {
+  EXPECT_FALSE(target_.ShouldLog(LogLevel::Debug));
+  EXPECT_TRUE(target_.ShouldLog(LogLevel::Info));
+  EXPECT_TRUE(target_.ShouldLog(LogLevel::Error));
+}
+
+TEST_F(ConsoleLogReceiverTests, TestLogIfDefersFormatting) {
+  int format_count = 0;
+  LogIf(&target_, LogLevel::Debug, [&format_count] {
+    ++format_count;
+    return std::string{"debug message"};
+  });
+  EXPECT_EQ(format_count, 0);
+  EXPECT_TRUE(stream_.str().empty());
+  LogIf(&target_, LogLevel::Warning, [&format_count] {
+    ++format_count;
+    return std::string{"warning message"};
+  });
+  EXPECT_EQ(format_count, 1);
+  EXPECT_EQ(stream_.str(), "warning message\n");
+}
+
+TEST(NullLogReceiverTests, TestShouldLog) {
+  NullLogReceiver target;
+  EXPECT_FALSE(target.ShouldLog(LogLevel::Error));
+}
+
 TEST(ILogReceiverTests, TestDefault) {
   auto* log_receiver = ILogReceiver::Default();
   ASSERT_NE(log_receiver, nullptr);
   ASSERT_NE(dynamic_cast<ConsoleLogReceiver*>(log_receiver), nullptr);
 }
+
+namespace {
+class CaptureLogReceiver : public ILogReceiver {
+ public:
+  void Receive(LogLevel level, const std::string& msg) override {
+    std::lock_guard<std::mutex> lock{mutex_};
+    while (blocked_.load()) {
+      // Simulate a stalled sink while the test holds `blocked_`
+    }
+    msgs_.emplace_back(level, msg);
+  }
+
+  void SetBlocked(bool blocked) { blocked_.store(blocked); }
+  std::vector<std::pair<LogLevel, std::string>> Messages() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return msgs_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::atomic<bool> blocked_{false};
+  std::vector<std::pair<LogLevel, std::string>> msgs_;
+};
+}  // namespace
+
+TEST(AsyncLogReceiverTests, TestDrainsInOrderOnDestruction) {
+  CaptureLogReceiver capture;
+  {
+    AsyncLogReceiver target{&capture, 64};
+    for (int i = 0; i < 50; ++i) {
+      target.Receive(LogLevel::Info, "msg" + std::to_string(i));
+    }
+  }
+  const auto msgs = capture.Messages();
+  ASSERT_EQ(msgs.size(), 50);
+  for (int i = 0; i < 50; ++i) {
+    EXPECT_EQ(msgs[static_cast<std::size_t>(i)].second,
+              "msg" + std::to_string(i));
+  }
+}
+
+TEST(AsyncLogReceiverTests, TestMultipleProducers) {
+  CaptureLogReceiver capture;
+  {
+    AsyncLogReceiver target{&capture, 4096};
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; ++t) {
+      producers.emplace_back([&target, t] {
+        for (int i = 0; i < 500; ++i) {
+          target.Receive(LogLevel::Info,
+                         't' + std::to_string(t) + 'm' + std::to_string(i));
+        }
+      });
+    }
+    for (auto& producer : producers) {
+      producer.join();
+    }
+  }
+  EXPECT_EQ(capture.Messages().size(), 2000);
+}
+
+TEST(AsyncLogReceiverTests, TestDropAndCountOnOverflow) {
+  CaptureLogReceiver capture;
+  capture.SetBlocked(true);
+  AsyncLogReceiver target{&capture, 4};
+  for (int i = 0; i < 100; ++i) {
+    target.Receive(LogLevel::Info, "x");
+  }
+  EXPECT_GE(target.DroppedCount(), 90);
+  capture.SetBlocked(false);
+  std::this_thread::sleep_for(std::chrono::milliseconds{50});
+  // The drop count is reported downstream once the ring drains
+  const auto msgs = capture.Messages();
+  const auto it = std::find_if(
+      msgs.begin(), msgs.end(),
+      [](const std::pair<LogLevel, std::string>& msg) {
+        return msg.second.find("Dropped") != std::string::npos;
+      });
+  EXPECT_NE(it, msgs.end());
+}
+
+TEST(AsyncLogReceiverTests, TestTruncatesLongMessages) {
+  CaptureLogReceiver capture;
+  {
+    AsyncLogReceiver target{&capture, 8};
+    target.Receive(LogLevel::Warning, std::string(1000, 'a'));
+  }
+  const auto msgs = capture.Messages();
+  ASSERT_EQ(msgs.size(), 1);
+  EXPECT_EQ(msgs[0].second, std::string(AsyncLogReceiver::kMaxMsgLen, 'a'));
+}
+
+TEST(AsyncLogReceiverTests, TestShouldLogForwards) {
+  std::ostringstream stream;
+  ConsoleLogReceiver console{LogLevel::Warning, stream};
+  AsyncLogReceiver target{&console, 8};
+  EXPECT_FALSE(target.ShouldLog(LogLevel::Info));
+  EXPECT_TRUE(target.ShouldLog(LogLevel::Error));
+}
 }  // namespace test
 }  // namespace databento
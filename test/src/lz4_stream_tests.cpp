@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "databento/detail/file_stream.hpp"
+#include "databento/detail/file_write_stream.hpp"
+#include "databento/detail/lz4_compress_stream.hpp"
+#include "databento/detail/lz4_stream.hpp"
+#include "databento/ireadable.hpp"
+#include "databento/iwritable.hpp"
+#include "temp_file.hpp"
+
+namespace databento {
+namespace detail {
+namespace test {
+TEST(Lz4StreamTests, TestLargeRoundTrip) {
+  TempFile temp_file{testing::TempDir() + "/lz4_round_trip.lz4"};
+  // Several times the compressor's input chunk size and the decompressor's
+  // read size, so both loop over their buffers
+  constexpr std::size_t kTransferSize = 5 * (1UL << 20);
+  std::vector<std::uint8_t> expected(kTransferSize);
+  for (std::size_t i = 0; i < kTransferSize; ++i) {
+    expected[i] = static_cast<std::uint8_t>(i * 31);
+  }
+  {
+    // Scoped so the frame is finished before reading back
+    Lz4CompressStream compressor{std::unique_ptr<IWritable>{
+        new FileWriteStream{temp_file.Path()}}};
+    compressor.WriteAll(expected.data(), expected.size());
+  }
+  Lz4Stream target{
+      std::unique_ptr<IReadable>{new FileStream{temp_file.Path()}}};
+  std::vector<std::uint8_t> res(kTransferSize);
+  target.ReadExact(res.data(), res.size());
+  std::size_t mismatches{};
+  for (std::size_t i = 0; i < kTransferSize; ++i) {
+    mismatches += res[i] != expected[i];
+  }
+  EXPECT_EQ(mismatches, 0);
+  std::uint8_t extra;
+  EXPECT_EQ(target.ReadSome(&extra, 1), 0);
+}
+
+TEST(Lz4StreamTests, TestHighCompressionLevel) {
+  TempFile temp_file{testing::TempDir() + "/lz4_hc.lz4"};
+  const std::vector<std::uint8_t> expected(100000, 0xAB);
+  {
+    // Positive levels select LZ4HC
+    Lz4CompressStream compressor{
+        9, std::unique_ptr<IWritable>{new FileWriteStream{temp_file.Path()}}};
+    compressor.WriteAll(expected.data(), expected.size());
+  }
+  Lz4Stream target{
+      std::unique_ptr<IReadable>{new FileStream{temp_file.Path()}}};
+  std::vector<std::uint8_t> res(expected.size());
+  target.ReadExact(res.data(), res.size());
+  EXPECT_EQ(res, expected);
+}
+}  // namespace test
+}  // namespace detail
+}  // namespace databento
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>  // any_of, equal
+#include <cstdint>
+#include <vector>
+
+#include "databento/detail/file_stream.hpp"
+#include "databento/detail/mmap_file_stream.hpp"
+#include "databento/exceptions.hpp"
+
+namespace databento {
+namespace detail {
+namespace test {
+TEST(MmapFileStreamTests, TestReadExactInsufficient) {
+  const std::string file_path =
+      TEST_BUILD_DIR "/data/test_data.ohlcv-1d.v1.dbn";
+  databento::detail::MmapFileStream target{file_path};
+  std::vector<std::uint8_t> buffer(1024);  // File is less than 1KiB
+  try {
+    target.ReadExact(buffer.data(), buffer.size());
+    FAIL() << "Expected throw";
+  } catch (const databento::Exception& exc) {
+    ASSERT_STREQ(exc.what(),
+                 "Unexpected end of file, expected 1024 bytes, got 206");
+  }
+}
+
+TEST(MmapFileStreamTests, TestReadSomeLessThanMax) {
+  const std::string file_path =
+      TEST_BUILD_DIR "/data/test_data.ohlcv-1d.v1.dbn";
+  databento::detail::MmapFileStream target{file_path};
+  std::vector<std::uint8_t> buffer(1024);  // File is less than 1KiB
+  const auto read_size = target.ReadSome(buffer.data(), buffer.size());
+  ASSERT_GT(read_size, 0);
+  ASSERT_EQ(read_size, target.Size());
+  ASSERT_TRUE(std::any_of(buffer.cbegin(), buffer.cend(),
+                          [](std::uint8_t byte) { return byte != 0; }));
+}
+
+TEST(MmapFileStreamTests, TestMatchesFileStream) {
+  const std::string file_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn";
+  databento::detail::MmapFileStream target{file_path};
+  databento::detail::FileStream reference{file_path};
+  std::vector<std::uint8_t> mmap_buffer(target.Size());
+  std::vector<std::uint8_t> file_buffer(target.Size());
+  target.ReadExact(mmap_buffer.data(), mmap_buffer.size());
+  reference.ReadExact(file_buffer.data(), file_buffer.size());
+  ASSERT_TRUE(std::equal(mmap_buffer.cbegin(), mmap_buffer.cend(),
+                         file_buffer.cbegin()));
+  // End of stream
+  ASSERT_EQ(target.ReadSome(mmap_buffer.data(), 1), 0);
+}
+
+TEST(MmapFileStreamTests, TestNonExistentFile) {
+  ASSERT_THROW(databento::detail::MmapFileStream{"non-existent-file.dbn"},
+               databento::InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace detail
+}  // namespace databento
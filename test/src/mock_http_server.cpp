@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>  // EXPECT_*
 #include <httplib.h>
+#include <zstd.h>
 
 #include <fstream>   // ifstream
 #include <ios>       // streamsize
@@ -55,6 +56,26 @@ void MockHttpServer::MockGetJson(
   });
 }
 
+void MockHttpServer::MockGetJsonZstd(const std::string& path,
+                                     const nlohmann::json& json) {
+  const std::string body = json.dump();
+  std::string compressed(::ZSTD_compressBound(body.length()), '\0');
+  const auto compressed_size =
+      ::ZSTD_compress(&compressed[0], compressed.length(), body.data(),
+                      body.length(), ZSTD_CLEVEL_DEFAULT);
+  ASSERT_FALSE(::ZSTD_isError(compressed_size));
+  compressed.resize(compressed_size);
+  server_.Get(path, [compressed](const httplib::Request& req,
+                                 httplib::Response& resp) {
+    // Only serve the encoding the client negotiated
+    EXPECT_NE(req.get_header_value("Accept-Encoding").find("zstd"),
+              std::string::npos);
+    resp.set_content(compressed, "application/json");
+    resp.set_header("Content-Encoding", "zstd");
+    resp.status = 200;
+  });
+}
+
 void MockHttpServer::MockPostJson(
     const std::string& path,
     const std::map<std::string, std::string>& form_params,
@@ -109,6 +130,30 @@ void MockHttpServer::MockStreamDbn(
   });
 }
 
+void MockHttpServer::MockStreamDbnRanged(
+    const std::string& path, const std::map<std::string, std::string>& params,
+    const std::string& dbn_path) {
+  // Read contents into buffer
+  std::ifstream input_file{dbn_path, std::ios::binary | std::ios::ate};
+  const auto size = static_cast<std::size_t>(input_file.tellg());
+  input_file.seekg(0, std::ios::beg);
+  std::string buffer(size, '\0');
+  input_file.read(&buffer[0], static_cast<std::streamsize>(size));
+
+  // Serve. `set_content` lets httplib handle any Range header itself.
+  server_.Get(path, [buffer, params](const httplib::Request& req,
+                                     httplib::Response& resp) {
+    if (!req.has_header("Authorization")) {
+      resp.status = 401;
+      return;
+    }
+    CheckParams(params, req);
+    resp.status = 200;
+    resp.set_header("Content-Disposition", "attachment; filename=test.dbn.zst");
+    resp.set_content(buffer, "application/octet-stream");
+  });
+}
+
 void MockHttpServer::CheckParams(
     const std::map<std::string, std::string>& params,
     const httplib::Request& req) {
@@ -8,9 +8,14 @@
 #endif
 #include <openssl/sha.h>  // SHA256_DIGEST_LENGTH
 
+#include <algorithm>  // min
+#include <chrono>     // steady_clock
 #include <cstdint>
+#include <cstring>  // memcpy
 #include <limits>
 #include <sstream>
+#include <utility>  // move, swap
+#include <vector>
 
 #include "databento/dbn.hpp"
 #include "databento/enums.hpp"
@@ -34,6 +39,13 @@ void MockLsgServer::Accept() {
       ::accept(socket_.Get(), reinterpret_cast<sockaddr*>(&addr), &addr_len)};
 }
 
+void MockLsgServer::AcceptSwapConn() {
+  held_fd_ = std::move(conn_fd_);
+  Accept();
+}
+
+void MockLsgServer::SwapConn() { std::swap(conn_fd_, held_fd_); }
+
 std::string MockLsgServer::Receive() {
   std::string received(1024, 0);
   char c{};
@@ -95,6 +107,20 @@ void MockLsgServer::Authenticate() {
 void MockLsgServer::Subscribe(const std::vector<std::string>& symbols,
                               Schema schema, SType stype) {
   const auto received = Receive();
+  CheckSubscription(received, symbols, schema, stype);
+}
+
+void MockLsgServer::Subscribe(const std::vector<std::string>& symbols,
+                              Schema schema, SType stype,
+                              const std::string& start) {
+  const auto received = Receive();
+  CheckSubscription(received, symbols, schema, stype);
+  EXPECT_NE(received.find("start=" + start), std::string::npos);
+}
+
+void MockLsgServer::CheckSubscription(const std::string& received,
+                                      const std::vector<std::string>& symbols,
+                                      Schema schema, SType stype) {
   EXPECT_NE(
       received.find("symbols=" +
                     JoinSymbolStrings("MockLsgServer::Subscribe", symbols)),
@@ -137,6 +163,60 @@ void MockLsgServer::Start() {
   ASSERT_EQ(bytes_written, kFrameLen);
 }
 
+std::size_t MockLsgServer::StreamMboBursts(
+    std::size_t record_count, std::size_t records_per_burst,
+    std::chrono::nanoseconds burst_interval) {
+// MSG_NOSIGNAL doesn't exist on Windows, but also isn't necessary
+#ifdef _WIN32
+  constexpr int MSG_NOSIGNAL = {};
+#endif
+  MboMsg rec{{sizeof(MboMsg) / RecordHeader::kLengthMultiplier, RType::Mbo, 1,
+              1, UnixNanos{}},
+             1,
+             2,
+             3,
+             {},
+             4,
+             Action::Add,
+             Side::Bid,
+             UnixNanos{},
+             TimeDeltaNanos{},
+             0};
+  std::vector<char> burst(records_per_burst * sizeof(MboMsg));
+  std::size_t sent{};
+  auto next_burst = std::chrono::steady_clock::now();
+  while (sent < record_count) {
+    const auto batch =
+        std::min(records_per_burst,
+                 // guard against overflow when record_count is SIZE_MAX
+                 record_count - sent);
+    for (std::size_t i = 0; i < batch; ++i) {
+      rec.sequence = static_cast<std::uint32_t>(sent + i);
+      std::memcpy(&burst[i * sizeof(MboMsg)], &rec, sizeof(MboMsg));
+    }
+    std::size_t offset{};
+    const auto burst_size = batch * sizeof(MboMsg);
+    while (offset < burst_size) {
+      const auto write_size = ::send(conn_fd_.Get(), burst.data() + offset,
+                                     burst_size - offset, MSG_NOSIGNAL);
+      if (write_size <= 0) {
+        // The peer disconnected; count only fully-written records
+        return sent + offset / sizeof(MboMsg);
+      }
+      offset += static_cast<std::size_t>(write_size);
+    }
+    sent += batch;
+    if (burst_interval.count() > 0) {
+      // Spin rather than sleep: OS sleep granularity is far too coarse to
+      // pace sub-millisecond bursts
+      next_burst += burst_interval;
+      while (std::chrono::steady_clock::now() < next_burst) {
+      }
+    }
+  }
+  return sent;
+}
+
 void MockLsgServer::Close() { conn_fd_.Close(); }
 
 databento::detail::Socket MockLsgServer::InitSocketAndSetPort() {
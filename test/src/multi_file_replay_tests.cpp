@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "databento/datetime.hpp"
+#include "databento/dbn_file_store.hpp"
+#include "databento/enums.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/multi_file_replay.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+namespace {
+std::size_t CountRecords(const std::string& file_path) {
+  std::size_t count{};
+  DbnFileStore store{file_path};
+  store.Replay([&count](const Record&) {
+    ++count;
+    return KeepGoing::Continue;
+  });
+  return count;
+}
+}  // namespace
+
+TEST(MultiFileReplayTests, TestMergesInTsEventOrder) {
+  const std::vector<std::string> file_paths{
+      TEST_BUILD_DIR "/data/test_data.mbo.dbn",
+      TEST_BUILD_DIR "/data/test_data.trades.dbn",
+      TEST_BUILD_DIR "/data/test_data.ohlcv-1d.dbn",
+  };
+  std::size_t expected_count{};
+  for (const auto& file_path : file_paths) {
+    expected_count += CountRecords(file_path);
+  }
+  MultiFileReplay target{file_paths, VersionUpgradePolicy::Upgrade, 2};
+  std::size_t metadata_count{};
+  std::size_t record_count{};
+  UnixNanos prev_ts{};
+  target.Replay(
+      [&metadata_count](Metadata&&) { ++metadata_count; },
+      [&record_count, &prev_ts](const Record& record) {
+        EXPECT_GE(record.Header().ts_event, prev_ts);
+        prev_ts = record.Header().ts_event;
+        ++record_count;
+        return KeepGoing::Continue;
+      });
+  EXPECT_EQ(metadata_count, file_paths.size());
+  EXPECT_EQ(record_count, expected_count);
+}
+
+TEST(MultiFileReplayTests, TestStop) {
+  MultiFileReplay target{{TEST_BUILD_DIR "/data/test_data.mbo.dbn",
+                          TEST_BUILD_DIR "/data/test_data.trades.dbn"}};
+  std::size_t record_count{};
+  target.Replay([&record_count](const Record&) {
+    ++record_count;
+    return KeepGoing::Stop;
+  });
+  EXPECT_EQ(record_count, 1);
+}
+
+TEST(MultiFileReplayTests, TestEmptyFilePaths) {
+  ASSERT_THROW(MultiFileReplay{std::vector<std::string>{}},
+               InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
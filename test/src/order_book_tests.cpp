@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "databento/constants.hpp"  // kUndefPrice
+#include "databento/enums.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/order_book.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+class OrderBookTests : public testing::Test {
+ protected:
+  static MboMsg MakeMbo(Action action, Side side, std::uint64_t order_id,
+                        std::int64_t price, std::uint32_t size) {
+    MboMsg mbo{};
+    mbo.hd = RecordHeader{sizeof(MboMsg) / RecordHeader::kLengthMultiplier,
+                          RType::Mbo, 1, 1, UnixNanos{}};
+    mbo.order_id = order_id;
+    mbo.price = price;
+    mbo.size = size;
+    mbo.action = action;
+    mbo.side = side;
+    return mbo;
+  }
+
+  OrderBook target_;
+};
+
+TEST_F(OrderBookTests, TestEmpty) {
+  EXPECT_EQ(target_.BidDepth(), 0);
+  EXPECT_EQ(target_.AskDepth(), 0);
+  EXPECT_EQ(target_.OrderCount(), 0);
+  EXPECT_TRUE(target_.BidLevel(0).IsEmpty());
+  EXPECT_TRUE(target_.AskLevel(0).IsEmpty());
+  const auto bbo = target_.Bbo();
+  EXPECT_EQ(bbo.bid_px, kUndefPrice);
+  EXPECT_EQ(bbo.ask_px, kUndefPrice);
+  EXPECT_EQ(bbo.bid_sz, 0);
+  EXPECT_EQ(bbo.ask_sz, 0);
+}
+
+TEST_F(OrderBookTests, TestAddAggregatesLevels) {
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 1, 100, 10));
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 2, 100, 5));
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 3, 99, 20));
+  target_.Apply(MakeMbo(Action::Add, Side::Ask, 4, 101, 7));
+  EXPECT_EQ(target_.BidDepth(), 2);
+  EXPECT_EQ(target_.AskDepth(), 1);
+  EXPECT_EQ(target_.OrderCount(), 4);
+  EXPECT_EQ(target_.BidLevel(0).price, 100);
+  EXPECT_EQ(target_.BidLevel(0).size, 15);
+  EXPECT_EQ(target_.BidLevel(0).count, 2);
+  EXPECT_EQ(target_.BidLevel(1).price, 99);
+  EXPECT_EQ(target_.AskLevel(0).price, 101);
+  EXPECT_EQ(target_.AskLevel(0).size, 7);
+  const auto bbo = target_.Bbo();
+  EXPECT_EQ(bbo.bid_px, 100);
+  EXPECT_EQ(bbo.ask_px, 101);
+  EXPECT_EQ(bbo.bid_sz, 15);
+  EXPECT_EQ(bbo.ask_ct, 1);
+}
+
+TEST_F(OrderBookTests, TestLevelOrdering) {
+  target_.Apply(MakeMbo(Action::Add, Side::Ask, 1, 103, 1));
+  target_.Apply(MakeMbo(Action::Add, Side::Ask, 2, 101, 2));
+  target_.Apply(MakeMbo(Action::Add, Side::Ask, 3, 102, 3));
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 4, 98, 4));
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 5, 100, 5));
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 6, 99, 6));
+  EXPECT_EQ(target_.AskLevel(0).price, 101);
+  EXPECT_EQ(target_.AskLevel(1).price, 102);
+  EXPECT_EQ(target_.AskLevel(2).price, 103);
+  EXPECT_EQ(target_.BidLevel(0).price, 100);
+  EXPECT_EQ(target_.BidLevel(1).price, 99);
+  EXPECT_EQ(target_.BidLevel(2).price, 98);
+}
+
+TEST_F(OrderBookTests, TestCancel) {
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 1, 100, 10));
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 2, 100, 5));
+  // Partial cancel
+  target_.Apply(MakeMbo(Action::Cancel, Side::Bid, 1, 100, 4));
+  EXPECT_EQ(target_.BidLevel(0).size, 11);
+  EXPECT_EQ(target_.BidLevel(0).count, 2);
+  ASSERT_NE(target_.GetOrder(1), nullptr);
+  EXPECT_EQ(target_.GetOrder(1)->size, 6);
+  // Full cancel removes the order
+  target_.Apply(MakeMbo(Action::Cancel, Side::Bid, 1, 100, 6));
+  EXPECT_EQ(target_.BidLevel(0).size, 5);
+  EXPECT_EQ(target_.BidLevel(0).count, 1);
+  EXPECT_EQ(target_.GetOrder(1), nullptr);
+  EXPECT_EQ(target_.OrderCount(), 1);
+  // Last order at the level removes the level
+  target_.Apply(MakeMbo(Action::Cancel, Side::Bid, 2, 100, 5));
+  EXPECT_EQ(target_.BidDepth(), 0);
+}
+
+TEST_F(OrderBookTests, TestModify) {
+  target_.Apply(MakeMbo(Action::Add, Side::Ask, 1, 101, 10));
+  target_.Apply(MakeMbo(Action::Add, Side::Ask, 2, 101, 3));
+  target_.Apply(MakeMbo(Action::Modify, Side::Ask, 1, 102, 8));
+  EXPECT_EQ(target_.AskLevel(0).price, 101);
+  EXPECT_EQ(target_.AskLevel(0).size, 3);
+  EXPECT_EQ(target_.AskLevel(1).price, 102);
+  EXPECT_EQ(target_.AskLevel(1).size, 8);
+  ASSERT_NE(target_.GetOrder(1), nullptr);
+  EXPECT_EQ(target_.GetOrder(1)->price, 102);
+  EXPECT_EQ(target_.GetOrder(1)->size, 8);
+  // A modify for an order that's no longer resting acts as an add
+  target_.Apply(MakeMbo(Action::Modify, Side::Ask, 3, 103, 2));
+  EXPECT_EQ(target_.AskDepth(), 3);
+  EXPECT_EQ(target_.OrderCount(), 3);
+}
+
+TEST_F(OrderBookTests, TestFillAndTrade) {
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 1, 100, 10));
+  // Trades don't change the book
+  target_.Apply(MakeMbo(Action::Trade, Side::Ask, 0, 100, 4));
+  EXPECT_EQ(target_.BidLevel(0).size, 10);
+  target_.Apply(MakeMbo(Action::Fill, Side::Bid, 1, 100, 4));
+  EXPECT_EQ(target_.BidLevel(0).size, 6);
+  target_.Apply(MakeMbo(Action::Fill, Side::Bid, 1, 100, 6));
+  EXPECT_EQ(target_.BidDepth(), 0);
+  EXPECT_EQ(target_.OrderCount(), 0);
+}
+
+TEST_F(OrderBookTests, TestClear) {
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 1, 100, 10));
+  target_.Apply(MakeMbo(Action::Add, Side::Ask, 2, 101, 5));
+  target_.Apply(MakeMbo(Action::Clear, Side::None, 0, 0, 0));
+  EXPECT_EQ(target_.BidDepth(), 0);
+  EXPECT_EQ(target_.AskDepth(), 0);
+  EXPECT_EQ(target_.OrderCount(), 0);
+  // The book is usable after a clear
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 1, 99, 1));
+  EXPECT_EQ(target_.BidLevel(0).price, 99);
+}
+
+TEST_F(OrderBookTests, TestSnapshot) {
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 1, 100, 10));
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 2, 99, 20));
+  target_.Apply(MakeMbo(Action::Add, Side::Ask, 3, 101, 5));
+  const auto levels = target_.Snapshot<3>();
+  EXPECT_EQ(levels[0].bid_px, 100);
+  EXPECT_EQ(levels[0].ask_px, 101);
+  EXPECT_EQ(levels[1].bid_px, 99);
+  EXPECT_EQ(levels[1].ask_px, kUndefPrice);
+  EXPECT_EQ(levels[1].ask_sz, 0);
+  EXPECT_EQ(levels[2].bid_px, kUndefPrice);
+  EXPECT_EQ(levels[2].bid_ct, 0);
+}
+
+TEST_F(OrderBookTests, TestInconsistentRecords) {
+  target_.Apply(MakeMbo(Action::Add, Side::Bid, 1, 100, 10));
+  EXPECT_THROW(target_.Apply(MakeMbo(Action::Add, Side::Bid, 1, 100, 5)),
+               InvalidArgumentError);
+  EXPECT_THROW(target_.Apply(MakeMbo(Action::Cancel, Side::Bid, 2, 100, 5)),
+               InvalidArgumentError);
+  EXPECT_THROW(target_.Apply(MakeMbo(Action::Fill, Side::Bid, 2, 100, 5)),
+               InvalidArgumentError);
+  EXPECT_THROW(target_.Apply(MakeMbo(Action::Cancel, Side::Bid, 1, 100, 11)),
+               InvalidArgumentError);
+  // The failed records left the book unchanged
+  EXPECT_EQ(target_.BidLevel(0).size, 10);
+  EXPECT_EQ(target_.OrderCount(), 1);
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <chrono>   // milliseconds, steady_clock
+#include <cstddef>  // size_t
+#include <string>
+
+#include "databento/constants.hpp"  // dataset, kDbnVersion
+#include "databento/datetime.hpp"   // UnixNanos
+#include "databento/dbn.hpp"        // Metadata
+#include "databento/dbn_encoder.hpp"
+#include "databento/enums.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/paced_replay.hpp"
+#include "databento/record.hpp"
+#include "temp_file.hpp"
+
+namespace databento {
+namespace test {
+class PacedReplayTests : public testing::Test {
+ protected:
+  static constexpr std::size_t kRecCount = 6;
+  // Simulated time between consecutive records
+  static constexpr std::chrono::milliseconds kStep{10};
+
+  // Writes records `kStep` of simulated time apart, with the index stored in
+  // `open`
+  static void WriteTestFile(const std::string& path) {
+    Metadata metadata{};
+    metadata.version = kDbnVersion;
+    metadata.dataset = dataset::kXnasItch;
+    metadata.schema = Schema::Ohlcv1S;
+    metadata.start = UnixNanos{std::chrono::seconds{1}};
+    metadata.stype_in = SType::RawSymbol;
+    metadata.stype_out = SType::InstrumentId;
+    metadata.symbol_cstr_len = kSymbolCstrLen;
+    DbnFileWriter writer{path, metadata};
+    for (std::size_t i = 0; i < kRecCount; ++i) {
+      OhlcvMsg rec{{sizeof(OhlcvMsg) / RecordHeader::kLengthMultiplier,
+                    RType::Ohlcv1S, 1, 1,
+                    metadata.start + kStep * i},
+                   static_cast<std::int64_t>(i),
+                   0,
+                   0,
+                   0,
+                   0};
+      writer.WriteRecord(Record{&rec.hd});
+    }
+  }
+};
+
+TEST_F(PacedReplayTests, TestInvalidSpeed) {
+  PacedReplay::Conf conf;
+  conf.speed = 0;
+  ASSERT_THROW(PacedReplay("unused", conf), InvalidArgumentError);
+}
+
+TEST_F(PacedReplayTests, TestPacing) {
+  TempFile temp_file{testing::TempDir() + "/paced_replay.dbn"};
+  WriteTestFile(temp_file.Path());
+  PacedReplay::Conf conf;
+  conf.speed = 5.0;
+  PacedReplay target{temp_file.Path(), conf};
+  std::size_t rec_count{};
+  const auto start = std::chrono::steady_clock::now();
+  target.Replay([&rec_count](const Record& record) {
+    EXPECT_EQ(record.Get<OhlcvMsg>().open,
+              static_cast<std::int64_t>(rec_count));
+    ++rec_count;
+    return KeepGoing::Continue;
+  });
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_EQ(rec_count, kRecCount);
+  // 50ms of simulated time at 5x should take at least 10ms of wall-clock
+  // time. No upper bound: a loaded machine can always run slower
+  EXPECT_GE(elapsed, kStep * (kRecCount - 1) / 5);
+}
+
+TEST_F(PacedReplayTests, TestFastForward) {
+  TempFile temp_file{testing::TempDir() + "/paced_replay_ff.dbn"};
+  WriteTestFile(temp_file.Path());
+  PacedReplay::Conf conf;
+  conf.speed = 1e9;
+  PacedReplay target{temp_file.Path(), conf};
+  std::size_t rec_count{};
+  target.Replay([&rec_count](const Record&) {
+    ++rec_count;
+    return KeepGoing::Continue;
+  });
+  EXPECT_EQ(rec_count, kRecCount);
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "databento/constants.hpp"
+#include "databento/dbn_file_store.hpp"
+#include "databento/enums.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/partitioned_replay.hpp"
+#include "databento/record.hpp"
+
+namespace databento {
+namespace test {
+TEST(PartitionedReplayTests, TestMatchesSequentialReplay) {
+  const std::string file_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn";
+  PartitionedReplay target{file_path, VersionUpgradePolicy::Upgrade, 2};
+  ASSERT_EQ(target.GetMetadata().schema, Schema::Mbo);
+  std::vector<std::vector<MboMsg>> partition_records(
+      target.PartitionCount());
+  std::mutex mutex;
+  target.Replay([&partition_records, &mutex](std::size_t partition,
+                                             const Record& record) {
+    EXPECT_TRUE(record.Holds<MboMsg>());
+    const std::lock_guard<std::mutex> lock{mutex};
+    partition_records[partition].emplace_back(record.Get<MboMsg>());
+    return KeepGoing::Continue;
+  });
+  std::vector<MboMsg> partitioned;
+  for (const auto& records : partition_records) {
+    partitioned.insert(partitioned.end(), records.begin(), records.end());
+  }
+  std::vector<MboMsg> sequential;
+  DbnFileStore sequential_store{file_path};
+  sequential_store.Replay([&sequential](const Record& record) {
+    sequential.emplace_back(record.Get<MboMsg>());
+    return KeepGoing::Continue;
+  });
+  ASSERT_EQ(sequential.size(), 2);
+  ASSERT_EQ(partitioned.size(), sequential.size());
+  for (std::size_t i = 0; i < sequential.size(); ++i) {
+    EXPECT_EQ(partitioned[i], sequential[i]);
+  }
+}
+
+TEST(PartitionedReplayTests, TestStop) {
+  const std::string file_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn";
+  // A single partition so the stop is deterministic
+  PartitionedReplay target{file_path, VersionUpgradePolicy::Upgrade, 1};
+  std::size_t record_count{};
+  target.Replay([&record_count](std::size_t, const Record&) {
+    ++record_count;
+    return KeepGoing::Stop;
+  });
+  ASSERT_EQ(record_count, 1);
+}
+
+TEST(PartitionedReplayTests, TestRejectsCompressed) {
+  const std::string file_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn.zst";
+  ASSERT_THROW(PartitionedReplay{file_path}, InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
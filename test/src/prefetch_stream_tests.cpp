@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>  // equal
+#include <cstdint>
+#include <memory>  // unique_ptr
+#include <vector>
+
+#include "databento/detail/file_stream.hpp"
+#include "databento/detail/prefetch_stream.hpp"
+#include "databento/exceptions.hpp"
+
+namespace databento {
+namespace detail {
+namespace test {
+TEST(PrefetchStreamTests, TestMatchesFileStream) {
+  const std::string file_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn";
+  // Tiny buffers to force several swaps and producer stalls
+  PrefetchStream target{
+      std::unique_ptr<IReadable>{new FileStream{file_path}}, 16, 2};
+  FileStream reference{file_path};
+  std::vector<std::uint8_t> prefetch_buffer;
+  std::vector<std::uint8_t> chunk(11);
+  while (true) {
+    const auto read_size = target.ReadSome(chunk.data(), chunk.size());
+    if (read_size == 0) {
+      break;
+    }
+    prefetch_buffer.insert(prefetch_buffer.end(), chunk.cbegin(),
+                           chunk.cbegin() + static_cast<std::ptrdiff_t>(
+                                                read_size));
+  }
+  std::vector<std::uint8_t> file_buffer(prefetch_buffer.size());
+  reference.ReadExact(file_buffer.data(), file_buffer.size());
+  ASSERT_GT(prefetch_buffer.size(), 0);
+  ASSERT_TRUE(std::equal(prefetch_buffer.cbegin(), prefetch_buffer.cend(),
+                         file_buffer.cbegin()));
+  // Remains at end of stream
+  ASSERT_EQ(target.ReadSome(chunk.data(), chunk.size()), 0);
+  ASSERT_EQ(reference.ReadSome(chunk.data(), chunk.size()), 0);
+}
+
+TEST(PrefetchStreamTests, TestReadExactInsufficient) {
+  const std::string file_path =
+      TEST_BUILD_DIR "/data/test_data.ohlcv-1d.v1.dbn";
+  PrefetchStream target{std::unique_ptr<IReadable>{new FileStream{file_path}}};
+  std::vector<std::uint8_t> buffer(1024);  // File is less than 1KiB
+  ASSERT_THROW(target.ReadExact(buffer.data(), buffer.size()),
+               databento::DbnResponseError);
+}
+
+TEST(PrefetchStreamTests, TestEarlyDestruction) {
+  const std::string file_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn";
+  // Small enough that the producer blocks with unread data when destroyed
+  PrefetchStream target{
+      std::unique_ptr<IReadable>{new FileStream{file_path}}, 8, 1};
+  std::vector<std::uint8_t> buffer(4);
+  ASSERT_EQ(target.ReadSome(buffer.data(), buffer.size()), buffer.size());
+}
+}  // namespace test
+}  // namespace detail
+}  // namespace databento
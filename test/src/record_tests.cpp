@@ -261,5 +261,90 @@ TEST(RecordTests, TestImbalanceMsgToString) {
     significant_imbalance = 'N'
 })");
 }
+
+TEST(RecordTests, TestRecordSizeOf) {
+  static_assert(RecordSizeOf(RType::Mbo) == sizeof(MboMsg),
+                "RecordSizeOf should be usable at compile time");
+  EXPECT_EQ(RecordSizeOf(RType::Mbp0), sizeof(TradeMsg));
+  EXPECT_EQ(RecordSizeOf(RType::Mbp1), sizeof(Mbp1Msg));
+  EXPECT_EQ(RecordSizeOf(RType::Mbp10), sizeof(Mbp10Msg));
+  EXPECT_EQ(RecordSizeOf(RType::OhlcvDeprecated), sizeof(OhlcvMsg));
+  EXPECT_EQ(RecordSizeOf(RType::Ohlcv1S), sizeof(OhlcvMsg));
+  EXPECT_EQ(RecordSizeOf(RType::Ohlcv1D), sizeof(OhlcvMsg));
+  EXPECT_EQ(RecordSizeOf(RType::InstrumentDef), sizeof(InstrumentDefMsg));
+  EXPECT_EQ(RecordSizeOf(RType::Imbalance), sizeof(ImbalanceMsg));
+  EXPECT_EQ(RecordSizeOf(RType::Statistics), sizeof(StatMsg));
+  EXPECT_EQ(RecordSizeOf(RType::Error), sizeof(ErrorMsg));
+  EXPECT_EQ(RecordSizeOf(RType::SymbolMapping), sizeof(SymbolMappingMsg));
+  EXPECT_EQ(RecordSizeOf(RType::System), sizeof(SystemMsg));
+  EXPECT_EQ(RecordSizeOf(static_cast<RType>(0xFF)), 0);
+}
+
+TEST(RecordTests, TestHasValidSize) {
+  MboMsg mbo{};
+  mbo.hd = RecordHeader{sizeof(MboMsg) / RecordHeader::kLengthMultiplier,
+                        RType::Mbo, 1, 1, UnixNanos{}};
+  EXPECT_TRUE(Record{&mbo.hd}.HasValidSize());
+  // A record with ts_out appended is also valid
+  WithTsOut<MboMsg> with_ts_out{mbo, UnixNanos{}};
+  with_ts_out.rec.hd.length =
+      sizeof(with_ts_out) / RecordHeader::kLengthMultiplier;
+  EXPECT_TRUE(Record{&with_ts_out.rec.hd}.HasValidSize());
+  // Truncated or unknown records are invalid
+  mbo.hd.length = sizeof(RecordHeader) / RecordHeader::kLengthMultiplier;
+  EXPECT_FALSE(Record{&mbo.hd}.HasValidSize());
+  mbo.hd.length = sizeof(MboMsg) / RecordHeader::kLengthMultiplier;
+  mbo.hd.rtype = static_cast<RType>(0xFF);
+  EXPECT_FALSE(Record{&mbo.hd}.HasValidSize());
+}
+
+// Local classes can't have member templates, so the test visitor lives at
+// namespace scope
+struct CountingVisitor {
+  void operator()(const MboMsg& mbo) { mbo_count += mbo.size; }
+  void operator()(const OhlcvMsg& ohlcv) { ohlcv_count += ohlcv.volume; }
+  // Catch-all for the record types this visitor doesn't care about
+  template <typename T>
+  void operator()(const T&) {
+    ++other_count;
+  }
+
+  std::uint64_t mbo_count{};
+  std::uint64_t ohlcv_count{};
+  std::uint64_t other_count{};
+};
+
+TEST(RecordTests, TestGetUnchecked) {
+  MboMsg mbo{};
+  mbo.hd = RecordHeader{sizeof(MboMsg) / RecordHeader::kLengthMultiplier,
+                        RType::Mbo, 1, 1, UnixNanos{}};
+  mbo.size = 9;
+  Record record{&mbo.hd};
+  EXPECT_EQ(&record.GetUnchecked<MboMsg>(), &record.Get<MboMsg>());
+  EXPECT_EQ(record.GetUnchecked<MboMsg>().size, 9);
+}
+
+TEST(RecordTests, TestVisit) {
+  CountingVisitor visitor;
+  MboMsg mbo{};
+  mbo.hd = RecordHeader{sizeof(MboMsg) / RecordHeader::kLengthMultiplier,
+                        RType::Mbo, 1, 1, UnixNanos{}};
+  mbo.size = 5;
+  EXPECT_TRUE(Record{&mbo.hd}.Visit(visitor));
+  OhlcvMsg ohlcv{};
+  ohlcv.hd = RecordHeader{sizeof(OhlcvMsg) / RecordHeader::kLengthMultiplier,
+                          RType::Ohlcv1S, 1, 1, UnixNanos{}};
+  ohlcv.volume = 7;
+  EXPECT_TRUE(Record{&ohlcv.hd}.Visit(visitor));
+  TradeMsg trade{};
+  trade.hd = RecordHeader{sizeof(TradeMsg) / RecordHeader::kLengthMultiplier,
+                          RType::Mbp0, 1, 1, UnixNanos{}};
+  EXPECT_TRUE(Record{&trade.hd}.Visit(visitor));
+  mbo.hd.rtype = static_cast<RType>(0xFF);
+  EXPECT_FALSE(Record{&mbo.hd}.Visit(visitor));
+  EXPECT_EQ(visitor.mbo_count, 5);
+  EXPECT_EQ(visitor.ohlcv_count, 7);
+  EXPECT_EQ(visitor.other_count, 1);
+}
 }  // namespace test
 }  // namespace databento
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>  // future
+#include <stdexcept>
+#include <vector>
+
+#include "databento/detail/request_thread_pool.hpp"
+
+namespace databento {
+namespace detail {
+namespace test {
+TEST(RequestThreadPoolTests, TestSubmitReturnsResults) {
+  RequestThreadPool target{4};
+  std::vector<std::future<int>> futures;
+  for (int i = 0; i < 100; ++i) {
+    futures.emplace_back(target.Submit([i]() { return i * 2; }));
+  }
+  int sum{};
+  for (auto& future : futures) {
+    sum += future.get();
+  }
+  ASSERT_EQ(sum, 9900);
+}
+
+TEST(RequestThreadPoolTests, TestSubmitPropagatesExceptions) {
+  RequestThreadPool target{2};
+  std::future<int> future =
+      target.Submit([]() -> int { throw std::logic_error{"tested"}; });
+  ASSERT_THROW(future.get(), std::logic_error);
+}
+
+TEST(RequestThreadPoolTests, TestDestructorDrainsQueue) {
+  std::atomic<int> run_count{};
+  {
+    RequestThreadPool target{2};
+    for (int i = 0; i < 50; ++i) {
+      target.Submit([&run_count]() { ++run_count; });
+    }
+  }
+  ASSERT_EQ(run_count.load(), 50);
+}
+}  // namespace test
+}  // namespace detail
+}  // namespace databento
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>  // mkdir, stat
+
+#include <chrono>
+#include <cstdio>  // remove
+#include <string>
+#include <thread>  // sleep_for
+#include <vector>
+
+#include "databento/constants.hpp"  // dataset, kDbnVersion, kSymbolCstrLen
+#include "databento/datetime.hpp"
+#include "databento/dbn.hpp"
+#include "databento/dbn_file_store.hpp"
+#include "databento/enums.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/record.hpp"
+#include "databento/rotating_dbn_writer.hpp"
+
+namespace databento {
+namespace test {
+class RotatingDbnWriterTests : public testing::Test {
+ protected:
+  static constexpr auto kOutputDir = TEST_BUILD_DIR "/rotating_writer_test";
+
+  void SetUp() override {
+#ifdef _WIN32
+    ::_mkdir(kOutputDir);
+#else
+    ::mkdir(kOutputDir, 0777);
+#endif
+  }
+
+  void TearDown() override {
+    for (const auto& path : WrittenFiles()) {
+      std::remove(path.c_str());
+    }
+    std::remove(kOutputDir);
+  }
+
+  static Metadata MboMetadata() {
+    Metadata metadata{};
+    metadata.version = kDbnVersion;
+    metadata.dataset = dataset::kXnasItch;
+    metadata.schema = Schema::Mbo;
+    metadata.stype_in = SType::RawSymbol;
+    metadata.stype_out = SType::InstrumentId;
+    metadata.symbol_cstr_len = kSymbolCstrLen;
+    return metadata;
+  }
+
+  static MboMsg MakeMbo(std::uint64_t ts_event) {
+    MboMsg mbo{};
+    mbo.hd = RecordHeader{sizeof(MboMsg) / RecordHeader::kLengthMultiplier,
+                          RType::Mbo, 1, 10,
+                          UnixNanos{std::chrono::nanoseconds{ts_event}}};
+    mbo.order_id = ts_event;
+    mbo.price = 1'000'000'000;
+    mbo.size = 5;
+    mbo.action = Action::Add;
+    mbo.side = Side::Bid;
+    mbo.ts_recv = UnixNanos{std::chrono::nanoseconds{ts_event}};
+    return mbo;
+  }
+
+  static std::string FilePath(std::size_t index, bool in_progress = false) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "/capture-%06zu.dbn", index);
+    return std::string{kOutputDir} + name +
+           (in_progress ? ".inprogress" : "");
+  }
+
+  static bool Exists(const std::string& path) {
+    struct stat entry_stat;
+    return ::stat(path.c_str(), &entry_stat) == 0;
+  }
+
+  // Every path the tests may have created, for cleanup
+  static std::vector<std::string> WrittenFiles() {
+    std::vector<std::string> paths;
+    for (std::size_t i = 0; i < 16; ++i) {
+      paths.emplace_back(FilePath(i));
+      paths.emplace_back(FilePath(i, true));
+    }
+    return paths;
+  }
+};
+
+TEST_F(RotatingDbnWriterTests, TestSizeBasedRotation) {
+  RotationPolicy policy;
+  // Metadata plus a handful of MBO records per file
+  policy.max_file_size = 512;
+  {
+    RotatingDbnWriter target{kOutputDir, "capture", MboMetadata(), policy};
+    for (std::uint64_t i = 0; i < 100; ++i) {
+      auto mbo = MakeMbo(1'000 + i);
+      target.WriteRecord(Record{&mbo.hd});
+    }
+    target.Close();
+    EXPECT_GT(target.FileCount(), 1);
+  }
+  // Every file was sealed: no .inprogress files remain and each sealed
+  // file decodes with the ts_event range of its records as start and end
+  std::size_t total_records{};
+  UnixNanos prev_end{};
+  for (std::size_t i = 0; Exists(FilePath(i)); ++i) {
+    EXPECT_FALSE(Exists(FilePath(i, true)));
+    DbnFileStore store{FilePath(i), VersionUpgradePolicy::Upgrade};
+    const auto metadata = store.GetMetadata();
+    EXPECT_GT(metadata.start, prev_end) << "in file " << i;
+    EXPECT_GE(metadata.end, metadata.start) << "in file " << i;
+    UnixNanos first_ts{};
+    UnixNanos last_ts{};
+    store.Replay([&first_ts, &last_ts, &total_records](const Record& record) {
+      if (first_ts.time_since_epoch().count() == 0) {
+        first_ts = record.Header().ts_event;
+      }
+      last_ts = record.Header().ts_event;
+      ++total_records;
+      return KeepGoing::Continue;
+    });
+    EXPECT_EQ(metadata.start, first_ts) << "in file " << i;
+    EXPECT_EQ(metadata.end, last_ts) << "in file " << i;
+    prev_end = metadata.end;
+  }
+  EXPECT_EQ(total_records, 100);
+}
+
+TEST_F(RotatingDbnWriterTests, TestTimeBasedRotation) {
+  RotationPolicy policy;
+  policy.max_file_duration = std::chrono::milliseconds{10};
+  RotatingDbnWriter target{kOutputDir, "capture", MboMetadata(), policy};
+  auto first_mbo = MakeMbo(1'000);
+  target.WriteRecord(Record{&first_mbo.hd});
+  std::this_thread::sleep_for(std::chrono::milliseconds{20});
+  auto second_mbo = MakeMbo(2'000);
+  target.WriteRecord(Record{&second_mbo.hd});
+  target.Close();
+  EXPECT_EQ(target.FileCount(), 2);
+  EXPECT_TRUE(Exists(FilePath(0)));
+  EXPECT_TRUE(Exists(FilePath(1)));
+}
+
+TEST_F(RotatingDbnWriterTests, TestCloseSealsEmptyFile) {
+  RotationPolicy policy;
+  policy.max_file_size = 1 << 20;
+  RotatingDbnWriter target{kOutputDir, "capture", MboMetadata(), policy};
+  target.Close();
+  // A file with no records still seals, keeping its original metadata
+  ASSERT_TRUE(Exists(FilePath(0)));
+  EXPECT_FALSE(Exists(FilePath(0, true)));
+  DbnFileStore store{FilePath(0), VersionUpgradePolicy::Upgrade};
+  EXPECT_EQ(store.GetMetadata().schema, Schema::Mbo);
+}
+
+TEST_F(RotatingDbnWriterTests, TestInvalidPolicy) {
+  ASSERT_THROW(RotatingDbnWriter(kOutputDir, "capture", MboMetadata(),
+                                 RotationPolicy{}),
+               InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "databento/detail/file_write_stream.hpp"
+#include "databento/detail/seekable_zstd_stream.hpp"
+#include "databento/detail/zstd_compress_stream.hpp"
+#include "databento/exceptions.hpp"
+#include "temp_file.hpp"
+
+namespace databento {
+namespace detail {
+namespace test {
+namespace {
+std::vector<std::uint8_t> WriteSeekableFile(const std::string& path,
+                                            std::size_t size,
+                                            std::size_t frame_size) {
+  std::vector<std::uint8_t> data(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<std::uint8_t>(i * 7 + i / 256);
+  }
+  // Scoped so the frames and seek table are finished before reading back
+  ZstdCompressStream compressor{
+      3, frame_size,
+      std::unique_ptr<IWritable>{new FileWriteStream{path}}};
+  compressor.WriteAll(data.data(), data.size());
+  return data;
+}
+}  // namespace
+
+TEST(SeekableZstdStreamTests, TestSequentialRead) {
+  TempFile temp_file{testing::TempDir() + "/seq.zst"};
+  const auto data = WriteSeekableFile(temp_file.Path(), 10000, 1024);
+  SeekableZstdStream target{temp_file.Path()};
+  ASSERT_EQ(target.Size(), data.size());
+  std::vector<std::uint8_t> res(data.size());
+  target.ReadExact(res.data(), res.size());
+  EXPECT_EQ(res, data);
+  // End of stream
+  EXPECT_EQ(target.ReadSome(res.data(), 1), 0);
+}
+
+TEST(SeekableZstdStreamTests, TestSeek) {
+  TempFile temp_file{testing::TempDir() + "/seek.zst"};
+  const auto data = WriteSeekableFile(temp_file.Path(), 10000, 1024);
+  SeekableZstdStream target{temp_file.Path()};
+  // Offsets within different frames, unaligned with frame boundaries, in
+  // both directions
+  for (const std::size_t offset : {9000UL, 100UL, 1024UL, 5555UL}) {
+    target.Seek(offset);
+    std::vector<std::uint8_t> res(data.size() - offset);
+    target.ReadExact(res.data(), res.size());
+    const std::vector<std::uint8_t> expected{
+        data.cbegin() + static_cast<std::ptrdiff_t>(offset), data.cend()};
+    EXPECT_EQ(res, expected) << "offset " << offset;
+  }
+}
+
+TEST(SeekableZstdStreamTests, TestMissingSeekTable) {
+  const std::string file_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn.zst";
+  ASSERT_THROW(SeekableZstdStream{file_path}, DbnResponseError);
+}
+}  // namespace test
+}  // namespace detail
+}  // namespace databento
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "databento/datetime.hpp"
+#include "databento/flag_set.hpp"
+#include "databento/record.hpp"
+#include "databento/sequence_tracker.hpp"
+
+namespace databento {
+namespace test {
+class SequenceTrackerTests : public testing::Test {
+ protected:
+  static MboMsg DummyMbo(std::uint32_t instrument_id, std::uint32_t sequence) {
+    MboMsg rec{};
+    rec.hd = {sizeof(MboMsg) / RecordHeader::kLengthMultiplier, RType::Mbo, 1,
+              instrument_id, UnixNanos{}};
+    rec.sequence = sequence;
+    return rec;
+  }
+};
+
+TEST_F(SequenceTrackerTests, TestContiguousSequence) {
+  SequenceTracker target;
+  for (std::uint32_t seq = 10; seq < 20; ++seq) {
+    target.Track(DummyMbo(1, seq));
+  }
+  EXPECT_EQ(target.GapCount(), 0);
+  EXPECT_EQ(target.OutOfOrderCount(), 0);
+  EXPECT_EQ(target.BadBookCount(), 0);
+}
+
+TEST_F(SequenceTrackerTests, TestGapAndHook) {
+  std::vector<SequenceTracker::Gap> gaps;
+  SequenceTracker target{
+      [&gaps](const SequenceTracker::Gap& gap) { gaps.emplace_back(gap); }};
+  target.Track(DummyMbo(1, 1));
+  target.Track(DummyMbo(1, 2));
+  // skips 3 through 9
+  target.Track(DummyMbo(1, 10));
+  target.Track(DummyMbo(1, 11));
+  EXPECT_EQ(target.GapCount(), 1);
+  EXPECT_EQ(target.OutOfOrderCount(), 0);
+  ASSERT_EQ(gaps.size(), 1);
+  EXPECT_EQ(gaps[0].instrument_id, 1);
+  EXPECT_EQ(gaps[0].expected, 3);
+  EXPECT_EQ(gaps[0].received, 10);
+}
+
+TEST_F(SequenceTrackerTests, TestOutOfOrder) {
+  SequenceTracker target;
+  target.Track(DummyMbo(1, 5));
+  target.Track(DummyMbo(1, 6));
+  // a late record shouldn't rewind the baseline
+  target.Track(DummyMbo(1, 4));
+  target.Track(DummyMbo(1, 7));
+  EXPECT_EQ(target.GapCount(), 0);
+  EXPECT_EQ(target.OutOfOrderCount(), 1);
+}
+
+TEST_F(SequenceTrackerTests, TestPerInstrumentTracking) {
+  SequenceTracker target;
+  // interleaved instruments, each individually contiguous
+  for (std::uint32_t seq = 1; seq < 10; ++seq) {
+    target.Track(DummyMbo(1, seq));
+    target.Track(DummyMbo(2, seq + 100));
+  }
+  EXPECT_EQ(target.GapCount(), 0);
+  EXPECT_EQ(target.OutOfOrderCount(), 0);
+}
+
+TEST_F(SequenceTrackerTests, TestBadBookFlagAndNonMbo) {
+  SequenceTracker target;
+  auto flagged = DummyMbo(1, 1);
+  flagged.flags = FlagSet{FlagSet::kMaybeBadBook};
+  target.OnRecord(Record{&flagged.hd});
+  OhlcvMsg ohlcv{{sizeof(OhlcvMsg) / RecordHeader::kLengthMultiplier,
+                  RType::Ohlcv1M, 1, 1, UnixNanos{}},
+                 1,
+                 2,
+                 3,
+                 4,
+                 5};
+  // non-MBO records are ignored
+  target.OnRecord(Record{&ohlcv.hd});
+  EXPECT_EQ(target.BadBookCount(), 1);
+  EXPECT_EQ(target.GapCount(), 0);
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "databento/datetime.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/record.hpp"
+#include "databento/sharded_dispatcher.hpp"
+
+namespace databento {
+namespace test {
+class ShardedDispatcherTests : public testing::Test {
+ protected:
+  static MboMsg DummyMbo(std::uint32_t instrument_id, std::uint32_t sequence) {
+    MboMsg rec{};
+    rec.hd = {sizeof(MboMsg) / RecordHeader::kLengthMultiplier, RType::Mbo, 1,
+              instrument_id, UnixNanos{}};
+    rec.sequence = sequence;
+    return rec;
+  }
+};
+
+TEST_F(ShardedDispatcherTests, TestPerInstrumentOrdering) {
+  constexpr std::uint32_t kInstrumentCount = 16;
+  constexpr std::uint32_t kRecordsPerInstrument = 1000;
+  std::mutex mutex;
+  std::map<std::uint32_t, std::vector<std::uint32_t>> sequences;
+  ShardedDispatcher target{4, [&mutex, &sequences](const Record& rec) {
+                             const auto& mbo = rec.Get<MboMsg>();
+                             const std::lock_guard<std::mutex> lock{mutex};
+                             sequences[mbo.hd.instrument_id].emplace_back(
+                                 mbo.sequence);
+                             return KeepGoing::Continue;
+                           }};
+  EXPECT_EQ(target.WorkerCount(), 4);
+  for (std::uint32_t seq = 0; seq < kRecordsPerInstrument; ++seq) {
+    for (std::uint32_t id = 1; id <= kInstrumentCount; ++id) {
+      auto rec = DummyMbo(id, seq);
+      target.Dispatch(Record{&rec.hd});
+    }
+  }
+  target.Close();
+  ASSERT_EQ(sequences.size(), kInstrumentCount);
+  for (const auto& id_and_seqs : sequences) {
+    ASSERT_EQ(id_and_seqs.second.size(), kRecordsPerInstrument);
+    for (std::uint32_t seq = 0; seq < kRecordsPerInstrument; ++seq) {
+      ASSERT_EQ(id_and_seqs.second[seq], seq)
+          << "out-of-order record for instrument " << id_and_seqs.first;
+    }
+  }
+}
+
+TEST_F(ShardedDispatcherTests, TestStop) {
+  std::atomic<std::uint32_t> processed{0};
+  ShardedDispatcher target{2, 16, [&processed](const Record&) {
+                             return ++processed < 10 ? KeepGoing::Continue
+                                                     : KeepGoing::Stop;
+                           }};
+  for (std::uint32_t seq = 0; seq < 10000; ++seq) {
+    auto rec = DummyMbo(seq % 7, seq);
+    target.Dispatch(Record{&rec.hd});
+  }
+  target.Close();
+  // Records dispatched after the stop are dropped, not processed
+  EXPECT_GE(processed, 10);
+  EXPECT_LT(processed, 10000);
+}
+
+TEST_F(ShardedDispatcherTests, TestCallbackException) {
+  ShardedDispatcher target{2, [](const Record&) -> KeepGoing {
+                             throw std::runtime_error{"callback failure"};
+                           }};
+  auto rec = DummyMbo(1, 0);
+  target.Dispatch(Record{&rec.hd});
+  EXPECT_THROW(target.Close(), std::runtime_error);
+}
+
+TEST_F(ShardedDispatcherTests, TestInvalidWorkerCount) {
+  EXPECT_THROW(ShardedDispatcher(0, [](const Record&) {
+                 return KeepGoing::Continue;
+               }),
+               InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>  // min
 #include <array>
 #include <chrono>
 #include <cstdint>
@@ -85,6 +86,81 @@ TEST_F(SharedChannelTests, TestReadSome) {
 
   ASSERT_EQ(res, "parsestreamtestssomelast");
 }
+TEST_F(SharedChannelTests, TestWatermarks) {
+  // A tiny high watermark forces the writer to park on every chunk while a
+  // low watermark above one byte batches reader wakeups
+  target_ = SharedChannel{64, 16};
+  write_thread_ = ScopedThread{[this] {
+    this->Write({"parse", "stream", "tests", "watermarks"});
+  }};
+  std::array<std::uint8_t, 32> buffer{};
+  std::string res;
+  while (res.size() < 26) {
+    const auto read_size = target_.ReadSome(buffer.data(), buffer.size());
+    ASSERT_GT(read_size, 0);
+    res.append(reinterpret_cast<const char*>(buffer.data()), read_size);
+  }
+  ASSERT_EQ(res, "parsestreamtestswatermarks");
+}
+
+TEST_F(SharedChannelTests, TestInvalidWatermarks) {
+  ASSERT_THROW(SharedChannel(16, 64), InvalidArgumentError);
+}
+
+TEST_F(SharedChannelTests, TestLargeTransfer) {
+  // Several times the channel capacity, so the writer wraps the ring and
+  // parks while the reader catches up
+  constexpr std::size_t kTransferSize = 5 * (1UL << 20);
+  write_thread_ = ScopedThread{[this] {
+    std::vector<std::uint8_t> chunk(100000);
+    std::size_t written{};
+    while (written < kTransferSize) {
+      const auto chunk_size = std::min(chunk.size(), kTransferSize - written);
+      for (std::size_t i = 0; i < chunk_size; ++i) {
+        chunk[i] = static_cast<std::uint8_t>((written + i) * 31);
+      }
+      target_.Write(chunk.data(), chunk_size);
+      written += chunk_size;
+    }
+    target_.Finish();
+  }};
+  std::vector<std::uint8_t> res(kTransferSize);
+  target_.ReadExact(res.data(), res.size());
+  std::size_t mismatches{};
+  for (std::size_t i = 0; i < kTransferSize; ++i) {
+    mismatches += res[i] != static_cast<std::uint8_t>(i * 31);
+  }
+  EXPECT_EQ(mismatches, 0);
+  std::array<std::uint8_t, 1> buffer;
+  EXPECT_EQ(target_.ReadSome(buffer.data(), 1), 0);
+}
+
+TEST_F(SharedChannelTests, TestAbortReleasesBlockedWriter) {
+  // A high watermark the first write fills, so the second parks until the
+  // channel is aborted
+  target_ = SharedChannel{16, 1};
+  write_thread_ = ScopedThread{[this] {
+    const std::array<std::uint8_t, 16> chunk{};
+    target_.Write(chunk.data(), chunk.size());
+    target_.Write(chunk.data(), chunk.size());
+    target_.Finish();
+  }};
+  target_.Abort();
+  // Joining proves the abort released the writer without a reader draining
+  // the channel
+  write_thread_.Join();
+  std::array<std::uint8_t, 32> buffer{};
+  // At most the bytes buffered before the abort remain readable
+  std::size_t total{};
+  while (true) {
+    const auto read_size = target_.ReadSome(buffer.data(), buffer.size());
+    if (read_size == 0) {
+      break;
+    }
+    total += read_size;
+  }
+  EXPECT_LE(total, 16);
+}
 }  // namespace test
 }  // namespace detail
 }  // namespace databento
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>  // remove
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "databento/datetime.hpp"
+#include "databento/exceptions.hpp"
+#include "databento/record.hpp"
+#include "databento/shm_record_fanout.hpp"
+
+namespace databento {
+namespace test {
+class ShmRecordFanoutTests : public testing::Test {
+ protected:
+  static constexpr auto kRingPath = TEST_BUILD_DIR "/shm_fanout_test.ring";
+
+  void TearDown() override { std::remove(kRingPath); }
+
+  static MboMsg DummyMbo(std::uint32_t sequence) {
+    MboMsg rec{};
+    rec.hd = {sizeof(MboMsg) / RecordHeader::kLengthMultiplier, RType::Mbo, 1,
+              1, UnixNanos{}};
+    rec.sequence = sequence;
+    return rec;
+  }
+};
+
+TEST_F(ShmRecordFanoutTests, TestPublishSubscribe) {
+  ShmRecordPublisher publisher{kRingPath, 8};
+  ASSERT_EQ(publisher.Capacity(), 8);
+  ShmRecordSubscriber subscriber{kRingPath};
+  ASSERT_EQ(subscriber.Capacity(), 8);
+  ASSERT_EQ(subscriber.Next(), nullptr);
+  for (std::uint32_t i = 0; i < 5; ++i) {
+    auto rec = DummyMbo(i);
+    publisher.Publish(Record{&rec.hd});
+  }
+  ASSERT_EQ(publisher.RecordCount(), 5);
+  for (std::uint32_t i = 0; i < 5; ++i) {
+    const Record* record = subscriber.Next();
+    ASSERT_NE(record, nullptr);
+    ASSERT_TRUE(record->Holds<MboMsg>());
+    EXPECT_EQ(record->Get<MboMsg>().sequence, i);
+  }
+  EXPECT_EQ(subscriber.Next(), nullptr);
+  EXPECT_EQ(subscriber.LostCount(), 0);
+}
+
+TEST_F(ShmRecordFanoutTests, TestLateJoinerStartsAtOldest) {
+  ShmRecordPublisher publisher{kRingPath, 8};
+  for (std::uint32_t i = 0; i < 20; ++i) {
+    auto rec = DummyMbo(i);
+    publisher.Publish(Record{&rec.hd});
+  }
+  // Only sequences 12 through 19 remain in the ring
+  ShmRecordSubscriber subscriber{kRingPath};
+  for (std::uint32_t i = 12; i < 20; ++i) {
+    const Record* record = subscriber.Next();
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->Get<MboMsg>().sequence, i);
+  }
+  EXPECT_EQ(subscriber.Next(), nullptr);
+  EXPECT_EQ(subscriber.LostCount(), 0);
+}
+
+TEST_F(ShmRecordFanoutTests, TestLappedSubscriberSkipsToOldest) {
+  ShmRecordPublisher publisher{kRingPath, 8};
+  ShmRecordSubscriber subscriber{kRingPath};
+  for (std::uint32_t i = 0; i < 20; ++i) {
+    auto rec = DummyMbo(i);
+    publisher.Publish(Record{&rec.hd});
+  }
+  // The subscriber was lapped: sequences 0 through 11 were overwritten
+  for (std::uint32_t i = 12; i < 20; ++i) {
+    const Record* record = subscriber.Next();
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->Get<MboMsg>().sequence, i);
+  }
+  EXPECT_EQ(subscriber.Next(), nullptr);
+  EXPECT_EQ(subscriber.LostCount(), 12);
+}
+
+TEST_F(ShmRecordFanoutTests, TestTwoThreadFanout) {
+  constexpr std::uint32_t kCount = 100000;
+  ShmRecordPublisher publisher{kRingPath, 512};
+  ShmRecordSubscriber subscriber{kRingPath};
+  std::thread producer{[&publisher] {
+    for (std::uint32_t i = 0; i < kCount; ++i) {
+      auto rec = DummyMbo(i);
+      publisher.Publish(Record{&rec.hd});
+    }
+  }};
+  std::uint64_t read_count = 0;
+  std::uint32_t last_sequence = 0;
+  bool any_read = false;
+  while (read_count + subscriber.LostCount() < kCount) {
+    const Record* record = subscriber.Next();
+    if (record == nullptr) {
+      std::this_thread::yield();
+      continue;
+    }
+    const auto sequence = record->Get<MboMsg>().sequence;
+    if (any_read) {
+      // Sequences never go backwards, even across gaps
+      ASSERT_GT(sequence, last_sequence);
+    }
+    any_read = true;
+    last_sequence = sequence;
+    ++read_count;
+  }
+  producer.join();
+  EXPECT_EQ(read_count + subscriber.LostCount(), kCount);
+  EXPECT_EQ(last_sequence, kCount - 1);
+}
+
+TEST_F(ShmRecordFanoutTests, TestOversizedRecordRejected) {
+  ShmRecordPublisher publisher{kRingPath, 8};
+  auto rec = DummyMbo(1);
+  // A corrupt length byte claiming more than kMaxRecordLen bytes must not
+  // be copied into the shared mapping
+  rec.hd.length = 255;
+  EXPECT_THROW(publisher.Publish(Record{&rec.hd}), InvalidArgumentError);
+  EXPECT_EQ(publisher.RecordCount(), 0);
+}
+
+TEST_F(ShmRecordFanoutTests, TestInvalidArgs) {
+  ASSERT_THROW(ShmRecordPublisher(kRingPath, 0), InvalidArgumentError);
+  ASSERT_THROW(ShmRecordSubscriber{kRingPath}, InvalidArgumentError);
+  {
+    std::ofstream out{kRingPath, std::ios::binary};
+    out << "not a record ring";
+  }
+  ASSERT_THROW(ShmRecordSubscriber{kRingPath}, InvalidArgumentError);
+}
+}  // namespace test
+}  // namespace databento
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <cstring>  // strcmp
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "databento/exceptions.hpp"
+#include "databento/symbol_intern_pool.hpp"
+
+namespace databento {
+namespace test {
+TEST(SymbolInternPoolTests, TestEqualTextYieldsSameHandle) {
+  SymbolInternPool target{16};
+  const char* esh6 = target.Intern("ESH6");
+  const char* nqm6 = target.Intern(std::string{"NQM6"});
+  EXPECT_STREQ(esh6, "ESH6");
+  EXPECT_STREQ(nqm6, "NQM6");
+  EXPECT_NE(esh6, nqm6);
+  // Equality is a pointer compare
+  EXPECT_EQ(target.Intern("ESH6"), esh6);
+  EXPECT_EQ(target.Intern(std::string{"ESH6"}), esh6);
+  EXPECT_EQ(target.Size(), 2);
+}
+
+TEST(SymbolInternPoolTests, TestFindWithoutInterning) {
+  SymbolInternPool target{16};
+  EXPECT_EQ(target.Find("ESH6"), nullptr);
+  const char* esh6 = target.Intern("ESH6");
+  EXPECT_EQ(target.Find("ESH6"), esh6);
+  EXPECT_EQ(target.Find(std::string{"ESH6"}), esh6);
+  EXPECT_EQ(target.Find("ESH"), nullptr);
+  EXPECT_EQ(target.Find("ESH60"), nullptr);
+  // Find never interns
+  EXPECT_EQ(target.Size(), 1);
+}
+
+TEST(SymbolInternPoolTests, TestCapacityExhaustion) {
+  SymbolInternPool target{2};
+  target.Intern("A");
+  target.Intern("B");
+  // Re-interning doesn't count against capacity
+  target.Intern("A");
+  ASSERT_THROW(target.Intern("C"), Exception);
+}
+
+TEST(SymbolInternPoolTests, TestSymbolLongerThanChunk) {
+  SymbolInternPool target{16};
+  const std::string huge(1 << 17, 'X');
+  const char* handle = target.Intern(huge);
+  EXPECT_EQ(handle, target.Intern(huge));
+  EXPECT_EQ(huge, handle);
+  // Later symbols are unaffected
+  EXPECT_STREQ(target.Intern("ESH6"), "ESH6");
+}
+
+TEST(SymbolInternPoolTests, TestConcurrentInternConverges) {
+  constexpr std::size_t kThreads = 4;
+  constexpr std::size_t kSymbols = 500;
+  SymbolInternPool target{1024};
+  std::vector<std::vector<const char*>> handles(kThreads);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&target, &handles, t] {
+      for (std::size_t i = 0; i < kSymbols; ++i) {
+        handles[t].emplace_back(target.Intern("SYM" + std::to_string(i)));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(target.Size(), kSymbols);
+  // All threads got identical handles for identical text
+  for (std::size_t t = 1; t < kThreads; ++t) {
+    EXPECT_EQ(handles[t], handles[0]);
+  }
+  // And the handles are distinct per symbol
+  const std::set<const char*> distinct{handles[0].begin(), handles[0].end()};
+  EXPECT_EQ(distinct.size(), kSymbols);
+}
+
+TEST(SymbolInternPoolTests, TestSharedPool) {
+  SymbolInternPool& shared = SymbolInternPool::Shared();
+  const char* handle = shared.Intern("SHARED.TEST");
+  EXPECT_EQ(&SymbolInternPool::Shared(), &shared);
+  EXPECT_EQ(shared.Intern("SHARED.TEST"), handle);
+}
+}  // namespace test
+}  // namespace databento
@@ -6,6 +6,8 @@
 #include <unordered_map>
 
 #include "databento/compat.hpp"
+#include "databento/dbn.hpp"
+#include "databento/exceptions.hpp"
 #include "databento/record.hpp"
 #include "databento/symbol_map.hpp"
 
@@ -54,5 +56,155 @@ TEST(PitSymbolMapTests, TestOnRecord) {
   target.OnRecord(Record{&sm2.hd});
   ASSERT_EQ(target[1], "MSFT");
 }
+
+TEST(FlatPitSymbolMapTests, TestOnSymbolMapping) {
+  FlatPitSymbolMap target;
+  EXPECT_TRUE(target.IsEmpty());
+  EXPECT_EQ(target.Find(1), nullptr);
+  target.OnSymbolMapping(GenMapping<SymbolMappingMsgV1>(1, "AAPL"));
+  target.OnSymbolMapping(GenMapping<SymbolMappingMsgV2>(2, "TSLA"));
+  target.OnSymbolMapping(GenMapping<SymbolMappingMsgV1>(3, "MSFT"));
+  EXPECT_EQ(target.Size(), 3);
+  EXPECT_STREQ(target.Find(1), "AAPL");
+  EXPECT_STREQ(target.Find(2), "TSLA");
+  EXPECT_STREQ(target.Find(3), "MSFT");
+  EXPECT_EQ(target.Find(4), nullptr);
+  // Remapping replaces in place
+  target.OnSymbolMapping(GenMapping<SymbolMappingMsgV2>(1, "MSFT"));
+  EXPECT_EQ(target.Size(), 3);
+  EXPECT_STREQ(target.Find(1), "MSFT");
+}
+
+TEST(FlatPitSymbolMapTests, TestOnRecord) {
+  FlatPitSymbolMap target;
+  auto sm1 = GenMapping<SymbolMappingMsgV1>(1, "AAPL");
+  target.OnRecord(Record{&sm1.hd});
+  auto sm2 = GenMapping<SymbolMappingMsgV2>(2, "TSLA");
+  target.OnRecord(Record{&sm2.hd});
+  EXPECT_EQ(target.Size(), 2);
+  EXPECT_STREQ(target.Find(1), "AAPL");
+  EXPECT_STREQ(target.Find(2), "TSLA");
+  sm2 = GenMapping<SymbolMappingMsgV2>(1, "MSFT");
+  target.OnRecord(Record{&sm2.hd});
+  EXPECT_STREQ(target.Find(1), "MSFT");
+}
+
+TEST(FlatPitSymbolMapTests, TestGrowth) {
+  FlatPitSymbolMap target;
+  // Well past the initial capacity, forcing several rehashes
+  constexpr std::uint32_t kMappingCount = 1000;
+  for (std::uint32_t id = 1; id <= kMappingCount; ++id) {
+    target.Insert(id, ("SYM" + std::to_string(id)).c_str());
+  }
+  ASSERT_EQ(target.Size(), kMappingCount);
+  for (std::uint32_t id = 1; id <= kMappingCount; ++id) {
+    ASSERT_STREQ(target.Find(id), ("SYM" + std::to_string(id)).c_str());
+  }
+  EXPECT_EQ(target.Find(kMappingCount + 1), nullptr);
+}
+
+TEST(DensePitSymbolMapTests, TestOnSymbolMapping) {
+  DensePitSymbolMap target;
+  EXPECT_TRUE(target.IsEmpty());
+  EXPECT_EQ(target.Find(5482), nullptr);
+  target.OnSymbolMapping(GenMapping<SymbolMappingMsgV1>(5482, "ESH1"));
+  target.OnSymbolMapping(GenMapping<SymbolMappingMsgV2>(5483, "ESM1"));
+  EXPECT_EQ(target.Size(), 2);
+  EXPECT_STREQ(target.Find(5482), "ESH1");
+  EXPECT_STREQ(target.Find(5483), "ESM1");
+  EXPECT_EQ(target.Find(5484), nullptr);
+  // Remapping replaces in place
+  target.OnSymbolMapping(GenMapping<SymbolMappingMsgV2>(5482, "ESU1"));
+  EXPECT_EQ(target.Size(), 2);
+  EXPECT_STREQ(target.Find(5482), "ESU1");
+}
+
+TEST(DensePitSymbolMapTests, TestOnRecord) {
+  DensePitSymbolMap target;
+  auto sm1 = GenMapping<SymbolMappingMsgV1>(1, "AAPL");
+  target.OnRecord(Record{&sm1.hd});
+  auto sm2 = GenMapping<SymbolMappingMsgV2>(2, "TSLA");
+  target.OnRecord(Record{&sm2.hd});
+  EXPECT_EQ(target.Size(), 2);
+  EXPECT_STREQ(target.Find(1), "AAPL");
+  EXPECT_STREQ(target.Find(2), "TSLA");
+  sm2 = GenMapping<SymbolMappingMsgV2>(1, "MSFT");
+  target.OnRecord(Record{&sm2.hd});
+  EXPECT_STREQ(target.Find(1), "MSFT");
+}
+
+TEST(DensePitSymbolMapTests, TestOutliers) {
+  DensePitSymbolMap target;
+  // IDs well below and far above the window around the first-seen ID take
+  // the sparse fallback
+  target.Insert(1000000, "NEAR");
+  target.Insert(1000500, "ALSO_NEAR");
+  target.Insert(5, "BELOW");
+  target.Insert(4000000000, "ABOVE");
+  EXPECT_EQ(target.Size(), 4);
+  EXPECT_STREQ(target.Find(1000000), "NEAR");
+  EXPECT_STREQ(target.Find(1000500), "ALSO_NEAR");
+  EXPECT_STREQ(target.Find(5), "BELOW");
+  EXPECT_STREQ(target.Find(4000000000), "ABOVE");
+  EXPECT_EQ(target.Find(6), nullptr);
+  EXPECT_EQ(target.Find(1000001), nullptr);
+  // Remapping an outlier doesn't change the count
+  target.Insert(5, "STILL_BELOW");
+  EXPECT_EQ(target.Size(), 4);
+  EXPECT_STREQ(target.Find(5), "STILL_BELOW");
+}
+
+TEST(TsSymbolMapTests, TestFind) {
+  Metadata metadata{};
+  metadata.stype_in = SType::RawSymbol;
+  metadata.stype_out = SType::InstrumentId;
+  metadata.mappings = {
+      SymbolMapping{"ESH1",
+                    {MappingInterval{20201228, 20210315, "5482"},
+                     // Unresolved days are skipped
+                     MappingInterval{20210315, 20210320, ""}}},
+      SymbolMapping{"ESM1", {MappingInterval{20210315, 20210614, "5482"}}},
+      SymbolMapping{"AAPL", {MappingInterval{20201228, 20210614, "32"}}}};
+  const TsSymbolMap target{metadata};
+  EXPECT_FALSE(target.IsEmpty());
+  EXPECT_EQ(target.Size(), 3);
+  ASSERT_NE(target.Find(20201228, 5482), nullptr);
+  EXPECT_EQ(*target.Find(20201228, 5482), "ESH1");
+  EXPECT_EQ(*target.Find(20210314, 5482), "ESH1");
+  // Start date is inclusive, so the roll takes effect on 2021-03-15
+  EXPECT_EQ(*target.Find(20210315, 5482), "ESM1");
+  EXPECT_EQ(*target.Find(20210613, 5482), "ESM1");
+  // End date is exclusive
+  EXPECT_EQ(target.Find(20210614, 5482), nullptr);
+  EXPECT_EQ(target.Find(20201227, 5482), nullptr);
+  EXPECT_EQ(*target.Find(20210101, 32), "AAPL");
+  EXPECT_EQ(target.Find(20210101, 33), nullptr);
+}
+
+TEST(TsSymbolMapTests, TestFindInverseMapping) {
+  // stype_in is instrument ID, so the IDs are the raw symbols
+  Metadata metadata{};
+  metadata.stype_in = SType::InstrumentId;
+  metadata.stype_out = SType::RawSymbol;
+  metadata.mappings = {
+      SymbolMapping{"5482",
+                    {MappingInterval{20201228, 20210315, "ESH1"},
+                     MappingInterval{20210315, 20210614, "ESM1"}}}};
+  const TsSymbolMap target{metadata};
+  EXPECT_EQ(target.Size(), 2);
+  EXPECT_EQ(*target.Find(20210314, 5482), "ESH1");
+  EXPECT_EQ(*target.Find(20210315, 5482), "ESM1");
+}
+
+TEST(TsSymbolMapTests, TestInvalidMetadata) {
+  Metadata metadata{};
+  metadata.stype_in = SType::RawSymbol;
+  metadata.stype_out = SType::Parent;
+  ASSERT_THROW(TsSymbolMap{metadata}, InvalidArgumentError);
+  metadata.stype_out = SType::InstrumentId;
+  metadata.mappings = {
+      SymbolMapping{"ESH1", {MappingInterval{20201228, 20210315, "ESH1"}}}};
+  ASSERT_THROW(TsSymbolMap{metadata}, InvalidArgumentError);
+}
 }  // namespace test
 }  // namespace databento
@@ -33,5 +33,46 @@ TEST(SymbologyTests, TestSymbologyResolutionToString) {
     FAIL() << res;
   }
 }
+
+TEST(SymbologyTests, TestFlatSymbologyResolution) {
+  const SymbologyResolution resolution{
+      {
+          {"ESM2",
+           {{"2022-06-13", "2022-06-17", "12344"},
+            {"2022-06-01", "2022-06-13", "12343"}}},
+          {"ESU2", {{"2022-06-01", "2022-07-01", "12345"}}},
+      },
+      {"ESM2"},
+      {"EEES"},
+  };
+  const FlatSymbologyResolution target{resolution};
+  EXPECT_FALSE(target.IsEmpty());
+  ASSERT_EQ(target.Size(), 2);
+  // Mappings are sorted by input symbol regardless of hash order
+  EXPECT_STREQ(target.Mappings()[0].input_symbol, "ESM2");
+  EXPECT_STREQ(target.Mappings()[1].input_symbol, "ESU2");
+  const auto* mapping = target.Find("ESM2");
+  ASSERT_NE(mapping, nullptr);
+  ASSERT_EQ(mapping->interval_count, 2);
+  // Intervals are sorted by start date within a mapping
+  const auto& first = target.Intervals()[mapping->interval_begin];
+  const auto& second = target.Intervals()[mapping->interval_begin + 1];
+  EXPECT_STREQ(first.start_date, "2022-06-01");
+  EXPECT_STREQ(first.end_date, "2022-06-13");
+  EXPECT_STREQ(first.symbol, "12343");
+  EXPECT_STREQ(second.start_date, "2022-06-13");
+  EXPECT_STREQ(second.symbol, "12344");
+  EXPECT_EQ(target.Find("EEES"), nullptr);
+  ASSERT_EQ(target.Partial().size(), 1);
+  EXPECT_STREQ(target.Partial()[0], "ESM2");
+  ASSERT_EQ(target.NotFound().size(), 1);
+  EXPECT_STREQ(target.NotFound()[0], "EEES");
+  // Repeated text is interned once: the shared boundary date resolves to
+  // the same pooled string
+  EXPECT_EQ(first.end_date, second.start_date);
+  // Copies share the pool, so views from a copy remain valid
+  FlatSymbologyResolution copy{target};
+  EXPECT_STREQ(copy.Find("ESU2")->input_symbol, "ESU2");
+}
 }  // namespace test
 }  // namespace databento
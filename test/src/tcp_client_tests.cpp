@@ -141,6 +141,61 @@ TEST_F(TcpClientTests, TestReadCloseNoTimeout) {
   EXPECT_LT(end - start, kTimeout);
 }
 
+TEST_F(TcpClientTests, TestSocketConf) {
+  mock::MockTcpServer mock_server;
+  detail::TcpClient::SocketConf socket_conf;
+  socket_conf.tcp_nodelay = true;
+  socket_conf.recv_buffer_size = 1UL << 20;
+  target_ = {"127.0.0.1", mock_server.Port(), {}, socket_conf};
+
+  const std::string msg = "testing with socket options";
+  target_.WriteAll(msg);
+  ASSERT_EQ(mock_server.AwaitReceived(), msg);
+}
+
+TEST_F(TcpClientTests, TestConnectFromAddressList) {
+  mock::MockTcpServer mock_server;
+  // port 1 is almost certainly closed, so connecting should fall through to
+  // the live address
+  auto addresses = detail::TcpClient::Resolve("127.0.0.1", 1);
+  const auto live_addresses =
+      detail::TcpClient::Resolve("127.0.0.1", mock_server.Port());
+  addresses.insert(addresses.end(), live_addresses.begin(),
+                   live_addresses.end());
+  target_ = {addresses, {}, {}};
+
+  const std::string msg = "cached addresses";
+  target_.WriteAll(msg);
+  ASSERT_EQ(mock_server.AwaitReceived(), msg);
+}
+
+#ifdef __linux__
+TEST_F(TcpClientTests, TestIoUringReadSome) {
+  mock::MockTcpServer mock_server;
+  detail::TcpClient::SocketConf socket_conf;
+  socket_conf.io_uring = true;
+  target_ = {"127.0.0.1", mock_server.Port(), {}, socket_conf};
+
+  const std::string kSendData = "Uring data";
+  mock_server.SetSend(kSendData);
+  // no data before the server receives, so the first read times out
+  std::array<char, 11> buffer{0};
+  auto res = target_.ReadSome(buffer.data(), buffer.size() - 1,
+                              std::chrono::milliseconds{5});
+  EXPECT_EQ(res.status, detail::TcpClient::Status::Timeout);
+  EXPECT_EQ(res.read_size, 0);
+  target_.WriteAll("start");
+  res = target_.ReadSome(buffer.data(), buffer.size() - 1,
+                         std::chrono::milliseconds{0});
+  EXPECT_STREQ(buffer.data(), kSendData.c_str());
+  EXPECT_EQ(res.status, detail::TcpClient::Status::Ok);
+  EXPECT_EQ(res.read_size, kSendData.length());
+  // server closed the connection after sending
+  res = target_.ReadSome(buffer.data(), buffer.size());
+  EXPECT_EQ(res.status, detail::TcpClient::Status::Closed);
+}
+#endif
+
 TEST_F(TcpClientTests, ReadAfterClose) {
   const std::string kSendData = "Read after close";
   mock_server_.SetSend(kSendData);
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>  // future
+#include <stdexcept>
+#include <vector>
+
+#include "databento/detail/work_stealing_executor.hpp"
+
+namespace databento {
+namespace detail {
+namespace test {
+TEST(WorkStealingExecutorTests, TestSubmitReturnsResults) {
+  WorkStealingExecutor target{4};
+  std::vector<std::future<int>> futures;
+  for (int i = 0; i < 100; ++i) {
+    futures.emplace_back(target.Submit([i]() { return i * 2; }));
+  }
+  int sum{};
+  for (auto& future : futures) {
+    sum += future.get();
+  }
+  ASSERT_EQ(sum, 9900);
+}
+
+TEST(WorkStealingExecutorTests, TestSubmitPropagatesExceptions) {
+  WorkStealingExecutor target{2};
+  std::future<int> future =
+      target.Submit([]() -> int { throw std::logic_error{"tested"}; });
+  ASSERT_THROW(future.get(), std::logic_error);
+}
+
+TEST(WorkStealingExecutorTests, TestDestructorDrainsQueues) {
+  std::atomic<int> run_count{};
+  {
+    WorkStealingExecutor target{2};
+    for (int i = 0; i < 50; ++i) {
+      target.Submit([&run_count]() { ++run_count; });
+    }
+  }
+  ASSERT_EQ(run_count.load(), 50);
+}
+
+TEST(WorkStealingExecutorTests, TestNestedSubmissionsAreStolen) {
+  WorkStealingExecutor target{4};
+  std::atomic<int> run_count{};
+  // One task fans out enough nested tasks that idle workers must steal
+  target
+      .Submit([&target, &run_count]() {
+        std::vector<std::future<void>> futures;
+        for (int i = 0; i < 200; ++i) {
+          futures.emplace_back(
+              target.Submit([&run_count]() { ++run_count; }));
+        }
+        for (auto& future : futures) {
+          future.get();
+        }
+      })
+      .get();
+  ASSERT_EQ(run_count.load(), 200);
+}
+
+TEST(WorkStealingExecutorTests, TestBoundedQueueAppliesBackpressure) {
+  // A single worker with a tiny deque forces the submitter to block for
+  // space rather than queueing unboundedly
+  WorkStealingExecutor target{1, 2};
+  std::atomic<int> run_count{};
+  std::vector<std::future<void>> futures;
+  for (int i = 0; i < 100; ++i) {
+    futures.emplace_back(target.Submit([&run_count]() { ++run_count; }));
+  }
+  for (auto& future : futures) {
+    future.get();
+  }
+  ASSERT_EQ(run_count.load(), 100);
+}
+
+TEST(WorkStealingExecutorTests, TestSharedInstance) {
+  WorkStealingExecutor& first = WorkStealingExecutor::Shared();
+  WorkStealingExecutor& second = WorkStealingExecutor::Shared();
+  ASSERT_EQ(&first, &second);
+  ASSERT_GE(first.ThreadCount(), 1);
+  ASSERT_EQ(first.Submit([]() { return 7; }).get(), 7);
+}
+}  // namespace test
+}  // namespace detail
+}  // namespace databento
@@ -2,7 +2,9 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>  // memcmp
 #include <memory>
+#include <vector>
 
 #include "databento/compat.hpp"
 #include "databento/detail/file_stream.hpp"
@@ -27,6 +29,57 @@ TEST(ZstdStreamTests, TestMultiFrameFiles) {
     EXPECT_EQ(def_msg.hd.rtype, databento::rtype::InstrumentDef);
   }
 }
+TEST(ZstdStreamTests, TestDecodeDictAndContextReuse) {
+  const std::string file_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn.zst";
+  // A raw content dictionary. The test file wasn't compressed with it, so it
+  // goes unused, but the stream still references it and must decode the same
+  // bytes as a dictionary-less stream.
+  const std::vector<std::uint8_t> dict_data(512, 0xAB);
+  const auto dict = std::make_shared<databento::detail::ZstdDecodeDict>(
+      dict_data.data(), dict_data.size());
+  std::vector<std::uint8_t> expected;
+  {
+    databento::detail::ZstdStream plain{std::unique_ptr<databento::IReadable>{
+        new databento::detail::FileStream{file_path}}};
+    std::uint8_t buffer[64];
+    std::size_t read_size;
+    while ((read_size = plain.ReadSome(buffer, sizeof(buffer))) > 0) {
+      expected.insert(expected.end(), buffer, buffer + read_size);
+    }
+  }
+  // Successive streams recycle decompression contexts from the pool
+  for (std::size_t i = 0; i < 3; ++i) {
+    databento::detail::ZstdStream target{
+        std::unique_ptr<databento::IReadable>{
+            new databento::detail::FileStream{file_path}},
+        dict};
+    std::vector<std::uint8_t> res(expected.size());
+    target.ReadExact(res.data(), res.size());
+    EXPECT_EQ(res, expected);
+  }
+}
+
+TEST(ZstdStreamTests, TestPipelinedMatchesSynchronous) {
+  const std::string file_path = TEST_BUILD_DIR "/data/test_data.mbo.dbn.zst";
+
+  databento::detail::ZstdStream synchronous{
+      std::unique_ptr<databento::IReadable>{
+          new databento::detail::FileStream{file_path}}};
+  const auto pipelined = databento::detail::ZstdStream::CreatePipelined(
+      std::unique_ptr<databento::IReadable>{
+          new databento::detail::FileStream{file_path}});
+  while (true) {
+    std::uint8_t sync_buffer[64];
+    std::uint8_t pipe_buffer[64];
+    const auto read_size = synchronous.ReadSome(sync_buffer, 64);
+    if (read_size == 0) {
+      EXPECT_EQ(pipelined->ReadSome(pipe_buffer, 64), 0);
+      break;
+    }
+    pipelined->ReadExact(pipe_buffer, read_size);
+    EXPECT_EQ(std::memcmp(sync_buffer, pipe_buffer, read_size), 0);
+  }
+}
 }  // namespace test
 }  // namespace detail
 }  // namespace databento